@@ -22,5 +22,6 @@ struct StarkFiles
     bool mapConstPolsFile;
     std::string zkevmConstantsTree;
     std::string zkevmStarkInfo;
+    std::string zkevmDomainTables;
 };
 #endif // CONSTANT_POLS_ABSTARCT_HPP
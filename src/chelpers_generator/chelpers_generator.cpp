@@ -0,0 +1,614 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <regex>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+/*
+    Chelpers generator
+    Turns a *_parser_first_avx() function, i.e. a loop that interprets the op/args tables of a step with a switch for
+    every batch of rows, into a straight-line function where every operation is written with its arguments as constants.
+    The generated function is named *_parser_first_avx_compiled(), returns true, and is only compiled with COMPILED_CHELPERS;
+    the interpreter is used otherwise.
+    With --avx512 it turns a parser file into its AVX-512 version instead, i.e. the *_parser_first_avx*() functions
+    rewritten for 8 rows per batch, which the Makefile builds as *.parser.avx512.cpp.
+    With --tiled it writes the table of the arguments of every case that address polynomials by row, with their
+    dimension, which the tiled step42ns evaluation needs to copy the columns read by the expression.
+*/
+
+// Parsers to compile by default: parser code, parser tables, generated code
+const vector<vector<string>> defaultParsers = {
+    {"src/starkpil/zkevm/chelpers/zkevm.chelpers.step3.parser.cpp", "src/starkpil/zkevm/chelpers/zkevm.chelpers.step3.parser.hpp", "src/starkpil/zkevm/chelpers/zkevm.chelpers.step3.compiled.cpp"},
+    {"src/starkpil/zkevm/chelpers/zkevm.chelpers.step42ns.parser.cpp", "src/starkpil/zkevm/chelpers/zkevm.chelpers.step42ns.parser.hpp", "src/starkpil/zkevm/chelpers/zkevm.chelpers.step42ns.compiled.cpp"}};
+
+// Forward declaration
+string file2string(const string &fileName);
+void string2file(const string &s, const string &fileName);
+uint64_t matchBrace(const string &s, uint64_t openPos);
+void parseTables(const string &hpp, vector<string> &defines, vector<uint64_t> &ops, vector<uint64_t> &args, string &opsName, string &argsName);
+string compileCase(const string &body, const string &argsName, const vector<uint64_t> &args, uint64_t &i_args);
+string findInterpreter(const string &cpp, const string &parserFileName, uint64_t &functionStart, string &functionName);
+map<uint64_t, string> parseCases(const string &function, uint64_t &loopStart, uint64_t &loopEnd);
+string generate(const string &parserFileName, const string &tablesFileName);
+string generateAvx512(const string &parserFileName);
+string generateTiled(const string &parserFileName, const string &tablesFileName);
+
+int main(int argc, char **argv)
+{
+    cout << "Chelpers generator" << endl;
+
+    vector<vector<string>> parsers = defaultParsers;
+    if ((argc == 4) && (string(argv[1]) == "--avx512"))
+    {
+        string2file(generateAvx512(argv[2]), argv[3]);
+        cout << "Chelpers generator generated " << argv[3] << endl;
+        return EXIT_SUCCESS;
+    }
+    else if ((argc == 5) && (string(argv[1]) == "--tiled"))
+    {
+        string2file(generateTiled(argv[2], argv[3]), argv[4]);
+        cout << "Chelpers generator generated " << argv[4] << endl;
+        return EXIT_SUCCESS;
+    }
+    else if (argc == 4)
+    {
+        parsers = {{argv[1], argv[2], argv[3]}};
+    }
+    else if (argc != 1)
+    {
+        cerr << "usage: chelpersGenerator [<parser_cpp> <parser_hpp> <output_cpp>]" << endl;
+        cerr << "       chelpersGenerator --avx512 <parser_cpp> <output_cpp>" << endl;
+        cerr << "       chelpersGenerator --tiled <parser_cpp> <parser_hpp> <output_hpp>" << endl;
+        return EXIT_FAILURE;
+    }
+
+    for (uint64_t i = 0; i < parsers.size(); i++)
+    {
+        string code = generate(parsers[i][0], parsers[i][1]);
+        string2file(code, parsers[i][2]);
+        cout << "Chelpers generator generated " << parsers[i][2] << endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+string file2string(const string &fileName)
+{
+    ifstream inputStream(fileName);
+    if (!inputStream.good())
+    {
+        cerr << "Error: Chelpers generator failed loading input file " << fileName << endl;
+        exit(-1);
+    }
+    stringstream buffer;
+    buffer << inputStream.rdbuf();
+    return buffer.str();
+}
+
+void string2file(const string &s, const string &fileName)
+{
+    ofstream outfile;
+    outfile.open(fileName);
+    outfile << s << endl;
+    outfile.close();
+}
+
+// Returns the position of the brace that closes the one at openPos
+uint64_t matchBrace(const string &s, uint64_t openPos)
+{
+    int64_t depth = 0;
+    for (uint64_t i = openPos; i < s.size(); i++)
+    {
+        if (s[i] == '{')
+            depth++;
+        else if (s[i] == '}')
+        {
+            depth--;
+            if (depth == 0)
+                return i;
+        }
+    }
+    cerr << "Error: Chelpers generator found an unbalanced brace at position " << openPos << endl;
+    exit(-1);
+}
+
+// Tables are too long to be parsed with std::regex, so their lines are parsed by hand
+void parseTables(const string &hpp, vector<string> &defines, vector<uint64_t> &ops, vector<uint64_t> &args, string &opsName, string &argsName)
+{
+    stringstream ss(hpp);
+    string line;
+    while (getline(ss, line))
+    {
+        if (line.rfind("#define", 0) == 0)
+        {
+            defines.push_back(line);
+            continue;
+        }
+        uint64_t typeEnd;
+        if (line.rfind("uint64_t ", 0) == 0)
+            typeEnd = 9;
+        else if (line.rfind("inline uint64_t ", 0) == 0)
+            typeEnd = 16;
+        else
+            continue;
+
+        uint64_t nameStart = line.find_first_not_of(' ', typeEnd);
+        uint64_t sizeStart = line.find('[', nameStart);
+        uint64_t sizeEnd = line.find(']', sizeStart);
+        uint64_t valuesStart = line.find('{', sizeEnd);
+        uint64_t valuesEnd = line.find('}', valuesStart);
+        if ((sizeStart == string::npos) || (sizeEnd == string::npos) || (valuesStart == string::npos) || (valuesEnd == string::npos))
+            continue;
+
+        vector<uint64_t> values;
+        stringstream valuesStream(line.substr(valuesStart + 1, valuesEnd - valuesStart - 1));
+        string value;
+        while (getline(valuesStream, value, ','))
+        {
+            uint64_t digit = value.find_first_of("0123456789");
+            if (digit != string::npos)
+                values.push_back(stoull(value.substr(digit)));
+        }
+        string name = line.substr(nameStart, sizeStart - nameStart);
+        string size = line.substr(sizeStart + 1, sizeEnd - sizeStart - 1);
+        if (size == "NOPS_")
+        {
+            opsName = name;
+            ops = values;
+        }
+        else if (size == "NARGS_")
+        {
+            argsName = name;
+            args = values;
+        }
+    }
+    if ((opsName == "") || (argsName == ""))
+    {
+        cerr << "Error: Chelpers generator did not find the NOPS_ and NARGS_ tables" << endl;
+        exit(-1);
+    }
+}
+
+// Returns the code of a case with its arguments replaced by constants, and advances i_args as the case does
+string compileCase(const string &body, const string &argsName, const vector<uint64_t> &args, uint64_t &i_args)
+{
+    static const regex tokenRegex("(\\w+)\\[\\s*i_args\\s*(?:\\+\\s*(\\d+)\\s*)?\\]|i_args\\s*\\+=\\s*(\\d+)\\s*;|break\\s*;");
+    string code;
+    uint64_t offset = 0;
+    uint64_t last = 0;
+    for (sregex_iterator it(body.begin(), body.end(), tokenRegex); it != sregex_iterator(); it++)
+    {
+        code += body.substr(last, it->position(0) - last);
+        last = it->position(0) + it->length(0);
+        if ((*it)[1].matched)
+        {
+            if ((*it)[1].str() != argsName)
+            {
+                cerr << "Error: Chelpers generator found unexpected table " << (*it)[1].str() << " indexed by i_args" << endl;
+                exit(-1);
+            }
+            uint64_t k = (*it)[2].matched ? stoull((*it)[2].str()) : 0;
+            uint64_t value = args.at(i_args + offset + k);
+            code += to_string(value) + ((value > 0x7FFFFFFF) ? "ULL" : "");
+        }
+        else if ((*it)[3].matched)
+        {
+            offset += stoull((*it)[3].str());
+        }
+    }
+    code += body.substr(last);
+    if (code.find("i_args") != string::npos)
+    {
+        cerr << "Error: Chelpers generator could not resolve every use of i_args in " << body << endl;
+        exit(-1);
+    }
+    i_args += offset;
+
+    // Drop empty lines
+    stringstream ss(code);
+    string line;
+    string result;
+    while (getline(ss, line))
+    {
+        if (line.find_first_not_of(" \t\r") != string::npos)
+            result += line + "\n";
+    }
+    return result;
+}
+
+// Returns the interpreter function, i.e. the first *_parser_first_avx*() function with the operations loop
+string findInterpreter(const string &cpp, const string &parserFileName, uint64_t &functionStart, string &functionName)
+{
+    uint64_t cppLoopStart = cpp.find("for (int kk = 0; kk < NOPS_; ++kk)");
+    if (cppLoopStart == string::npos)
+    {
+        cerr << "Error: Chelpers generator did not find the operations loop in " << parserFileName << endl;
+        exit(-1);
+    }
+    functionStart = cpp.rfind("\nvoid ", cppLoopStart) + 1;
+    uint64_t namePos = cpp.find("_parser_first_avx", functionStart);
+    if ((functionStart == 0) || (namePos == string::npos) || (namePos > cppLoopStart))
+    {
+        cerr << "Error: Chelpers generator did not find a *_parser_first_avx*() function in " << parserFileName << endl;
+        exit(-1);
+    }
+    uint64_t functionEnd = matchBrace(cpp, cpp.find('{', namePos));
+    functionName = cpp.substr(cpp.rfind(':', namePos) + 1, namePos - cpp.rfind(':', namePos) - 1) + "_parser_first_avx";
+    return cpp.substr(functionStart, functionEnd + 1 - functionStart);
+}
+
+// Returns the code of every case of the switch of the operations loop of an interpreter function, and the loop position
+map<uint64_t, string> parseCases(const string &function, uint64_t &loopStart, uint64_t &loopEnd)
+{
+    loopStart = function.find("for (int kk = 0; kk < NOPS_; ++kk)");
+    loopEnd = matchBrace(function, function.find('{', loopStart));
+    string loop = function.substr(loopStart, loopEnd + 1 - loopStart);
+
+    map<uint64_t, string> cases;
+    uint64_t casePos = loop.find("case ");
+    while (casePos != string::npos)
+    {
+        uint64_t bodyStart = loop.find('{', casePos);
+        uint64_t bodyEnd = matchBrace(loop, bodyStart);
+        cases[stoull(loop.substr(casePos + 5))] = loop.substr(bodyStart + 1, bodyEnd - bodyStart - 1);
+        casePos = loop.find("case ", bodyEnd);
+    }
+    return cases;
+}
+
+string generate(const string &parserFileName, const string &tablesFileName)
+{
+    string cpp = file2string(parserFileName);
+    string hpp = file2string(tablesFileName);
+
+    vector<string> defines;
+    vector<uint64_t> ops, args;
+    string opsName, argsName;
+    parseTables(hpp, defines, ops, args, opsName, argsName);
+
+    uint64_t functionStart;
+    string functionName;
+    string function = findInterpreter(cpp, parserFileName, functionStart, functionName);
+    uint64_t loopStart, loopEnd;
+    map<uint64_t, string> cases = parseCases(function, loopStart, loopEnd);
+
+    // Write every operation with its arguments, since i_args is known at generation time
+    string code;
+    uint64_t i_args = 0;
+    for (uint64_t kk = 0; kk < ops.size(); kk++)
+    {
+        if (cases.find(ops[kk]) == cases.end())
+        {
+            cerr << "Error: Chelpers generator found operation " << ops[kk] << " without case in " << functionName << endl;
+            exit(-1);
+        }
+        code += "          // " + to_string(kk) + ": " + to_string(ops[kk]) + "\n          {\n";
+        code += compileCase(cases[ops[kk]], argsName, args, i_args);
+        code += "          }\n";
+    }
+    if (i_args != args.size())
+    {
+        cerr << "Error: Chelpers generator consumed " << i_args << " arguments instead of " << args.size() << " in " << functionName << endl;
+        exit(-1);
+    }
+
+    // Replace the loop, drop i_args and rename the function
+    string prologue = function.substr(0, loopStart);
+    string epilogue = function.substr(loopEnd + 1);
+    prologue = regex_replace(prologue, regex("[ \\t]*int i_args = 0;[^\\n]*\\n"), "");
+    epilogue = regex_replace(epilogue, regex("[ \\t]*if \\(i_args != NARGS_\\)[^\\n]*\\n[^\\n]*\\n"), "");
+    epilogue = regex_replace(epilogue, regex("[ \\t]*assert\\(i_args == NARGS_\\);[^\\n]*\\n"), "");
+    prologue.replace(0, 4, "bool");
+    prologue = regex_replace(prologue, regex("_parser_first_avx\\w*\\("), "_parser_first_avx_compiled(", regex_constants::format_first_only);
+    prologue = regex_replace(prologue, regex(",\\s*const uint64_t \\*" + argsName + "\\)"), ")"); // Arguments are constants in the compiled function
+    epilogue = epilogue.substr(0, epilogue.rfind('}')) + "     return true;\n}";
+
+    // Includes and defines of the parser, except its tables
+    string header = "// Generated by chelpersGenerator from " + parserFileName + "; do not edit\n\n#ifdef COMPILED_CHELPERS\n\n";
+    string tablesBaseName = tablesFileName.substr(tablesFileName.rfind('/') + 1);
+    stringstream ss(cpp.substr(0, functionStart));
+    string line;
+    string parserDefines;
+    while (getline(ss, line))
+    {
+        if ((line.rfind("#include", 0) == 0) && (line.find(tablesBaseName) == string::npos))
+            header += line + "\n";
+        else if (line.rfind("#define", 0) == 0)
+            parserDefines += line + "\n";
+    }
+    header += "\n";
+    for (uint64_t i = 0; i < defines.size(); i++)
+    {
+        header += defines[i] + "\n";
+    }
+    header += parserDefines;
+
+    return header + "\n" + prologue + "\n" + code + epilogue + "\n\n#endif";
+}
+
+// Rewrites a line of an AVX2 parser for AVX-512: 8 rows per batch, 512 bits registers and the *_avx512 Goldilocks functions
+string avx512Line(const string &line)
+{
+    static const vector<pair<regex, string>> rules = {
+        {regex("#define NR_ 4"), "#define NR_ 8"},
+        {regex("\\[4\\]"), "[NR_]"},
+        {regex("\\b(\\w+)_avx\\b"), "$1_avx512"},
+        {regex("_avx_args"), "_avx512_args"},
+        {regex("__m256i"), "__m512i"},
+        {regex("_mm256_setzero_si256"), "_mm512_setzero_si512"},
+        {regex("Goldilocks::load\\("), "Goldilocks::load_avx512("},
+        {regex("Goldilocks::store\\("), "Goldilocks::store_avx512("}};
+    string result = line;
+    for (uint64_t i = 0; i < rules.size(); i++)
+    {
+        result = regex_replace(result, rules[i].first, rules[i].second);
+    }
+    return result;
+}
+
+string generateAvx512(const string &parserFileName)
+{
+    string cpp = file2string(parserFileName);
+
+    // Keep the includes and defines, and the *_parser_first_avx() and *_parser_first_avx_args() functions; the scalar
+    // and jump table versions have no AVX-512 counterpart
+    static const regex avxFunctionRegex("_parser_first_avx(_args)?\\(");
+    stringstream ss(cpp);
+    string line;
+    string code;
+    bool bFunction = false;
+    bool bKeep = true;
+    uint64_t nFunctions = 0;
+    while (getline(ss, line))
+    {
+        if (line.rfind("void ", 0) == 0)
+        {
+            bFunction = true;
+            bKeep = regex_search(line, avxFunctionRegex);
+            nFunctions += bKeep ? 1 : 0;
+        }
+        if (bKeep || !bFunction)
+        {
+            code += avx512Line(line) + "\n";
+        }
+    }
+    if (nFunctions == 0)
+    {
+        cerr << "Error: Chelpers generator did not find a *_parser_first_avx*() function in " << parserFileName << endl;
+        exit(-1);
+    }
+    code = code.substr(0, code.find_last_not_of(" \t\r\n") + 1);
+
+    return "// Generated by chelpersGenerator --avx512 from " + parserFileName + "; do not edit\n\n" + code;
+}
+
+// Argument of a case that addresses a polynomial by row, with the positions of its values relative to i_args
+struct TiledArg
+{
+    string type;
+    uint64_t dim;
+    uint64_t offset;
+    uint64_t stride;
+    uint64_t next;
+    uint64_t modulus;
+};
+
+// Splits the arguments of a call, i.e. the text between its parentheses, by its top level commas
+vector<string> splitArguments(const string &s)
+{
+    vector<string> result;
+    string current;
+    int64_t depth = 0;
+    for (uint64_t i = 0; i < s.size(); i++)
+    {
+        if ((s[i] == '(') || (s[i] == '['))
+            depth++;
+        else if ((s[i] == ')') || (s[i] == ']'))
+            depth--;
+        if ((s[i] == ',') && (depth == 0))
+        {
+            result.push_back(current);
+            current = "";
+        }
+        else
+        {
+            current += s[i];
+        }
+    }
+    result.push_back(current);
+    for (uint64_t i = 0; i < result.size(); i++)
+    {
+        result[i] = regex_replace(result[i], regex("^\\s+|\\s+$"), "");
+    }
+    return result;
+}
+
+// Dimension of the operand k (0 for a, 1 for b) of a Goldilocks or Goldilocks3 function, e.g. 1 for the a of Goldilocks3::mul13c_avx()
+uint64_t operandDim(const string &ns, const string &function, uint64_t k)
+{
+    if (ns == "Goldilocks")
+        return 1;
+    string digits = regex_replace(function.substr(0, function.rfind("_avx")), regex("[^0-9]"), "");
+    return (k < digits.size()) ? (digits[k] - '0') : 3;
+}
+
+// Returns the arguments of a case that address polynomials by row, and its number of arguments
+vector<TiledArg> parseTiledCase(const string &body, const string &argsName, uint64_t &nArgs)
+{
+    // Statements, split by the semicolons out of parentheses, with single spaces and args[i_args] as args[i_args + 0]
+    string code = regex_replace(body, regex("\\s+"), " ");
+    code = regex_replace(code, regex(argsName + "\\[i_args\\]"), argsName + "[i_args + 0]");
+    vector<string> statements;
+    string current;
+    int64_t depth = 0;
+    for (uint64_t i = 0; i < code.size(); i++)
+    {
+        if (code[i] == '(')
+            depth++;
+        else if (code[i] == ')')
+            depth--;
+        if ((code[i] == ';') && (depth == 0))
+        {
+            statements.push_back(current);
+            current = "";
+        }
+        else
+        {
+            current += code[i];
+        }
+    }
+
+    const string A = argsName + "\\[i_args \\+ (\\d+)\\]";
+    const regex incrementRegex("i_args \\+= (\\d+)$");
+    const regex offsetsRegex("offsets(\\d)\\[j\\] = (.*)$");
+    const regex nextRegex("^" + A + " \\+ \\(\\(\\(i \\+ j\\) \\+ " + A + "\\) % " + A + "\\) \\* (?:" + A + "|(numpols))$");
+    const regex rowRegex("^" + A + " \\+ \\(i \\+ j\\) \\* (?:" + A + "|(numpols))$");
+    const regex callRegex("(Goldilocks3?)::(\\w+)\\((.*)\\)$");
+    const regex polsRegex("^&params\\.pols\\[" + A + " \\+ i \\* " + A + "\\]$");
+
+    vector<TiledArg> args;
+    map<string, TiledArg> offsets; // Pending offsetsK arrays; type "" if they do not address polynomials by row
+    uint64_t offset = 0;
+    for (uint64_t s = 0; s < statements.size(); s++)
+    {
+        string statement = regex_replace(statements[s], regex("^[\\s{}]+|\\s+$"), "");
+        smatch m;
+        if (regex_search(statement, m, incrementRegex))
+        {
+            offset += stoull(m[1].str());
+        }
+        else if (regex_search(statement, m, offsetsRegex))
+        {
+            string name = "offsets" + m[1].str();
+            string rhs = m[2].str();
+            smatch r;
+            if (regex_match(rhs, r, nextRegex))
+                offsets[name] = {r[5].matched ? "STEP42NS_CONST_NEXT" : "STEP42NS_POLS_NEXT", 0, offset + stoull(r[1].str()), r[5].matched ? 0 : offset + stoull(r[4].str()), offset + stoull(r[2].str()), offset + stoull(r[3].str())};
+            else if (regex_match(rhs, r, rowRegex))
+                offsets[name] = {r[3].matched ? "" : "STEP42NS_POLS", 0, offset + stoull(r[1].str()), r[3].matched ? 0 : offset + stoull(r[2].str()), 0, 0};
+            else
+                offsets[name] = {"", 0, 0, 0, 0, 0};
+        }
+        else if (regex_search(statement, m, callRegex) && ((statement.find("params.pols") != string::npos) || (statement.find("getElement(0, 0)") != string::npos)))
+        {
+            vector<string> callArgs = splitArguments(m[3].str());
+            vector<string> callOffsets;
+            for (uint64_t k = 0; k < callArgs.size(); k++)
+            {
+                if (regex_match(callArgs[k], regex("offsets\\d")))
+                    callOffsets.push_back(callArgs[k]);
+            }
+            uint64_t nextOffsets = 0;
+            for (uint64_t k = 1; k < callArgs.size(); k++)
+            {
+                bool bPols = (callArgs[k].find("params.pols") != string::npos);
+                bool bConst = (callArgs[k] == "&params.pConstPols2ns->getElement(0, 0)");
+                uint64_t dim = operandDim(m[1].str(), m[2].str(), k - 1);
+                smatch p;
+                if (bPols && regex_match(callArgs[k], p, polsRegex))
+                {
+                    args.push_back({"STEP42NS_POLS", dim, offset + stoull(p[1].str()), offset + stoull(p[2].str()), 0, 0});
+                }
+                else if ((bPols && (callArgs[k] == "&params.pols[0]")) || bConst)
+                {
+                    if ((nextOffsets >= callOffsets.size()) || (offsets.find(callOffsets[nextOffsets]) == offsets.end()))
+                    {
+                        cerr << "Error: Chelpers generator found no offsets for argument " << callArgs[k] << " of " << statement << endl;
+                        exit(-1);
+                    }
+                    TiledArg arg = offsets[callOffsets[nextOffsets++]];
+                    arg.dim = dim;
+                    if ((arg.type == "") && bPols)
+                    {
+                        cerr << "Error: Chelpers generator could not parse the offsets of argument " << callArgs[k] << " of " << statement << endl;
+                        exit(-1);
+                    }
+                    if (bPols ? (arg.type == "STEP42NS_CONST_NEXT") : ((arg.type == "STEP42NS_POLS") || (arg.type == "STEP42NS_POLS_NEXT")))
+                    {
+                        cerr << "Error: Chelpers generator found offsets of the wrong kind for argument " << callArgs[k] << " of " << statement << endl;
+                        exit(-1);
+                    }
+                    if (arg.type != "")
+                        args.push_back(arg);
+                }
+                else if (bPols)
+                {
+                    cerr << "Error: Chelpers generator could not parse argument " << callArgs[k] << " of " << statement << endl;
+                    exit(-1);
+                }
+            }
+        }
+        else if (statement.find("params.pols") != string::npos)
+        {
+            cerr << "Error: Chelpers generator could not parse statement " << statement << endl;
+            exit(-1);
+        }
+    }
+    nArgs = offset;
+    return args;
+}
+
+string generateTiled(const string &parserFileName, const string &tablesFileName)
+{
+    string cpp = file2string(parserFileName);
+    string hpp = file2string(tablesFileName);
+
+    vector<string> defines;
+    vector<uint64_t> ops, args;
+    string opsName, argsName;
+    parseTables(hpp, defines, ops, args, opsName, argsName);
+
+    uint64_t functionStart;
+    string functionName;
+    string function = findInterpreter(cpp, parserFileName, functionStart, functionName);
+    uint64_t loopStart, loopEnd;
+    map<uint64_t, string> cases = parseCases(function, loopStart, loopEnd);
+    if (cases.empty() || (cases.rbegin()->first != cases.size() - 1))
+    {
+        cerr << "Error: Chelpers generator expected cases 0 to " << cases.size() - 1 << " in " << functionName << endl;
+        exit(-1);
+    }
+
+    string code = "// Generated by chelpersGenerator --tiled from " + parserFileName + "; do not edit\n\n";
+    code += "#ifndef STEP42NS_PARSER_TILED_HPP\n#define STEP42NS_PARSER_TILED_HPP\n\n#include <vector>\n#include <cstdint>\n\n";
+    code += "#define STEP42NS_POLS 0       // params.pols[offset + i * stride]\n";
+    code += "#define STEP42NS_POLS_NEXT 1  // params.pols[offset + ((i + next) % modulus) * stride]\n";
+    code += "#define STEP42NS_CONST_NEXT 2 // params.pConstPols2ns->getElement(offset, (i + next) % modulus)\n\n";
+    code += "struct Step42nsArg\n{\n    uint64_t type;\n    uint64_t dim; // Elements per row read by the operation, 1 or 3\n";
+    code += "    uint64_t offset; // Positions of the arguments, relative to i_args\n    uint64_t stride;\n    uint64_t next;\n    uint64_t modulus;\n};\n\n";
+    code += "struct Step42nsOp\n{\n    uint64_t nArgs;\n    std::vector<Step42nsArg> args;\n};\n\n";
+    code += "// Arguments of every case of " + functionName + "() that address polynomials by row\n";
+    code += "static const std::vector<Step42nsOp> step42nsOps = {\n";
+    for (auto it = cases.begin(); it != cases.end(); it++)
+    {
+        uint64_t nArgs;
+        vector<TiledArg> caseArgs = parseTiledCase(it->second, argsName, nArgs);
+        code += "    {" + to_string(nArgs) + ", {";
+        for (uint64_t k = 0; k < caseArgs.size(); k++)
+        {
+            const TiledArg &a = caseArgs[k];
+            code += string(k > 0 ? ", " : "") + "{" + a.type + ", " + to_string(a.dim) + ", " + to_string(a.offset) + ", " + to_string(a.stride) + ", " + to_string(a.next) + ", " + to_string(a.modulus) + "}";
+        }
+        code += "}}, // " + to_string(it->first) + "\n";
+    }
+    code += "};\n\n#endif";
+
+    // The table must account for every argument of the expression
+    uint64_t i_args = 0;
+    for (uint64_t kk = 0; kk < ops.size(); kk++)
+    {
+        uint64_t nArgs;
+        parseTiledCase(cases[ops[kk]], argsName, nArgs);
+        i_args += nArgs;
+    }
+    if (i_args != args.size())
+    {
+        cerr << "Error: Chelpers generator consumed " << i_args << " arguments instead of " << args.size() << " in " << functionName << endl;
+        exit(-1);
+    }
+
+    return code;
+}
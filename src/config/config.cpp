@@ -4,6 +4,7 @@
 #include "config.hpp"
 #include "zkassert.hpp"
 #include "utils.hpp"
+#include "prover_request_type.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -99,6 +100,22 @@ void Config::load(json &config)
     if (config.contains("runBlakeTest") && config["runBlakeTest"].is_boolean())
         runBlakeTest = config["runBlakeTest"];
 
+    runPolinomialTest = false;
+    if (config.contains("runPolinomialTest") && config["runPolinomialTest"].is_boolean())
+        runPolinomialTest = config["runPolinomialTest"];
+
+    runMerkleTreeGLTest = false;
+    if (config.contains("runMerkleTreeGLTest") && config["runMerkleTreeGLTest"].is_boolean())
+        runMerkleTreeGLTest = config["runMerkleTreeGLTest"];
+
+    runZkinStarkTest = false;
+    if (config.contains("runZkinStarkTest") && config["runZkinStarkTest"].is_boolean())
+        runZkinStarkTest = config["runZkinStarkTest"];
+
+    runProverSchedulerTest = false;
+    if (config.contains("runProverSchedulerTest") && config["runProverSchedulerTest"].is_boolean())
+        runProverSchedulerTest = config["runProverSchedulerTest"];
+
     useMainExecGenerated = false;
     if (config.contains("useMainExecGenerated") && config["useMainExecGenerated"].is_boolean())
         useMainExecGenerated = config["useMainExecGenerated"];
@@ -238,25 +255,30 @@ void Config::load(json &config)
     storageRomFile = configPath + "/scripts/storage_sm_rom.json";
     zkevmConstPols = configPath + "/zkevm/zkevm.const";
     zkevmConstantsTree = configPath + "/zkevm/zkevm.consttree";
+    zkevmDomainTables = configPath + "/zkevm/zkevm.domain";
     zkevmStarkInfo = configPath + "/zkevm/zkevm.starkinfo.json";
     zkevmVerifier = configPath + "/zkevm/zkevm.verifier.dat";
     c12aConstPols = configPath + "/c12a/c12a.const";
     c12aConstantsTree = configPath + "/c12a/c12a.consttree";
+    c12aDomainTables = configPath + "/c12a/c12a.domain";
     c12aExec = configPath + "/c12a/c12a.exec";
     c12aStarkInfo = configPath + "/c12a/c12a.starkinfo.json";
     recursive1ConstPols = configPath + "/recursive1/recursive1.const";
     recursive1ConstantsTree = configPath + "/recursive1/recursive1.consttree";
+    recursive1DomainTables = configPath + "/recursive1/recursive1.domain";
     recursive1Exec = configPath + "/recursive1/recursive1.exec";
     recursive1StarkInfo = configPath + "/recursive1/recursive1.starkinfo.json";
     recursive1Verifier = configPath + "/recursive1/recursive1.verifier.dat";
     recursive2ConstPols = configPath + "/recursive2/recursive2.const";
     recursive2ConstantsTree = configPath + "/recursive2/recursive2.consttree";
+    recursive2DomainTables = configPath + "/recursive2/recursive2.domain";
     recursive2Exec = configPath + "/recursive2/recursive2.exec";
     recursive2StarkInfo = configPath + "/recursive2/recursive2.starkinfo.json";
     recursive2Verifier = configPath + "/recursive2/recursive2.verifier.dat";
     recursive2Verkey = configPath + "/recursive2/recursive2.verkey.json";
     recursivefConstPols = configPath + "/recursivef/recursivef.const";
     recursivefConstantsTree = configPath + "/recursivef/recursivef.consttree";
+    recursivefDomainTables = configPath + "/recursivef/recursivef.domain";
     recursivefExec = configPath + "/recursivef/recursivef.exec";
     recursivefStarkInfo = configPath + "/recursivef/recursivef.starkinfo.json";
     recursivefVerifier = configPath + "/recursivef/recursivef.verifier.dat";
@@ -314,10 +336,84 @@ void Config::load(json &config)
     if (config.contains("recursivefConstantsTree") && config["recursivefConstantsTree"].is_string())
         recursivefConstantsTree = config["recursivefConstantsTree"];
 
+    if (config.contains("zkevmDomainTables") && config["zkevmDomainTables"].is_string())
+        zkevmDomainTables = config["zkevmDomainTables"];
+
+    if (config.contains("c12aDomainTables") && config["c12aDomainTables"].is_string())
+        c12aDomainTables = config["c12aDomainTables"];
+
+    if (config.contains("recursive1DomainTables") && config["recursive1DomainTables"].is_string())
+        recursive1DomainTables = config["recursive1DomainTables"];
+
+    if (config.contains("recursive2DomainTables") && config["recursive2DomainTables"].is_string())
+        recursive2DomainTables = config["recursive2DomainTables"];
+
+    if (config.contains("recursivefDomainTables") && config["recursivefDomainTables"].is_string())
+        recursivefDomainTables = config["recursivefDomainTables"];
+
     mapConstantsTreeFile = true;
     if (config.contains("mapConstantsTreeFile") && config["mapConstantsTreeFile"].is_boolean())
         mapConstantsTreeFile = config["mapConstantsTreeFile"];
 
+    fuseLdeMerkleTree = false;
+    if (config.contains("fuseLdeMerkleTree") && config["fuseLdeMerkleTree"].is_boolean())
+        fuseLdeMerkleTree = config["fuseLdeMerkleTree"];
+
+    merkleTreeKeptLevels = 0;
+    if (config.contains("merkleTreeKeptLevels") && config["merkleTreeKeptLevels"].is_number())
+        merkleTreeKeptLevels = config["merkleTreeKeptLevels"];
+
+    cmPolsHugePages = "";
+    if (config.contains("cmPolsHugePages") && config["cmPolsHugePages"].is_string())
+        cmPolsHugePages = config["cmPolsHugePages"];
+
+    cmPolsNumaPolicy = "";
+    if (config.contains("cmPolsNumaPolicy") && config["cmPolsNumaPolicy"].is_string())
+        cmPolsNumaPolicy = config["cmPolsNumaPolicy"];
+
+    step42nsTileBytes = 0;
+    if (config.contains("step42nsTileBytes") && config["step42nsTileBytes"].is_number())
+        step42nsTileBytes = config["step42nsTileBytes"];
+
+    checkCompiledChelpers = false;
+    if (config.contains("checkCompiledChelpers") && config["checkCompiledChelpers"].is_boolean())
+        checkCompiledChelpers = config["checkCompiledChelpers"];
+
+    checkTiledStep42ns = false;
+    if (config.contains("checkTiledStep42ns") && config["checkTiledStep42ns"].is_boolean())
+        checkTiledStep42ns = config["checkTiledStep42ns"];
+
+    pipelineBatchProofs = false;
+    if (config.contains("pipelineBatchProofs") && config["pipelineBatchProofs"].is_boolean())
+        pipelineBatchProofs = config["pipelineBatchProofs"];
+
+    pipelineExecutorThreads = 0;
+    if (config.contains("pipelineExecutorThreads") && config["pipelineExecutorThreads"].is_number())
+        pipelineExecutorThreads = config["pipelineExecutorThreads"];
+
+    pipelineMaxMemory = 0;
+    if (config.contains("pipelineMaxMemory") && config["pipelineMaxMemory"].is_number())
+        pipelineMaxMemory = config["pipelineMaxMemory"];
+
+    maxWitnessThreads = 0;
+    if (config.contains("maxWitnessThreads") && config["maxWitnessThreads"].is_number())
+        maxWitnessThreads = config["maxWitnessThreads"];
+
+    aggregateInputFolder = false;
+    if (config.contains("aggregateInputFolder") && config["aggregateInputFolder"].is_boolean())
+        aggregateInputFolder = config["aggregateInputFolder"];
+
+    aggregatedProofAllLevels = false;
+    if (config.contains("aggregatedProofAllLevels") && config["aggregatedProofAllLevels"].is_boolean())
+        aggregatedProofAllLevels = config["aggregatedProofAllLevels"];
+
+    planMemoryBudget = 0;
+    if (config.contains("planMemoryBudget") && config["planMemoryBudget"].is_number())
+        planMemoryBudget = config["planMemoryBudget"];
+
+    if (config.contains("batchProofCheckpointPath") && config["batchProofCheckpointPath"].is_string())
+        batchProofCheckpointPath = config["batchProofCheckpointPath"];
+
     if (config.contains("finalVerkey") && config["finalVerkey"].is_string())
         finalVerkey = config["finalVerkey"];
 
@@ -421,6 +517,29 @@ void Config::load(json &config)
     if (config.contains("requestsPersistence") && config["requestsPersistence"].is_number())
         requestsPersistence = config["requestsPersistence"];
 
+    // Final proofs are served before the rest by default, the other types in turns
+    schedulerPriority.assign(prt_execute + 1, 1);
+    schedulerWeight.assign(prt_execute + 1, 1);
+    schedulerMaxWait.assign(prt_execute + 1, 0);
+    schedulerPriority[prt_genFinalProof] = 2;
+    for (uint64_t type = prt_genBatchProof; type <= prt_execute; type++)
+    {
+        string typeName = proverRequestType2string((tProverRequestType)type);
+        if (!config.contains("proverScheduler") || !config["proverScheduler"].contains(typeName) || !config["proverScheduler"][typeName].is_object())
+            continue;
+        json &typeConfig = config["proverScheduler"][typeName];
+        if (typeConfig.contains("priority") && typeConfig["priority"].is_number())
+            schedulerPriority[type] = typeConfig["priority"];
+        if (typeConfig.contains("weight") && typeConfig["weight"].is_number())
+            schedulerWeight[type] = typeConfig["weight"];
+        if (typeConfig.contains("maxWait") && typeConfig["maxWait"].is_number())
+            schedulerMaxWait[type] = typeConfig["maxWait"];
+    }
+
+    schedulerStatisticsPeriod = 60;
+    if (config.contains("schedulerStatisticsPeriod") && config["schedulerStatisticsPeriod"].is_number())
+        schedulerStatisticsPeriod = config["schedulerStatisticsPeriod"];
+
     maxExecutorThreads = 16;
     if (config.contains("maxExecutorThreads") && config["maxExecutorThreads"].is_number())
         maxExecutorThreads = config["maxExecutorThreads"];
@@ -488,6 +607,14 @@ void Config::print(void)
         cout << "    runSHA256Test=true" << endl;
     if (runBlakeTest)
         cout << "    runBlakeTest=true" << endl;
+    if (runPolinomialTest)
+        cout << "    runPolinomialTest=true" << endl;
+    if (runMerkleTreeGLTest)
+        cout << "    runMerkleTreeGLTest=true" << endl;
+    if (runZkinStarkTest)
+        cout << "    runZkinStarkTest=true" << endl;
+    if (runProverSchedulerTest)
+        cout << "    runProverSchedulerTest=true" << endl;
 
     if (executeInParallel)
         cout << "    executeInParallel=true" << endl;
@@ -553,8 +680,34 @@ void Config::print(void)
         cout << "    mapConstPolsFile=true" << endl;
     cout << "    zkevmConstantsTree=" << zkevmConstantsTree << endl;
     cout << "    c12aConstantsTree=" << c12aConstantsTree << endl;
+    cout << "    zkevmDomainTables=" << zkevmDomainTables << endl;
+    cout << "    c12aDomainTables=" << c12aDomainTables << endl;
+    cout << "    recursive1DomainTables=" << recursive1DomainTables << endl;
+    cout << "    recursive2DomainTables=" << recursive2DomainTables << endl;
+    cout << "    recursivefDomainTables=" << recursivefDomainTables << endl;
     if (mapConstantsTreeFile)
         cout << "    mapConstantsTreeFile=true" << endl;
+    if (fuseLdeMerkleTree)
+        cout << "    fuseLdeMerkleTree=true" << endl;
+    cout << "    merkleTreeKeptLevels=" << merkleTreeKeptLevels << endl;
+    cout << "    cmPolsHugePages=" << cmPolsHugePages << endl;
+    cout << "    cmPolsNumaPolicy=" << cmPolsNumaPolicy << endl;
+    cout << "    step42nsTileBytes=" << step42nsTileBytes << endl;
+    if (checkCompiledChelpers)
+        cout << "    checkCompiledChelpers=true" << endl;
+    if (checkTiledStep42ns)
+        cout << "    checkTiledStep42ns=true" << endl;
+    if (pipelineBatchProofs)
+        cout << "    pipelineBatchProofs=true" << endl;
+    cout << "    pipelineExecutorThreads=" << pipelineExecutorThreads << endl;
+    cout << "    pipelineMaxMemory=" << pipelineMaxMemory << endl;
+    cout << "    maxWitnessThreads=" << maxWitnessThreads << endl;
+    if (aggregateInputFolder)
+        cout << "    aggregateInputFolder=true" << endl;
+    if (aggregatedProofAllLevels)
+        cout << "    aggregatedProofAllLevels=true" << endl;
+    cout << "    planMemoryBudget=" << planMemoryBudget << endl;
+    cout << "    batchProofCheckpointPath=" << batchProofCheckpointPath << endl;
     cout << "    finalVerkey=" << finalVerkey << endl;
     cout << "    zkevmVerifier=" << zkevmVerifier << endl;
     cout << "    recursive1Verifier=" << recursive1Verifier << endl;
@@ -583,6 +736,11 @@ void Config::print(void)
     cout << "    maxExecutorThreads=" << maxExecutorThreads << endl;
     cout << "    maxProverThreads=" << maxProverThreads << endl;
     cout << "    maxStateDBThreads=" << maxStateDBThreads << endl;
+    for (uint64_t type = prt_genBatchProof; type <= prt_execute; type++)
+    {
+        cout << "    proverScheduler." << proverRequestType2string((tProverRequestType)type) << ": priority=" << schedulerPriority[type] << " weight=" << schedulerWeight[type] << " maxWait=" << schedulerMaxWait[type] << endl;
+    }
+    cout << "    schedulerStatisticsPeriod=" << schedulerStatisticsPeriod << endl;
     cout << "    dbMTCacheSize=" << dbMTCacheSize << endl;
     cout << "    dbProgramCacheSize=" << dbProgramCacheSize << endl;
 }
\ No newline at end of file
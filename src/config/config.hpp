@@ -2,6 +2,7 @@
 #define CONFIG_HPP
 
 #include <string>
+#include <vector>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include "definitions.hpp"
@@ -37,6 +38,10 @@ public:
     bool runMemAlignSMTest;
     bool runSHA256Test;
     bool runBlakeTest;
+    bool runPolinomialTest;
+    bool runMerkleTreeGLTest;
+    bool runZkinStarkTest;
+    bool runProverSchedulerTest;
     
     bool executeInParallel;
     bool useMainExecGenerated;
@@ -94,7 +99,29 @@ public:
     string recursive1ConstantsTree;
     string recursive2ConstantsTree;
     string recursivefConstantsTree;
+    string zkevmDomainTables;
+    string c12aDomainTables;
+    string recursive1DomainTables;
+    string recursive2DomainTables;
+    string recursivefDomainTables;
     bool mapConstantsTreeFile;
+    bool fuseLdeMerkleTree; // Hashes the Merkle tree leaves of steps 1 to 4 as soon as the LDE produces each block of rows
+    uint64_t merkleTreeKeptLevels; // Number of upper levels of the stark Merkle trees kept in memory; lower levels are rebuilt from the polynomials when queried; 0 keeps all
+    string cmPolsHugePages; // Huge pages of the committed polynomials memory: "" (none), "thp", "2MB" or "1GB"
+    string cmPolsNumaPolicy; // NUMA placement of the committed polynomials memory: "" (first touch by the threads that process it), "interleave" or "bind" (one contiguous part per NUMA node)
+    uint64_t step42nsTileBytes; // Size of the blocks of columns that step42ns evaluates at once, e.g. the L2 cache size; 0 evaluates it row by row
+    bool checkCompiledChelpers; // Runs the AVX2 step3 and step42ns interpreters before their compiled kernels (make chelpers=1), and exits if they write different buffers;
+                                // the compiled kernels, and so this check, are only used on CPUs without AVX-512, and by step42ns only if step42nsTileBytes is 0 or checkTiledStep42ns is set
+    bool checkTiledStep42ns; // Runs step42ns row by row before running it by blocks of step42nsTileBytes, and exits if they write different buffers
+    bool pipelineBatchProofs; // Runs the executor of the next batch proof, into a second committed polynomials buffer, while the current one is proved
+    uint64_t pipelineExecutorThreads; // Cores used by the pipelined executor, the rest are used by the starks; 0 shares all the cores
+    uint64_t pipelineMaxMemory; // Memory budget, in bytes, of the committed polynomials buffers; batch proofs are not pipelined if the second buffer does not fit; 0 is no limit
+    uint64_t maxWitnessThreads; // Max threads running the parallel subcomponents of the verifier circuits witness calculation; 0 uses all the cores
+    bool aggregateInputFolder; // If runFileGenAggregatedProof and inputFile is a folder, aggregates all its files, in alphabetical order, into one proof; the
+                               // only way to aggregate more than 2 proofs, and to check the consistency of more than 2 inputs, since the aggregator service sends 2
+    bool aggregatedProofAllLevels; // Saves the intermediate proofs of the aggregation tree to aggregated_proof.level_<level>_<index>.output.json files as they are generated
+    uint64_t planMemoryBudget; // Memory, in bytes, of the machine that the --plan mode checks the configuration against; 0 uses the memory of this one
+    string batchProofCheckpointPath; // Saves the result of every stage of a batch proof into a subfolder per input, and resumes from the last completed stage; "" disables it
     string finalVerkey;
     string zkevmVerifier;
     string recursive1Verifier;
@@ -127,6 +154,13 @@ public:
     uint64_t dbNumberOfPoolConnections;
     uint64_t cleanerPollingPeriod;
     uint64_t requestsPersistence;
+    // Prover requests scheduler, indexed by tProverRequestType and loaded from proverScheduler.<type name>: requests with a higher priority
+    // are served first, types with the same priority share the prover in proportion to their weights, and requests that have waited more
+    // than the max wait of their type, in seconds, are served before any other; 0 is no max wait
+    vector<uint64_t> schedulerPriority;
+    vector<uint64_t> schedulerWeight;
+    vector<uint64_t> schedulerMaxWait;
+    uint64_t schedulerStatisticsPeriod; // Seconds between the scheduler statistics logged by the aggregator client GetStatus(); 0 does not log them
     uint64_t maxExecutorThreads;
     uint64_t maxProverThreads;
     uint64_t maxStateDBThreads;
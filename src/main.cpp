@@ -31,7 +31,12 @@
 #include "service/statedb/statedb.hpp"
 #include "sha256_test.hpp"
 #include "blake_test.hpp"
+#include "starkpil/polinomial/polinomial_test.hpp"
+#include "starkpil/merkle_tree/merkle_tree_gl_test.hpp"
+#include "starkpil/zkin/zkin_stark_test.hpp"
+#include "prover_scheduler/prover_scheduler_test.hpp"
 #include "goldilocks_precomputed.hpp"
+#include "memory_plan.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -100,7 +105,17 @@ void runFileGenAggregatedProof(Goldilocks fr, Prover &prover, Config &config)
     TimerStart(INPUT_LOAD);
     // Create and init an empty prover request
     ProverRequest proverRequest(fr, config, prt_genAggregatedProof);
-    if (config.inputFile.size() > 0)
+    if ((config.inputFile.size() > 0) && (config.inputFile.back() == '/')) // Aggregate all input files in the folder
+    {
+        // Get files sorted alphabetically from the folder, i.e. in batch order
+        vector<string> files = getFolderFiles(config.inputFile, true);
+        proverRequest.aggregatedProofInputs.resize(files.size());
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            file2json(config.inputFile + files[i], proverRequest.aggregatedProofInputs[i]);
+        }
+    }
+    else if (config.inputFile.size() > 0)
     {
         file2json(config.inputFile, proverRequest.aggregatedProofInput1);
     }
@@ -301,13 +316,18 @@ int main(int argc, char **argv)
 
     TimerStart(WHOLE_PROCESS);
 
-    // Parse the name of the configuration file
+    // Parse the name of the configuration file, and the plan mode
     char *pConfigFile = (char *)"config/config.json";
-    if (argc == 3)
+    bool bPlan = false;
+    for (int i = 1; i < argc; i++)
     {
-        if ((strcmp(argv[1], "-c") == 0) || (strcmp(argv[1], "--config") == 0))
+        if (((strcmp(argv[i], "-c") == 0) || (strcmp(argv[i], "--config") == 0)) && (i + 1 < argc))
+        {
+            pConfigFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--plan") == 0)
         {
-            pConfigFile = argv[2];
+            bPlan = true;
         }
     }
 
@@ -320,6 +340,14 @@ int main(int argc, char **argv)
     config.print();
     TimerStopAndLog(LOAD_CONFIG_JSON);
 
+    // If requested to only plan the memory of this configuration, then exit the program
+    if (bPlan)
+    {
+        bool bFits = planMemory(config);
+        TimerStopAndLog(WHOLE_PROCESS);
+        return bFits ? 0 : 1;
+    }
+
     // Check required files presence
     bool bError = false;
     if (!fileExists(config.rom))
@@ -528,6 +556,30 @@ int main(int argc, char **argv)
         Blake2b256_Test(fr, config);
     }
 
+    // Test Polinomial
+    if (config.runPolinomialTest)
+    {
+        PolinomialTest(fr, config);
+    }
+
+    // Test MerkleTreeGL
+    if (config.runMerkleTreeGLTest)
+    {
+        MerkleTreeGLTest(fr, config);
+    }
+
+    // Test ZkinStark
+    if (config.runZkinStarkTest)
+    {
+        ZkinStarkTest(fr, config);
+    }
+
+    // Test ProverScheduler
+    if (config.runProverSchedulerTest)
+    {
+        ProverSchedulerTest(fr, config);
+    }
+
     // If there is nothing else to run, exit normally
     if (!config.runExecutorServer && !config.runExecutorClient && !config.runExecutorClientMultithread &&
         !config.runStateDBServer && !config.runStateDBTest &&
@@ -648,7 +700,7 @@ int main(int argc, char **argv)
     // Generate an aggregated proof from the input file
     if (config.runFileGenAggregatedProof)
     {
-        if (config.inputFile.back() == '/') // Process all input files in the folder
+        if ((config.inputFile.back() == '/') && !config.aggregateInputFolder) // Process all input files in the folder
         {
             Config tmpConfig = config;
             // Get files sorted alphabetically from the folder
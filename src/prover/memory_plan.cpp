@@ -0,0 +1,313 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <algorithm> // std::max
+#include <sys/stat.h>
+#include <omp.h>
+#include "memory_plan.hpp"
+#include "definitions.hpp"
+#include "utils.hpp"
+#include "alt_bn128.hpp"
+#include "zkey.hpp"
+#include "stark_info.hpp"
+#include "starks.hpp"
+#include "domainTables.hpp"
+#include "merkleTreeGL.hpp"
+#include "merkleTreeBN128.hpp"
+#include "friProve.hpp"
+#include "sm/pols_generated/commit_pols.hpp"
+#include "main.hpp"
+#include "main.recursive1.hpp"
+#include "main.recursive2.hpp"
+#include "main.recursiveF.hpp"
+#include "main.final.hpp"
+
+using namespace std;
+
+class MemoryComponent
+{
+public:
+    string name;
+    uint64_t size;  // Bytes
+    bool bMapped;   // Mapped from a file, so it is page cache that the kernel can reclaim
+};
+
+class MemoryStage
+{
+public:
+    string name;
+    uint64_t size; // Bytes of temporary memory, on top of the components
+};
+
+static uint64_t getFileSize(const string &fileName)
+{
+    struct stat sb;
+    if ((fileName.size() == 0) || (stat(fileName.c_str(), &sb) != 0))
+    {
+        cerr << "Error: planMemory() could not find file " << fileName << "; its size is not included" << endl;
+        return 0;
+    }
+    return sb.st_size;
+}
+
+static string bytes2MB(uint64_t size)
+{
+    stringstream ss;
+    ss << fixed << setprecision(1) << double(size) / (1024 * 1024) << " MB";
+    return ss.str();
+}
+
+// Same allocations as the Starks constructor
+static void planStarks(const Config &config, const string &name, const string &starkInfoFile, const string &domainTablesFile, vector<MemoryComponent> &components)
+{
+    StarkInfo starkInfo(config, starkInfoFile);
+    uint64_t nBits = starkInfo.starkStruct.nBits;
+    uint64_t nBitsExt = starkInfo.starkStruct.nBitsExt;
+
+    components.push_back({name + " constant polynomials", starkInfo.nConstants * (1ULL << nBits) * sizeof(Goldilocks::Element), config.mapConstPolsFile});
+    components.push_back({name + " constants tree", starkInfo.getConstTreeSizeInBytes(), config.mapConstantsTreeFile});
+    components.push_back({name + " domain tables", DomainTables::getFileSize(nBits, nBitsExt), config.mapConstantsTreeFile && fileExists(domainTablesFile)});
+    components.push_back({name + " Merkle trees nodes", 4 * MerkleTreeGL::getNumElements(1ULL << nBitsExt, config.merkleTreeKeptLevels) * sizeof(Goldilocks::Element), false});
+    components.push_back({name + " scratch", Starks::getScratchSize(starkInfo) * sizeof(Goldilocks::Element), false});
+}
+
+/*
+    Temporary memory of Starks::genProof(), on top of the scratch and the trees of the Starks constructor: the evmap
+    accumulators, the NTT buffer of the q polynomial, and the FRI trees, which live until the queries are opened, together
+    with either the per-thread folding buffers or the queries of the proof
+*/
+static uint64_t planStarkProof(const Config &config, const string &starkInfoFile)
+{
+    StarkInfo starkInfo(config, starkInfoFile);
+    uint64_t nThreads = omp_get_max_threads();
+    uint64_t NExtended = 1ULL << starkInfo.starkStruct.nBitsExt;
+    vector<StepStruct> &steps = starkInfo.starkStruct.steps;
+
+    uint64_t evmap = nThreads * starkInfo.evMap.size() * FIELD_EXTENSION;
+    uint64_t nttQ = NExtended * starkInfo.qDim * starkInfo.qDeg;
+
+    // Tree k of FRIProve::prove(), built by step k - 1, and its queries
+    uint64_t friTrees = 0;
+    uint64_t fold = 0;
+    uint64_t querySize = starkInfo.mapSectionsN.section[eSection::cm1_n] + starkInfo.mapSectionsN.section[eSection::cm2_n] +
+                         starkInfo.mapSectionsN.section[eSection::cm3_n] + starkInfo.mapSectionsN.section[eSection::cm4_2ns] +
+                         starkInfo.nConstants + 5 * starkInfo.starkStruct.nBitsExt * HASH_SIZE;
+    for (uint64_t k = 1; k < steps.size(); k++)
+    {
+        uint64_t nX = 1ULL << (steps[k - 1].nBits - steps[k].nBits);
+        friTrees += (1ULL << steps[k - 1].nBits) * FIELD_EXTENSION + MerkleTreeGL::getNumElements(1ULL << steps[k].nBits, 0);
+        fold = std::max(fold, nThreads * (2 * nX * FRI_FOLD_LANES * FIELD_EXTENSION + nX));
+        querySize += nX * FIELD_EXTENSION + steps[k].nBits * HASH_SIZE;
+    }
+    uint64_t queries = starkInfo.starkStruct.nQueries * querySize + (1ULL << steps.back().nBits) * FIELD_EXTENSION;
+
+    return std::max(std::max(evmap, nttQ), friTrees + std::max(fold, queries)) * sizeof(Goldilocks::Element);
+}
+
+// Temporary memory of StarkRecursiveF::genProof(), on top of its buffer and trees: the evmap accumulators and the FRI trees
+static uint64_t planStarkRecursiveFProof(const Config &config)
+{
+    StarkInfo starkInfo(config, config.recursivefStarkInfo);
+    vector<StepStruct> &steps = starkInfo.starkStruct.steps;
+
+    uint64_t evmap = omp_get_max_threads() * starkInfo.evMap.size() * FIELD_EXTENSION * sizeof(Goldilocks::Element);
+    uint64_t friTrees = 0;
+    for (uint64_t k = 1; k < steps.size(); k++)
+    {
+        friTrees += (1ULL << steps[k - 1].nBits) * FIELD_EXTENSION * sizeof(Goldilocks::Element) + MerkleTreeBN128::getNumNodes(1ULL << steps[k].nBits) * sizeof(RawFr::Element);
+    }
+    return std::max(evmap, friTrees);
+}
+
+// Reads the protocol and the sizes of the zkey from its header sections, without loading it
+static bool readZkeyHeader(const string &fileName, uint32_t &protocolId, uint32_t &nPublic, uint32_t &domainSize, uint32_t &nAdditions, uint32_t &nConstraints)
+{
+    FILE *f = fopen(fileName.c_str(), "rb");
+    if (f == NULL)
+    {
+        cerr << "Error: planMemory() failed calling fopen() of zkey file " << fileName << endl;
+        return false;
+    }
+    char type[4];
+    uint32_t version, nSections;
+    bool bOk = (fread(type, 1, 4, f) == 4) && (fread(&version, sizeof(uint32_t), 1, f) == 1) && (fread(&nSections, sizeof(uint32_t), 1, f) == 1);
+    bool bProtocol = false;
+    bool bHeader = false;
+    for (uint32_t i = 0; bOk && (i < nSections); i++)
+    {
+        uint32_t sType;
+        uint64_t sSize;
+        bOk = (fread(&sType, sizeof(uint32_t), 1, f) == 1) && (fread(&sSize, sizeof(uint64_t), 1, f) == 1);
+        if (!bOk)
+            break;
+        long sStart = ftell(f);
+        if (sType == (uint32_t)Zkey::ZKEY_HEADER_SECTION)
+        {
+            bProtocol = (fread(&protocolId, sizeof(uint32_t), 1, f) == 1);
+        }
+        else if (sType == 2) // Protocol header, with the same first fields in groth16 and fflonk
+        {
+            uint32_t n8q, n8r, nVars;
+            bHeader = (fread(&n8q, sizeof(uint32_t), 1, f) == 1) && (fseek(f, n8q, SEEK_CUR) == 0) &&
+                      (fread(&n8r, sizeof(uint32_t), 1, f) == 1) && (fseek(f, n8r, SEEK_CUR) == 0) &&
+                      (fread(&nVars, sizeof(uint32_t), 1, f) == 1) && (fread(&nPublic, sizeof(uint32_t), 1, f) == 1) &&
+                      (fread(&domainSize, sizeof(uint32_t), 1, f) == 1);
+            nAdditions = 0;
+            nConstraints = 0;
+            if (bHeader && bProtocol && (protocolId == (uint32_t)Zkey::FFLONK_PROTOCOL_ID))
+            {
+                bHeader = (fread(&nAdditions, sizeof(uint32_t), 1, f) == 1) && (fread(&nConstraints, sizeof(uint32_t), 1, f) == 1);
+            }
+        }
+        bOk = (fseek(f, sStart + sSize, SEEK_SET) == 0);
+    }
+    fclose(f);
+    if (!bProtocol || !bHeader)
+    {
+        cerr << "Error: planMemory() failed reading the header of zkey file " << fileName << endl;
+        return false;
+    }
+    return true;
+}
+
+bool planMemory(const Config &config)
+{
+    cout << "MEMORY PLAN" << endl;
+
+    if (!config.generateProof())
+    {
+        cout << "The configuration does not generate proofs, so no prover memory is allocated" << endl;
+        return true;
+    }
+
+    vector<MemoryComponent> components;
+    vector<MemoryStage> stages;
+    bool bFits = true;
+
+    // Committed polynomials, shared by the zkevm, c12a, recursive1 and recursive2 starks, and reserved memory of fflonk
+    StarkInfo starkInfo(config, config.zkevmStarkInfo);
+    uint64_t cm3Extra = starkInfo.mapSectionsN.section[eSection::cm3_2ns] * (1ULL << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element);
+    uint64_t polsSize = starkInfo.mapTotalN * sizeof(Goldilocks::Element) + cm3Extra;
+    components.push_back({"Committed polynomials (mapTotalN)", starkInfo.mapTotalN * sizeof(Goldilocks::Element), config.zkevmCmPols.size() > 0});
+    components.push_back({"Committed polynomials (cm3_2ns extra buffer)", cm3Extra, config.zkevmCmPols.size() > 0});
+
+    // Second buffer of the batch proofs pipeline, if it fits in pipelineMaxMemory
+    if (config.pipelineBatchProofs)
+    {
+        uint64_t cmPolsSize = PROVER_FORK_NAMESPACE::CommitPols::pilSize();
+        if ((config.pipelineMaxMemory > 0) && (polsSize + cmPolsSize > config.pipelineMaxMemory))
+        {
+            cout << "Warning: batch proofs will not be pipelined, since the second committed polynomials buffer of " << bytes2MB(cmPolsSize) << " exceeds pipelineMaxMemory=" << config.pipelineMaxMemory << endl;
+        }
+        else
+        {
+            components.push_back({"Pipeline committed polynomials", cmPolsSize, false});
+        }
+    }
+
+    planStarks(config, "zkevm", config.zkevmStarkInfo, config.zkevmDomainTables, components);
+    planStarks(config, "c12a", config.c12aStarkInfo, config.c12aDomainTables, components);
+    planStarks(config, "recursive1", config.recursive1StarkInfo, config.recursive1DomainTables, components);
+    planStarks(config, "recursive2", config.recursive2StarkInfo, config.recursive2DomainTables, components);
+
+    // Same allocations as the StarkRecursiveF constructor
+    StarkInfo starkInfoRecursiveF(config, config.recursivefStarkInfo);
+    uint64_t nBitsF = starkInfoRecursiveF.starkStruct.nBits;
+    uint64_t nBitsExtF = starkInfoRecursiveF.starkStruct.nBitsExt;
+    components.push_back({"recursiveF committed polynomials", starkInfoRecursiveF.mapTotalN * sizeof(Goldilocks::Element), false});
+    components.push_back({"recursiveF constant polynomials", starkInfoRecursiveF.nConstants * (1ULL << nBitsF) * sizeof(Goldilocks::Element), config.mapConstPolsFile});
+    components.push_back({"recursiveF constants tree", getFileSize(config.recursivefConstantsTree), config.mapConstantsTreeFile});
+    components.push_back({"recursiveF domain tables", DomainTables::getFileSize(nBitsF, nBitsExtF), config.mapConstantsTreeFile && fileExists(config.recursivefDomainTables)});
+    components.push_back({"recursiveF buffer", starkInfoRecursiveF.mapSectionsN.section[eSection::cm1_n] * (1ULL << nBitsExtF) * FIELD_EXTENSION * sizeof(Goldilocks::Element), false});
+    components.push_back({"recursiveF Merkle trees nodes", 4 * MerkleTreeBN128::getNumNodes(1ULL << nBitsExtF) * sizeof(RawFr::Element), false});
+
+    // Verifier circuits: witness map and constants, loaded once; signals and witness, allocated by every witness calculation
+    components.push_back({"zkevm verifier circuit", Circom::get_size_of_witness() * sizeof(uint64_t) + Circom::get_size_of_constants() * sizeof(FrGElement), false});
+    components.push_back({"recursive1 verifier circuit", CircomRecursive1::get_size_of_witness() * sizeof(uint64_t) + CircomRecursive1::get_size_of_constants() * sizeof(FrGElement), false});
+    components.push_back({"recursive2 verifier circuit", CircomRecursive2::get_size_of_witness() * sizeof(uint64_t) + CircomRecursive2::get_size_of_constants() * sizeof(FrGElement), false});
+    components.push_back({"recursiveF verifier circuit", CircomRecursiveF::get_size_of_witness() * sizeof(uint64_t) + CircomRecursiveF::get_size_of_constants() * sizeof(FrGElement), false});
+    components.push_back({"final verifier circuit", CircomFinal::get_size_of_witness() * sizeof(uint64_t) + CircomFinal::get_size_of_constants() * sizeof(FrElement), false});
+
+    // Exec files are stored in the file as u64 and loaded as FrGElement
+    uint64_t execSize = getFileSize(config.c12aExec) + getFileSize(config.recursive1Exec) + getFileSize(config.recursive2Exec) + getFileSize(config.recursivefExec);
+    components.push_back({"Exec files", execSize / sizeof(uint64_t) * sizeof(FrGElement), false});
+
+    // The zkey is copied into memory; fflonk adds its precomputed buffers, and uses the committed polynomials as reserved memory
+    components.push_back({"Final zkey", getFileSize(config.finalStarkZkey), false});
+    uint32_t protocolId = 0, nPublic = 0, domainSize = 0, nAdditions = 0, nConstraints = 0;
+    if (readZkeyHeader(config.finalStarkZkey, protocolId, nPublic, domainSize, nAdditions, nConstraints) && (protocolId == (uint32_t)Zkey::FFLONK_PROTOCOL_ID))
+    {
+        // Same buffers as FflonkProver::setZkey()
+        uint64_t n = domainSize;
+        uint64_t precomputed = (n * 8 + n * 8 + n * 4 * 8 + n * 4 * nPublic) * sizeof(AltBn128::Engine::FrElement) + n * 9 * sizeof(AltBn128::Engine::G1PointAffine);
+        components.push_back({"Fflonk precomputed buffers", precomputed + uint64_t(nConstraints) * 3 * sizeof(uint32_t) + uint64_t(nAdditions) * sizeof(AltBn128::Engine::FrElement), false});
+
+        uint64_t reserved = (n * 2 + n * (16 + 8 + 16 + 16 + 16) + n * 4 * 4 + n * (4 * 3 + 16)) * sizeof(AltBn128::Engine::FrElement);
+        cout << "Fflonk reserved memory: " << bytes2MB(reserved) << " of the " << bytes2MB(polsSize) << " of committed polynomials" << endl;
+        if (reserved > polsSize)
+        {
+            cerr << "Error: planMemory() found that the fflonk reserved memory of " << bytes2MB(reserved) << " does not fit in the committed polynomials buffer of " << bytes2MB(polsSize) << endl;
+            bFits = false;
+        }
+    }
+    else if (protocolId == (uint32_t)Zkey::GROTH16_PROTOCOL_ID)
+    {
+        cout << "Warning: the temporary memory of the groth16 proof is not included" << endl;
+    }
+
+    // Temporary memory of every stage: the starks allocate their proof temporaries, see planStarkProof(), and the witness
+    // calculations allocate their signals and their witness
+    stages.push_back({"executor", 0});
+    stages.push_back({"zkevm stark", planStarkProof(config, config.zkevmStarkInfo)});
+    stages.push_back({"c12a witness", (uint64_t(Circom::get_total_signal_no()) + Circom::get_size_of_witness()) * sizeof(FrGElement)});
+    stages.push_back({"c12a stark", planStarkProof(config, config.c12aStarkInfo)});
+    stages.push_back({"recursive1 witness", (uint64_t(CircomRecursive1::get_total_signal_no()) + CircomRecursive1::get_size_of_witness()) * sizeof(FrGElement)});
+    stages.push_back({"recursive1 stark", planStarkProof(config, config.recursive1StarkInfo)});
+    stages.push_back({"recursive2 witness", (uint64_t(CircomRecursive2::get_total_signal_no()) + CircomRecursive2::get_size_of_witness()) * sizeof(FrGElement)});
+    stages.push_back({"recursive2 stark", planStarkProof(config, config.recursive2StarkInfo)});
+    stages.push_back({"recursiveF witness", (uint64_t(CircomRecursiveF::get_total_signal_no()) + CircomRecursiveF::get_size_of_witness()) * sizeof(FrGElement)});
+    stages.push_back({"recursiveF stark", planStarkRecursiveFProof(config)});
+    stages.push_back({"final witness", (uint64_t(CircomFinal::get_total_signal_no()) + CircomFinal::get_size_of_witness()) * sizeof(FrElement)});
+    stages.push_back({"final snark", 0});
+
+    // Print the components
+    uint64_t total = 0;
+    uint64_t totalMapped = 0;
+    for (uint64_t i = 0; i < components.size(); i++)
+    {
+        cout << "    " << left << setw(48) << components[i].name << right << setw(16) << bytes2MB(components[i].size) << (components[i].bMapped ? " (mapped)" : "") << endl;
+        total += components[i].size;
+        totalMapped += components[i].bMapped ? components[i].size : 0;
+    }
+    cout << "    " << left << setw(48) << "Total allocated at start" << right << setw(16) << bytes2MB(total) << ", " << bytes2MB(totalMapped) << " of it mapped from files" << endl;
+
+    // Print the peak of every stage, and check it against the budget; the files mapped into memory are page cache, which
+    // the kernel can reclaim, so they are reported apart and not checked
+    uint64_t resident = total - totalMapped;
+    uint64_t budget = config.planMemoryBudget;
+    if (budget == 0)
+    {
+        MemoryInfo info;
+        getMemoryInfo(info);
+        budget = info.total * 1024;
+    }
+    uint64_t peak = 0;
+    cout << "PEAK PER STAGE (without the mapped files)" << endl;
+    for (uint64_t i = 0; i < stages.size(); i++)
+    {
+        uint64_t stagePeak = resident + stages[i].size;
+        peak = std::max(peak, stagePeak);
+        cout << "    " << left << setw(48) << stages[i].name << right << setw(16) << bytes2MB(stagePeak) << " (" << bytes2MB(stages[i].size) << " temporary)" << endl;
+        if (stagePeak > budget)
+        {
+            cerr << "Error: planMemory() found that stage " << stages[i].name << " needs " << bytes2MB(stagePeak) << ", more than the budget of " << bytes2MB(budget) << endl;
+            bFits = false;
+        }
+    }
+    cout << "Peak=" << bytes2MB(peak) << " budget=" << bytes2MB(budget) << (bFits ? " fits" : " DOES NOT FIT") << endl;
+    cout << "Mapped files=" << bytes2MB(totalMapped) << " of page cache, on top of the peak if it is available, not checked against the budget" << endl;
+    cout << "The executor state machines, the database cache and the thread stacks are not included" << endl;
+
+    return bFits;
+}
@@ -0,0 +1,17 @@
+#ifndef MEMORY_PLAN_HPP
+#define MEMORY_PLAN_HPP
+
+#include "config.hpp"
+
+/*
+    Memory plan of the prover for a configuration, computed from the stark infos, the zkey header and the circuits sizes,
+    without allocating or loading anything else.
+    Prints the memory of every component allocated by the prover when it starts, the peak of every proof stage, which adds
+    the temporary memory of the stage, e.g. the FRI trees of a stark, and a warning for every stage that exceeds
+    config.planMemoryBudget, or the memory of this machine if it is 0. The files mapped into memory are page cache that the
+    kernel can reclaim, so they are printed apart and not checked against the budget.
+    Returns false if the configuration does not fit.
+*/
+bool planMemory(const Config &config);
+
+#endif
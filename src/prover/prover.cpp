@@ -1,6 +1,8 @@
 #include <fstream>
 #include <iomanip>
 #include <unistd.h>
+#include <omp.h>
+#include <filesystem>
 #include "prover.hpp"
 #include "utils.hpp"
 #include "scalar.hpp"
@@ -30,13 +32,14 @@
 #include "recursive1Steps.hpp"
 #include "recursive2Steps.hpp"
 
-#define NROWS_STEPS_ 4 // if AVX is used this must be 4
+#define NROWS_STEPS_ 4 // if AVX2 is used this must be 4
 
 Prover::Prover(Goldilocks &fr,
                PoseidonGoldilocks &poseidon,
                const Config &config) : fr(fr),
                                        poseidon(poseidon),
                                        executor(fr, config, poseidon),
+                                       pendingRequests(config),
                                        pCurrentRequest(NULL),
                                        config(config),
                                        lastComputedRequestEndTime(0)
@@ -83,8 +86,6 @@ Prover::Prover(Goldilocks &fr,
             sem_init(&pendingRequestSem, 0, 0);
             pthread_mutex_init(&mutex, NULL);
             pCurrentRequest = NULL;
-            pthread_create(&proverPthread, NULL, proverThread, this);
-            pthread_create(&cleanerPthread, NULL, cleanerThread, this);
 
             StarkInfo _starkInfo(config, config.zkevmStarkInfo);
 
@@ -104,12 +105,9 @@ Prover::Prover(Goldilocks &fr,
             }
             else
             {
-                pAddress = calloc(polsSize, 1);
-                if (pAddress == NULL)
-                {
-                    cerr << "Error: Prover::genBatchProof() failed calling malloc() of size " << polsSize << endl;
-                    exitProcess();
-                }
+                TimerStart(PROVER_ALLOCATE_COMMITTED_POLS);
+                pAddress = cmPolsArena.allocate(polsSize, config.cmPolsHugePages, config.cmPolsNumaPolicy);
+                TimerStopAndLog(PROVER_ALLOCATE_COMMITTED_POLS);
                 cout << "Prover::genBatchProof() successfully allocated " << polsSize << " bytes" << endl;
             }
 
@@ -119,12 +117,59 @@ Prover::Prover(Goldilocks &fr,
             StarkInfo _starkInfoRecursiveF(config, config.recursivefStarkInfo);
             pAddressStarksRecursiveF = (void *)malloc(_starkInfoRecursiveF.mapTotalN * sizeof(Goldilocks::Element));
 
-            starkZkevm = new Starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo}, pAddress);
-            starkZkevm->nrowsStepBatch = NROWS_STEPS_;
-            starksC12a = new Starks(config, {config.c12aConstPols, config.mapConstPolsFile, config.c12aConstantsTree, config.c12aStarkInfo}, pAddress);
-            starksRecursive1 = new Starks(config, {config.recursive1ConstPols, config.mapConstPolsFile, config.recursive1ConstantsTree, config.recursive1StarkInfo}, pAddress);
-            starksRecursive2 = new Starks(config, {config.recursive2ConstPols, config.mapConstPolsFile, config.recursive2ConstantsTree, config.recursive2StarkInfo}, pAddress);
+            starkZkevm = new Starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo, config.zkevmDomainTables}, pAddress);
+            // Process 8 rows per batch with the AVX-512 step parsers if the CPU supports them, 4 rows with the AVX2 ones otherwise
+            starkZkevm->nrowsStepBatch = cpuSupportsAvx512() ? NROWS_STEPS_AVX512_ : NROWS_STEPS_;
+            cout << "Prover::Prover() using " << (cpuSupportsAvx512() ? "AVX-512" : "AVX2") << " step parsers" << endl;
+            if (cpuSupportsAvx512() && config.checkCompiledChelpers)
+            {
+                cout << "Prover::Prover() checkCompiledChelpers has no effect since the compiled step kernels are only used by the AVX2 step parsers" << endl;
+            }
+            starksC12a = new Starks(config, {config.c12aConstPols, config.mapConstPolsFile, config.c12aConstantsTree, config.c12aStarkInfo, config.c12aDomainTables}, pAddress);
+            starksRecursive1 = new Starks(config, {config.recursive1ConstPols, config.mapConstPolsFile, config.recursive1ConstantsTree, config.recursive1StarkInfo, config.recursive1DomainTables}, pAddress);
+            starksRecursive2 = new Starks(config, {config.recursive2ConstPols, config.mapConstPolsFile, config.recursive2ConstantsTree, config.recursive2StarkInfo, config.recursive2DomainTables}, pAddress);
             starksRecursiveF = new StarkRecursiveF(config, pAddressStarksRecursiveF);
+
+            witnessThreads = (config.maxWitnessThreads > 0) ? config.maxWitnessThreads : omp_get_max_threads();
+
+            if (config.pipelineBatchProofs)
+            {
+                uint64_t cmPolsSize = PROVER_FORK_NAMESPACE::CommitPols::pilSize();
+                if ((config.pipelineMaxMemory > 0) && (polsSize + cmPolsSize > config.pipelineMaxMemory))
+                {
+                    cout << "Prover::Prover() batch proofs are not pipelined, since the second committed polynomials buffer of " << cmPolsSize << " bytes exceeds pipelineMaxMemory=" << config.pipelineMaxMemory << endl;
+                }
+                else
+                {
+                    TimerStart(PROVER_ALLOCATE_PIPELINE_COMMITTED_POLS);
+                    pAddressPipeline = pipelineArena.allocate(cmPolsSize, config.cmPolsHugePages, config.cmPolsNumaPolicy);
+                    TimerStopAndLog(PROVER_ALLOCATE_PIPELINE_COMMITTED_POLS);
+                    bPipeline = true;
+                    pthread_cond_init(&pipelineCond, NULL);
+                    pthread_create(&pipelineExecutorPthread, NULL, pipelineExecutorThread, this);
+                    cout << "Prover::Prover() batch proofs are pipelined with a second committed polynomials buffer of " << cmPolsSize << " bytes" << endl;
+                }
+            }
+
+            // Started once bPipeline is known, since the prover thread sizes its OpenMP team from it
+            pthread_create(&proverPthread, NULL, proverThread, this);
+            pthread_create(&cleanerPthread, NULL, cleanerThread, this);
+
+            TimerStart(CIRCOM_LOAD_CIRCUITS);
+            circuitZkevm = Circom::loadCircuit(config.zkevmVerifier);
+            circuitRecursive1 = CircomRecursive1::loadCircuit(config.recursive1Verifier);
+            circuitRecursive2 = CircomRecursive2::loadCircuit(config.recursive2Verifier);
+            circuitRecursiveF = CircomRecursiveF::loadCircuit(config.recursivefVerifier);
+            circuitFinal = CircomFinal::loadCircuit(config.finalVerifier);
+            execC12a = new ExecFile(config.c12aExec);
+            execRecursive1 = new ExecFile(config.recursive1Exec);
+            execRecursive2 = new ExecFile(config.recursive2Exec);
+            execRecursiveF = new ExecFile(config.recursivefExec);
+            execC12a->setAddsChunks(Circom::get_size_of_witness());
+            execRecursive1->setAddsChunks(CircomRecursive1::get_size_of_witness());
+            execRecursive2->setAddsChunks(CircomRecursive2::get_size_of_witness());
+            execRecursiveF->setAddsChunks(CircomRecursiveF::get_size_of_witness());
+            TimerStopAndLog(CIRCOM_LOAD_CIRCUITS);
         }
     }
     catch (std::exception &e)
@@ -164,7 +209,7 @@ Prover::~Prover()
         }
         else
         {
-            free(pAddress);
+            cmPolsArena.release();
         }
         free(pAddressStarksRecursiveF);
 
@@ -174,6 +219,16 @@ Prover::~Prover()
         delete starksC12a;
         delete starksRecursive1;
         delete starksRecursive2;
+
+        Circom::freeCircuit(circuitZkevm);
+        CircomRecursive1::freeCircuit(circuitRecursive1);
+        CircomRecursive2::freeCircuit(circuitRecursive2);
+        CircomRecursiveF::freeCircuit(circuitRecursiveF);
+        CircomFinal::freeCircuit(circuitFinal);
+        delete execC12a;
+        delete execRecursive1;
+        delete execRecursive2;
+        delete execRecursiveF;
     }
 }
 
@@ -184,6 +239,12 @@ void *proverThread(void *arg)
 
     zkassert(pProver->config.generateProof());
 
+    // Leave the cores of the pipelined executor to it
+    if (pProver->bPipeline && (pProver->config.pipelineExecutorThreads > 0))
+    {
+        omp_set_num_threads(std::max(1, omp_get_max_threads() - (int)pProver->config.pipelineExecutorThreads));
+    }
+
     while (true)
     {
         pProver->lock();
@@ -203,10 +264,10 @@ void *proverThread(void *arg)
             continue;
         }
 
-        // Extract the first pending request (first in, first out)
-        pProver->pCurrentRequest = pProver->pendingRequests[0];
+        // Extract the next pending request, as per the scheduler priorities, weights and deadlines
+        pProver->pCurrentRequest = pProver->pendingRequests.pop();
         pProver->pCurrentRequest->startTime = time(NULL);
-        pProver->pendingRequests.erase(pProver->pendingRequests.begin());
+        pProver->notifyPipeline();
 
         cout << "proverThread() starting to process request with UUID: " << pProver->pCurrentRequest->uuid << endl;
 
@@ -241,9 +302,11 @@ void *proverThread(void *arg)
 
         pProver->completedRequests.push_back(pProver->pCurrentRequest);
         pProver->pCurrentRequest = NULL;
+        string schedulerStatistics = pProver->pendingRequests.getStatistics();
         pProver->unlock();
 
-        cout << "proverThread() done processing request with UUID: " << pProverRequest->uuid << endl;
+        cout << "proverThread() done processing request with UUID: " << pProverRequest->uuid << " after waiting " << pProverRequest->startTime - pProverRequest->submitTime << "s" << endl;
+        cout << "proverThread() scheduler statistics:" << endl << schedulerStatistics;
 
         // Release the prove request semaphore to notify any blocked waiting call
         pProverRequest->notifyCompleted();
@@ -252,6 +315,27 @@ void *proverThread(void *arg)
     return NULL;
 }
 
+void *pipelineExecutorThread(void *arg)
+{
+    Prover *pProver = (Prover *)arg;
+    cout << "pipelineExecutorThread() started" << endl;
+
+    zkassert(pProver->config.generateProof());
+
+    // Reserve the configured cores to the executor; the prover thread uses the rest
+    if (pProver->config.pipelineExecutorThreads > 0)
+    {
+        omp_set_num_threads(pProver->config.pipelineExecutorThreads);
+    }
+
+    while (true)
+    {
+        pProver->executePipelinedBatchProof();
+    }
+    cout << "pipelineExecutorThread() done" << endl;
+    return NULL;
+}
+
 void *cleanerThread(void *arg)
 {
     Prover *pProver = (Prover *)arg;
@@ -295,6 +379,30 @@ void *cleanerThread(void *arg)
     return NULL;
 }
 
+void Prover::executePipelinedBatchProof(void)
+{
+    // Wait until the pipeline buffer is free, a request is being proved and the next pending one is a batch proof
+    lock();
+    while ((pPipelineRequest != NULL) || (pCurrentRequest == NULL) || (pendingRequests.front() == NULL) || (pendingRequests.front()->type != prt_genBatchProof))
+    {
+        pthread_cond_wait(&pipelineCond, &mutex);
+    }
+    ProverRequest *pProverRequest = pendingRequests.front();
+    pPipelineRequest = pProverRequest;
+    bPipelineExecuted = false;
+    cout << "Prover::executePipelinedBatchProof() executing request with UUID: " << pProverRequest->uuid << " while processing request with UUID: " << pCurrentRequest->uuid << endl;
+    unlock();
+
+    TimerStart(PROVER_PIPELINE_EXECUTOR);
+    executeBatchProof(pProverRequest, pAddressPipeline);
+    TimerStopAndLog(PROVER_PIPELINE_EXECUTOR);
+
+    lock();
+    bPipelineExecuted = true;
+    notifyPipeline();
+    unlock();
+}
+
 string Prover::submitRequest(ProverRequest *pProverRequest) // returns UUID for this request
 {
     zkassert(config.generateProof());
@@ -308,8 +416,9 @@ string Prover::submitRequest(ProverRequest *pProverRequest) // returns UUID for
     // Add the request to the pending requests queue, and release the semaphore to notify the prover thread
     lock();
     requestsMap[uuid] = pProverRequest;
-    pendingRequests.push_back(pProverRequest);
+    pendingRequests.push(pProverRequest);
     sem_post(&pendingRequestSem);
+    notifyPipeline();
     unlock();
 
     cout << "Prover::submitRequest() returns UUID: " << uuid << endl;
@@ -376,6 +485,75 @@ void Prover::processBatch(ProverRequest *pProverRequest)
     TimerStopAndLog(PROVER_PROCESS_BATCH);
 }
 
+// Name, size and modification time of every file the checkpointed stages depend on, so that checkpoints
+// made with other ROM, stark info, constant polynomials or circuits are never resumed
+static string batchProofCheckpointFingerprint(const Config &config)
+{
+    vector<string> files = {config.rom,
+                            config.zkevmStarkInfo, config.zkevmConstPols,
+                            config.zkevmVerifier, config.c12aExec,
+                            config.c12aStarkInfo, config.c12aConstPols,
+                            config.recursive2Verkey};
+    stringstream ss;
+    for (uint64_t i = 0; i < files.size(); i++)
+    {
+        std::error_code ec;
+        uint64_t size = std::filesystem::file_size(files[i], ec);
+        int64_t time = ec ? 0 : std::filesystem::last_write_time(files[i], ec).time_since_epoch().count();
+        ss << files[i] << ":" << (ec ? 0 : size) << ":" << (ec ? 0 : time) << "\n";
+    }
+    return ss.str();
+}
+
+// Checkpoints are keyed by the hash of the input and of the configuration fingerprint, so a batch proof submitted again,
+// with a new UUID, after a restart finds them, as long as the prover configuration files have not changed
+static string batchProofCheckpointKey(ProverRequest *pProverRequest, const Config &config)
+{
+    json inputJson;
+    pProverRequest->input.save(inputJson);
+    string inputString = inputJson.dump() + "\n" + batchProofCheckpointFingerprint(config);
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+    SHA256((const unsigned char *)inputString.data(), inputString.size(), hash);
+    stringstream ss;
+    for (uint64_t i = 0; i < SHA256_DIGEST_LENGTH; i++)
+    {
+        ss << setfill('0') << setw(2) << hex << (uint64_t)hash[i];
+    }
+    return ss.str();
+}
+
+// Writes a temporary file and renames it, so an interrupted write never leaves an incomplete checkpoint
+static void saveCheckpointFile(const string &fileName, const void *pData, uint64_t size)
+{
+    string tmpFileName = fileName + ".tmp";
+    FILE *f = fopen(tmpFileName.c_str(), "wb");
+    if (f == NULL)
+    {
+        cerr << "Error: saveCheckpointFile() failed calling fopen() of file " << tmpFileName << endl;
+        exitProcess();
+    }
+    bool bOk = (fwrite(pData, 1, size, f) == size);
+    bOk = (fclose(f) == 0) && bOk;
+    if (!bOk || (rename(tmpFileName.c_str(), fileName.c_str()) != 0))
+    {
+        cerr << "Error: saveCheckpointFile() failed writing file " << fileName << endl;
+        exitProcess();
+    }
+}
+
+// Returns false if the checkpoint does not exist or does not have the expected size
+static bool loadCheckpointFile(const string &fileName, void *pData, uint64_t size)
+{
+    FILE *f = fopen(fileName.c_str(), "rb");
+    if (f == NULL)
+    {
+        return false;
+    }
+    bool bOk = (fread(pData, 1, size, f) == size) && (fgetc(f) == EOF);
+    fclose(f);
+    return bOk;
+}
+
 void Prover::genBatchProof(ProverRequest *pProverRequest)
 {
     zkassert(config.generateProof());
@@ -394,42 +572,91 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
     // cout << "Prover::genBatchProof() public file: " << pProverRequest->publicsOutputFile() << endl;
     // cout << "Prover::genBatchProof() proof file: " << pProverRequest->proofFile() << endl;
 
-    // Save input to <timestamp>.input.json, as provided by client
-    if (config.saveInputToFile)
+    /***************/
+    /* Checkpoints */
+    /***************/
+    // Every completed stage is saved into the checkpoint folder of this input: the committed polynomials after the executor,
+    // and the zkin of the zkevm and c12a proofs, which contain the whole proof and the publics; the batch proof resumes after
+    // the last one found. The folder is removed when the batch proof completes or fails, and is only left behind if the
+    // process dies, which is when it is needed
+    string checkpointFolder;
+    ZkinStark zkin;     // zkevm proof, input of the c12a circuit
+    ZkinStark zkinC12a; // c12a proof, input of the recursive1 circuit
+    bool bZkinCheckpoint = false;
+    bool bZkinC12aCheckpoint = false;
+    if (config.batchProofCheckpointPath != "")
     {
-        json inputJson;
-        pProverRequest->input.save(inputJson);
-        json2file(inputJson, pProverRequest->inputFile());
+        checkpointFolder = config.batchProofCheckpointPath + "/" + batchProofCheckpointKey(pProverRequest, config) + "/";
+        ensureDirectoryExists(checkpointFolder);
+        TimerStart(CHECKPOINT_LOAD_BATCH_PROOF);
+        bZkinC12aCheckpoint = zkinC12a.load(checkpointFolder + "c12a.zkin.bin");
+        bZkinCheckpoint = !bZkinC12aCheckpoint && zkin.load(checkpointFolder + "zkevm.zkin.bin");
+        TimerStopAndLog(CHECKPOINT_LOAD_BATCH_PROOF);
+        if (bZkinC12aCheckpoint || bZkinCheckpoint)
+        {
+            cout << "Prover::genBatchProof() resuming after the " << (bZkinC12aCheckpoint ? "c12a" : "zkevm") << " proof from checkpoint folder " << checkpointFolder << endl;
+        }
     }
 
     /************/
     /* Executor */
     /************/
-    TimerStart(EXECUTOR_EXECUTE_INITIALIZATION);
-
-    PROVER_FORK_NAMESPACE::CommitPols cmPols(pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
-    uint64_t num_threads = omp_get_max_threads();
-    uint64_t bytes_per_thread = cmPols.size() / num_threads;
-#pragma omp parallel for num_threads(num_threads)
-    for (uint64_t i = 0; i < cmPols.size(); i += bytes_per_thread) // Each iteration processes 64 bytes at a time
+    lock();
+    bool bPipelined = bPipeline && (pPipelineRequest == pProverRequest);
+    unlock();
+    if (bPipelined)
     {
-        memset((uint8_t *)pAddress + i, 0, bytes_per_thread);
-    }
+        // The executor has run, or is running, in the pipeline thread while the previous request was proved
+        TimerStart(PROVER_PIPELINE_WAIT_EXECUTOR);
+        lock();
+        while (!bPipelineExecuted)
+        {
+            pthread_cond_wait(&pipelineCond, &mutex);
+        }
+        unlock();
+        TimerStopAndLog(PROVER_PIPELINE_WAIT_EXECUTOR);
 
-    TimerStopAndLog(EXECUTOR_EXECUTE_INITIALIZATION);
-    // Execute all the State Machines
-    TimerStart(EXECUTOR_EXECUTE_BATCH_PROOF);
-    executor.execute(*pProverRequest, cmPols);
-    TimerStopAndLog(EXECUTOR_EXECUTE_BATCH_PROOF);
+        TimerStart(PROVER_PIPELINE_COPY_COMMITTED_POLS);
+        MemoryArena::parallelCopy(pAddress, pAddressPipeline, PROVER_FORK_NAMESPACE::CommitPols::pilSize(), cmPolsArena.getPageSize());
+        TimerStopAndLog(PROVER_PIPELINE_COPY_COMMITTED_POLS);
 
-    // Save commit pols to file zkevm.commit
-    if (config.zkevmCmPolsAfterExecutor != "")
+        if ((checkpointFolder != "") && (pProverRequest->result == ZKR_SUCCESS))
+        {
+            TimerStart(CHECKPOINT_SAVE_EXECUTOR);
+            saveCheckpointFile(checkpointFolder + "executor.commit", pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilSize());
+            TimerStopAndLog(CHECKPOINT_SAVE_EXECUTOR);
+        }
+
+        // Release the pipeline buffer to the next batch proof
+        lock();
+        pPipelineRequest = NULL;
+        bPipelineExecuted = false;
+        notifyPipeline();
+        unlock();
+    }
+    else if (bZkinCheckpoint || bZkinC12aCheckpoint)
     {
-        void *pointerCmPols = mapFile(config.zkevmCmPolsAfterExecutor, cmPols.size(), true);
-        memcpy(pointerCmPols, cmPols.address(), cmPols.size());
-        unmapFile(pointerCmPols, cmPols.size());
+        // The committed polynomials are not needed any more
+        pProverRequest->result = ZKR_SUCCESS;
+    }
+    else if ((checkpointFolder != "") && loadCheckpointFile(checkpointFolder + "executor.commit", pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilSize()))
+    {
+        cout << "Prover::genBatchProof() resuming after the executor from checkpoint folder " << checkpointFolder << endl;
+        pProverRequest->result = ZKR_SUCCESS;
+    }
+    else
+    {
+        executeBatchProof(pProverRequest, pAddress);
+        if ((checkpointFolder != "") && (pProverRequest->result == ZKR_SUCCESS))
+        {
+            TimerStart(CHECKPOINT_SAVE_EXECUTOR);
+            saveCheckpointFile(checkpointFolder + "executor.commit", pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilSize());
+            TimerStopAndLog(CHECKPOINT_SAVE_EXECUTOR);
+        }
     }
 
+    PROVER_FORK_NAMESPACE::CommitPols cmPols(pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
+
     if (pProverRequest->result == ZKR_SUCCESS)
     {
         /*************************************/
@@ -438,72 +665,84 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         TimerStart(SAVE_PUBLICS_JSON_BATCH_PROOF);
         json publicStarkJson;
 
-        uint64_t lastN = cmPols.pilDegree() - 1;
-
         json recursive2Verkey;
         file2json(config.recursive2Verkey, recursive2Verkey);
 
         Goldilocks::Element publics[starksRecursive1->starkInfo.nPublics];
 
-        // oldStateRoot
-        publics[0] = cmPols.Main.B0[0];
-        publics[1] = cmPols.Main.B1[0];
-        publics[2] = cmPols.Main.B2[0];
-        publics[3] = cmPols.Main.B3[0];
-        publics[4] = cmPols.Main.B4[0];
-        publics[5] = cmPols.Main.B5[0];
-        publics[6] = cmPols.Main.B6[0];
-        publics[7] = cmPols.Main.B7[0];
-
-        // oldAccInputHash
-        publics[8] = cmPols.Main.C0[0];
-        publics[9] = cmPols.Main.C1[0];
-        publics[10] = cmPols.Main.C2[0];
-        publics[11] = cmPols.Main.C3[0];
-        publics[12] = cmPols.Main.C4[0];
-        publics[13] = cmPols.Main.C5[0];
-        publics[14] = cmPols.Main.C6[0];
-        publics[15] = cmPols.Main.C7[0];
-
-        // oldBatchNum
-        publics[16] = cmPols.Main.SP[0];
-        // chainId
-        publics[17] = cmPols.Main.GAS[0];
-        // forkid
-        publics[18] = cmPols.Main.CTX[0];
-
-        // newStateRoot
-        publics[19] = cmPols.Main.SR0[lastN];
-        publics[20] = cmPols.Main.SR1[lastN];
-        publics[21] = cmPols.Main.SR2[lastN];
-        publics[22] = cmPols.Main.SR3[lastN];
-        publics[23] = cmPols.Main.SR4[lastN];
-        publics[24] = cmPols.Main.SR5[lastN];
-        publics[25] = cmPols.Main.SR6[lastN];
-        publics[26] = cmPols.Main.SR7[lastN];
-
-        // newAccInputHash
-        publics[27] = cmPols.Main.D0[lastN];
-        publics[28] = cmPols.Main.D1[lastN];
-        publics[29] = cmPols.Main.D2[lastN];
-        publics[30] = cmPols.Main.D3[lastN];
-        publics[31] = cmPols.Main.D4[lastN];
-        publics[32] = cmPols.Main.D5[lastN];
-        publics[33] = cmPols.Main.D6[lastN];
-        publics[34] = cmPols.Main.D7[lastN];
-
-        // localExitRoot
-        publics[35] = cmPols.Main.E0[lastN];
-        publics[36] = cmPols.Main.E1[lastN];
-        publics[37] = cmPols.Main.E2[lastN];
-        publics[38] = cmPols.Main.E3[lastN];
-        publics[39] = cmPols.Main.E4[lastN];
-        publics[40] = cmPols.Main.E5[lastN];
-        publics[41] = cmPols.Main.E6[lastN];
-        publics[42] = cmPols.Main.E7[lastN];
-
-        // newBatchNum
-        publics[43] = cmPols.Main.PC[lastN];
+        if (bZkinCheckpoint || bZkinC12aCheckpoint)
+        {
+            // The checkpointed zkin keeps the publics of the batch
+            std::vector<uint64_t> &publicsCheckpoint = (bZkinC12aCheckpoint ? zkinC12a : zkin).get("publics");
+            for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
+            {
+                publics[i] = Goldilocks::fromU64(publicsCheckpoint[i]);
+            }
+        }
+        else
+        {
+            uint64_t lastN = cmPols.pilDegree() - 1;
+
+            // oldStateRoot
+            publics[0] = cmPols.Main.B0[0];
+            publics[1] = cmPols.Main.B1[0];
+            publics[2] = cmPols.Main.B2[0];
+            publics[3] = cmPols.Main.B3[0];
+            publics[4] = cmPols.Main.B4[0];
+            publics[5] = cmPols.Main.B5[0];
+            publics[6] = cmPols.Main.B6[0];
+            publics[7] = cmPols.Main.B7[0];
+
+            // oldAccInputHash
+            publics[8] = cmPols.Main.C0[0];
+            publics[9] = cmPols.Main.C1[0];
+            publics[10] = cmPols.Main.C2[0];
+            publics[11] = cmPols.Main.C3[0];
+            publics[12] = cmPols.Main.C4[0];
+            publics[13] = cmPols.Main.C5[0];
+            publics[14] = cmPols.Main.C6[0];
+            publics[15] = cmPols.Main.C7[0];
+
+            // oldBatchNum
+            publics[16] = cmPols.Main.SP[0];
+            // chainId
+            publics[17] = cmPols.Main.GAS[0];
+            // forkid
+            publics[18] = cmPols.Main.CTX[0];
+
+            // newStateRoot
+            publics[19] = cmPols.Main.SR0[lastN];
+            publics[20] = cmPols.Main.SR1[lastN];
+            publics[21] = cmPols.Main.SR2[lastN];
+            publics[22] = cmPols.Main.SR3[lastN];
+            publics[23] = cmPols.Main.SR4[lastN];
+            publics[24] = cmPols.Main.SR5[lastN];
+            publics[25] = cmPols.Main.SR6[lastN];
+            publics[26] = cmPols.Main.SR7[lastN];
+
+            // newAccInputHash
+            publics[27] = cmPols.Main.D0[lastN];
+            publics[28] = cmPols.Main.D1[lastN];
+            publics[29] = cmPols.Main.D2[lastN];
+            publics[30] = cmPols.Main.D3[lastN];
+            publics[31] = cmPols.Main.D4[lastN];
+            publics[32] = cmPols.Main.D5[lastN];
+            publics[33] = cmPols.Main.D6[lastN];
+            publics[34] = cmPols.Main.D7[lastN];
+
+            // localExitRoot
+            publics[35] = cmPols.Main.E0[lastN];
+            publics[36] = cmPols.Main.E1[lastN];
+            publics[37] = cmPols.Main.E2[lastN];
+            publics[38] = cmPols.Main.E3[lastN];
+            publics[39] = cmPols.Main.E4[lastN];
+            publics[40] = cmPols.Main.E5[lastN];
+            publics[41] = cmPols.Main.E6[lastN];
+            publics[42] = cmPols.Main.E7[lastN];
+
+            // newBatchNum
+            publics[43] = cmPols.Main.PC[lastN];
+        }
 
         publics[44] = Goldilocks::fromU64(recursive2Verkey["constRoot"][0]);
         publics[45] = Goldilocks::fromU64(recursive2Verkey["constRoot"][1]);
@@ -521,60 +760,77 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         /*  Generate stark proof            */
         /*************************************/
 
-        TimerStart(STARK_PROOF_BATCH_PROOF);
+        std::vector<Goldilocks::Element> publicsZkevm(publics, publics + starkZkevm->starkInfo.nPublics);
 
-        ZkevmSteps zkevmSteps;
-        uint64_t polBits = starkZkevm->starkInfo.starkStruct.steps[starkZkevm->starkInfo.starkStruct.steps.size() - 1].nBits;
-        FRIProof fproof((1 << polBits), FIELD_EXTENSION, starkZkevm->starkInfo.starkStruct.steps.size(), starkZkevm->starkInfo.evMap.size(), starkZkevm->starkInfo.nPublics);
-        starkZkevm->genProof(fproof, &publics[0], &zkevmSteps);
+        if (!bZkinCheckpoint && !bZkinC12aCheckpoint)
+        {
+            TimerStart(STARK_PROOF_BATCH_PROOF);
 
-        TimerStopAndLog(STARK_PROOF_BATCH_PROOF);
+            ZkevmSteps zkevmSteps;
+            uint64_t polBits = starkZkevm->starkInfo.starkStruct.steps[starkZkevm->starkInfo.starkStruct.steps.size() - 1].nBits;
+            FRIProof fproof((1 << polBits), FIELD_EXTENSION, starkZkevm->starkInfo.starkStruct.steps.size(), starkZkevm->starkInfo.evMap.size(), starkZkevm->starkInfo.nPublics);
+            starkZkevm->genProof(fproof, &publics[0], &zkevmSteps);
 
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF);
+            TimerStopAndLog(STARK_PROOF_BATCH_PROOF);
 
-        nlohmann::ordered_json jProof = fproof.proofs.proof2json();
-        nlohmann::json zkin = proof2zkinStark(jProof);
-        // Generate publics
-        jProof["publics"] = publicStarkJson;
-        zkin["publics"] = publicStarkJson;
+            TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF);
 
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF);
+            // The zkin is handed to the next circuit in binary form, without a json round trip
+            proof2zkinStark(fproof, zkin);
+            zkin.set("publics", publicsZkevm);
 
-        CommitPolsStarks cmPols12a(pAddress, (1 << starksC12a->starkInfo.starkStruct.nBits));
+            TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF);
 
-        Circom::getCommitedPols(&cmPols12a, config.zkevmVerifier, config.c12aExec, zkin, (1 << starksC12a->starkInfo.starkStruct.nBits));
+            if (checkpointFolder != "")
+            {
+                TimerStart(CHECKPOINT_SAVE_ZKEVM);
+                zkin.save(checkpointFolder + "zkevm.zkin.bin");
+                TimerStopAndLog(CHECKPOINT_SAVE_ZKEVM);
+            }
+        }
 
-        //-------------------------------------------
-        /* Generate C12a stark proof             */
-        //-------------------------------------------
-        TimerStart(STARK_C12_A_PROOF_BATCH_PROOF);
-        uint64_t polBitsC12 = starksC12a->starkInfo.starkStruct.steps[starksC12a->starkInfo.starkStruct.steps.size() - 1].nBits;
-        FRIProof fproofC12a((1 << polBitsC12), FIELD_EXTENSION, starksC12a->starkInfo.starkStruct.steps.size(), starksC12a->starkInfo.evMap.size(), starksC12a->starkInfo.nPublics);
+        if (!bZkinC12aCheckpoint)
+        {
+            CommitPolsStarks cmPols12a(pAddress, (1 << starksC12a->starkInfo.starkStruct.nBits));
 
-        // Generate the proof
-        C12aSteps c12aSteps;
+            Circom::getCommitedPols(&cmPols12a, circuitZkevm, *execC12a, zkin, (1 << starksC12a->starkInfo.starkStruct.nBits), witnessThreads);
 
-        starksC12a->genProof(fproofC12a, publics, &c12aSteps);
+            //-------------------------------------------
+            /* Generate C12a stark proof             */
+            //-------------------------------------------
+            TimerStart(STARK_C12_A_PROOF_BATCH_PROOF);
+            uint64_t polBitsC12 = starksC12a->starkInfo.starkStruct.steps[starksC12a->starkInfo.starkStruct.steps.size() - 1].nBits;
+            FRIProof fproofC12a((1 << polBitsC12), FIELD_EXTENSION, starksC12a->starkInfo.starkStruct.steps.size(), starksC12a->starkInfo.evMap.size(), starksC12a->starkInfo.nPublics);
 
-        TimerStopAndLog(STARK_C12_A_PROOF_BATCH_PROOF);
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+            // Generate the proof
+            C12aSteps c12aSteps;
 
-        // Save the proof & zkinproof
-        nlohmann::ordered_json jProofc12a = fproofC12a.proofs.proof2json();
-        nlohmann::json zkinC12a = proof2zkinStark(jProofc12a);
-
-        // Add the recursive2 verification key
-        json rootC;
-        rootC[0] = to_string(recursive2Verkey["constRoot"][0]);
-        rootC[1] = to_string(recursive2Verkey["constRoot"][1]);
-        rootC[2] = to_string(recursive2Verkey["constRoot"][2]);
-        rootC[3] = to_string(recursive2Verkey["constRoot"][3]);
-        zkinC12a["publics"] = publicStarkJson;
-        zkinC12a["rootC"] = rootC;
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+            starksC12a->genProof(fproofC12a, publics, &c12aSteps);
+
+            TimerStopAndLog(STARK_C12_A_PROOF_BATCH_PROOF);
+            TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
+
+            proof2zkinStark(fproofC12a, zkinC12a);
+            zkinC12a.set("publics", publicsZkevm);
+
+            // Add the recursive2 verification key
+            std::vector<uint64_t> &rootC = zkinC12a.set("rootC", {4});
+            rootC[0] = recursive2Verkey["constRoot"][0];
+            rootC[1] = recursive2Verkey["constRoot"][1];
+            rootC[2] = recursive2Verkey["constRoot"][2];
+            rootC[3] = recursive2Verkey["constRoot"][3];
+            TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
+
+            if (checkpointFolder != "")
+            {
+                TimerStart(CHECKPOINT_SAVE_C12A);
+                zkinC12a.save(checkpointFolder + "c12a.zkin.bin");
+                TimerStopAndLog(CHECKPOINT_SAVE_C12A);
+            }
+        }
 
         CommitPolsStarks cmPolsRecursive1(pAddress, (1 << starksRecursive1->starkInfo.starkStruct.nBits));
-        CircomRecursive1::getCommitedPols(&cmPolsRecursive1, config.recursive1Verifier, config.recursive1Exec, zkinC12a, (1 << starksRecursive1->starkInfo.starkStruct.nBits));
+        CircomRecursive1::getCommitedPols(&cmPolsRecursive1, circuitRecursive1, *execRecursive1, zkinC12a, (1 << starksRecursive1->starkInfo.starkStruct.nBits), witnessThreads);
 
         //-------------------------------------------
         /* Generate Recursive 1 proof            */
@@ -590,11 +846,12 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         // Save the proof & zkinproof
         TimerStart(SAVE_PROOF);
 
-        nlohmann::ordered_json jProofRecursive1 = fproofRecursive1.proofs.proof2json();
-        nlohmann::ordered_json zkinRecursive1 = proof2zkinStark(jProofRecursive1);
-        zkinRecursive1["publics"] = publicStarkJson;
+        ZkinStark zkinRecursive1;
+        proof2zkinStark(fproofRecursive1, zkinRecursive1);
+        zkinRecursive1.set("publics", publicsZkevm);
 
-        pProverRequest->batchProofOutput = zkinRecursive1;
+        // The output is returned to the client as json
+        pProverRequest->batchProofOutput = zkinRecursive1.toJson();
 
         // save publics to file
         json2file(publicStarkJson, pProverRequest->publicsOutputFile());
@@ -607,107 +864,119 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         // Save proof to file
         if (config.saveProofToFile)
         {
+            nlohmann::ordered_json jProofRecursive1 = fproofRecursive1.proofs.proof2json();
             jProofRecursive1["publics"] = publicStarkJson;
             json2file(jProofRecursive1, pProverRequest->filePrefix + "batch_proof.proof.json");
         }
         TimerStopAndLog(SAVE_PROOF);
     }
 
+    // The batch proof is complete or has failed, so its checkpoints are not needed any more
+    if (checkpointFolder != "")
+    {
+        std::filesystem::remove_all(checkpointFolder);
+    }
+
     TimerStopAndLog(PROVER_BATCH_PROOF);
 }
 
-void Prover::genAggregatedProof(ProverRequest *pProverRequest)
+// Runs the executor of a batch proof, writing its committed polynomials into pCmPols
+void Prover::executeBatchProof(ProverRequest *pProverRequest, void *pCmPols)
 {
+    // Save input to <timestamp>.input.json, as provided by client
+    if (config.saveInputToFile)
+    {
+        json inputJson;
+        pProverRequest->input.save(inputJson);
+        json2file(inputJson, pProverRequest->inputFile());
+    }
 
-    zkassert(config.generateProof());
-    zkassert(pProverRequest != NULL);
-    zkassert(pProverRequest->type == prt_genAggregatedProof);
+    TimerStart(EXECUTOR_EXECUTE_INITIALIZATION);
 
-    TimerStart(PROVER_AGGREGATED_PROOF);
+    PROVER_FORK_NAMESPACE::CommitPols cmPols(pCmPols, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
+    MemoryArena::parallelZero(pCmPols, cmPols.size(), (pCmPols == pAddressPipeline) ? pipelineArena.getPageSize() : cmPolsArena.getPageSize());
 
-    printMemoryInfo(true);
-    printProcessInfo(true);
+    TimerStopAndLog(EXECUTOR_EXECUTE_INITIALIZATION);
+    // Execute all the State Machines
+    TimerStart(EXECUTOR_EXECUTE_BATCH_PROOF);
+    executor.execute(*pProverRequest, cmPols);
+    TimerStopAndLog(EXECUTOR_EXECUTE_BATCH_PROOF);
 
-    // Save input to file
-    if (config.saveInputToFile)
+    // Save commit pols to file zkevm.commit
+    if (config.zkevmCmPolsAfterExecutor != "")
     {
-        json2file(pProverRequest->aggregatedProofInput1, pProverRequest->filePrefix + "aggregated_proof.input_1.json");
-        json2file(pProverRequest->aggregatedProofInput2, pProverRequest->filePrefix + "aggregated_proof.input_2.json");
+        void *pointerCmPols = mapFile(config.zkevmCmPolsAfterExecutor, cmPols.size(), true);
+        memcpy(pointerCmPols, cmPols.address(), cmPols.size());
+        unmapFile(pointerCmPols, cmPols.size());
     }
+}
 
-    // Input is pProverRequest->aggregatedProofInput1 and pProverRequest->aggregatedProofInput2 (of type json)
-
-    ordered_json verKey;
-    file2json(config.recursive2Verkey, verKey);
-
-    // ----------------------------------------------
-    // CHECKS
-    // ----------------------------------------------
+// Checks that the proof of publics2 starts where the proof of publics1 ends
+static bool aggregatedProofInputsConsistent(vector<uint64_t> &publics1, vector<uint64_t> &publics2)
+{
     // Check chainID
-
-    if (pProverRequest->aggregatedProofInput1["publics"][17] != pProverRequest->aggregatedProofInput2["publics"][17])
+    if (publics1[17] != publics2[17])
     {
         std::cerr << "Error: Inputs has different chainId" << std::endl;
-        std::cerr << pProverRequest->aggregatedProofInput1["publics"][17] << "!=" << pProverRequest->aggregatedProofInput2["publics"][17] << std::endl;
-        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
-        return;
+        std::cerr << publics1[17] << "!=" << publics2[17] << std::endl;
+        return false;
     }
-    if (pProverRequest->aggregatedProofInput1["publics"][18] != pProverRequest->aggregatedProofInput2["publics"][18])
+    if (publics1[18] != publics2[18])
     {
         std::cerr << "Error: Inputs has different forkId" << std::endl;
-        std::cerr << pProverRequest->aggregatedProofInput1["publics"][18] << "!=" << pProverRequest->aggregatedProofInput2["publics"][18] << std::endl;
-        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
-        return;
+        std::cerr << publics1[18] << "!=" << publics2[18] << std::endl;
+        return false;
     }
     // Check midStateRoot
     for (int i = 0; i < 8; i++)
     {
-        if (pProverRequest->aggregatedProofInput1["publics"][19 + i] != pProverRequest->aggregatedProofInput2["publics"][0 + i])
+        if (publics1[19 + i] != publics2[0 + i])
         {
             std::cerr << "Error: The newStateRoot and the oldStateRoot are not consistent" << std::endl;
-            std::cerr << pProverRequest->aggregatedProofInput1["publics"][19 + i] << "!=" << pProverRequest->aggregatedProofInput2["publics"][0 + i] << std::endl;
-            pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
-            return;
+            std::cerr << publics1[19 + i] << "!=" << publics2[0 + i] << std::endl;
+            return false;
         }
     }
     // Check midAccInputHash0
     for (int i = 0; i < 8; i++)
     {
-        if (pProverRequest->aggregatedProofInput1["publics"][27 + i] != pProverRequest->aggregatedProofInput2["publics"][8 + i])
+        if (publics1[27 + i] != publics2[8 + i])
         {
             std::cerr << "Error: newAccInputHash and oldAccInputHash are not consistent" << std::endl;
-            std::cerr << pProverRequest->aggregatedProofInput1["publics"][27 + i] << "!=" << pProverRequest->aggregatedProofInput2["publics"][8 + i] << std::endl;
-            pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
-            return;
+            std::cerr << publics1[27 + i] << "!=" << publics2[8 + i] << std::endl;
+            return false;
         }
     }
     // Check batchNum
-    if (pProverRequest->aggregatedProofInput1["publics"][43] != pProverRequest->aggregatedProofInput2["publics"][16])
+    if (publics1[43] != publics2[16])
     {
         std::cerr << "Error: newBatchNum and oldBatchNum are not consistent" << std::endl;
-        std::cerr << pProverRequest->aggregatedProofInput1["publics"][43] << "!=" << pProverRequest->aggregatedProofInput2["publics"][16] << std::endl;
-        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
-        return;
+        std::cerr << publics1[43] << "!=" << publics2[16] << std::endl;
+        return false;
     }
+    return true;
+}
 
-    json zkinInputRecursive2 = joinzkin(pProverRequest->aggregatedProofInput1, pProverRequest->aggregatedProofInput2, verKey);
-    json recursive2Verkey;
-    file2json(config.recursive2Verkey, recursive2Verkey);
+void Prover::genRecursive2Proof(ZkinStark &zkin1, ZkinStark &zkin2, ordered_json &verKey, ZkinStark &zkinOut, ordered_json *pProof)
+{
+    ZkinStark zkinInputRecursive2;
+    joinzkin(zkin1, zkin2, verKey, zkinInputRecursive2);
+    vector<uint64_t> publicsJoined = zkinInputRecursive2.get("publics");
 
     Goldilocks::Element publics[starksRecursive2->starkInfo.nPublics];
 
     for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
     {
-        publics[i] = Goldilocks::fromString(zkinInputRecursive2["publics"][i]);
+        publics[i] = Goldilocks::fromU64(publicsJoined[i]);
     }
 
-    for (uint64_t i = 0; i < recursive2Verkey["constRoot"].size(); i++)
+    for (uint64_t i = 0; i < verKey["constRoot"].size(); i++)
     {
-        publics[starkZkevm->starkInfo.nPublics + i] = Goldilocks::fromU64(recursive2Verkey["constRoot"][i]);
+        publics[starkZkevm->starkInfo.nPublics + i] = Goldilocks::fromU64(verKey["constRoot"][i]);
     }
 
     CommitPolsStarks cmPolsRecursive2(pAddress, (1 << starksRecursive2->starkInfo.starkStruct.nBits));
-    CircomRecursive2::getCommitedPols(&cmPolsRecursive2, config.recursive2Verifier, config.recursive2Exec, zkinInputRecursive2, (1 << starksRecursive2->starkInfo.starkStruct.nBits));
+    CircomRecursive2::getCommitedPols(&cmPolsRecursive2, circuitRecursive2, *execRecursive2, zkinInputRecursive2, (1 << starksRecursive2->starkInfo.starkStruct.nBits), witnessThreads);
 
     //-------------------------------------------
     // Generate Recursive 2 proof
@@ -720,13 +989,122 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     starksRecursive2->genProof(fproofRecursive2, publics, &recursive2Steps);
     TimerStopAndLog(STARK_RECURSIVE_2_PROOF_BATCH_PROOF);
 
-    // Save the proof & zkinproof
-    nlohmann::ordered_json jProofRecursive2 = fproofRecursive2.proofs.proof2json();
-    nlohmann::ordered_json zkinRecursive2 = proof2zkinStark(jProofRecursive2);
-    zkinRecursive2["publics"] = zkinInputRecursive2["publics"];
+    // The aggregated proof keeps the publics of the joined inputs
+    proof2zkinStark(fproofRecursive2, zkinOut);
+    zkinOut.set("publics", {publicsJoined.size()}) = publicsJoined;
+
+    if (pProof != NULL)
+    {
+        *pProof = fproofRecursive2.proofs.proof2json();
+        for (uint64_t i = 0; i < publicsJoined.size(); i++)
+        {
+            (*pProof)["publics"][i] = to_string(publicsJoined[i]);
+        }
+    }
+}
+
+void Prover::genAggregatedProof(ProverRequest *pProverRequest)
+{
+
+    zkassert(config.generateProof());
+    zkassert(pProverRequest != NULL);
+    zkassert(pProverRequest->type == prt_genAggregatedProof);
+
+    TimerStart(PROVER_AGGREGATED_PROOF);
+
+    printMemoryInfo(true);
+    printProcessInfo(true);
+
+    // Input is pProverRequest->aggregatedProofInputs, if not empty, or pProverRequest->aggregatedProofInput1 and
+    // pProverRequest->aggregatedProofInput2 (of type json), the proofs of consecutive batches. The aggregator service only
+    // sends input1 and input2; aggregatedProofInputs is only filled by the file mode aggregateInputFolder
+    vector<ordered_json *> inputs;
+    if (pProverRequest->aggregatedProofInputs.size() > 0)
+    {
+        for (uint64_t i = 0; i < pProverRequest->aggregatedProofInputs.size(); i++)
+        {
+            inputs.push_back(&pProverRequest->aggregatedProofInputs[i]);
+        }
+    }
+    else
+    {
+        inputs.push_back(&pProverRequest->aggregatedProofInput1);
+        inputs.push_back(&pProverRequest->aggregatedProofInput2);
+    }
+
+    // Save input to file
+    if (config.saveInputToFile)
+    {
+        for (uint64_t i = 0; i < inputs.size(); i++)
+        {
+            json2file(*inputs[i], pProverRequest->filePrefix + "aggregated_proof.input_" + to_string(i + 1) + ".json");
+        }
+    }
+
+    if (inputs.size() < 2)
+    {
+        cerr << "Error: Prover::genAggregatedProof() got " << inputs.size() << " inputs, at least 2 are required" << endl;
+        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
+        return;
+    }
+
+    ordered_json verKey;
+    file2json(config.recursive2Verkey, verKey);
+
+    // ----------------------------------------------
+    // CHECKS
+    // ----------------------------------------------
+    // Every input must start where the previous one ends; then so do the proofs of every level of the tree
+
+    TimerStart(AGGREGATED_PROOF_LOAD_INPUTS);
+    vector<ZkinStark> level(inputs.size());
+    for (uint64_t i = 0; i < inputs.size(); i++)
+    {
+        level[i].fromJson(*inputs[i]);
+    }
+    TimerStopAndLog(AGGREGATED_PROOF_LOAD_INPUTS);
+
+    for (uint64_t i = 0; i + 1 < level.size(); i++)
+    {
+        if (!aggregatedProofInputsConsistent(level[i].get("publics"), level[i + 1].get("publics")))
+        {
+            cerr << "Error: Prover::genAggregatedProof() inputs " << i + 1 << " and " << i + 2 << " are not consistent" << endl;
+            pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
+            return;
+        }
+    }
+
+    // Aggregate the proofs in a binary tree, level by level, adjacent pairs at a time; the last proof of a level with an
+    // odd number of proofs goes up to the next one. Intermediate proofs are kept in binary form
+    ordered_json jProofRecursive2;
+    for (uint64_t l = 1; level.size() > 1; l++)
+    {
+        bool bRoot = (level.size() == 2);
+        vector<ZkinStark> nextLevel((level.size() + 1) / 2);
+        for (uint64_t i = 0; i + 1 < level.size(); i += 2)
+        {
+            cout << "Prover::genAggregatedProof() aggregating level " << l << " proof " << i / 2 << " of " << nextLevel.size() << endl;
+            genRecursive2Proof(level[i], level[i + 1], verKey, nextLevel[i / 2], (bRoot && config.saveProofToFile) ? &jProofRecursive2 : NULL);
+        }
+        if (level.size() % 2 == 1)
+        {
+            nextLevel.back() = level.back();
+        }
+
+        // Save the intermediate proofs of this level to files, if requested; they are not kept in memory
+        if (config.aggregatedProofAllLevels && !bRoot)
+        {
+            for (uint64_t i = 0; i < nextLevel.size(); i++)
+            {
+                json2file(nextLevel[i].toJson(), pProverRequest->filePrefix + "aggregated_proof.level_" + to_string(l) + "_" + to_string(i) + ".output.json");
+            }
+        }
+
+        level.swap(nextLevel);
+    }
 
     // Output is pProverRequest->aggregatedProofOutput (of type json)
-    pProverRequest->aggregatedProofOutput = zkinRecursive2;
+    pProverRequest->aggregatedProofOutput = level[0].toJson();
 
     // Save output to file
     if (config.saveOutputToFile)
@@ -736,24 +1114,21 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     // Save proof to file
     if (config.saveProofToFile)
     {
-        jProofRecursive2["publics"] = zkinInputRecursive2["publics"];
         json2file(jProofRecursive2, pProverRequest->filePrefix + "aggregated_proof.proof.json");
     }
 
     // Add the recursive2 verification key
     json publicsJson = json::array();
 
-    file2json(config.recursive2Verkey, recursive2Verkey);
-
     for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
     {
-        publicsJson[i] = zkinInputRecursive2["publics"][i];
+        publicsJson[i] = pProverRequest->aggregatedProofOutput["publics"][i];
     }
     // Add the recursive2 verification key
-    publicsJson[44] = to_string(recursive2Verkey["constRoot"][0]);
-    publicsJson[45] = to_string(recursive2Verkey["constRoot"][1]);
-    publicsJson[46] = to_string(recursive2Verkey["constRoot"][2]);
-    publicsJson[47] = to_string(recursive2Verkey["constRoot"][3]);
+    publicsJson[44] = to_string(verKey["constRoot"][0]);
+    publicsJson[45] = to_string(verKey["constRoot"][1]);
+    publicsJson[46] = to_string(verKey["constRoot"][2]);
+    publicsJson[47] = to_string(verKey["constRoot"][3]);
 
     json2file(publicsJson, pProverRequest->publicsOutputFile());
 
@@ -793,7 +1168,7 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     }
 
     CommitPolsStarks cmPolsRecursive2(pAddressStarksRecursiveF, (1 << starksRecursiveF->starkInfo.starkStruct.nBits));
-    CircomRecursiveF::getCommitedPols(&cmPolsRecursive2, config.recursivefVerifier, config.recursivefExec, zkinFinal, (1 << starksRecursiveF->starkInfo.starkStruct.nBits));
+    CircomRecursiveF::getCommitedPols(&cmPolsRecursive2, circuitRecursiveF, *execRecursiveF, zkinFinal, (1 << starksRecursiveF->starkInfo.starkStruct.nBits), witnessThreads);
 
     //  ----------------------------------------------
     //  Generate Recursive Final proof
@@ -814,10 +1189,6 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     //  Verifier final
     //  ----------------------------------------------
 
-    TimerStart(CIRCOM_LOAD_CIRCUIT_FINAL);
-    CircomFinal::Circom_Circuit *circuitFinal = CircomFinal::loadCircuit(config.finalVerifier);
-    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_FINAL);
-
     TimerStart(CIRCOM_FINAL_LOAD_JSON);
     CircomFinal::Circom_CalcWit *ctxFinal = new CircomFinal::Circom_CalcWit(circuitFinal);
 
@@ -833,7 +1204,6 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     AltBn128::FrElement *pWitnessFinal = NULL;
     uint64_t witnessSizeFinal = 0;
     CircomFinal::getBinWitness(ctxFinal, pWitnessFinal, witnessSizeFinal);
-    CircomFinal::freeCircuit(circuitFinal);
     delete ctxFinal;
 
     TimerStopAndLog(CIRCOM_GET_BIN_WITNESS_FINAL);
@@ -23,6 +23,17 @@
 #include "starks.hpp"
 #include "constant_pols_starks.hpp"
 #include "fflonk_prover.hpp"
+#include "memory_arena.hpp"
+#include "prover_scheduler.hpp"
+
+class ExecFile;
+class ZkinStark;
+namespace Circom { struct Circom_Circuit; }
+namespace CircomRecursive1 { struct Circom_Circuit; }
+namespace CircomRecursive2 { struct Circom_Circuit; }
+namespace CircomRecursiveF { struct Circom_Circuit; }
+namespace CircomFinal { struct Circom_Circuit; }
+
 class Prover
 {
     Goldilocks &fr;
@@ -36,6 +47,18 @@ class Prover
     Starks *starksRecursive1;
     Starks *starksRecursive2;
 
+    // Verifier circuits and exec files, loaded once and shared by all the requests
+    Circom::Circom_Circuit *circuitZkevm;
+    CircomRecursive1::Circom_Circuit *circuitRecursive1;
+    CircomRecursive2::Circom_Circuit *circuitRecursive2;
+    CircomRecursiveF::Circom_Circuit *circuitRecursiveF;
+    CircomFinal::Circom_Circuit *circuitFinal;
+    ExecFile *execC12a;
+    ExecFile *execRecursive1;
+    ExecFile *execRecursive2;
+    ExecFile *execRecursiveF;
+    uint64_t witnessThreads; // Max threads of the verifier circuits witness calculation
+
     Fflonk::FflonkProver<AltBn128::Engine> *prover;
     std::unique_ptr<Groth16::Prover<AltBn128::Engine>> groth16Prover;
     std::unique_ptr<BinFileUtils::BinFile> zkey;
@@ -45,7 +68,7 @@ class Prover
 public:
     unordered_map<string, ProverRequest *> requestsMap; // Map uuid -> ProveRequest pointer
 
-    vector<ProverRequest *> pendingRequests;   // Queue of pending requests
+    ProverScheduler pendingRequests;           // Queues of pending requests, per request type
     ProverRequest *pCurrentRequest;            // Request currently being processed by the prover thread in server mode
     vector<ProverRequest *> completedRequests; // Map uuid -> ProveRequest pointer
 
@@ -54,8 +77,21 @@ private:
     pthread_t cleanerPthread; // Garbage collector
     pthread_mutex_t mutex;    // Mutex to protect the requests queues
     void *pAddress = NULL;
+    MemoryArena cmPolsArena; // Committed polynomials memory, when not mapped to a file
     void *pAddressStarksRecursiveF = NULL;
     int protocolId;
+
+    // Batch proofs pipeline: the executor of the next batch proof runs in pipelineExecutorPthread, into pAddressPipeline,
+    // while the current one is proved; the buffer is copied to pAddress, and released, when its batch proof starts
+    bool bPipeline = false;
+    pthread_t pipelineExecutorPthread;
+    pthread_cond_t pipelineCond;           // Signaled when the pipeline buffer state changes or a request is submitted
+    MemoryArena pipelineArena;
+    void *pAddressPipeline = NULL;
+    ProverRequest *pPipelineRequest = NULL; // Request whose executor runs, or has run, into pAddressPipeline
+    bool bPipelineExecuted = false;
+
+    void genRecursive2Proof(ZkinStark &zkin1, ZkinStark &zkin2, nlohmann::ordered_json &verKey, ZkinStark &zkinOut, nlohmann::ordered_json *pProof); // Aggregates 2 consecutive proofs into zkinOut
 public:
     const Config &config;
     sem_t pendingRequestSem; // Semaphore to wakeup prover thread when a new request is available
@@ -69,6 +105,7 @@ public:
     ~Prover();
 
     void genBatchProof(ProverRequest *pProverRequest);
+    void executeBatchProof(ProverRequest *pProverRequest, void *pCmPols);
     void genAggregatedProof(ProverRequest *pProverRequest);
     void genFinalProof(ProverRequest *pProverRequest);
     void processBatch(ProverRequest *pProverRequest);
@@ -76,12 +113,15 @@ public:
     
     string submitRequest(ProverRequest *pProverRequest);                                          // returns UUID for this request
     ProverRequest *waitForRequestToComplete(const string &uuid, const uint64_t timeoutInSeconds); // wait for the request with this UUID to complete; returns NULL if UUID is invalid
+    void executePipelinedBatchProof(void); // Waits for the next pending batch proof, while the current one is proved, and runs its executor into the pipeline buffer
+    void notifyPipeline(void) { if (bPipeline) pthread_cond_broadcast(&pipelineCond); }; // Called with the mutex locked when the queue or the current request change
 
     void lock(void) { pthread_mutex_lock(&mutex); };
     void unlock(void) { pthread_mutex_unlock(&mutex); };
 };
 
 void *proverThread(void *arg);
+void *pipelineExecutorThread(void *arg);
 void *cleanerThread(void *arg);
 
 #endif
\ No newline at end of file
@@ -10,6 +10,8 @@
 ProverRequest::ProverRequest (Goldilocks &fr, const Config &config, tProverRequestType type) :
     fr(fr),
     config(config),
+    submitTime(0),
+    deadline(0),
     startTime(0),
     endTime(0),
     type(type),
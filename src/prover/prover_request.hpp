@@ -24,6 +24,8 @@ public:
     /* IDs */
     string uuid;
     string timestamp; // Timestamp, when requested, used as a prefix in the output files
+    time_t submitTime; // Time when the request was submitted to the prover
+    time_t deadline; // Time after which the request is scheduled before any other; 0 if none
     time_t startTime; // Time when the request started being processed
     time_t endTime; // Time when the request ended
 
@@ -42,6 +44,7 @@ public:
     /* genAggregatedProof input and output */
     nlohmann::ordered_json aggregatedProofInput1;
     nlohmann::ordered_json aggregatedProofInput2;
+    vector<nlohmann::ordered_json> aggregatedProofInputs; // If not empty, proofs of consecutive batches aggregated in a tree instead of input1 and input2; only set by aggregateInputFolder
     nlohmann::ordered_json aggregatedProofOutput;
 
     /* genFinalProof input */
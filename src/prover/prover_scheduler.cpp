@@ -0,0 +1,166 @@
+#include <sstream>
+#include <algorithm> // std::max
+#include "prover_scheduler.hpp"
+#include "zkassert.hpp"
+
+using namespace std;
+
+void ProverScheduler::push(ProverRequest *pProverRequest)
+{
+    zkassert(pProverRequest != NULL);
+    zkassert((uint64_t)pProverRequest->type < PROVER_SCHEDULER_QUEUES);
+
+    Queue &queue = queues[pProverRequest->type];
+
+    pProverRequest->submitTime = time(NULL);
+    uint64_t maxWait = config.schedulerMaxWait[pProverRequest->type];
+    pProverRequest->deadline = (maxWait > 0) ? pProverRequest->submitTime + maxWait : 0;
+
+    // A queue that was empty does not keep the turns it did not use
+    if (queue.requests.size() == 0)
+    {
+        queue.pass = std::max(queue.pass, virtualTime);
+    }
+
+    // Insert it after the requests with an earlier or equal deadline; requests without deadline go last
+    vector<ProverRequest *>::iterator it = queue.requests.end();
+    if (pProverRequest->deadline != 0)
+    {
+        it = queue.requests.begin();
+        while ((it != queue.requests.end()) && ((*it)->deadline != 0) && ((*it)->deadline <= pProverRequest->deadline))
+        {
+            it++;
+        }
+    }
+    queue.requests.insert(it, pProverRequest);
+
+    queue.submitted++;
+    queue.maxDepth = std::max(queue.maxDepth, (uint64_t)queue.requests.size());
+}
+
+// Returns the queue to serve, or PROVER_SCHEDULER_QUEUES if there are no pending requests
+uint64_t ProverScheduler::selectQueue(time_t now, bool &bDeadline)
+{
+    uint64_t selected = PROVER_SCHEDULER_QUEUES;
+
+    // Requests that exceeded their deadline go first, the earliest one first
+    bDeadline = false;
+    for (uint64_t i = 0; i < PROVER_SCHEDULER_QUEUES; i++)
+    {
+        if (queues[i].requests.size() == 0)
+            continue;
+        time_t deadline = queues[i].requests[0]->deadline;
+        if ((deadline != 0) && (deadline <= now) && (!bDeadline || (deadline < queues[selected].requests[0]->deadline)))
+        {
+            selected = i;
+            bDeadline = true;
+        }
+    }
+    if (bDeadline)
+    {
+        return selected;
+    }
+
+    // Otherwise, the highest priority; among the same priority, the lowest pass
+    for (uint64_t i = 0; i < PROVER_SCHEDULER_QUEUES; i++)
+    {
+        if (queues[i].requests.size() == 0)
+            continue;
+        if ((selected == PROVER_SCHEDULER_QUEUES) ||
+            (config.schedulerPriority[i] > config.schedulerPriority[selected]) ||
+            ((config.schedulerPriority[i] == config.schedulerPriority[selected]) && (queues[i].pass < queues[selected].pass)))
+        {
+            selected = i;
+        }
+    }
+    return selected;
+}
+
+ProverRequest *ProverScheduler::front(void)
+{
+    bool bDeadline;
+    uint64_t selected = selectQueue(time(NULL), bDeadline);
+    if (selected == PROVER_SCHEDULER_QUEUES)
+    {
+        return NULL;
+    }
+    return queues[selected].requests[0];
+}
+
+ProverRequest *ProverScheduler::pop(void)
+{
+    time_t now = time(NULL);
+    bool bDeadline;
+    uint64_t selected = selectQueue(now, bDeadline);
+    if (selected == PROVER_SCHEDULER_QUEUES)
+    {
+        return NULL;
+    }
+
+    Queue &queue = queues[selected];
+    ProverRequest *pProverRequest = queue.requests[0];
+    queue.requests.erase(queue.requests.begin());
+
+    // Requests served by deadline do not consume the turns of their queue
+    if (bDeadline)
+    {
+        queue.scheduledByDeadline++;
+    }
+    else
+    {
+        virtualTime = queue.pass;
+        queue.pass += 1.0 / std::max((uint64_t)1, config.schedulerWeight[selected]);
+    }
+
+    uint64_t wait = now - pProverRequest->submitTime;
+    queue.scheduled++;
+    queue.totalWait += wait;
+    queue.maxWait = std::max(queue.maxWait, wait);
+
+    return pProverRequest;
+}
+
+uint64_t ProverScheduler::size(void)
+{
+    uint64_t size = 0;
+    for (uint64_t i = 0; i < PROVER_SCHEDULER_QUEUES; i++)
+    {
+        size += queues[i].requests.size();
+    }
+    return size;
+}
+
+void ProverScheduler::getRequests(vector<ProverRequest *> &requests)
+{
+    for (uint64_t i = 0; i < PROVER_SCHEDULER_QUEUES; i++)
+    {
+        requests.insert(requests.end(), queues[i].requests.begin(), queues[i].requests.end());
+    }
+}
+
+string ProverScheduler::getStatistics(void)
+{
+    time_t now = time(NULL);
+    stringstream ss;
+    for (uint64_t i = 0; i < PROVER_SCHEDULER_QUEUES; i++)
+    {
+        Queue &queue = queues[i];
+        if (queue.submitted == 0)
+            continue;
+        uint64_t oldestWait = 0;
+        for (uint64_t r = 0; r < queue.requests.size(); r++)
+        {
+            oldestWait = std::max(oldestWait, (uint64_t)(now - queue.requests[r]->submitTime));
+        }
+        ss << proverRequestType2string((tProverRequestType)i)
+           << ": depth=" << queue.requests.size()
+           << " maxDepth=" << queue.maxDepth
+           << " submitted=" << queue.submitted
+           << " scheduled=" << queue.scheduled
+           << " scheduledByDeadline=" << queue.scheduledByDeadline
+           << " avgWait=" << ((queue.scheduled > 0) ? queue.totalWait / queue.scheduled : 0) << "s"
+           << " maxWait=" << queue.maxWait << "s"
+           << " oldestPendingWait=" << oldestWait << "s" << endl;
+    }
+    return ss.str();
+}
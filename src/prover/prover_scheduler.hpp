@@ -0,0 +1,58 @@
+#ifndef PROVER_SCHEDULER_HPP
+#define PROVER_SCHEDULER_HPP
+
+#include <vector>
+#include <string>
+#include "config.hpp"
+#include "prover_request.hpp"
+
+using namespace std;
+
+#define PROVER_SCHEDULER_QUEUES 6 // One queue per tProverRequestType
+
+/*
+    Pending requests of the prover, in one queue per request type.
+    The next request is taken from the queue whose first request has exceeded its deadline, the earliest one if several
+    have; otherwise from the non-empty queues with the highest priority, which are served in proportion to their weights.
+    Every request gets a deadline of its submission time plus the max wait of its type, if configured, and every queue is
+    kept sorted by deadline, requests without deadline last, in arrival order.
+    It is not thread safe; the prover mutex protects it.
+*/
+class ProverScheduler
+{
+private:
+    class Queue
+    {
+    public:
+        vector<ProverRequest *> requests;
+        double pass; // Virtual time of the queue, increased by 1/weight every time it is served; the lowest one is served first
+
+        // Statistics
+        uint64_t submitted;
+        uint64_t scheduled;
+        uint64_t scheduledByDeadline;
+        uint64_t maxDepth;
+        uint64_t totalWait; // Seconds
+        uint64_t maxWait;   // Seconds
+
+        Queue() : pass(0), submitted(0), scheduled(0), scheduledByDeadline(0), maxDepth(0), totalWait(0), maxWait(0){};
+    };
+
+    const Config &config;
+    Queue queues[PROVER_SCHEDULER_QUEUES];
+    double virtualTime; // Pass of the last served queue; queues that become non-empty start from it
+
+    uint64_t selectQueue(time_t now, bool &bDeadline);
+
+public:
+    ProverScheduler(const Config &config) : config(config), virtualTime(0){};
+
+    void push(ProverRequest *pProverRequest);
+    ProverRequest *front(void); // Request that pop() would return now, or NULL if there are no pending requests
+    ProverRequest *pop(void);
+    uint64_t size(void);
+    void getRequests(vector<ProverRequest *> &requests); // Pending requests, queue by queue
+    string getStatistics(void);
+};
+
+#endif
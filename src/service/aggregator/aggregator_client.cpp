@@ -8,7 +8,8 @@ using json = nlohmann::json;
 AggregatorClient::AggregatorClient (Goldilocks &fr, const Config &config, Prover &prover) :
     fr(fr),
     config(config),
-    prover(prover)
+    prover(prover),
+    lastSchedulerStatisticsTime(0)
 {
     // Create channel
     std::shared_ptr<grpc_impl::Channel> channel = ::grpc::CreateChannel(config.aggregatorClientHost + ":" + to_string(config.aggregatorClientPort), grpc::InsecureChannelCredentials());
@@ -63,10 +64,30 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
     getStatusResponse.set_version_proto("v0_0_1");
     getStatusResponse.set_version_server("0.0.1");
 
-    // Set the list of pending requests uuids
-    for (uint64_t i=0; i<prover.pendingRequests.size(); i++)
+    // Set the list of pending requests uuids, the next one to be processed first
+    vector<ProverRequest *> pendingRequests;
+    ProverRequest *pNextRequest = prover.pendingRequests.front();
+    if (pNextRequest != NULL)
     {
-        getStatusResponse.add_pending_request_queue_ids(prover.pendingRequests[i]->uuid);
+        getStatusResponse.add_pending_request_queue_ids(pNextRequest->uuid);
+    }
+    prover.pendingRequests.getRequests(pendingRequests);
+    for (uint64_t i=0; i<pendingRequests.size(); i++)
+    {
+        if (pendingRequests[i] != pNextRequest)
+        {
+            getStatusResponse.add_pending_request_queue_ids(pendingRequests[i]->uuid);
+        }
+    }
+
+    // Queue depths and wait times per request type; the status message has no fields for them, so they are logged,
+    // at most once every schedulerStatisticsPeriod seconds since the aggregator polls the status continuously
+    string schedulerStatistics;
+    time_t now = time(NULL);
+    if ((config.schedulerStatisticsPeriod > 0) && ((uint64_t)(now - lastSchedulerStatisticsTime) >= config.schedulerStatisticsPeriod))
+    {
+        schedulerStatistics = prover.pendingRequests.getStatistics();
+        lastSchedulerStatisticsTime = now;
     }
 
     // Unlock the prover
@@ -91,6 +112,10 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
 #ifdef LOG_SERVICE
     cout << "AggregatorClient::GetStatus() returns: " << getStatusResponse.DebugString() << endl;
 #endif
+    if (schedulerStatistics.size() > 0)
+    {
+        cout << "AggregatorClient::GetStatus() scheduler statistics:" << endl << schedulerStatistics;
+    }
     return true;
 }
 
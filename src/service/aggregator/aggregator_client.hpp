@@ -19,6 +19,7 @@ public:
     Prover &prover;
     aggregator::v1::AggregatorService::Stub * stub;
     pthread_t t; // Client thread
+    time_t lastSchedulerStatisticsTime; // Last time GetStatus() logged the scheduler statistics
 
 public:
     AggregatorClient (Goldilocks &fr, const Config &config, Prover &prover);
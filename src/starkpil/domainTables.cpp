@@ -0,0 +1,131 @@
+#include "domainTables.hpp"
+#include "zhInv.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include <algorithm>
+#include <fstream>
+
+void DomainTables::generate(Goldilocks::Element *pTables, uint64_t nBits, uint64_t nBitsExt)
+{
+    uint64_t N = 1ULL << nBits;
+    uint64_t NExtended = 1ULL << nBitsExt;
+    Goldilocks::Element *x_n = &pTables[getXnOffset(nBits, nBitsExt)];
+    Goldilocks::Element *x_2ns = &pTables[getX2nsOffset(nBits, nBitsExt)];
+    Goldilocks::Element *x = &pTables[getXOffset(nBits, nBitsExt)];
+    Goldilocks::Element *zhInv = &pTables[getZhInvOffset(nBits, nBitsExt)];
+
+    // Every block starts from its own power of the root of unity, so the blocks are independent
+#pragma omp parallel for
+    for (uint64_t b = 0; b < N; b += DOMAIN_TABLES_BLOCK_SIZE)
+    {
+        Goldilocks::Element xx = Goldilocks::exp(Goldilocks::w(nBits), b);
+        for (uint64_t i = b; i < std::min(N, b + DOMAIN_TABLES_BLOCK_SIZE); i++)
+        {
+            x_n[i] = xx;
+            Goldilocks::mul(xx, xx, Goldilocks::w(nBits));
+        }
+    }
+
+#pragma omp parallel for
+    for (uint64_t b = 0; b < NExtended; b += DOMAIN_TABLES_BLOCK_SIZE)
+    {
+        Goldilocks::Element xx = Goldilocks::shift() * Goldilocks::exp(Goldilocks::w(nBitsExt), b);
+        for (uint64_t i = b; i < std::min(NExtended, b + DOMAIN_TABLES_BLOCK_SIZE); i++)
+        {
+            x_2ns[i] = xx;
+            x[i * FIELD_EXTENSION] = xx;
+            x[i * FIELD_EXTENSION + 1] = Goldilocks::zero();
+            x[i * FIELD_EXTENSION + 2] = Goldilocks::zero();
+            Goldilocks::mul(xx, xx, Goldilocks::w(nBitsExt));
+        }
+    }
+
+    ZhInv zi(nBits, nBitsExt);
+    for (uint64_t i = 0; i < getZhInvSize(nBits, nBitsExt); i++)
+    {
+        zhInv[i] = zi.zhInv(i);
+    }
+}
+
+// Returns true if the header of fileName matches nBits and nBitsExt, and the file has the size of their tables
+static bool checkHeader(const string &fileName, uint64_t nBits, uint64_t nBitsExt)
+{
+    uint64_t header[DOMAIN_TABLES_HEADER_SIZE];
+    ifstream file(fileName, ios::binary | ios::ate);
+    if (!file.good() || ((uint64_t)file.tellg() != DomainTables::getFileSize(nBits, nBitsExt)))
+    {
+        return false;
+    }
+    file.seekg(0);
+    file.read((char *)header, sizeof(header));
+    return file.good() && (header[0] == nBits) && (header[1] == nBitsExt) && (header[2] == DomainTables::getSize(nBits, nBitsExt));
+}
+
+static void setHeader(Goldilocks::Element *pFile, uint64_t nBits, uint64_t nBitsExt)
+{
+    uint64_t *header = (uint64_t *)pFile;
+    header[0] = nBits;
+    header[1] = nBitsExt;
+    header[2] = DomainTables::getSize(nBits, nBitsExt);
+}
+
+Goldilocks::Element *DomainTables::load(const string &fileName, bool bMapFile, uint64_t nBits, uint64_t nBitsExt, bool &bMapped)
+{
+    uint64_t fileSize = getFileSize(nBits, nBitsExt);
+    Goldilocks::Element *pFile;
+
+    if ((fileName.size() > 0) && fileExists(fileName))
+    {
+        if (checkHeader(fileName, nBits, nBitsExt))
+        {
+            if (bMapFile)
+            {
+                pFile = (Goldilocks::Element *)mapFile(fileName, fileSize, false);
+                cout << "DomainTables::load() successfully mapped " << fileSize << " bytes from domain tables file " << fileName << endl;
+            }
+            else
+            {
+                pFile = (Goldilocks::Element *)copyFile(fileName, fileSize);
+                cout << "DomainTables::load() successfully copied " << fileSize << " bytes from domain tables file " << fileName << endl;
+            }
+            bMapped = bMapFile;
+            return &pFile[DOMAIN_TABLES_HEADER_SIZE];
+        }
+        cerr << "Error: DomainTables::load() found domain tables file " << fileName << " does not match nBits=" << nBits << " nBitsExt=" << nBitsExt << "; generating the tables instead (rebuild it with bctree -d)" << endl;
+    }
+
+    pFile = (Goldilocks::Element *)malloc(fileSize);
+    if (pFile == NULL)
+    {
+        cerr << "Error: DomainTables::load() failed calling malloc() of size " << fileSize << endl;
+        exit(-1);
+    }
+    setHeader(pFile, nBits, nBitsExt);
+    TimerStart(GENERATE_DOMAIN_TABLES);
+    generate(&pFile[DOMAIN_TABLES_HEADER_SIZE], nBits, nBitsExt);
+    TimerStopAndLog(GENERATE_DOMAIN_TABLES);
+    bMapped = false;
+    return &pFile[DOMAIN_TABLES_HEADER_SIZE];
+}
+
+void DomainTables::unload(Goldilocks::Element *pTables, uint64_t nBits, uint64_t nBitsExt, bool bMapped)
+{
+    Goldilocks::Element *pFile = pTables - DOMAIN_TABLES_HEADER_SIZE;
+    if (bMapped)
+    {
+        unmapFile(pFile, getFileSize(nBits, nBitsExt));
+    }
+    else
+    {
+        free(pFile);
+    }
+}
+
+void DomainTables::save(const string &fileName, uint64_t nBits, uint64_t nBitsExt)
+{
+    uint64_t fileSize = getFileSize(nBits, nBitsExt);
+    Goldilocks::Element *pFile = (Goldilocks::Element *)mapFile(fileName, fileSize, true);
+    setHeader(pFile, nBits, nBitsExt);
+    generate(&pFile[DOMAIN_TABLES_HEADER_SIZE], nBits, nBitsExt);
+    unmapFile(pFile, fileSize);
+}
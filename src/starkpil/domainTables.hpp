@@ -0,0 +1,47 @@
+#ifndef DOMAIN_TABLES_HPP
+#define DOMAIN_TABLES_HPP
+
+#include <cstdint>
+#include <string>
+#include "goldilocks_base_field.hpp"
+#include "goldilocks_cubic_extension.hpp"
+
+#define DOMAIN_TABLES_BLOCK_SIZE (1 << 16) // Rows computed sequentially by every thread when generating the tables
+#define DOMAIN_TABLES_HEADER_SIZE 3       // nBits, nBitsExt and number of elements of the tables, before the tables in the file
+
+/*
+    Tables of the stark evaluation domains, stored in a domain tables file after a header of DOMAIN_TABLES_HEADER_SIZE
+    elements with nBits, nBitsExt and getSize(), one after the other:
+        x_n:   N elements, w^i
+        x_2ns: NExtended elements, shift * w_ext^i
+        x:     NExtended field extension elements, shift * w_ext^i in the first component
+        zhInv: NExtended / N elements, the inverses of the vanishing polynomial over the extended domain
+*/
+class DomainTables
+{
+public:
+    static uint64_t getXnOffset(uint64_t nBits, uint64_t nBitsExt) { return 0; }
+    static uint64_t getX2nsOffset(uint64_t nBits, uint64_t nBitsExt) { return (1ULL << nBits); }
+    static uint64_t getXOffset(uint64_t nBits, uint64_t nBitsExt) { return (1ULL << nBits) + (1ULL << nBitsExt); }
+    static uint64_t getZhInvOffset(uint64_t nBits, uint64_t nBitsExt) { return (1ULL << nBits) + (1ULL << nBitsExt) * (1 + FIELD_EXTENSION); }
+    static uint64_t getZhInvSize(uint64_t nBits, uint64_t nBitsExt) { return (1ULL << (nBitsExt - nBits)); }
+
+    // Number of field elements of the tables
+    static uint64_t getSize(uint64_t nBits, uint64_t nBitsExt) { return getZhInvOffset(nBits, nBitsExt) + getZhInvSize(nBits, nBitsExt); }
+
+    // Computes the tables in parallel into pTables, which must have getSize() elements
+    static void generate(Goldilocks::Element *pTables, uint64_t nBits, uint64_t nBitsExt);
+
+    // Size in bytes of a domain tables file, header included
+    static uint64_t getFileSize(uint64_t nBits, uint64_t nBitsExt) { return (DOMAIN_TABLES_HEADER_SIZE + getSize(nBits, nBitsExt)) * sizeof(Goldilocks::Element); }
+
+    // Maps (or copies) the tables from fileName if it exists and its header matches nBits and nBitsExt, or generates them
+    // otherwise; bMapped tells how to release them
+    static Goldilocks::Element *load(const std::string &fileName, bool bMapFile, uint64_t nBits, uint64_t nBitsExt, bool &bMapped);
+    static void unload(Goldilocks::Element *pTables, uint64_t nBits, uint64_t nBitsExt, bool bMapped);
+
+    // Generates the tables and writes them into fileName
+    static void save(const std::string &fileName, uint64_t nBits, uint64_t nBitsExt);
+};
+
+#endif
@@ -10,19 +10,26 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <vector>
 
 #include "goldilocks_base_field.hpp"
 #include "fr_goldilocks.hpp"
 
+#define EXEC_FILE_MIN_PARALLEL_ADDS 4096 // Chunks with fewer additions are computed by a single thread, since a parallel loop costs more than it saves
+
 class ExecFile
 {
 public:
     uint64_t nAdds;
     uint64_t nSMap;
 
+    // Stored in long normal form, so their longVal[0] can be read directly; the exec file is loaded once and shared by all the proofs
     FrGElement *p_adds;
     FrGElement *p_sMap;
 
+    // Additions [addsChunks[k], addsChunks[k + 1]) only depend on the witness and on the additions of previous chunks
+    std::vector<uint64_t> addsChunks;
+
     ExecFile(std::string execFile)
     {
         int fd;
@@ -63,6 +70,49 @@ public:
         }
         munmap(p_data, sb.st_size);
     }
+    // Splits the additions in chunks that can be computed in parallel, given the witness size of the circuit
+    void setAddsChunks(uint64_t sizeWitness)
+    {
+        addsChunks.clear();
+        addsChunks.push_back(0);
+        for (uint64_t i = 0; i < nAdds; i++)
+        {
+            uint64_t idx_1 = p_adds[i * 4].longVal[0];
+            uint64_t idx_2 = p_adds[i * 4 + 1].longVal[0];
+            if ((idx_1 >= sizeWitness + addsChunks.back()) || (idx_2 >= sizeWitness + addsChunks.back()))
+            {
+                addsChunks.push_back(i);
+            }
+        }
+        addsChunks.push_back(nAdds);
+
+        uint64_t nSerialChunks = 0;
+        for (uint64_t k = 0; k < addsChunks.size() - 1; k++)
+        {
+            if (!isParallelChunk(k))
+            {
+                nSerialChunks++;
+            }
+        }
+        std::cout << "ExecFile::setAddsChunks() split " << nAdds << " additions in " << addsChunks.size() - 1 << " chunks, " << nSerialChunks << " of them computed serially" << std::endl;
+    }
+
+    bool isParallelChunk(uint64_t k) const
+    {
+        return addsChunks[k + 1] - addsChunks[k] >= EXEC_FILE_MIN_PARALLEL_ADDS;
+    }
+
+    // Computes addition i into tmp, which holds the witness followed by the additions
+    inline void computeAdd(Goldilocks::Element *tmp, uint64_t sizeWitness, uint64_t i) const
+    {
+        uint64_t idx_1 = p_adds[i * 4].longVal[0];
+        uint64_t idx_2 = p_adds[i * 4 + 1].longVal[0];
+
+        Goldilocks::Element c = tmp[idx_1] * Goldilocks::fromU64(p_adds[i * 4 + 2].longVal[0]);
+        Goldilocks::Element d = tmp[idx_2] * Goldilocks::fromU64(p_adds[i * 4 + 3].longVal[0]);
+        tmp[sizeWitness + i] = c + d;
+    }
+
     ~ExecFile()
     {
         delete[] p_adds;
@@ -8,73 +8,61 @@
 
 using ordered_json = nlohmann::ordered_json;
 
-class MerkleProof
+/*
+    Queries of a FRI step: for every query, the opened row and the Merkle proof of every tree of the step, stored one
+    after the other in the queries buffer of Fri, starting at queriesOffset
+*/
+class ProofTree
 {
 public:
-    std::vector<std::vector<Goldilocks::Element>> v;
-    std::vector<std::vector<Goldilocks::Element>> mp;
+    std::vector<Goldilocks::Element> root;
+    uint64_t nQueries;
+    std::vector<uint64_t> widths;     // Elements of the row opened in every tree
+    std::vector<uint64_t> proofSizes; // Siblings of the Merkle proof of every tree
+    uint64_t queriesOffset;
 
-    MerkleProof(uint64_t nLinears, uint64_t elementsTree, Goldilocks::Element *pointer) : v(nLinears, std::vector<Goldilocks::Element>(1, Goldilocks::zero())), mp(elementsTree, std::vector<Goldilocks::Element>(HASH_SIZE, Goldilocks::zero()))
+    ProofTree() : root(HASH_SIZE), nQueries(0), queriesOffset(0){};
+    void setRoot(Goldilocks::Element *_root)
     {
-        for (uint64_t i = 0; i < nLinears; i++)
-        {
-            std::memcpy(&v[i][0], &pointer[i], sizeof(Goldilocks::Element));
-        }
-        for (uint64_t j = 0; j < elementsTree; j++)
+        std::memcpy(&root[0], &_root[0], HASH_SIZE * sizeof(Goldilocks::Element));
+    };
+
+    // Elements of every query of the step
+    uint64_t querySize()
+    {
+        uint64_t size = 0;
+        for (uint64_t k = 0; k < widths.size(); k++)
         {
-            std::memcpy(&mp[j][0], &pointer[nLinears + j * HASH_SIZE], HASH_SIZE * sizeof(Goldilocks::Element));
+            size += widths[k] + proofSizes[k] * HASH_SIZE;
         }
-    };
-    ordered_json merkleProof2json()
+        return size;
+    }
+
+    static ordered_json merkleProof2json(const Goldilocks::Element *pointer, uint64_t nLinears, uint64_t elementsTree)
     {
         ordered_json j = ordered_json::array();
         ordered_json json_v = ordered_json::array();
-        for (uint i = 0; i < v.size(); i++)
+        for (uint i = 0; i < nLinears; i++)
         {
-            if (v[i].size() > 1)
-            {
-                ordered_json element = ordered_json::array();
-                for (uint j = 0; j < v[i].size(); j++)
-                {
-                    element.push_back(Goldilocks::toString(v[i][j]));
-                }
-                json_v.push_back(element);
-            }
-            else
-            {
-                json_v.push_back(Goldilocks::toString(v[i][0]));
-            }
+            json_v.push_back(Goldilocks::toString(pointer[i]));
         }
         j.push_back(json_v);
 
         ordered_json json_mp = ordered_json::array();
-        for (uint i = 0; i < mp.size(); i++)
+        for (uint i = 0; i < elementsTree; i++)
         {
             ordered_json element = ordered_json::array();
-            for (uint j = 0; j < mp[i].size(); j++)
+            for (uint j = 0; j < HASH_SIZE; j++)
             {
-                element.push_back(Goldilocks::toString(mp[i][j]));
+                element.push_back(Goldilocks::toString(pointer[nLinears + i * HASH_SIZE + j]));
             }
             json_mp.push_back(element);
         }
         j.push_back(json_mp);
         return j;
     }
-};
-
-class ProofTree
-{
-public:
-    std::vector<Goldilocks::Element> root;
-    std::vector<std::vector<MerkleProof>> polQueries;
-
-    ProofTree() : root(HASH_SIZE){};
-    void setRoot(Goldilocks::Element *_root)
-    {
-        std::memcpy(&root[0], &_root[0], HASH_SIZE * sizeof(Goldilocks::Element));
-    };
 
-    ordered_json ProofTree2json()
+    ordered_json ProofTree2json(const Goldilocks::Element *queries)
     {
         ordered_json j_ProofTree2json = ordered_json::object();
 
@@ -87,20 +75,23 @@ public:
             j_ProofTree2json.erase("root");
 
         ordered_json json_polQueries = ordered_json::array();
-        for (uint i = 0; i < polQueries.size(); i++)
+        uint64_t size = querySize();
+        for (uint i = 0; i < nQueries; i++)
         {
-            ordered_json element = ordered_json::array();
-            if (polQueries[i].size() != 1)
+            const Goldilocks::Element *query = &queries[queriesOffset + i * size];
+            if (widths.size() != 1)
             {
-                for (uint j = 0; j < polQueries[i].size(); j++)
+                ordered_json element = ordered_json::array();
+                for (uint k = 0; k < widths.size(); k++)
                 {
-                    element.push_back(polQueries[i][j].merkleProof2json());
+                    element.push_back(merkleProof2json(query, widths[k], proofSizes[k]));
+                    query += widths[k] + proofSizes[k] * HASH_SIZE;
                 }
                 json_polQueries.push_back(element);
             }
             else
             {
-                json_polQueries.push_back(polQueries[i][0].merkleProof2json());
+                json_polQueries.push_back(merkleProof2json(query, widths[0], proofSizes[0]));
             }
         }
         j_ProofTree2json["root"] = json_root;
@@ -115,6 +106,7 @@ class Fri
 public:
     std::vector<std::vector<Goldilocks::Element>> pol;
     std::vector<ProofTree> trees;
+    std::vector<Goldilocks::Element> queries; // Queries of all the steps, see ProofTree
 
     Fri(uint64_t polN, uint64_t dim, uint64_t numSteps) : pol(polN, std::vector<Goldilocks::Element>(dim, Goldilocks::zero())),
                                                           trees(numSteps){};
@@ -133,7 +125,7 @@ public:
 
         for (uint i = 0; i < trees.size(); i++)
         {
-            j.push_back((trees[i].ProofTree2json()));
+            j.push_back((trees[i].ProofTree2json(queries.data())));
         }
 
         ordered_json json_pol = ordered_json::array();
@@ -23,102 +23,89 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
         pol2N = 1 << (polBits - reductionBits);
         uint64_t nX = (1 << polBits) / pol2N;
 
-        Polinomial pol2_e(pol2N, FIELD_EXTENSION);
-
         Polinomial special_x(1, FIELD_EXTENSION);
         transcript.getField(special_x.address());
 
-        Polinomial sinv(1, 1);
-        Polinomial wi(1, 1);
-
-        *sinv[0] = *polShiftInv[0];
-        *wi[0] = Goldilocks::inv(Goldilocks::w(polBits));
-
-        uint64_t nn = ((1 << polBits) / nX);
-        u_int64_t maxth = omp_get_max_threads();
-        if (maxth > nn)
+        Goldilocks::Element wi = Goldilocks::inv(Goldilocks::w(polBits));
+
+        /*
+            The folded layer is written directly in the layout of the next tree, i.e. element g goes to row g % nGroups,
+            column g / nGroups, and the rows are hashed as soon as they are written. Row g of the next tree is then the
+            coset g folded by the next step. The last layer is written to friPol, in its natural order.
+        */
+        bool isLastStep = (si == starkInfo.starkStruct.steps.size() - 1);
+        uint64_t nGroups = isLastStep ? pol2N : 1 << starkInfo.starkStruct.steps[si + 1].nBits;
+        uint64_t groupSize = pol2N / nGroups;
+        Goldilocks::Element *src = (si == 0) ? friPol.address() : treesFRIGL[si]->source;
+        Goldilocks::Element *dst = friPol.address();
+        if (!isLastStep)
         {
-            maxth = nn;
+            treesFRIGL[si + 1] = new MerkleTreeGL(nGroups, groupSize * FIELD_EXTENSION, NULL);
+            dst = treesFRIGL[si + 1]->source;
         }
-#pragma omp parallel num_threads(maxth)
-        {
-            u_int64_t nth = omp_get_num_threads();
-            u_int64_t thid = omp_get_thread_num();
-            u_int64_t chunk = nn / nth;
-            u_int64_t res = nn - nth * chunk;
-
-            // Evaluate bounds of the loop for the thread
-            uint64_t init = chunk * thid;
-            uint64_t end;
-            if (thid < res)
-            {
-                init += thid;
-                end = init + chunk + 1;
-            }
-            else
-            {
-                init += res;
-                end = init + chunk;
-            }
-            //  Evaluate the starting point for the sinv
-            Goldilocks::Element aux = *wi[0];
-            Goldilocks::Element sinv_ = *sinv[0];
-            for (uint64_t i = 0; i < chunk - 1; ++i)
-            {
-                aux = aux * (*wi[0]);
-            }
-            for (u_int64_t i = 0; i < thid; ++i)
-            {
-                sinv_ = sinv_ * aux;
-            }
-            u_int64_t ncor = res;
-            if (thid < res)
-            {
-                ncor = thid;
-            }
-            for (u_int64_t j = 0; j < ncor; ++j)
-            {
-                sinv_ = sinv_ * (*wi[0]);
-            }
 
-            for (uint64_t g = init; g < end; g++)
+        if (!isLastStep || (si > 0))
+        {
+            uint64_t blockRows = std::min(nGroups, (uint64_t)FRI_FOLD_BLOCK_ROWS);
+#pragma omp parallel
             {
-                if (si == 0)
+                // Step 0 only copies friPol into the next tree, so only the next steps allocate the folding buffers
+                NTT_Goldilocks *ntt = NULL;
+                Polinomial *ppar = NULL;
+                Polinomial *ppar_c = NULL;
+                if (si > 0)
                 {
-                    Polinomial::copyElement(pol2_e, g, friPol, g);
+                    ntt = new NTT_Goldilocks(nX, 1);
+                    ppar = new Polinomial(nX, FRI_FOLD_LANES * FIELD_EXTENSION);
+                    ppar_c = new Polinomial(nX, FRI_FOLD_LANES * FIELD_EXTENSION);
                 }
-                else
-                {
-                    Polinomial ppar(nX, FIELD_EXTENSION);
-                    Polinomial ppar_c(nX, FIELD_EXTENSION);
+                Goldilocks::Element res[FRI_FOLD_LANES * FIELD_EXTENSION];
 
-                    for (uint64_t i = 0; i < nX; i++)
+#pragma omp for
+                for (uint64_t r0 = 0; r0 < nGroups; r0 += blockRows)
+                {
+                    for (uint64_t j = 0; j < groupSize; j++)
                     {
-                        Polinomial::copyElement(ppar, i, friPol, (i * pol2N) + g);
+                        for (uint64_t r = r0; r < r0 + blockRows; r += FRI_FOLD_LANES)
+                        {
+                            uint64_t g = j * nGroups + r;
+                            uint64_t n = std::min((uint64_t)FRI_FOLD_LANES, r0 + blockRows - r);
+                            if (si == 0)
+                            {
+                                std::memcpy(res, &src[g * FIELD_EXTENSION], n * FIELD_EXTENSION * sizeof(Goldilocks::Element));
+                            }
+                            else
+                            {
+                                Goldilocks::Element sinv[FRI_FOLD_LANES];
+                                sinv[0] = *polShiftInv[0] * Goldilocks::exp(wi, g);
+                                for (uint64_t l = 1; l < FRI_FOLD_LANES; l++)
+                                {
+                                    sinv[l] = sinv[l - 1] * wi;
+                                }
+                                foldCosets(res, src, g, n, nX, sinv, special_x.address(), *ntt, *ppar, *ppar_c);
+                            }
+                            for (uint64_t l = 0; l < n; l++)
+                            {
+                                std::memcpy(&dst[((r + l) * groupSize + j) * FIELD_EXTENSION], &res[l * FIELD_EXTENSION], FIELD_EXTENSION * sizeof(Goldilocks::Element));
+                            }
+                        }
+                    }
+                    if (!isLastStep)
+                    {
+                        treesFRIGL[si + 1]->hashLeaves(r0, blockRows);
                     }
-                    NTT_Goldilocks ntt(nX, 1);
-
-                    ntt.INTT(ppar_c.address(), ppar.address(), nX, FIELD_EXTENSION);
-                    polMulAxi(ppar_c, Goldilocks::one(), sinv_); // Multiplies coefs by 1, shiftInv, shiftInv^2, shiftInv^3, ......
-                    evalPol(pol2_e, g, ppar_c, special_x);
-                    sinv_ = sinv_ * (*wi[0]);
                 }
+
+                delete ntt;
+                delete ppar;
+                delete ppar_c;
             }
         }
 
-        if (si < starkInfo.starkStruct.steps.size() - 1)
+        if (!isLastStep)
         {
-            uint64_t nGroups = 1 << starkInfo.starkStruct.steps[si + 1].nBits;
-            uint64_t groupSize = (1 << starkInfo.starkStruct.steps[si].nBits) / nGroups;
-
-            // Re-org in groups
-            Polinomial aux(pol2N, FIELD_EXTENSION);
-            getTransposed(aux, pol2_e, starkInfo.starkStruct.steps[si + 1].nBits);
-
             Polinomial rootGL(HASH_SIZE, 1);
-            treesFRIGL[si + 1] = new MerkleTreeGL(nGroups, groupSize * FIELD_EXTENSION, NULL);
-            treesFRIGL[si + 1]->copySource(aux.address());
-            treesFRIGL[si + 1]->merkelize();
+            treesFRIGL[si + 1]->merkelizeNodes();
             treesFRIGL[si + 1]->getRoot(rootGL.address());
             std::cout << "rootGL[" << si + 1 << "]: " << rootGL.toString(4) << std::endl;
             transcript.put(rootGL.address(), HASH_SIZE);
@@ -128,16 +115,10 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
         {
             for (uint64_t i = 0; i < pol2N; i++)
             {
-                transcript.put(pol2_e[i], FIELD_EXTENSION);
+                transcript.put(friPol[i], FIELD_EXTENSION);
             }
         }
 
-#pragma omp parallel for
-        for (uint64_t i = 0; i < pol2_e.degree(); i++)
-        {
-            Polinomial::copyElement(friPol, i, pol2_e, i);
-        }
-
         polBits = polBits - reductionBits;
 
         for (uint64_t j = 0; j < reductionBits; j++)
@@ -154,27 +135,7 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
     uint64_t ys[starkInfo.starkStruct.nQueries];
     transcript.getPermutations(ys, starkInfo.starkStruct.nQueries, starkInfo.starkStruct.steps[0].nBits);
 
-    for (uint64_t si = 0; si < starkInfo.starkStruct.steps.size(); si++)
-    {
-        for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
-        {
-            if (si == 0)
-            {
-                queryPol(fproof, treesGL, ys[i], si);
-            }
-            else
-            {
-                queryPol(fproof, treesFRIGL[si], ys[i], si);
-            }
-        }
-        if (si < starkInfo.starkStruct.steps.size() - 1)
-        {
-            for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
-            {
-                ys[i] = ys[i] % (1 << starkInfo.starkStruct.steps[si + 1].nBits);
-            }
-        }
-    }
+    queryPols(fproof, treesGL, treesFRIGL, ys, starkInfo);
 
     while (!treesFRIGL.empty())
     {
@@ -188,6 +149,64 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
     return;
 }
 
+/*
+    Folds FRI_FOLD_LANES consecutive cosets g + l of the previous layer, one per AVX2 lane; only the first n are valid.
+    Coset g is row g of src, with nX elements of dimension 3. Its coefficients are obtained by one INTT of all the lanes,
+    and res[3 * l] is their evaluation at special_x * sinv[l], which is the same as polMulAxi() by sinv[l] and evalPol()
+*/
+void FRIProve::foldCosets(Goldilocks::Element *res, Goldilocks::Element *src, uint64_t g, uint64_t n, uint64_t nX, Goldilocks::Element *sinv, Goldilocks::Element *special_x, NTT_Goldilocks &ntt, Polinomial &ppar, Polinomial &ppar_c)
+{
+    // Gather the cosets as the FRI_FOLD_LANES * FIELD_EXTENSION columns of ppar; invalid lanes repeat the last valid coset
+    for (uint64_t l = 0; l < FRI_FOLD_LANES; l++)
+    {
+        Goldilocks::Element *coset = &src[(g + std::min(l, n - 1)) * nX * FIELD_EXTENSION];
+        for (uint64_t i = 0; i < nX; i++)
+        {
+            std::memcpy(&ppar[i][l * FIELD_EXTENSION], &coset[i * FIELD_EXTENSION], FIELD_EXTENSION * sizeof(Goldilocks::Element));
+        }
+    }
+    ntt.INTT(ppar_c.address(), ppar.address(), nX, FRI_FOLD_LANES * FIELD_EXTENSION);
+
+    // Evaluation point of every lane, y = special_x * sinv
+    Goldilocks::Element y[FIELD_EXTENSION][FRI_FOLD_LANES];
+    Goldilocks::Element yo[FIELD_EXTENSION][FRI_FOLD_LANES];
+    for (uint64_t l = 0; l < FRI_FOLD_LANES; l++)
+    {
+        y[0][l] = special_x[0] * sinv[l];
+        y[1][l] = special_x[1] * sinv[l];
+        y[2][l] = special_x[2] * sinv[l];
+        yo[0][l] = y[0][l] + y[1][l];
+        yo[1][l] = y[0][l] + y[2][l];
+        yo[2][l] = y[1][l] + y[2][l];
+    }
+    __m256i y0_, y1_, y2_, yo0_, yo1_, yo2_;
+    Goldilocks::load(y0_, y[0]);
+    Goldilocks::load(y1_, y[1]);
+    Goldilocks::load(y2_, y[2]);
+    Goldilocks::load(yo0_, yo[0]);
+    Goldilocks::load(yo1_, yo[1]);
+    Goldilocks::load(yo2_, yo[2]);
+
+    // Horner, acc = acc * y + c[i]
+    __m256i acc0_, acc1_, acc2_, c_;
+    Goldilocks::copy_avx(acc0_, &ppar_c[nX - 1][0], FIELD_EXTENSION);
+    Goldilocks::copy_avx(acc1_, &ppar_c[nX - 1][1], FIELD_EXTENSION);
+    Goldilocks::copy_avx(acc2_, &ppar_c[nX - 1][2], FIELD_EXTENSION);
+    for (int64_t i = nX - 2; i >= 0; i--)
+    {
+        Goldilocks3::mul_avx(acc0_, acc1_, acc2_, acc0_, acc1_, acc2_, y0_, y1_, y2_, yo0_, yo1_, yo2_);
+        Goldilocks::copy_avx(c_, &ppar_c[i][0], FIELD_EXTENSION);
+        Goldilocks::add_avx(acc0_, acc0_, c_);
+        Goldilocks::copy_avx(c_, &ppar_c[i][1], FIELD_EXTENSION);
+        Goldilocks::add_avx(acc1_, acc1_, c_);
+        Goldilocks::copy_avx(c_, &ppar_c[i][2], FIELD_EXTENSION);
+        Goldilocks::add_avx(acc2_, acc2_, c_);
+    }
+    Goldilocks::copy_avx(&res[0], FIELD_EXTENSION, acc0_);
+    Goldilocks::copy_avx(&res[1], FIELD_EXTENSION, acc1_);
+    Goldilocks::copy_avx(&res[2], FIELD_EXTENSION, acc2_);
+}
+
 void FRIProve::polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc)
 {
     Goldilocks::Element r = init;
@@ -215,37 +234,57 @@ void FRIProve::evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinom
     }
 }
 
-void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL *treesGL[5], uint64_t idx, uint64_t treeIdx)
+/*
+    Opens all the queries of all the steps: step 0 opens the 5 stark trees, and every other step opens its FRI tree.
+    The layout of every step is set in its ProofTree, the queries buffer of the proof is sized once, and every (step, query)
+    pair is written to its place in it in a single parallel loop
+*/
+void FRIProve::queryPols(FRIProof &fproof, MerkleTreeGL **treesGL, std::vector<MerkleTreeGL *> &treesFRIGL, uint64_t *ys, StarkInfo &starkInfo)
 {
-    vector<MerkleProof> vMkProof;
-    for (uint i = 0; i < 5; i++)
-    {
-        MerkleTreeGL *treesGLTmp = treesGL[i];
-        Goldilocks::Element buff[treesGLTmp->width + treesGLTmp->MerkleProofSize() * HASH_SIZE] = {Goldilocks::zero()};
-
-        treesGLTmp->getGroupProof(&buff[0], idx);
+    uint64_t nSteps = starkInfo.starkStruct.steps.size();
+    uint64_t nQueries = starkInfo.starkStruct.nQueries;
 
-        MerkleProof mkProof(treesGLTmp->width, treesGLTmp->MerkleProofSize(), &buff[0]);
-        vMkProof.push_back(mkProof);
+    std::vector<std::vector<MerkleTreeGL *>> stepTrees(nSteps);
+    uint64_t queriesSize = 0;
+    for (uint64_t si = 0; si < nSteps; si++)
+    {
+        if (si == 0)
+        {
+            stepTrees[si].assign(treesGL, treesGL + 5);
+        }
+        else
+        {
+            stepTrees[si].push_back(treesFRIGL[si]);
+        }
+        ProofTree &proofTree = fproof.proofs.fri.trees[si];
+        proofTree.nQueries = nQueries;
+        proofTree.widths.clear();
+        proofTree.proofSizes.clear();
+        for (uint64_t k = 0; k < stepTrees[si].size(); k++)
+        {
+            proofTree.widths.push_back(stepTrees[si][k]->width);
+            proofTree.proofSizes.push_back(stepTrees[si][k]->MerkleProofSize());
+        }
+        proofTree.queriesOffset = queriesSize;
+        queriesSize += nQueries * proofTree.querySize();
     }
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
+    fproof.proofs.fri.queries.resize(queriesSize);
+    Goldilocks::Element *queries = fproof.proofs.fri.queries.data();
 
-    return;
-}
-
-void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL *treeGL, uint64_t idx, uint64_t treeIdx)
-{
-    vector<MerkleProof> vMkProof;
-
-    Goldilocks::Element buff[treeGL->width * treeGL->width + treeGL->MerkleProofSize() * HASH_SIZE] = {Goldilocks::zero()};
-    treeGL->getGroupProof(&buff[0], idx);
-
-    MerkleProof mkProof(treeGL->width, treeGL->MerkleProofSize(), &buff[0]);
-    vMkProof.push_back(mkProof);
-
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
-
-    return;
+#pragma omp parallel for schedule(dynamic)
+    for (uint64_t t = 0; t < nSteps * nQueries; t++)
+    {
+        uint64_t si = t / nQueries;
+        uint64_t i = t % nQueries;
+        uint64_t idx = ys[i] % (1 << starkInfo.starkStruct.steps[si].nBits);
+        ProofTree &proofTree = fproof.proofs.fri.trees[si];
+        Goldilocks::Element *query = &queries[proofTree.queriesOffset + i * proofTree.querySize()];
+        for (uint64_t k = 0; k < stepTrees[si].size(); k++)
+        {
+            stepTrees[si][k]->getGroupProof(query, idx);
+            query += proofTree.widths[k] + proofTree.proofSizes[k] * HASH_SIZE;
+        }
+    }
 }
 
 void FRIProve::getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasposeBits)
@@ -9,15 +9,19 @@
 #include "ntt_goldilocks.hpp"
 #include "merklehash_goldilocks.hpp"
 #include "merkleTreeGL.hpp"
+#include "polinomial.hpp"
+
+#define FRI_FOLD_LANES 4      // Cosets folded at once, one per AVX2 lane
+#define FRI_FOLD_BLOCK_ROWS 8 // Rows of the next tree folded, and hashed, per block
 
 class FRIProve
 {
 public:
     static void prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo);
+    static void foldCosets(Goldilocks::Element *res, Goldilocks::Element *src, uint64_t g, uint64_t n, uint64_t nX, Goldilocks::Element *sinv, Goldilocks::Element *special_x, NTT_Goldilocks &ntt, Polinomial &ppar, Polinomial &ppar_c);
     static void polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc);
     static void evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x);
-    static void queryPol(FRIProof &fproof, MerkleTreeGL **treeGL, uint64_t idx, uint64_t treeIdx);
-    static void queryPol(FRIProof &fproof, MerkleTreeGL *treeGL, uint64_t idx, uint64_t treeIdx);
+    static void queryPols(FRIProof &fproof, MerkleTreeGL **treesGL, std::vector<MerkleTreeGL *> &treesFRIGL, uint64_t *ys, StarkInfo &starkInfo);
     static void getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasposeBits);
 };
 
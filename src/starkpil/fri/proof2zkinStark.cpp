@@ -2,6 +2,7 @@
 
 #include <string>
 #include <iostream>
+#include <algorithm>
 #include "proof2zkinStark.hpp"
 using namespace std;
 
@@ -81,6 +82,249 @@ ordered_json proof2zkinStark(ordered_json &proof)
     return zkinOut;
 };
 
+std::vector<uint64_t> &ZkinStark::set(const std::string &name, const std::vector<uint64_t> &shape)
+{
+    uint64_t size = 1;
+    for (uint64_t i = 0; i < shape.size(); i++)
+    {
+        size *= shape[i];
+    }
+    uint64_t s = std::find(names.begin(), names.end(), name) - names.begin();
+    if (s == names.size())
+    {
+        names.push_back(name);
+        shapes.push_back(shape);
+        values.emplace_back(size);
+    }
+    else
+    {
+        shapes[s] = shape;
+        values[s].assign(size, 0);
+    }
+    return values[s];
+}
+
+void ZkinStark::set(const std::string &name, const std::vector<Goldilocks::Element> &elements)
+{
+    std::vector<uint64_t> &v = set(name, {elements.size()});
+    for (uint64_t i = 0; i < elements.size(); i++)
+    {
+        v[i] = Goldilocks::toU64(elements[i]);
+    }
+}
+
+std::vector<uint64_t> &ZkinStark::get(const std::string &name)
+{
+    uint64_t s = std::find(names.begin(), names.end(), name) - names.begin();
+    if (s == names.size())
+    {
+        cerr << "Error: ZkinStark::get() found no signal " << name << endl;
+        exit(-1);
+    }
+    return values[s];
+}
+
+// Flattens the nested arrays of a json signal into values
+static void zkinJson2array(ordered_json &j, std::vector<uint64_t> &values)
+{
+    if (!j.is_array())
+    {
+        values.push_back(j.is_string() ? std::stoull(j.get<std::string>()) : j.get<uint64_t>());
+        return;
+    }
+    for (uint64_t i = 0; i < j.size(); i++)
+    {
+        zkinJson2array(j[i], values);
+    }
+}
+
+// Adds the signals of a json zkin; arrays are assumed to be regular, so their shape is taken from their first elements
+void ZkinStark::fromJson(ordered_json &j)
+{
+    for (ordered_json::iterator it = j.begin(); it != j.end(); ++it)
+    {
+        std::vector<uint64_t> shape;
+        ordered_json *element = &it.value();
+        while (element->is_array())
+        {
+            shape.push_back(element->size());
+            if (element->size() == 0)
+                break;
+            element = &(*element)[0];
+        }
+        std::vector<uint64_t> &v = set(it.key(), shape);
+        v.clear();
+        zkinJson2array(it.value(), v);
+    }
+}
+
+// Builds the nested arrays of dimension d of a signal, starting at values[pos]
+static ordered_json zkinArray2json(const std::vector<uint64_t> &shape, uint64_t d, const std::vector<uint64_t> &values, uint64_t &pos)
+{
+    ordered_json j = ordered_json::array();
+    for (uint64_t i = 0; i < shape[d]; i++)
+    {
+        if (d == shape.size() - 1)
+        {
+            j.push_back(std::to_string(values[pos++]));
+        }
+        else
+        {
+            j.push_back(zkinArray2json(shape, d + 1, values, pos));
+        }
+    }
+    return j;
+}
+
+ordered_json ZkinStark::toJson(void)
+{
+    ordered_json j = ordered_json::object();
+    for (uint64_t s = 0; s < names.size(); s++)
+    {
+        uint64_t pos = 0;
+        j[names[s]] = (shapes[s].size() == 0) ? ordered_json(std::to_string(values[s][0])) : zkinArray2json(shapes[s], 0, values[s], pos);
+    }
+    return j;
+}
+
+// Layout: number of signals, then per signal the name length, the name, the number of dimensions, the shape and the values
+void ZkinStark::save(const std::string &fileName)
+{
+    std::string tmpFileName = fileName + ".tmp";
+    FILE *f = fopen(tmpFileName.c_str(), "wb");
+    if (f == NULL)
+    {
+        cerr << "Error: ZkinStark::save() failed calling fopen() of file " << tmpFileName << endl;
+        exit(-1);
+    }
+    bool bOk = true;
+    uint64_t nSignals = names.size();
+    bOk = bOk && (fwrite(&nSignals, sizeof(uint64_t), 1, f) == 1);
+    for (uint64_t s = 0; s < nSignals; s++)
+    {
+        uint64_t nameSize = names[s].size();
+        uint64_t nDims = shapes[s].size();
+        bOk = bOk && (fwrite(&nameSize, sizeof(uint64_t), 1, f) == 1);
+        bOk = bOk && (fwrite(names[s].data(), 1, nameSize, f) == nameSize);
+        bOk = bOk && (fwrite(&nDims, sizeof(uint64_t), 1, f) == 1);
+        bOk = bOk && (fwrite(shapes[s].data(), sizeof(uint64_t), nDims, f) == nDims);
+        bOk = bOk && (fwrite(values[s].data(), sizeof(uint64_t), values[s].size(), f) == values[s].size());
+    }
+    bOk = (fclose(f) == 0) && bOk;
+    if (!bOk || (rename(tmpFileName.c_str(), fileName.c_str()) != 0))
+    {
+        cerr << "Error: ZkinStark::save() failed writing file " << fileName << endl;
+        exit(-1);
+    }
+}
+
+bool ZkinStark::load(const std::string &fileName)
+{
+    FILE *f = fopen(fileName.c_str(), "rb");
+    if (f == NULL)
+    {
+        return false;
+    }
+    names.clear();
+    shapes.clear();
+    values.clear();
+    uint64_t nSignals;
+    bool bOk = (fread(&nSignals, sizeof(uint64_t), 1, f) == 1);
+    for (uint64_t s = 0; bOk && (s < nSignals); s++)
+    {
+        uint64_t nameSize, nDims;
+        bOk = (fread(&nameSize, sizeof(uint64_t), 1, f) == 1);
+        std::string name(bOk ? nameSize : 0, ' ');
+        bOk = bOk && (fread(&name[0], 1, nameSize, f) == nameSize);
+        bOk = bOk && (fread(&nDims, sizeof(uint64_t), 1, f) == 1);
+        std::vector<uint64_t> shape(bOk ? nDims : 0);
+        bOk = bOk && (fread(shape.data(), sizeof(uint64_t), nDims, f) == nDims);
+        if (bOk)
+        {
+            std::vector<uint64_t> &v = set(name, shape);
+            bOk = (fread(v.data(), sizeof(uint64_t), v.size(), f) == v.size());
+        }
+    }
+    fclose(f);
+    return bOk;
+}
+
+// Copies nQueries rows of the flat queries buffer, size elements starting at offset every querySize elements
+static void copyQueries(std::vector<uint64_t> &dst, const Goldilocks::Element *queries, uint64_t nQueries, uint64_t querySize, uint64_t offset, uint64_t size)
+{
+    for (uint64_t q = 0; q < nQueries; q++)
+    {
+        for (uint64_t k = 0; k < size; k++)
+        {
+            dst[q * size + k] = Goldilocks::toU64(queries[q * querySize + offset + k]);
+        }
+    }
+}
+
+// Same signals as proof2zkinStark(proof2json()), built from the proof buffers
+void proof2zkinStark(FRIProof &fproof, ZkinStark &zkin)
+{
+    Proofs &proofs = fproof.proofs;
+    Fri &fri = proofs.fri;
+
+    zkin.set("root1", proofs.root1);
+    zkin.set("root2", proofs.root2);
+    zkin.set("root3", proofs.root3);
+    zkin.set("root4", proofs.root4);
+
+    std::vector<uint64_t> &evals = zkin.set("evals", {proofs.evals.size(), FIELD_EXTENSION});
+    for (uint64_t i = 0; i < proofs.evals.size(); i++)
+    {
+        for (uint64_t k = 0; k < FIELD_EXTENSION; k++)
+        {
+            evals[i * FIELD_EXTENSION + k] = Goldilocks::toU64(proofs.evals[i][k]);
+        }
+    }
+
+    const Goldilocks::Element *queries = fri.queries.data();
+    for (uint64_t i = 1; i < fri.trees.size(); i++)
+    {
+        ProofTree &tree = fri.trees[i];
+        zkin.set("s" + std::to_string(i) + "_root", tree.root);
+        std::vector<uint64_t> &vals = zkin.set("s" + std::to_string(i) + "_vals", {tree.nQueries, tree.widths[0]});
+        copyQueries(vals, &queries[tree.queriesOffset], tree.nQueries, tree.querySize(), 0, tree.widths[0]);
+        std::vector<uint64_t> &siblings = zkin.set("s" + std::to_string(i) + "_siblings", {tree.nQueries, tree.proofSizes[0], HASH_SIZE});
+        copyQueries(siblings, &queries[tree.queriesOffset], tree.nQueries, tree.querySize(), tree.widths[0], tree.proofSizes[0] * HASH_SIZE);
+    }
+
+    // Step 0 opens the trees of cm1, cm2, cm3, cm4 and constants; cm2 and cm3 may be empty
+    ProofTree &tree0 = fri.trees[0];
+    const std::vector<std::string> suffixes = {"1", "2", "3", "4", "C"};
+    std::vector<uint64_t> offsets(suffixes.size());
+    for (uint64_t k = 1; k < suffixes.size(); k++)
+    {
+        offsets[k] = offsets[k - 1] + tree0.widths[k - 1] + tree0.proofSizes[k - 1] * HASH_SIZE;
+    }
+    for (uint64_t k = 0; k < suffixes.size(); k++)
+    {
+        if ((k == 1 || k == 2) && tree0.widths[k] == 0)
+            continue;
+        std::vector<uint64_t> &vals = zkin.set("s0_vals" + suffixes[k], {tree0.nQueries, tree0.widths[k]});
+        copyQueries(vals, &queries[tree0.queriesOffset], tree0.nQueries, tree0.querySize(), offsets[k], tree0.widths[k]);
+    }
+    for (uint64_t k = 0; k < suffixes.size(); k++)
+    {
+        if ((k == 1 || k == 2) && tree0.widths[k] == 0)
+            continue;
+        std::vector<uint64_t> &siblings = zkin.set("s0_siblings" + suffixes[k], {tree0.nQueries, tree0.proofSizes[k], HASH_SIZE});
+        copyQueries(siblings, &queries[tree0.queriesOffset], tree0.nQueries, tree0.querySize(), offsets[k] + tree0.widths[k], tree0.proofSizes[k] * HASH_SIZE);
+    }
+
+    std::vector<uint64_t> &finalPol = zkin.set("finalPol", {fri.pol.size(), FIELD_EXTENSION});
+    for (uint64_t i = 0; i < fri.pol.size(); i++)
+    {
+        for (uint64_t k = 0; k < FIELD_EXTENSION; k++)
+        {
+            finalPol[i * FIELD_EXTENSION + k] = Goldilocks::toU64(fri.pol[i][k]);
+        }
+    }
+}
+
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey)
 {
     ordered_json zkinOut = ordered_json::object();
@@ -184,4 +428,51 @@ ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &ve
     }
 
     return zkinOut;
-}
\ No newline at end of file
+}
+
+// Same signals as joinzkin() of the json zkins
+void joinzkin(ZkinStark &zkin1, ZkinStark &zkin2, ordered_json &verKey, ZkinStark &zkinOut)
+{
+    std::vector<uint64_t> &publics1 = zkin1.get("publics");
+    std::vector<uint64_t> &publics2 = zkin2.get("publics");
+
+    // oldStateRoot, oldAccInputHash0, oldBatchNum, chainId and forkid from the first proof; newStateRoot, newAccInputHash0,
+    // newLocalExitRoot and newBatchNum from the second one
+    std::vector<uint64_t> &publics = zkinOut.set("publics", {44});
+    for (int i = 0; i < 19; i++)
+    {
+        publics[i] = publics1[i];
+    }
+    for (int i = 19; i < 44; i++)
+    {
+        publics[i] = publics2[i];
+    }
+
+    const std::vector<std::string> names = {"publics", "root1", "root2", "root3", "root4", "evals",
+                                            "s0_vals1", "s0_vals3", "s0_vals4", "s0_valsC",
+                                            "s0_siblings1", "s0_siblings3", "s0_siblings4", "s0_siblingsC",
+                                            "s1_root", "s2_root", "s3_root", "s4_root",
+                                            "s1_siblings", "s2_siblings", "s3_siblings", "s4_siblings",
+                                            "s1_vals", "s2_vals", "s3_vals", "s4_vals", "finalPol"};
+    const std::vector<std::string> prefixes = {"a_", "b_"};
+    ZkinStark *zkins[2] = {&zkin1, &zkin2};
+    for (uint64_t z = 0; z < 2; z++)
+    {
+        for (uint64_t i = 0; i < names.size(); i++)
+        {
+            uint64_t s = std::find(zkins[z]->names.begin(), zkins[z]->names.end(), names[i]) - zkins[z]->names.begin();
+            if (s == zkins[z]->names.size())
+            {
+                cerr << "Error: joinzkin() found no signal " << names[i] << endl;
+                exit(-1);
+            }
+            zkinOut.set(prefixes[z] + names[i], zkins[z]->shapes[s]) = zkins[z]->values[s];
+        }
+    }
+
+    std::vector<uint64_t> &rootC = zkinOut.set("rootC", {4});
+    for (int i = 0; i < 4; i++)
+    {
+        rootC[i] = verKey["constRoot"][i];
+    }
+}
@@ -6,7 +6,34 @@
 
 using ordered_json = nlohmann::ordered_json;
 
+/*
+    Binary zkin: the input signals of a verifier circuit, with the same names as the json zkin and their values flattened
+    in the same order as its nested arrays. Values are canonical field elements, so they are loaded into the witness
+    calculators, and handed from one stark to the next, without formatting or parsing strings.
+    The json zkin is only generated, by toJson(), when it must be returned or saved.
+*/
+class ZkinStark
+{
+public:
+    std::vector<std::string> names;
+    std::vector<std::vector<uint64_t>> shapes;
+    std::vector<std::vector<uint64_t>> values;
+
+    // Adds the signal, or replaces it if it already exists; returns its values, to be filled by the caller
+    std::vector<uint64_t> &set(const std::string &name, const std::vector<uint64_t> &shape);
+    void set(const std::string &name, const std::vector<Goldilocks::Element> &elements);
+    // Returns the values of the signal; it must exist
+    std::vector<uint64_t> &get(const std::string &name);
+    ordered_json toJson(void);
+    void fromJson(ordered_json &j);
+    // Binary file of the signals; save() writes a temporary file and renames it, so fileName is either complete or absent
+    void save(const std::string &fileName);
+    bool load(const std::string &fileName); // Returns false if the file does not exist or is incomplete
+};
+
 ordered_json proof2zkinStark(ordered_json &fproof);
+void proof2zkinStark(FRIProof &fproof, ZkinStark &zkin);
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey);
+void joinzkin(ZkinStark &zkin1, ZkinStark &zkin2, ordered_json &verKey, ZkinStark &zkinOut);
 
 #endif
\ No newline at end of file
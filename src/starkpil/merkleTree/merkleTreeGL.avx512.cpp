@@ -0,0 +1,38 @@
+#include "merkleTreeGL.hpp"
+#include "poseidonGoldilocksLanes512.hpp"
+#include <algorithm> // std::max
+
+// Hashes the leaves of rows [row, row + POSEIDON_AVX512_LANES), one row per AVX-512 lane, gathering them from source with the row stride
+void MerkleTreeGL::hashRowsLanes512(Goldilocks::Element *leaves, uint64_t row)
+{
+    uint64_t batch_size = std::max((uint64_t)8, (width + 3) / 4);
+    uint64_t nbatches = 1;
+    if (width > 0)
+    {
+        nbatches = (width + batch_size - 1) / batch_size;
+    }
+    uint64_t nlastb = width - (nbatches - 1) * batch_size;
+
+    const __m512i rowOffsets = _mm512_set_epi64(7 * width, 6 * width, 5 * width, 4 * width, 3 * width, 2 * width, width, 0);
+    __m512i buff0[nbatches * CAPACITY];
+    __m512i buff1[batch_size];
+    for (uint64_t j = 0; j < nbatches; j++)
+    {
+        uint64_t nn = batch_size;
+        if (j == nbatches - 1)
+            nn = nlastb;
+        for (uint64_t k = 0; k < nn; k++)
+        {
+            buff1[k] = _mm512_i64gather_epi64(rowOffsets, (const long long *)&source[row * width + j * batch_size + k], sizeof(Goldilocks::Element));
+        }
+        PoseidonGoldilocksLanes512::linear_hash((__m512i(&)[CAPACITY])buff0[j * CAPACITY], buff1, nn);
+    }
+    __m512i leaf[CAPACITY];
+    PoseidonGoldilocksLanes512::linear_hash(leaf, buff0, nbatches * CAPACITY);
+
+    const __m512i leafOffsets = _mm512_set_epi64(7 * CAPACITY, 6 * CAPACITY, 5 * CAPACITY, 4 * CAPACITY, 3 * CAPACITY, 2 * CAPACITY, CAPACITY, 0);
+    for (uint64_t k = 0; k < CAPACITY; k++)
+    {
+        _mm512_i64scatter_epi64((long long *)&leaves[k], leafOffsets, leaf[k], sizeof(Goldilocks::Element));
+    }
+}
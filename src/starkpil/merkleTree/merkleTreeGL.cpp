@@ -1,6 +1,12 @@
 #include "merkleTreeGL.hpp"
+#include "poseidonGoldilocksLanes.hpp"
+#include "zkassert.hpp"
+#include "utils.hpp"
 #include <cassert>
 #include <algorithm> // std::max
+#include <iostream>
+
+using namespace std;
 
 void MerkleTreeGL::getElement(Goldilocks::Element &element, uint64_t idx, uint64_t subIdx)
 {
@@ -11,35 +17,63 @@ void MerkleTreeGL::getElement(Goldilocks::Element &element, uint64_t idx, uint64
 
 void MerkleTreeGL::getGroupProof(Goldilocks::Element *proof, uint64_t idx)
 {
+    std::memcpy(proof, &source[idx * width], width * sizeof(Goldilocks::Element));
 
-#pragma omp parallel for
-    for (uint64_t i = 0; i < width; i++)
+    if (nLevelsDropped == 0)
     {
-        getElement(proof[i], idx, i);
+        genMerkleProof(&proof[width], nodes, idx, 0, height * HASH_SIZE);
+        return;
     }
 
-    genMerkleProof(&proof[width], idx, 0, height * HASH_SIZE);
+    // Rebuild the lower subtree that contains idx from source, and take from it the siblings of the dropped levels.
+    // Queries are opened in parallel, so every thread hashes its subtree serially into its own buffer
+    uint64_t subtreeHeight = getSubtreeHeight();
+    uint64_t subtreeIdx = idx >> nLevelsDropped;
+    Goldilocks::Element *subtree = &subtrees[omp_get_thread_num() * getSubtreeNumElements()];
+    hashRowsTo(subtree, subtreeIdx * subtreeHeight, subtreeHeight);
+    buildLevels(subtree, subtreeHeight);
+    genMerkleProof(&proof[width], subtree, idx & (subtreeHeight - 1), 0, subtreeHeight * HASH_SIZE);
+
+    genMerkleProof(&proof[width + nLevelsDropped * HASH_SIZE], nodes, subtreeIdx, 0, (height >> nLevelsDropped) * HASH_SIZE);
 }
 
-void MerkleTreeGL::genMerkleProof(Goldilocks::Element *proof, uint64_t idx, uint64_t offset, uint64_t n)
+void MerkleTreeGL::genMerkleProof(Goldilocks::Element *proof, Goldilocks::Element *levels, uint64_t idx, uint64_t offset, uint64_t n)
 {
     if (n <= HASH_SIZE)
         return;
     uint64_t nextIdx = idx >> 1;
     uint64_t si = (idx ^ 1) * HASH_SIZE;
 
-    std::memcpy(proof, &nodes[offset + si], HASH_SIZE * sizeof(Goldilocks::Element));
+    std::memcpy(proof, &levels[offset + si], HASH_SIZE * sizeof(Goldilocks::Element));
 
     uint64_t nextN = (std::floor((n - 1) / 8) + 1) * HASH_SIZE;
-    genMerkleProof(&proof[HASH_SIZE], nextIdx, offset + nextN * 2, nextN);
+    genMerkleProof(&proof[HASH_SIZE], levels, nextIdx, offset + nextN * 2, nextN);
 }
 
-void MerkleTreeGL::merkelize()
+void MerkleTreeGL::hashRow(Goldilocks::Element *leaf, uint64_t row)
 {
-    if (height == 0)
+    uint64_t batch_size = std::max((uint64_t)8, (width + 3) / 4);
+    uint64_t nbatches = 1;
+    if (width > 0)
     {
-        return;
+        nbatches = (width + batch_size - 1) / batch_size;
+    }
+    uint64_t nlastb = width - (nbatches - 1) * batch_size;
+
+    Goldilocks::Element buff0[nbatches * CAPACITY];
+    for (uint64_t j = 0; j < nbatches; j++)
+    {
+        uint64_t nn = batch_size;
+        if (j == nbatches - 1)
+            nn = nlastb;
+        PoseidonGoldilocks::linear_hash(&buff0[j * CAPACITY], &source[row * width + j * batch_size], nn);
     }
+    PoseidonGoldilocks::linear_hash((Goldilocks::Element(&)[CAPACITY])leaf[0], buff0, nbatches * CAPACITY);
+}
+
+// Hashes the leaves of rows [row, row + POSEIDON_AVX_LANES), one row per AVX2 lane, reading them from source with the row stride
+void MerkleTreeGL::hashRowsLanes(Goldilocks::Element *leaves, uint64_t row)
+{
     uint64_t batch_size = std::max((uint64_t)8, (width + 3) / 4);
     uint64_t nbatches = 1;
     if (width > 0)
@@ -48,34 +82,160 @@ void MerkleTreeGL::merkelize()
     }
     uint64_t nlastb = width - (nbatches - 1) * batch_size;
 
-    // Hash the leaves
+    __m256i buff0[nbatches * CAPACITY];
+    __m256i buff1[batch_size];
+    for (uint64_t j = 0; j < nbatches; j++)
+    {
+        uint64_t nn = batch_size;
+        if (j == nbatches - 1)
+            nn = nlastb;
+        for (uint64_t k = 0; k < nn; k++)
+        {
+            Goldilocks::copy_avx(buff1[k], &source[row * width + j * batch_size + k], width);
+        }
+        PoseidonGoldilocksLanes::linear_hash((__m256i(&)[CAPACITY])buff0[j * CAPACITY], buff1, nn);
+    }
+    __m256i leaf[CAPACITY];
+    PoseidonGoldilocksLanes::linear_hash(leaf, buff0, nbatches * CAPACITY);
+    for (uint64_t k = 0; k < CAPACITY; k++)
+    {
+        Goldilocks::copy_avx(&leaves[k], CAPACITY, leaf[k]);
+    }
+}
+
+// Hashes the leaves of rows [rowStart, rowStart + nRows) into leaves
+void MerkleTreeGL::hashRowsTo(Goldilocks::Element *leaves, uint64_t rowStart, uint64_t nRows)
+{
+    uint64_t i = 0;
+    if (cpuSupportsAvx512())
+    {
+        for (; i + POSEIDON_AVX512_LANES <= nRows; i += POSEIDON_AVX512_LANES)
+        {
+            hashRowsLanes512(&leaves[i * CAPACITY], rowStart + i);
+        }
+    }
+    for (; i + POSEIDON_AVX_LANES <= nRows; i += POSEIDON_AVX_LANES)
+    {
+        hashRowsLanes(&leaves[i * CAPACITY], rowStart + i);
+    }
+    for (; i < nRows; i++)
+    {
+        hashRow(&leaves[i * CAPACITY], rowStart + i);
+    }
+}
+
+// Computes the root of the lower subtree subtreeIdx, whose levels are not kept in nodes; called from parallel loops over subtrees
+void MerkleTreeGL::hashSubtree(Goldilocks::Element *subtreeRoot, uint64_t subtreeIdx)
+{
+    uint64_t subtreeHeight = getSubtreeHeight();
+    Goldilocks::Element *subtree = &subtrees[omp_get_thread_num() * getSubtreeNumElements()];
+    hashRowsTo(subtree, subtreeIdx * subtreeHeight, subtreeHeight);
+    buildLevels(subtree, subtreeHeight);
+    std::memcpy(subtreeRoot, &subtree[getSubtreeNumElements() - HASH_SIZE], HASH_SIZE * sizeof(Goldilocks::Element));
+}
+
+void MerkleTreeGL::hashLeaves(uint64_t rowStart, uint64_t nRows)
+{
+    assert(rowStart + nRows <= height);
+    if (nLevelsDropped == 0)
+    {
+        hashRowsTo(&nodes[rowStart * CAPACITY], rowStart, nRows);
+        return;
+    }
+
+    uint64_t subtreeHeight = getSubtreeHeight();
+    assert((rowStart % subtreeHeight == 0) && (nRows % subtreeHeight == 0));
+    for (uint64_t i = rowStart / subtreeHeight; i < (rowStart + nRows) / subtreeHeight; i++)
+    {
+        hashSubtree(&nodes[i * CAPACITY], i);
+    }
+}
+
+void MerkleTreeGL::merkelize()
+{
+    if (height == 0)
+    {
+        return;
+    }
+
+    // Hash the leaves, or the roots of the lower subtrees if their levels are not kept
+    if (nLevelsDropped == 0)
+    {
+        // Chunks of POSEIDON_AVX512_LANES rows, so they can be hashed by AVX-512 lanes if available
 #pragma omp parallel for
-    for (uint64_t i = 0; i < height; i++)
+        for (uint64_t i = 0; i < height; i += POSEIDON_AVX512_LANES)
+        {
+            hashLeaves(i, std::min((uint64_t)POSEIDON_AVX512_LANES, height - i));
+        }
+    }
+    else
+    {
+#pragma omp parallel for
+        for (uint64_t i = 0; i < (height >> nLevelsDropped); i++)
+        {
+            hashSubtree(&nodes[i * CAPACITY], i);
+        }
+    }
+
+#ifdef DEBUG
+    // The leaves hashed by lanes must match the sequential hash
+    if ((nLevelsDropped == 0) && (height >= POSEIDON_AVX512_LANES))
     {
-        Goldilocks::Element buff0[nbatches * CAPACITY];
-        for (uint64_t j = 0; j < nbatches; j++)
+        Goldilocks::Element leaf[CAPACITY];
+        hashRow(leaf, POSEIDON_AVX512_LANES - 1);
+        for (uint64_t k = 0; k < CAPACITY; k++)
         {
-            uint64_t nn = batch_size;
-            if (j == nbatches - 1)
-                nn = nlastb;
-            Goldilocks::Element buff1[batch_size];
-            std::memcpy(&buff1[0], &source[i * width + j * batch_size], nn * sizeof(Goldilocks::Element));
-            PoseidonGoldilocks::linear_hash(&buff0[j * CAPACITY], buff1, nn);
+            zkassert(Goldilocks::toU64(leaf[k]) == Goldilocks::toU64(nodes[(POSEIDON_AVX512_LANES - 1) * CAPACITY + k]));
         }
-        PoseidonGoldilocks::linear_hash(&nodes[i * CAPACITY], buff0, nbatches * CAPACITY);
     }
+#endif
 
     // Build the merkle tree
-    uint64_t pending = height;
+    merkelizeNodes();
+}
+
+void MerkleTreeGL::merkelizeNodes()
+{
+    if (height == 0)
+    {
+        return;
+    }
+    buildLevels(nodes, height >> nLevelsDropped);
+}
+
+// Builds the upper levels over the nLeaves nodes stored at the beginning of levels
+void MerkleTreeGL::buildLevels(Goldilocks::Element *levels, uint64_t nLeaves)
+{
+    uint64_t pending = nLeaves;
     uint64_t nextN = floor((pending - 1) / 2) + 1;
 
-    Goldilocks::Element *cursor_read = nodes;
-    Goldilocks::Element *cursor_write = &nodes[height * CAPACITY];
+    Goldilocks::Element *cursor_read = levels;
+    Goldilocks::Element *cursor_write = &levels[nLeaves * CAPACITY];
 
     while (pending > 1)
     {
+        // Hash POSEIDON_AVX_LANES pairs of nodes at once, reading the pairs with a stride of RATE elements
+        uint64_t nextNLanes = nextN - nextN % POSEIDON_AVX_LANES;
 #pragma omp parallel for
-        for (uint64_t i = 0; i < nextN; i++)
+        for (uint64_t i = 0; i < nextNLanes; i += POSEIDON_AVX_LANES)
+        {
+            __m256i pol_input[SPONGE_WIDTH];
+            for (uint64_t k = 0; k < RATE; k++)
+            {
+                Goldilocks::copy_avx(pol_input[k], &cursor_read[i * RATE + k], RATE);
+            }
+            for (uint64_t k = RATE; k < SPONGE_WIDTH; k++)
+            {
+                Goldilocks::copy_avx(pol_input[k], Goldilocks::zero());
+            }
+            __m256i pol_output[CAPACITY];
+            PoseidonGoldilocksLanes::hash(pol_output, pol_input);
+            for (uint64_t k = 0; k < CAPACITY; k++)
+            {
+                Goldilocks::copy_avx(&cursor_write[i * CAPACITY + k], CAPACITY, pol_output[k]);
+            }
+        }
+        for (uint64_t i = nextNLanes; i < nextN; i++)
         {
             Goldilocks::Element pol_input[SPONGE_WIDTH];
             std::memset(pol_input, 0, SPONGE_WIDTH * sizeof(Goldilocks::Element));
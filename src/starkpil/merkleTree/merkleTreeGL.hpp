@@ -4,14 +4,23 @@
 #include "goldilocks_base_field.hpp"
 #include "poseidon_goldilocks.hpp"
 #include <math.h>
+#include <cassert>
+#include <iostream>
+#include <omp.h>
 
 #define MERKLEHASHGL_ARITY 2
 class MerkleTreeGL
 {
 private:
     void linearHash();
+    void hashRow(Goldilocks::Element *leaf, uint64_t row);
+    void hashRowsLanes(Goldilocks::Element *leaves, uint64_t row);
+    void hashRowsLanes512(Goldilocks::Element *leaves, uint64_t row); // Only if cpuSupportsAvx512()
+    void hashRowsTo(Goldilocks::Element *leaves, uint64_t rowStart, uint64_t nRows);
+    void hashSubtree(Goldilocks::Element *subtree, uint64_t subtreeIdx);
     void getElement(Goldilocks::Element &element, uint64_t idx, uint64_t subIdx);
-    void genMerkleProof(Goldilocks::Element *proof, uint64_t idx, uint64_t offset, uint64_t n);
+    void genMerkleProof(Goldilocks::Element *proof, Goldilocks::Element *levels, uint64_t idx, uint64_t offset, uint64_t n);
+    static void buildLevels(Goldilocks::Element *levels, uint64_t nLeaves);
 
 public:
     uint64_t height;
@@ -20,6 +29,8 @@ public:
     Goldilocks::Element *nodes;
     bool isSourceAllocated = false;
     bool isNodesAllocated = false;
+    uint64_t nLevelsDropped = 0; // Lower levels of the tree that are not kept in nodes, and are rebuilt from source when needed
+    Goldilocks::Element *subtrees = NULL; // One buffer per OpenMP thread to rebuild a lower subtree, if levels are dropped
     MerkleTreeGL(){};
     MerkleTreeGL(Goldilocks::Element *tree)
     {
@@ -30,9 +41,11 @@ public:
         isNodesAllocated = false;
         isSourceAllocated = false;
     };
-    MerkleTreeGL(uint64_t _height, uint64_t _width, Goldilocks::Element *_source) : height(_height), width(_width), source(_source)
+    MerkleTreeGL(uint64_t _height, uint64_t _width, Goldilocks::Element *_source) : MerkleTreeGL(_height, _width, _source, 0){};
+    // Keeps only the top nKeptLevels levels of the tree (leaves level included); 0 keeps all of them
+    MerkleTreeGL(uint64_t _height, uint64_t _width, Goldilocks::Element *_source, uint64_t nKeptLevels) : height(_height), width(_width), source(_source)
     {
-
+        nLevelsDropped = getLevelsDropped(height, nKeptLevels);
         if (source == NULL)
         {
             source = (Goldilocks::Element *)calloc(height * width, sizeof(Goldilocks::Element));
@@ -40,6 +53,15 @@ public:
         }
         nodes = (Goldilocks::Element *)calloc(getTreeNumElements(), sizeof(Goldilocks::Element));
         isNodesAllocated = true;
+        if (nLevelsDropped > 0)
+        {
+            subtrees = (Goldilocks::Element *)malloc(omp_get_max_threads() * getSubtreeNumElements() * sizeof(Goldilocks::Element));
+            if (subtrees == NULL)
+            {
+                std::cerr << "Error: MerkleTreeGL::MerkleTreeGL() failed calling malloc() of size " << omp_get_max_threads() * getSubtreeNumElements() * sizeof(Goldilocks::Element) << std::endl;
+                exit(-1);
+            }
+        }
     };
     ~MerkleTreeGL()
     {
@@ -51,6 +73,10 @@ public:
         {
             free(nodes);
         }
+        if (subtrees != NULL)
+        {
+            free(subtrees);
+        }
     };
     void copySource(Goldilocks::Element *_source)
     {
@@ -58,9 +84,45 @@ public:
     }
 
     void merkelize();
+    // Hashes the leaves of rows [rowStart, rowStart + nRows), to be called while the rows are still in cache.
+    // If lower levels are dropped, rowStart and nRows must be multiples of getSubtreeHeight()
+    void hashLeaves(uint64_t rowStart, uint64_t nRows);
+    // Builds the internal levels of the tree, once all the leaves have been hashed
+    void merkelizeNodes();
+    static uint64_t getLevelsDropped(uint64_t height, uint64_t nKeptLevels)
+    {
+        uint64_t nLevels = 1;
+        while ((1ULL << (nLevels - 1)) < height)
+        {
+            nLevels++;
+        }
+        if ((nKeptLevels > 0) && (nKeptLevels < nLevels))
+        {
+            assert((height & (height - 1)) == 0);
+            return nLevels - nKeptLevels;
+        }
+        return 0;
+    }
+    // Number of elements of the nodes of a tree of height rows that keeps its top nKeptLevels levels, without allocating it
+    static uint64_t getNumElements(uint64_t height, uint64_t nKeptLevels)
+    {
+        uint64_t nLeaves = height >> getLevelsDropped(height, nKeptLevels);
+        return nLeaves * HASH_SIZE + (nLeaves - 1) * HASH_SIZE;
+    }
+    // Number of rows hashed into each of the lowest nodes kept in memory
+    uint64_t getSubtreeHeight()
+    {
+        return 1ULL << nLevelsDropped;
+    }
+    // Number of elements of a lower subtree, from its leaves to its root
+    uint64_t getSubtreeNumElements()
+    {
+        return (2 * getSubtreeHeight() - 1) * HASH_SIZE;
+    }
     uint64_t getTreeNumElements()
     {
-        return height * HASH_SIZE + (height - 1) * HASH_SIZE;
+        uint64_t nLeaves = height >> nLevelsDropped;
+        return nLeaves * HASH_SIZE + (nLeaves - 1) * HASH_SIZE;
     }
     void getRoot(Goldilocks::Element *root)
     {
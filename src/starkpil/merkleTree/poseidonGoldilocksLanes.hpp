@@ -0,0 +1,154 @@
+#ifndef POSEIDON_GOLDILOCKS_LANES
+#define POSEIDON_GOLDILOCKS_LANES
+
+#include <immintrin.h>
+#include <cstring>
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+
+#define POSEIDON_AVX_LANES 4
+#define POSEIDON_AVX512_LANES 8 // States of PoseidonGoldilocksLanes512, defined here for the sources that are not built with AVX-512
+
+/*
+    Poseidon permutation and linear hash of 4 independent states at once, one state per AVX2 lane.
+    state[i] holds the i-th element of the 4 states, so every operation of PoseidonGoldilocks::hash_full_result()
+    is done for the 4 lanes with a single AVX2 operation. Results are the same as the ones of PoseidonGoldilocks.
+*/
+class PoseidonGoldilocksLanes
+{
+private:
+    static inline void pow7(__m256i &x)
+    {
+        __m256i x2, x3, x4;
+        Goldilocks::mul_avx(x2, x, x);
+        Goldilocks::mul_avx(x3, x, x2);
+        Goldilocks::mul_avx(x4, x2, x2);
+        Goldilocks::mul_avx(x, x3, x4);
+    }
+
+    static inline void add(__m256i (&state)[SPONGE_WIDTH], const Goldilocks::Element *C)
+    {
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            Goldilocks::add_avx(state[i], state[i], C[i]);
+        }
+    }
+
+    static inline void pow7add(__m256i (&state)[SPONGE_WIDTH], const Goldilocks::Element *C)
+    {
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            pow7(state[i]);
+            Goldilocks::add_avx(state[i], state[i], C[i]);
+        }
+    }
+
+    static inline void mvp(__m256i (&state)[SPONGE_WIDTH], const Goldilocks::Element (&mat)[SPONGE_WIDTH][SPONGE_WIDTH])
+    {
+        __m256i old_state[SPONGE_WIDTH];
+        std::memcpy(old_state, state, SPONGE_WIDTH * sizeof(__m256i));
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            Goldilocks::mul_avx(state[i], mat[0][i], old_state[0]);
+            for (uint64_t j = 1; j < SPONGE_WIDTH; j++)
+            {
+                __m256i aux;
+                Goldilocks::mul_avx(aux, mat[j][i], old_state[j]);
+                Goldilocks::add_avx(state[i], state[i], aux);
+            }
+        }
+    }
+
+public:
+    static void permutation(__m256i (&state)[SPONGE_WIDTH])
+    {
+        add(state, &(PoseidonGoldilocksConstants::C[0]));
+        for (uint64_t r = 0; r < HALF_N_FULL_ROUNDS - 1; r++)
+        {
+            pow7add(state, &(PoseidonGoldilocksConstants::C[(r + 1) * SPONGE_WIDTH]));
+            mvp(state, PoseidonGoldilocksConstants::M);
+        }
+        pow7add(state, &(PoseidonGoldilocksConstants::C[HALF_N_FULL_ROUNDS * SPONGE_WIDTH]));
+        mvp(state, PoseidonGoldilocksConstants::P);
+
+        for (uint64_t r = 0; r < N_PARTIAL_ROUNDS; r++)
+        {
+            const Goldilocks::Element *S = &(PoseidonGoldilocksConstants::S[(SPONGE_WIDTH * 2 - 1) * r]);
+            pow7(state[0]);
+            Goldilocks::add_avx(state[0], state[0], PoseidonGoldilocksConstants::C[(HALF_N_FULL_ROUNDS + 1) * SPONGE_WIDTH + r]);
+            __m256i s0, aux;
+            Goldilocks::mul_avx(s0, S[0], state[0]);
+            for (uint64_t j = 1; j < SPONGE_WIDTH; j++)
+            {
+                Goldilocks::mul_avx(aux, S[j], state[j]);
+                Goldilocks::add_avx(s0, s0, aux);
+                Goldilocks::mul_avx(aux, S[SPONGE_WIDTH - 1 + j], state[0]);
+                Goldilocks::add_avx(state[j], state[j], aux);
+            }
+            state[0] = s0;
+        }
+
+        for (uint64_t r = 0; r < HALF_N_FULL_ROUNDS - 1; r++)
+        {
+            pow7add(state, &(PoseidonGoldilocksConstants::C[(HALF_N_FULL_ROUNDS + 1) * SPONGE_WIDTH + N_PARTIAL_ROUNDS + r * SPONGE_WIDTH]));
+            mvp(state, PoseidonGoldilocksConstants::M);
+        }
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            pow7(state[i]);
+        }
+        mvp(state, PoseidonGoldilocksConstants::M);
+    }
+
+    // Same as PoseidonGoldilocks::hash() for 4 inputs; input[i] holds the i-th element of the 4 inputs
+    static inline void hash(__m256i (&output)[CAPACITY], const __m256i (&input)[SPONGE_WIDTH])
+    {
+        __m256i state[SPONGE_WIDTH];
+        std::memcpy(state, input, SPONGE_WIDTH * sizeof(__m256i));
+        permutation(state);
+        std::memcpy(output, state, CAPACITY * sizeof(__m256i));
+    }
+
+    // Same as PoseidonGoldilocks::linear_hash() for 4 inputs of the same size; input[i] holds the i-th element of the 4 inputs
+    static void linear_hash(__m256i (&output)[CAPACITY], const __m256i *input, uint64_t size)
+    {
+        __m256i zero;
+        Goldilocks::copy_avx(zero, Goldilocks::zero());
+
+        if (size <= CAPACITY)
+        {
+            for (uint64_t i = 0; i < CAPACITY; i++)
+            {
+                output[i] = (i < size) ? input[i] : zero;
+            }
+            return;
+        }
+
+        __m256i state[SPONGE_WIDTH];
+        uint64_t remaining = size;
+        while (remaining)
+        {
+            if (remaining == size)
+            {
+                for (uint64_t i = 0; i < CAPACITY; i++)
+                {
+                    state[RATE + i] = zero;
+                }
+            }
+            else
+            {
+                std::memcpy(&state[RATE], &state[0], CAPACITY * sizeof(__m256i));
+            }
+            uint64_t n = (remaining < RATE) ? remaining : RATE;
+            for (uint64_t i = 0; i < RATE; i++)
+            {
+                state[i] = (i < n) ? input[size - remaining + i] : zero;
+            }
+            permutation(state);
+            remaining -= n;
+        }
+        std::memcpy(output, state, CAPACITY * sizeof(__m256i));
+    }
+};
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef POSEIDON_GOLDILOCKS_LANES_512
+#define POSEIDON_GOLDILOCKS_LANES_512
+
+#include <immintrin.h>
+#include <cstring>
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+
+/*
+    Same as PoseidonGoldilocksLanes for POSEIDON_AVX512_LANES (8) independent states, one state per AVX-512 lane.
+    POSEIDON_AVX512_LANES is defined in poseidonGoldilocksLanes.hpp, whose AVX2 functions must not be built with AVX-512.
+    Only to be included from sources built with AVX-512 (*.avx512.cpp), and run if cpuSupportsAvx512().
+*/
+class PoseidonGoldilocksLanes512
+{
+private:
+    static inline __m512i broadcast(const Goldilocks::Element &a)
+    {
+        return _mm512_set1_epi64(Goldilocks::toU64(a));
+    }
+
+    static inline void pow7(__m512i &x)
+    {
+        __m512i x2, x3, x4;
+        Goldilocks::mul_avx512(x2, x, x);
+        Goldilocks::mul_avx512(x3, x, x2);
+        Goldilocks::mul_avx512(x4, x2, x2);
+        Goldilocks::mul_avx512(x, x3, x4);
+    }
+
+    static inline void add(__m512i (&state)[SPONGE_WIDTH], const Goldilocks::Element *C)
+    {
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            Goldilocks::add_avx512(state[i], state[i], broadcast(C[i]));
+        }
+    }
+
+    static inline void pow7add(__m512i (&state)[SPONGE_WIDTH], const Goldilocks::Element *C)
+    {
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            pow7(state[i]);
+            Goldilocks::add_avx512(state[i], state[i], broadcast(C[i]));
+        }
+    }
+
+    static inline void mvp(__m512i (&state)[SPONGE_WIDTH], const Goldilocks::Element (&mat)[SPONGE_WIDTH][SPONGE_WIDTH])
+    {
+        __m512i old_state[SPONGE_WIDTH];
+        std::memcpy(old_state, state, SPONGE_WIDTH * sizeof(__m512i));
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            Goldilocks::mul_avx512(state[i], broadcast(mat[0][i]), old_state[0]);
+            for (uint64_t j = 1; j < SPONGE_WIDTH; j++)
+            {
+                __m512i aux;
+                Goldilocks::mul_avx512(aux, broadcast(mat[j][i]), old_state[j]);
+                Goldilocks::add_avx512(state[i], state[i], aux);
+            }
+        }
+    }
+
+public:
+    static void permutation(__m512i (&state)[SPONGE_WIDTH])
+    {
+        add(state, &(PoseidonGoldilocksConstants::C[0]));
+        for (uint64_t r = 0; r < HALF_N_FULL_ROUNDS - 1; r++)
+        {
+            pow7add(state, &(PoseidonGoldilocksConstants::C[(r + 1) * SPONGE_WIDTH]));
+            mvp(state, PoseidonGoldilocksConstants::M);
+        }
+        pow7add(state, &(PoseidonGoldilocksConstants::C[HALF_N_FULL_ROUNDS * SPONGE_WIDTH]));
+        mvp(state, PoseidonGoldilocksConstants::P);
+
+        for (uint64_t r = 0; r < N_PARTIAL_ROUNDS; r++)
+        {
+            const Goldilocks::Element *S = &(PoseidonGoldilocksConstants::S[(SPONGE_WIDTH * 2 - 1) * r]);
+            pow7(state[0]);
+            Goldilocks::add_avx512(state[0], state[0], broadcast(PoseidonGoldilocksConstants::C[(HALF_N_FULL_ROUNDS + 1) * SPONGE_WIDTH + r]));
+            __m512i s0, aux;
+            Goldilocks::mul_avx512(s0, broadcast(S[0]), state[0]);
+            for (uint64_t j = 1; j < SPONGE_WIDTH; j++)
+            {
+                Goldilocks::mul_avx512(aux, broadcast(S[j]), state[j]);
+                Goldilocks::add_avx512(s0, s0, aux);
+                Goldilocks::mul_avx512(aux, broadcast(S[SPONGE_WIDTH - 1 + j]), state[0]);
+                Goldilocks::add_avx512(state[j], state[j], aux);
+            }
+            state[0] = s0;
+        }
+
+        for (uint64_t r = 0; r < HALF_N_FULL_ROUNDS - 1; r++)
+        {
+            pow7add(state, &(PoseidonGoldilocksConstants::C[(HALF_N_FULL_ROUNDS + 1) * SPONGE_WIDTH + N_PARTIAL_ROUNDS + r * SPONGE_WIDTH]));
+            mvp(state, PoseidonGoldilocksConstants::M);
+        }
+        for (uint64_t i = 0; i < SPONGE_WIDTH; i++)
+        {
+            pow7(state[i]);
+        }
+        mvp(state, PoseidonGoldilocksConstants::M);
+    }
+
+    // Same as PoseidonGoldilocks::linear_hash() for 8 inputs of the same size; input[i] holds the i-th element of the 8 inputs
+    static void linear_hash(__m512i (&output)[CAPACITY], const __m512i *input, uint64_t size)
+    {
+        __m512i zero = _mm512_setzero_si512();
+
+        if (size <= CAPACITY)
+        {
+            for (uint64_t i = 0; i < CAPACITY; i++)
+            {
+                output[i] = (i < size) ? input[i] : zero;
+            }
+            return;
+        }
+
+        __m512i state[SPONGE_WIDTH];
+        uint64_t remaining = size;
+        while (remaining)
+        {
+            if (remaining == size)
+            {
+                for (uint64_t i = 0; i < CAPACITY; i++)
+                {
+                    state[RATE + i] = zero;
+                }
+            }
+            else
+            {
+                std::memcpy(&state[RATE], &state[0], CAPACITY * sizeof(__m512i));
+            }
+            uint64_t n = (remaining < RATE) ? remaining : RATE;
+            for (uint64_t i = 0; i < RATE; i++)
+            {
+                state[i] = (i < n) ? input[size - remaining + i] : zero;
+            }
+            permutation(state);
+            remaining -= n;
+        }
+        std::memcpy(output, state, CAPACITY * sizeof(__m512i));
+    }
+};
+
+#endif
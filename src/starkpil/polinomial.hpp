@@ -5,6 +5,15 @@
 #include "goldilocks_cubic_extension.hpp"
 #include "compare_fe.hpp"
 #include <math.h> /* log2 */
+#include <omp.h>
+#include <vector>
+#include <algorithm> // std::upper_bound
+#include <cassert>
+#include <immintrin.h>
+
+#define CALCULATE_Z_MIN_BLOCK_SIZE 1024 // Rows per thread below which calculateZParallel() uses less threads
+#define CALCULATE_POWERS_MIN_BLOCK_SIZE 4096 // Rows per thread below which calculatePowers() uses less threads
+#define COPY_BLOCKED_ROWS 256 // Rows of every polinomial copied per block by copyBlocked()
 
 class Polinomial
 {
@@ -123,6 +132,57 @@ public:
         }
     };
 
+    // Copies every b[i] into a[i], by blocks of rows distributed among the threads. Every row of the sources is read once for
+    // all the polinomials, so a strided section is gathered (or scattered) in a single pass. With nonTemporal, the destination
+    // is written with streaming stores, bypassing the cache
+    static void copyBlocked(std::vector<Polinomial> &a, std::vector<Polinomial> &b, bool nonTemporal = false)
+    {
+        assert(a.size() == b.size());
+        if (b.size() == 0)
+        {
+            return;
+        }
+        uint64_t degree = b[0].degree();
+        for (uint64_t p = 0; p < b.size(); p++)
+        {
+            assert(a[p].dim() == b[p].dim());
+            assert(a[p].degree() == degree && b[p].degree() == degree);
+        }
+
+#pragma omp parallel
+        {
+#pragma omp for schedule(static) nowait
+            for (uint64_t first = 0; first < degree; first += COPY_BLOCKED_ROWS)
+            {
+                uint64_t last = std::min(first + COPY_BLOCKED_ROWS, degree);
+                for (uint64_t i = first; i < last; i++)
+                {
+                    for (uint64_t p = 0; p < b.size(); p++)
+                    {
+                        Goldilocks::Element *src = b[p][i];
+                        Goldilocks::Element *dst = a[p][i];
+                        if (nonTemporal)
+                        {
+                            for (uint64_t j = 0; j < b[p].dim(); j++)
+                            {
+                                _mm_stream_si64((long long *)&dst[j], *(long long *)&src[j]);
+                            }
+                        }
+                        else
+                        {
+                            std::memcpy(dst, src, b[p].dim() * sizeof(Goldilocks::Element));
+                        }
+                    }
+                }
+            }
+            // Streaming stores are weakly ordered and fenced per thread, so that every thread's stores are visible at the barrier
+            if (nonTemporal)
+            {
+                _mm_sfence();
+            }
+        }
+    };
+
     static void copyElement(Polinomial &a, uint64_t idx_a, Polinomial &b, uint64_t idx_b)
     {
         assert(a.dim() == b.dim());
@@ -581,6 +641,167 @@ public:
         // std::cout << "holu: " << id << " " << pos << " times: " << time2 - time1 << " " << time3 - time2 << " " << time4 - time3 << " " << h2.dim() << std::endl;
     }
 
+    // Elements of the buffer of calculateH1H2_parallel() for a tPol of degree N: the hash table slots, the power of 2
+    // not less than 2 * N, plus 2 * N counters and positions, i.e. up to 6 * N (4 * N if N is a power of 2)
+    static uint64_t calculateH1H2_parallelBufferSize(uint64_t N)
+    {
+        uint64_t nSlots = 1;
+        while (nSlots < 2 * N)
+        {
+            nSlots <<= 1;
+        }
+        return nSlots + 2 * N;
+    }
+
+    // Same result as calculateH1H2_opt1/opt3, parallelized inside the plookup. buffer must have at least
+    // calculateH1H2_parallelBufferSize(tPol.degree()) elements, which is up to 6 * tPol.degree()
+    static void calculateH1H2_parallel(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol, uint64_t pNumber, uint64_t *buffer, uint64_t size)
+    {
+        uint64_t N = tPol.degree();
+        if (calculateH1H2_parallelBufferSize(N) > size)
+        {
+            cerr << "Error: calculateH1H2_parallel() needs a buffer of " << calculateH1H2_parallelBufferSize(N) << " elements but got " << size << endl;
+            exit(-1);
+        }
+        uint64_t nSlots = calculateH1H2_parallelBufferSize(N) - 2 * N;
+        uint64_t *slots = buffer;          // Open addressing hash table of t values: index in tPol + 1, or 0 if empty
+        uint64_t *counter = &buffer[nSlots]; // Times every t row appears in h1 and h2
+        uint64_t *position = &buffer[nSlots + N]; // Position of the first appearance of every t row in h1 and h2
+
+#pragma omp parallel for
+        for (uint64_t i = 0; i < nSlots; i++)
+        {
+            slots[i] = 0;
+        }
+
+        // Insert every t value with the index of its last row, as calculateH1H2() does
+#pragma omp parallel for
+        for (uint64_t i = 0; i < N; i++)
+        {
+            uint64_t key[3];
+            tPol.toVectorU64(i, key);
+            uint64_t slot = hashH1H2Key(key, tPol.dim()) & (nSlots - 1);
+            while (true)
+            {
+                uint64_t current = __sync_val_compare_and_swap(&slots[slot], 0, i + 1);
+                if (current == 0)
+                {
+                    break;
+                }
+                if (equalH1H2Key(key, tPol, current - 1))
+                {
+                    while ((current < i + 1) && !__sync_bool_compare_and_swap(&slots[slot], current, i + 1))
+                    {
+                        current = slots[slot];
+                    }
+                    break;
+                }
+                slot = (slot + 1) & (nSlots - 1);
+            }
+            counter[i] = 1;
+        }
+
+        // Count the f values per t row
+#pragma omp parallel for
+        for (uint64_t i = 0; i < fPol.degree(); i++)
+        {
+            uint64_t key[3];
+            fPol.toVectorU64(i, key);
+            uint64_t slot = hashH1H2Key(key, fPol.dim()) & (nSlots - 1);
+            while ((slots[slot] != 0) && !equalH1H2Key(key, tPol, slots[slot] - 1))
+            {
+                slot = (slot + 1) & (nSlots - 1);
+            }
+            if (slots[slot] == 0)
+            {
+                cerr << "Error: calculateH1H2() Number not included: w=" << i << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[i], 16) << endl;
+                exit(-1);
+            }
+#pragma omp atomic
+            counter[slots[slot] - 1]++;
+        }
+
+        // Exclusive prefix sum of the counters, by chunks of rows
+        uint64_t nChunks = omp_get_max_threads();
+        uint64_t chunkSize = (N + nChunks - 1) / nChunks;
+        std::vector<uint64_t> chunkStart(nChunks + 1, 0);
+#pragma omp parallel for
+        for (uint64_t c = 0; c < nChunks; c++)
+        {
+            uint64_t sum = 0;
+            for (uint64_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, N); i++)
+            {
+                position[i] = sum;
+                sum += counter[i];
+            }
+            chunkStart[c + 1] = sum;
+        }
+        for (uint64_t c = 0; c < nChunks; c++)
+        {
+            chunkStart[c + 1] += chunkStart[c];
+        }
+#pragma omp parallel for
+        for (uint64_t c = 0; c < nChunks; c++)
+        {
+            for (uint64_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, N); i++)
+            {
+                position[i] += chunkStart[c];
+            }
+        }
+        assert(chunkStart[nChunks] == 2 * N);
+
+        // Every chunk of the 2N elements of h1 and h2, interleaved, starts with the last t row whose position is not greater
+#pragma omp parallel for
+        for (uint64_t c = 0; c < nChunks; c++)
+        {
+            uint64_t first = c * 2 * chunkSize;
+            uint64_t last = std::min((c + 1) * 2 * chunkSize, 2 * N);
+            if (first >= last)
+            {
+                continue;
+            }
+            uint64_t id = std::upper_bound(position, position + N, first) - position - 1;
+            for (uint64_t k = first; k < last; k++)
+            {
+                while ((id + 1 < N) && (position[id + 1] <= k))
+                {
+                    id++;
+                }
+                if ((k & 1) == 0)
+                {
+                    Polinomial::copyElement(h1, k / 2, tPol, id);
+                }
+                else
+                {
+                    Polinomial::copyElement(h2, k / 2, tPol, id);
+                }
+            }
+        }
+    }
+
+    static inline uint64_t hashH1H2Key(const uint64_t *key, uint64_t dim)
+    {
+        uint64_t hash = key[0];
+        for (uint64_t i = 1; i < dim; i++)
+        {
+            hash = (hash ^ (hash >> 29)) * 0xbf58476d1ce4e5b9ULL + key[i];
+        }
+        hash = (hash ^ (hash >> 31)) * 0x9e3779b97f4a7c15ULL;
+        return hash ^ (hash >> 32);
+    }
+
+    static inline bool equalH1H2Key(const uint64_t *key, Polinomial &pol, uint64_t idx)
+    {
+        for (uint64_t i = 0; i < pol.dim(); i++)
+        {
+            if (key[i] != Goldilocks::toU64(pol[idx][i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     static void calculateZ(Polinomial &z, Polinomial &num, Polinomial &den)
     {
         uint64_t size = num.degree();
@@ -604,6 +825,168 @@ public:
         zkassert(Goldilocks3::isOne((Goldilocks3::Element &)*checkVal[0]));
     }
 
+    // Same result as calculateZ(), parallelized inside the polynomial: every thread inverts the denominators of a block
+    // of rows and computes the running product of the block, which is then multiplied by the product of the previous blocks
+    static void calculateZParallel(Polinomial &z, Polinomial &num, Polinomial &den)
+    {
+        uint64_t size = num.degree();
+        uint64_t nBlocks = std::max((uint64_t)1, std::min((uint64_t)omp_get_max_threads(), size / CALCULATE_Z_MIN_BLOCK_SIZE));
+        uint64_t blockSize = (size + nBlocks - 1) / nBlocks;
+
+        Polinomial denI(size, 3);
+        Polinomial blockProducts(nBlocks, 3);
+        Polinomial checkVal(1, 3);
+
+        // Batch inverse of the denominators and running product of num / den, by blocks
+#pragma omp parallel for
+        for (uint64_t b = 0; b < nBlocks; b++)
+        {
+            uint64_t first = b * blockSize;
+            uint64_t last = std::min(first + blockSize, size);
+            if (first >= last)
+            {
+                Goldilocks3::copy((Goldilocks3::Element *)blockProducts[b], &Goldilocks3::one());
+                continue;
+            }
+
+            Polinomial::copyElement(denI, first, den, first);
+            for (uint64_t i = first + 1; i < last; i++)
+            {
+                Polinomial::mulElement(denI, i, denI, i - 1, den, i);
+            }
+            Polinomial inv(2, 3);
+            Goldilocks3::inv((Goldilocks3::Element *)inv[0], (Goldilocks3::Element *)denI[last - 1]);
+            for (uint64_t i = last - 1; i > first; i--)
+            {
+                Polinomial::mulElement(inv, 1, inv, 0, denI, i - 1);
+                Polinomial::mulElement(inv, 0, inv, 0, den, i);
+                Polinomial::copyElement(denI, i, inv, 1);
+            }
+            Polinomial::copyElement(denI, first, inv, 0);
+
+            // z[i + 1] = num[first] / den[first] * ... * num[i] / den[i]
+            Polinomial tmp(1, 3);
+            Polinomial::mulElement(tmp, 0, num, first, denI, first);
+            Polinomial::copyElement(blockProducts, b, tmp, 0);
+            for (uint64_t i = first + 1; i < last; i++)
+            {
+                Polinomial::mulElement(tmp, 0, num, i, denI, i);
+                Polinomial::mulElement(blockProducts, b, blockProducts, b, tmp, 0);
+                if (i + 1 < size)
+                {
+                    Polinomial::copyElement(z, i + 1, blockProducts, b);
+                }
+            }
+            if (first + 1 < size)
+            {
+                Polinomial::mulElement(z, first + 1, num, first, denI, first);
+            }
+        }
+
+        // Product of the previous blocks, i.e. the value of z at the beginning of every block
+        Polinomial blockStarts(nBlocks, 3);
+        Goldilocks3::copy((Goldilocks3::Element *)blockStarts[0], &Goldilocks3::one());
+        for (uint64_t b = 1; b < nBlocks; b++)
+        {
+            Polinomial::mulElement(blockStarts, b, blockStarts, b - 1, blockProducts, b - 1);
+        }
+        Polinomial::mulElement(checkVal, 0, blockStarts, nBlocks - 1, blockProducts, nBlocks - 1);
+        zkassert(Goldilocks3::isOne((Goldilocks3::Element &)*checkVal[0]));
+
+        Goldilocks::Element *pZ = z[0];
+        Goldilocks3::copy((Goldilocks3::Element *)&pZ[0], &Goldilocks3::one());
+#pragma omp parallel for
+        for (uint64_t b = 1; b < nBlocks; b++)
+        {
+            uint64_t first = b * blockSize;
+            uint64_t last = std::min(first + blockSize, size - 1);
+            for (uint64_t i = first; i < last; i++)
+            {
+                Polinomial::mulElement(z, i + 1, z, i + 1, blockStarts, b);
+            }
+        }
+    }
+
+    // out[idx_out] = base[idx_base]^exp, by square and multiply
+    static void powElement(Polinomial &out, uint64_t idx_out, Polinomial &base, uint64_t idx_base, uint64_t exp)
+    {
+        assert(out.dim() == 3 && base.dim() == 3);
+
+        Polinomial acc(2, 3);
+        Goldilocks3::copy((Goldilocks3::Element *)acc[0], &Goldilocks3::one());
+        Polinomial::copyElement(acc, 1, base, idx_base);
+        while (exp > 0)
+        {
+            if (exp & 1)
+            {
+                Polinomial::mulElement(acc, 0, acc, 0, acc, 1);
+            }
+            Polinomial::mulElement(acc, 1, acc, 1, acc, 1);
+            exp >>= 1;
+        }
+        Polinomial::copyElement(out, idx_out, acc, 0);
+    }
+
+    // pol[k] = base[idx_base]^k for every row of pol. Every thread starts its block of rows from base^first, and
+    // computes the rest of the block 4 rows at a time with AVX2, multiplying by base^4
+    static void calculatePowers(Polinomial &pol, Polinomial &base, uint64_t idx_base)
+    {
+        assert(pol.dim() == 3 && base.dim() == 3);
+
+        uint64_t size = pol.degree();
+        uint64_t nBlocks = std::max((uint64_t)1, std::min((uint64_t)omp_get_max_threads(), size / CALCULATE_POWERS_MIN_BLOCK_SIZE));
+        uint64_t blockSize = (((size + nBlocks - 1) / nBlocks) + 3) & ~(uint64_t)3;
+
+        Polinomial base4(1, 3);
+        powElement(base4, 0, base, idx_base, 4);
+        __m256i b0_, b1_, b2_, bo0_, bo1_, bo2_;
+        Goldilocks::copy_avx(b0_, base4[0][0]);
+        Goldilocks::copy_avx(b1_, base4[0][1]);
+        Goldilocks::copy_avx(b2_, base4[0][2]);
+        Goldilocks::copy_avx(bo0_, base4[0][0] + base4[0][1]);
+        Goldilocks::copy_avx(bo1_, base4[0][0] + base4[0][2]);
+        Goldilocks::copy_avx(bo2_, base4[0][1] + base4[0][2]);
+
+#pragma omp parallel for
+        for (uint64_t b = 0; b < nBlocks; b++)
+        {
+            uint64_t first = b * blockSize;
+            uint64_t last = std::min(first + blockSize, size);
+            if (first >= last)
+            {
+                continue;
+            }
+
+            // First 4 rows of the block
+            powElement(pol, first, base, idx_base, first);
+            uint64_t i = first + 1;
+            for (; (i < first + 4) && (i < last); i++)
+            {
+                Polinomial::mulElement(pol, i, pol, i - 1, base, idx_base);
+            }
+
+            // Rest of the block, pol[i .. i + 3] = pol[i - 4 .. i - 1] * base^4
+            if (i == first + 4)
+            {
+                __m256i a0_, a1_, a2_;
+                Goldilocks::copy_avx(a0_, &pol[first][0], pol.offset());
+                Goldilocks::copy_avx(a1_, &pol[first][1], pol.offset());
+                Goldilocks::copy_avx(a2_, &pol[first][2], pol.offset());
+                for (; i + 4 <= last; i += 4)
+                {
+                    Goldilocks3::mul_avx(a0_, a1_, a2_, a0_, a1_, a2_, b0_, b1_, b2_, bo0_, bo1_, bo2_);
+                    Goldilocks::copy_avx(&pol[i][0], pol.offset(), a0_);
+                    Goldilocks::copy_avx(&pol[i][1], pol.offset(), a1_);
+                    Goldilocks::copy_avx(&pol[i][2], pol.offset(), a2_);
+                }
+            }
+            for (; i < last; i++)
+            {
+                Polinomial::mulElement(pol, i, pol, i - 1, base, idx_base);
+            }
+        }
+    }
+
     // compute the multiplications of the polynomials in src in parallel with partitions of size partitionSize
     // Every thread computes a partition of size partitionSize / (2 * nThreadsPartition)
     // after every computation the size of the partition is doubled until it reaches partitionSize
@@ -719,20 +1102,25 @@ public:
 
     static inline void mulAddElement_adim3(Goldilocks::Element *out, Goldilocks::Element *in_a, Polinomial &in_b, uint64_t idx_b)
     {
-        if (in_b.dim() == 1)
+        mulAddElement_adim3(out, in_a, in_b[idx_b], in_b.dim());
+    }
+
+    static inline void mulAddElement_adim3(Goldilocks::Element *out, Goldilocks::Element *in_a, Goldilocks::Element *in_b, uint64_t dim_b)
+    {
+        if (dim_b == 1)
         {
-            out[0] = out[0] + in_a[0] * in_b[idx_b][0];
-            out[1] = out[1] + in_a[1] * in_b[idx_b][0];
-            out[2] = out[2] + in_a[2] * in_b[idx_b][0];
+            out[0] = out[0] + in_a[0] * in_b[0];
+            out[1] = out[1] + in_a[1] * in_b[0];
+            out[2] = out[2] + in_a[2] * in_b[0];
         }
         else
         {
-            Goldilocks::Element A = (in_a[0] + in_a[1]) * (in_b[idx_b][0] + in_b[idx_b][1]);
-            Goldilocks::Element B = (in_a[0] + in_a[2]) * (in_b[idx_b][0] + in_b[idx_b][2]);
-            Goldilocks::Element C = (in_a[1] + in_a[2]) * (in_b[idx_b][1] + in_b[idx_b][2]);
-            Goldilocks::Element D = in_a[0] * in_b[idx_b][0];
-            Goldilocks::Element E = in_a[1] * in_b[idx_b][1];
-            Goldilocks::Element F = in_a[2] * in_b[idx_b][2];
+            Goldilocks::Element A = (in_a[0] + in_a[1]) * (in_b[0] + in_b[1]);
+            Goldilocks::Element B = (in_a[0] + in_a[2]) * (in_b[0] + in_b[2]);
+            Goldilocks::Element C = (in_a[1] + in_a[2]) * (in_b[1] + in_b[2]);
+            Goldilocks::Element D = in_a[0] * in_b[0];
+            Goldilocks::Element E = in_a[1] * in_b[1];
+            Goldilocks::Element F = in_a[2] * in_b[2];
             Goldilocks::Element G = D - E;
             out[0] = out[0] + (C + G) - F;
             out[1] = out[1] + ((((A + C) - E) - E) - D);
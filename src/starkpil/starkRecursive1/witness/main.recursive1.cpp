@@ -9,6 +9,7 @@
 #include <nlohmann/json.hpp>
 #include <vector>
 #include <chrono>
+#include <cassert>
 #include "main.recursive1.hpp"
 
 using json = nlohmann::json;
@@ -256,6 +257,59 @@ namespace CircomRecursive1
     }
   }
 
+  // Loads the signals of a binary zkin; its values are canonical field elements, so they are set without parsing
+  void loadZkinImpl(Circom_CalcWit *ctx, ZkinStark &zkin)
+  {
+    if (zkin.names.size() == 0)
+    {
+      ctx->tryRunCircuit();
+    }
+    for (uint64_t s = 0; s < zkin.names.size(); s++)
+    {
+      u64 h = fnv1a(zkin.names[s]);
+      std::vector<uint64_t> &values = zkin.values[s];
+      uint signalSize = ctx->getInputSignalSize(h);
+      if (values.size() < signalSize)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << zkin.names[s] << ": Not enough values\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      if (values.size() > signalSize)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << zkin.names[s] << ": Too many values\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      for (uint i = 0; i < values.size(); i++)
+      {
+        FrGElement v;
+        if (values[i] <= INT32_MAX)
+        {
+          v.type = FrG_SHORT;
+          v.shortVal = values[i];
+        }
+        else
+        {
+          v.type = FrG_LONG;
+          v.shortVal = 0;
+          v.longVal[0] = values[i];
+        }
+        try
+        {
+          ctx->setInputSignal(h, i, v);
+        }
+        catch (std::runtime_error &e)
+        {
+          std::ostringstream errStrStream;
+          errStrStream << "Error setting signal: " << zkin.names[s] << "\n"
+                       << e.what();
+          throw std::runtime_error(errStrStream.str());
+        }
+      }
+    }
+  }
+
   void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName)
   {
     FILE *write_ptr;
@@ -314,18 +368,24 @@ namespace CircomRecursive1
     inStream.close();
     loadJsonImpl(ctx, j);
   }
-  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N)
+  // Loads either zkin or zkinBin
+  void getCommitedPolsImpl(CommitPolsStarks *commitPols, Circom_Circuit *circuit, ExecFile &exec, nlohmann::json *zkin, ZkinStark *zkinBin, uint64_t N, uint64_t maxThreads)
   {
     //-------------------------------------------
     // Verifier stark proof
     //-------------------------------------------
-    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_2);
-    Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
-    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_2);
     TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
-    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
+    // The parallel subcomponents of the circuit run in their own threads, up to maxThreads at once
+    Circom_CalcWit *ctx = new Circom_CalcWit(circuit, maxThreads);
 
-    loadJsonImpl(ctx, zkin);
+    if (zkinBin != NULL)
+    {
+      loadZkinImpl(ctx, *zkinBin);
+    }
+    else
+    {
+      loadJsonImpl(ctx, *zkin);
+    }
     if (ctx->getRemaingInputsToBeSet() != 0)
     {
       cerr << "Error: Prover::genBatchProof() Not all inputs have been set. Only " << get_main_input_signal_no() - ctx->getRemaingInputsToBeSet() << " out of " << get_main_input_signal_no() << endl;
@@ -337,9 +397,10 @@ namespace CircomRecursive1
     //-------------------------------------------
     TimerStart(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
 
-    ExecFile exec(execFile);
     uint64_t sizeWitness = get_size_of_witness();
+    assert(exec.addsChunks.size() > 0);
     Goldilocks::Element *tmp = new Goldilocks::Element[exec.nAdds + sizeWitness];
+#pragma omp parallel for
     for (uint64_t i = 0; i < sizeWitness; i++)
     {
       FrGElement aux;
@@ -348,29 +409,35 @@ namespace CircomRecursive1
       tmp[i] = Goldilocks::fromU64(aux.longVal[0]);
     }
     delete ctx;
-    for (uint64_t i = 0; i < exec.nAdds; i++)
-    {
-      FrG_toLongNormal(&exec.p_adds[i * 4], &exec.p_adds[i * 4]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 1], &exec.p_adds[i * 4 + 1]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 2], &exec.p_adds[i * 4 + 2]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 3], &exec.p_adds[i * 4 + 3]);
 
-      uint64_t idx_1 = exec.p_adds[i * 4].longVal[0];
-      uint64_t idx_2 = exec.p_adds[i * 4 + 1].longVal[0];
-
-      Goldilocks::Element c = tmp[idx_1] * Goldilocks::fromU64(exec.p_adds[i * 4 + 2].longVal[0]);
-      Goldilocks::Element d = tmp[idx_2] * Goldilocks::fromU64(exec.p_adds[i * 4 + 3].longVal[0]);
-      tmp[sizeWitness + i] = c + d;
+    // The additions of a chunk are independent, chunks are computed in order; small chunks by a single thread
+#pragma omp parallel
+    for (uint64_t k = 0; k < exec.addsChunks.size() - 1; k++)
+    {
+      if (exec.isParallelChunk(k))
+      {
+#pragma omp for
+        for (uint64_t i = exec.addsChunks[k]; i < exec.addsChunks[k + 1]; i++)
+        {
+          exec.computeAdd(tmp, sizeWitness, i);
+        }
+      }
+      else
+      {
+#pragma omp single
+        for (uint64_t i = exec.addsChunks[k]; i < exec.addsChunks[k + 1]; i++)
+        {
+          exec.computeAdd(tmp, sizeWitness, i);
+        }
+      }
     }
 
-    // #pragma omp parallel for
+#pragma omp parallel for
     for (uint i = 0; i < exec.nSMap; i++)
     {
       for (uint j = 0; j < 12; j++)
       {
-        FrGElement aux;
-        FrG_toLongNormal(&aux, &exec.p_sMap[12 * i + j]);
-        uint64_t idx_1 = aux.longVal[0];
+        uint64_t idx_1 = exec.p_sMap[12 * i + j].longVal[0];
         if (idx_1 != 0)
         {
           uint64_t idx_2 = Goldilocks::toU64(tmp[idx_1]);
@@ -382,6 +449,7 @@ namespace CircomRecursive1
         }
       }
     }
+#pragma omp parallel for
     for (uint i = exec.nSMap; i < N; i++)
     {
       for (uint j = 0; j < 12; j++)
@@ -390,8 +458,17 @@ namespace CircomRecursive1
       }
     }
     delete[] tmp;
-    freeCircuit(circuit);
     TimerStopAndLog(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
   }
 
+  void getCommitedPols(CommitPolsStarks *commitPols, Circom_Circuit *circuit, ExecFile &exec, nlohmann::json &zkin, uint64_t N, uint64_t maxThreads)
+  {
+    getCommitedPolsImpl(commitPols, circuit, exec, &zkin, NULL, N, maxThreads);
+  }
+
+  void getCommitedPols(CommitPolsStarks *commitPols, Circom_Circuit *circuit, ExecFile &exec, ZkinStark &zkin, uint64_t N, uint64_t maxThreads)
+  {
+    getCommitedPolsImpl(commitPols, circuit, exec, NULL, &zkin, N, maxThreads);
+  }
+
 }
\ No newline at end of file
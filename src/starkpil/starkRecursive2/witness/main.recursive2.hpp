@@ -11,6 +11,8 @@
 #include <iostream>
 #include <unistd.h>
 #include "commit_pols_starks.hpp"
+#include "execFile.hpp"
+#include "proof2zkinStark.hpp"
 using namespace std;
 
 namespace CircomRecursive2
@@ -20,9 +22,11 @@ namespace CircomRecursive2
     void freeCircuit(Circom_Circuit *circuit);
     void loadJson(Circom_CalcWit *ctx, std::string filename);
     void loadJsonImpl(Circom_CalcWit *ctx, json &j);
+    void loadZkinImpl(Circom_CalcWit *ctx, ZkinStark &zkin);
     void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName);
     void getBinWitness(Circom_CalcWit *ctx, FrGElement *&pWitness, uint64_t &witnessSize);
-    void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N);
+    void getCommitedPols(CommitPolsStarks *commitPols, Circom_Circuit *circuit, ExecFile &exec, nlohmann::json &zkin, uint64_t N, uint64_t maxThreads);
+    void getCommitedPols(CommitPolsStarks *commitPols, Circom_Circuit *circuit, ExecFile &exec, ZkinStark &zkin, uint64_t N, uint64_t maxThreads);
     bool check_valid_number(std::string &s, uint base);
 
 }
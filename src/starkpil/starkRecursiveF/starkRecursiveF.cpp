@@ -5,19 +5,16 @@
 #include "fr.hpp"
 #include "poseidon_opt.hpp"
 #include "starkRecursiveFSteps.hpp"
+#include "domainTables.hpp"
 
 #define NUM_CHALLENGES 8
 
 StarkRecursiveF::StarkRecursiveF(const Config &config, void *_pAddress) : config(config),
                                                          starkInfo(config, config.recursivefStarkInfo),
-                                                         zi(config.generateProof() ? starkInfo.starkStruct.nBits : 0,
-                                                            config.generateProof() ? starkInfo.starkStruct.nBitsExt : 0),
                                                          N(config.generateProof() ? 1 << starkInfo.starkStruct.nBits : 0),
                                                          NExtended(config.generateProof() ? 1 << starkInfo.starkStruct.nBitsExt : 0),
                                                          ntt(config.generateProof() ? 1 << starkInfo.starkStruct.nBits : 0),
                                                          nttExtended(config.generateProof() ? 1 << starkInfo.starkStruct.nBitsExt : 0),
-                                                         x_n(config.generateProof() ? N : 0, config.generateProof() ? 1 : 0),
-                                                         x_2ns(config.generateProof() ? NExtended : 0, config.generateProof() ? 1 : 0),
                                                          pAddress(_pAddress)
 {
     // Avoid unnecessary initialization if we are not going to generate any proof
@@ -71,29 +68,22 @@ StarkRecursiveF::StarkRecursiveF(const Config &config, void *_pAddress) : config
     }
     TimerStopAndLog(LOAD_RECURSIVE_F_CONST_TREE_TO_MEMORY);
 
-    // Initialize and allocate ConstantPols2ns
+    // ConstantPols2ns is a view of the constants tree source, which holds the extended constant polynomials
     TimerStart(LOAD_RECURSIVE_F_CONST_POLS_2NS_TO_MEMORY);
-    pConstPolsAddress2ns = (void *)calloc(starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt), sizeof(Goldilocks::Element));
+    pConstPolsAddress2ns = (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element);
     pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
-    std::memcpy(pConstPolsAddress2ns, (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element), starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element));
 
     TimerStopAndLog(LOAD_RECURSIVE_F_CONST_POLS_2NS_TO_MEMORY);
 
-    // TODO x_n and x_2ns could be precomputed
-    TimerStart(COMPUTE_X_N_AND_X_2_NS);
-    Goldilocks::Element xx = Goldilocks::one();
-    for (uint i = 0; i < N; i++)
-    {
-        *x_n[i] = xx;
-        Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBits));
-    }
-    xx = Goldilocks::shift();
-    for (uint i = 0; i < NExtended; i++)
-    {
-        *x_2ns[i] = xx;
-        Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBitsExt));
-    }
-    TimerStopAndLog(COMPUTE_X_N_AND_X_2_NS);
+    // Map the precomputed x_n, x_2ns and zhInv tables, or generate them if there is no domain tables file
+    TimerStart(LOAD_RECURSIVE_F_DOMAIN_TABLES_TO_MEMORY);
+    uint64_t nBits = starkInfo.starkStruct.nBits;
+    uint64_t nBitsExt = starkInfo.starkStruct.nBitsExt;
+    pDomainTables = DomainTables::load(config.recursivefDomainTables, config.mapConstantsTreeFile, nBits, nBitsExt, bDomainTablesMapped);
+    x_n.potConstruct(&pDomainTables[DomainTables::getXnOffset(nBits, nBitsExt)], N, 1, 1);
+    x_2ns.potConstruct(&pDomainTables[DomainTables::getX2nsOffset(nBits, nBitsExt)], NExtended, 1, 1);
+    zi = ZhInv(&pDomainTables[DomainTables::getZhInvOffset(nBits, nBitsExt)], DomainTables::getZhInvSize(nBits, nBitsExt));
+    TimerStopAndLog(LOAD_RECURSIVE_F_DOMAIN_TABLES_TO_MEMORY);
 
     mem = (Goldilocks::Element *)_pAddress;
     pBuffer = (Goldilocks::Element *)malloc(starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION * sizeof(Goldilocks::Element));
@@ -117,7 +107,7 @@ StarkRecursiveF::~StarkRecursiveF()
 
     delete pConstPols;
     delete pConstPols2ns;
-    free(pConstPolsAddress2ns);
+    DomainTables::unload(pDomainTables, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt, bDomainTablesMapped);
 
     if (config.mapConstPolsFile)
     {
@@ -265,7 +255,7 @@ void StarkRecursiveF::genProof( FRIProofC12 &proof, Goldilocks::Element publicIn
         Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].numId)]);
         Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].denId)]);
         Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited++]);
-        Polinomial::calculateZ(z, pNum, pDen);
+        Polinomial::calculateZParallel(z, pNum, pDen);
     }
 
     for (uint64_t i = 0; i < starkInfo.peCtx.size(); i++)
@@ -273,7 +263,7 @@ void StarkRecursiveF::genProof( FRIProofC12 &proof, Goldilocks::Element publicIn
         Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].numId)]);
         Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].denId)]);
         Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited++]);
-        Polinomial::calculateZ(z, pNum, pDen);
+        Polinomial::calculateZParallel(z, pNum, pDen);
     }
 
     for (uint64_t i = 0; i < starkInfo.ciCtx.size(); i++)
@@ -281,7 +271,7 @@ void StarkRecursiveF::genProof( FRIProofC12 &proof, Goldilocks::Element publicIn
         Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].numId)]);
         Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].denId)]);
         Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited++]);
-        Polinomial::calculateZ(z, pNum, pDen);
+        Polinomial::calculateZParallel(z, pNum, pDen);
     }
     TimerStopAndLog(STARK_RECURSIVE_F_STEP_3_CALCULATE_Z);
 
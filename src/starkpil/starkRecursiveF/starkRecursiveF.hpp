@@ -42,6 +42,8 @@ private:
     NTT_Goldilocks nttExtended;
     Polinomial x_n;
     Polinomial x_2ns;
+    Goldilocks::Element *pDomainTables;
+    bool bDomainTablesMapped;
     uint64_t constPolsSize;
     uint64_t constPolsDegree;
 
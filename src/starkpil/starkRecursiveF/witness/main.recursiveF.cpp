@@ -9,6 +9,7 @@
 #include <nlohmann/json.hpp>
 #include <vector>
 #include <chrono>
+#include <cassert>
 #include "main.recursiveF.hpp"
 
 using json = nlohmann::json;
@@ -314,16 +315,14 @@ namespace CircomRecursiveF
     inStream.close();
     loadJsonImpl(ctx, j);
   }
-  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N)
+  void getCommitedPols(CommitPolsStarks *commitPols, Circom_Circuit *circuit, ExecFile &exec, nlohmann::json &zkin, uint64_t N, uint64_t maxThreads)
   {
     //-------------------------------------------
     // Verifier stark proof
     //-------------------------------------------
-    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_F);
-    Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
-    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_F);
     TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
-    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
+    // The parallel subcomponents of the circuit run in their own threads, up to maxThreads at once
+    Circom_CalcWit *ctx = new Circom_CalcWit(circuit, maxThreads);
 
     loadJsonImpl(ctx, zkin);
     if (ctx->getRemaingInputsToBeSet() != 0)
@@ -337,9 +336,10 @@ namespace CircomRecursiveF
     //-------------------------------------------
     TimerStart(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
 
-    ExecFile exec(execFile);
     uint64_t sizeWitness = get_size_of_witness();
+    assert(exec.addsChunks.size() > 0);
     Goldilocks::Element *tmp = new Goldilocks::Element[exec.nAdds + sizeWitness];
+#pragma omp parallel for
     for (uint64_t i = 0; i < sizeWitness; i++)
     {
       FrGElement aux;
@@ -348,29 +348,35 @@ namespace CircomRecursiveF
       tmp[i] = Goldilocks::fromU64(aux.longVal[0]);
     }
     delete ctx;
-    for (uint64_t i = 0; i < exec.nAdds; i++)
-    {
-      FrG_toLongNormal(&exec.p_adds[i * 4], &exec.p_adds[i * 4]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 1], &exec.p_adds[i * 4 + 1]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 2], &exec.p_adds[i * 4 + 2]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 3], &exec.p_adds[i * 4 + 3]);
-
-      uint64_t idx_1 = exec.p_adds[i * 4].longVal[0];
-      uint64_t idx_2 = exec.p_adds[i * 4 + 1].longVal[0];
 
-      Goldilocks::Element c = tmp[idx_1] * Goldilocks::fromU64(exec.p_adds[i * 4 + 2].longVal[0]);
-      Goldilocks::Element d = tmp[idx_2] * Goldilocks::fromU64(exec.p_adds[i * 4 + 3].longVal[0]);
-      tmp[sizeWitness + i] = c + d;
+    // The additions of a chunk are independent, chunks are computed in order; small chunks by a single thread
+#pragma omp parallel
+    for (uint64_t k = 0; k < exec.addsChunks.size() - 1; k++)
+    {
+      if (exec.isParallelChunk(k))
+      {
+#pragma omp for
+        for (uint64_t i = exec.addsChunks[k]; i < exec.addsChunks[k + 1]; i++)
+        {
+          exec.computeAdd(tmp, sizeWitness, i);
+        }
+      }
+      else
+      {
+#pragma omp single
+        for (uint64_t i = exec.addsChunks[k]; i < exec.addsChunks[k + 1]; i++)
+        {
+          exec.computeAdd(tmp, sizeWitness, i);
+        }
+      }
     }
 
-    // #pragma omp parallel for
+#pragma omp parallel for
     for (uint i = 0; i < exec.nSMap; i++)
     {
       for (uint j = 0; j < 12; j++)
       {
-        FrGElement aux;
-        FrG_toLongNormal(&aux, &exec.p_sMap[12 * i + j]);
-        uint64_t idx_1 = aux.longVal[0];
+        uint64_t idx_1 = exec.p_sMap[12 * i + j].longVal[0];
         if (idx_1 != 0)
         {
           uint64_t idx_2 = Goldilocks::toU64(tmp[idx_1]);
@@ -382,6 +388,7 @@ namespace CircomRecursiveF
         }
       }
     }
+#pragma omp parallel for
     for (uint i = exec.nSMap; i < N; i++)
     {
       for (uint j = 0; j < 12; j++)
@@ -390,7 +397,6 @@ namespace CircomRecursiveF
       }
     }
     delete[] tmp;
-    freeCircuit(circuit);
     TimerStopAndLog(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
   }
 
@@ -11,9 +11,9 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
 
     uint64_t numCommited = starkInfo.nCm1;
     Transcript transcript;
-    Polinomial evals(N, FIELD_EXTENSION);
-    Polinomial xDivXSubXi(NExtended, FIELD_EXTENSION);
-    Polinomial xDivXSubWXi(NExtended, FIELD_EXTENSION);
+    Polinomial evals(pScratch, N, FIELD_EXTENSION, FIELD_EXTENSION);
+    Polinomial xDivXSubXi(&pScratch[getScratchOffsetXDivXSubXi(starkInfo)], NExtended, FIELD_EXTENSION, FIELD_EXTENSION);
+    Polinomial xDivXSubWXi(&pScratch[getScratchOffsetXDivXSubWXi(starkInfo)], NExtended, FIELD_EXTENSION, FIELD_EXTENSION);
     Polinomial challenges(NUM_CHALLENGES, FIELD_EXTENSION);
 
     CommitPols cmPols(pAddress, starkInfo.mapDeg.section[eSection::cm1_n]);
@@ -45,14 +45,20 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     //--------------------------------
     TimerStart(STARK_STEP_1);
     TimerStart(STARK_STEP_1_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_1_LDE);
-
-    ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
-    TimerStopAndLog(STARK_STEP_1_LDE);
-    TimerStart(STARK_STEP_1_MERKLETREE);
-    treesGL[0]->merkelize();
+    if (config.fuseLdeMerkleTree)
+    {
+        extendAndMerkelize(treesGL[0], p_cm1_2ns, p_cm1_n, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_1_LDE);
+        ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
+        TimerStopAndLog(STARK_STEP_1_LDE);
+        TimerStart(STARK_STEP_1_MERKLETREE);
+        treesGL[0]->merkelize();
+        TimerStopAndLog(STARK_STEP_1_MERKLETREE);
+    }
     treesGL[0]->getRoot(root0.address());
-    TimerStopAndLog(STARK_STEP_1_MERKLETREE);
     std::cout << "MerkleTree rootGL 0: [ " << root0.toString(4) << " ]" << std::endl;
     transcript.put(root0.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_1_LDE_AND_MERKLETREE);
@@ -67,7 +73,11 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStart(STARK_STEP_2_CALCULATE_EXPS);
 
     // Calculate exps
-    if (nrowsStepBatch > 1)
+    if (nrowsStepBatch == NROWS_STEPS_AVX512_)
+    {
+        steps->step2prev_parser_first_avx512(params, N, nrowsStepBatch);
+    }
+    else if (nrowsStepBatch > 1)
     {
         steps->step2prev_parser_first_avx(params, N, nrowsStepBatch);
     }
@@ -86,34 +96,17 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE);
     TimerStart(STARK_STEP_2_CALCULATEH1H2);
 
-    uint64_t nthreads = starkInfo.puCtx.size();
-    if (nthreads == 0)
-    {
-        nthreads += 1;
-    }
-    uint64_t buffSize = 8 * starkInfo.puCtx.size() * N;
-    assert(buffSize <= starkInfo.mapSectionsN.section[eSection::cm3_2ns] * NExtended);
+    uint64_t buffSize = starkInfo.mapSectionsN.section[eSection::cm3_2ns] * NExtended;
+    assert(Polinomial::calculateH1H2_parallelBufferSize(N) <= buffSize);
     uint64_t *mam = (uint64_t *)pAddress;
     uint64_t *pbufferH = &mam[starkInfo.mapOffsets.section[eSection::cm3_2ns]];
-    uint64_t buffSizeThread = buffSize / nthreads;
 
-#pragma omp parallel for num_threads(nthreads)
+    // Plookups one after the other, every one of them calculated by all the threads
     for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
         int indx1 = 4 * i;
-        if (transPols[indx1 + 2].dim() == 1)
-        {
-            uint64_t buffSizeThreadValues = 3 * N;
-            uint64_t buffSizeThreadKeys = buffSizeThread - buffSizeThreadValues;
-            Polinomial::calculateH1H2_opt1(transPols[indx1 + 2], transPols[indx1 + 3], transPols[indx1], transPols[indx1 + 1], i, &pbufferH[omp_get_thread_num() * buffSizeThread], buffSizeThreadKeys, buffSizeThreadValues);
-        }
-        else
-        {
-            assert(transPols[indx1 + 2].dim() == 3);
-            uint64_t buffSizeThreadValues = 5 * N;
-            uint64_t buffSizeThreadKeys = buffSizeThread - buffSizeThreadValues;
-            Polinomial::calculateH1H2_opt3(transPols[indx1 + 2], transPols[indx1 + 3], transPols[indx1], transPols[indx1 + 1], i, &pbufferH[omp_get_thread_num() * buffSizeThread], buffSizeThreadKeys, buffSizeThreadValues);
-        }
+        assert((transPols[indx1 + 2].dim() == 1) || (transPols[indx1 + 2].dim() == 3));
+        Polinomial::calculateH1H2_parallel(transPols[indx1 + 2], transPols[indx1 + 3], transPols[indx1], transPols[indx1 + 1], i, pbufferH, buffSize);
     }
     TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2);
 
@@ -122,13 +115,20 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE_2);
 
     TimerStart(STARK_STEP_2_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_2_LDE);
-    ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_2_LDE);
-    TimerStart(STARK_STEP_2_MERKLETREE);
-    treesGL[1]->merkelize();
+    if (config.fuseLdeMerkleTree)
+    {
+        extendAndMerkelize(treesGL[1], p_cm2_2ns, p_cm2_n, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_2_LDE);
+        ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_2_LDE);
+        TimerStart(STARK_STEP_2_MERKLETREE);
+        treesGL[1]->merkelize();
+        TimerStopAndLog(STARK_STEP_2_MERKLETREE);
+    }
     treesGL[1]->getRoot(root1.address());
-    TimerStopAndLog(STARK_STEP_2_MERKLETREE);
     std::cout << "MerkleTree rootGL 1: [ " << root1.toString(4) << " ]" << std::endl;
     transcript.put(root1.address(), HASH_SIZE);
 
@@ -143,7 +143,11 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     transcript.getField(challenges[3]); // betta
     TimerStart(STARK_STEP_3_CALCULATE_EXPS);
 
-    if (nrowsStepBatch > 1)
+    if (nrowsStepBatch == NROWS_STEPS_AVX512_)
+    {
+        steps->step3prev_parser_first_avx512(params, N, nrowsStepBatch);
+    }
+    else if (nrowsStepBatch > 1)
     {
         steps->step3prev_parser_first_avx(params, N, nrowsStepBatch);
     }
@@ -163,11 +167,11 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
 
     TimerStart(STARK_STEP_3_CALCULATE_Z);
     u_int64_t numpols = starkInfo.ciCtx.size() + starkInfo.peCtx.size() + starkInfo.puCtx.size();
-#pragma omp parallel for
+    // Z polynomials one after the other, every one of them calculated by all the threads
     for (uint64_t i = 0; i < numpols; i++)
     {
         int indx1 = 3 * i;
-        Polinomial::calculateZ(newpols_[indx1 + 2], newpols_[indx1], newpols_[indx1 + 1]);
+        Polinomial::calculateZParallel(newpols_[indx1 + 2], newpols_[indx1], newpols_[indx1 + 1]);
     }
     TimerStopAndLog(STARK_STEP_3_CALCULATE_Z);
     TimerStart(STARK_STEP_3_CALCULATE_Z_TRANSPOSE_2);
@@ -176,9 +180,23 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStart(STARK_STEP_3_CALCULATE_EXPS_2);
 
     // Calculate exps
-    if (nrowsStepBatch > 1)
+    if (nrowsStepBatch == NROWS_STEPS_AVX512_)
+    {
+        steps->step3_parser_first_avx512(params, N, nrowsStepBatch);
+    }
+    else if (nrowsStepBatch > 1)
     {
-        steps->step3_parser_first_avx(params, N, nrowsStepBatch);
+        // Use the straight-line kernel generated by chelpersGenerator, if any, or the interpreter otherwise
+        if (config.checkCompiledChelpers)
+        {
+            checkStepKernel(
+                "step3", "compiled", [&]() { steps->step3_parser_first_avx(params, N, nrowsStepBatch); }, [&]() { return steps->step3_parser_first_avx_compiled(params, N, nrowsStepBatch); },
+                {{p_cm3_n, N * starkInfo.mapSectionsN.section[eSection::cm3_n], false}, {&mem[starkInfo.mapOffsets.section[eSection::tmpExp_n]], N * starkInfo.mapSectionsN.section[eSection::tmpExp_n], false}});
+        }
+        else if (!steps->step3_parser_first_avx_compiled(params, N, nrowsStepBatch))
+        {
+            steps->step3_parser_first_avx(params, N, nrowsStepBatch);
+        }
     }
     else
     {
@@ -191,13 +209,20 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
 
     TimerStopAndLog(STARK_STEP_3_CALCULATE_EXPS_2);
     TimerStart(STARK_STEP_3_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_3_LDE);
-    ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_3_LDE);
-    TimerStart(STARK_STEP_3_MERKLETREE);
-    treesGL[2]->merkelize();
+    if (config.fuseLdeMerkleTree)
+    {
+        extendAndMerkelize(treesGL[2], p_cm3_2ns, p_cm3_n, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_3_LDE);
+        ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_3_LDE);
+        TimerStart(STARK_STEP_3_MERKLETREE);
+        treesGL[2]->merkelize();
+        TimerStopAndLog(STARK_STEP_3_MERKLETREE);
+    }
     treesGL[2]->getRoot(root2.address());
-    TimerStopAndLog(STARK_STEP_3_MERKLETREE);
     std::cout << "MerkleTree rootGL 2: [ " << root2.toString(4) << " ]" << std::endl;
     transcript.put(root2.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_3_LDE_AND_MERKLETREE);
@@ -209,25 +234,59 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStart(STARK_STEP_4);
     TimerStart(STARK_STEP_4_INIT);
 
-    Polinomial qq1 = Polinomial(NExtended, starkInfo.qDim, "qq1");
-    Polinomial qq2 = Polinomial(NExtended * starkInfo.qDeg, starkInfo.qDim, "qq2");
+    Polinomial qq1(&pScratch[getScratchOffsetStep(starkInfo)], NExtended, starkInfo.qDim, starkInfo.qDim, "qq1");
+    Polinomial qq2(&pScratch[getScratchOffsetStep(starkInfo) + NExtended * starkInfo.qDim], NExtended * starkInfo.qDeg, starkInfo.qDim, starkInfo.qDim, "qq2");
     transcript.getField(challenges[4]); // gamma
 
     uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
+
+    // Only the first N rows of every qq2 block are written below; the rest are the zero padding of the NTT
+    MemoryArena::parallelZero(qq2[N * starkInfo.qDeg], (NExtended - N) * starkInfo.qDeg * starkInfo.qDim * sizeof(Goldilocks::Element), scratchArena.getPageSize());
     TimerStopAndLog(STARK_STEP_4_INIT);
     TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS);
 
-    if (nrowsStepBatch > 1)
-    {
-        steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch);
-    }
-    else
+    // Evaluation of step42ns row by row, or by batches of rows
+    auto step42nsRows = [&]()
     {
-#pragma omp parallel for
-        for (uint64_t i = 0; i < NExtended; i++)
+        if (nrowsStepBatch == NROWS_STEPS_AVX512_)
+        {
+            steps->step42ns_parser_first_avx512(params, NExtended, nrowsStepBatch);
+        }
+        else if (nrowsStepBatch > 1)
+        {
+            // Use the straight-line kernel generated by chelpersGenerator, if any, or the interpreter otherwise
+            if (config.checkCompiledChelpers)
+            {
+                checkStepKernel(
+                    "step42ns", "compiled", [&]() { steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch); }, [&]() { return steps->step42ns_parser_first_avx_compiled(params, NExtended, nrowsStepBatch); },
+                    {{p_q_2ns, NExtended * starkInfo.qDim, true}});
+            }
+            else if (!steps->step42ns_parser_first_avx_compiled(params, NExtended, nrowsStepBatch))
+            {
+                steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch);
+            }
+        }
+        else
         {
-            steps->step42ns_first(params, i);
+#pragma omp parallel for
+            for (uint64_t i = 0; i < NExtended; i++)
+            {
+                steps->step42ns_first(params, i);
+            }
         }
+    };
+
+    // Evaluated by blocks of rows whose columns fit in config.step42nsTileBytes, if they fit
+    bool bTiled = (nrowsStepBatch > 1) && (config.step42nsTileBytes > 0);
+    if (bTiled && config.checkTiledStep42ns)
+    {
+        checkStepKernel(
+            "step42ns", "tiled", step42nsRows, [&]() { return steps->step42ns_parser_first_tiled(params, NExtended, nrowsStepBatch, config.step42nsTileBytes); },
+            {{p_q_2ns, NExtended * starkInfo.qDim, true}});
+    }
+    else if (!bTiled || !steps->step42ns_parser_first_tiled(params, NExtended, nrowsStepBatch, config.step42nsTileBytes))
+    {
+        step42nsRows();
     }
 
     TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS);
@@ -255,18 +314,26 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     }
     TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_MUL);
 
-    TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_NTT);
-    nttExtended.NTT(cm4_2ns, qq2.address(), NExtended, starkInfo.qDim * starkInfo.qDeg);
-    TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_NTT);
-
-    TimerStart(STARK_STEP_4_MERKLETREE);
+    if (config.fuseLdeMerkleTree)
+    {
+        TimerStart(STARK_STEP_4_NTT_AND_MERKLETREE);
+        nttAndMerkelize(treesGL[3], cm4_2ns, qq2.address(), starkInfo.qDim * starkInfo.qDeg);
+        TimerStopAndLog(STARK_STEP_4_NTT_AND_MERKLETREE);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_NTT);
+        nttExtended.NTT(cm4_2ns, qq2.address(), NExtended, starkInfo.qDim * starkInfo.qDeg);
+        TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_NTT);
+        TimerStart(STARK_STEP_4_MERKLETREE);
+        treesGL[3]->merkelize();
+        TimerStopAndLog(STARK_STEP_4_MERKLETREE);
+    }
 
-    treesGL[3]->merkelize();
     treesGL[3]->getRoot(root3.address());
     std::cout << "MerkleTree rootGL 3: [ " << root3.toString(4) << " ]" << std::endl;
     transcript.put(root3.address(), HASH_SIZE);
 
-    TimerStopAndLog(STARK_STEP_4_MERKLETREE);
     TimerStopAndLog(STARK_STEP_4);
 
     //--------------------------------
@@ -279,26 +346,21 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     // transcript.getField(challenges[6]); // v2
     transcript.getField(challenges[7]); // xi
 
-    Polinomial LEv(N, 3, "LEv");
-    Polinomial LpEv(N, 3, "LpEv");
+    // LEv and LpEv share the rows of a single polinomial, so they are transformed by one INTT and read together by evmap
+    Polinomial LEvLpEv(&pScratch[getScratchOffsetStep(starkInfo)], N, 2 * FIELD_EXTENSION, 2 * FIELD_EXTENSION, "LEvLpEv");
+    Polinomial LEv(LEvLpEv.address(), N, FIELD_EXTENSION, 2 * FIELD_EXTENSION, "LEv");
+    Polinomial LpEv(&LEvLpEv.address()[FIELD_EXTENSION], N, FIELD_EXTENSION, 2 * FIELD_EXTENSION, "LpEv");
     Polinomial xis(1, 3);
     Polinomial wxis(1, 3);
     Polinomial c_w(1, 3);
 
-    Goldilocks3::one((Goldilocks3::Element &)*LEv[0]);
-    Goldilocks3::one((Goldilocks3::Element &)*LpEv[0]);
-
     Polinomial::divElement(xis, 0, challenges, 7, (Goldilocks::Element &)Goldilocks::shift());
     Polinomial::mulElement(c_w, 0, challenges, 7, (Goldilocks::Element &)Goldilocks::w(starkInfo.starkStruct.nBits));
     Polinomial::divElement(wxis, 0, c_w, 0, (Goldilocks::Element &)Goldilocks::shift());
 
-    for (uint64_t k = 1; k < N; k++)
-    {
-        Polinomial::mulElement(LEv, k, LEv, k - 1, xis, 0);
-        Polinomial::mulElement(LpEv, k, LpEv, k - 1, wxis, 0);
-    }
-    ntt.INTT(LEv.address(), LEv.address(), N, 3);
-    ntt.INTT(LpEv.address(), LpEv.address(), N, 3);
+    Polinomial::calculatePowers(LEv, xis, 0);
+    Polinomial::calculatePowers(LpEv, wxis, 0);
+    ntt.INTT(LEvLpEv.address(), LEvLpEv.address(), N, 2 * FIELD_EXTENSION);
     TimerStopAndLog(STARK_STEP_5_LEv_LpEv);
 
     TimerStart(STARK_STEP_5_EVMAP);
@@ -339,7 +401,11 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     }
     TimerStopAndLog(STARK_STEP_5_XDIVXSUB);
     TimerStart(STARK_STEP_5_CALCULATE_EXPS);
-    if (nrowsStepBatch > 1)
+    if (nrowsStepBatch == NROWS_STEPS_AVX512_)
+    {
+        steps->step52ns_parser_first_avx512(params, NExtended, nrowsStepBatch);
+    }
+    else if (nrowsStepBatch > 1)
     {
         steps->step52ns_parser_first_avx(params, NExtended, nrowsStepBatch);
     }
@@ -368,17 +434,143 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStopAndLog(STARK_STEP_FRI);
 }
 
+void Starks::extendAndMerkelize(MerkleTreeGL *tree, Goldilocks::Element *dst, Goldilocks::Element *src, uint64_t nCols, Goldilocks::Element *buffer)
+{
+    TimerStart(STARK_LDE_AND_MERKLETREE_FUSED);
+
+    // Coefficients of the polynomials, multiplied by the powers of the shift and padded with zeros up to NExtended.
+    // dst is not written yet, so it is used as the INTT buffer
+    ntt.INTT(buffer, src, N, nCols, dst);
+
+    uint64_t blockRows = std::max((uint64_t)1, (uint64_t)LDE_MERKLE_BLOCK_SIZE / (nCols * sizeof(Goldilocks::Element)));
+#pragma omp parallel for
+    for (uint64_t b = 0; b < N; b += blockRows)
+    {
+        Goldilocks::Element r = Goldilocks::exp(Goldilocks::shift(), b);
+        for (uint64_t k = b; k < std::min(N, b + blockRows); k++)
+        {
+            for (uint64_t c = 0; c < nCols; c++)
+            {
+                buffer[k * nCols + c] = buffer[k * nCols + c] * r;
+            }
+            r = r * Goldilocks::shift();
+        }
+    }
+#pragma omp parallel for
+    for (uint64_t b = N; b < NExtended; b += blockRows)
+    {
+        std::memset(&buffer[b * nCols], 0, (std::min(NExtended, b + blockRows) - b) * nCols * sizeof(Goldilocks::Element));
+    }
+
+    nttAndMerkelize(tree, dst, buffer, nCols);
+
+    TimerStopAndLog(STARK_LDE_AND_MERKLETREE_FUSED);
+}
+
+/*
+    Evaluates the NExtended rows of coefs over the extended domain and hashes the Merkle tree leaves on the fly.
+    With R = NExtended / N, row n1 + R*n2 of coefs is seen as column block n1 of a wide row n2, so that:
+        1. One size N NTT over the R*nCols wide columns is done in place (dst is used as its buffer)
+        2. Every wide row k2 is multiplied by the twiddles w_2ns^(n1*k2)
+        3. A radix R butterfly of wide row k2 gives the extended rows k1*N + k2, for all k1 < R
+    Step 3 is done by blocks of consecutive k2, and the rows produced by each block are hashed while they are in cache.
+    The result is the same as nttExtended.NTT(dst, coefs, NExtended, nCols) followed by tree->merkelize().
+    The content of coefs is overwritten.
+*/
+void Starks::nttAndMerkelize(MerkleTreeGL *tree, Goldilocks::Element *dst, Goldilocks::Element *coefs, uint64_t nCols)
+{
+    assert(tree->source == dst);
+    assert(tree->width == nCols && tree->height == NExtended);
+
+    uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
+    uint64_t R = 1 << extendBits;
+    uint64_t rowSize = R * nCols;
+
+    ntt.NTT(coefs, coefs, N, rowSize, dst);
+
+    std::vector<Goldilocks::Element> wR(R);
+    wR[0] = Goldilocks::one();
+    for (uint64_t k = 1; k < R; k++)
+    {
+        wR[k] = wR[k - 1] * Goldilocks::w(extendBits);
+    }
+    Goldilocks::Element w2ns = Goldilocks::w(starkInfo.starkStruct.nBitsExt);
+
+    // Blocks must hold whole lower subtrees when the tree does not keep its lower levels
+    uint64_t subtreeHeight = tree->getSubtreeHeight();
+    bool hashByBlocks = subtreeHeight <= N;
+    uint64_t blockRows = std::max((uint64_t)1, (uint64_t)LDE_MERKLE_BLOCK_SIZE / (rowSize * sizeof(Goldilocks::Element)));
+    if (hashByBlocks)
+    {
+        blockRows = ((blockRows + subtreeHeight - 1) / subtreeHeight) * subtreeHeight;
+    }
+#pragma omp parallel for
+    for (uint64_t b = 0; b < N; b += blockRows)
+    {
+        uint64_t e = std::min(N, b + blockRows);
+
+        Goldilocks::Element tw = Goldilocks::exp(w2ns, b);
+        for (uint64_t k2 = b; k2 < e; k2++)
+        {
+            Goldilocks::Element *z = &coefs[k2 * rowSize];
+            Goldilocks::Element t = tw;
+            for (uint64_t n1 = 1; n1 < R; n1++)
+            {
+                for (uint64_t c = 0; c < nCols; c++)
+                {
+                    z[n1 * nCols + c] = z[n1 * nCols + c] * t;
+                }
+                t = t * tw;
+            }
+            tw = tw * w2ns;
+        }
+
+        for (uint64_t k1 = 0; k1 < R; k1++)
+        {
+            for (uint64_t k2 = b; k2 < e; k2++)
+            {
+                Goldilocks::Element *z = &coefs[k2 * rowSize];
+                Goldilocks::Element *row = &dst[(k1 * N + k2) * nCols];
+                std::memcpy(row, z, nCols * sizeof(Goldilocks::Element));
+                for (uint64_t n1 = 1; n1 < R; n1++)
+                {
+                    Goldilocks::Element w = wR[(n1 * k1) % R];
+                    for (uint64_t c = 0; c < nCols; c++)
+                    {
+                        row[c] = row[c] + w * z[n1 * nCols + c];
+                    }
+                }
+            }
+            if (hashByBlocks)
+            {
+                tree->hashLeaves(k1 * N + b, e - b);
+            }
+        }
+    }
+
+    if (hashByBlocks)
+    {
+        tree->merkelizeNodes();
+    }
+    else
+    {
+        tree->merkelize();
+    }
+}
+
 Polinomial *Starks::transposeH1H2Columns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer)
 {
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
 
     u_int64_t stride_pol0 = N * FIELD_EXTENSION + 8;
     uint64_t tot_pols0 = 4 * starkInfo.puCtx.size();
-    Polinomial *transPols = new Polinomial[tot_pols0];
+    Polinomial *transPols = transPolsH1H2;
 
     assert(starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION >= 3 * tot_pols0 * N);
 
-    // #pragma omp parallel for
+    // f and t of every plookup are gathered in a single pass; h1 and h2 are only computed in the buffer
+    std::vector<Polinomial> dst;
+    std::vector<Polinomial> src;
     for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
         Polinomial fPol = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].fExpId)]);
@@ -388,10 +580,12 @@ Polinomial *Starks::transposeH1H2Columns(void *pAddress, uint64_t &numCommited,
 
         uint64_t indx = i * 4;
         transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), fPol.degree(), fPol.dim(), fPol.dim());
-        Polinomial::copy(transPols[indx], fPol);
+        dst.push_back(transPols[indx]);
+        src.push_back(fPol);
         indx++;
         transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), tPol.degree(), tPol.dim(), tPol.dim());
-        Polinomial::copy(transPols[indx], tPol);
+        dst.push_back(transPols[indx]);
+        src.push_back(tPol);
         indx++;
 
         transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), h1.degree(), h1.dim(), h1.dim());
@@ -399,25 +593,26 @@ Polinomial *Starks::transposeH1H2Columns(void *pAddress, uint64_t &numCommited,
 
         transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), h2.degree(), h2.dim(), h2.dim());
     }
+    Polinomial::copyBlocked(dst, src);
     return transPols;
 }
 void Starks::transposeH1H2Rows(void *pAddress, uint64_t &numCommited, Polinomial *transPols)
 {
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
 
+    // h1 and h2 of every plookup are scattered into the committed section in a single pass
+    std::vector<Polinomial> dst;
+    std::vector<Polinomial> src;
     for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
         int indx1 = 4 * i + 2;
         int indx2 = 4 * i + 3;
-        Polinomial h1 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2]);
-        Polinomial h2 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2 + 1]);
-        Polinomial::copy(h1, transPols[indx1]);
-        Polinomial::copy(h2, transPols[indx2]);
-    }
-    if (starkInfo.puCtx.size() > 0)
-    {
-        delete[] transPols;
+        dst.push_back(starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2]));
+        dst.push_back(starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2 + 1]));
+        src.push_back(transPols[indx1]);
+        src.push_back(transPols[indx2]);
     }
+    Polinomial::copyBlocked(dst, src, true);
     numCommited = numCommited + starkInfo.puCtx.size() * 2;
 }
 Polinomial *Starks::transposeZColumns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer)
@@ -426,7 +621,7 @@ Polinomial *Starks::transposeZColumns(void *pAddress, uint64_t &numCommited, Gol
 
     u_int64_t stride_pol_ = N * FIELD_EXTENSION + 8; // assuming all polinomials have same degree
     uint64_t tot_pols = 3 * (starkInfo.puCtx.size() + starkInfo.peCtx.size() + starkInfo.ciCtx.size());
-    Polinomial *newpols_ = new Polinomial[tot_pols];
+    Polinomial *newpols_ = transPolsZ;
     assert(starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION >= tot_pols * stride_pol_);
 
     if (pBuffer == NULL || newpols_ == NULL)
@@ -435,200 +630,204 @@ Polinomial *Starks::transposeZColumns(void *pAddress, uint64_t &numCommited, Gol
         exit(1);
     }
 
-    // #pragma omp parallel for (better without)
+    // Numerators and denominators of plookups, permutations and connections, in this order, gathered in a single pass
+    std::vector<uint64_t> numIds;
+    std::vector<uint64_t> denIds;
     for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
-        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].numId)]);
-        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].denId)]);
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        u_int64_t indx = i * 3;
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pNum.degree(), pNum.dim(), pNum.dim());
-        Polinomial::copy(newpols_[indx], pNum);
-        indx++;
-        assert(pNum.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pDen.degree(), pDen.dim(), pDen.dim());
-        Polinomial::copy(newpols_[indx], pDen);
-        indx++;
-        assert(pDen.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), z.degree(), z.dim(), z.dim());
-        assert(z.degree() <= N);
+        numIds.push_back(starkInfo.puCtx[i].numId);
+        denIds.push_back(starkInfo.puCtx[i].denId);
     }
-    numCommited += starkInfo.puCtx.size();
-    u_int64_t offset = 3 * starkInfo.puCtx.size();
     for (uint64_t i = 0; i < starkInfo.peCtx.size(); i++)
     {
-        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].numId)]);
-        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].denId)]);
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        u_int64_t indx = 3 * i + offset;
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pNum.degree(), pNum.dim(), pNum.dim());
-        Polinomial::copy(newpols_[indx], pNum);
-        indx++;
-        assert(pNum.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pDen.degree(), pDen.dim(), pDen.dim());
-        Polinomial::copy(newpols_[indx], pDen);
-        indx++;
-        assert(pDen.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), z.degree(), z.dim(), z.dim());
-        assert(z.degree() <= N);
+        numIds.push_back(starkInfo.peCtx[i].numId);
+        denIds.push_back(starkInfo.peCtx[i].denId);
     }
-    numCommited += starkInfo.peCtx.size();
-    offset += 3 * starkInfo.peCtx.size();
     for (uint64_t i = 0; i < starkInfo.ciCtx.size(); i++)
     {
+        numIds.push_back(starkInfo.ciCtx[i].numId);
+        denIds.push_back(starkInfo.ciCtx[i].denId);
+    }
 
-        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].numId)]);
-        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].denId)]);
+    std::vector<Polinomial> dst;
+    std::vector<Polinomial> src;
+    for (uint64_t i = 0; i < numIds.size(); i++)
+    {
+        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(numIds[i])]);
+        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(denIds[i])]);
         Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        u_int64_t indx = 3 * i + offset;
-
+        u_int64_t indx = i * 3;
         newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pNum.degree(), pNum.dim(), pNum.dim());
-        Polinomial::copy(newpols_[indx], pNum);
+        dst.push_back(newpols_[indx]);
+        src.push_back(pNum);
         indx++;
         assert(pNum.degree() <= N);
 
         newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pDen.degree(), pDen.dim(), pDen.dim());
-        Polinomial::copy(newpols_[indx], pDen);
+        dst.push_back(newpols_[indx]);
+        src.push_back(pDen);
         indx++;
         assert(pDen.degree() <= N);
 
         newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), z.degree(), z.dim(), z.dim());
         assert(z.degree() <= N);
     }
-    numCommited += starkInfo.ciCtx.size();
-    numCommited -= starkInfo.ciCtx.size() + starkInfo.peCtx.size() + starkInfo.puCtx.size();
+    Polinomial::copyBlocked(dst, src);
     return newpols_;
 }
 void Starks::transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *transPols)
 {
     u_int64_t numpols = starkInfo.ciCtx.size() + starkInfo.peCtx.size() + starkInfo.puCtx.size();
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
+
+    // Every z is scattered into the committed section in a single pass
+    std::vector<Polinomial> dst;
+    std::vector<Polinomial> src;
     for (uint64_t i = 0; i < numpols; i++)
     {
         int indx1 = 3 * i;
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        Polinomial::copy(z, transPols[indx1 + 2]);
-    }
-    if (numpols > 0)
-    {
-        delete[] transPols;
+        dst.push_back(starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]));
+        src.push_back(transPols[indx1 + 2]);
     }
+    Polinomial::copyBlocked(dst, src, true);
 }
+// Computes all the openings in one pass over the rows: every thread accumulates the openings of a block of rows,
+// reading the columns of every row in address order, i.e. section by section
 void Starks::evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv)
 {
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
     uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
     u_int64_t size_eval = starkInfo.evMap.size();
-    // Order polinomials by address, note that there are collisions!
-    map<uintptr_t, vector<uint>> map_offsets;
+
+    // Column of every opening, ordered by address; note that there are collisions!
+    vector<EvMapColumn> columns(size_eval);
     for (uint64_t i = 0; i < size_eval; i++)
     {
         EvMap ev = starkInfo.evMap[i];
+        Polinomial pol;
         if (ev.type == EvMap::eType::_const)
         {
-            map_offsets[reinterpret_cast<std::uintptr_t>(&((Goldilocks::Element *)pConstPols2ns->address())[ev.id])].push_back(i);
+            pol.potConstruct(&((Goldilocks::Element *)pConstPols2ns->address())[ev.id], pConstPols2ns->degree(), 1, pConstPols2ns->numPols());
         }
         else if (ev.type == EvMap::eType::cm)
         {
-            Polinomial pol = starkInfo.getPolinomial(mem, starkInfo.cm_2ns[ev.id]);
-            map_offsets[reinterpret_cast<std::uintptr_t>(pol.address())].push_back(i);
+            pol = starkInfo.getPolinomial(mem, starkInfo.cm_2ns[ev.id]);
         }
         else if (ev.type == EvMap::eType::q)
         {
-            Polinomial pol = starkInfo.getPolinomial(mem, starkInfo.qs[ev.id]);
-            map_offsets[reinterpret_cast<std::uintptr_t>(pol.address())].push_back(i);
+            pol = starkInfo.getPolinomial(mem, starkInfo.qs[ev.id]);
         }
         else
         {
             throw std::invalid_argument("Invalid ev type: " + ev.type);
         }
+        columns[i].address = pol.address();
+        columns[i].offset = pol.offset() << extendBits;
+        columns[i].dim = pol.dim();
+        columns[i].prime = ev.prime;
+        columns[i].index = i;
     }
-    Polinomial *ordPols = new Polinomial[size_eval];
-    vector<bool> isPrime(size_eval);
-    vector<uint> indx(size_eval);
-    //   build and store ordered polinomials that need to be computed
-    uint kk = 0;
-    for (std::map<uintptr_t, std::vector<uint>>::const_iterator it = map_offsets.begin(); it != map_offsets.end(); ++it)
-    {
-        for (std::vector<uint>::const_iterator it2 = it->second.begin(); it2 != it->second.end(); ++it2)
-        {
-            EvMap ev = starkInfo.evMap[*it2];
-            if (ev.type == EvMap::eType::_const)
-            {
-                ordPols[kk].potConstruct(&((Goldilocks::Element *)pConstPols2ns->address())[ev.id], pConstPols2ns->degree(), 1, pConstPols2ns->numPols());
-            }
-            else if (ev.type == EvMap::eType::cm)
-            {
-                ordPols[kk] = starkInfo.getPolinomial(mem, starkInfo.cm_2ns[ev.id]);
-            }
-            else if (ev.type == EvMap::eType::q)
-            {
-                ordPols[kk] = starkInfo.getPolinomial(mem, starkInfo.qs[ev.id]);
-            }
-            isPrime[kk] = ev.prime;
-            indx[kk] = *it2;
-            ++kk;
-        }
-    }
-    assert(kk == size_eval);
-    // Build buffer for partial results of the matrix-vector product (columns distribution)  .
+    std::stable_sort(columns.begin(), columns.end(), [](const EvMapColumn &a, const EvMapColumn &b)
+                     { return a.address < b.address; });
+
+    // Partial results of every thread, reduced at the end
     int num_threads = omp_get_max_threads();
-    Goldilocks::Element **evals_acc = (Goldilocks::Element **)malloc(num_threads * sizeof(Goldilocks::Element *));
-    for (int i = 0; i < num_threads; ++i)
+    Goldilocks::Element *evals_acc = (Goldilocks::Element *)calloc(num_threads * size_eval * FIELD_EXTENSION, sizeof(Goldilocks::Element));
+    if (evals_acc == NULL)
     {
-        evals_acc[i] = (Goldilocks::Element *)malloc(size_eval * FIELD_EXTENSION * sizeof(Goldilocks::Element));
+        cerr << "Error: Starks::evmap() failed calling calloc() of size " << num_threads * size_eval * FIELD_EXTENSION * sizeof(Goldilocks::Element) << endl;
+        exit(-1);
     }
 #pragma omp parallel
     {
-        int thread_idx = omp_get_thread_num();
-        for (uint64_t i = 0; i < size_eval * FIELD_EXTENSION; ++i)
-        {
-            evals_acc[thread_idx][i] = Goldilocks::zero();
-        }
-#pragma omp for
+        Goldilocks::Element *acc = &evals_acc[omp_get_thread_num() * size_eval * FIELD_EXTENSION];
+#pragma omp for schedule(static)
         for (uint64_t k = 0; k < N; k++)
         {
-            Goldilocks::Element *LpEv_ = &(LpEv[k][0]);
-            Goldilocks::Element *LEv_ = &(LEv[k][0]);
+            Goldilocks::Element *LEv_ = LEv[k];
+            Goldilocks::Element *LpEv_ = LpEv[k];
             for (uint64_t i = 0; i < size_eval; i++)
             {
-                Polinomial::mulAddElement_adim3(&(evals_acc[thread_idx][i * FIELD_EXTENSION]), isPrime[i] ? LpEv_ : LEv_, ordPols[i], k << extendBits);
+                EvMapColumn &column = columns[i];
+                Polinomial::mulAddElement_adim3(&acc[i * FIELD_EXTENSION], column.prime ? LpEv_ : LEv_, &column.address[k * column.offset], column.dim);
             }
         }
 #pragma omp for
         for (uint64_t i = 0; i < size_eval; ++i)
         {
-            Goldilocks::Element sum0 = Goldilocks::zero();
-            Goldilocks::Element sum1 = Goldilocks::zero();
-            Goldilocks::Element sum2 = Goldilocks::zero();
-            int offset = i * FIELD_EXTENSION;
-            for (int k = 0; k < num_threads; ++k)
+            Goldilocks::Element sum[FIELD_EXTENSION] = {Goldilocks::zero(), Goldilocks::zero(), Goldilocks::zero()};
+            for (int t = 0; t < num_threads; ++t)
             {
-                sum0 = sum0 + evals_acc[k][offset];
-                sum1 = sum1 + evals_acc[k][offset + 1];
-                sum2 = sum2 + evals_acc[k][offset + 2];
+                Goldilocks::Element *acc_t = &evals_acc[(t * size_eval + i) * FIELD_EXTENSION];
+                sum[0] = sum[0] + acc_t[0];
+                sum[1] = sum[1] + acc_t[1];
+                sum[2] = sum[2] + acc_t[2];
             }
-            evals_acc[0][offset] = sum0;
-            evals_acc[0][offset + 1] = sum1;
-            evals_acc[0][offset + 2] = sum2;
+            evals[columns[i].index][0] = sum[0];
+            evals[columns[i].index][1] = sum[1];
+            evals[columns[i].index][2] = sum[2];
         }
-#pragma omp single
-        for (uint64_t i = 0; i < size_eval; ++i)
+    }
+    free(evals_acc);
+}
+
+void Starks::checkStepKernel(const string &step, const string &kernel, std::function<void(void)> reference, std::function<bool(void)> candidate, const vector<StepKernelOutput> &outputs)
+{
+    /*
+        The outputs are restored to their values before the reference kernel ran, so an element that the reference kernel
+        changes and the checked kernel does not write keeps its old value, which differs from the expected one. The outputs
+        that the step does not read are filled with a sentinel first; the rest may hold inputs of the step, e.g. other
+        columns of the same section, and keep their values
+    */
+    Goldilocks::Element sentinel = Goldilocks::fromU64(0x5A5A5A5A5A5A5A5AULL);
+    vector<vector<Goldilocks::Element>> before(outputs.size());
+    for (uint64_t i = 0; i < outputs.size(); i++)
+    {
+        if (outputs[i].bOnlyOutput)
         {
-            int offset = i * FIELD_EXTENSION;
-            (evals[indx[i]])[0] = evals_acc[0][offset];
-            (evals[indx[i]])[1] = evals_acc[0][offset + 1];
-            (evals[indx[i]])[2] = evals_acc[0][offset + 2];
+            std::fill(outputs[i].pAddress, outputs[i].pAddress + outputs[i].size, sentinel);
         }
+        before[i].assign(outputs[i].pAddress, outputs[i].pAddress + outputs[i].size);
     }
-    delete[] ordPols;
-    for (int i = 0; i < num_threads; ++i)
+
+    reference();
+    vector<vector<Goldilocks::Element>> expected(outputs.size());
+    uint64_t nWritten = 0;
+    for (uint64_t i = 0; i < outputs.size(); i++)
     {
-        free(evals_acc[i]);
+        expected[i].assign(outputs[i].pAddress, outputs[i].pAddress + outputs[i].size);
+        for (uint64_t j = 0; j < outputs[i].size; j++)
+        {
+            if (Goldilocks::toU64(expected[i][j]) != Goldilocks::toU64(before[i][j]))
+            {
+                nWritten++;
+            }
+        }
+        std::memcpy(outputs[i].pAddress, before[i].data(), outputs[i].size * sizeof(Goldilocks::Element));
     }
-    free(evals_acc);
+
+    if (!candidate())
+    {
+        // Keep the outputs of the reference kernel
+        for (uint64_t i = 0; i < outputs.size(); i++)
+        {
+            std::memcpy(outputs[i].pAddress, expected[i].data(), outputs[i].size * sizeof(Goldilocks::Element));
+        }
+        cout << "Starks::checkStepKernel() found no " << kernel << " kernel of " << step << " to check" << endl;
+        return;
+    }
+
+    for (uint64_t i = 0; i < outputs.size(); i++)
+    {
+        for (uint64_t j = 0; j < outputs[i].size; j++)
+        {
+            if (Goldilocks::toU64(outputs[i].pAddress[j]) != Goldilocks::toU64(expected[i][j]))
+            {
+                cerr << "Error: Starks::checkStepKernel() found that the " << kernel << " " << step << " writes " << Goldilocks::toString(outputs[i].pAddress[j]) << " instead of " << Goldilocks::toString(expected[i][j]) << " at element " << j << " of output " << i
+                     << ((Goldilocks::toU64(outputs[i].pAddress[j]) == Goldilocks::toU64(before[i][j])) ? ", which it does not write" : "") << endl;
+                exit(-1);
+            }
+        }
+    }
+    cout << "Starks::checkStepKernel() checked that the " << kernel << " " << step << " writes the same " << nWritten << " elements as the reference one" << endl;
 }
@@ -2,6 +2,7 @@
 #define STARKS_HPP
 
 #include <algorithm>
+#include <functional>
 #include "config.hpp"
 #include "utils.hpp"
 #include "timer.hpp"
@@ -11,10 +12,13 @@
 #include "friProve.hpp"
 #include "transcript.hpp"
 #include "zhInv.hpp"
+#include "domainTables.hpp"
 #include "steps.hpp"
+#include "memory_arena.hpp"
 
 #define STARK_C12_A_NUM_TREES 5
 #define NUM_CHALLENGES 8
+#define LDE_MERKLE_BLOCK_SIZE (1 << 18) // Bytes of extended rows produced, and hashed, per block when config.fuseLdeMerkleTree is set
 
 struct StarkFiles
 {
@@ -22,6 +26,25 @@ struct StarkFiles
     bool mapConstPolsFile;
     std::string zkevmConstantsTree;
     std::string zkevmStarkInfo;
+    std::string zkevmDomainTables;
+};
+
+// Column read by an opening of the evMap
+struct EvMapColumn
+{
+    Goldilocks::Element *address; // Element of the column in the first row
+    uint64_t offset;              // Distance between consecutive rows of the basic domain
+    uint64_t dim;
+    bool prime;
+    uint64_t index; // Position of the opening in the evMap
+};
+
+// Buffer written by a step, checked by Starks::checkStepKernel()
+struct StepKernelOutput
+{
+    Goldilocks::Element *pAddress;
+    uint64_t size;
+    bool bOnlyOutput; // The step does not read it, so it is filled with a sentinel before the reference kernel runs
 };
 
 class Starks
@@ -66,20 +89,25 @@ private:
 
     Polinomial x;
 
+    Goldilocks::Element *pDomainTables;
+    bool bDomainTablesMapped;
+
+    // Temporaries of genProof, allocated once and reused by every proof
+    MemoryArena scratchArena;
+    Goldilocks::Element *pScratch;
+    uint64_t scratchSize; // In elements
+    Polinomial *transPolsH1H2;
+    Polinomial *transPolsZ;
+
 public:
     Starks(const Config &config, StarkFiles starkFiles, void *_pAddress) : config(config),
                                                                            starkInfo(config, starkFiles.zkevmStarkInfo),
                                                                            starkFiles(starkFiles),
-                                                                           zi(config.generateProof() ? starkInfo.starkStruct.nBits : 0,
-                                                                              config.generateProof() ? starkInfo.starkStruct.nBitsExt : 0),
                                                                            N(config.generateProof() ? 1 << starkInfo.starkStruct.nBits : 0),
                                                                            NExtended(config.generateProof() ? 1 << starkInfo.starkStruct.nBitsExt : 0),
                                                                            ntt(config.generateProof() ? 1 << starkInfo.starkStruct.nBits : 0),
                                                                            nttExtended(config.generateProof() ? 1 << starkInfo.starkStruct.nBitsExt : 0),
-                                                                           x_n(config.generateProof() ? N : 0, config.generateProof() ? 1 : 0),
-                                                                           x_2ns(config.generateProof() ? NExtended : 0, config.generateProof() ? 1 : 0),
-                                                                           pAddress(_pAddress),
-                                                                           x(config.generateProof() ? N << (starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits) : 0, config.generateProof() ? FIELD_EXTENSION : 0)
+                                                                           pAddress(_pAddress)
     {
         nrowsStepBatch = 1;
         // Avoid unnecessary initialization if we are not going to generate any proof
@@ -132,29 +160,23 @@ public:
         }
         TimerStopAndLog(LOAD_CONST_TREE_TO_MEMORY);
 
-        // Initialize and allocate ConstantPols2ns
+        // ConstantPols2ns is a view of the constants tree source, which holds the extended constant polynomials
         TimerStart(LOAD_CONST_POLS_2NS_TO_MEMORY);
-        pConstPolsAddress2ns = (void *)calloc(starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt), sizeof(Goldilocks::Element));
+        pConstPolsAddress2ns = (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element);
         pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
-        std::memcpy(pConstPolsAddress2ns, (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element), starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element));
 
         TimerStopAndLog(LOAD_CONST_POLS_2NS_TO_MEMORY);
 
-        // TODO x_n and x_2ns could be precomputed
-        TimerStart(COMPUTE_X_N_AND_X_2_NS);
-        Goldilocks::Element xx = Goldilocks::one();
-        for (uint64_t i = 0; i < N; i++)
-        {
-            *x_n[i] = xx;
-            Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBits));
-        }
-        xx = Goldilocks::shift();
-        for (uint64_t i = 0; i < NExtended; i++)
-        {
-            *x_2ns[i] = xx;
-            Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBitsExt));
-        }
-        TimerStopAndLog(COMPUTE_X_N_AND_X_2_NS);
+        // Map the precomputed x_n, x_2ns, x and zhInv tables, or generate them if there is no domain tables file
+        TimerStart(LOAD_DOMAIN_TABLES_TO_MEMORY);
+        uint64_t nBits = starkInfo.starkStruct.nBits;
+        uint64_t nBitsExt = starkInfo.starkStruct.nBitsExt;
+        pDomainTables = DomainTables::load(starkFiles.zkevmDomainTables, config.mapConstantsTreeFile, nBits, nBitsExt, bDomainTablesMapped);
+        x_n.potConstruct(&pDomainTables[DomainTables::getXnOffset(nBits, nBitsExt)], N, 1, 1);
+        x_2ns.potConstruct(&pDomainTables[DomainTables::getX2nsOffset(nBits, nBitsExt)], NExtended, 1, 1);
+        x.potConstruct(&pDomainTables[DomainTables::getXOffset(nBits, nBitsExt)], NExtended, FIELD_EXTENSION, FIELD_EXTENSION);
+        zi = ZhInv(&pDomainTables[DomainTables::getZhInvOffset(nBits, nBitsExt)], DomainTables::getZhInvSize(nBits, nBitsExt));
+        TimerStopAndLog(LOAD_DOMAIN_TABLES_TO_MEMORY);
 
         mem = (Goldilocks::Element *)pAddress;
         pBuffer = &mem[starkInfo.mapTotalN];
@@ -169,22 +191,21 @@ public:
         p_q_2ns = &mem[starkInfo.mapOffsets.section[eSection::q_2ns]];
         p_f_2ns = &mem[starkInfo.mapOffsets.section[eSection::f_2ns]];
 
-        *x[0] = Goldilocks::shift();
-
-        uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
-
-        for (uint64_t k = 1; k < (N << extendBits); k++)
-        {
-            Polinomial::mulElement(x, k, x, k - 1, (Goldilocks::Element &)Goldilocks::w(starkInfo.starkStruct.nBits + extendBits));
-        }
-
         TimerStart(MERKLE_TREE_ALLOCATION);
-        treesGL[0] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm1_2ns);
-        treesGL[1] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm2_n], p_cm2_2ns);
-        treesGL[2] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm3_n], p_cm3_2ns);
-        treesGL[3] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm4_2ns], cm4_2ns);
+        treesGL[0] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm1_2ns, config.merkleTreeKeptLevels);
+        treesGL[1] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm2_n], p_cm2_2ns, config.merkleTreeKeptLevels);
+        treesGL[2] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm3_n], p_cm3_2ns, config.merkleTreeKeptLevels);
+        treesGL[3] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm4_2ns], cm4_2ns, config.merkleTreeKeptLevels);
         treesGL[4] = new MerkleTreeGL((Goldilocks::Element *)pConstTreeAddress);
         TimerStopAndLog(MERKLE_TREE_ALLOCATION);
+
+        TimerStart(SCRATCH_ALLOCATION);
+        scratchSize = getScratchSize(starkInfo);
+        pScratch = (Goldilocks::Element *)scratchArena.allocate(scratchSize * sizeof(Goldilocks::Element), config.cmPolsHugePages, config.cmPolsNumaPolicy);
+        transPolsH1H2 = new Polinomial[4 * starkInfo.puCtx.size()];
+        transPolsZ = new Polinomial[3 * (starkInfo.puCtx.size() + starkInfo.peCtx.size() + starkInfo.ciCtx.size())];
+        cout << "Starks::Starks() allocated " << scratchSize * sizeof(Goldilocks::Element) << " bytes of scratch memory" << endl;
+        TimerStopAndLog(SCRATCH_ALLOCATION);
     };
     ~Starks()
     {
@@ -193,7 +214,7 @@ public:
 
         delete pConstPols;
         delete pConstPols2ns;
-        free(pConstPolsAddress2ns);
+        DomainTables::unload(pDomainTables, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt, bDomainTablesMapped);
 
         if (config.mapConstPolsFile)
         {
@@ -216,15 +237,40 @@ public:
         {
             delete treesGL[i];
         }
+
+        delete[] transPolsH1H2;
+        delete[] transPolsZ;
+    };
+
+    /*
+        Scratch memory layout, in elements:
+            evals, xDivXSubXi and xDivXSubWXi, used during the whole proof
+            qq1 and qq2 in step 4, reused by LEv and LpEv in step 5
+    */
+    static uint64_t getScratchOffsetXDivXSubXi(StarkInfo &starkInfo) { return (1 << starkInfo.starkStruct.nBits) * FIELD_EXTENSION; };
+    static uint64_t getScratchOffsetXDivXSubWXi(StarkInfo &starkInfo) { return getScratchOffsetXDivXSubXi(starkInfo) + (1 << starkInfo.starkStruct.nBitsExt) * FIELD_EXTENSION; };
+    static uint64_t getScratchOffsetStep(StarkInfo &starkInfo) { return getScratchOffsetXDivXSubWXi(starkInfo) + (1 << starkInfo.starkStruct.nBitsExt) * FIELD_EXTENSION; };
+    static uint64_t getScratchSize(StarkInfo &starkInfo)
+    {
+        uint64_t qqSize = (1 << starkInfo.starkStruct.nBitsExt) * starkInfo.qDim * (1 + starkInfo.qDeg);
+        uint64_t LEvLpEvSize = (1 << starkInfo.starkStruct.nBits) * 2 * FIELD_EXTENSION;
+        return getScratchOffsetStep(starkInfo) + std::max(qqSize, LEvLpEvSize);
     };
 
     void genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps *steps);
 
+    void extendAndMerkelize(MerkleTreeGL *tree, Goldilocks::Element *dst, Goldilocks::Element *src, uint64_t nCols, Goldilocks::Element *buffer);
+    void nttAndMerkelize(MerkleTreeGL *tree, Goldilocks::Element *dst, Goldilocks::Element *coefs, uint64_t nCols);
+
     Polinomial *transposeH1H2Columns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer);
     void transposeH1H2Rows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
     Polinomial *transposeZColumns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer);
     void transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
     void evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv);
+
+    // Runs the reference kernel of a step and then another kernel of it, e.g. the compiled or the tiled one, if available,
+    // and exits if they write different outputs
+    void checkStepKernel(const string &step, const string &kernel, std::function<void(void)> reference, std::function<bool(void)> candidate, const vector<StepKernelOutput> &outputs);
 };
 
 #endif // STARKS_H
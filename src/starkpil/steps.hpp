@@ -1,6 +1,8 @@
 #ifndef STEPS_HPP
 #define STEPS_HPP
 
+#define NROWS_STEPS_AVX512_ 8 // rows per batch of the *_parser_first_avx512() steps
+
 struct StepsParams
 {
     Goldilocks::Element *pols;
@@ -25,25 +27,32 @@ public:
     virtual void step2prev_i(StepsParams &params, uint64_t i) = 0;
     virtual void step2prev_last(StepsParams &params, uint64_t i) = 0;
     virtual void step2prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step2prev_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
 
     virtual void step3prev_first(StepsParams &params, uint64_t i) = 0;
     virtual void step3prev_i(StepsParams &params, uint64_t i) = 0;
     virtual void step3prev_last(StepsParams &params, uint64_t i) = 0;
     virtual void step3prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step3prev_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
 
     virtual void step3_first(StepsParams &params, uint64_t i) = 0;
     virtual void step3_i(StepsParams &params, uint64_t i) = 0;
     virtual void step3_last(StepsParams &params, uint64_t i) = 0;
     virtual void step3_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step3_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step3_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step3_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual bool step3_parser_first_avx_compiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { return false; }; // false if not generated
 
     virtual void step42ns_first(StepsParams &params, uint64_t i) = 0;
     virtual void step42ns_i(StepsParams &params, uint64_t i) = 0;
     virtual void step42ns_last(StepsParams &params, uint64_t i) = 0;
     virtual void step42ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step42ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step42ns_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual bool step42ns_parser_first_avx_compiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { return false; }; // false if not generated
+    virtual bool step42ns_parser_first_tiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch, uint64_t tileBytes) { return false; }; // false if not supported
 
     virtual void step52ns_first(StepsParams &params, uint64_t i) = 0;
     virtual void step52ns_i(StepsParams &params, uint64_t i) = 0;
@@ -51,6 +60,7 @@ public:
 
     virtual void step52ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step52ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step52ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
 };
 
 #endif // STEPS
@@ -19,6 +19,9 @@ public:
 
     ZhInv(uint64_t nBits, uint64_t nBitsExt);
 
+    // Loads the size precomputed inverses, e.g. from a domain tables file
+    ZhInv(const Goldilocks::Element *zhInv, uint64_t size) : ZHInv(zhInv, zhInv + size){};
+
     inline Goldilocks::Element zhInv(int64_t i)
     {
         return ZHInv[i % ZHInv.size()];
@@ -4,7 +4,7 @@
 #define NTEMP3_ 2
 
 
-uint64_t op2prev[NOPS_] = { 79, 79, 59, 88, 82, 82, 59, 88, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 88, 82, 82, 59, 88, 79, 100, 82, 100, 79, 100, 82, 100, 79, 100, 82, 100, 81, 79, 79, 79, 79, 81, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 5, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 79, 100, 82, 100, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 90, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 79, 82, 79, 79, 82, 79, 59, 12, 70, 88, 82, 59, 12, 70, 12, 44, 61, 89, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 1, 96, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 35, 35, 21, 47, 35, 0, 10, 78, 100, 32, 78, 22, 45, 87, 79, 100, 82, 100, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 50, 50, 0, 1, 50, 46, 53, 0, 50, 0, 53, 0, 0, 78, 79, 50, 1, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 54, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89};
+inline uint64_t op2prev[NOPS_] = { 79, 79, 59, 88, 82, 82, 59, 88, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 88, 82, 82, 59, 88, 79, 100, 82, 100, 79, 100, 82, 100, 79, 100, 82, 100, 81, 79, 79, 79, 79, 81, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 5, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 79, 100, 82, 100, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 90, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 79, 82, 79, 79, 82, 79, 59, 12, 70, 88, 82, 59, 12, 70, 12, 44, 61, 89, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 1, 96, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 35, 35, 21, 47, 35, 0, 10, 78, 100, 32, 78, 22, 45, 87, 79, 100, 82, 100, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 50, 50, 0, 1, 50, 46, 53, 0, 50, 0, 53, 0, 0, 78, 79, 50, 1, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 54, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89};
 
 
-uint64_t args2prev[NARGS_] = { 0, 1, 665, 1, 0, 665, 0, 0, 0, 9814671379, 265, 1, 0, 0, 3, 1, 2, 0, 0, 0, 9814671382, 265, 1, 0, 0, 46, 1, 54, 1, 8388608, 665, 2, 3, 1, 8388608, 665, 3, 4, 1, 8388608, 665, 4, 45, 665, 5, 2, 665, 6, 46, 665, 7, 47, 665, 8, 48, 665, 9, 49, 665, 10, 50, 665, 11, 51, 665, 12, 52, 665, 13, 53, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671385, 265, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 265, 13, 0, 0, 58, 665, 5, 1, 59, 665, 6, 2, 0, 1, 0, 60, 665, 7, 1, 2, 0, 0, 61, 665, 8, 2, 1, 0, 0, 62, 665, 9, 1, 2, 0, 0, 63, 665, 10, 2, 1, 0, 0, 64, 665, 11, 1, 2, 0, 0, 65, 665, 12, 2, 1, 0, 0, 66, 665, 13, 1, 2, 0, 0, 67, 665, 14, 2, 1, 0, 0, 68, 665, 15, 1, 2, 0, 0, 69, 665, 16, 2, 1, 0, 0, 70, 665, 17, 1, 2, 0, 0, 71, 665, 18, 2, 1, 0, 0, 72, 665, 19, 1, 2, 0, 0, 73, 665, 20, 2, 1, 0, 0, 74, 665, 21, 1, 2, 0, 0, 75, 665, 22, 2, 1, 0, 0, 76, 665, 23, 1, 2, 0, 0, 77, 665, 24, 2, 1, 0, 0, 78, 665, 25, 1, 2, 0, 0, 79, 665, 26, 2, 1, 0, 0, 80, 665, 27, 1, 2, 0, 0, 81, 665, 28, 2, 1, 0, 0, 82, 665, 29, 1, 2, 0, 0, 83, 665, 30, 2, 1, 0, 0, 84, 665, 31, 1, 2, 0, 0, 85, 665, 32, 2, 1, 0, 0, 86, 665, 33, 1, 2, 0, 0, 87, 665, 34, 2, 1, 0, 0, 88, 665, 35, 1, 2, 0, 0, 89, 665, 36, 2, 1, 0, 9814671360, 265, 2, 0, 4, 9814671361, 265, 0, 0, 90, 665, 5, 1, 91, 665, 6, 2, 0, 1, 0, 92, 665, 7, 1, 2, 0, 0, 93, 665, 8, 2, 1, 0, 0, 94, 665, 9, 1, 2, 0, 0, 95, 665, 10, 2, 1, 0, 0, 96, 665, 11, 1, 2, 0, 0, 97, 665, 12, 2, 1, 0, 0, 98, 665, 13, 1, 2, 0, 0, 99, 665, 14, 2, 1, 0, 0, 100, 665, 15, 1, 2, 0, 0, 101, 665, 16, 2, 1, 0, 0, 102, 665, 17, 1, 2, 0, 0, 103, 665, 18, 2, 1, 0, 0, 104, 665, 19, 1, 2, 0, 0, 105, 665, 20, 2, 1, 0, 0, 106, 665, 21, 1, 2, 0, 0, 107, 665, 22, 2, 1, 0, 0, 108, 665, 23, 1, 2, 0, 0, 109, 665, 24, 2, 1, 0, 0, 110, 665, 25, 1, 2, 0, 0, 111, 665, 26, 2, 1, 0, 0, 112, 665, 27, 1, 2, 0, 0, 113, 665, 28, 2, 1, 0, 0, 114, 665, 29, 1, 2, 0, 0, 115, 665, 30, 2, 1, 0, 0, 116, 665, 31, 1, 2, 0, 0, 117, 665, 32, 2, 1, 0, 0, 118, 665, 33, 1, 2, 0, 0, 119, 665, 34, 2, 1, 0, 0, 120, 665, 35, 1, 2, 0, 0, 121, 665, 36, 2, 1, 0, 9814671362, 265, 2, 0, 4, 9814671363, 265, 0, 0, 122, 665, 5, 1, 123, 665, 6, 2, 0, 1, 0, 124, 665, 7, 1, 2, 0, 0, 125, 665, 8, 2, 1, 0, 0, 126, 665, 9, 1, 2, 0, 0, 127, 665, 10, 2, 1, 0, 0, 128, 665, 11, 1, 2, 0, 0, 129, 665, 12, 2, 1, 0, 0, 130, 665, 13, 1, 2, 0, 0, 131, 665, 14, 2, 1, 0, 0, 132, 665, 15, 1, 2, 0, 0, 133, 665, 16, 2, 1, 0, 0, 134, 665, 17, 1, 2, 0, 0, 135, 665, 18, 2, 1, 0, 0, 136, 665, 19, 1, 2, 0, 0, 137, 665, 20, 2, 1, 0, 0, 138, 665, 21, 1, 2, 0, 0, 139, 665, 22, 2, 1, 0, 0, 140, 665, 23, 1, 2, 0, 0, 141, 665, 24, 2, 1, 0, 0, 142, 665, 25, 1, 2, 0, 0, 143, 665, 26, 2, 1, 0, 0, 144, 665, 27, 1, 2, 0, 0, 145, 665, 28, 2, 1, 0, 0, 146, 665, 29, 1, 2, 0, 0, 147, 665, 30, 2, 1, 0, 0, 148, 665, 31, 1, 2, 0, 0, 149, 665, 32, 2, 1, 0, 0, 150, 665, 33, 1, 2, 0, 0, 151, 665, 34, 2, 1, 0, 0, 152, 665, 35, 1, 2, 0, 0, 153, 665, 36, 2, 1, 0, 9814671364, 265, 2, 0, 4, 9814671365, 265, 0, 0, 154, 665, 5, 1, 155, 665, 6, 2, 0, 1, 0, 156, 665, 7, 1, 2, 0, 0, 157, 665, 8, 2, 1, 0, 0, 158, 665, 9, 1, 2, 0, 0, 159, 665, 10, 2, 1, 0, 0, 160, 665, 11, 1, 2, 0, 0, 161, 665, 12, 2, 1, 0, 0, 162, 665, 13, 1, 2, 0, 0, 163, 665, 14, 2, 1, 0, 0, 164, 665, 15, 1, 2, 0, 0, 165, 665, 16, 2, 1, 0, 0, 166, 665, 17, 1, 2, 0, 0, 167, 665, 18, 2, 1, 0, 0, 168, 665, 19, 1, 2, 0, 0, 169, 665, 20, 2, 1, 0, 0, 170, 665, 21, 1, 2, 0, 0, 171, 665, 22, 2, 1, 0, 0, 172, 665, 23, 1, 2, 0, 0, 173, 665, 24, 2, 1, 0, 0, 174, 665, 25, 1, 2, 0, 0, 175, 665, 26, 2, 1, 0, 0, 176, 665, 27, 1, 2, 0, 0, 177, 665, 28, 2, 1, 0, 0, 178, 665, 29, 1, 2, 0, 0, 179, 665, 30, 2, 1, 0, 0, 180, 665, 31, 1, 2, 0, 0, 181, 665, 32, 2, 1, 0, 0, 182, 665, 33, 1, 2, 0, 0, 183, 665, 34, 2, 1, 0, 0, 184, 665, 35, 1, 2, 0, 0, 186, 665, 36, 2, 1, 0, 9814671366, 265, 2, 0, 4, 9814671367, 265, 0, 0, 34, 35, 3, 0, 36, 0, 187, 665, 5, 1, 188, 665, 6, 2, 0, 1, 0, 189, 665, 7, 1, 2, 0, 0, 190, 665, 8, 2, 1, 0, 0, 191, 665, 9, 1, 2, 0, 0, 192, 665, 10, 2, 1, 0, 0, 193, 665, 11, 1, 2, 0, 0, 194, 665, 12, 2, 1, 0, 0, 195, 665, 13, 1, 2, 0, 0, 196, 665, 14, 2, 1, 0, 0, 197, 665, 15, 1, 2, 0, 0, 198, 665, 16, 2, 1, 0, 0, 199, 665, 17, 1, 2, 0, 0, 200, 665, 18, 2, 1, 0, 0, 202, 665, 19, 1, 2, 0, 0, 203, 665, 20, 2, 1, 0, 0, 204, 665, 21, 1, 2, 0, 0, 205, 665, 22, 2, 1, 0, 0, 206, 665, 23, 1, 2, 0, 0, 207, 665, 24, 2, 1, 0, 0, 208, 665, 25, 1, 2, 0, 0, 209, 665, 26, 2, 1, 0, 0, 210, 665, 27, 1, 2, 0, 0, 211, 665, 28, 2, 1, 0, 0, 212, 665, 29, 1, 2, 0, 0, 213, 665, 30, 2, 1, 0, 0, 214, 665, 31, 1, 2, 0, 0, 215, 665, 32, 2, 1, 0, 0, 216, 665, 33, 1, 2, 0, 0, 185, 665, 34, 2, 1, 0, 0, 201, 665, 35, 1, 2, 0, 0, 217, 665, 36, 2, 1, 0, 0, 3, 0, 9814671391, 265, 2, 0, 0, 106, 1, 105, 0, 0, 0, 9814671394, 265, 1, 0, 0, 225, 665, 9814671368, 265, 0, 0, 107, 9814671369, 265, 0, 0, 226, 665, 9814671370, 265, 0, 0, 107, 9814671371, 265, 0, 0, 227, 665, 9814671372, 265, 0, 0, 107, 9814671373, 265, 0, 0, 0ULL, 1, 258, 665, 2, 228, 665, 3, 230, 665, 4, 259, 665, 5, 0ULL, 6, 232, 665, 7, 260, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671397, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 265, 7, 0, 0, 266, 1, 8388608, 665, 265, 1, 8388608, 665, 1, 258, 665, 2, 229, 665, 3, 231, 665, 4, 260, 665, 5, 264, 665, 6, 233, 665, 7, 261, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671403, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 265, 7, 0, 0, 294, 665, 9814671374, 265, 0, 0, 2, 9814671375, 265, 0, 0, 296, 665, 297, 665, 2, 1ULL, 0, 0, 2, 298, 665, 6652166188, 371, 0, 146, 0, 2, 298, 665, 1, 1ULL, 0, 0, 1, 294, 665, 1, 0, 2, 0, 128ULL, 6652166188, 371, 6652166189, 371, 1, 0, 0, 6652166189, 371, 138, 1, 0, 286, 665, 17, 1, 0, 6652166189, 371, 139, 1, 0, 287, 665, 18, 1, 0, 6652166189, 371, 140, 1, 0, 288, 665, 19, 1, 0, 6652166189, 371, 141, 1, 0, 289, 665, 20, 1, 0, 6652166189, 371, 142, 1, 0, 290, 665, 21, 1, 0, 6652166189, 371, 143, 1, 0, 291, 665, 22, 1, 0, 6652166189, 371, 144, 1, 0, 292, 665, 23, 1, 0, 6652166189, 371, 145, 1, 0, 293, 665, 24, 1, 25, 305, 665, 26, 306, 665, 27, 307, 665, 28, 308, 665, 29, 301, 665, 30, 302, 665, 31, 303, 665, 32, 304, 665, 0, 267, 665, 1, 268, 665, 2, 269, 665, 3, 270, 665, 4, 271, 665, 5, 272, 665, 6, 273, 665, 7, 274, 665, 8, 275, 665, 9, 276, 665, 10, 277, 665, 11, 278, 665, 12, 279, 665, 13, 280, 665, 14, 281, 665, 15, 282, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 265, 1, 1, 0, 146, 0, 17, 0, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 1, 9814671409, 265, 1, 0, 0, 6652166365, 371, 9814671409, 265, 1, 0, 311, 665, 1, 314, 665, 2, 315, 665, 3, 316, 665, 4, 317, 665, 5, 318, 665, 6, 319, 665, 7, 320, 665, 8, 321, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671412, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 265, 8, 0, 0, 397, 665, 1, 398, 665, 2, 400, 665, 3, 399, 665, 4, 401, 665, 5, 402, 665, 6, 403, 665, 7, 404, 665, 8, 405, 665, 9, 406, 665, 10, 407, 665, 11, 408, 665, 12, 409, 665, 13, 410, 665, 14, 411, 665, 15, 375, 665, 16, 384, 665, 17, 377, 665, 18, 376, 665, 19, 381, 665, 20, 382, 665, 21, 383, 665, 22, 380, 665, 23, 378, 665, 24, 379, 665, 25, 385, 665, 26, 386, 665, 27, 387, 665, 28, 396, 665, 29, 389, 665, 30, 388, 665, 31, 393, 665, 32, 395, 665, 33, 394, 665, 34, 392, 665, 35, 391, 665, 36, 390, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671418, 265, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 265, 36, 0, 0, 188, 1, 414, 665, 2, 418, 665, 3, 422, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671424, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 265, 3, 0, 0, 188, 1, 415, 665, 2, 419, 665, 3, 423, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671430, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 265, 3, 0, 0, 188, 1, 416, 665, 2, 420, 665, 3, 424, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671436, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 265, 3, 0, 0, 188, 1, 417, 665, 2, 421, 665, 3, 425, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671442, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 265, 3, 0, 0, 443, 665, 444, 665, 9, 1ULL, 0, 0, 9, 445, 665, 6652166200, 371, 0, 213, 0, 9, 445, 665, 1, 1ULL, 0, 0, 1, 440, 665, 1, 0, 9, 0, 128ULL, 6652166200, 371, 6652166202, 371, 1, 0, 3, 6652166202, 371, 4, 212, 5, 441, 665, 0, 430, 665, 1, 195, 2, 431, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 265, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 9814671451, 265, 1, 0, 0, 9814671448, 265, 9814671451, 265, 1, 10, 449, 665, 11, 450, 665, 12, 451, 665, 13, 452, 665, 14, 453, 665, 15, 454, 665, 16, 455, 665, 17, 456, 665, 18, 216, 0, 432, 665, 1, 433, 665, 2, 434, 665, 3, 435, 665, 4, 436, 665, 5, 437, 665, 6, 438, 665, 7, 439, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 265, 8, 0, 0, 9, 445, 665, 6652166201, 371, 0, 214, 0, 6652166201, 371, 0, 10, 0, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 9814671457, 265, 1, 0, 0, 9814671454, 265, 9814671457, 265, 1, 0, 458, 665, 1, 461, 665, 2, 462, 665, 3, 463, 665, 4, 464, 665, 5, 465, 665, 6, 466, 665, 7, 467, 665, 8, 468, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671460, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 265, 8, 0, 0, 477, 1, 8388608, 665, 477, 665, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 489, 665, 2, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 45, 1ULL, 1, 0, 9814671376, 265, 1, 0, 1ULL, 1, 1, 0, 0, 2, 9814671376, 265, 2, 0, 1, 6652166220, 371, 2, 9814671376, 265, 0, 641, 665, 9814671377, 265, 0, 0, 45, 9814671378, 265, 0, 3, 553, 665, 4, 552, 665, 5, 551, 665, 6, 550, 665, 7, 549, 665, 8, 548, 665, 9, 547, 665, 10, 546, 665, 11, 562, 665, 12, 563, 665, 13, 564, 665, 14, 565, 665, 15, 566, 665, 16, 567, 665, 17, 568, 665, 18, 569, 665, 19, 570, 665, 20, 571, 665, 21, 572, 665, 22, 573, 665, 23, 576, 665, 24, 574, 665, 25, 575, 665, 26, 577, 665, 27, 634, 665, 28, 635, 665, 29, 637, 665, 30, 636, 665, 31, 639, 665, 32, 638, 665, 0, 1ULL, 607, 665, 1, 2ULL, 608, 665, 2, 0, 1, 0, 4ULL, 609, 665, 1, 2, 0, 0, 8ULL, 623, 665, 2, 1, 0, 0, 16ULL, 621, 665, 1, 2, 0, 0, 32ULL, 613, 665, 2, 1, 0, 0, 64ULL, 616, 665, 1, 2, 0, 0, 128ULL, 615, 665, 2, 1, 0, 0, 256ULL, 617, 665, 1, 2, 0, 0, 512ULL, 620, 665, 2, 1, 0, 0, 1024ULL, 619, 665, 1, 2, 0, 0, 2048ULL, 599, 665, 2, 1, 0, 0, 4096ULL, 600, 665, 1, 2, 0, 0, 8192ULL, 598, 665, 2, 1, 0, 0, 16384ULL, 597, 665, 1, 2, 0, 0, 32768ULL, 591, 665, 2, 1, 0, 0, 65536ULL, 593, 665, 1, 2, 0, 0, 131072ULL, 592, 665, 2, 1, 0, 0, 262144ULL, 610, 665, 1, 2, 0, 0, 524288ULL, 611, 665, 2, 1, 0, 0, 1048576ULL, 612, 665, 1, 2, 0, 0, 2097152ULL, 603, 665, 2, 1, 0, 0, 4194304ULL, 604, 665, 1, 2, 0, 0, 8388608ULL, 624, 665, 2, 1, 0, 0, 16777216ULL, 578, 665, 1, 2, 0, 0, 33554432ULL, 579, 665, 2, 1, 0, 0, 67108864ULL, 580, 665, 1, 2, 0, 0, 134217728ULL, 584, 665, 2, 1, 0, 0, 268435456ULL, 581, 665, 1, 2, 0, 0, 536870912ULL, 582, 665, 2, 1, 0, 0, 1073741824ULL, 587, 665, 1, 2, 0, 0, 2147483648ULL, 589, 665, 2, 1, 0, 0, 4294967296ULL, 586, 665, 1, 2, 0, 0, 8589934592ULL, 590, 665, 2, 1, 0, 0, 17179869184ULL, 588, 665, 1, 2, 0, 0, 34359738368ULL, 585, 665, 2, 1, 0, 0, 68719476736ULL, 583, 665, 1, 2, 0, 0, 137438953472ULL, 606, 665, 2, 1, 0, 0, 274877906944ULL, 605, 665, 1, 2, 0, 0, 549755813888ULL, 601, 665, 2, 1, 0, 0, 1099511627776ULL, 655, 665, 1, 2, 0, 0, 2199023255552ULL, 594, 665, 2, 1, 0, 0, 4398046511104ULL, 625, 665, 1, 2, 0, 0, 8796093022208ULL, 626, 665, 2, 1, 0, 0, 17592186044416ULL, 614, 665, 1, 2, 0, 0, 35184372088832ULL, 618, 665, 2, 1, 0, 0, 70368744177664ULL, 656, 665, 1, 2, 0, 0, 1, 1, 595, 665, 2, 596, 665, 33, 622, 665, 34, 653, 665, 35, 654, 665, 36, 542, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671466, 265, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 265, 36, 0, 0, 599, 665, 529, 665, 1, 600, 665, 543, 665, 2, 0, 1, 3, 2, 595, 665, 0, 601, 665, 538, 665, 1, 262144ULL, 0, 0, 65536ULL, 597, 665, 2, 1, 0, 0, 597, 665, 539, 665, 1, 2, 0, 0, 131072ULL, 598, 665, 2, 1, 0, 24, 2, 3, 13, 24, 14, 544, 665, 0, 521, 665, 613, 665, 15, 0, 614, 665, 0, 497, 665, 562, 665, 1, 505, 665, 563, 665, 2, 0, 1, 0, 513, 665, 564, 665, 1, 2, 0, 0, 506, 665, 565, 665, 2, 1, 0, 0, 521, 665, 566, 665, 1, 2, 0, 0, 529, 665, 567, 665, 2, 1, 0, 0, 561, 665, 569, 665, 1, 2, 0, 0, 537, 665, 568, 665, 2, 1, 0, 0, 538, 665, 570, 665, 1, 2, 0, 0, 539, 665, 571, 665, 2, 1, 0, 0, 540, 665, 572, 665, 1, 2, 0, 0, 541, 665, 573, 665, 2, 1, 0, 0, 574, 665, 45, 1, 2, 0, 0, 543, 665, 575, 665, 2, 1, 0, 0, 544, 665, 576, 665, 1, 2, 0, 0, 628, 665, 634, 665, 2, 1, 0, 0, 629, 665, 635, 665, 1, 2, 0, 0, 630, 665, 636, 665, 2, 1, 0, 0, 631, 665, 637, 665, 1, 2, 0, 0, 632, 665, 638, 665, 2, 1, 0, 0, 633, 665, 639, 665, 1, 2, 0, 0, 545, 665, 577, 665, 2, 1, 0, 25, 2, 553, 665, 16, 25, 0, 496, 665, 562, 665, 1, 504, 665, 563, 665, 2, 0, 1, 0, 512, 665, 564, 665, 1, 2, 0, 0, 513, 665, 565, 665, 2, 1, 0, 0, 520, 665, 566, 665, 1, 2, 0, 0, 528, 665, 567, 665, 2, 1, 0, 0, 536, 665, 568, 665, 1, 2, 0, 0, 560, 665, 569, 665, 2, 1, 0, 26, 2, 552, 665, 17, 26, 0, 495, 665, 562, 665, 1, 503, 665, 563, 665, 2, 0, 1, 0, 511, 665, 564, 665, 1, 2, 0, 0, 512, 665, 565, 665, 2, 1, 0, 0, 519, 665, 566, 665, 1, 2, 0, 0, 527, 665, 567, 665, 2, 1, 0, 0, 535, 665, 568, 665, 1, 2, 0, 0, 559, 665, 569, 665, 2, 1, 0, 27, 2, 551, 665, 18, 27, 0, 494, 665, 562, 665, 1, 502, 665, 563, 665, 2, 0, 1, 0, 510, 665, 564, 665, 1, 2, 0, 0, 511, 665, 565, 665, 2, 1, 0, 0, 518, 665, 566, 665, 1, 2, 0, 0, 526, 665, 567, 665, 2, 1, 0, 0, 534, 665, 568, 665, 1, 2, 0, 0, 558, 665, 569, 665, 2, 1, 0, 28, 2, 550, 665, 19, 28, 0, 493, 665, 562, 665, 1, 501, 665, 563, 665, 2, 0, 1, 0, 509, 665, 564, 665, 1, 2, 0, 0, 510, 665, 565, 665, 2, 1, 0, 0, 517, 665, 566, 665, 1, 2, 0, 0, 525, 665, 567, 665, 2, 1, 0, 0, 533, 665, 568, 665, 1, 2, 0, 0, 557, 665, 569, 665, 2, 1, 0, 29, 2, 549, 665, 20, 29, 0, 492, 665, 562, 665, 1, 500, 665, 563, 665, 2, 0, 1, 0, 508, 665, 564, 665, 1, 2, 0, 0, 509, 665, 565, 665, 2, 1, 0, 0, 516, 665, 566, 665, 1, 2, 0, 0, 524, 665, 567, 665, 2, 1, 0, 0, 532, 665, 568, 665, 1, 2, 0, 0, 556, 665, 569, 665, 2, 1, 0, 30, 2, 548, 665, 21, 30, 0, 491, 665, 562, 665, 1, 499, 665, 563, 665, 2, 0, 1, 0, 507, 665, 564, 665, 1, 2, 0, 0, 508, 665, 565, 665, 2, 1, 0, 0, 515, 665, 566, 665, 1, 2, 0, 0, 523, 665, 567, 665, 2, 1, 0, 0, 531, 665, 568, 665, 1, 2, 0, 0, 555, 665, 569, 665, 2, 1, 0, 31, 2, 547, 665, 22, 31, 0, 490, 665, 562, 665, 1, 498, 665, 563, 665, 2, 0, 1, 0, 506, 665, 564, 665, 1, 2, 0, 0, 507, 665, 565, 665, 2, 1, 0, 0, 514, 665, 566, 665, 1, 2, 0, 0, 522, 665, 567, 665, 2, 1, 0, 0, 530, 665, 568, 665, 1, 2, 0, 0, 554, 665, 569, 665, 2, 1, 0, 32, 2, 546, 665, 23, 32, 2, 442, 665, 0, 448, 665, 443, 665, 1, 0, 459, 665, 3, 1, 1ULL, 4, 459, 665, 0, 461, 665, 6652166202, 371, 6652166203, 371, 0, 469, 665, 5, 6652166203, 371, 0, 462, 665, 6652166202, 371, 6652166204, 371, 0, 470, 665, 6, 6652166204, 371, 0, 463, 665, 6652166202, 371, 6652166205, 371, 0, 471, 665, 7, 6652166205, 371, 0, 464, 665, 6652166202, 371, 6652166206, 371, 0, 472, 665, 8, 6652166206, 371, 0, 465, 665, 6652166202, 371, 6652166207, 371, 0, 473, 665, 9, 6652166207, 371, 0, 466, 665, 6652166202, 371, 6652166208, 371, 0, 474, 665, 10, 6652166208, 371, 0, 467, 665, 6652166202, 371, 6652166209, 371, 0, 475, 665, 11, 6652166209, 371, 0, 468, 665, 6652166202, 371, 6652166210, 371, 0, 476, 665, 12, 6652166210, 371, 0, 458, 665, 460, 665, 1, 1ULL, 0, 6652166218, 371, 1, 215, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 371, 0, 9814671472, 265, 1, 1, 0, 613, 665, 614, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671472, 265, 1, 0, 0, 6652166368, 371, 9814671472, 265, 1, 13, 24, 14, 544, 665, 0, 521, 665, 617, 665, 15, 0, 618, 665, 16, 25, 17, 26, 18, 27, 19, 28, 20, 29, 21, 30, 22, 31, 23, 32, 2, 295, 665, 0, 310, 665, 296, 665, 1, 0, 312, 665, 3, 1, 1ULL, 4, 312, 665, 0, 314, 665, 6652166189, 371, 6652166190, 371, 0, 322, 665, 5, 6652166190, 371, 0, 315, 665, 6652166189, 371, 6652166191, 371, 0, 323, 665, 6, 6652166191, 371, 0, 316, 665, 6652166189, 371, 6652166192, 371, 0, 324, 665, 7, 6652166192, 371, 0, 317, 665, 6652166189, 371, 6652166193, 371, 0, 325, 665, 8, 6652166193, 371, 0, 318, 665, 6652166189, 371, 6652166194, 371, 0, 326, 665, 9, 6652166194, 371, 0, 319, 665, 6652166189, 371, 6652166195, 371, 0, 327, 665, 10, 6652166195, 371, 0, 320, 665, 6652166189, 371, 6652166196, 371, 0, 328, 665, 11, 6652166196, 371, 0, 321, 665, 6652166189, 371, 6652166197, 371, 0, 329, 665, 12, 6652166197, 371, 0, 311, 665, 313, 665, 1, 1ULL, 0, 6652166219, 371, 1, 147, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 371, 0, 9814671475, 265, 1, 1, 0, 617, 665, 618, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671475, 265, 1, 0, 0, 6652166371, 371, 9814671475, 265, 1};
+inline uint64_t args2prev[NARGS_] = { 0, 1, 665, 1, 0, 665, 0, 0, 0, 9814671379, 265, 1, 0, 0, 3, 1, 2, 0, 0, 0, 9814671382, 265, 1, 0, 0, 46, 1, 54, 1, 8388608, 665, 2, 3, 1, 8388608, 665, 3, 4, 1, 8388608, 665, 4, 45, 665, 5, 2, 665, 6, 46, 665, 7, 47, 665, 8, 48, 665, 9, 49, 665, 10, 50, 665, 11, 51, 665, 12, 52, 665, 13, 53, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671385, 265, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 265, 13, 0, 0, 58, 665, 5, 1, 59, 665, 6, 2, 0, 1, 0, 60, 665, 7, 1, 2, 0, 0, 61, 665, 8, 2, 1, 0, 0, 62, 665, 9, 1, 2, 0, 0, 63, 665, 10, 2, 1, 0, 0, 64, 665, 11, 1, 2, 0, 0, 65, 665, 12, 2, 1, 0, 0, 66, 665, 13, 1, 2, 0, 0, 67, 665, 14, 2, 1, 0, 0, 68, 665, 15, 1, 2, 0, 0, 69, 665, 16, 2, 1, 0, 0, 70, 665, 17, 1, 2, 0, 0, 71, 665, 18, 2, 1, 0, 0, 72, 665, 19, 1, 2, 0, 0, 73, 665, 20, 2, 1, 0, 0, 74, 665, 21, 1, 2, 0, 0, 75, 665, 22, 2, 1, 0, 0, 76, 665, 23, 1, 2, 0, 0, 77, 665, 24, 2, 1, 0, 0, 78, 665, 25, 1, 2, 0, 0, 79, 665, 26, 2, 1, 0, 0, 80, 665, 27, 1, 2, 0, 0, 81, 665, 28, 2, 1, 0, 0, 82, 665, 29, 1, 2, 0, 0, 83, 665, 30, 2, 1, 0, 0, 84, 665, 31, 1, 2, 0, 0, 85, 665, 32, 2, 1, 0, 0, 86, 665, 33, 1, 2, 0, 0, 87, 665, 34, 2, 1, 0, 0, 88, 665, 35, 1, 2, 0, 0, 89, 665, 36, 2, 1, 0, 9814671360, 265, 2, 0, 4, 9814671361, 265, 0, 0, 90, 665, 5, 1, 91, 665, 6, 2, 0, 1, 0, 92, 665, 7, 1, 2, 0, 0, 93, 665, 8, 2, 1, 0, 0, 94, 665, 9, 1, 2, 0, 0, 95, 665, 10, 2, 1, 0, 0, 96, 665, 11, 1, 2, 0, 0, 97, 665, 12, 2, 1, 0, 0, 98, 665, 13, 1, 2, 0, 0, 99, 665, 14, 2, 1, 0, 0, 100, 665, 15, 1, 2, 0, 0, 101, 665, 16, 2, 1, 0, 0, 102, 665, 17, 1, 2, 0, 0, 103, 665, 18, 2, 1, 0, 0, 104, 665, 19, 1, 2, 0, 0, 105, 665, 20, 2, 1, 0, 0, 106, 665, 21, 1, 2, 0, 0, 107, 665, 22, 2, 1, 0, 0, 108, 665, 23, 1, 2, 0, 0, 109, 665, 24, 2, 1, 0, 0, 110, 665, 25, 1, 2, 0, 0, 111, 665, 26, 2, 1, 0, 0, 112, 665, 27, 1, 2, 0, 0, 113, 665, 28, 2, 1, 0, 0, 114, 665, 29, 1, 2, 0, 0, 115, 665, 30, 2, 1, 0, 0, 116, 665, 31, 1, 2, 0, 0, 117, 665, 32, 2, 1, 0, 0, 118, 665, 33, 1, 2, 0, 0, 119, 665, 34, 2, 1, 0, 0, 120, 665, 35, 1, 2, 0, 0, 121, 665, 36, 2, 1, 0, 9814671362, 265, 2, 0, 4, 9814671363, 265, 0, 0, 122, 665, 5, 1, 123, 665, 6, 2, 0, 1, 0, 124, 665, 7, 1, 2, 0, 0, 125, 665, 8, 2, 1, 0, 0, 126, 665, 9, 1, 2, 0, 0, 127, 665, 10, 2, 1, 0, 0, 128, 665, 11, 1, 2, 0, 0, 129, 665, 12, 2, 1, 0, 0, 130, 665, 13, 1, 2, 0, 0, 131, 665, 14, 2, 1, 0, 0, 132, 665, 15, 1, 2, 0, 0, 133, 665, 16, 2, 1, 0, 0, 134, 665, 17, 1, 2, 0, 0, 135, 665, 18, 2, 1, 0, 0, 136, 665, 19, 1, 2, 0, 0, 137, 665, 20, 2, 1, 0, 0, 138, 665, 21, 1, 2, 0, 0, 139, 665, 22, 2, 1, 0, 0, 140, 665, 23, 1, 2, 0, 0, 141, 665, 24, 2, 1, 0, 0, 142, 665, 25, 1, 2, 0, 0, 143, 665, 26, 2, 1, 0, 0, 144, 665, 27, 1, 2, 0, 0, 145, 665, 28, 2, 1, 0, 0, 146, 665, 29, 1, 2, 0, 0, 147, 665, 30, 2, 1, 0, 0, 148, 665, 31, 1, 2, 0, 0, 149, 665, 32, 2, 1, 0, 0, 150, 665, 33, 1, 2, 0, 0, 151, 665, 34, 2, 1, 0, 0, 152, 665, 35, 1, 2, 0, 0, 153, 665, 36, 2, 1, 0, 9814671364, 265, 2, 0, 4, 9814671365, 265, 0, 0, 154, 665, 5, 1, 155, 665, 6, 2, 0, 1, 0, 156, 665, 7, 1, 2, 0, 0, 157, 665, 8, 2, 1, 0, 0, 158, 665, 9, 1, 2, 0, 0, 159, 665, 10, 2, 1, 0, 0, 160, 665, 11, 1, 2, 0, 0, 161, 665, 12, 2, 1, 0, 0, 162, 665, 13, 1, 2, 0, 0, 163, 665, 14, 2, 1, 0, 0, 164, 665, 15, 1, 2, 0, 0, 165, 665, 16, 2, 1, 0, 0, 166, 665, 17, 1, 2, 0, 0, 167, 665, 18, 2, 1, 0, 0, 168, 665, 19, 1, 2, 0, 0, 169, 665, 20, 2, 1, 0, 0, 170, 665, 21, 1, 2, 0, 0, 171, 665, 22, 2, 1, 0, 0, 172, 665, 23, 1, 2, 0, 0, 173, 665, 24, 2, 1, 0, 0, 174, 665, 25, 1, 2, 0, 0, 175, 665, 26, 2, 1, 0, 0, 176, 665, 27, 1, 2, 0, 0, 177, 665, 28, 2, 1, 0, 0, 178, 665, 29, 1, 2, 0, 0, 179, 665, 30, 2, 1, 0, 0, 180, 665, 31, 1, 2, 0, 0, 181, 665, 32, 2, 1, 0, 0, 182, 665, 33, 1, 2, 0, 0, 183, 665, 34, 2, 1, 0, 0, 184, 665, 35, 1, 2, 0, 0, 186, 665, 36, 2, 1, 0, 9814671366, 265, 2, 0, 4, 9814671367, 265, 0, 0, 34, 35, 3, 0, 36, 0, 187, 665, 5, 1, 188, 665, 6, 2, 0, 1, 0, 189, 665, 7, 1, 2, 0, 0, 190, 665, 8, 2, 1, 0, 0, 191, 665, 9, 1, 2, 0, 0, 192, 665, 10, 2, 1, 0, 0, 193, 665, 11, 1, 2, 0, 0, 194, 665, 12, 2, 1, 0, 0, 195, 665, 13, 1, 2, 0, 0, 196, 665, 14, 2, 1, 0, 0, 197, 665, 15, 1, 2, 0, 0, 198, 665, 16, 2, 1, 0, 0, 199, 665, 17, 1, 2, 0, 0, 200, 665, 18, 2, 1, 0, 0, 202, 665, 19, 1, 2, 0, 0, 203, 665, 20, 2, 1, 0, 0, 204, 665, 21, 1, 2, 0, 0, 205, 665, 22, 2, 1, 0, 0, 206, 665, 23, 1, 2, 0, 0, 207, 665, 24, 2, 1, 0, 0, 208, 665, 25, 1, 2, 0, 0, 209, 665, 26, 2, 1, 0, 0, 210, 665, 27, 1, 2, 0, 0, 211, 665, 28, 2, 1, 0, 0, 212, 665, 29, 1, 2, 0, 0, 213, 665, 30, 2, 1, 0, 0, 214, 665, 31, 1, 2, 0, 0, 215, 665, 32, 2, 1, 0, 0, 216, 665, 33, 1, 2, 0, 0, 185, 665, 34, 2, 1, 0, 0, 201, 665, 35, 1, 2, 0, 0, 217, 665, 36, 2, 1, 0, 0, 3, 0, 9814671391, 265, 2, 0, 0, 106, 1, 105, 0, 0, 0, 9814671394, 265, 1, 0, 0, 225, 665, 9814671368, 265, 0, 0, 107, 9814671369, 265, 0, 0, 226, 665, 9814671370, 265, 0, 0, 107, 9814671371, 265, 0, 0, 227, 665, 9814671372, 265, 0, 0, 107, 9814671373, 265, 0, 0, 0ULL, 1, 258, 665, 2, 228, 665, 3, 230, 665, 4, 259, 665, 5, 0ULL, 6, 232, 665, 7, 260, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671397, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 265, 7, 0, 0, 266, 1, 8388608, 665, 265, 1, 8388608, 665, 1, 258, 665, 2, 229, 665, 3, 231, 665, 4, 260, 665, 5, 264, 665, 6, 233, 665, 7, 261, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671403, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 265, 7, 0, 0, 294, 665, 9814671374, 265, 0, 0, 2, 9814671375, 265, 0, 0, 296, 665, 297, 665, 2, 1ULL, 0, 0, 2, 298, 665, 6652166188, 371, 0, 146, 0, 2, 298, 665, 1, 1ULL, 0, 0, 1, 294, 665, 1, 0, 2, 0, 128ULL, 6652166188, 371, 6652166189, 371, 1, 0, 0, 6652166189, 371, 138, 1, 0, 286, 665, 17, 1, 0, 6652166189, 371, 139, 1, 0, 287, 665, 18, 1, 0, 6652166189, 371, 140, 1, 0, 288, 665, 19, 1, 0, 6652166189, 371, 141, 1, 0, 289, 665, 20, 1, 0, 6652166189, 371, 142, 1, 0, 290, 665, 21, 1, 0, 6652166189, 371, 143, 1, 0, 291, 665, 22, 1, 0, 6652166189, 371, 144, 1, 0, 292, 665, 23, 1, 0, 6652166189, 371, 145, 1, 0, 293, 665, 24, 1, 25, 305, 665, 26, 306, 665, 27, 307, 665, 28, 308, 665, 29, 301, 665, 30, 302, 665, 31, 303, 665, 32, 304, 665, 0, 267, 665, 1, 268, 665, 2, 269, 665, 3, 270, 665, 4, 271, 665, 5, 272, 665, 6, 273, 665, 7, 274, 665, 8, 275, 665, 9, 276, 665, 10, 277, 665, 11, 278, 665, 12, 279, 665, 13, 280, 665, 14, 281, 665, 15, 282, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 265, 1, 1, 0, 146, 0, 17, 0, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 1, 9814671409, 265, 1, 0, 0, 6652166365, 371, 9814671409, 265, 1, 0, 311, 665, 1, 314, 665, 2, 315, 665, 3, 316, 665, 4, 317, 665, 5, 318, 665, 6, 319, 665, 7, 320, 665, 8, 321, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671412, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 265, 8, 0, 0, 397, 665, 1, 398, 665, 2, 400, 665, 3, 399, 665, 4, 401, 665, 5, 402, 665, 6, 403, 665, 7, 404, 665, 8, 405, 665, 9, 406, 665, 10, 407, 665, 11, 408, 665, 12, 409, 665, 13, 410, 665, 14, 411, 665, 15, 375, 665, 16, 384, 665, 17, 377, 665, 18, 376, 665, 19, 381, 665, 20, 382, 665, 21, 383, 665, 22, 380, 665, 23, 378, 665, 24, 379, 665, 25, 385, 665, 26, 386, 665, 27, 387, 665, 28, 396, 665, 29, 389, 665, 30, 388, 665, 31, 393, 665, 32, 395, 665, 33, 394, 665, 34, 392, 665, 35, 391, 665, 36, 390, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671418, 265, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 265, 36, 0, 0, 188, 1, 414, 665, 2, 418, 665, 3, 422, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671424, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 265, 3, 0, 0, 188, 1, 415, 665, 2, 419, 665, 3, 423, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671430, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 265, 3, 0, 0, 188, 1, 416, 665, 2, 420, 665, 3, 424, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671436, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 265, 3, 0, 0, 188, 1, 417, 665, 2, 421, 665, 3, 425, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671442, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 265, 3, 0, 0, 443, 665, 444, 665, 9, 1ULL, 0, 0, 9, 445, 665, 6652166200, 371, 0, 213, 0, 9, 445, 665, 1, 1ULL, 0, 0, 1, 440, 665, 1, 0, 9, 0, 128ULL, 6652166200, 371, 6652166202, 371, 1, 0, 3, 6652166202, 371, 4, 212, 5, 441, 665, 0, 430, 665, 1, 195, 2, 431, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 265, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 9814671451, 265, 1, 0, 0, 9814671448, 265, 9814671451, 265, 1, 10, 449, 665, 11, 450, 665, 12, 451, 665, 13, 452, 665, 14, 453, 665, 15, 454, 665, 16, 455, 665, 17, 456, 665, 18, 216, 0, 432, 665, 1, 433, 665, 2, 434, 665, 3, 435, 665, 4, 436, 665, 5, 437, 665, 6, 438, 665, 7, 439, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 265, 8, 0, 0, 9, 445, 665, 6652166201, 371, 0, 214, 0, 6652166201, 371, 0, 10, 0, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 9814671457, 265, 1, 0, 0, 9814671454, 265, 9814671457, 265, 1, 0, 458, 665, 1, 461, 665, 2, 462, 665, 3, 463, 665, 4, 464, 665, 5, 465, 665, 6, 466, 665, 7, 467, 665, 8, 468, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671460, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 265, 8, 0, 0, 477, 1, 8388608, 665, 477, 665, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 489, 665, 2, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 45, 1ULL, 1, 0, 9814671376, 265, 1, 0, 1ULL, 1, 1, 0, 0, 2, 9814671376, 265, 2, 0, 1, 6652166220, 371, 2, 9814671376, 265, 0, 641, 665, 9814671377, 265, 0, 0, 45, 9814671378, 265, 0, 3, 553, 665, 4, 552, 665, 5, 551, 665, 6, 550, 665, 7, 549, 665, 8, 548, 665, 9, 547, 665, 10, 546, 665, 11, 562, 665, 12, 563, 665, 13, 564, 665, 14, 565, 665, 15, 566, 665, 16, 567, 665, 17, 568, 665, 18, 569, 665, 19, 570, 665, 20, 571, 665, 21, 572, 665, 22, 573, 665, 23, 576, 665, 24, 574, 665, 25, 575, 665, 26, 577, 665, 27, 634, 665, 28, 635, 665, 29, 637, 665, 30, 636, 665, 31, 639, 665, 32, 638, 665, 0, 1ULL, 607, 665, 1, 2ULL, 608, 665, 2, 0, 1, 0, 4ULL, 609, 665, 1, 2, 0, 0, 8ULL, 623, 665, 2, 1, 0, 0, 16ULL, 621, 665, 1, 2, 0, 0, 32ULL, 613, 665, 2, 1, 0, 0, 64ULL, 616, 665, 1, 2, 0, 0, 128ULL, 615, 665, 2, 1, 0, 0, 256ULL, 617, 665, 1, 2, 0, 0, 512ULL, 620, 665, 2, 1, 0, 0, 1024ULL, 619, 665, 1, 2, 0, 0, 2048ULL, 599, 665, 2, 1, 0, 0, 4096ULL, 600, 665, 1, 2, 0, 0, 8192ULL, 598, 665, 2, 1, 0, 0, 16384ULL, 597, 665, 1, 2, 0, 0, 32768ULL, 591, 665, 2, 1, 0, 0, 65536ULL, 593, 665, 1, 2, 0, 0, 131072ULL, 592, 665, 2, 1, 0, 0, 262144ULL, 610, 665, 1, 2, 0, 0, 524288ULL, 611, 665, 2, 1, 0, 0, 1048576ULL, 612, 665, 1, 2, 0, 0, 2097152ULL, 603, 665, 2, 1, 0, 0, 4194304ULL, 604, 665, 1, 2, 0, 0, 8388608ULL, 624, 665, 2, 1, 0, 0, 16777216ULL, 578, 665, 1, 2, 0, 0, 33554432ULL, 579, 665, 2, 1, 0, 0, 67108864ULL, 580, 665, 1, 2, 0, 0, 134217728ULL, 584, 665, 2, 1, 0, 0, 268435456ULL, 581, 665, 1, 2, 0, 0, 536870912ULL, 582, 665, 2, 1, 0, 0, 1073741824ULL, 587, 665, 1, 2, 0, 0, 2147483648ULL, 589, 665, 2, 1, 0, 0, 4294967296ULL, 586, 665, 1, 2, 0, 0, 8589934592ULL, 590, 665, 2, 1, 0, 0, 17179869184ULL, 588, 665, 1, 2, 0, 0, 34359738368ULL, 585, 665, 2, 1, 0, 0, 68719476736ULL, 583, 665, 1, 2, 0, 0, 137438953472ULL, 606, 665, 2, 1, 0, 0, 274877906944ULL, 605, 665, 1, 2, 0, 0, 549755813888ULL, 601, 665, 2, 1, 0, 0, 1099511627776ULL, 655, 665, 1, 2, 0, 0, 2199023255552ULL, 594, 665, 2, 1, 0, 0, 4398046511104ULL, 625, 665, 1, 2, 0, 0, 8796093022208ULL, 626, 665, 2, 1, 0, 0, 17592186044416ULL, 614, 665, 1, 2, 0, 0, 35184372088832ULL, 618, 665, 2, 1, 0, 0, 70368744177664ULL, 656, 665, 1, 2, 0, 0, 1, 1, 595, 665, 2, 596, 665, 33, 622, 665, 34, 653, 665, 35, 654, 665, 36, 542, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671466, 265, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 265, 36, 0, 0, 599, 665, 529, 665, 1, 600, 665, 543, 665, 2, 0, 1, 3, 2, 595, 665, 0, 601, 665, 538, 665, 1, 262144ULL, 0, 0, 65536ULL, 597, 665, 2, 1, 0, 0, 597, 665, 539, 665, 1, 2, 0, 0, 131072ULL, 598, 665, 2, 1, 0, 24, 2, 3, 13, 24, 14, 544, 665, 0, 521, 665, 613, 665, 15, 0, 614, 665, 0, 497, 665, 562, 665, 1, 505, 665, 563, 665, 2, 0, 1, 0, 513, 665, 564, 665, 1, 2, 0, 0, 506, 665, 565, 665, 2, 1, 0, 0, 521, 665, 566, 665, 1, 2, 0, 0, 529, 665, 567, 665, 2, 1, 0, 0, 561, 665, 569, 665, 1, 2, 0, 0, 537, 665, 568, 665, 2, 1, 0, 0, 538, 665, 570, 665, 1, 2, 0, 0, 539, 665, 571, 665, 2, 1, 0, 0, 540, 665, 572, 665, 1, 2, 0, 0, 541, 665, 573, 665, 2, 1, 0, 0, 574, 665, 45, 1, 2, 0, 0, 543, 665, 575, 665, 2, 1, 0, 0, 544, 665, 576, 665, 1, 2, 0, 0, 628, 665, 634, 665, 2, 1, 0, 0, 629, 665, 635, 665, 1, 2, 0, 0, 630, 665, 636, 665, 2, 1, 0, 0, 631, 665, 637, 665, 1, 2, 0, 0, 632, 665, 638, 665, 2, 1, 0, 0, 633, 665, 639, 665, 1, 2, 0, 0, 545, 665, 577, 665, 2, 1, 0, 25, 2, 553, 665, 16, 25, 0, 496, 665, 562, 665, 1, 504, 665, 563, 665, 2, 0, 1, 0, 512, 665, 564, 665, 1, 2, 0, 0, 513, 665, 565, 665, 2, 1, 0, 0, 520, 665, 566, 665, 1, 2, 0, 0, 528, 665, 567, 665, 2, 1, 0, 0, 536, 665, 568, 665, 1, 2, 0, 0, 560, 665, 569, 665, 2, 1, 0, 26, 2, 552, 665, 17, 26, 0, 495, 665, 562, 665, 1, 503, 665, 563, 665, 2, 0, 1, 0, 511, 665, 564, 665, 1, 2, 0, 0, 512, 665, 565, 665, 2, 1, 0, 0, 519, 665, 566, 665, 1, 2, 0, 0, 527, 665, 567, 665, 2, 1, 0, 0, 535, 665, 568, 665, 1, 2, 0, 0, 559, 665, 569, 665, 2, 1, 0, 27, 2, 551, 665, 18, 27, 0, 494, 665, 562, 665, 1, 502, 665, 563, 665, 2, 0, 1, 0, 510, 665, 564, 665, 1, 2, 0, 0, 511, 665, 565, 665, 2, 1, 0, 0, 518, 665, 566, 665, 1, 2, 0, 0, 526, 665, 567, 665, 2, 1, 0, 0, 534, 665, 568, 665, 1, 2, 0, 0, 558, 665, 569, 665, 2, 1, 0, 28, 2, 550, 665, 19, 28, 0, 493, 665, 562, 665, 1, 501, 665, 563, 665, 2, 0, 1, 0, 509, 665, 564, 665, 1, 2, 0, 0, 510, 665, 565, 665, 2, 1, 0, 0, 517, 665, 566, 665, 1, 2, 0, 0, 525, 665, 567, 665, 2, 1, 0, 0, 533, 665, 568, 665, 1, 2, 0, 0, 557, 665, 569, 665, 2, 1, 0, 29, 2, 549, 665, 20, 29, 0, 492, 665, 562, 665, 1, 500, 665, 563, 665, 2, 0, 1, 0, 508, 665, 564, 665, 1, 2, 0, 0, 509, 665, 565, 665, 2, 1, 0, 0, 516, 665, 566, 665, 1, 2, 0, 0, 524, 665, 567, 665, 2, 1, 0, 0, 532, 665, 568, 665, 1, 2, 0, 0, 556, 665, 569, 665, 2, 1, 0, 30, 2, 548, 665, 21, 30, 0, 491, 665, 562, 665, 1, 499, 665, 563, 665, 2, 0, 1, 0, 507, 665, 564, 665, 1, 2, 0, 0, 508, 665, 565, 665, 2, 1, 0, 0, 515, 665, 566, 665, 1, 2, 0, 0, 523, 665, 567, 665, 2, 1, 0, 0, 531, 665, 568, 665, 1, 2, 0, 0, 555, 665, 569, 665, 2, 1, 0, 31, 2, 547, 665, 22, 31, 0, 490, 665, 562, 665, 1, 498, 665, 563, 665, 2, 0, 1, 0, 506, 665, 564, 665, 1, 2, 0, 0, 507, 665, 565, 665, 2, 1, 0, 0, 514, 665, 566, 665, 1, 2, 0, 0, 522, 665, 567, 665, 2, 1, 0, 0, 530, 665, 568, 665, 1, 2, 0, 0, 554, 665, 569, 665, 2, 1, 0, 32, 2, 546, 665, 23, 32, 2, 442, 665, 0, 448, 665, 443, 665, 1, 0, 459, 665, 3, 1, 1ULL, 4, 459, 665, 0, 461, 665, 6652166202, 371, 6652166203, 371, 0, 469, 665, 5, 6652166203, 371, 0, 462, 665, 6652166202, 371, 6652166204, 371, 0, 470, 665, 6, 6652166204, 371, 0, 463, 665, 6652166202, 371, 6652166205, 371, 0, 471, 665, 7, 6652166205, 371, 0, 464, 665, 6652166202, 371, 6652166206, 371, 0, 472, 665, 8, 6652166206, 371, 0, 465, 665, 6652166202, 371, 6652166207, 371, 0, 473, 665, 9, 6652166207, 371, 0, 466, 665, 6652166202, 371, 6652166208, 371, 0, 474, 665, 10, 6652166208, 371, 0, 467, 665, 6652166202, 371, 6652166209, 371, 0, 475, 665, 11, 6652166209, 371, 0, 468, 665, 6652166202, 371, 6652166210, 371, 0, 476, 665, 12, 6652166210, 371, 0, 458, 665, 460, 665, 1, 1ULL, 0, 6652166218, 371, 1, 215, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 371, 0, 9814671472, 265, 1, 1, 0, 613, 665, 614, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671472, 265, 1, 0, 0, 6652166368, 371, 9814671472, 265, 1, 13, 24, 14, 544, 665, 0, 521, 665, 617, 665, 15, 0, 618, 665, 16, 25, 17, 26, 18, 27, 19, 28, 20, 29, 21, 30, 22, 31, 23, 32, 2, 295, 665, 0, 310, 665, 296, 665, 1, 0, 312, 665, 3, 1, 1ULL, 4, 312, 665, 0, 314, 665, 6652166189, 371, 6652166190, 371, 0, 322, 665, 5, 6652166190, 371, 0, 315, 665, 6652166189, 371, 6652166191, 371, 0, 323, 665, 6, 6652166191, 371, 0, 316, 665, 6652166189, 371, 6652166192, 371, 0, 324, 665, 7, 6652166192, 371, 0, 317, 665, 6652166189, 371, 6652166193, 371, 0, 325, 665, 8, 6652166193, 371, 0, 318, 665, 6652166189, 371, 6652166194, 371, 0, 326, 665, 9, 6652166194, 371, 0, 319, 665, 6652166189, 371, 6652166195, 371, 0, 327, 665, 10, 6652166195, 371, 0, 320, 665, 6652166189, 371, 6652166196, 371, 0, 328, 665, 11, 6652166196, 371, 0, 321, 665, 6652166189, 371, 6652166197, 371, 0, 329, 665, 12, 6652166197, 371, 0, 311, 665, 313, 665, 1, 1ULL, 0, 6652166219, 371, 1, 147, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 371, 0, 9814671475, 265, 1, 1, 0, 617, 665, 618, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671475, 265, 1, 0, 0, 6652166371, 371, 9814671475, 265, 1};
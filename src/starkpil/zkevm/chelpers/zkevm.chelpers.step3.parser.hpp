@@ -4,7 +4,7 @@
 #define NTEMP3_ 4
 
 
-uint64_t op3[NOPS_] = { 30, 57, 51, 0, 5, 56, 37, 45, 86, 51, 5, 56, 37, 45, 86, 30, 56, 50, 0, 31, 23, 45, 5, 56, 86, 50, 1, 22, 50, 50, 0, 1, 22, 50, 50, 115, 0, 1, 22, 50, 50, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 0, 22, 50, 50, 115, 115, 0, 22, 50, 50, 115, 0, 22, 50, 50, 0, 22, 50, 22, 30, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 50, 21, 53, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 53, 0, 22, 22, 22, 50, 53, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 0, 26, 50, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 50, 21, 53, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 47, 78, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 56, 93, 53, 56, 24, 47, 1, 100, 50, 27, 1, 96, 1, 96, 1, 27, 56, 0, 53, 86, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 52, 27, 30, 94, 27, 95, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 54, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 56, 93, 50, 27, 27, 95, 30, 47, 30, 47, 0, 30, 47, 86, 50, 50, 0, 1, 50, 46, 53, 115, 0, 53, 0, 0, 24, 47, 24, 47, 0, 86, 7, 27, 56, 92, 50, 27, 96, 50, 27, 96, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 90, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 35, 35, 21, 47, 35, 0, 10, 78, 100, 32, 78, 22, 45, 87, 78, 79, 50, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 79, 79, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 81, 79, 79, 79, 79, 81, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 5, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 82, 79, 79, 82, 79, 59, 12, 70, 88, 82, 59, 12, 70, 12, 44, 61, 89, 80, 83, 80, 59, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 78, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 78, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 82, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 53, 0, 53, 0, 1, 78, 67, 12, 18, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 71, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 59, 12, 18, 98, 79, 67, 12, 18, 66, 68, 15, 18, 71, 79, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 59, 12, 18, 98};
+inline uint64_t op3[NOPS_] = { 30, 57, 51, 0, 5, 56, 37, 45, 86, 51, 5, 56, 37, 45, 86, 30, 56, 50, 0, 31, 23, 45, 5, 56, 86, 50, 1, 22, 50, 50, 0, 1, 22, 50, 50, 115, 0, 1, 22, 50, 50, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 115, 0, 22, 50, 50, 115, 115, 115, 0, 22, 50, 50, 115, 115, 0, 22, 50, 50, 115, 0, 22, 50, 50, 0, 22, 50, 22, 30, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 50, 21, 53, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 115, 50, 115, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 115, 21, 50, 21, 50, 21, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 53, 0, 22, 22, 22, 50, 53, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 22, 22, 22, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 115, 53, 0, 0, 26, 50, 53, 115, 53, 0, 0, 26, 50, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 50, 50, 21, 53, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 115, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 86, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 6, 94, 50, 95, 47, 78, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 86, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 56, 93, 53, 56, 24, 47, 1, 100, 50, 27, 1, 96, 1, 96, 1, 27, 56, 0, 53, 86, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 50, 87, 52, 27, 30, 94, 27, 95, 50, 50, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 54, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 1, 56, 93, 50, 27, 27, 95, 30, 47, 30, 47, 0, 30, 47, 86, 50, 50, 0, 1, 50, 46, 53, 115, 0, 53, 0, 0, 24, 47, 24, 47, 0, 86, 7, 27, 56, 92, 50, 27, 96, 50, 27, 96, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 90, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 35, 35, 21, 47, 35, 0, 10, 78, 100, 32, 78, 22, 45, 87, 78, 79, 50, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 0, 1, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 79, 79, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 81, 79, 79, 79, 79, 81, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 5, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 82, 79, 79, 82, 79, 59, 12, 70, 88, 82, 59, 12, 70, 12, 44, 61, 89, 80, 83, 80, 59, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 78, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 78, 50, 50, 115, 115, 115, 115, 115, 115, 115, 0, 1, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 78, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 82, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 53, 0, 53, 0, 1, 78, 67, 12, 18, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 71, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 59, 12, 18, 98, 79, 67, 12, 18, 66, 68, 15, 18, 71, 79, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 59, 12, 18, 98};
 
 
-uint64_t args3[NARGS_] = { 0, 1ULL, 45, 665, 1, 0, 3, 1, 8388608, 665, 0, 45, 665, 4, 1, 8388608, 665, 2, 1, 0, 0, 4, 1, 8388608, 665, 3, 1, 8388608, 665, 1, 0, 0, 665, 0, 2, 665, 0, 665, 3, 2, 0, 6652166144, 371, 1, 3, 1, 45, 665, 3, 1, 8388608, 665, 0, 4, 1, 8388608, 665, 3, 1, 8388608, 665, 2, 0, 1, 665, 0, 2, 665, 1, 665, 3, 1, 0, 6652166145, 371, 2, 3, 0, 1ULL, 45, 665, 1, 0, 0, 665, 0, 45, 665, 1, 665, 2, 1, 0, 0, 1ULL, 3, 1, 8388608, 665, 1, 0, 4, 1, 8388608, 665, 3, 1, 2, 0, 3, 1, 8388608, 665, 4, 1, 8388608, 665, 1, 0, 2, 665, 6652166146, 371, 3, 1, 0, 58, 665, 74, 665, 1, 0, 90, 665, 3, 1, 138, 665, 0, 58, 665, 75, 665, 1, 59, 665, 74, 665, 2, 0, 1, 0, 2, 91, 665, 4, 0, 139, 665, 0, 58, 665, 76, 665, 1, 59, 665, 75, 665, 2, 0, 1, 0, 60, 665, 74, 665, 1, 2, 0, 0, 1, 92, 665, 5, 0, 140, 665, 0, 58, 665, 77, 665, 1, 59, 665, 76, 665, 2, 0, 1, 0, 60, 665, 75, 665, 1, 2, 0, 0, 61, 665, 74, 665, 2, 1, 0, 0, 2, 93, 665, 6, 0, 141, 665, 0, 58, 665, 78, 665, 1, 59, 665, 77, 665, 2, 0, 1, 0, 60, 665, 76, 665, 1, 2, 0, 0, 61, 665, 75, 665, 2, 1, 0, 0, 62, 665, 74, 665, 1, 2, 0, 0, 1, 94, 665, 7, 0, 142, 665, 0, 58, 665, 79, 665, 1, 59, 665, 78, 665, 2, 0, 1, 0, 60, 665, 77, 665, 1, 2, 0, 0, 61, 665, 76, 665, 2, 1, 0, 0, 62, 665, 75, 665, 1, 2, 0, 0, 63, 665, 74, 665, 2, 1, 0, 0, 2, 95, 665, 8, 0, 143, 665, 0, 58, 665, 80, 665, 1, 59, 665, 79, 665, 2, 0, 1, 0, 60, 665, 78, 665, 1, 2, 0, 0, 61, 665, 77, 665, 2, 1, 0, 0, 62, 665, 76, 665, 1, 2, 0, 0, 63, 665, 75, 665, 2, 1, 0, 0, 64, 665, 74, 665, 1, 2, 0, 0, 1, 96, 665, 9, 0, 144, 665, 0, 58, 665, 81, 665, 1, 59, 665, 80, 665, 2, 0, 1, 0, 60, 665, 79, 665, 1, 2, 0, 0, 61, 665, 78, 665, 2, 1, 0, 0, 62, 665, 77, 665, 1, 2, 0, 0, 63, 665, 76, 665, 2, 1, 0, 0, 64, 665, 75, 665, 1, 2, 0, 0, 65, 665, 74, 665, 2, 1, 0, 0, 2, 97, 665, 10, 0, 145, 665, 0, 58, 665, 82, 665, 1, 59, 665, 81, 665, 2, 0, 1, 0, 60, 665, 80, 665, 1, 2, 0, 0, 61, 665, 79, 665, 2, 1, 0, 0, 62, 665, 78, 665, 1, 2, 0, 0, 63, 665, 77, 665, 2, 1, 0, 0, 64, 665, 76, 665, 1, 2, 0, 0, 65, 665, 75, 665, 2, 1, 0, 0, 66, 665, 74, 665, 1, 2, 0, 0, 1, 98, 665, 11, 0, 146, 665, 0, 58, 665, 83, 665, 1, 59, 665, 82, 665, 2, 0, 1, 0, 60, 665, 81, 665, 1, 2, 0, 0, 61, 665, 80, 665, 2, 1, 0, 0, 62, 665, 79, 665, 1, 2, 0, 0, 63, 665, 78, 665, 2, 1, 0, 0, 64, 665, 77, 665, 1, 2, 0, 0, 65, 665, 76, 665, 2, 1, 0, 0, 66, 665, 75, 665, 1, 2, 0, 0, 67, 665, 74, 665, 2, 1, 0, 0, 2, 99, 665, 12, 0, 147, 665, 0, 58, 665, 84, 665, 1, 59, 665, 83, 665, 2, 0, 1, 0, 60, 665, 82, 665, 1, 2, 0, 0, 61, 665, 81, 665, 2, 1, 0, 0, 62, 665, 80, 665, 1, 2, 0, 0, 63, 665, 79, 665, 2, 1, 0, 0, 64, 665, 78, 665, 1, 2, 0, 0, 65, 665, 77, 665, 2, 1, 0, 0, 66, 665, 76, 665, 1, 2, 0, 0, 67, 665, 75, 665, 2, 1, 0, 0, 68, 665, 74, 665, 1, 2, 0, 0, 1, 100, 665, 13, 0, 148, 665, 0, 58, 665, 85, 665, 1, 59, 665, 84, 665, 2, 0, 1, 0, 60, 665, 83, 665, 1, 2, 0, 0, 61, 665, 82, 665, 2, 1, 0, 0, 62, 665, 81, 665, 1, 2, 0, 0, 63, 665, 80, 665, 2, 1, 0, 0, 64, 665, 79, 665, 1, 2, 0, 0, 65, 665, 78, 665, 2, 1, 0, 0, 66, 665, 77, 665, 1, 2, 0, 0, 67, 665, 76, 665, 2, 1, 0, 0, 68, 665, 75, 665, 1, 2, 0, 0, 69, 665, 74, 665, 2, 1, 0, 0, 2, 101, 665, 14, 0, 149, 665, 0, 58, 665, 86, 665, 1, 59, 665, 85, 665, 2, 0, 1, 0, 60, 665, 84, 665, 1, 2, 0, 0, 61, 665, 83, 665, 2, 1, 0, 0, 62, 665, 82, 665, 1, 2, 0, 0, 63, 665, 81, 665, 2, 1, 0, 0, 64, 665, 80, 665, 1, 2, 0, 0, 65, 665, 79, 665, 2, 1, 0, 0, 66, 665, 78, 665, 1, 2, 0, 0, 67, 665, 77, 665, 2, 1, 0, 0, 68, 665, 76, 665, 1, 2, 0, 0, 69, 665, 75, 665, 2, 1, 0, 0, 70, 665, 74, 665, 1, 2, 0, 0, 1, 102, 665, 15, 0, 150, 665, 0, 58, 665, 87, 665, 1, 59, 665, 86, 665, 2, 0, 1, 0, 60, 665, 85, 665, 1, 2, 0, 0, 61, 665, 84, 665, 2, 1, 0, 0, 62, 665, 83, 665, 1, 2, 0, 0, 63, 665, 82, 665, 2, 1, 0, 0, 64, 665, 81, 665, 1, 2, 0, 0, 65, 665, 80, 665, 2, 1, 0, 0, 66, 665, 79, 665, 1, 2, 0, 0, 67, 665, 78, 665, 2, 1, 0, 0, 68, 665, 77, 665, 1, 2, 0, 0, 69, 665, 76, 665, 2, 1, 0, 0, 70, 665, 75, 665, 1, 2, 0, 0, 71, 665, 74, 665, 2, 1, 0, 0, 2, 103, 665, 16, 0, 151, 665, 0, 58, 665, 88, 665, 1, 59, 665, 87, 665, 2, 0, 1, 0, 60, 665, 86, 665, 1, 2, 0, 0, 61, 665, 85, 665, 2, 1, 0, 0, 62, 665, 84, 665, 1, 2, 0, 0, 63, 665, 83, 665, 2, 1, 0, 0, 64, 665, 82, 665, 1, 2, 0, 0, 65, 665, 81, 665, 2, 1, 0, 0, 66, 665, 80, 665, 1, 2, 0, 0, 67, 665, 79, 665, 2, 1, 0, 0, 68, 665, 78, 665, 1, 2, 0, 0, 69, 665, 77, 665, 2, 1, 0, 0, 70, 665, 76, 665, 1, 2, 0, 0, 71, 665, 75, 665, 2, 1, 0, 0, 72, 665, 74, 665, 1, 2, 0, 0, 1, 104, 665, 17, 0, 152, 665, 0, 58, 665, 89, 665, 1, 59, 665, 88, 665, 2, 0, 1, 0, 60, 665, 87, 665, 1, 2, 0, 0, 61, 665, 86, 665, 2, 1, 0, 0, 62, 665, 85, 665, 1, 2, 0, 0, 63, 665, 84, 665, 2, 1, 0, 0, 64, 665, 83, 665, 1, 2, 0, 0, 65, 665, 82, 665, 2, 1, 0, 0, 66, 665, 81, 665, 1, 2, 0, 0, 67, 665, 80, 665, 2, 1, 0, 0, 68, 665, 79, 665, 1, 2, 0, 0, 69, 665, 78, 665, 2, 1, 0, 0, 70, 665, 77, 665, 1, 2, 0, 0, 71, 665, 76, 665, 2, 1, 0, 0, 72, 665, 75, 665, 1, 2, 0, 0, 73, 665, 74, 665, 2, 1, 0, 0, 2, 105, 665, 18, 0, 153, 665, 0, 59, 665, 89, 665, 1, 60, 665, 88, 665, 2, 0, 1, 0, 61, 665, 87, 665, 1, 2, 0, 0, 62, 665, 86, 665, 2, 1, 0, 0, 63, 665, 85, 665, 1, 2, 0, 0, 64, 665, 84, 665, 2, 1, 0, 0, 65, 665, 83, 665, 1, 2, 0, 0, 66, 665, 82, 665, 2, 1, 0, 0, 67, 665, 81, 665, 1, 2, 0, 0, 68, 665, 80, 665, 2, 1, 0, 0, 69, 665, 79, 665, 1, 2, 0, 0, 70, 665, 78, 665, 2, 1, 0, 0, 71, 665, 77, 665, 1, 2, 0, 0, 72, 665, 76, 665, 2, 1, 0, 0, 73, 665, 75, 665, 1, 2, 0, 19, 1, 106, 665, 0, 60, 665, 89, 665, 1, 61, 665, 88, 665, 2, 0, 1, 0, 62, 665, 87, 665, 1, 2, 0, 0, 63, 665, 86, 665, 2, 1, 0, 0, 64, 665, 85, 665, 1, 2, 0, 0, 65, 665, 84, 665, 2, 1, 0, 0, 66, 665, 83, 665, 1, 2, 0, 0, 67, 665, 82, 665, 2, 1, 0, 0, 68, 665, 81, 665, 1, 2, 0, 0, 69, 665, 80, 665, 2, 1, 0, 0, 70, 665, 79, 665, 1, 2, 0, 0, 71, 665, 78, 665, 2, 1, 0, 0, 72, 665, 77, 665, 1, 2, 0, 0, 73, 665, 76, 665, 2, 1, 0, 20, 2, 107, 665, 0, 61, 665, 89, 665, 1, 62, 665, 88, 665, 2, 0, 1, 0, 63, 665, 87, 665, 1, 2, 0, 0, 64, 665, 86, 665, 2, 1, 0, 0, 65, 665, 85, 665, 1, 2, 0, 0, 66, 665, 84, 665, 2, 1, 0, 0, 67, 665, 83, 665, 1, 2, 0, 0, 68, 665, 82, 665, 2, 1, 0, 0, 69, 665, 81, 665, 1, 2, 0, 0, 70, 665, 80, 665, 2, 1, 0, 0, 71, 665, 79, 665, 1, 2, 0, 0, 72, 665, 78, 665, 2, 1, 0, 0, 73, 665, 77, 665, 1, 2, 0, 21, 1, 108, 665, 0, 62, 665, 89, 665, 1, 63, 665, 88, 665, 2, 0, 1, 0, 64, 665, 87, 665, 1, 2, 0, 0, 65, 665, 86, 665, 2, 1, 0, 0, 66, 665, 85, 665, 1, 2, 0, 0, 67, 665, 84, 665, 2, 1, 0, 0, 68, 665, 83, 665, 1, 2, 0, 0, 69, 665, 82, 665, 2, 1, 0, 0, 70, 665, 81, 665, 1, 2, 0, 0, 71, 665, 80, 665, 2, 1, 0, 0, 72, 665, 79, 665, 1, 2, 0, 0, 73, 665, 78, 665, 2, 1, 0, 22, 2, 109, 665, 0, 63, 665, 89, 665, 1, 64, 665, 88, 665, 2, 0, 1, 0, 65, 665, 87, 665, 1, 2, 0, 0, 66, 665, 86, 665, 2, 1, 0, 0, 67, 665, 85, 665, 1, 2, 0, 0, 68, 665, 84, 665, 2, 1, 0, 0, 69, 665, 83, 665, 1, 2, 0, 0, 70, 665, 82, 665, 2, 1, 0, 0, 71, 665, 81, 665, 1, 2, 0, 0, 72, 665, 80, 665, 2, 1, 0, 0, 73, 665, 79, 665, 1, 2, 0, 23, 1, 110, 665, 0, 64, 665, 89, 665, 1, 65, 665, 88, 665, 2, 0, 1, 0, 66, 665, 87, 665, 1, 2, 0, 0, 67, 665, 86, 665, 2, 1, 0, 0, 68, 665, 85, 665, 1, 2, 0, 0, 69, 665, 84, 665, 2, 1, 0, 0, 70, 665, 83, 665, 1, 2, 0, 0, 71, 665, 82, 665, 2, 1, 0, 0, 72, 665, 81, 665, 1, 2, 0, 0, 73, 665, 80, 665, 2, 1, 0, 24, 2, 111, 665, 0, 65, 665, 89, 665, 1, 66, 665, 88, 665, 2, 0, 1, 0, 67, 665, 87, 665, 1, 2, 0, 0, 68, 665, 86, 665, 2, 1, 0, 0, 69, 665, 85, 665, 1, 2, 0, 0, 70, 665, 84, 665, 2, 1, 0, 0, 71, 665, 83, 665, 1, 2, 0, 0, 72, 665, 82, 665, 2, 1, 0, 0, 73, 665, 81, 665, 1, 2, 0, 25, 1, 112, 665, 0, 66, 665, 89, 665, 1, 67, 665, 88, 665, 2, 0, 1, 0, 68, 665, 87, 665, 1, 2, 0, 0, 69, 665, 86, 665, 2, 1, 0, 0, 70, 665, 85, 665, 1, 2, 0, 0, 71, 665, 84, 665, 2, 1, 0, 0, 72, 665, 83, 665, 1, 2, 0, 0, 73, 665, 82, 665, 2, 1, 0, 26, 2, 113, 665, 0, 67, 665, 89, 665, 1, 68, 665, 88, 665, 2, 0, 1, 0, 69, 665, 87, 665, 1, 2, 0, 0, 70, 665, 86, 665, 2, 1, 0, 0, 71, 665, 85, 665, 1, 2, 0, 0, 72, 665, 84, 665, 2, 1, 0, 0, 73, 665, 83, 665, 1, 2, 0, 27, 1, 114, 665, 0, 68, 665, 89, 665, 1, 69, 665, 88, 665, 2, 0, 1, 0, 70, 665, 87, 665, 1, 2, 0, 0, 71, 665, 86, 665, 2, 1, 0, 0, 72, 665, 85, 665, 1, 2, 0, 0, 73, 665, 84, 665, 2, 1, 0, 28, 2, 115, 665, 0, 69, 665, 89, 665, 1, 70, 665, 88, 665, 2, 0, 1, 0, 71, 665, 87, 665, 1, 2, 0, 0, 72, 665, 86, 665, 2, 1, 0, 0, 73, 665, 85, 665, 1, 2, 0, 29, 1, 116, 665, 0, 70, 665, 89, 665, 1, 71, 665, 88, 665, 2, 0, 1, 0, 72, 665, 87, 665, 1, 2, 0, 0, 73, 665, 86, 665, 2, 1, 0, 30, 2, 117, 665, 0, 71, 665, 89, 665, 1, 72, 665, 88, 665, 2, 0, 1, 0, 73, 665, 87, 665, 1, 2, 0, 31, 1, 118, 665, 0, 72, 665, 89, 665, 1, 73, 665, 88, 665, 2, 0, 1, 32, 2, 119, 665, 0, 73, 665, 89, 665, 33, 0, 120, 665, 34, 0ULL, 121, 665, 0, 3, 5, 1, 4, 6, 2, 0, 1, 0, 5, 7, 1, 2, 0, 0, 6, 8, 2, 1, 0, 0, 7, 9, 1, 2, 0, 0, 8, 10, 2, 1, 0, 0, 9, 11, 1, 2, 0, 0, 10, 12, 2, 1, 0, 0, 11, 13, 1, 2, 0, 0, 12, 14, 2, 1, 0, 0, 13, 15, 1, 2, 0, 0, 14, 16, 2, 1, 0, 0, 15, 17, 1, 2, 0, 0, 16, 18, 2, 1, 0, 0, 17, 19, 1, 2, 0, 0, 18, 20, 2, 1, 0, 0, 19, 21, 1, 2, 0, 0, 20, 22, 2, 1, 0, 0, 21, 23, 1, 2, 0, 0, 22, 24, 2, 1, 0, 0, 23, 25, 1, 2, 0, 0, 24, 26, 2, 1, 0, 0, 25, 27, 1, 2, 0, 0, 26, 28, 2, 1, 0, 0, 27, 29, 1, 2, 0, 0, 28, 30, 2, 1, 0, 0, 29, 31, 1, 2, 0, 0, 30, 32, 2, 1, 0, 0, 31, 33, 1, 2, 0, 0, 32, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166147, 371, 1, 0, 0, 154, 665, 90, 665, 1, 154, 665, 58, 665, 2, 0, 1, 0, 64559ULL, 170, 665, 1, 2, 0, 0, 1, 106, 665, 5, 0, 74, 665, 0, 154, 665, 91, 665, 1, 154, 665, 59, 665, 2, 0, 1, 0, 64559ULL, 171, 665, 3, 2, 0, 0, 155, 665, 90, 665, 1, 155, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 107, 665, 6, 1, 75, 665, 0, 154, 665, 92, 665, 1, 154, 665, 60, 665, 2, 0, 1, 0, 64559ULL, 172, 665, 3, 2, 0, 0, 155, 665, 91, 665, 1, 155, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 90, 665, 1, 156, 665, 58, 665, 2, 0, 1, 0, 65534ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 108, 665, 7, 1, 76, 665, 0, 154, 665, 93, 665, 1, 154, 665, 61, 665, 2, 0, 1, 0, 64559ULL, 173, 665, 3, 2, 0, 0, 155, 665, 92, 665, 1, 155, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 91, 665, 1, 156, 665, 59, 665, 2, 0, 1, 0, 65534ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 90, 665, 1, 157, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 109, 665, 8, 1, 77, 665, 0, 154, 665, 94, 665, 1, 154, 665, 62, 665, 2, 0, 1, 0, 64559ULL, 174, 665, 3, 2, 0, 0, 155, 665, 93, 665, 1, 155, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 92, 665, 1, 156, 665, 60, 665, 2, 0, 1, 0, 65534ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 91, 665, 1, 157, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 90, 665, 1, 158, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 110, 665, 9, 1, 78, 665, 0, 154, 665, 95, 665, 1, 154, 665, 63, 665, 2, 0, 1, 0, 64559ULL, 175, 665, 3, 2, 0, 0, 155, 665, 94, 665, 1, 155, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 93, 665, 1, 156, 665, 61, 665, 2, 0, 1, 0, 65534ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 92, 665, 1, 157, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 91, 665, 1, 158, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 90, 665, 1, 159, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 111, 665, 10, 1, 79, 665, 0, 154, 665, 96, 665, 1, 154, 665, 64, 665, 2, 0, 1, 0, 64559ULL, 176, 665, 3, 2, 0, 0, 155, 665, 95, 665, 1, 155, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 94, 665, 1, 156, 665, 62, 665, 2, 0, 1, 0, 65534ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 93, 665, 1, 157, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 92, 665, 1, 158, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 91, 665, 1, 159, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 90, 665, 1, 160, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 112, 665, 11, 1, 80, 665, 0, 154, 665, 97, 665, 1, 154, 665, 65, 665, 2, 0, 1, 0, 64559ULL, 177, 665, 3, 2, 0, 0, 155, 665, 96, 665, 1, 155, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 95, 665, 1, 156, 665, 63, 665, 2, 0, 1, 0, 65534ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 94, 665, 1, 157, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 93, 665, 1, 158, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 92, 665, 1, 159, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 91, 665, 1, 160, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 90, 665, 1, 161, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 113, 665, 12, 1, 81, 665, 0, 154, 665, 98, 665, 1, 154, 665, 66, 665, 2, 0, 1, 0, 64559ULL, 178, 665, 3, 2, 0, 0, 155, 665, 97, 665, 1, 155, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 96, 665, 1, 156, 665, 64, 665, 2, 0, 1, 0, 65534ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 95, 665, 1, 157, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 94, 665, 1, 158, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 93, 665, 1, 159, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 92, 665, 1, 160, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 91, 665, 1, 161, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 90, 665, 1, 162, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 114, 665, 13, 1, 82, 665, 0, 154, 665, 99, 665, 1, 154, 665, 67, 665, 2, 0, 1, 0, 64559ULL, 179, 665, 3, 2, 0, 0, 155, 665, 98, 665, 1, 155, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 97, 665, 1, 156, 665, 65, 665, 2, 0, 1, 0, 65534ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 96, 665, 1, 157, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 95, 665, 1, 158, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 94, 665, 1, 159, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 93, 665, 1, 160, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 92, 665, 1, 161, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 91, 665, 1, 162, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 90, 665, 1, 163, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 115, 665, 14, 1, 83, 665, 0, 154, 665, 100, 665, 1, 154, 665, 68, 665, 2, 0, 1, 0, 64559ULL, 180, 665, 3, 2, 0, 0, 155, 665, 99, 665, 1, 155, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 98, 665, 1, 156, 665, 66, 665, 2, 0, 1, 0, 65534ULL, 178, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 97, 665, 1, 157, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 96, 665, 1, 158, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 95, 665, 1, 159, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 94, 665, 1, 160, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 93, 665, 1, 161, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 92, 665, 1, 162, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 91, 665, 1, 163, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 90, 665, 1, 164, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 116, 665, 15, 1, 84, 665, 0, 154, 665, 101, 665, 1, 154, 665, 69, 665, 2, 0, 1, 0, 64559ULL, 181, 665, 3, 2, 0, 0, 155, 665, 100, 665, 1, 155, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 99, 665, 1, 156, 665, 67, 665, 2, 0, 1, 0, 65534ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 98, 665, 1, 157, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 97, 665, 1, 158, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 96, 665, 1, 159, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 95, 665, 1, 160, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 94, 665, 1, 161, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 93, 665, 1, 162, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 92, 665, 1, 163, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 91, 665, 1, 164, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 90, 665, 1, 165, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 117, 665, 16, 1, 85, 665, 0, 154, 665, 102, 665, 1, 154, 665, 70, 665, 2, 0, 1, 0, 64559ULL, 182, 665, 3, 2, 0, 0, 155, 665, 101, 665, 1, 155, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 100, 665, 1, 156, 665, 68, 665, 2, 0, 1, 0, 65534ULL, 180, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 99, 665, 1, 157, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 98, 665, 1, 158, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 97, 665, 1, 159, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 96, 665, 1, 160, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 95, 665, 1, 161, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 94, 665, 1, 162, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 93, 665, 1, 163, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 92, 665, 1, 164, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 91, 665, 1, 165, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 90, 665, 1, 166, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 118, 665, 17, 1, 86, 665, 0, 154, 665, 103, 665, 1, 154, 665, 71, 665, 2, 0, 1, 0, 64559ULL, 183, 665, 3, 2, 0, 0, 155, 665, 102, 665, 1, 155, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 101, 665, 1, 156, 665, 69, 665, 2, 0, 1, 0, 65534ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 100, 665, 1, 157, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 99, 665, 1, 158, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 98, 665, 1, 159, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 97, 665, 1, 160, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 96, 665, 1, 161, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 95, 665, 1, 162, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 94, 665, 1, 163, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 93, 665, 1, 164, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 92, 665, 1, 165, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 91, 665, 1, 166, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 90, 665, 1, 167, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 119, 665, 18, 1, 87, 665, 0, 154, 665, 104, 665, 1, 154, 665, 72, 665, 2, 0, 1, 0, 64559ULL, 184, 665, 3, 2, 0, 0, 155, 665, 103, 665, 1, 155, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 102, 665, 1, 156, 665, 70, 665, 2, 0, 1, 0, 65534ULL, 182, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 101, 665, 1, 157, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 100, 665, 1, 158, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 99, 665, 1, 159, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 98, 665, 1, 160, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 97, 665, 1, 161, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 96, 665, 1, 162, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 95, 665, 1, 163, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 94, 665, 1, 164, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 93, 665, 1, 165, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 92, 665, 1, 166, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 91, 665, 1, 167, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 90, 665, 1, 168, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 120, 665, 19, 1, 88, 665, 0, 154, 665, 105, 665, 1, 154, 665, 73, 665, 2, 0, 1, 0, 64559ULL, 185, 665, 3, 2, 0, 0, 155, 665, 104, 665, 1, 155, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 103, 665, 1, 156, 665, 71, 665, 2, 0, 1, 0, 65534ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 102, 665, 1, 157, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 101, 665, 1, 158, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 100, 665, 1, 159, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 99, 665, 1, 160, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 98, 665, 1, 161, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 97, 665, 1, 162, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 96, 665, 1, 163, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 95, 665, 1, 164, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 94, 665, 1, 165, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 93, 665, 1, 166, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 92, 665, 1, 167, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 91, 665, 1, 168, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 90, 665, 1, 169, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 121, 665, 20, 1, 89, 665, 0, 155, 665, 105, 665, 1, 155, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 156, 665, 104, 665, 1, 156, 665, 72, 665, 2, 0, 1, 0, 65534ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 157, 665, 103, 665, 1, 157, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 158, 665, 102, 665, 1, 158, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 101, 665, 1, 159, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 100, 665, 1, 160, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 99, 665, 1, 161, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 98, 665, 1, 162, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 97, 665, 1, 163, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 96, 665, 1, 164, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 95, 665, 1, 165, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 94, 665, 1, 166, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 93, 665, 1, 167, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 92, 665, 1, 168, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 91, 665, 1, 169, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 0, 4, 1, 21, 0, 258236ULL, 0, 156, 665, 105, 665, 1, 156, 665, 73, 665, 2, 0, 1, 0, 65534ULL, 185, 665, 3, 2, 0, 0, 157, 665, 104, 665, 1, 157, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 103, 665, 1, 158, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 102, 665, 1, 159, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 101, 665, 1, 160, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 100, 665, 1, 161, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 99, 665, 1, 162, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 98, 665, 1, 163, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 97, 665, 1, 164, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 96, 665, 1, 165, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 95, 665, 1, 166, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 94, 665, 1, 167, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 93, 665, 1, 168, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 92, 665, 1, 169, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 0, 3, 1, 22, 0, 262140ULL, 0, 157, 665, 105, 665, 1, 157, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 158, 665, 104, 665, 1, 158, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 103, 665, 1, 159, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 102, 665, 1, 160, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 101, 665, 1, 161, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 100, 665, 1, 162, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 99, 665, 1, 163, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 98, 665, 1, 164, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 97, 665, 1, 165, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 96, 665, 1, 166, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 95, 665, 1, 167, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 94, 665, 1, 168, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 93, 665, 1, 169, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 0, 4, 1, 23, 0, 262136ULL, 0, 158, 665, 105, 665, 1, 158, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 159, 665, 104, 665, 1, 159, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 103, 665, 1, 160, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 102, 665, 1, 161, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 101, 665, 1, 162, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 100, 665, 1, 163, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 99, 665, 1, 164, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 98, 665, 1, 165, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 97, 665, 1, 166, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 96, 665, 1, 167, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 95, 665, 1, 168, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 94, 665, 1, 169, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 0, 3, 1, 24, 0, 262140ULL, 0, 159, 665, 105, 665, 1, 159, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 160, 665, 104, 665, 1, 160, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 103, 665, 1, 161, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 102, 665, 1, 162, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 101, 665, 1, 163, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 100, 665, 1, 164, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 99, 665, 1, 165, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 98, 665, 1, 166, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 97, 665, 1, 167, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 96, 665, 1, 168, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 95, 665, 1, 169, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 0, 4, 1, 25, 0, 262140ULL, 0, 160, 665, 105, 665, 1, 160, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 161, 665, 104, 665, 1, 161, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 103, 665, 1, 162, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 102, 665, 1, 163, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 101, 665, 1, 164, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 100, 665, 1, 165, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 99, 665, 1, 166, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 98, 665, 1, 167, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 97, 665, 1, 168, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 96, 665, 1, 169, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 0, 3, 1, 26, 0, 262140ULL, 0, 161, 665, 105, 665, 1, 161, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 162, 665, 104, 665, 1, 162, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 103, 665, 1, 163, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 102, 665, 1, 164, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 101, 665, 1, 165, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 100, 665, 1, 166, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 99, 665, 1, 167, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 98, 665, 1, 168, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 97, 665, 1, 169, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 0, 4, 1, 27, 0, 262140ULL, 0, 162, 665, 105, 665, 1, 162, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 163, 665, 104, 665, 1, 163, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 103, 665, 1, 164, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 102, 665, 1, 165, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 101, 665, 1, 166, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 100, 665, 1, 167, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 99, 665, 1, 168, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 98, 665, 1, 169, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 0, 3, 1, 28, 0, 262140ULL, 0, 163, 665, 105, 665, 1, 163, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 164, 665, 104, 665, 1, 164, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 103, 665, 1, 165, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 102, 665, 1, 166, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 101, 665, 1, 167, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 100, 665, 1, 168, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 99, 665, 1, 169, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 0, 4, 1, 29, 0, 262140ULL, 0, 164, 665, 105, 665, 1, 164, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 165, 665, 104, 665, 1, 165, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 103, 665, 1, 166, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 102, 665, 1, 167, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 101, 665, 1, 168, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 100, 665, 1, 169, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 0, 3, 1, 30, 0, 262140ULL, 0, 165, 665, 105, 665, 1, 165, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 166, 665, 104, 665, 1, 166, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 103, 665, 1, 167, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 102, 665, 1, 168, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 101, 665, 1, 169, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 0, 4, 1, 31, 0, 262140ULL, 0, 166, 665, 105, 665, 1, 166, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 167, 665, 104, 665, 1, 167, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 103, 665, 1, 168, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 102, 665, 1, 169, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 0, 3, 1, 32, 0, 262140ULL, 0, 167, 665, 105, 665, 1, 167, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 168, 665, 104, 665, 1, 168, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 103, 665, 1, 169, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 0, 4, 1, 4, 0, 262140ULL, 0, 168, 665, 105, 665, 1, 168, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 169, 665, 104, 665, 1, 169, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 0, 3, 1, 3, 0, 262140ULL, 0, 169, 665, 105, 665, 1, 169, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 1, 2, 0, 33, 1, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166148, 371, 1, 0, 0, 154, 665, 74, 665, 1, 154, 665, 74, 665, 2, 0, 1, 0, 58, 665, 58, 665, 1, 2, 0, 0, 58, 665, 58, 665, 2, 1, 0, 0, 58, 665, 58, 665, 1, 2, 0, 0, 64559ULL, 170, 665, 5, 1, 0, 0, 154, 665, 75, 665, 1, 154, 665, 75, 665, 2, 0, 1, 0, 58, 665, 59, 665, 1, 2, 0, 0, 58, 665, 59, 665, 2, 1, 0, 0, 58, 665, 59, 665, 1, 2, 0, 0, 64559ULL, 171, 665, 3, 1, 0, 0, 155, 665, 74, 665, 1, 155, 665, 74, 665, 2, 0, 1, 0, 59, 665, 58, 665, 1, 2, 0, 0, 59, 665, 58, 665, 2, 1, 0, 0, 59, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 6, 3, 2, 0, 154, 665, 76, 665, 1, 154, 665, 76, 665, 2, 0, 1, 0, 58, 665, 60, 665, 1, 2, 0, 0, 58, 665, 60, 665, 2, 1, 0, 0, 58, 665, 60, 665, 1, 2, 0, 0, 64559ULL, 172, 665, 3, 1, 0, 0, 155, 665, 75, 665, 1, 155, 665, 75, 665, 2, 0, 1, 0, 59, 665, 59, 665, 1, 2, 0, 0, 59, 665, 59, 665, 2, 1, 0, 0, 59, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 74, 665, 1, 156, 665, 74, 665, 2, 0, 1, 0, 60, 665, 58, 665, 1, 2, 0, 0, 60, 665, 58, 665, 2, 1, 0, 0, 60, 665, 58, 665, 1, 2, 0, 0, 65534ULL, 170, 665, 2, 1, 0, 7, 4, 2, 0, 154, 665, 77, 665, 1, 154, 665, 77, 665, 2, 0, 1, 0, 58, 665, 61, 665, 1, 2, 0, 0, 58, 665, 61, 665, 2, 1, 0, 0, 58, 665, 61, 665, 1, 2, 0, 0, 64559ULL, 173, 665, 3, 1, 0, 0, 155, 665, 76, 665, 1, 155, 665, 76, 665, 2, 0, 1, 0, 59, 665, 60, 665, 1, 2, 0, 0, 59, 665, 60, 665, 2, 1, 0, 0, 59, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 75, 665, 1, 156, 665, 75, 665, 2, 0, 1, 0, 60, 665, 59, 665, 1, 2, 0, 0, 60, 665, 59, 665, 2, 1, 0, 0, 60, 665, 59, 665, 1, 2, 0, 0, 65534ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 74, 665, 1, 157, 665, 74, 665, 2, 0, 1, 0, 61, 665, 58, 665, 1, 2, 0, 0, 61, 665, 58, 665, 2, 1, 0, 0, 61, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 8, 3, 2, 0, 154, 665, 78, 665, 1, 154, 665, 78, 665, 2, 0, 1, 0, 58, 665, 62, 665, 1, 2, 0, 0, 58, 665, 62, 665, 2, 1, 0, 0, 58, 665, 62, 665, 1, 2, 0, 0, 64559ULL, 174, 665, 3, 1, 0, 0, 155, 665, 77, 665, 1, 155, 665, 77, 665, 2, 0, 1, 0, 59, 665, 61, 665, 1, 2, 0, 0, 59, 665, 61, 665, 2, 1, 0, 0, 59, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 76, 665, 1, 156, 665, 76, 665, 2, 0, 1, 0, 60, 665, 60, 665, 1, 2, 0, 0, 60, 665, 60, 665, 2, 1, 0, 0, 60, 665, 60, 665, 1, 2, 0, 0, 65534ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 75, 665, 1, 157, 665, 75, 665, 2, 0, 1, 0, 61, 665, 59, 665, 1, 2, 0, 0, 61, 665, 59, 665, 2, 1, 0, 0, 61, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 74, 665, 1, 158, 665, 74, 665, 2, 0, 1, 0, 62, 665, 58, 665, 1, 2, 0, 0, 62, 665, 58, 665, 2, 1, 0, 0, 62, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 9, 4, 2, 0, 154, 665, 79, 665, 1, 154, 665, 79, 665, 2, 0, 1, 0, 58, 665, 63, 665, 1, 2, 0, 0, 58, 665, 63, 665, 2, 1, 0, 0, 58, 665, 63, 665, 1, 2, 0, 0, 64559ULL, 175, 665, 3, 1, 0, 0, 155, 665, 78, 665, 1, 155, 665, 78, 665, 2, 0, 1, 0, 59, 665, 62, 665, 1, 2, 0, 0, 59, 665, 62, 665, 2, 1, 0, 0, 59, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 77, 665, 1, 156, 665, 77, 665, 2, 0, 1, 0, 60, 665, 61, 665, 1, 2, 0, 0, 60, 665, 61, 665, 2, 1, 0, 0, 60, 665, 61, 665, 1, 2, 0, 0, 65534ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 76, 665, 1, 157, 665, 76, 665, 2, 0, 1, 0, 61, 665, 60, 665, 1, 2, 0, 0, 61, 665, 60, 665, 2, 1, 0, 0, 61, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 75, 665, 1, 158, 665, 75, 665, 2, 0, 1, 0, 62, 665, 59, 665, 1, 2, 0, 0, 62, 665, 59, 665, 2, 1, 0, 0, 62, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 74, 665, 1, 159, 665, 74, 665, 2, 0, 1, 0, 63, 665, 58, 665, 1, 2, 0, 0, 63, 665, 58, 665, 2, 1, 0, 0, 63, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 10, 3, 2, 0, 154, 665, 80, 665, 1, 154, 665, 80, 665, 2, 0, 1, 0, 58, 665, 64, 665, 1, 2, 0, 0, 58, 665, 64, 665, 2, 1, 0, 0, 58, 665, 64, 665, 1, 2, 0, 0, 64559ULL, 176, 665, 3, 1, 0, 0, 155, 665, 79, 665, 1, 155, 665, 79, 665, 2, 0, 1, 0, 59, 665, 63, 665, 1, 2, 0, 0, 59, 665, 63, 665, 2, 1, 0, 0, 59, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 78, 665, 1, 156, 665, 78, 665, 2, 0, 1, 0, 60, 665, 62, 665, 1, 2, 0, 0, 60, 665, 62, 665, 2, 1, 0, 0, 60, 665, 62, 665, 1, 2, 0, 0, 65534ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 77, 665, 1, 157, 665, 77, 665, 2, 0, 1, 0, 61, 665, 61, 665, 1, 2, 0, 0, 61, 665, 61, 665, 2, 1, 0, 0, 61, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 76, 665, 1, 158, 665, 76, 665, 2, 0, 1, 0, 62, 665, 60, 665, 1, 2, 0, 0, 62, 665, 60, 665, 2, 1, 0, 0, 62, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 75, 665, 1, 159, 665, 75, 665, 2, 0, 1, 0, 63, 665, 59, 665, 1, 2, 0, 0, 63, 665, 59, 665, 2, 1, 0, 0, 63, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 74, 665, 1, 160, 665, 74, 665, 2, 0, 1, 0, 64, 665, 58, 665, 1, 2, 0, 0, 64, 665, 58, 665, 2, 1, 0, 0, 64, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 11, 4, 2, 0, 154, 665, 81, 665, 1, 154, 665, 81, 665, 2, 0, 1, 0, 58, 665, 65, 665, 1, 2, 0, 0, 58, 665, 65, 665, 2, 1, 0, 0, 58, 665, 65, 665, 1, 2, 0, 0, 64559ULL, 177, 665, 3, 1, 0, 0, 155, 665, 80, 665, 1, 155, 665, 80, 665, 2, 0, 1, 0, 59, 665, 64, 665, 1, 2, 0, 0, 59, 665, 64, 665, 2, 1, 0, 0, 59, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 79, 665, 1, 156, 665, 79, 665, 2, 0, 1, 0, 60, 665, 63, 665, 1, 2, 0, 0, 60, 665, 63, 665, 2, 1, 0, 0, 60, 665, 63, 665, 1, 2, 0, 0, 65534ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 78, 665, 1, 157, 665, 78, 665, 2, 0, 1, 0, 61, 665, 62, 665, 1, 2, 0, 0, 61, 665, 62, 665, 2, 1, 0, 0, 61, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 77, 665, 1, 158, 665, 77, 665, 2, 0, 1, 0, 62, 665, 61, 665, 1, 2, 0, 0, 62, 665, 61, 665, 2, 1, 0, 0, 62, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 76, 665, 1, 159, 665, 76, 665, 2, 0, 1, 0, 63, 665, 60, 665, 1, 2, 0, 0, 63, 665, 60, 665, 2, 1, 0, 0, 63, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 75, 665, 1, 160, 665, 75, 665, 2, 0, 1, 0, 64, 665, 59, 665, 1, 2, 0, 0, 64, 665, 59, 665, 2, 1, 0, 0, 64, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 74, 665, 1, 161, 665, 74, 665, 2, 0, 1, 0, 65, 665, 58, 665, 1, 2, 0, 0, 65, 665, 58, 665, 2, 1, 0, 0, 65, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 12, 3, 2, 0, 154, 665, 82, 665, 1, 154, 665, 82, 665, 2, 0, 1, 0, 58, 665, 66, 665, 1, 2, 0, 0, 58, 665, 66, 665, 2, 1, 0, 0, 58, 665, 66, 665, 1, 2, 0, 0, 64559ULL, 178, 665, 3, 1, 0, 0, 155, 665, 81, 665, 1, 155, 665, 81, 665, 2, 0, 1, 0, 59, 665, 65, 665, 1, 2, 0, 0, 59, 665, 65, 665, 2, 1, 0, 0, 59, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 80, 665, 1, 156, 665, 80, 665, 2, 0, 1, 0, 60, 665, 64, 665, 1, 2, 0, 0, 60, 665, 64, 665, 2, 1, 0, 0, 60, 665, 64, 665, 1, 2, 0, 0, 65534ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 79, 665, 1, 157, 665, 79, 665, 2, 0, 1, 0, 61, 665, 63, 665, 1, 2, 0, 0, 61, 665, 63, 665, 2, 1, 0, 0, 61, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 78, 665, 1, 158, 665, 78, 665, 2, 0, 1, 0, 62, 665, 62, 665, 1, 2, 0, 0, 62, 665, 62, 665, 2, 1, 0, 0, 62, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 77, 665, 1, 159, 665, 77, 665, 2, 0, 1, 0, 63, 665, 61, 665, 1, 2, 0, 0, 63, 665, 61, 665, 2, 1, 0, 0, 63, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 76, 665, 1, 160, 665, 76, 665, 2, 0, 1, 0, 64, 665, 60, 665, 1, 2, 0, 0, 64, 665, 60, 665, 2, 1, 0, 0, 64, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 75, 665, 1, 161, 665, 75, 665, 2, 0, 1, 0, 65, 665, 59, 665, 1, 2, 0, 0, 65, 665, 59, 665, 2, 1, 0, 0, 65, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 74, 665, 1, 162, 665, 74, 665, 2, 0, 1, 0, 66, 665, 58, 665, 1, 2, 0, 0, 66, 665, 58, 665, 2, 1, 0, 0, 66, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 13, 4, 2, 0, 154, 665, 83, 665, 1, 154, 665, 83, 665, 2, 0, 1, 0, 58, 665, 67, 665, 1, 2, 0, 0, 58, 665, 67, 665, 2, 1, 0, 0, 58, 665, 67, 665, 1, 2, 0, 0, 64559ULL, 179, 665, 3, 1, 0, 0, 155, 665, 82, 665, 1, 155, 665, 82, 665, 2, 0, 1, 0, 59, 665, 66, 665, 1, 2, 0, 0, 59, 665, 66, 665, 2, 1, 0, 0, 59, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 81, 665, 1, 156, 665, 81, 665, 2, 0, 1, 0, 60, 665, 65, 665, 1, 2, 0, 0, 60, 665, 65, 665, 2, 1, 0, 0, 60, 665, 65, 665, 1, 2, 0, 0, 65534ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 80, 665, 1, 157, 665, 80, 665, 2, 0, 1, 0, 61, 665, 64, 665, 1, 2, 0, 0, 61, 665, 64, 665, 2, 1, 0, 0, 61, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 79, 665, 1, 158, 665, 79, 665, 2, 0, 1, 0, 62, 665, 63, 665, 1, 2, 0, 0, 62, 665, 63, 665, 2, 1, 0, 0, 62, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 78, 665, 1, 159, 665, 78, 665, 2, 0, 1, 0, 63, 665, 62, 665, 1, 2, 0, 0, 63, 665, 62, 665, 2, 1, 0, 0, 63, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 77, 665, 1, 160, 665, 77, 665, 2, 0, 1, 0, 64, 665, 61, 665, 1, 2, 0, 0, 64, 665, 61, 665, 2, 1, 0, 0, 64, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 76, 665, 1, 161, 665, 76, 665, 2, 0, 1, 0, 65, 665, 60, 665, 1, 2, 0, 0, 65, 665, 60, 665, 2, 1, 0, 0, 65, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 75, 665, 1, 162, 665, 75, 665, 2, 0, 1, 0, 66, 665, 59, 665, 1, 2, 0, 0, 66, 665, 59, 665, 2, 1, 0, 0, 66, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 74, 665, 1, 163, 665, 74, 665, 2, 0, 1, 0, 67, 665, 58, 665, 1, 2, 0, 0, 67, 665, 58, 665, 2, 1, 0, 0, 67, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 14, 3, 2, 0, 154, 665, 84, 665, 1, 154, 665, 84, 665, 2, 0, 1, 0, 58, 665, 68, 665, 1, 2, 0, 0, 58, 665, 68, 665, 2, 1, 0, 0, 58, 665, 68, 665, 1, 2, 0, 0, 64559ULL, 180, 665, 3, 1, 0, 0, 155, 665, 83, 665, 1, 155, 665, 83, 665, 2, 0, 1, 0, 59, 665, 67, 665, 1, 2, 0, 0, 59, 665, 67, 665, 2, 1, 0, 0, 59, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 82, 665, 1, 156, 665, 82, 665, 2, 0, 1, 0, 60, 665, 66, 665, 1, 2, 0, 0, 60, 665, 66, 665, 2, 1, 0, 0, 60, 665, 66, 665, 1, 2, 0, 0, 65534ULL, 178, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 81, 665, 1, 157, 665, 81, 665, 2, 0, 1, 0, 61, 665, 65, 665, 1, 2, 0, 0, 61, 665, 65, 665, 2, 1, 0, 0, 61, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 80, 665, 1, 158, 665, 80, 665, 2, 0, 1, 0, 62, 665, 64, 665, 1, 2, 0, 0, 62, 665, 64, 665, 2, 1, 0, 0, 62, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 79, 665, 1, 159, 665, 79, 665, 2, 0, 1, 0, 63, 665, 63, 665, 1, 2, 0, 0, 63, 665, 63, 665, 2, 1, 0, 0, 63, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 78, 665, 1, 160, 665, 78, 665, 2, 0, 1, 0, 64, 665, 62, 665, 1, 2, 0, 0, 64, 665, 62, 665, 2, 1, 0, 0, 64, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 77, 665, 1, 161, 665, 77, 665, 2, 0, 1, 0, 65, 665, 61, 665, 1, 2, 0, 0, 65, 665, 61, 665, 2, 1, 0, 0, 65, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 76, 665, 1, 162, 665, 76, 665, 2, 0, 1, 0, 66, 665, 60, 665, 1, 2, 0, 0, 66, 665, 60, 665, 2, 1, 0, 0, 66, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 75, 665, 1, 163, 665, 75, 665, 2, 0, 1, 0, 67, 665, 59, 665, 1, 2, 0, 0, 67, 665, 59, 665, 2, 1, 0, 0, 67, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 74, 665, 1, 164, 665, 74, 665, 2, 0, 1, 0, 68, 665, 58, 665, 1, 2, 0, 0, 68, 665, 58, 665, 2, 1, 0, 0, 68, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 15, 4, 2, 0, 154, 665, 85, 665, 1, 154, 665, 85, 665, 2, 0, 1, 0, 58, 665, 69, 665, 1, 2, 0, 0, 58, 665, 69, 665, 2, 1, 0, 0, 58, 665, 69, 665, 1, 2, 0, 0, 64559ULL, 181, 665, 3, 1, 0, 0, 155, 665, 84, 665, 1, 155, 665, 84, 665, 2, 0, 1, 0, 59, 665, 68, 665, 1, 2, 0, 0, 59, 665, 68, 665, 2, 1, 0, 0, 59, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 83, 665, 1, 156, 665, 83, 665, 2, 0, 1, 0, 60, 665, 67, 665, 1, 2, 0, 0, 60, 665, 67, 665, 2, 1, 0, 0, 60, 665, 67, 665, 1, 2, 0, 0, 65534ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 82, 665, 1, 157, 665, 82, 665, 2, 0, 1, 0, 61, 665, 66, 665, 1, 2, 0, 0, 61, 665, 66, 665, 2, 1, 0, 0, 61, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 81, 665, 1, 158, 665, 81, 665, 2, 0, 1, 0, 62, 665, 65, 665, 1, 2, 0, 0, 62, 665, 65, 665, 2, 1, 0, 0, 62, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 80, 665, 1, 159, 665, 80, 665, 2, 0, 1, 0, 63, 665, 64, 665, 1, 2, 0, 0, 63, 665, 64, 665, 2, 1, 0, 0, 63, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 79, 665, 1, 160, 665, 79, 665, 2, 0, 1, 0, 64, 665, 63, 665, 1, 2, 0, 0, 64, 665, 63, 665, 2, 1, 0, 0, 64, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 78, 665, 1, 161, 665, 78, 665, 2, 0, 1, 0, 65, 665, 62, 665, 1, 2, 0, 0, 65, 665, 62, 665, 2, 1, 0, 0, 65, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 77, 665, 1, 162, 665, 77, 665, 2, 0, 1, 0, 66, 665, 61, 665, 1, 2, 0, 0, 66, 665, 61, 665, 2, 1, 0, 0, 66, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 76, 665, 1, 163, 665, 76, 665, 2, 0, 1, 0, 67, 665, 60, 665, 1, 2, 0, 0, 67, 665, 60, 665, 2, 1, 0, 0, 67, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 75, 665, 1, 164, 665, 75, 665, 2, 0, 1, 0, 68, 665, 59, 665, 1, 2, 0, 0, 68, 665, 59, 665, 2, 1, 0, 0, 68, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 74, 665, 1, 165, 665, 74, 665, 2, 0, 1, 0, 69, 665, 58, 665, 1, 2, 0, 0, 69, 665, 58, 665, 2, 1, 0, 0, 69, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 16, 3, 2, 0, 154, 665, 86, 665, 1, 154, 665, 86, 665, 2, 0, 1, 0, 58, 665, 70, 665, 1, 2, 0, 0, 58, 665, 70, 665, 2, 1, 0, 0, 58, 665, 70, 665, 1, 2, 0, 0, 64559ULL, 182, 665, 3, 1, 0, 0, 155, 665, 85, 665, 1, 155, 665, 85, 665, 2, 0, 1, 0, 59, 665, 69, 665, 1, 2, 0, 0, 59, 665, 69, 665, 2, 1, 0, 0, 59, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 84, 665, 1, 156, 665, 84, 665, 2, 0, 1, 0, 60, 665, 68, 665, 1, 2, 0, 0, 60, 665, 68, 665, 2, 1, 0, 0, 60, 665, 68, 665, 1, 2, 0, 0, 65534ULL, 180, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 83, 665, 1, 157, 665, 83, 665, 2, 0, 1, 0, 61, 665, 67, 665, 1, 2, 0, 0, 61, 665, 67, 665, 2, 1, 0, 0, 61, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 82, 665, 1, 158, 665, 82, 665, 2, 0, 1, 0, 62, 665, 66, 665, 1, 2, 0, 0, 62, 665, 66, 665, 2, 1, 0, 0, 62, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 81, 665, 1, 159, 665, 81, 665, 2, 0, 1, 0, 63, 665, 65, 665, 1, 2, 0, 0, 63, 665, 65, 665, 2, 1, 0, 0, 63, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 80, 665, 1, 160, 665, 80, 665, 2, 0, 1, 0, 64, 665, 64, 665, 1, 2, 0, 0, 64, 665, 64, 665, 2, 1, 0, 0, 64, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 79, 665, 1, 161, 665, 79, 665, 2, 0, 1, 0, 65, 665, 63, 665, 1, 2, 0, 0, 65, 665, 63, 665, 2, 1, 0, 0, 65, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 78, 665, 1, 162, 665, 78, 665, 2, 0, 1, 0, 66, 665, 62, 665, 1, 2, 0, 0, 66, 665, 62, 665, 2, 1, 0, 0, 66, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 77, 665, 1, 163, 665, 77, 665, 2, 0, 1, 0, 67, 665, 61, 665, 1, 2, 0, 0, 67, 665, 61, 665, 2, 1, 0, 0, 67, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 76, 665, 1, 164, 665, 76, 665, 2, 0, 1, 0, 68, 665, 60, 665, 1, 2, 0, 0, 68, 665, 60, 665, 2, 1, 0, 0, 68, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 75, 665, 1, 165, 665, 75, 665, 2, 0, 1, 0, 69, 665, 59, 665, 1, 2, 0, 0, 69, 665, 59, 665, 2, 1, 0, 0, 69, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 74, 665, 1, 166, 665, 74, 665, 2, 0, 1, 0, 70, 665, 58, 665, 1, 2, 0, 0, 70, 665, 58, 665, 2, 1, 0, 0, 70, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 17, 4, 2, 0, 154, 665, 87, 665, 1, 154, 665, 87, 665, 2, 0, 1, 0, 58, 665, 71, 665, 1, 2, 0, 0, 58, 665, 71, 665, 2, 1, 0, 0, 58, 665, 71, 665, 1, 2, 0, 0, 64559ULL, 183, 665, 3, 1, 0, 0, 155, 665, 86, 665, 1, 155, 665, 86, 665, 2, 0, 1, 0, 59, 665, 70, 665, 1, 2, 0, 0, 59, 665, 70, 665, 2, 1, 0, 0, 59, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 85, 665, 1, 156, 665, 85, 665, 2, 0, 1, 0, 60, 665, 69, 665, 1, 2, 0, 0, 60, 665, 69, 665, 2, 1, 0, 0, 60, 665, 69, 665, 1, 2, 0, 0, 65534ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 84, 665, 1, 157, 665, 84, 665, 2, 0, 1, 0, 61, 665, 68, 665, 1, 2, 0, 0, 61, 665, 68, 665, 2, 1, 0, 0, 61, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 83, 665, 1, 158, 665, 83, 665, 2, 0, 1, 0, 62, 665, 67, 665, 1, 2, 0, 0, 62, 665, 67, 665, 2, 1, 0, 0, 62, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 82, 665, 1, 159, 665, 82, 665, 2, 0, 1, 0, 63, 665, 66, 665, 1, 2, 0, 0, 63, 665, 66, 665, 2, 1, 0, 0, 63, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 81, 665, 1, 160, 665, 81, 665, 2, 0, 1, 0, 64, 665, 65, 665, 1, 2, 0, 0, 64, 665, 65, 665, 2, 1, 0, 0, 64, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 80, 665, 1, 161, 665, 80, 665, 2, 0, 1, 0, 65, 665, 64, 665, 1, 2, 0, 0, 65, 665, 64, 665, 2, 1, 0, 0, 65, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 79, 665, 1, 162, 665, 79, 665, 2, 0, 1, 0, 66, 665, 63, 665, 1, 2, 0, 0, 66, 665, 63, 665, 2, 1, 0, 0, 66, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 78, 665, 1, 163, 665, 78, 665, 2, 0, 1, 0, 67, 665, 62, 665, 1, 2, 0, 0, 67, 665, 62, 665, 2, 1, 0, 0, 67, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 77, 665, 1, 164, 665, 77, 665, 2, 0, 1, 0, 68, 665, 61, 665, 1, 2, 0, 0, 68, 665, 61, 665, 2, 1, 0, 0, 68, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 76, 665, 1, 165, 665, 76, 665, 2, 0, 1, 0, 69, 665, 60, 665, 1, 2, 0, 0, 69, 665, 60, 665, 2, 1, 0, 0, 69, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 75, 665, 1, 166, 665, 75, 665, 2, 0, 1, 0, 70, 665, 59, 665, 1, 2, 0, 0, 70, 665, 59, 665, 2, 1, 0, 0, 70, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 74, 665, 1, 167, 665, 74, 665, 2, 0, 1, 0, 71, 665, 58, 665, 1, 2, 0, 0, 71, 665, 58, 665, 2, 1, 0, 0, 71, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 18, 3, 2, 0, 154, 665, 88, 665, 1, 154, 665, 88, 665, 2, 0, 1, 0, 58, 665, 72, 665, 1, 2, 0, 0, 58, 665, 72, 665, 2, 1, 0, 0, 58, 665, 72, 665, 1, 2, 0, 0, 64559ULL, 184, 665, 3, 1, 0, 0, 155, 665, 87, 665, 1, 155, 665, 87, 665, 2, 0, 1, 0, 59, 665, 71, 665, 1, 2, 0, 0, 59, 665, 71, 665, 2, 1, 0, 0, 59, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 86, 665, 1, 156, 665, 86, 665, 2, 0, 1, 0, 60, 665, 70, 665, 1, 2, 0, 0, 60, 665, 70, 665, 2, 1, 0, 0, 60, 665, 70, 665, 1, 2, 0, 0, 65534ULL, 182, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 85, 665, 1, 157, 665, 85, 665, 2, 0, 1, 0, 61, 665, 69, 665, 1, 2, 0, 0, 61, 665, 69, 665, 2, 1, 0, 0, 61, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 84, 665, 1, 158, 665, 84, 665, 2, 0, 1, 0, 62, 665, 68, 665, 1, 2, 0, 0, 62, 665, 68, 665, 2, 1, 0, 0, 62, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 83, 665, 1, 159, 665, 83, 665, 2, 0, 1, 0, 63, 665, 67, 665, 1, 2, 0, 0, 63, 665, 67, 665, 2, 1, 0, 0, 63, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 82, 665, 1, 160, 665, 82, 665, 2, 0, 1, 0, 64, 665, 66, 665, 1, 2, 0, 0, 64, 665, 66, 665, 2, 1, 0, 0, 64, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 81, 665, 1, 161, 665, 81, 665, 2, 0, 1, 0, 65, 665, 65, 665, 1, 2, 0, 0, 65, 665, 65, 665, 2, 1, 0, 0, 65, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 80, 665, 1, 162, 665, 80, 665, 2, 0, 1, 0, 66, 665, 64, 665, 1, 2, 0, 0, 66, 665, 64, 665, 2, 1, 0, 0, 66, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 79, 665, 1, 163, 665, 79, 665, 2, 0, 1, 0, 67, 665, 63, 665, 1, 2, 0, 0, 67, 665, 63, 665, 2, 1, 0, 0, 67, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 78, 665, 1, 164, 665, 78, 665, 2, 0, 1, 0, 68, 665, 62, 665, 1, 2, 0, 0, 68, 665, 62, 665, 2, 1, 0, 0, 68, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 77, 665, 1, 165, 665, 77, 665, 2, 0, 1, 0, 69, 665, 61, 665, 1, 2, 0, 0, 69, 665, 61, 665, 2, 1, 0, 0, 69, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 76, 665, 1, 166, 665, 76, 665, 2, 0, 1, 0, 70, 665, 60, 665, 1, 2, 0, 0, 70, 665, 60, 665, 2, 1, 0, 0, 70, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 75, 665, 1, 167, 665, 75, 665, 2, 0, 1, 0, 71, 665, 59, 665, 1, 2, 0, 0, 71, 665, 59, 665, 2, 1, 0, 0, 71, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 74, 665, 1, 168, 665, 74, 665, 2, 0, 1, 0, 72, 665, 58, 665, 1, 2, 0, 0, 72, 665, 58, 665, 2, 1, 0, 0, 72, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 19, 4, 2, 0, 154, 665, 89, 665, 1, 154, 665, 89, 665, 2, 0, 1, 0, 58, 665, 73, 665, 1, 2, 0, 0, 58, 665, 73, 665, 2, 1, 0, 0, 58, 665, 73, 665, 1, 2, 0, 0, 64559ULL, 185, 665, 3, 1, 0, 0, 155, 665, 88, 665, 1, 155, 665, 88, 665, 2, 0, 1, 0, 59, 665, 72, 665, 1, 2, 0, 0, 59, 665, 72, 665, 2, 1, 0, 0, 59, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 87, 665, 1, 156, 665, 87, 665, 2, 0, 1, 0, 60, 665, 71, 665, 1, 2, 0, 0, 60, 665, 71, 665, 2, 1, 0, 0, 60, 665, 71, 665, 1, 2, 0, 0, 65534ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 86, 665, 1, 157, 665, 86, 665, 2, 0, 1, 0, 61, 665, 70, 665, 1, 2, 0, 0, 61, 665, 70, 665, 2, 1, 0, 0, 61, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 85, 665, 1, 158, 665, 85, 665, 2, 0, 1, 0, 62, 665, 69, 665, 1, 2, 0, 0, 62, 665, 69, 665, 2, 1, 0, 0, 62, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 84, 665, 1, 159, 665, 84, 665, 2, 0, 1, 0, 63, 665, 68, 665, 1, 2, 0, 0, 63, 665, 68, 665, 2, 1, 0, 0, 63, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 83, 665, 1, 160, 665, 83, 665, 2, 0, 1, 0, 64, 665, 67, 665, 1, 2, 0, 0, 64, 665, 67, 665, 2, 1, 0, 0, 64, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 82, 665, 1, 161, 665, 82, 665, 2, 0, 1, 0, 65, 665, 66, 665, 1, 2, 0, 0, 65, 665, 66, 665, 2, 1, 0, 0, 65, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 81, 665, 1, 162, 665, 81, 665, 2, 0, 1, 0, 66, 665, 65, 665, 1, 2, 0, 0, 66, 665, 65, 665, 2, 1, 0, 0, 66, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 80, 665, 1, 163, 665, 80, 665, 2, 0, 1, 0, 67, 665, 64, 665, 1, 2, 0, 0, 67, 665, 64, 665, 2, 1, 0, 0, 67, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 79, 665, 1, 164, 665, 79, 665, 2, 0, 1, 0, 68, 665, 63, 665, 1, 2, 0, 0, 68, 665, 63, 665, 2, 1, 0, 0, 68, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 78, 665, 1, 165, 665, 78, 665, 2, 0, 1, 0, 69, 665, 62, 665, 1, 2, 0, 0, 69, 665, 62, 665, 2, 1, 0, 0, 69, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 77, 665, 1, 166, 665, 77, 665, 2, 0, 1, 0, 70, 665, 61, 665, 1, 2, 0, 0, 70, 665, 61, 665, 2, 1, 0, 0, 70, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 76, 665, 1, 167, 665, 76, 665, 2, 0, 1, 0, 71, 665, 60, 665, 1, 2, 0, 0, 71, 665, 60, 665, 2, 1, 0, 0, 71, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 75, 665, 1, 168, 665, 75, 665, 2, 0, 1, 0, 72, 665, 59, 665, 1, 2, 0, 0, 72, 665, 59, 665, 2, 1, 0, 0, 72, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 74, 665, 1, 169, 665, 74, 665, 2, 0, 1, 0, 73, 665, 58, 665, 1, 2, 0, 0, 73, 665, 58, 665, 2, 1, 0, 0, 73, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 20, 3, 2, 0, 155, 665, 89, 665, 1, 155, 665, 89, 665, 2, 0, 1, 0, 59, 665, 73, 665, 1, 2, 0, 0, 59, 665, 73, 665, 2, 1, 0, 0, 59, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 156, 665, 88, 665, 1, 156, 665, 88, 665, 2, 0, 1, 0, 60, 665, 72, 665, 1, 2, 0, 0, 60, 665, 72, 665, 2, 1, 0, 0, 60, 665, 72, 665, 1, 2, 0, 0, 65534ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 157, 665, 87, 665, 1, 157, 665, 87, 665, 2, 0, 1, 0, 61, 665, 71, 665, 1, 2, 0, 0, 61, 665, 71, 665, 2, 1, 0, 0, 61, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 158, 665, 86, 665, 1, 158, 665, 86, 665, 2, 0, 1, 0, 62, 665, 70, 665, 1, 2, 0, 0, 62, 665, 70, 665, 2, 1, 0, 0, 62, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 159, 665, 85, 665, 1, 159, 665, 85, 665, 2, 0, 1, 0, 63, 665, 69, 665, 1, 2, 0, 0, 63, 665, 69, 665, 2, 1, 0, 0, 63, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 160, 665, 84, 665, 1, 160, 665, 84, 665, 2, 0, 1, 0, 64, 665, 68, 665, 1, 2, 0, 0, 64, 665, 68, 665, 2, 1, 0, 0, 64, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 161, 665, 83, 665, 1, 161, 665, 83, 665, 2, 0, 1, 0, 65, 665, 67, 665, 1, 2, 0, 0, 65, 665, 67, 665, 2, 1, 0, 0, 65, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 162, 665, 82, 665, 1, 162, 665, 82, 665, 2, 0, 1, 0, 66, 665, 66, 665, 1, 2, 0, 0, 66, 665, 66, 665, 2, 1, 0, 0, 66, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 81, 665, 1, 163, 665, 81, 665, 2, 0, 1, 0, 67, 665, 65, 665, 1, 2, 0, 0, 67, 665, 65, 665, 2, 1, 0, 0, 67, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 80, 665, 1, 164, 665, 80, 665, 2, 0, 1, 0, 68, 665, 64, 665, 1, 2, 0, 0, 68, 665, 64, 665, 2, 1, 0, 0, 68, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 79, 665, 1, 165, 665, 79, 665, 2, 0, 1, 0, 69, 665, 63, 665, 1, 2, 0, 0, 69, 665, 63, 665, 2, 1, 0, 0, 69, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 78, 665, 1, 166, 665, 78, 665, 2, 0, 1, 0, 70, 665, 62, 665, 1, 2, 0, 0, 70, 665, 62, 665, 2, 1, 0, 0, 70, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 77, 665, 1, 167, 665, 77, 665, 2, 0, 1, 0, 71, 665, 61, 665, 1, 2, 0, 0, 71, 665, 61, 665, 2, 1, 0, 0, 71, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 76, 665, 1, 168, 665, 76, 665, 2, 0, 1, 0, 72, 665, 60, 665, 1, 2, 0, 0, 72, 665, 60, 665, 2, 1, 0, 0, 72, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 75, 665, 1, 169, 665, 75, 665, 2, 0, 1, 0, 73, 665, 59, 665, 1, 2, 0, 0, 73, 665, 59, 665, 2, 1, 0, 0, 73, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 0, 4, 2, 21, 0, 258236ULL, 0, 156, 665, 89, 665, 1, 156, 665, 89, 665, 2, 0, 1, 0, 60, 665, 73, 665, 1, 2, 0, 0, 60, 665, 73, 665, 2, 1, 0, 0, 60, 665, 73, 665, 1, 2, 0, 0, 65534ULL, 185, 665, 3, 1, 0, 0, 157, 665, 88, 665, 1, 157, 665, 88, 665, 2, 0, 1, 0, 61, 665, 72, 665, 1, 2, 0, 0, 61, 665, 72, 665, 2, 1, 0, 0, 61, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 87, 665, 1, 158, 665, 87, 665, 2, 0, 1, 0, 62, 665, 71, 665, 1, 2, 0, 0, 62, 665, 71, 665, 2, 1, 0, 0, 62, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 86, 665, 1, 159, 665, 86, 665, 2, 0, 1, 0, 63, 665, 70, 665, 1, 2, 0, 0, 63, 665, 70, 665, 2, 1, 0, 0, 63, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 85, 665, 1, 160, 665, 85, 665, 2, 0, 1, 0, 64, 665, 69, 665, 1, 2, 0, 0, 64, 665, 69, 665, 2, 1, 0, 0, 64, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 84, 665, 1, 161, 665, 84, 665, 2, 0, 1, 0, 65, 665, 68, 665, 1, 2, 0, 0, 65, 665, 68, 665, 2, 1, 0, 0, 65, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 83, 665, 1, 162, 665, 83, 665, 2, 0, 1, 0, 66, 665, 67, 665, 1, 2, 0, 0, 66, 665, 67, 665, 2, 1, 0, 0, 66, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 82, 665, 1, 163, 665, 82, 665, 2, 0, 1, 0, 67, 665, 66, 665, 1, 2, 0, 0, 67, 665, 66, 665, 2, 1, 0, 0, 67, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 81, 665, 1, 164, 665, 81, 665, 2, 0, 1, 0, 68, 665, 65, 665, 1, 2, 0, 0, 68, 665, 65, 665, 2, 1, 0, 0, 68, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 80, 665, 1, 165, 665, 80, 665, 2, 0, 1, 0, 69, 665, 64, 665, 1, 2, 0, 0, 69, 665, 64, 665, 2, 1, 0, 0, 69, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 79, 665, 1, 166, 665, 79, 665, 2, 0, 1, 0, 70, 665, 63, 665, 1, 2, 0, 0, 70, 665, 63, 665, 2, 1, 0, 0, 70, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 78, 665, 1, 167, 665, 78, 665, 2, 0, 1, 0, 71, 665, 62, 665, 1, 2, 0, 0, 71, 665, 62, 665, 2, 1, 0, 0, 71, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 77, 665, 1, 168, 665, 77, 665, 2, 0, 1, 0, 72, 665, 61, 665, 1, 2, 0, 0, 72, 665, 61, 665, 2, 1, 0, 0, 72, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 76, 665, 1, 169, 665, 76, 665, 2, 0, 1, 0, 73, 665, 60, 665, 1, 2, 0, 0, 73, 665, 60, 665, 2, 1, 0, 0, 73, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 0, 3, 2, 22, 0, 262140ULL, 0, 157, 665, 89, 665, 1, 157, 665, 89, 665, 2, 0, 1, 0, 61, 665, 73, 665, 1, 2, 0, 0, 61, 665, 73, 665, 2, 1, 0, 0, 61, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 158, 665, 88, 665, 1, 158, 665, 88, 665, 2, 0, 1, 0, 62, 665, 72, 665, 1, 2, 0, 0, 62, 665, 72, 665, 2, 1, 0, 0, 62, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 159, 665, 87, 665, 1, 159, 665, 87, 665, 2, 0, 1, 0, 63, 665, 71, 665, 1, 2, 0, 0, 63, 665, 71, 665, 2, 1, 0, 0, 63, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 160, 665, 86, 665, 1, 160, 665, 86, 665, 2, 0, 1, 0, 64, 665, 70, 665, 1, 2, 0, 0, 64, 665, 70, 665, 2, 1, 0, 0, 64, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 161, 665, 85, 665, 1, 161, 665, 85, 665, 2, 0, 1, 0, 65, 665, 69, 665, 1, 2, 0, 0, 65, 665, 69, 665, 2, 1, 0, 0, 65, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 162, 665, 84, 665, 1, 162, 665, 84, 665, 2, 0, 1, 0, 66, 665, 68, 665, 1, 2, 0, 0, 66, 665, 68, 665, 2, 1, 0, 0, 66, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 83, 665, 1, 163, 665, 83, 665, 2, 0, 1, 0, 67, 665, 67, 665, 1, 2, 0, 0, 67, 665, 67, 665, 2, 1, 0, 0, 67, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 82, 665, 1, 164, 665, 82, 665, 2, 0, 1, 0, 68, 665, 66, 665, 1, 2, 0, 0, 68, 665, 66, 665, 2, 1, 0, 0, 68, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 81, 665, 1, 165, 665, 81, 665, 2, 0, 1, 0, 69, 665, 65, 665, 1, 2, 0, 0, 69, 665, 65, 665, 2, 1, 0, 0, 69, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 80, 665, 1, 166, 665, 80, 665, 2, 0, 1, 0, 70, 665, 64, 665, 1, 2, 0, 0, 70, 665, 64, 665, 2, 1, 0, 0, 70, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 79, 665, 1, 167, 665, 79, 665, 2, 0, 1, 0, 71, 665, 63, 665, 1, 2, 0, 0, 71, 665, 63, 665, 2, 1, 0, 0, 71, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 78, 665, 1, 168, 665, 78, 665, 2, 0, 1, 0, 72, 665, 62, 665, 1, 2, 0, 0, 72, 665, 62, 665, 2, 1, 0, 0, 72, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 77, 665, 1, 169, 665, 77, 665, 2, 0, 1, 0, 73, 665, 61, 665, 1, 2, 0, 0, 73, 665, 61, 665, 2, 1, 0, 0, 73, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 0, 4, 2, 23, 0, 262136ULL, 0, 158, 665, 89, 665, 1, 158, 665, 89, 665, 2, 0, 1, 0, 62, 665, 73, 665, 1, 2, 0, 0, 62, 665, 73, 665, 2, 1, 0, 0, 62, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 159, 665, 88, 665, 1, 159, 665, 88, 665, 2, 0, 1, 0, 63, 665, 72, 665, 1, 2, 0, 0, 63, 665, 72, 665, 2, 1, 0, 0, 63, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 87, 665, 1, 160, 665, 87, 665, 2, 0, 1, 0, 64, 665, 71, 665, 1, 2, 0, 0, 64, 665, 71, 665, 2, 1, 0, 0, 64, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 86, 665, 1, 161, 665, 86, 665, 2, 0, 1, 0, 65, 665, 70, 665, 1, 2, 0, 0, 65, 665, 70, 665, 2, 1, 0, 0, 65, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 85, 665, 1, 162, 665, 85, 665, 2, 0, 1, 0, 66, 665, 69, 665, 1, 2, 0, 0, 66, 665, 69, 665, 2, 1, 0, 0, 66, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 84, 665, 1, 163, 665, 84, 665, 2, 0, 1, 0, 67, 665, 68, 665, 1, 2, 0, 0, 67, 665, 68, 665, 2, 1, 0, 0, 67, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 83, 665, 1, 164, 665, 83, 665, 2, 0, 1, 0, 68, 665, 67, 665, 1, 2, 0, 0, 68, 665, 67, 665, 2, 1, 0, 0, 68, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 82, 665, 1, 165, 665, 82, 665, 2, 0, 1, 0, 69, 665, 66, 665, 1, 2, 0, 0, 69, 665, 66, 665, 2, 1, 0, 0, 69, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 81, 665, 1, 166, 665, 81, 665, 2, 0, 1, 0, 70, 665, 65, 665, 1, 2, 0, 0, 70, 665, 65, 665, 2, 1, 0, 0, 70, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 80, 665, 1, 167, 665, 80, 665, 2, 0, 1, 0, 71, 665, 64, 665, 1, 2, 0, 0, 71, 665, 64, 665, 2, 1, 0, 0, 71, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 79, 665, 1, 168, 665, 79, 665, 2, 0, 1, 0, 72, 665, 63, 665, 1, 2, 0, 0, 72, 665, 63, 665, 2, 1, 0, 0, 72, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 78, 665, 1, 169, 665, 78, 665, 2, 0, 1, 0, 73, 665, 62, 665, 1, 2, 0, 0, 73, 665, 62, 665, 2, 1, 0, 0, 73, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 0, 3, 2, 24, 0, 262140ULL, 0, 159, 665, 89, 665, 1, 159, 665, 89, 665, 2, 0, 1, 0, 63, 665, 73, 665, 1, 2, 0, 0, 63, 665, 73, 665, 2, 1, 0, 0, 63, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 160, 665, 88, 665, 1, 160, 665, 88, 665, 2, 0, 1, 0, 64, 665, 72, 665, 1, 2, 0, 0, 64, 665, 72, 665, 2, 1, 0, 0, 64, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 161, 665, 87, 665, 1, 161, 665, 87, 665, 2, 0, 1, 0, 65, 665, 71, 665, 1, 2, 0, 0, 65, 665, 71, 665, 2, 1, 0, 0, 65, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 162, 665, 86, 665, 1, 162, 665, 86, 665, 2, 0, 1, 0, 66, 665, 70, 665, 1, 2, 0, 0, 66, 665, 70, 665, 2, 1, 0, 0, 66, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 85, 665, 1, 163, 665, 85, 665, 2, 0, 1, 0, 67, 665, 69, 665, 1, 2, 0, 0, 67, 665, 69, 665, 2, 1, 0, 0, 67, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 84, 665, 1, 164, 665, 84, 665, 2, 0, 1, 0, 68, 665, 68, 665, 1, 2, 0, 0, 68, 665, 68, 665, 2, 1, 0, 0, 68, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 83, 665, 1, 165, 665, 83, 665, 2, 0, 1, 0, 69, 665, 67, 665, 1, 2, 0, 0, 69, 665, 67, 665, 2, 1, 0, 0, 69, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 82, 665, 1, 166, 665, 82, 665, 2, 0, 1, 0, 70, 665, 66, 665, 1, 2, 0, 0, 70, 665, 66, 665, 2, 1, 0, 0, 70, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 81, 665, 1, 167, 665, 81, 665, 2, 0, 1, 0, 71, 665, 65, 665, 1, 2, 0, 0, 71, 665, 65, 665, 2, 1, 0, 0, 71, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 80, 665, 1, 168, 665, 80, 665, 2, 0, 1, 0, 72, 665, 64, 665, 1, 2, 0, 0, 72, 665, 64, 665, 2, 1, 0, 0, 72, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 79, 665, 1, 169, 665, 79, 665, 2, 0, 1, 0, 73, 665, 63, 665, 1, 2, 0, 0, 73, 665, 63, 665, 2, 1, 0, 0, 73, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 0, 4, 2, 25, 0, 262140ULL, 0, 160, 665, 89, 665, 1, 160, 665, 89, 665, 2, 0, 1, 0, 64, 665, 73, 665, 1, 2, 0, 0, 64, 665, 73, 665, 2, 1, 0, 0, 64, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 161, 665, 88, 665, 1, 161, 665, 88, 665, 2, 0, 1, 0, 65, 665, 72, 665, 1, 2, 0, 0, 65, 665, 72, 665, 2, 1, 0, 0, 65, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 87, 665, 1, 162, 665, 87, 665, 2, 0, 1, 0, 66, 665, 71, 665, 1, 2, 0, 0, 66, 665, 71, 665, 2, 1, 0, 0, 66, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 86, 665, 1, 163, 665, 86, 665, 2, 0, 1, 0, 67, 665, 70, 665, 1, 2, 0, 0, 67, 665, 70, 665, 2, 1, 0, 0, 67, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 85, 665, 1, 164, 665, 85, 665, 2, 0, 1, 0, 68, 665, 69, 665, 1, 2, 0, 0, 68, 665, 69, 665, 2, 1, 0, 0, 68, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 84, 665, 1, 165, 665, 84, 665, 2, 0, 1, 0, 69, 665, 68, 665, 1, 2, 0, 0, 69, 665, 68, 665, 2, 1, 0, 0, 69, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 83, 665, 1, 166, 665, 83, 665, 2, 0, 1, 0, 70, 665, 67, 665, 1, 2, 0, 0, 70, 665, 67, 665, 2, 1, 0, 0, 70, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 82, 665, 1, 167, 665, 82, 665, 2, 0, 1, 0, 71, 665, 66, 665, 1, 2, 0, 0, 71, 665, 66, 665, 2, 1, 0, 0, 71, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 81, 665, 1, 168, 665, 81, 665, 2, 0, 1, 0, 72, 665, 65, 665, 1, 2, 0, 0, 72, 665, 65, 665, 2, 1, 0, 0, 72, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 80, 665, 1, 169, 665, 80, 665, 2, 0, 1, 0, 73, 665, 64, 665, 1, 2, 0, 0, 73, 665, 64, 665, 2, 1, 0, 0, 73, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 0, 3, 2, 26, 0, 262140ULL, 0, 161, 665, 89, 665, 1, 161, 665, 89, 665, 2, 0, 1, 0, 65, 665, 73, 665, 1, 2, 0, 0, 65, 665, 73, 665, 2, 1, 0, 0, 65, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 162, 665, 88, 665, 1, 162, 665, 88, 665, 2, 0, 1, 0, 66, 665, 72, 665, 1, 2, 0, 0, 66, 665, 72, 665, 2, 1, 0, 0, 66, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 87, 665, 1, 163, 665, 87, 665, 2, 0, 1, 0, 67, 665, 71, 665, 1, 2, 0, 0, 67, 665, 71, 665, 2, 1, 0, 0, 67, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 86, 665, 1, 164, 665, 86, 665, 2, 0, 1, 0, 68, 665, 70, 665, 1, 2, 0, 0, 68, 665, 70, 665, 2, 1, 0, 0, 68, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 85, 665, 1, 165, 665, 85, 665, 2, 0, 1, 0, 69, 665, 69, 665, 1, 2, 0, 0, 69, 665, 69, 665, 2, 1, 0, 0, 69, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 84, 665, 1, 166, 665, 84, 665, 2, 0, 1, 0, 70, 665, 68, 665, 1, 2, 0, 0, 70, 665, 68, 665, 2, 1, 0, 0, 70, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 83, 665, 1, 167, 665, 83, 665, 2, 0, 1, 0, 71, 665, 67, 665, 1, 2, 0, 0, 71, 665, 67, 665, 2, 1, 0, 0, 71, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 82, 665, 1, 168, 665, 82, 665, 2, 0, 1, 0, 72, 665, 66, 665, 1, 2, 0, 0, 72, 665, 66, 665, 2, 1, 0, 0, 72, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 81, 665, 1, 169, 665, 81, 665, 2, 0, 1, 0, 73, 665, 65, 665, 1, 2, 0, 0, 73, 665, 65, 665, 2, 1, 0, 0, 73, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 0, 4, 2, 27, 0, 262140ULL, 0, 162, 665, 89, 665, 1, 162, 665, 89, 665, 2, 0, 1, 0, 66, 665, 73, 665, 1, 2, 0, 0, 66, 665, 73, 665, 2, 1, 0, 0, 66, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 163, 665, 88, 665, 1, 163, 665, 88, 665, 2, 0, 1, 0, 67, 665, 72, 665, 1, 2, 0, 0, 67, 665, 72, 665, 2, 1, 0, 0, 67, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 87, 665, 1, 164, 665, 87, 665, 2, 0, 1, 0, 68, 665, 71, 665, 1, 2, 0, 0, 68, 665, 71, 665, 2, 1, 0, 0, 68, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 86, 665, 1, 165, 665, 86, 665, 2, 0, 1, 0, 69, 665, 70, 665, 1, 2, 0, 0, 69, 665, 70, 665, 2, 1, 0, 0, 69, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 85, 665, 1, 166, 665, 85, 665, 2, 0, 1, 0, 70, 665, 69, 665, 1, 2, 0, 0, 70, 665, 69, 665, 2, 1, 0, 0, 70, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 84, 665, 1, 167, 665, 84, 665, 2, 0, 1, 0, 71, 665, 68, 665, 1, 2, 0, 0, 71, 665, 68, 665, 2, 1, 0, 0, 71, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 83, 665, 1, 168, 665, 83, 665, 2, 0, 1, 0, 72, 665, 67, 665, 1, 2, 0, 0, 72, 665, 67, 665, 2, 1, 0, 0, 72, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 82, 665, 1, 169, 665, 82, 665, 2, 0, 1, 0, 73, 665, 66, 665, 1, 2, 0, 0, 73, 665, 66, 665, 2, 1, 0, 0, 73, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 0, 3, 2, 28, 0, 262140ULL, 0, 163, 665, 89, 665, 1, 163, 665, 89, 665, 2, 0, 1, 0, 67, 665, 73, 665, 1, 2, 0, 0, 67, 665, 73, 665, 2, 1, 0, 0, 67, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 164, 665, 88, 665, 1, 164, 665, 88, 665, 2, 0, 1, 0, 68, 665, 72, 665, 1, 2, 0, 0, 68, 665, 72, 665, 2, 1, 0, 0, 68, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 87, 665, 1, 165, 665, 87, 665, 2, 0, 1, 0, 69, 665, 71, 665, 1, 2, 0, 0, 69, 665, 71, 665, 2, 1, 0, 0, 69, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 86, 665, 1, 166, 665, 86, 665, 2, 0, 1, 0, 70, 665, 70, 665, 1, 2, 0, 0, 70, 665, 70, 665, 2, 1, 0, 0, 70, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 85, 665, 1, 167, 665, 85, 665, 2, 0, 1, 0, 71, 665, 69, 665, 1, 2, 0, 0, 71, 665, 69, 665, 2, 1, 0, 0, 71, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 84, 665, 1, 168, 665, 84, 665, 2, 0, 1, 0, 72, 665, 68, 665, 1, 2, 0, 0, 72, 665, 68, 665, 2, 1, 0, 0, 72, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 83, 665, 1, 169, 665, 83, 665, 2, 0, 1, 0, 73, 665, 67, 665, 1, 2, 0, 0, 73, 665, 67, 665, 2, 1, 0, 0, 73, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 0, 4, 2, 29, 0, 262140ULL, 0, 164, 665, 89, 665, 1, 164, 665, 89, 665, 2, 0, 1, 0, 68, 665, 73, 665, 1, 2, 0, 0, 68, 665, 73, 665, 2, 1, 0, 0, 68, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 165, 665, 88, 665, 1, 165, 665, 88, 665, 2, 0, 1, 0, 69, 665, 72, 665, 1, 2, 0, 0, 69, 665, 72, 665, 2, 1, 0, 0, 69, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 87, 665, 1, 166, 665, 87, 665, 2, 0, 1, 0, 70, 665, 71, 665, 1, 2, 0, 0, 70, 665, 71, 665, 2, 1, 0, 0, 70, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 86, 665, 1, 167, 665, 86, 665, 2, 0, 1, 0, 71, 665, 70, 665, 1, 2, 0, 0, 71, 665, 70, 665, 2, 1, 0, 0, 71, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 85, 665, 1, 168, 665, 85, 665, 2, 0, 1, 0, 72, 665, 69, 665, 1, 2, 0, 0, 72, 665, 69, 665, 2, 1, 0, 0, 72, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 84, 665, 1, 169, 665, 84, 665, 2, 0, 1, 0, 73, 665, 68, 665, 1, 2, 0, 0, 73, 665, 68, 665, 2, 1, 0, 0, 73, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 0, 3, 2, 30, 0, 262140ULL, 0, 165, 665, 89, 665, 1, 165, 665, 89, 665, 2, 0, 1, 0, 69, 665, 73, 665, 1, 2, 0, 0, 69, 665, 73, 665, 2, 1, 0, 0, 69, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 166, 665, 88, 665, 1, 166, 665, 88, 665, 2, 0, 1, 0, 70, 665, 72, 665, 1, 2, 0, 0, 70, 665, 72, 665, 2, 1, 0, 0, 70, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 87, 665, 1, 167, 665, 87, 665, 2, 0, 1, 0, 71, 665, 71, 665, 1, 2, 0, 0, 71, 665, 71, 665, 2, 1, 0, 0, 71, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 86, 665, 1, 168, 665, 86, 665, 2, 0, 1, 0, 72, 665, 70, 665, 1, 2, 0, 0, 72, 665, 70, 665, 2, 1, 0, 0, 72, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 85, 665, 1, 169, 665, 85, 665, 2, 0, 1, 0, 73, 665, 69, 665, 1, 2, 0, 0, 73, 665, 69, 665, 2, 1, 0, 0, 73, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 0, 4, 2, 31, 0, 262140ULL, 0, 166, 665, 89, 665, 1, 166, 665, 89, 665, 2, 0, 1, 0, 70, 665, 73, 665, 1, 2, 0, 0, 70, 665, 73, 665, 2, 1, 0, 0, 70, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 167, 665, 88, 665, 1, 167, 665, 88, 665, 2, 0, 1, 0, 71, 665, 72, 665, 1, 2, 0, 0, 71, 665, 72, 665, 2, 1, 0, 0, 71, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 87, 665, 1, 168, 665, 87, 665, 2, 0, 1, 0, 72, 665, 71, 665, 1, 2, 0, 0, 72, 665, 71, 665, 2, 1, 0, 0, 72, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 86, 665, 1, 169, 665, 86, 665, 2, 0, 1, 0, 73, 665, 70, 665, 1, 2, 0, 0, 73, 665, 70, 665, 2, 1, 0, 0, 73, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 0, 3, 2, 32, 0, 262140ULL, 0, 167, 665, 89, 665, 1, 167, 665, 89, 665, 2, 0, 1, 0, 71, 665, 73, 665, 1, 2, 0, 0, 71, 665, 73, 665, 2, 1, 0, 0, 71, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 168, 665, 88, 665, 1, 168, 665, 88, 665, 2, 0, 1, 0, 72, 665, 72, 665, 1, 2, 0, 0, 72, 665, 72, 665, 2, 1, 0, 0, 72, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 87, 665, 1, 169, 665, 87, 665, 2, 0, 1, 0, 73, 665, 71, 665, 1, 2, 0, 0, 73, 665, 71, 665, 2, 1, 0, 0, 73, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 0, 4, 2, 4, 0, 262140ULL, 0, 168, 665, 89, 665, 1, 168, 665, 89, 665, 2, 0, 1, 0, 72, 665, 73, 665, 1, 2, 0, 0, 72, 665, 73, 665, 2, 1, 0, 0, 72, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 169, 665, 88, 665, 1, 169, 665, 88, 665, 2, 0, 1, 0, 73, 665, 72, 665, 1, 2, 0, 0, 73, 665, 72, 665, 2, 1, 0, 0, 73, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 0, 3, 2, 3, 0, 262140ULL, 0, 169, 665, 89, 665, 1, 169, 665, 89, 665, 2, 0, 1, 0, 73, 665, 73, 665, 1, 2, 0, 0, 73, 665, 73, 665, 2, 1, 0, 0, 73, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 2, 1, 0, 33, 2, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166149, 371, 1, 0, 0, 154, 665, 154, 665, 1, 64559ULL, 186, 665, 2, 0, 1, 0, 2, 58, 665, 1, 0, 90, 665, 5, 1, 122, 665, 0, 154, 665, 155, 665, 1, 64559ULL, 187, 665, 2, 0, 1, 0, 155, 665, 154, 665, 1, 65535ULL, 186, 665, 3, 0, 1, 0, 2, 3, 1, 0, 59, 665, 0, 1, 91, 665, 6, 0, 123, 665, 0, 154, 665, 156, 665, 1, 64559ULL, 188, 665, 2, 0, 1, 0, 155, 665, 155, 665, 1, 65535ULL, 187, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 154, 665, 1, 65534ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 60, 665, 0, 1, 92, 665, 7, 0, 124, 665, 0, 154, 665, 157, 665, 1, 64559ULL, 189, 665, 2, 0, 1, 0, 155, 665, 156, 665, 1, 65535ULL, 188, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 155, 665, 1, 65534ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 61, 665, 0, 1, 93, 665, 8, 0, 125, 665, 0, 154, 665, 158, 665, 1, 64559ULL, 190, 665, 2, 0, 1, 0, 155, 665, 157, 665, 1, 65535ULL, 189, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 156, 665, 1, 65534ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 62, 665, 0, 1, 94, 665, 9, 0, 126, 665, 0, 154, 665, 159, 665, 1, 64559ULL, 191, 665, 2, 0, 1, 0, 155, 665, 158, 665, 1, 65535ULL, 190, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 157, 665, 1, 65534ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 63, 665, 0, 1, 95, 665, 10, 0, 127, 665, 0, 154, 665, 160, 665, 1, 64559ULL, 192, 665, 2, 0, 1, 0, 155, 665, 159, 665, 1, 65535ULL, 191, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 158, 665, 1, 65534ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 64, 665, 0, 1, 96, 665, 11, 0, 128, 665, 0, 154, 665, 161, 665, 1, 64559ULL, 193, 665, 2, 0, 1, 0, 155, 665, 160, 665, 1, 65535ULL, 192, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 159, 665, 1, 65534ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 65, 665, 0, 1, 97, 665, 12, 0, 129, 665, 0, 154, 665, 162, 665, 1, 64559ULL, 194, 665, 2, 0, 1, 0, 155, 665, 161, 665, 1, 65535ULL, 193, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 160, 665, 1, 65534ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 66, 665, 0, 1, 98, 665, 13, 0, 130, 665, 0, 154, 665, 163, 665, 1, 64559ULL, 195, 665, 2, 0, 1, 0, 155, 665, 162, 665, 1, 65535ULL, 194, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 161, 665, 1, 65534ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 67, 665, 0, 1, 99, 665, 14, 0, 131, 665, 0, 154, 665, 164, 665, 1, 64559ULL, 196, 665, 2, 0, 1, 0, 155, 665, 163, 665, 1, 65535ULL, 195, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 162, 665, 1, 65534ULL, 194, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 68, 665, 0, 1, 100, 665, 15, 0, 132, 665, 0, 154, 665, 165, 665, 1, 64559ULL, 197, 665, 2, 0, 1, 0, 155, 665, 164, 665, 1, 65535ULL, 196, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 163, 665, 1, 65534ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 69, 665, 0, 1, 101, 665, 16, 0, 133, 665, 0, 154, 665, 166, 665, 1, 64559ULL, 198, 665, 2, 0, 1, 0, 155, 665, 165, 665, 1, 65535ULL, 197, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 164, 665, 1, 65534ULL, 196, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 70, 665, 0, 1, 102, 665, 17, 0, 134, 665, 0, 154, 665, 167, 665, 1, 64559ULL, 199, 665, 2, 0, 1, 0, 155, 665, 166, 665, 1, 65535ULL, 198, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 165, 665, 1, 65534ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 71, 665, 0, 1, 103, 665, 18, 0, 135, 665, 0, 154, 665, 168, 665, 1, 64559ULL, 200, 665, 2, 0, 1, 0, 155, 665, 167, 665, 1, 65535ULL, 199, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 166, 665, 1, 65534ULL, 198, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 72, 665, 0, 1, 104, 665, 19, 0, 136, 665, 0, 154, 665, 169, 665, 1, 64559ULL, 201, 665, 2, 0, 1, 0, 155, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 167, 665, 1, 65534ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 73, 665, 0, 1, 105, 665, 20, 0, 137, 665, 0, 155, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 156, 665, 168, 665, 1, 65534ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 157, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 158, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 159, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 160, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 161, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 162, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 163, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 0, 4, 2, 21, 0, 258236ULL, 0, 156, 665, 169, 665, 1, 65534ULL, 201, 665, 2, 0, 1, 0, 157, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 158, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 0, 3, 2, 22, 0, 262140ULL, 0, 157, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 158, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 159, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 160, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 161, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 162, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 163, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 0, 4, 2, 23, 0, 262136ULL, 0, 158, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 159, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 160, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 0, 3, 2, 24, 0, 262140ULL, 0, 159, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 160, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 161, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 162, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 163, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 0, 4, 2, 25, 0, 262140ULL, 0, 160, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 161, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 162, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 0, 3, 2, 26, 0, 262140ULL, 0, 161, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 162, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 163, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 0, 4, 2, 27, 0, 262140ULL, 0, 162, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 163, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 164, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 0, 3, 2, 28, 0, 262140ULL, 0, 163, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 164, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 165, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 0, 4, 2, 29, 0, 262140ULL, 0, 164, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 165, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 166, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 0, 3, 2, 30, 0, 262140ULL, 0, 165, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 166, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 167, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 0, 4, 2, 31, 0, 262140ULL, 0, 166, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 167, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 168, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 0, 3, 2, 32, 0, 262140ULL, 0, 167, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 168, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 169, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 0, 4, 2, 4, 0, 262140ULL, 0, 168, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 169, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 0, 2, 3, 3, 0, 262140ULL, 0, 169, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 33, 2, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166150, 371, 1, 0, 0, 154, 665, 58, 665, 1, 154, 665, 122, 665, 2, 0, 1, 0, 64559ULL, 202, 665, 1, 2, 0, 0, 1, 74, 665, 5, 0, 138, 665, 0, 154, 665, 59, 665, 1, 154, 665, 123, 665, 2, 0, 1, 0, 64559ULL, 203, 665, 3, 2, 0, 0, 155, 665, 58, 665, 1, 155, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 75, 665, 6, 1, 139, 665, 0, 154, 665, 60, 665, 1, 154, 665, 124, 665, 2, 0, 1, 0, 64559ULL, 204, 665, 3, 2, 0, 0, 155, 665, 59, 665, 1, 155, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 58, 665, 1, 156, 665, 122, 665, 2, 0, 1, 0, 65534ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 76, 665, 7, 1, 140, 665, 0, 154, 665, 61, 665, 1, 154, 665, 125, 665, 2, 0, 1, 0, 64559ULL, 205, 665, 3, 2, 0, 0, 155, 665, 60, 665, 1, 155, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 59, 665, 1, 156, 665, 123, 665, 2, 0, 1, 0, 65534ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 58, 665, 1, 157, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 77, 665, 8, 1, 141, 665, 0, 154, 665, 62, 665, 1, 154, 665, 126, 665, 2, 0, 1, 0, 64559ULL, 206, 665, 3, 2, 0, 0, 155, 665, 61, 665, 1, 155, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 60, 665, 1, 156, 665, 124, 665, 2, 0, 1, 0, 65534ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 59, 665, 1, 157, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 58, 665, 1, 158, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 78, 665, 9, 1, 142, 665, 0, 154, 665, 63, 665, 1, 154, 665, 127, 665, 2, 0, 1, 0, 64559ULL, 207, 665, 3, 2, 0, 0, 155, 665, 62, 665, 1, 155, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 61, 665, 1, 156, 665, 125, 665, 2, 0, 1, 0, 65534ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 60, 665, 1, 157, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 59, 665, 1, 158, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 58, 665, 1, 159, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 79, 665, 10, 1, 143, 665, 0, 154, 665, 64, 665, 1, 154, 665, 128, 665, 2, 0, 1, 0, 64559ULL, 208, 665, 3, 2, 0, 0, 155, 665, 63, 665, 1, 155, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 62, 665, 1, 156, 665, 126, 665, 2, 0, 1, 0, 65534ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 61, 665, 1, 157, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 60, 665, 1, 158, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 59, 665, 1, 159, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 58, 665, 1, 160, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 80, 665, 11, 1, 144, 665, 0, 154, 665, 65, 665, 1, 154, 665, 129, 665, 2, 0, 1, 0, 64559ULL, 209, 665, 3, 2, 0, 0, 155, 665, 64, 665, 1, 155, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 63, 665, 1, 156, 665, 127, 665, 2, 0, 1, 0, 65534ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 62, 665, 1, 157, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 61, 665, 1, 158, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 60, 665, 1, 159, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 59, 665, 1, 160, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 58, 665, 1, 161, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 81, 665, 12, 1, 145, 665, 0, 154, 665, 66, 665, 1, 154, 665, 130, 665, 2, 0, 1, 0, 64559ULL, 210, 665, 3, 2, 0, 0, 155, 665, 65, 665, 1, 155, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 64, 665, 1, 156, 665, 128, 665, 2, 0, 1, 0, 65534ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 63, 665, 1, 157, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 62, 665, 1, 158, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 61, 665, 1, 159, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 60, 665, 1, 160, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 59, 665, 1, 161, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 58, 665, 1, 162, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 82, 665, 13, 1, 146, 665, 0, 154, 665, 67, 665, 1, 154, 665, 131, 665, 2, 0, 1, 0, 64559ULL, 211, 665, 3, 2, 0, 0, 155, 665, 66, 665, 1, 155, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 65, 665, 1, 156, 665, 129, 665, 2, 0, 1, 0, 65534ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 64, 665, 1, 157, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 63, 665, 1, 158, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 62, 665, 1, 159, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 61, 665, 1, 160, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 60, 665, 1, 161, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 59, 665, 1, 162, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 58, 665, 1, 163, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 83, 665, 14, 1, 147, 665, 0, 154, 665, 68, 665, 1, 154, 665, 132, 665, 2, 0, 1, 0, 64559ULL, 212, 665, 3, 2, 0, 0, 155, 665, 67, 665, 1, 155, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 66, 665, 1, 156, 665, 130, 665, 2, 0, 1, 0, 65534ULL, 210, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 65, 665, 1, 157, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 64, 665, 1, 158, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 63, 665, 1, 159, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 62, 665, 1, 160, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 61, 665, 1, 161, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 60, 665, 1, 162, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 59, 665, 1, 163, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 58, 665, 1, 164, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 84, 665, 15, 1, 148, 665, 0, 154, 665, 69, 665, 1, 154, 665, 133, 665, 2, 0, 1, 0, 64559ULL, 213, 665, 3, 2, 0, 0, 155, 665, 68, 665, 1, 155, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 67, 665, 1, 156, 665, 131, 665, 2, 0, 1, 0, 65534ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 66, 665, 1, 157, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 65, 665, 1, 158, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 64, 665, 1, 159, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 63, 665, 1, 160, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 62, 665, 1, 161, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 61, 665, 1, 162, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 60, 665, 1, 163, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 59, 665, 1, 164, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 58, 665, 1, 165, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 85, 665, 16, 1, 149, 665, 0, 154, 665, 70, 665, 1, 154, 665, 134, 665, 2, 0, 1, 0, 64559ULL, 214, 665, 3, 2, 0, 0, 155, 665, 69, 665, 1, 155, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 68, 665, 1, 156, 665, 132, 665, 2, 0, 1, 0, 65534ULL, 212, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 67, 665, 1, 157, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 66, 665, 1, 158, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 65, 665, 1, 159, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 64, 665, 1, 160, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 63, 665, 1, 161, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 62, 665, 1, 162, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 61, 665, 1, 163, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 60, 665, 1, 164, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 59, 665, 1, 165, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 58, 665, 1, 166, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 86, 665, 17, 1, 150, 665, 0, 154, 665, 71, 665, 1, 154, 665, 135, 665, 2, 0, 1, 0, 64559ULL, 215, 665, 3, 2, 0, 0, 155, 665, 70, 665, 1, 155, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 69, 665, 1, 156, 665, 133, 665, 2, 0, 1, 0, 65534ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 68, 665, 1, 157, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 67, 665, 1, 158, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 66, 665, 1, 159, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 65, 665, 1, 160, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 64, 665, 1, 161, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 63, 665, 1, 162, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 62, 665, 1, 163, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 61, 665, 1, 164, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 60, 665, 1, 165, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 59, 665, 1, 166, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 58, 665, 1, 167, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 87, 665, 18, 1, 151, 665, 0, 154, 665, 72, 665, 1, 154, 665, 136, 665, 2, 0, 1, 0, 64559ULL, 216, 665, 3, 2, 0, 0, 155, 665, 71, 665, 1, 155, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 70, 665, 1, 156, 665, 134, 665, 2, 0, 1, 0, 65534ULL, 214, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 69, 665, 1, 157, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 68, 665, 1, 158, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 67, 665, 1, 159, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 66, 665, 1, 160, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 65, 665, 1, 161, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 64, 665, 1, 162, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 63, 665, 1, 163, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 62, 665, 1, 164, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 61, 665, 1, 165, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 60, 665, 1, 166, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 59, 665, 1, 167, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 58, 665, 1, 168, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 88, 665, 19, 1, 152, 665, 0, 154, 665, 73, 665, 1, 154, 665, 137, 665, 2, 0, 1, 0, 64559ULL, 217, 665, 3, 2, 0, 0, 155, 665, 72, 665, 1, 155, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 71, 665, 1, 156, 665, 135, 665, 2, 0, 1, 0, 65534ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 70, 665, 1, 157, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 69, 665, 1, 158, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 68, 665, 1, 159, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 67, 665, 1, 160, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 66, 665, 1, 161, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 65, 665, 1, 162, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 64, 665, 1, 163, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 63, 665, 1, 164, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 62, 665, 1, 165, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 61, 665, 1, 166, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 60, 665, 1, 167, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 59, 665, 1, 168, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 58, 665, 1, 169, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 89, 665, 20, 1, 153, 665, 0, 155, 665, 73, 665, 1, 155, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 156, 665, 72, 665, 1, 156, 665, 136, 665, 2, 0, 1, 0, 65534ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 157, 665, 71, 665, 1, 157, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 158, 665, 70, 665, 1, 158, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 69, 665, 1, 159, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 68, 665, 1, 160, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 67, 665, 1, 161, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 66, 665, 1, 162, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 65, 665, 1, 163, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 64, 665, 1, 164, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 63, 665, 1, 165, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 62, 665, 1, 166, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 61, 665, 1, 167, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 60, 665, 1, 168, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 59, 665, 1, 169, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 0, 4, 1, 21, 0, 258236ULL, 0, 156, 665, 73, 665, 1, 156, 665, 137, 665, 2, 0, 1, 0, 65534ULL, 217, 665, 3, 2, 0, 0, 157, 665, 72, 665, 1, 157, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 71, 665, 1, 158, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 70, 665, 1, 159, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 69, 665, 1, 160, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 68, 665, 1, 161, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 67, 665, 1, 162, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 66, 665, 1, 163, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 65, 665, 1, 164, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 64, 665, 1, 165, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 63, 665, 1, 166, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 62, 665, 1, 167, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 61, 665, 1, 168, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 60, 665, 1, 169, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 0, 3, 1, 22, 0, 262140ULL, 0, 157, 665, 73, 665, 1, 157, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 158, 665, 72, 665, 1, 158, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 71, 665, 1, 159, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 70, 665, 1, 160, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 69, 665, 1, 161, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 68, 665, 1, 162, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 67, 665, 1, 163, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 66, 665, 1, 164, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 65, 665, 1, 165, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 64, 665, 1, 166, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 63, 665, 1, 167, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 62, 665, 1, 168, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 61, 665, 1, 169, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 0, 4, 1, 23, 0, 262136ULL, 0, 158, 665, 73, 665, 1, 158, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 159, 665, 72, 665, 1, 159, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 71, 665, 1, 160, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 70, 665, 1, 161, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 69, 665, 1, 162, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 68, 665, 1, 163, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 67, 665, 1, 164, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 66, 665, 1, 165, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 65, 665, 1, 166, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 64, 665, 1, 167, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 63, 665, 1, 168, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 62, 665, 1, 169, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 0, 3, 1, 24, 0, 262140ULL, 0, 159, 665, 73, 665, 1, 159, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 160, 665, 72, 665, 1, 160, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 71, 665, 1, 161, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 70, 665, 1, 162, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 69, 665, 1, 163, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 68, 665, 1, 164, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 67, 665, 1, 165, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 66, 665, 1, 166, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 65, 665, 1, 167, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 64, 665, 1, 168, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 63, 665, 1, 169, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 0, 4, 1, 25, 0, 262140ULL, 0, 160, 665, 73, 665, 1, 160, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 161, 665, 72, 665, 1, 161, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 71, 665, 1, 162, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 70, 665, 1, 163, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 69, 665, 1, 164, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 68, 665, 1, 165, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 67, 665, 1, 166, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 66, 665, 1, 167, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 65, 665, 1, 168, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 64, 665, 1, 169, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 0, 3, 1, 26, 0, 262140ULL, 0, 161, 665, 73, 665, 1, 161, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 162, 665, 72, 665, 1, 162, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 71, 665, 1, 163, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 70, 665, 1, 164, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 69, 665, 1, 165, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 68, 665, 1, 166, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 67, 665, 1, 167, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 66, 665, 1, 168, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 65, 665, 1, 169, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 0, 4, 1, 27, 0, 262140ULL, 0, 162, 665, 73, 665, 1, 162, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 163, 665, 72, 665, 1, 163, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 71, 665, 1, 164, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 70, 665, 1, 165, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 69, 665, 1, 166, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 68, 665, 1, 167, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 67, 665, 1, 168, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 66, 665, 1, 169, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 0, 3, 1, 28, 0, 262140ULL, 0, 163, 665, 73, 665, 1, 163, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 164, 665, 72, 665, 1, 164, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 71, 665, 1, 165, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 70, 665, 1, 166, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 69, 665, 1, 167, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 68, 665, 1, 168, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 67, 665, 1, 169, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 0, 4, 1, 29, 0, 262140ULL, 0, 164, 665, 73, 665, 1, 164, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 165, 665, 72, 665, 1, 165, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 71, 665, 1, 166, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 70, 665, 1, 167, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 69, 665, 1, 168, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 68, 665, 1, 169, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 0, 3, 1, 30, 0, 262140ULL, 0, 165, 665, 73, 665, 1, 165, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 166, 665, 72, 665, 1, 166, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 71, 665, 1, 167, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 70, 665, 1, 168, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 69, 665, 1, 169, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 0, 4, 1, 31, 0, 262140ULL, 0, 166, 665, 73, 665, 1, 166, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 167, 665, 72, 665, 1, 167, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 71, 665, 1, 168, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 70, 665, 1, 169, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 0, 3, 1, 32, 0, 262140ULL, 0, 167, 665, 73, 665, 1, 167, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 168, 665, 72, 665, 1, 168, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 71, 665, 1, 169, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 0, 4, 1, 4, 0, 262140ULL, 0, 168, 665, 73, 665, 1, 168, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 169, 665, 72, 665, 1, 169, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 0, 3, 1, 3, 0, 262140ULL, 0, 169, 665, 73, 665, 1, 169, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 1, 2, 0, 33, 1, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166151, 371, 1, 0, 1, 267, 665, 126, 6652166152, 371, 1, 1, 0, 6652166152, 371, 6652166152, 371, 6652166153, 371, 6652166152, 371, 0, 2, 268, 665, 127, 6652166154, 371, 2, 2, 0, 6652166154, 371, 6652166154, 371, 6652166155, 371, 6652166154, 371, 0, 4, 269, 665, 128, 6652166156, 371, 4, 4, 0, 6652166156, 371, 6652166156, 371, 6652166157, 371, 6652166156, 371, 0, 5, 270, 665, 129, 6652166158, 371, 5, 5, 0, 6652166158, 371, 6652166158, 371, 6652166159, 371, 6652166158, 371, 0, 6, 271, 665, 130, 6652166160, 371, 6, 6, 0, 6652166160, 371, 6652166160, 371, 6652166161, 371, 6652166160, 371, 0, 7, 272, 665, 131, 6652166162, 371, 7, 7, 0, 6652166162, 371, 6652166162, 371, 6652166163, 371, 6652166162, 371, 0, 8, 273, 665, 132, 6652166164, 371, 8, 8, 0, 6652166164, 371, 6652166164, 371, 6652166165, 371, 6652166164, 371, 0, 9, 274, 665, 133, 6652166166, 371, 9, 9, 0, 6652166166, 371, 6652166166, 371, 6652166167, 371, 6652166166, 371, 0, 10, 275, 665, 134, 6652166168, 371, 10, 10, 0, 6652166168, 371, 6652166168, 371, 6652166169, 371, 6652166168, 371, 0, 11, 276, 665, 135, 6652166170, 371, 11, 11, 0, 6652166170, 371, 6652166170, 371, 6652166171, 371, 6652166170, 371, 0, 12, 277, 665, 136, 6652166172, 371, 12, 12, 0, 6652166172, 371, 6652166172, 371, 6652166173, 371, 6652166172, 371, 0, 13, 278, 665, 137, 6652166174, 371, 13, 13, 0, 6652166174, 371, 6652166174, 371, 6652166175, 371, 6652166174, 371, 0, 0, 6652166153, 371, 1, 14, 0, 3, 6652166155, 371, 2, 0, 2, 3, 1, 125, 0, 15, 1, 3, 2, 6652166157, 371, 4, 0, 4, 2, 1, 125, 0, 3, 1, 2, 2, 6652166159, 371, 5, 0, 5, 2, 1, 125, 0, 4, 1, 2, 2, 6652166161, 371, 6, 0, 6, 2, 1, 125, 0, 5, 1, 2, 2, 6652166163, 371, 7, 0, 7, 2, 1, 125, 0, 6, 1, 2, 2, 6652166165, 371, 8, 0, 8, 2, 1, 125, 0, 7, 1, 2, 2, 6652166167, 371, 9, 0, 9, 2, 1, 125, 0, 8, 1, 2, 2, 6652166169, 371, 10, 0, 10, 2, 1, 125, 0, 9, 1, 2, 2, 6652166171, 371, 11, 0, 11, 2, 1, 125, 0, 10, 1, 2, 2, 6652166173, 371, 12, 0, 12, 2, 1, 125, 0, 11, 1, 2, 2, 6652166175, 371, 13, 0, 13, 2, 1, 125, 0, 12, 1, 2, 0, 25ULL, 14, 1, 15ULL, 15, 2, 0, 1, 0, 41ULL, 3, 1, 2, 0, 0, 16ULL, 4, 2, 1, 0, 0, 2ULL, 5, 1, 2, 0, 0, 28ULL, 6, 2, 1, 0, 0, 13ULL, 7, 1, 2, 0, 0, 13ULL, 8, 2, 1, 0, 0, 39ULL, 9, 1, 2, 0, 0, 18ULL, 10, 2, 1, 0, 0, 34ULL, 11, 1, 2, 0, 0, 20ULL, 12, 6652166176, 371, 1, 0, 0, 20ULL, 14, 1, 17ULL, 15, 2, 0, 1, 0, 15ULL, 3, 1, 2, 0, 0, 41ULL, 4, 2, 1, 0, 0, 16ULL, 5, 1, 2, 0, 0, 2ULL, 6, 2, 1, 0, 0, 28ULL, 7, 1, 2, 0, 0, 13ULL, 8, 2, 1, 0, 0, 13ULL, 9, 1, 2, 0, 0, 39ULL, 10, 2, 1, 0, 0, 18ULL, 11, 1, 2, 0, 0, 34ULL, 12, 6652166177, 371, 1, 0, 0, 34ULL, 14, 1, 20ULL, 15, 2, 0, 1, 0, 17ULL, 3, 1, 2, 0, 0, 15ULL, 4, 2, 1, 0, 0, 41ULL, 5, 1, 2, 0, 0, 16ULL, 6, 2, 1, 0, 0, 2ULL, 7, 1, 2, 0, 0, 28ULL, 8, 2, 1, 0, 0, 13ULL, 9, 1, 2, 0, 0, 13ULL, 10, 2, 1, 0, 0, 39ULL, 11, 1, 2, 0, 0, 18ULL, 12, 6652166178, 371, 1, 0, 0, 18ULL, 14, 1, 34ULL, 15, 2, 0, 1, 0, 20ULL, 3, 1, 2, 0, 0, 17ULL, 4, 2, 1, 0, 0, 15ULL, 5, 1, 2, 0, 0, 41ULL, 6, 2, 1, 0, 0, 16ULL, 7, 1, 2, 0, 0, 2ULL, 8, 2, 1, 0, 0, 28ULL, 9, 1, 2, 0, 0, 13ULL, 10, 2, 1, 0, 0, 13ULL, 11, 1, 2, 0, 0, 39ULL, 12, 6652166179, 371, 1, 0, 0, 39ULL, 14, 1, 18ULL, 15, 2, 0, 1, 0, 34ULL, 3, 1, 2, 0, 0, 20ULL, 4, 2, 1, 0, 0, 17ULL, 5, 1, 2, 0, 0, 15ULL, 6, 2, 1, 0, 0, 41ULL, 7, 1, 2, 0, 0, 16ULL, 8, 2, 1, 0, 0, 2ULL, 9, 1, 2, 0, 0, 28ULL, 10, 2, 1, 0, 0, 13ULL, 11, 1, 2, 0, 0, 13ULL, 12, 6652166180, 371, 1, 0, 0, 13ULL, 14, 1, 39ULL, 15, 2, 0, 1, 0, 18ULL, 3, 1, 2, 0, 0, 34ULL, 4, 2, 1, 0, 0, 20ULL, 5, 1, 2, 0, 0, 17ULL, 6, 2, 1, 0, 0, 15ULL, 7, 1, 2, 0, 0, 41ULL, 8, 2, 1, 0, 0, 16ULL, 9, 1, 2, 0, 0, 2ULL, 10, 2, 1, 0, 0, 28ULL, 11, 1, 2, 0, 0, 13ULL, 12, 6652166181, 371, 1, 0, 0, 13ULL, 14, 1, 13ULL, 15, 2, 0, 1, 0, 39ULL, 3, 1, 2, 0, 0, 18ULL, 4, 2, 1, 0, 0, 34ULL, 5, 1, 2, 0, 0, 20ULL, 6, 2, 1, 0, 0, 17ULL, 7, 1, 2, 0, 0, 15ULL, 8, 2, 1, 0, 0, 41ULL, 9, 1, 2, 0, 0, 16ULL, 10, 2, 1, 0, 0, 2ULL, 11, 1, 2, 0, 0, 28ULL, 12, 6652166182, 371, 1, 0, 0, 28ULL, 14, 1, 13ULL, 15, 2, 0, 1, 0, 13ULL, 3, 1, 2, 0, 0, 39ULL, 4, 2, 1, 0, 0, 18ULL, 5, 1, 2, 0, 0, 34ULL, 6, 2, 1, 0, 0, 20ULL, 7, 1, 2, 0, 0, 17ULL, 8, 2, 1, 0, 0, 15ULL, 9, 1, 2, 0, 0, 41ULL, 10, 2, 1, 0, 0, 16ULL, 11, 1, 2, 0, 0, 2ULL, 12, 6652166183, 371, 1, 0, 0, 2ULL, 14, 1, 28ULL, 15, 2, 0, 1, 0, 13ULL, 3, 1, 2, 0, 0, 13ULL, 4, 2, 1, 0, 0, 39ULL, 5, 1, 2, 0, 0, 18ULL, 6, 2, 1, 0, 0, 34ULL, 7, 1, 2, 0, 0, 20ULL, 8, 2, 1, 0, 0, 17ULL, 9, 1, 2, 0, 0, 15ULL, 10, 2, 1, 0, 0, 41ULL, 11, 1, 2, 0, 0, 16ULL, 12, 6652166184, 371, 1, 0, 0, 16ULL, 14, 1, 2ULL, 15, 2, 0, 1, 0, 28ULL, 3, 1, 2, 0, 0, 13ULL, 4, 2, 1, 0, 0, 13ULL, 5, 1, 2, 0, 0, 39ULL, 6, 2, 1, 0, 0, 18ULL, 7, 1, 2, 0, 0, 34ULL, 8, 2, 1, 0, 0, 20ULL, 9, 1, 2, 0, 0, 17ULL, 10, 2, 1, 0, 0, 15ULL, 11, 1, 2, 0, 0, 41ULL, 12, 6652166185, 371, 1, 0, 0, 41ULL, 14, 1, 16ULL, 15, 2, 0, 1, 0, 2ULL, 3, 1, 2, 0, 0, 28ULL, 4, 2, 1, 0, 0, 13ULL, 5, 1, 2, 0, 0, 13ULL, 6, 2, 1, 0, 0, 39ULL, 7, 1, 2, 0, 0, 18ULL, 8, 2, 1, 0, 0, 34ULL, 9, 1, 2, 0, 0, 20ULL, 10, 2, 1, 0, 0, 17ULL, 11, 1, 2, 0, 0, 15ULL, 12, 6652166186, 371, 1, 0, 0, 15ULL, 14, 1, 41ULL, 15, 2, 0, 1, 0, 16ULL, 3, 1, 2, 0, 0, 2ULL, 4, 2, 1, 0, 0, 28ULL, 5, 1, 2, 0, 0, 13ULL, 6, 2, 1, 0, 0, 13ULL, 7, 1, 2, 0, 0, 39ULL, 8, 2, 1, 0, 0, 18ULL, 9, 1, 2, 0, 0, 34ULL, 10, 2, 1, 0, 0, 20ULL, 11, 1, 2, 0, 0, 17ULL, 12, 6652166187, 371, 1, 0, 0, 296, 665, 297, 665, 2, 1ULL, 0, 0, 2, 298, 665, 6652166188, 371, 0, 146, 0, 2, 298, 665, 1, 1ULL, 0, 0, 1, 294, 665, 1, 0, 2, 0, 128ULL, 6652166188, 371, 6652166189, 371, 1, 0, 0, 314, 665, 6652166189, 371, 6652166190, 371, 0, 322, 665, 0, 315, 665, 6652166189, 371, 6652166191, 371, 0, 323, 665, 0, 316, 665, 6652166189, 371, 6652166192, 371, 0, 324, 665, 0, 317, 665, 6652166189, 371, 6652166193, 371, 0, 325, 665, 0, 318, 665, 6652166189, 371, 6652166194, 371, 0, 326, 665, 0, 319, 665, 6652166189, 371, 6652166195, 371, 0, 327, 665, 0, 320, 665, 6652166189, 371, 6652166196, 371, 0, 328, 665, 0, 321, 665, 6652166189, 371, 6652166197, 371, 0, 329, 665, 0, 376, 665, 342, 665, 1, 377, 665, 346, 665, 2, 0, 1, 0, 378, 665, 350, 665, 1, 2, 0, 0, 379, 665, 354, 665, 2, 1, 0, 0, 380, 665, 358, 665, 1, 2, 0, 0, 383, 665, 366, 665, 2, 1, 0, 0, 381, 665, 362, 665, 1, 2, 0, 0, 384, 665, 330, 665, 2, 1, 0, 0, 382, 665, 370, 665, 1, 2, 0, 0, 385, 665, 357, 665, 2, 1, 0, 37, 2, 407, 665, 0, 37, 413, 665, 6652166198, 371, 1ULL, 0, 0, 2ULL, 429, 665, 1, 0, 428, 665, 0, 429, 665, 1, 1, 431, 665, 0, 0, 1, 428, 665, 6652166199, 371, 0, 0, 443, 665, 444, 665, 2, 1ULL, 0, 0, 2, 445, 665, 6652166200, 371, 0, 213, 0, 2, 445, 665, 6652166201, 371, 0, 214, 0, 2, 445, 665, 1, 1ULL, 0, 0, 1, 440, 665, 1, 0, 2, 0, 128ULL, 6652166200, 371, 6652166202, 371, 1, 0, 0, 461, 665, 6652166202, 371, 6652166203, 371, 0, 469, 665, 0, 462, 665, 6652166202, 371, 6652166204, 371, 0, 470, 665, 0, 463, 665, 6652166202, 371, 6652166205, 371, 0, 471, 665, 0, 464, 665, 6652166202, 371, 6652166206, 371, 0, 472, 665, 0, 465, 665, 6652166202, 371, 6652166207, 371, 0, 473, 665, 0, 466, 665, 6652166202, 371, 6652166208, 371, 0, 474, 665, 0, 467, 665, 6652166202, 371, 6652166209, 371, 0, 475, 665, 0, 468, 665, 6652166202, 371, 6652166210, 371, 0, 476, 665, 2, 479, 1, 8388608, 665, 480, 1, 8388608, 665, 0, 1ULL, 2, 1, 1ULL, 489, 665, 6652166211, 371, 0, 1, 0, 1ULL, 2, 6652166212, 371, 489, 665, 0, 0, 497, 665, 562, 665, 1, 505, 665, 563, 665, 2, 0, 1, 0, 513, 665, 564, 665, 1, 2, 0, 0, 506, 665, 565, 665, 2, 1, 0, 0, 521, 665, 566, 665, 1, 2, 0, 0, 529, 665, 567, 665, 2, 1, 0, 0, 561, 665, 569, 665, 1, 2, 0, 0, 537, 665, 568, 665, 2, 1, 0, 0, 538, 665, 570, 665, 1, 2, 0, 0, 539, 665, 571, 665, 2, 1, 0, 0, 540, 665, 572, 665, 1, 2, 0, 0, 541, 665, 573, 665, 2, 1, 0, 0, 574, 665, 45, 1, 2, 0, 0, 543, 665, 575, 665, 2, 1, 0, 0, 544, 665, 576, 665, 1, 2, 0, 0, 628, 665, 634, 665, 2, 1, 0, 0, 629, 665, 635, 665, 1, 2, 0, 0, 630, 665, 636, 665, 2, 1, 0, 0, 631, 665, 637, 665, 1, 2, 0, 0, 632, 665, 638, 665, 2, 1, 0, 0, 633, 665, 639, 665, 1, 2, 0, 0, 545, 665, 577, 665, 2, 1, 0, 54, 2, 553, 665, 0, 54, 652, 665, 6652166213, 371, 1ULL, 0, 0, 545, 665, 651, 665, 4, 1ULL, 0, 0, 1ULL, 4, 6652166214, 371, 624, 665, 0, 0, 1ULL, 627, 665, 1, 592, 665, 0, 0, 1ULL, 602, 665, 2, 593, 665, 0, 3, 1, 2, 0, 1ULL, 6652166213, 371, 1, 594, 665, 0, 6652166215, 371, 3, 1, 0, 599, 665, 529, 665, 1, 600, 665, 543, 665, 2, 0, 1, 3, 2, 595, 665, 0, 601, 665, 538, 665, 1, 262144ULL, 0, 0, 65536ULL, 597, 665, 2, 1, 0, 0, 597, 665, 539, 665, 1, 2, 0, 0, 131072ULL, 598, 665, 2, 1, 0, 53, 2, 3, 0, 653, 665, 53, 1, 655, 665, 0, 0, 543, 665, 53, 2, 626, 665, 0, 0, 1, 2, 6652166216, 371, 0, 53, 1, 542, 665, 1ULL, 0, 1ULL, 4, 2, 0, 624, 665, 6652166217, 371, 1, 2, 0, 458, 665, 460, 665, 1, 1ULL, 0, 6652166218, 371, 1, 215, 0, 311, 665, 313, 665, 1, 1ULL, 0, 6652166219, 371, 1, 147, 0, 6652166189, 371, 138, 1, 0, 286, 665, 17, 1, 0, 6652166189, 371, 139, 1, 0, 287, 665, 18, 1, 0, 6652166189, 371, 140, 1, 0, 288, 665, 19, 1, 0, 6652166189, 371, 141, 1, 0, 289, 665, 20, 1, 0, 6652166189, 371, 142, 1, 0, 290, 665, 21, 1, 0, 6652166189, 371, 143, 1, 0, 291, 665, 22, 1, 0, 6652166189, 371, 144, 1, 0, 292, 665, 23, 1, 0, 6652166189, 371, 145, 1, 0, 293, 665, 24, 1, 25, 305, 665, 26, 306, 665, 27, 307, 665, 28, 308, 665, 29, 301, 665, 30, 302, 665, 31, 303, 665, 32, 304, 665, 0, 267, 665, 1, 268, 665, 2, 269, 665, 3, 270, 665, 4, 271, 665, 5, 272, 665, 6, 273, 665, 7, 274, 665, 8, 275, 665, 9, 276, 665, 10, 277, 665, 11, 278, 665, 12, 279, 665, 13, 280, 665, 14, 281, 665, 15, 282, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 265, 1, 1, 0, 146, 0, 17, 0, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 1, 9814671409, 265, 1, 0, 0, 6652166365, 371, 9814671409, 265, 1, 0, 477, 1, 8388608, 665, 477, 665, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 489, 665, 2, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 45, 1ULL, 1, 0, 9814671376, 265, 1, 0, 1ULL, 1, 1, 0, 0, 2, 9814671376, 265, 2, 0, 1, 6652166220, 371, 2, 9814671376, 265, 11, 53, 12, 544, 665, 0, 521, 665, 613, 665, 13, 0, 614, 665, 14, 54, 0, 496, 665, 562, 665, 1, 504, 665, 563, 665, 2, 0, 1, 0, 512, 665, 564, 665, 1, 2, 0, 0, 513, 665, 565, 665, 2, 1, 0, 0, 520, 665, 566, 665, 1, 2, 0, 0, 528, 665, 567, 665, 2, 1, 0, 0, 536, 665, 568, 665, 1, 2, 0, 0, 560, 665, 569, 665, 2, 1, 0, 55, 2, 552, 665, 15, 55, 0, 495, 665, 562, 665, 1, 503, 665, 563, 665, 2, 0, 1, 0, 511, 665, 564, 665, 1, 2, 0, 0, 512, 665, 565, 665, 2, 1, 0, 0, 519, 665, 566, 665, 1, 2, 0, 0, 527, 665, 567, 665, 2, 1, 0, 0, 535, 665, 568, 665, 1, 2, 0, 0, 559, 665, 569, 665, 2, 1, 0, 56, 2, 551, 665, 16, 56, 0, 494, 665, 562, 665, 1, 502, 665, 563, 665, 2, 0, 1, 0, 510, 665, 564, 665, 1, 2, 0, 0, 511, 665, 565, 665, 2, 1, 0, 0, 518, 665, 566, 665, 1, 2, 0, 0, 526, 665, 567, 665, 2, 1, 0, 0, 534, 665, 568, 665, 1, 2, 0, 0, 558, 665, 569, 665, 2, 1, 0, 57, 2, 550, 665, 17, 57, 0, 493, 665, 562, 665, 1, 501, 665, 563, 665, 2, 0, 1, 0, 509, 665, 564, 665, 1, 2, 0, 0, 510, 665, 565, 665, 2, 1, 0, 0, 517, 665, 566, 665, 1, 2, 0, 0, 525, 665, 567, 665, 2, 1, 0, 0, 533, 665, 568, 665, 1, 2, 0, 0, 557, 665, 569, 665, 2, 1, 0, 58, 2, 549, 665, 18, 58, 0, 492, 665, 562, 665, 1, 500, 665, 563, 665, 2, 0, 1, 0, 508, 665, 564, 665, 1, 2, 0, 0, 509, 665, 565, 665, 2, 1, 0, 0, 516, 665, 566, 665, 1, 2, 0, 0, 524, 665, 567, 665, 2, 1, 0, 0, 532, 665, 568, 665, 1, 2, 0, 0, 556, 665, 569, 665, 2, 1, 0, 59, 2, 548, 665, 19, 59, 0, 491, 665, 562, 665, 1, 499, 665, 563, 665, 2, 0, 1, 0, 507, 665, 564, 665, 1, 2, 0, 0, 508, 665, 565, 665, 2, 1, 0, 0, 515, 665, 566, 665, 1, 2, 0, 0, 523, 665, 567, 665, 2, 1, 0, 0, 531, 665, 568, 665, 1, 2, 0, 0, 555, 665, 569, 665, 2, 1, 0, 60, 2, 547, 665, 20, 60, 0, 490, 665, 562, 665, 1, 498, 665, 563, 665, 2, 0, 1, 0, 506, 665, 564, 665, 1, 2, 0, 0, 507, 665, 565, 665, 2, 1, 0, 0, 514, 665, 566, 665, 1, 2, 0, 0, 522, 665, 567, 665, 2, 1, 0, 0, 530, 665, 568, 665, 1, 2, 0, 0, 554, 665, 569, 665, 2, 1, 0, 61, 2, 546, 665, 21, 61, 2, 442, 665, 0, 448, 665, 443, 665, 1, 0, 459, 665, 0, 1, 1ULL, 1, 459, 665, 3, 6652166203, 371, 4, 6652166204, 371, 5, 6652166205, 371, 6, 6652166206, 371, 7, 6652166207, 371, 8, 6652166208, 371, 9, 6652166209, 371, 10, 6652166210, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 6652166218, 371, 0, 9814671472, 265, 1, 1, 0, 613, 665, 614, 665, 0, 11, 0, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 1, 9814671472, 265, 1, 0, 0, 6652166368, 371, 9814671472, 265, 1, 11, 53, 12, 544, 665, 0, 521, 665, 617, 665, 13, 0, 618, 665, 14, 54, 15, 55, 16, 56, 17, 57, 18, 58, 19, 59, 20, 60, 21, 61, 2, 295, 665, 0, 310, 665, 296, 665, 1, 0, 312, 665, 0, 1, 1ULL, 1, 312, 665, 3, 6652166190, 371, 4, 6652166191, 371, 5, 6652166192, 371, 6, 6652166193, 371, 7, 6652166194, 371, 8, 6652166195, 371, 9, 6652166196, 371, 10, 6652166197, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 6652166219, 371, 0, 9814671475, 265, 1, 1, 0, 617, 665, 618, 665, 0, 11, 0, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 1, 9814671475, 265, 1, 0, 0, 6652166371, 371, 9814671475, 265, 1, 0, 1, 665, 1, 0, 665, 0, 0, 0, 9814671379, 265, 1, 0, 0, 3, 1, 2, 0, 0, 0, 9814671382, 265, 1, 0, 0, 3, 1, 8388608, 1, 2, 1, 8388608, 0, 0, 0, 9814671382, 1, 8388608, 265, 1, 0, 3, 9814671379, 265, 2, 0, 9814671382, 1, 8388608, 265, 3, 1, 9814671382, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166374, 371, 1, 0, 0, 46, 1, 54, 1, 8388608, 665, 2, 3, 1, 8388608, 665, 3, 4, 1, 8388608, 665, 4, 45, 665, 5, 2, 665, 6, 46, 665, 7, 47, 665, 8, 48, 665, 9, 49, 665, 10, 50, 665, 11, 51, 665, 12, 52, 665, 13, 53, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671385, 265, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 265, 13, 0, 0, 46, 1, 8388608, 1, 103, 1, 8388608, 2, 101, 1, 8388608, 3, 102, 1, 8388608, 4, 104, 1, 8388608, 5, 84, 1, 8388608, 6, 93, 1, 8388608, 7, 94, 1, 8388608, 8, 95, 1, 8388608, 9, 96, 1, 8388608, 10, 97, 1, 8388608, 11, 98, 1, 8388608, 12, 99, 1, 8388608, 13, 100, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 1, 8388608, 265, 13, 0, 3, 9814671385, 265, 2, 0, 9814671388, 1, 8388608, 265, 3, 1, 9814671388, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166377, 371, 1, 0, 0, 58, 665, 5, 1, 59, 665, 6, 2, 0, 1, 0, 60, 665, 7, 1, 2, 0, 0, 61, 665, 8, 2, 1, 0, 0, 62, 665, 9, 1, 2, 0, 0, 63, 665, 10, 2, 1, 0, 0, 64, 665, 11, 1, 2, 0, 0, 65, 665, 12, 2, 1, 0, 0, 66, 665, 13, 1, 2, 0, 0, 67, 665, 14, 2, 1, 0, 0, 68, 665, 15, 1, 2, 0, 0, 69, 665, 16, 2, 1, 0, 0, 70, 665, 17, 1, 2, 0, 0, 71, 665, 18, 2, 1, 0, 0, 72, 665, 19, 1, 2, 0, 0, 73, 665, 20, 2, 1, 0, 0, 74, 665, 21, 1, 2, 0, 0, 75, 665, 22, 2, 1, 0, 0, 76, 665, 23, 1, 2, 0, 0, 77, 665, 24, 2, 1, 0, 0, 78, 665, 25, 1, 2, 0, 0, 79, 665, 26, 2, 1, 0, 0, 80, 665, 27, 1, 2, 0, 0, 81, 665, 28, 2, 1, 0, 0, 82, 665, 29, 1, 2, 0, 0, 83, 665, 30, 2, 1, 0, 0, 84, 665, 31, 1, 2, 0, 0, 85, 665, 32, 2, 1, 0, 0, 86, 665, 33, 1, 2, 0, 0, 87, 665, 34, 2, 1, 0, 0, 88, 665, 35, 1, 2, 0, 0, 89, 665, 36, 2, 1, 0, 9814671360, 265, 2, 0, 4, 9814671361, 265, 0, 0, 4, 1, 8388608, 9814671361, 1, 8388608, 265, 0, 3, 9814671360, 265, 2, 0, 9814671361, 1, 8388608, 265, 3, 1, 9814671361, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166380, 371, 1, 0, 0, 90, 665, 5, 1, 91, 665, 6, 2, 0, 1, 0, 92, 665, 7, 1, 2, 0, 0, 93, 665, 8, 2, 1, 0, 0, 94, 665, 9, 1, 2, 0, 0, 95, 665, 10, 2, 1, 0, 0, 96, 665, 11, 1, 2, 0, 0, 97, 665, 12, 2, 1, 0, 0, 98, 665, 13, 1, 2, 0, 0, 99, 665, 14, 2, 1, 0, 0, 100, 665, 15, 1, 2, 0, 0, 101, 665, 16, 2, 1, 0, 0, 102, 665, 17, 1, 2, 0, 0, 103, 665, 18, 2, 1, 0, 0, 104, 665, 19, 1, 2, 0, 0, 105, 665, 20, 2, 1, 0, 0, 106, 665, 21, 1, 2, 0, 0, 107, 665, 22, 2, 1, 0, 0, 108, 665, 23, 1, 2, 0, 0, 109, 665, 24, 2, 1, 0, 0, 110, 665, 25, 1, 2, 0, 0, 111, 665, 26, 2, 1, 0, 0, 112, 665, 27, 1, 2, 0, 0, 113, 665, 28, 2, 1, 0, 0, 114, 665, 29, 1, 2, 0, 0, 115, 665, 30, 2, 1, 0, 0, 116, 665, 31, 1, 2, 0, 0, 117, 665, 32, 2, 1, 0, 0, 118, 665, 33, 1, 2, 0, 0, 119, 665, 34, 2, 1, 0, 0, 120, 665, 35, 1, 2, 0, 0, 121, 665, 36, 2, 1, 0, 9814671362, 265, 2, 0, 4, 9814671363, 265, 0, 0, 4, 1, 8388608, 9814671363, 1, 8388608, 265, 0, 3, 9814671362, 265, 2, 0, 9814671363, 1, 8388608, 265, 3, 1, 9814671363, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166383, 371, 1, 0, 0, 122, 665, 5, 1, 123, 665, 6, 2, 0, 1, 0, 124, 665, 7, 1, 2, 0, 0, 125, 665, 8, 2, 1, 0, 0, 126, 665, 9, 1, 2, 0, 0, 127, 665, 10, 2, 1, 0, 0, 128, 665, 11, 1, 2, 0, 0, 129, 665, 12, 2, 1, 0, 0, 130, 665, 13, 1, 2, 0, 0, 131, 665, 14, 2, 1, 0, 0, 132, 665, 15, 1, 2, 0, 0, 133, 665, 16, 2, 1, 0, 0, 134, 665, 17, 1, 2, 0, 0, 135, 665, 18, 2, 1, 0, 0, 136, 665, 19, 1, 2, 0, 0, 137, 665, 20, 2, 1, 0, 0, 138, 665, 21, 1, 2, 0, 0, 139, 665, 22, 2, 1, 0, 0, 140, 665, 23, 1, 2, 0, 0, 141, 665, 24, 2, 1, 0, 0, 142, 665, 25, 1, 2, 0, 0, 143, 665, 26, 2, 1, 0, 0, 144, 665, 27, 1, 2, 0, 0, 145, 665, 28, 2, 1, 0, 0, 146, 665, 29, 1, 2, 0, 0, 147, 665, 30, 2, 1, 0, 0, 148, 665, 31, 1, 2, 0, 0, 149, 665, 32, 2, 1, 0, 0, 150, 665, 33, 1, 2, 0, 0, 151, 665, 34, 2, 1, 0, 0, 152, 665, 35, 1, 2, 0, 0, 153, 665, 36, 2, 1, 0, 9814671364, 265, 2, 0, 4, 9814671365, 265, 0, 0, 4, 1, 8388608, 9814671365, 1, 8388608, 265, 0, 3, 9814671364, 265, 2, 0, 9814671365, 1, 8388608, 265, 3, 1, 9814671365, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166386, 371, 1, 0, 0, 154, 665, 5, 1, 155, 665, 6, 2, 0, 1, 0, 156, 665, 7, 1, 2, 0, 0, 157, 665, 8, 2, 1, 0, 0, 158, 665, 9, 1, 2, 0, 0, 159, 665, 10, 2, 1, 0, 0, 160, 665, 11, 1, 2, 0, 0, 161, 665, 12, 2, 1, 0, 0, 162, 665, 13, 1, 2, 0, 0, 163, 665, 14, 2, 1, 0, 0, 164, 665, 15, 1, 2, 0, 0, 165, 665, 16, 2, 1, 0, 0, 166, 665, 17, 1, 2, 0, 0, 167, 665, 18, 2, 1, 0, 0, 168, 665, 19, 1, 2, 0, 0, 169, 665, 20, 2, 1, 0, 0, 170, 665, 21, 1, 2, 0, 0, 171, 665, 22, 2, 1, 0, 0, 172, 665, 23, 1, 2, 0, 0, 173, 665, 24, 2, 1, 0, 0, 174, 665, 25, 1, 2, 0, 0, 175, 665, 26, 2, 1, 0, 0, 176, 665, 27, 1, 2, 0, 0, 177, 665, 28, 2, 1, 0, 0, 178, 665, 29, 1, 2, 0, 0, 179, 665, 30, 2, 1, 0, 0, 180, 665, 31, 1, 2, 0, 0, 181, 665, 32, 2, 1, 0, 0, 182, 665, 33, 1, 2, 0, 0, 183, 665, 34, 2, 1, 0, 0, 184, 665, 35, 1, 2, 0, 0, 186, 665, 36, 2, 1, 0, 9814671366, 265, 2, 0, 4, 9814671367, 265, 0, 0, 4, 1, 8388608, 9814671367, 1, 8388608, 265, 0, 3, 9814671366, 265, 2, 0, 9814671367, 1, 8388608, 265, 3, 1, 9814671367, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166389, 371, 1, 0, 0, 34, 35, 3, 0, 36, 0, 187, 665, 5, 1, 188, 665, 6, 2, 0, 1, 0, 189, 665, 7, 1, 2, 0, 0, 190, 665, 8, 2, 1, 0, 0, 191, 665, 9, 1, 2, 0, 0, 192, 665, 10, 2, 1, 0, 0, 193, 665, 11, 1, 2, 0, 0, 194, 665, 12, 2, 1, 0, 0, 195, 665, 13, 1, 2, 0, 0, 196, 665, 14, 2, 1, 0, 0, 197, 665, 15, 1, 2, 0, 0, 198, 665, 16, 2, 1, 0, 0, 199, 665, 17, 1, 2, 0, 0, 200, 665, 18, 2, 1, 0, 0, 202, 665, 19, 1, 2, 0, 0, 203, 665, 20, 2, 1, 0, 0, 204, 665, 21, 1, 2, 0, 0, 205, 665, 22, 2, 1, 0, 0, 206, 665, 23, 1, 2, 0, 0, 207, 665, 24, 2, 1, 0, 0, 208, 665, 25, 1, 2, 0, 0, 209, 665, 26, 2, 1, 0, 0, 210, 665, 27, 1, 2, 0, 0, 211, 665, 28, 2, 1, 0, 0, 212, 665, 29, 1, 2, 0, 0, 213, 665, 30, 2, 1, 0, 0, 214, 665, 31, 1, 2, 0, 0, 215, 665, 32, 2, 1, 0, 0, 216, 665, 33, 1, 2, 0, 0, 185, 665, 34, 2, 1, 0, 0, 201, 665, 35, 1, 2, 0, 0, 217, 665, 36, 2, 1, 0, 0, 3, 0, 9814671391, 265, 2, 0, 0, 106, 1, 105, 0, 0, 0, 9814671394, 265, 1, 0, 0, 106, 1, 8388608, 1, 105, 1, 8388608, 0, 0, 0, 9814671394, 1, 8388608, 265, 1, 0, 3, 9814671391, 265, 2, 0, 9814671394, 1, 8388608, 265, 3, 1, 9814671394, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166392, 371, 1, 0, 0, 225, 665, 9814671368, 265, 0, 0, 107, 9814671369, 265, 0, 0, 107, 1, 8388608, 9814671369, 1, 8388608, 265, 0, 3, 9814671368, 265, 2, 0, 9814671369, 1, 8388608, 265, 3, 1, 9814671369, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166395, 371, 1, 0, 0, 226, 665, 9814671370, 265, 0, 0, 107, 9814671371, 265, 0, 0, 107, 1, 8388608, 9814671371, 1, 8388608, 265, 0, 3, 9814671370, 265, 2, 0, 9814671371, 1, 8388608, 265, 3, 1, 9814671371, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166398, 371, 1, 0, 0, 227, 665, 9814671372, 265, 0, 0, 107, 9814671373, 265, 0, 0, 107, 1, 8388608, 9814671373, 1, 8388608, 265, 0, 3, 9814671372, 265, 2, 0, 9814671373, 1, 8388608, 265, 3, 1, 9814671373, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166401, 371, 1, 0, 0, 0ULL, 1, 258, 665, 2, 228, 665, 3, 230, 665, 4, 259, 665, 5, 0ULL, 6, 232, 665, 7, 260, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671397, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 1, 8388608, 265, 7, 0, 3, 9814671397, 265, 2, 0, 9814671400, 1, 8388608, 265, 3, 1, 9814671400, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166404, 371, 1, 0, 0, 266, 1, 8388608, 665, 265, 1, 8388608, 665, 1, 258, 665, 2, 229, 665, 3, 231, 665, 4, 260, 665, 5, 264, 665, 6, 233, 665, 7, 261, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671403, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 1, 8388608, 265, 7, 0, 3, 9814671403, 265, 2, 0, 9814671406, 1, 8388608, 265, 3, 1, 9814671406, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166407, 371, 1, 0, 0, 294, 665, 9814671374, 265, 0, 0, 2, 9814671375, 265, 0, 0, 2, 1, 8388608, 9814671375, 1, 8388608, 265, 0, 3, 9814671374, 265, 2, 0, 9814671375, 1, 8388608, 265, 3, 1, 9814671375, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166410, 371, 1, 0, 0, 267, 1, 8388608, 665, 1, 268, 1, 8388608, 665, 2, 269, 1, 8388608, 665, 3, 270, 1, 8388608, 665, 4, 271, 1, 8388608, 665, 5, 272, 1, 8388608, 665, 6, 273, 1, 8388608, 665, 7, 274, 1, 8388608, 665, 8, 275, 1, 8388608, 665, 9, 276, 1, 8388608, 665, 10, 277, 1, 8388608, 665, 11, 278, 1, 8388608, 665, 12, 279, 1, 8388608, 665, 13, 280, 1, 8388608, 665, 14, 281, 1, 8388608, 665, 15, 282, 1, 8388608, 665, 16, 123, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 1, 8388608, 265, 1, 1, 3, 6652166365, 371, 2, 0, 9814671409, 1, 8388608, 265, 3, 1, 9814671409, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166413, 371, 1, 0, 0, 311, 665, 1, 314, 665, 2, 315, 665, 3, 316, 665, 4, 317, 665, 5, 318, 665, 6, 319, 665, 7, 320, 665, 8, 321, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671412, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 1, 8388608, 265, 8, 0, 3, 9814671412, 265, 2, 0, 9814671415, 1, 8388608, 265, 3, 1, 9814671415, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166416, 371, 1, 0, 0, 397, 665, 1, 398, 665, 2, 400, 665, 3, 399, 665, 4, 401, 665, 5, 402, 665, 6, 403, 665, 7, 404, 665, 8, 405, 665, 9, 406, 665, 10, 407, 665, 11, 408, 665, 12, 409, 665, 13, 410, 665, 14, 411, 665, 15, 375, 665, 16, 384, 665, 17, 377, 665, 18, 376, 665, 19, 381, 665, 20, 382, 665, 21, 383, 665, 22, 380, 665, 23, 378, 665, 24, 379, 665, 25, 385, 665, 26, 386, 665, 27, 387, 665, 28, 396, 665, 29, 389, 665, 30, 388, 665, 31, 393, 665, 32, 395, 665, 33, 394, 665, 34, 392, 665, 35, 391, 665, 36, 390, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671418, 265, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 265, 36, 0, 0, 148, 1, 8388608, 1, 149, 1, 8388608, 2, 150, 1, 8388608, 3, 151, 1, 8388608, 4, 152, 1, 8388608, 5, 153, 1, 8388608, 6, 154, 1, 8388608, 7, 155, 1, 8388608, 8, 156, 1, 8388608, 9, 157, 1, 8388608, 10, 158, 1, 8388608, 11, 159, 1, 8388608, 12, 160, 1, 8388608, 13, 161, 1, 8388608, 14, 162, 1, 8388608, 15, 163, 1, 8388608, 16, 164, 1, 8388608, 17, 165, 1, 8388608, 18, 166, 1, 8388608, 19, 167, 1, 8388608, 20, 168, 1, 8388608, 21, 169, 1, 8388608, 22, 170, 1, 8388608, 23, 171, 1, 8388608, 24, 172, 1, 8388608, 25, 173, 1, 8388608, 26, 174, 1, 8388608, 27, 175, 1, 8388608, 28, 176, 1, 8388608, 29, 177, 1, 8388608, 30, 178, 1, 8388608, 31, 179, 1, 8388608, 32, 180, 1, 8388608, 33, 181, 1, 8388608, 34, 182, 1, 8388608, 35, 183, 1, 8388608, 36, 184, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 1, 8388608, 265, 36, 0, 3, 9814671418, 265, 2, 0, 9814671421, 1, 8388608, 265, 3, 1, 9814671421, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166419, 371, 1, 0, 0, 188, 1, 414, 665, 2, 418, 665, 3, 422, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671424, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 1, 8388608, 265, 3, 0, 3, 9814671424, 265, 2, 0, 9814671427, 1, 8388608, 265, 3, 1, 9814671427, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166422, 371, 1, 0, 0, 188, 1, 415, 665, 2, 419, 665, 3, 423, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671430, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 1, 8388608, 265, 3, 0, 3, 9814671430, 265, 2, 0, 9814671433, 1, 8388608, 265, 3, 1, 9814671433, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166425, 371, 1, 0, 0, 188, 1, 416, 665, 2, 420, 665, 3, 424, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671436, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 1, 8388608, 265, 3, 0, 3, 9814671436, 265, 2, 0, 9814671439, 1, 8388608, 265, 3, 1, 9814671439, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166428, 371, 1, 0, 0, 188, 1, 417, 665, 2, 421, 665, 3, 425, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671442, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 1, 8388608, 265, 3, 0, 3, 9814671442, 265, 2, 0, 9814671445, 1, 8388608, 265, 3, 1, 9814671445, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166431, 371, 1, 0, 3, 6652166202, 371, 4, 212, 5, 441, 665, 0, 430, 665, 1, 195, 2, 431, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 265, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 9814671451, 265, 1, 0, 0, 9814671448, 265, 9814671451, 265, 1, 0, 430, 1, 8388608, 665, 1, 195, 1, 8388608, 2, 431, 1, 8388608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 1, 8388608, 265, 2, 0, 3, 9814671448, 265, 2, 0, 9814671451, 1, 8388608, 265, 3, 1, 9814671451, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166434, 371, 1, 0, 9, 449, 665, 10, 450, 665, 11, 451, 665, 12, 452, 665, 13, 453, 665, 14, 454, 665, 15, 455, 665, 16, 456, 665, 17, 216, 0, 432, 665, 1, 433, 665, 2, 434, 665, 3, 435, 665, 4, 436, 665, 5, 437, 665, 6, 438, 665, 7, 439, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 265, 8, 0, 0, 6652166201, 371, 0, 9, 0, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 1, 9814671457, 265, 1, 0, 0, 9814671454, 265, 9814671457, 265, 1, 0, 432, 1, 8388608, 665, 1, 433, 1, 8388608, 665, 2, 434, 1, 8388608, 665, 3, 435, 1, 8388608, 665, 4, 436, 1, 8388608, 665, 5, 437, 1, 8388608, 665, 6, 438, 1, 8388608, 665, 7, 439, 1, 8388608, 665, 8, 196, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 1, 8388608, 265, 8, 0, 3, 9814671454, 265, 2, 0, 9814671457, 1, 8388608, 265, 3, 1, 9814671457, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166437, 371, 1, 0, 0, 458, 665, 1, 461, 665, 2, 462, 665, 3, 463, 665, 4, 464, 665, 5, 465, 665, 6, 466, 665, 7, 467, 665, 8, 468, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671460, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 1, 8388608, 265, 8, 0, 3, 9814671460, 265, 2, 0, 9814671463, 1, 8388608, 265, 3, 1, 9814671463, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166440, 371, 1, 0, 0, 641, 665, 9814671377, 265, 0, 0, 45, 9814671378, 265, 0, 0, 45, 1, 8388608, 9814671378, 1, 8388608, 265, 0, 3, 9814671377, 265, 2, 0, 9814671378, 1, 8388608, 265, 3, 1, 9814671378, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166443, 371, 1, 0, 3, 553, 665, 4, 552, 665, 5, 551, 665, 6, 550, 665, 7, 549, 665, 8, 548, 665, 9, 547, 665, 10, 546, 665, 11, 562, 665, 12, 563, 665, 13, 564, 665, 14, 565, 665, 15, 566, 665, 16, 567, 665, 17, 568, 665, 18, 569, 665, 19, 570, 665, 20, 571, 665, 21, 572, 665, 22, 573, 665, 23, 576, 665, 24, 574, 665, 25, 575, 665, 26, 577, 665, 27, 634, 665, 28, 635, 665, 29, 637, 665, 30, 636, 665, 31, 639, 665, 32, 638, 665, 0, 1ULL, 607, 665, 1, 2ULL, 608, 665, 2, 0, 1, 0, 4ULL, 609, 665, 1, 2, 0, 0, 8ULL, 623, 665, 2, 1, 0, 0, 16ULL, 621, 665, 1, 2, 0, 0, 32ULL, 613, 665, 2, 1, 0, 0, 64ULL, 616, 665, 1, 2, 0, 0, 128ULL, 615, 665, 2, 1, 0, 0, 256ULL, 617, 665, 1, 2, 0, 0, 512ULL, 620, 665, 2, 1, 0, 0, 1024ULL, 619, 665, 1, 2, 0, 0, 2048ULL, 599, 665, 2, 1, 0, 0, 4096ULL, 600, 665, 1, 2, 0, 0, 8192ULL, 598, 665, 2, 1, 0, 0, 16384ULL, 597, 665, 1, 2, 0, 0, 32768ULL, 591, 665, 2, 1, 0, 0, 65536ULL, 593, 665, 1, 2, 0, 0, 131072ULL, 592, 665, 2, 1, 0, 0, 262144ULL, 610, 665, 1, 2, 0, 0, 524288ULL, 611, 665, 2, 1, 0, 0, 1048576ULL, 612, 665, 1, 2, 0, 0, 2097152ULL, 603, 665, 2, 1, 0, 0, 4194304ULL, 604, 665, 1, 2, 0, 0, 8388608ULL, 624, 665, 2, 1, 0, 0, 16777216ULL, 578, 665, 1, 2, 0, 0, 33554432ULL, 579, 665, 2, 1, 0, 0, 67108864ULL, 580, 665, 1, 2, 0, 0, 134217728ULL, 584, 665, 2, 1, 0, 0, 268435456ULL, 581, 665, 1, 2, 0, 0, 536870912ULL, 582, 665, 2, 1, 0, 0, 1073741824ULL, 587, 665, 1, 2, 0, 0, 2147483648ULL, 589, 665, 2, 1, 0, 0, 4294967296ULL, 586, 665, 1, 2, 0, 0, 8589934592ULL, 590, 665, 2, 1, 0, 0, 17179869184ULL, 588, 665, 1, 2, 0, 0, 34359738368ULL, 585, 665, 2, 1, 0, 0, 68719476736ULL, 583, 665, 1, 2, 0, 0, 137438953472ULL, 606, 665, 2, 1, 0, 0, 274877906944ULL, 605, 665, 1, 2, 0, 0, 549755813888ULL, 601, 665, 2, 1, 0, 0, 1099511627776ULL, 655, 665, 1, 2, 0, 0, 2199023255552ULL, 594, 665, 2, 1, 0, 0, 4398046511104ULL, 625, 665, 1, 2, 0, 0, 8796093022208ULL, 626, 665, 2, 1, 0, 0, 17592186044416ULL, 614, 665, 1, 2, 0, 0, 35184372088832ULL, 618, 665, 2, 1, 0, 0, 70368744177664ULL, 656, 665, 1, 2, 0, 0, 1, 1, 595, 665, 2, 596, 665, 33, 622, 665, 34, 653, 665, 35, 654, 665, 36, 542, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671466, 265, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 265, 36, 0, 0, 47, 1, 8388608, 1, 48, 1, 8388608, 2, 49, 1, 8388608, 3, 50, 1, 8388608, 4, 51, 1, 8388608, 5, 52, 1, 8388608, 6, 53, 1, 8388608, 7, 54, 1, 8388608, 8, 56, 1, 8388608, 9, 57, 1, 8388608, 10, 58, 1, 8388608, 11, 59, 1, 8388608, 12, 60, 1, 8388608, 13, 61, 1, 8388608, 14, 62, 1, 8388608, 15, 63, 1, 8388608, 16, 64, 1, 8388608, 17, 65, 1, 8388608, 18, 66, 1, 8388608, 19, 67, 1, 8388608, 20, 68, 1, 8388608, 21, 69, 1, 8388608, 22, 70, 1, 8388608, 23, 71, 1, 8388608, 24, 72, 1, 8388608, 25, 73, 1, 8388608, 26, 74, 1, 8388608, 27, 75, 1, 8388608, 28, 76, 1, 8388608, 29, 77, 1, 8388608, 30, 83, 1, 8388608, 31, 55, 1, 8388608, 32, 78, 1, 8388608, 33, 79, 1, 8388608, 34, 80, 1, 8388608, 35, 81, 1, 8388608, 36, 82, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 1, 8388608, 265, 36, 0, 3, 9814671466, 265, 2, 0, 9814671469, 1, 8388608, 265, 3, 1, 9814671469, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166446, 371, 1, 0, 3, 442, 1, 8388608, 665, 0, 448, 1, 8388608, 665, 443, 1, 8388608, 665, 1, 0, 459, 1, 8388608, 665, 4, 1, 1ULL, 5, 459, 1, 8388608, 665, 0, 443, 1, 8388608, 665, 444, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 445, 1, 8388608, 665, 6652166200, 1, 8388608, 371, 213, 1, 8388608, 0, 0, 2, 445, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 440, 1, 8388608, 665, 1, 0, 2, 0, 6652166200, 1, 8388608, 371, 128ULL, 6652166202, 1, 8388608, 371, 1, 0, 0, 461, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166203, 1, 8388608, 371, 0, 469, 1, 8388608, 665, 2, 6652166203, 1, 8388608, 371, 0, 462, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166204, 1, 8388608, 371, 0, 470, 1, 8388608, 665, 6, 6652166204, 1, 8388608, 371, 0, 463, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166205, 1, 8388608, 371, 0, 471, 1, 8388608, 665, 7, 6652166205, 1, 8388608, 371, 0, 464, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166206, 1, 8388608, 371, 0, 472, 1, 8388608, 665, 8, 6652166206, 1, 8388608, 371, 0, 465, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166207, 1, 8388608, 371, 0, 473, 1, 8388608, 665, 9, 6652166207, 1, 8388608, 371, 0, 466, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166208, 1, 8388608, 371, 0, 474, 1, 8388608, 665, 10, 6652166208, 1, 8388608, 371, 0, 467, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166209, 1, 8388608, 371, 0, 475, 1, 8388608, 665, 11, 6652166209, 1, 8388608, 371, 0, 468, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166210, 1, 8388608, 371, 0, 476, 1, 8388608, 665, 12, 6652166210, 1, 8388608, 371, 0, 458, 1, 8388608, 665, 460, 1, 8388608, 665, 1, 1ULL, 0, 6652166218, 1, 8388608, 371, 215, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 1, 8388608, 371, 0, 9814671472, 1, 8388608, 265, 1, 1, 3, 6652166368, 371, 2, 0, 9814671472, 1, 8388608, 265, 3, 1, 9814671472, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166449, 371, 1, 0, 3, 295, 1, 8388608, 665, 0, 310, 1, 8388608, 665, 296, 1, 8388608, 665, 1, 0, 312, 1, 8388608, 665, 4, 1, 1ULL, 5, 312, 1, 8388608, 665, 0, 296, 1, 8388608, 665, 297, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 298, 1, 8388608, 665, 6652166188, 1, 8388608, 371, 146, 1, 8388608, 0, 0, 2, 298, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 294, 1, 8388608, 665, 1, 0, 2, 0, 6652166188, 1, 8388608, 371, 128ULL, 6652166189, 1, 8388608, 371, 1, 0, 0, 314, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166190, 1, 8388608, 371, 0, 322, 1, 8388608, 665, 2, 6652166190, 1, 8388608, 371, 0, 315, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166191, 1, 8388608, 371, 0, 323, 1, 8388608, 665, 6, 6652166191, 1, 8388608, 371, 0, 316, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166192, 1, 8388608, 371, 0, 324, 1, 8388608, 665, 7, 6652166192, 1, 8388608, 371, 0, 317, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166193, 1, 8388608, 371, 0, 325, 1, 8388608, 665, 8, 6652166193, 1, 8388608, 371, 0, 318, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166194, 1, 8388608, 371, 0, 326, 1, 8388608, 665, 9, 6652166194, 1, 8388608, 371, 0, 319, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166195, 1, 8388608, 371, 0, 327, 1, 8388608, 665, 10, 6652166195, 1, 8388608, 371, 0, 320, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166196, 1, 8388608, 371, 0, 328, 1, 8388608, 665, 11, 6652166196, 1, 8388608, 371, 0, 321, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166197, 1, 8388608, 371, 0, 329, 1, 8388608, 665, 12, 6652166197, 1, 8388608, 371, 0, 311, 1, 8388608, 665, 313, 1, 8388608, 665, 1, 1ULL, 0, 6652166219, 1, 8388608, 371, 147, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 1, 8388608, 371, 0, 9814671475, 1, 8388608, 265, 1, 1, 3, 6652166371, 371, 2, 0, 9814671475, 1, 8388608, 265, 3, 1, 9814671475, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166452, 371, 1, 0, 3, 0ULL, 4, 0ULL, 5, 1ULL, 6, 334, 665, 7, 335, 665, 8, 336, 665, 9, 337, 665, 10, 338, 665, 11, 339, 665, 12, 340, 665, 13, 341, 665, 14, 398, 665, 15, 0ULL, 16, 0ULL, 17, 0ULL, 18, 37, 0, 376, 665, 343, 665, 1, 377, 665, 347, 665, 2, 0, 1, 0, 378, 665, 351, 665, 1, 2, 0, 0, 379, 665, 355, 665, 2, 1, 0, 0, 380, 665, 359, 665, 1, 2, 0, 0, 383, 665, 367, 665, 2, 1, 0, 0, 381, 665, 363, 665, 1, 2, 0, 0, 384, 665, 331, 665, 2, 1, 0, 0, 385, 665, 354, 665, 1, 2, 0, 0, 1, 408, 665, 19, 0, 0, 376, 665, 344, 665, 1, 377, 665, 348, 665, 2, 0, 1, 0, 378, 665, 352, 665, 1, 2, 0, 0, 379, 665, 356, 665, 2, 1, 0, 0, 380, 665, 360, 665, 1, 2, 0, 0, 383, 665, 368, 665, 2, 1, 0, 0, 381, 665, 364, 665, 1, 2, 0, 0, 384, 665, 332, 665, 2, 1, 0, 0, 385, 665, 355, 665, 1, 2, 0, 0, 1, 409, 665, 20, 0, 0, 376, 665, 345, 665, 1, 377, 665, 349, 665, 2, 0, 1, 0, 378, 665, 353, 665, 1, 2, 0, 0, 379, 665, 357, 665, 2, 1, 0, 0, 380, 665, 361, 665, 1, 2, 0, 0, 383, 665, 369, 665, 2, 1, 0, 0, 381, 665, 365, 665, 1, 2, 0, 0, 384, 665, 333, 665, 2, 1, 0, 0, 385, 665, 356, 665, 1, 2, 0, 0, 1, 410, 665, 1, 0, 0, 397, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 6652166455, 371, 0, 3, 0, 54, 1, 55, 2, 56, 3, 57, 4, 58, 5, 59, 6, 60, 7, 61, 8, 605, 665, 620, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 6652166458, 371, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 0ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 54, 37, 55, 38, 56, 39, 57, 40, 58, 41, 59, 42, 60, 43, 61, 44, 607, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 6652166461, 371, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 54, 45, 55, 46, 56, 47, 57, 48, 58, 49, 59, 50, 60, 51, 61, 52, 608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166464, 371, 0, 3, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 497, 665, 21, 496, 665, 22, 495, 665, 23, 494, 665, 24, 493, 665, 25, 492, 665, 26, 491, 665, 27, 490, 665, 28, 505, 665, 29, 504, 665, 30, 503, 665, 31, 502, 665, 32, 501, 665, 33, 500, 665, 34, 499, 665, 35, 498, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 54, 45, 55, 46, 56, 47, 57, 48, 58, 49, 59, 50, 60, 51, 61, 52, 609, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166467, 371, 0, 3, 0, 622, 665, 1, 497, 665, 2, 496, 665, 3, 495, 665, 4, 494, 665, 5, 493, 665, 6, 492, 665, 7, 491, 665, 8, 490, 665, 9, 505, 665, 10, 504, 665, 11, 503, 665, 12, 502, 665, 13, 501, 665, 14, 500, 665, 15, 499, 665, 16, 498, 665, 17, 54, 18, 55, 19, 56, 20, 57, 21, 58, 22, 59, 23, 60, 24, 61, 25, 602, 665, 26, 621, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 6652166470, 371, 0, 3, 0, 53, 1, 54, 2, 615, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166473, 371, 0, 3, 0, 53, 1, 54, 2, 55, 3, 56, 4, 57, 5, 58, 6, 59, 7, 60, 8, 61, 9, 640, 665, 10, 616, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 6652166476, 371, 0, 3, 0, 53, 1, 54, 2, 619, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166479, 371, 0, 3, 1, 53, 0, 4294967296ULL, 55, 2, 54, 0, 0, 4294967296ULL, 57, 3, 56, 0, 0, 4294967296ULL, 59, 4, 58, 0, 0, 4294967296ULL, 61, 5, 60, 0, 0, 640, 665, 6, 620, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 6652166482, 371, 0, 3, 0, 53, 1, 45, 2, 604, 665, 3, 54, 4, 55, 5, 56, 6, 57, 7, 58, 8, 59, 9, 60, 10, 61, 11, 603, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 6652166485, 371, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 0, 661, 665, 5, 662, 665, 6, 663, 665, 7, 664, 665, 8, 54, 9, 55, 10, 56, 11, 57, 12, 58, 13, 59, 14, 60, 15, 61, 16, 640, 665, 17, 606, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 6652166488, 371, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 5, 661, 665, 6, 662, 665, 7, 663, 665, 8, 664, 665, 9, 521, 665, 10, 520, 665, 11, 519, 665, 12, 518, 665, 13, 517, 665, 14, 516, 665, 15, 515, 665, 16, 514, 665, 0, 4294967296ULL, 55, 17, 54, 0, 0, 4294967296ULL, 57, 18, 56, 0, 0, 4294967296ULL, 59, 19, 58, 0, 0, 4294967296ULL, 61, 20, 60, 0, 0, 640, 665, 21, 605, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 6652166491, 371, 0, 3, 0, 0ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 54, 19, 55, 20, 56, 21, 57, 22, 58, 23, 59, 24, 60, 25, 61, 26, 513, 665, 27, 610, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166494, 371, 0, 3, 0, 1ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 54, 19, 55, 20, 56, 21, 57, 22, 58, 23, 59, 24, 60, 25, 61, 26, 513, 665, 27, 521, 665, 28, 520, 665, 29, 519, 665, 30, 518, 665, 31, 517, 665, 32, 516, 665, 33, 515, 665, 34, 514, 665, 35, 529, 665, 36, 528, 665, 37, 527, 665, 38, 526, 665, 39, 525, 665, 40, 524, 665, 41, 523, 665, 42, 522, 665, 43, 611, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 6652166497, 371, 0, 3, 0, 0ULL, 1, 1ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 54, 11, 55, 12, 56, 13, 57, 14, 58, 15, 59, 16, 60, 17, 61, 18, 513, 665, 19, 521, 665, 20, 520, 665, 21, 519, 665, 22, 518, 665, 23, 517, 665, 24, 516, 665, 25, 515, 665, 26, 514, 665, 27, 612, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166500, 371, 0, 3, 0, 8589934592ULL, 417, 665, 1, 4194304ULL, 416, 665, 2, 0, 1, 0, 2048ULL, 415, 665, 1, 2, 0, 0, 1, 414, 665, 3, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 8589934592ULL, 421, 665, 1, 4194304ULL, 420, 665, 2, 0, 1, 0, 2048ULL, 419, 665, 1, 2, 0, 0, 1, 418, 665, 4, 0, 0, 12275445934081160404ULL, 3, 1, 0, 0, 4, 1, 1, 0, 2, 3, 2, 1, 0, 8589934592ULL, 425, 665, 1, 4194304ULL, 424, 665, 2, 0, 1, 0, 2048ULL, 423, 665, 1, 2, 0, 0, 1, 422, 665, 1, 0, 0, 4756475762779100925ULL, 3, 1, 0, 0, 1, 1, 1, 0, 2, 6652166503, 371, 3, 1, 0, 185, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 186, 0, 0, 3, 1, 4, 0, 0, 1, 2, 3, 2, 0, 0, 187, 0, 0, 3, 1, 1, 0, 0, 1, 2, 6652166506, 371, 3, 0, 1, 429, 665, 0, 3, 1, 1, 0, 2, 1, 2, 0, 12275445934081160404ULL, 3, 1, 0, 0, 6652166199, 371, 1, 1, 0, 2, 3, 2, 1, 2, 426, 665, 0, 4756475762779100925ULL, 3, 1, 0, 0, 2, 1, 1, 0, 2, 6652166509, 371, 3, 1, 0, 209, 0, 0, 3, 1, 1, 0, 2, 1, 2, 0, 210, 0, 0, 3, 1, 6652166199, 371, 0, 0, 1, 2, 3, 2, 0, 0, 211, 0, 0, 3, 1, 2, 0, 0, 1, 2, 6652166512, 371, 3, 0};
+inline uint64_t args3[NARGS_] = { 0, 1ULL, 45, 665, 1, 0, 3, 1, 8388608, 665, 0, 45, 665, 4, 1, 8388608, 665, 2, 1, 0, 0, 4, 1, 8388608, 665, 3, 1, 8388608, 665, 1, 0, 0, 665, 0, 2, 665, 0, 665, 3, 2, 0, 6652166144, 371, 1, 3, 1, 45, 665, 3, 1, 8388608, 665, 0, 4, 1, 8388608, 665, 3, 1, 8388608, 665, 2, 0, 1, 665, 0, 2, 665, 1, 665, 3, 1, 0, 6652166145, 371, 2, 3, 0, 1ULL, 45, 665, 1, 0, 0, 665, 0, 45, 665, 1, 665, 2, 1, 0, 0, 1ULL, 3, 1, 8388608, 665, 1, 0, 4, 1, 8388608, 665, 3, 1, 2, 0, 3, 1, 8388608, 665, 4, 1, 8388608, 665, 1, 0, 2, 665, 6652166146, 371, 3, 1, 0, 58, 665, 74, 665, 1, 0, 90, 665, 3, 1, 138, 665, 0, 58, 665, 75, 665, 1, 59, 665, 74, 665, 2, 0, 1, 0, 2, 91, 665, 4, 0, 139, 665, 0, 58, 665, 76, 665, 1, 59, 665, 75, 665, 2, 0, 1, 0, 60, 665, 74, 665, 1, 2, 0, 0, 1, 92, 665, 5, 0, 140, 665, 0, 58, 665, 77, 665, 1, 59, 665, 76, 665, 2, 0, 1, 0, 60, 665, 75, 665, 1, 2, 0, 0, 61, 665, 74, 665, 2, 1, 0, 0, 2, 93, 665, 6, 0, 141, 665, 0, 58, 665, 78, 665, 1, 59, 665, 77, 665, 2, 0, 1, 0, 60, 665, 76, 665, 1, 2, 0, 0, 61, 665, 75, 665, 2, 1, 0, 0, 62, 665, 74, 665, 1, 2, 0, 0, 1, 94, 665, 7, 0, 142, 665, 0, 58, 665, 79, 665, 1, 59, 665, 78, 665, 2, 0, 1, 0, 60, 665, 77, 665, 1, 2, 0, 0, 61, 665, 76, 665, 2, 1, 0, 0, 62, 665, 75, 665, 1, 2, 0, 0, 63, 665, 74, 665, 2, 1, 0, 0, 2, 95, 665, 8, 0, 143, 665, 0, 58, 665, 80, 665, 1, 59, 665, 79, 665, 2, 0, 1, 0, 60, 665, 78, 665, 1, 2, 0, 0, 61, 665, 77, 665, 2, 1, 0, 0, 62, 665, 76, 665, 1, 2, 0, 0, 63, 665, 75, 665, 2, 1, 0, 0, 64, 665, 74, 665, 1, 2, 0, 0, 1, 96, 665, 9, 0, 144, 665, 0, 58, 665, 81, 665, 1, 59, 665, 80, 665, 2, 0, 1, 0, 60, 665, 79, 665, 1, 2, 0, 0, 61, 665, 78, 665, 2, 1, 0, 0, 62, 665, 77, 665, 1, 2, 0, 0, 63, 665, 76, 665, 2, 1, 0, 0, 64, 665, 75, 665, 1, 2, 0, 0, 65, 665, 74, 665, 2, 1, 0, 0, 2, 97, 665, 10, 0, 145, 665, 0, 58, 665, 82, 665, 1, 59, 665, 81, 665, 2, 0, 1, 0, 60, 665, 80, 665, 1, 2, 0, 0, 61, 665, 79, 665, 2, 1, 0, 0, 62, 665, 78, 665, 1, 2, 0, 0, 63, 665, 77, 665, 2, 1, 0, 0, 64, 665, 76, 665, 1, 2, 0, 0, 65, 665, 75, 665, 2, 1, 0, 0, 66, 665, 74, 665, 1, 2, 0, 0, 1, 98, 665, 11, 0, 146, 665, 0, 58, 665, 83, 665, 1, 59, 665, 82, 665, 2, 0, 1, 0, 60, 665, 81, 665, 1, 2, 0, 0, 61, 665, 80, 665, 2, 1, 0, 0, 62, 665, 79, 665, 1, 2, 0, 0, 63, 665, 78, 665, 2, 1, 0, 0, 64, 665, 77, 665, 1, 2, 0, 0, 65, 665, 76, 665, 2, 1, 0, 0, 66, 665, 75, 665, 1, 2, 0, 0, 67, 665, 74, 665, 2, 1, 0, 0, 2, 99, 665, 12, 0, 147, 665, 0, 58, 665, 84, 665, 1, 59, 665, 83, 665, 2, 0, 1, 0, 60, 665, 82, 665, 1, 2, 0, 0, 61, 665, 81, 665, 2, 1, 0, 0, 62, 665, 80, 665, 1, 2, 0, 0, 63, 665, 79, 665, 2, 1, 0, 0, 64, 665, 78, 665, 1, 2, 0, 0, 65, 665, 77, 665, 2, 1, 0, 0, 66, 665, 76, 665, 1, 2, 0, 0, 67, 665, 75, 665, 2, 1, 0, 0, 68, 665, 74, 665, 1, 2, 0, 0, 1, 100, 665, 13, 0, 148, 665, 0, 58, 665, 85, 665, 1, 59, 665, 84, 665, 2, 0, 1, 0, 60, 665, 83, 665, 1, 2, 0, 0, 61, 665, 82, 665, 2, 1, 0, 0, 62, 665, 81, 665, 1, 2, 0, 0, 63, 665, 80, 665, 2, 1, 0, 0, 64, 665, 79, 665, 1, 2, 0, 0, 65, 665, 78, 665, 2, 1, 0, 0, 66, 665, 77, 665, 1, 2, 0, 0, 67, 665, 76, 665, 2, 1, 0, 0, 68, 665, 75, 665, 1, 2, 0, 0, 69, 665, 74, 665, 2, 1, 0, 0, 2, 101, 665, 14, 0, 149, 665, 0, 58, 665, 86, 665, 1, 59, 665, 85, 665, 2, 0, 1, 0, 60, 665, 84, 665, 1, 2, 0, 0, 61, 665, 83, 665, 2, 1, 0, 0, 62, 665, 82, 665, 1, 2, 0, 0, 63, 665, 81, 665, 2, 1, 0, 0, 64, 665, 80, 665, 1, 2, 0, 0, 65, 665, 79, 665, 2, 1, 0, 0, 66, 665, 78, 665, 1, 2, 0, 0, 67, 665, 77, 665, 2, 1, 0, 0, 68, 665, 76, 665, 1, 2, 0, 0, 69, 665, 75, 665, 2, 1, 0, 0, 70, 665, 74, 665, 1, 2, 0, 0, 1, 102, 665, 15, 0, 150, 665, 0, 58, 665, 87, 665, 1, 59, 665, 86, 665, 2, 0, 1, 0, 60, 665, 85, 665, 1, 2, 0, 0, 61, 665, 84, 665, 2, 1, 0, 0, 62, 665, 83, 665, 1, 2, 0, 0, 63, 665, 82, 665, 2, 1, 0, 0, 64, 665, 81, 665, 1, 2, 0, 0, 65, 665, 80, 665, 2, 1, 0, 0, 66, 665, 79, 665, 1, 2, 0, 0, 67, 665, 78, 665, 2, 1, 0, 0, 68, 665, 77, 665, 1, 2, 0, 0, 69, 665, 76, 665, 2, 1, 0, 0, 70, 665, 75, 665, 1, 2, 0, 0, 71, 665, 74, 665, 2, 1, 0, 0, 2, 103, 665, 16, 0, 151, 665, 0, 58, 665, 88, 665, 1, 59, 665, 87, 665, 2, 0, 1, 0, 60, 665, 86, 665, 1, 2, 0, 0, 61, 665, 85, 665, 2, 1, 0, 0, 62, 665, 84, 665, 1, 2, 0, 0, 63, 665, 83, 665, 2, 1, 0, 0, 64, 665, 82, 665, 1, 2, 0, 0, 65, 665, 81, 665, 2, 1, 0, 0, 66, 665, 80, 665, 1, 2, 0, 0, 67, 665, 79, 665, 2, 1, 0, 0, 68, 665, 78, 665, 1, 2, 0, 0, 69, 665, 77, 665, 2, 1, 0, 0, 70, 665, 76, 665, 1, 2, 0, 0, 71, 665, 75, 665, 2, 1, 0, 0, 72, 665, 74, 665, 1, 2, 0, 0, 1, 104, 665, 17, 0, 152, 665, 0, 58, 665, 89, 665, 1, 59, 665, 88, 665, 2, 0, 1, 0, 60, 665, 87, 665, 1, 2, 0, 0, 61, 665, 86, 665, 2, 1, 0, 0, 62, 665, 85, 665, 1, 2, 0, 0, 63, 665, 84, 665, 2, 1, 0, 0, 64, 665, 83, 665, 1, 2, 0, 0, 65, 665, 82, 665, 2, 1, 0, 0, 66, 665, 81, 665, 1, 2, 0, 0, 67, 665, 80, 665, 2, 1, 0, 0, 68, 665, 79, 665, 1, 2, 0, 0, 69, 665, 78, 665, 2, 1, 0, 0, 70, 665, 77, 665, 1, 2, 0, 0, 71, 665, 76, 665, 2, 1, 0, 0, 72, 665, 75, 665, 1, 2, 0, 0, 73, 665, 74, 665, 2, 1, 0, 0, 2, 105, 665, 18, 0, 153, 665, 0, 59, 665, 89, 665, 1, 60, 665, 88, 665, 2, 0, 1, 0, 61, 665, 87, 665, 1, 2, 0, 0, 62, 665, 86, 665, 2, 1, 0, 0, 63, 665, 85, 665, 1, 2, 0, 0, 64, 665, 84, 665, 2, 1, 0, 0, 65, 665, 83, 665, 1, 2, 0, 0, 66, 665, 82, 665, 2, 1, 0, 0, 67, 665, 81, 665, 1, 2, 0, 0, 68, 665, 80, 665, 2, 1, 0, 0, 69, 665, 79, 665, 1, 2, 0, 0, 70, 665, 78, 665, 2, 1, 0, 0, 71, 665, 77, 665, 1, 2, 0, 0, 72, 665, 76, 665, 2, 1, 0, 0, 73, 665, 75, 665, 1, 2, 0, 19, 1, 106, 665, 0, 60, 665, 89, 665, 1, 61, 665, 88, 665, 2, 0, 1, 0, 62, 665, 87, 665, 1, 2, 0, 0, 63, 665, 86, 665, 2, 1, 0, 0, 64, 665, 85, 665, 1, 2, 0, 0, 65, 665, 84, 665, 2, 1, 0, 0, 66, 665, 83, 665, 1, 2, 0, 0, 67, 665, 82, 665, 2, 1, 0, 0, 68, 665, 81, 665, 1, 2, 0, 0, 69, 665, 80, 665, 2, 1, 0, 0, 70, 665, 79, 665, 1, 2, 0, 0, 71, 665, 78, 665, 2, 1, 0, 0, 72, 665, 77, 665, 1, 2, 0, 0, 73, 665, 76, 665, 2, 1, 0, 20, 2, 107, 665, 0, 61, 665, 89, 665, 1, 62, 665, 88, 665, 2, 0, 1, 0, 63, 665, 87, 665, 1, 2, 0, 0, 64, 665, 86, 665, 2, 1, 0, 0, 65, 665, 85, 665, 1, 2, 0, 0, 66, 665, 84, 665, 2, 1, 0, 0, 67, 665, 83, 665, 1, 2, 0, 0, 68, 665, 82, 665, 2, 1, 0, 0, 69, 665, 81, 665, 1, 2, 0, 0, 70, 665, 80, 665, 2, 1, 0, 0, 71, 665, 79, 665, 1, 2, 0, 0, 72, 665, 78, 665, 2, 1, 0, 0, 73, 665, 77, 665, 1, 2, 0, 21, 1, 108, 665, 0, 62, 665, 89, 665, 1, 63, 665, 88, 665, 2, 0, 1, 0, 64, 665, 87, 665, 1, 2, 0, 0, 65, 665, 86, 665, 2, 1, 0, 0, 66, 665, 85, 665, 1, 2, 0, 0, 67, 665, 84, 665, 2, 1, 0, 0, 68, 665, 83, 665, 1, 2, 0, 0, 69, 665, 82, 665, 2, 1, 0, 0, 70, 665, 81, 665, 1, 2, 0, 0, 71, 665, 80, 665, 2, 1, 0, 0, 72, 665, 79, 665, 1, 2, 0, 0, 73, 665, 78, 665, 2, 1, 0, 22, 2, 109, 665, 0, 63, 665, 89, 665, 1, 64, 665, 88, 665, 2, 0, 1, 0, 65, 665, 87, 665, 1, 2, 0, 0, 66, 665, 86, 665, 2, 1, 0, 0, 67, 665, 85, 665, 1, 2, 0, 0, 68, 665, 84, 665, 2, 1, 0, 0, 69, 665, 83, 665, 1, 2, 0, 0, 70, 665, 82, 665, 2, 1, 0, 0, 71, 665, 81, 665, 1, 2, 0, 0, 72, 665, 80, 665, 2, 1, 0, 0, 73, 665, 79, 665, 1, 2, 0, 23, 1, 110, 665, 0, 64, 665, 89, 665, 1, 65, 665, 88, 665, 2, 0, 1, 0, 66, 665, 87, 665, 1, 2, 0, 0, 67, 665, 86, 665, 2, 1, 0, 0, 68, 665, 85, 665, 1, 2, 0, 0, 69, 665, 84, 665, 2, 1, 0, 0, 70, 665, 83, 665, 1, 2, 0, 0, 71, 665, 82, 665, 2, 1, 0, 0, 72, 665, 81, 665, 1, 2, 0, 0, 73, 665, 80, 665, 2, 1, 0, 24, 2, 111, 665, 0, 65, 665, 89, 665, 1, 66, 665, 88, 665, 2, 0, 1, 0, 67, 665, 87, 665, 1, 2, 0, 0, 68, 665, 86, 665, 2, 1, 0, 0, 69, 665, 85, 665, 1, 2, 0, 0, 70, 665, 84, 665, 2, 1, 0, 0, 71, 665, 83, 665, 1, 2, 0, 0, 72, 665, 82, 665, 2, 1, 0, 0, 73, 665, 81, 665, 1, 2, 0, 25, 1, 112, 665, 0, 66, 665, 89, 665, 1, 67, 665, 88, 665, 2, 0, 1, 0, 68, 665, 87, 665, 1, 2, 0, 0, 69, 665, 86, 665, 2, 1, 0, 0, 70, 665, 85, 665, 1, 2, 0, 0, 71, 665, 84, 665, 2, 1, 0, 0, 72, 665, 83, 665, 1, 2, 0, 0, 73, 665, 82, 665, 2, 1, 0, 26, 2, 113, 665, 0, 67, 665, 89, 665, 1, 68, 665, 88, 665, 2, 0, 1, 0, 69, 665, 87, 665, 1, 2, 0, 0, 70, 665, 86, 665, 2, 1, 0, 0, 71, 665, 85, 665, 1, 2, 0, 0, 72, 665, 84, 665, 2, 1, 0, 0, 73, 665, 83, 665, 1, 2, 0, 27, 1, 114, 665, 0, 68, 665, 89, 665, 1, 69, 665, 88, 665, 2, 0, 1, 0, 70, 665, 87, 665, 1, 2, 0, 0, 71, 665, 86, 665, 2, 1, 0, 0, 72, 665, 85, 665, 1, 2, 0, 0, 73, 665, 84, 665, 2, 1, 0, 28, 2, 115, 665, 0, 69, 665, 89, 665, 1, 70, 665, 88, 665, 2, 0, 1, 0, 71, 665, 87, 665, 1, 2, 0, 0, 72, 665, 86, 665, 2, 1, 0, 0, 73, 665, 85, 665, 1, 2, 0, 29, 1, 116, 665, 0, 70, 665, 89, 665, 1, 71, 665, 88, 665, 2, 0, 1, 0, 72, 665, 87, 665, 1, 2, 0, 0, 73, 665, 86, 665, 2, 1, 0, 30, 2, 117, 665, 0, 71, 665, 89, 665, 1, 72, 665, 88, 665, 2, 0, 1, 0, 73, 665, 87, 665, 1, 2, 0, 31, 1, 118, 665, 0, 72, 665, 89, 665, 1, 73, 665, 88, 665, 2, 0, 1, 32, 2, 119, 665, 0, 73, 665, 89, 665, 33, 0, 120, 665, 34, 0ULL, 121, 665, 0, 3, 5, 1, 4, 6, 2, 0, 1, 0, 5, 7, 1, 2, 0, 0, 6, 8, 2, 1, 0, 0, 7, 9, 1, 2, 0, 0, 8, 10, 2, 1, 0, 0, 9, 11, 1, 2, 0, 0, 10, 12, 2, 1, 0, 0, 11, 13, 1, 2, 0, 0, 12, 14, 2, 1, 0, 0, 13, 15, 1, 2, 0, 0, 14, 16, 2, 1, 0, 0, 15, 17, 1, 2, 0, 0, 16, 18, 2, 1, 0, 0, 17, 19, 1, 2, 0, 0, 18, 20, 2, 1, 0, 0, 19, 21, 1, 2, 0, 0, 20, 22, 2, 1, 0, 0, 21, 23, 1, 2, 0, 0, 22, 24, 2, 1, 0, 0, 23, 25, 1, 2, 0, 0, 24, 26, 2, 1, 0, 0, 25, 27, 1, 2, 0, 0, 26, 28, 2, 1, 0, 0, 27, 29, 1, 2, 0, 0, 28, 30, 2, 1, 0, 0, 29, 31, 1, 2, 0, 0, 30, 32, 2, 1, 0, 0, 31, 33, 1, 2, 0, 0, 32, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166147, 371, 1, 0, 0, 154, 665, 90, 665, 1, 154, 665, 58, 665, 2, 0, 1, 0, 64559ULL, 170, 665, 1, 2, 0, 0, 1, 106, 665, 5, 0, 74, 665, 0, 154, 665, 91, 665, 1, 154, 665, 59, 665, 2, 0, 1, 0, 64559ULL, 171, 665, 3, 2, 0, 0, 155, 665, 90, 665, 1, 155, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 107, 665, 6, 1, 75, 665, 0, 154, 665, 92, 665, 1, 154, 665, 60, 665, 2, 0, 1, 0, 64559ULL, 172, 665, 3, 2, 0, 0, 155, 665, 91, 665, 1, 155, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 90, 665, 1, 156, 665, 58, 665, 2, 0, 1, 0, 65534ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 108, 665, 7, 1, 76, 665, 0, 154, 665, 93, 665, 1, 154, 665, 61, 665, 2, 0, 1, 0, 64559ULL, 173, 665, 3, 2, 0, 0, 155, 665, 92, 665, 1, 155, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 91, 665, 1, 156, 665, 59, 665, 2, 0, 1, 0, 65534ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 90, 665, 1, 157, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 109, 665, 8, 1, 77, 665, 0, 154, 665, 94, 665, 1, 154, 665, 62, 665, 2, 0, 1, 0, 64559ULL, 174, 665, 3, 2, 0, 0, 155, 665, 93, 665, 1, 155, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 92, 665, 1, 156, 665, 60, 665, 2, 0, 1, 0, 65534ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 91, 665, 1, 157, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 90, 665, 1, 158, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 110, 665, 9, 1, 78, 665, 0, 154, 665, 95, 665, 1, 154, 665, 63, 665, 2, 0, 1, 0, 64559ULL, 175, 665, 3, 2, 0, 0, 155, 665, 94, 665, 1, 155, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 93, 665, 1, 156, 665, 61, 665, 2, 0, 1, 0, 65534ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 92, 665, 1, 157, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 91, 665, 1, 158, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 90, 665, 1, 159, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 111, 665, 10, 1, 79, 665, 0, 154, 665, 96, 665, 1, 154, 665, 64, 665, 2, 0, 1, 0, 64559ULL, 176, 665, 3, 2, 0, 0, 155, 665, 95, 665, 1, 155, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 94, 665, 1, 156, 665, 62, 665, 2, 0, 1, 0, 65534ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 93, 665, 1, 157, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 92, 665, 1, 158, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 91, 665, 1, 159, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 90, 665, 1, 160, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 112, 665, 11, 1, 80, 665, 0, 154, 665, 97, 665, 1, 154, 665, 65, 665, 2, 0, 1, 0, 64559ULL, 177, 665, 3, 2, 0, 0, 155, 665, 96, 665, 1, 155, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 95, 665, 1, 156, 665, 63, 665, 2, 0, 1, 0, 65534ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 94, 665, 1, 157, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 93, 665, 1, 158, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 92, 665, 1, 159, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 91, 665, 1, 160, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 90, 665, 1, 161, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 113, 665, 12, 1, 81, 665, 0, 154, 665, 98, 665, 1, 154, 665, 66, 665, 2, 0, 1, 0, 64559ULL, 178, 665, 3, 2, 0, 0, 155, 665, 97, 665, 1, 155, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 96, 665, 1, 156, 665, 64, 665, 2, 0, 1, 0, 65534ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 95, 665, 1, 157, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 94, 665, 1, 158, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 93, 665, 1, 159, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 92, 665, 1, 160, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 91, 665, 1, 161, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 90, 665, 1, 162, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 114, 665, 13, 1, 82, 665, 0, 154, 665, 99, 665, 1, 154, 665, 67, 665, 2, 0, 1, 0, 64559ULL, 179, 665, 3, 2, 0, 0, 155, 665, 98, 665, 1, 155, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 97, 665, 1, 156, 665, 65, 665, 2, 0, 1, 0, 65534ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 96, 665, 1, 157, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 95, 665, 1, 158, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 94, 665, 1, 159, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 93, 665, 1, 160, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 92, 665, 1, 161, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 91, 665, 1, 162, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 90, 665, 1, 163, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 115, 665, 14, 1, 83, 665, 0, 154, 665, 100, 665, 1, 154, 665, 68, 665, 2, 0, 1, 0, 64559ULL, 180, 665, 3, 2, 0, 0, 155, 665, 99, 665, 1, 155, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 98, 665, 1, 156, 665, 66, 665, 2, 0, 1, 0, 65534ULL, 178, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 97, 665, 1, 157, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 96, 665, 1, 158, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 95, 665, 1, 159, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 94, 665, 1, 160, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 93, 665, 1, 161, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 92, 665, 1, 162, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 91, 665, 1, 163, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 90, 665, 1, 164, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 116, 665, 15, 1, 84, 665, 0, 154, 665, 101, 665, 1, 154, 665, 69, 665, 2, 0, 1, 0, 64559ULL, 181, 665, 3, 2, 0, 0, 155, 665, 100, 665, 1, 155, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 99, 665, 1, 156, 665, 67, 665, 2, 0, 1, 0, 65534ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 98, 665, 1, 157, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 97, 665, 1, 158, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 96, 665, 1, 159, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 95, 665, 1, 160, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 94, 665, 1, 161, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 93, 665, 1, 162, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 92, 665, 1, 163, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 91, 665, 1, 164, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 90, 665, 1, 165, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 117, 665, 16, 1, 85, 665, 0, 154, 665, 102, 665, 1, 154, 665, 70, 665, 2, 0, 1, 0, 64559ULL, 182, 665, 3, 2, 0, 0, 155, 665, 101, 665, 1, 155, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 100, 665, 1, 156, 665, 68, 665, 2, 0, 1, 0, 65534ULL, 180, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 99, 665, 1, 157, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 98, 665, 1, 158, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 97, 665, 1, 159, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 96, 665, 1, 160, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 95, 665, 1, 161, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 94, 665, 1, 162, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 93, 665, 1, 163, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 92, 665, 1, 164, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 91, 665, 1, 165, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 90, 665, 1, 166, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 118, 665, 17, 1, 86, 665, 0, 154, 665, 103, 665, 1, 154, 665, 71, 665, 2, 0, 1, 0, 64559ULL, 183, 665, 3, 2, 0, 0, 155, 665, 102, 665, 1, 155, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 101, 665, 1, 156, 665, 69, 665, 2, 0, 1, 0, 65534ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 100, 665, 1, 157, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 99, 665, 1, 158, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 98, 665, 1, 159, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 97, 665, 1, 160, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 96, 665, 1, 161, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 95, 665, 1, 162, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 94, 665, 1, 163, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 93, 665, 1, 164, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 92, 665, 1, 165, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 91, 665, 1, 166, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 90, 665, 1, 167, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 119, 665, 18, 1, 87, 665, 0, 154, 665, 104, 665, 1, 154, 665, 72, 665, 2, 0, 1, 0, 64559ULL, 184, 665, 3, 2, 0, 0, 155, 665, 103, 665, 1, 155, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 102, 665, 1, 156, 665, 70, 665, 2, 0, 1, 0, 65534ULL, 182, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 101, 665, 1, 157, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 100, 665, 1, 158, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 99, 665, 1, 159, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 98, 665, 1, 160, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 97, 665, 1, 161, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 96, 665, 1, 162, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 95, 665, 1, 163, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 94, 665, 1, 164, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 93, 665, 1, 165, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 92, 665, 1, 166, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 91, 665, 1, 167, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 90, 665, 1, 168, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 4, 1, 1, 0, 120, 665, 19, 1, 88, 665, 0, 154, 665, 105, 665, 1, 154, 665, 73, 665, 2, 0, 1, 0, 64559ULL, 185, 665, 3, 2, 0, 0, 155, 665, 104, 665, 1, 155, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 103, 665, 1, 156, 665, 71, 665, 2, 0, 1, 0, 65534ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 102, 665, 1, 157, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 101, 665, 1, 158, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 100, 665, 1, 159, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 99, 665, 1, 160, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 98, 665, 1, 161, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 97, 665, 1, 162, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 96, 665, 1, 163, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 95, 665, 1, 164, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 94, 665, 1, 165, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 93, 665, 1, 166, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 92, 665, 1, 167, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 91, 665, 1, 168, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 90, 665, 1, 169, 665, 58, 665, 2, 0, 1, 0, 65535ULL, 170, 665, 1, 2, 0, 0, 3, 1, 1, 0, 121, 665, 20, 1, 89, 665, 0, 155, 665, 105, 665, 1, 155, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 156, 665, 104, 665, 1, 156, 665, 72, 665, 2, 0, 1, 0, 65534ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 157, 665, 103, 665, 1, 157, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 158, 665, 102, 665, 1, 158, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 101, 665, 1, 159, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 100, 665, 1, 160, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 99, 665, 1, 161, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 98, 665, 1, 162, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 97, 665, 1, 163, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 96, 665, 1, 164, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 95, 665, 1, 165, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 94, 665, 1, 166, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 93, 665, 1, 167, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 92, 665, 1, 168, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 91, 665, 1, 169, 665, 59, 665, 2, 0, 1, 0, 65535ULL, 171, 665, 1, 2, 0, 0, 4, 1, 21, 0, 258236ULL, 0, 156, 665, 105, 665, 1, 156, 665, 73, 665, 2, 0, 1, 0, 65534ULL, 185, 665, 3, 2, 0, 0, 157, 665, 104, 665, 1, 157, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 103, 665, 1, 158, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 102, 665, 1, 159, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 101, 665, 1, 160, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 100, 665, 1, 161, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 99, 665, 1, 162, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 98, 665, 1, 163, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 97, 665, 1, 164, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 96, 665, 1, 165, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 95, 665, 1, 166, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 94, 665, 1, 167, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 93, 665, 1, 168, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 92, 665, 1, 169, 665, 60, 665, 2, 0, 1, 0, 65535ULL, 172, 665, 1, 2, 0, 0, 3, 1, 22, 0, 262140ULL, 0, 157, 665, 105, 665, 1, 157, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 158, 665, 104, 665, 1, 158, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 103, 665, 1, 159, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 102, 665, 1, 160, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 101, 665, 1, 161, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 100, 665, 1, 162, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 99, 665, 1, 163, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 98, 665, 1, 164, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 97, 665, 1, 165, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 96, 665, 1, 166, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 95, 665, 1, 167, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 94, 665, 1, 168, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 93, 665, 1, 169, 665, 61, 665, 2, 0, 1, 0, 65535ULL, 173, 665, 1, 2, 0, 0, 4, 1, 23, 0, 262136ULL, 0, 158, 665, 105, 665, 1, 158, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 159, 665, 104, 665, 1, 159, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 103, 665, 1, 160, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 102, 665, 1, 161, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 101, 665, 1, 162, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 100, 665, 1, 163, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 99, 665, 1, 164, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 98, 665, 1, 165, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 97, 665, 1, 166, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 96, 665, 1, 167, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 95, 665, 1, 168, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 94, 665, 1, 169, 665, 62, 665, 2, 0, 1, 0, 65535ULL, 174, 665, 1, 2, 0, 0, 3, 1, 24, 0, 262140ULL, 0, 159, 665, 105, 665, 1, 159, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 160, 665, 104, 665, 1, 160, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 103, 665, 1, 161, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 102, 665, 1, 162, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 101, 665, 1, 163, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 100, 665, 1, 164, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 99, 665, 1, 165, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 98, 665, 1, 166, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 97, 665, 1, 167, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 96, 665, 1, 168, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 95, 665, 1, 169, 665, 63, 665, 2, 0, 1, 0, 65535ULL, 175, 665, 1, 2, 0, 0, 4, 1, 25, 0, 262140ULL, 0, 160, 665, 105, 665, 1, 160, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 161, 665, 104, 665, 1, 161, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 103, 665, 1, 162, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 102, 665, 1, 163, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 101, 665, 1, 164, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 100, 665, 1, 165, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 99, 665, 1, 166, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 98, 665, 1, 167, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 97, 665, 1, 168, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 96, 665, 1, 169, 665, 64, 665, 2, 0, 1, 0, 65535ULL, 176, 665, 1, 2, 0, 0, 3, 1, 26, 0, 262140ULL, 0, 161, 665, 105, 665, 1, 161, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 162, 665, 104, 665, 1, 162, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 103, 665, 1, 163, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 102, 665, 1, 164, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 101, 665, 1, 165, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 100, 665, 1, 166, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 99, 665, 1, 167, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 98, 665, 1, 168, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 97, 665, 1, 169, 665, 65, 665, 2, 0, 1, 0, 65535ULL, 177, 665, 1, 2, 0, 0, 4, 1, 27, 0, 262140ULL, 0, 162, 665, 105, 665, 1, 162, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 163, 665, 104, 665, 1, 163, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 103, 665, 1, 164, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 102, 665, 1, 165, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 101, 665, 1, 166, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 100, 665, 1, 167, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 99, 665, 1, 168, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 98, 665, 1, 169, 665, 66, 665, 2, 0, 1, 0, 65535ULL, 178, 665, 1, 2, 0, 0, 3, 1, 28, 0, 262140ULL, 0, 163, 665, 105, 665, 1, 163, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 164, 665, 104, 665, 1, 164, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 103, 665, 1, 165, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 102, 665, 1, 166, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 101, 665, 1, 167, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 100, 665, 1, 168, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 99, 665, 1, 169, 665, 67, 665, 2, 0, 1, 0, 65535ULL, 179, 665, 1, 2, 0, 0, 4, 1, 29, 0, 262140ULL, 0, 164, 665, 105, 665, 1, 164, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 165, 665, 104, 665, 1, 165, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 103, 665, 1, 166, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 102, 665, 1, 167, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 101, 665, 1, 168, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 100, 665, 1, 169, 665, 68, 665, 2, 0, 1, 0, 65535ULL, 180, 665, 1, 2, 0, 0, 3, 1, 30, 0, 262140ULL, 0, 165, 665, 105, 665, 1, 165, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 166, 665, 104, 665, 1, 166, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 103, 665, 1, 167, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 102, 665, 1, 168, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 101, 665, 1, 169, 665, 69, 665, 2, 0, 1, 0, 65535ULL, 181, 665, 1, 2, 0, 0, 4, 1, 31, 0, 262140ULL, 0, 166, 665, 105, 665, 1, 166, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 167, 665, 104, 665, 1, 167, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 103, 665, 1, 168, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 102, 665, 1, 169, 665, 70, 665, 2, 0, 1, 0, 65535ULL, 182, 665, 1, 2, 0, 0, 3, 1, 32, 0, 262140ULL, 0, 167, 665, 105, 665, 1, 167, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 168, 665, 104, 665, 1, 168, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 103, 665, 1, 169, 665, 71, 665, 2, 0, 1, 0, 65535ULL, 183, 665, 1, 2, 0, 0, 4, 1, 4, 0, 262140ULL, 0, 168, 665, 105, 665, 1, 168, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 3, 2, 0, 0, 169, 665, 104, 665, 1, 169, 665, 72, 665, 2, 0, 1, 0, 65535ULL, 184, 665, 1, 2, 0, 0, 3, 1, 3, 0, 262140ULL, 0, 169, 665, 105, 665, 1, 169, 665, 73, 665, 2, 0, 1, 0, 65535ULL, 185, 665, 1, 2, 0, 33, 1, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166148, 371, 1, 0, 0, 154, 665, 74, 665, 1, 154, 665, 74, 665, 2, 0, 1, 0, 58, 665, 58, 665, 1, 2, 0, 0, 58, 665, 58, 665, 2, 1, 0, 0, 58, 665, 58, 665, 1, 2, 0, 0, 64559ULL, 170, 665, 5, 1, 0, 0, 154, 665, 75, 665, 1, 154, 665, 75, 665, 2, 0, 1, 0, 58, 665, 59, 665, 1, 2, 0, 0, 58, 665, 59, 665, 2, 1, 0, 0, 58, 665, 59, 665, 1, 2, 0, 0, 64559ULL, 171, 665, 3, 1, 0, 0, 155, 665, 74, 665, 1, 155, 665, 74, 665, 2, 0, 1, 0, 59, 665, 58, 665, 1, 2, 0, 0, 59, 665, 58, 665, 2, 1, 0, 0, 59, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 6, 3, 2, 0, 154, 665, 76, 665, 1, 154, 665, 76, 665, 2, 0, 1, 0, 58, 665, 60, 665, 1, 2, 0, 0, 58, 665, 60, 665, 2, 1, 0, 0, 58, 665, 60, 665, 1, 2, 0, 0, 64559ULL, 172, 665, 3, 1, 0, 0, 155, 665, 75, 665, 1, 155, 665, 75, 665, 2, 0, 1, 0, 59, 665, 59, 665, 1, 2, 0, 0, 59, 665, 59, 665, 2, 1, 0, 0, 59, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 74, 665, 1, 156, 665, 74, 665, 2, 0, 1, 0, 60, 665, 58, 665, 1, 2, 0, 0, 60, 665, 58, 665, 2, 1, 0, 0, 60, 665, 58, 665, 1, 2, 0, 0, 65534ULL, 170, 665, 2, 1, 0, 7, 4, 2, 0, 154, 665, 77, 665, 1, 154, 665, 77, 665, 2, 0, 1, 0, 58, 665, 61, 665, 1, 2, 0, 0, 58, 665, 61, 665, 2, 1, 0, 0, 58, 665, 61, 665, 1, 2, 0, 0, 64559ULL, 173, 665, 3, 1, 0, 0, 155, 665, 76, 665, 1, 155, 665, 76, 665, 2, 0, 1, 0, 59, 665, 60, 665, 1, 2, 0, 0, 59, 665, 60, 665, 2, 1, 0, 0, 59, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 75, 665, 1, 156, 665, 75, 665, 2, 0, 1, 0, 60, 665, 59, 665, 1, 2, 0, 0, 60, 665, 59, 665, 2, 1, 0, 0, 60, 665, 59, 665, 1, 2, 0, 0, 65534ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 74, 665, 1, 157, 665, 74, 665, 2, 0, 1, 0, 61, 665, 58, 665, 1, 2, 0, 0, 61, 665, 58, 665, 2, 1, 0, 0, 61, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 8, 3, 2, 0, 154, 665, 78, 665, 1, 154, 665, 78, 665, 2, 0, 1, 0, 58, 665, 62, 665, 1, 2, 0, 0, 58, 665, 62, 665, 2, 1, 0, 0, 58, 665, 62, 665, 1, 2, 0, 0, 64559ULL, 174, 665, 3, 1, 0, 0, 155, 665, 77, 665, 1, 155, 665, 77, 665, 2, 0, 1, 0, 59, 665, 61, 665, 1, 2, 0, 0, 59, 665, 61, 665, 2, 1, 0, 0, 59, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 76, 665, 1, 156, 665, 76, 665, 2, 0, 1, 0, 60, 665, 60, 665, 1, 2, 0, 0, 60, 665, 60, 665, 2, 1, 0, 0, 60, 665, 60, 665, 1, 2, 0, 0, 65534ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 75, 665, 1, 157, 665, 75, 665, 2, 0, 1, 0, 61, 665, 59, 665, 1, 2, 0, 0, 61, 665, 59, 665, 2, 1, 0, 0, 61, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 74, 665, 1, 158, 665, 74, 665, 2, 0, 1, 0, 62, 665, 58, 665, 1, 2, 0, 0, 62, 665, 58, 665, 2, 1, 0, 0, 62, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 9, 4, 2, 0, 154, 665, 79, 665, 1, 154, 665, 79, 665, 2, 0, 1, 0, 58, 665, 63, 665, 1, 2, 0, 0, 58, 665, 63, 665, 2, 1, 0, 0, 58, 665, 63, 665, 1, 2, 0, 0, 64559ULL, 175, 665, 3, 1, 0, 0, 155, 665, 78, 665, 1, 155, 665, 78, 665, 2, 0, 1, 0, 59, 665, 62, 665, 1, 2, 0, 0, 59, 665, 62, 665, 2, 1, 0, 0, 59, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 77, 665, 1, 156, 665, 77, 665, 2, 0, 1, 0, 60, 665, 61, 665, 1, 2, 0, 0, 60, 665, 61, 665, 2, 1, 0, 0, 60, 665, 61, 665, 1, 2, 0, 0, 65534ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 76, 665, 1, 157, 665, 76, 665, 2, 0, 1, 0, 61, 665, 60, 665, 1, 2, 0, 0, 61, 665, 60, 665, 2, 1, 0, 0, 61, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 75, 665, 1, 158, 665, 75, 665, 2, 0, 1, 0, 62, 665, 59, 665, 1, 2, 0, 0, 62, 665, 59, 665, 2, 1, 0, 0, 62, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 74, 665, 1, 159, 665, 74, 665, 2, 0, 1, 0, 63, 665, 58, 665, 1, 2, 0, 0, 63, 665, 58, 665, 2, 1, 0, 0, 63, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 10, 3, 2, 0, 154, 665, 80, 665, 1, 154, 665, 80, 665, 2, 0, 1, 0, 58, 665, 64, 665, 1, 2, 0, 0, 58, 665, 64, 665, 2, 1, 0, 0, 58, 665, 64, 665, 1, 2, 0, 0, 64559ULL, 176, 665, 3, 1, 0, 0, 155, 665, 79, 665, 1, 155, 665, 79, 665, 2, 0, 1, 0, 59, 665, 63, 665, 1, 2, 0, 0, 59, 665, 63, 665, 2, 1, 0, 0, 59, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 78, 665, 1, 156, 665, 78, 665, 2, 0, 1, 0, 60, 665, 62, 665, 1, 2, 0, 0, 60, 665, 62, 665, 2, 1, 0, 0, 60, 665, 62, 665, 1, 2, 0, 0, 65534ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 77, 665, 1, 157, 665, 77, 665, 2, 0, 1, 0, 61, 665, 61, 665, 1, 2, 0, 0, 61, 665, 61, 665, 2, 1, 0, 0, 61, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 76, 665, 1, 158, 665, 76, 665, 2, 0, 1, 0, 62, 665, 60, 665, 1, 2, 0, 0, 62, 665, 60, 665, 2, 1, 0, 0, 62, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 75, 665, 1, 159, 665, 75, 665, 2, 0, 1, 0, 63, 665, 59, 665, 1, 2, 0, 0, 63, 665, 59, 665, 2, 1, 0, 0, 63, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 74, 665, 1, 160, 665, 74, 665, 2, 0, 1, 0, 64, 665, 58, 665, 1, 2, 0, 0, 64, 665, 58, 665, 2, 1, 0, 0, 64, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 11, 4, 2, 0, 154, 665, 81, 665, 1, 154, 665, 81, 665, 2, 0, 1, 0, 58, 665, 65, 665, 1, 2, 0, 0, 58, 665, 65, 665, 2, 1, 0, 0, 58, 665, 65, 665, 1, 2, 0, 0, 64559ULL, 177, 665, 3, 1, 0, 0, 155, 665, 80, 665, 1, 155, 665, 80, 665, 2, 0, 1, 0, 59, 665, 64, 665, 1, 2, 0, 0, 59, 665, 64, 665, 2, 1, 0, 0, 59, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 79, 665, 1, 156, 665, 79, 665, 2, 0, 1, 0, 60, 665, 63, 665, 1, 2, 0, 0, 60, 665, 63, 665, 2, 1, 0, 0, 60, 665, 63, 665, 1, 2, 0, 0, 65534ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 78, 665, 1, 157, 665, 78, 665, 2, 0, 1, 0, 61, 665, 62, 665, 1, 2, 0, 0, 61, 665, 62, 665, 2, 1, 0, 0, 61, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 77, 665, 1, 158, 665, 77, 665, 2, 0, 1, 0, 62, 665, 61, 665, 1, 2, 0, 0, 62, 665, 61, 665, 2, 1, 0, 0, 62, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 76, 665, 1, 159, 665, 76, 665, 2, 0, 1, 0, 63, 665, 60, 665, 1, 2, 0, 0, 63, 665, 60, 665, 2, 1, 0, 0, 63, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 75, 665, 1, 160, 665, 75, 665, 2, 0, 1, 0, 64, 665, 59, 665, 1, 2, 0, 0, 64, 665, 59, 665, 2, 1, 0, 0, 64, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 74, 665, 1, 161, 665, 74, 665, 2, 0, 1, 0, 65, 665, 58, 665, 1, 2, 0, 0, 65, 665, 58, 665, 2, 1, 0, 0, 65, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 12, 3, 2, 0, 154, 665, 82, 665, 1, 154, 665, 82, 665, 2, 0, 1, 0, 58, 665, 66, 665, 1, 2, 0, 0, 58, 665, 66, 665, 2, 1, 0, 0, 58, 665, 66, 665, 1, 2, 0, 0, 64559ULL, 178, 665, 3, 1, 0, 0, 155, 665, 81, 665, 1, 155, 665, 81, 665, 2, 0, 1, 0, 59, 665, 65, 665, 1, 2, 0, 0, 59, 665, 65, 665, 2, 1, 0, 0, 59, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 80, 665, 1, 156, 665, 80, 665, 2, 0, 1, 0, 60, 665, 64, 665, 1, 2, 0, 0, 60, 665, 64, 665, 2, 1, 0, 0, 60, 665, 64, 665, 1, 2, 0, 0, 65534ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 79, 665, 1, 157, 665, 79, 665, 2, 0, 1, 0, 61, 665, 63, 665, 1, 2, 0, 0, 61, 665, 63, 665, 2, 1, 0, 0, 61, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 78, 665, 1, 158, 665, 78, 665, 2, 0, 1, 0, 62, 665, 62, 665, 1, 2, 0, 0, 62, 665, 62, 665, 2, 1, 0, 0, 62, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 77, 665, 1, 159, 665, 77, 665, 2, 0, 1, 0, 63, 665, 61, 665, 1, 2, 0, 0, 63, 665, 61, 665, 2, 1, 0, 0, 63, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 76, 665, 1, 160, 665, 76, 665, 2, 0, 1, 0, 64, 665, 60, 665, 1, 2, 0, 0, 64, 665, 60, 665, 2, 1, 0, 0, 64, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 75, 665, 1, 161, 665, 75, 665, 2, 0, 1, 0, 65, 665, 59, 665, 1, 2, 0, 0, 65, 665, 59, 665, 2, 1, 0, 0, 65, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 74, 665, 1, 162, 665, 74, 665, 2, 0, 1, 0, 66, 665, 58, 665, 1, 2, 0, 0, 66, 665, 58, 665, 2, 1, 0, 0, 66, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 13, 4, 2, 0, 154, 665, 83, 665, 1, 154, 665, 83, 665, 2, 0, 1, 0, 58, 665, 67, 665, 1, 2, 0, 0, 58, 665, 67, 665, 2, 1, 0, 0, 58, 665, 67, 665, 1, 2, 0, 0, 64559ULL, 179, 665, 3, 1, 0, 0, 155, 665, 82, 665, 1, 155, 665, 82, 665, 2, 0, 1, 0, 59, 665, 66, 665, 1, 2, 0, 0, 59, 665, 66, 665, 2, 1, 0, 0, 59, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 81, 665, 1, 156, 665, 81, 665, 2, 0, 1, 0, 60, 665, 65, 665, 1, 2, 0, 0, 60, 665, 65, 665, 2, 1, 0, 0, 60, 665, 65, 665, 1, 2, 0, 0, 65534ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 80, 665, 1, 157, 665, 80, 665, 2, 0, 1, 0, 61, 665, 64, 665, 1, 2, 0, 0, 61, 665, 64, 665, 2, 1, 0, 0, 61, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 79, 665, 1, 158, 665, 79, 665, 2, 0, 1, 0, 62, 665, 63, 665, 1, 2, 0, 0, 62, 665, 63, 665, 2, 1, 0, 0, 62, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 78, 665, 1, 159, 665, 78, 665, 2, 0, 1, 0, 63, 665, 62, 665, 1, 2, 0, 0, 63, 665, 62, 665, 2, 1, 0, 0, 63, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 77, 665, 1, 160, 665, 77, 665, 2, 0, 1, 0, 64, 665, 61, 665, 1, 2, 0, 0, 64, 665, 61, 665, 2, 1, 0, 0, 64, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 76, 665, 1, 161, 665, 76, 665, 2, 0, 1, 0, 65, 665, 60, 665, 1, 2, 0, 0, 65, 665, 60, 665, 2, 1, 0, 0, 65, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 75, 665, 1, 162, 665, 75, 665, 2, 0, 1, 0, 66, 665, 59, 665, 1, 2, 0, 0, 66, 665, 59, 665, 2, 1, 0, 0, 66, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 74, 665, 1, 163, 665, 74, 665, 2, 0, 1, 0, 67, 665, 58, 665, 1, 2, 0, 0, 67, 665, 58, 665, 2, 1, 0, 0, 67, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 14, 3, 2, 0, 154, 665, 84, 665, 1, 154, 665, 84, 665, 2, 0, 1, 0, 58, 665, 68, 665, 1, 2, 0, 0, 58, 665, 68, 665, 2, 1, 0, 0, 58, 665, 68, 665, 1, 2, 0, 0, 64559ULL, 180, 665, 3, 1, 0, 0, 155, 665, 83, 665, 1, 155, 665, 83, 665, 2, 0, 1, 0, 59, 665, 67, 665, 1, 2, 0, 0, 59, 665, 67, 665, 2, 1, 0, 0, 59, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 82, 665, 1, 156, 665, 82, 665, 2, 0, 1, 0, 60, 665, 66, 665, 1, 2, 0, 0, 60, 665, 66, 665, 2, 1, 0, 0, 60, 665, 66, 665, 1, 2, 0, 0, 65534ULL, 178, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 81, 665, 1, 157, 665, 81, 665, 2, 0, 1, 0, 61, 665, 65, 665, 1, 2, 0, 0, 61, 665, 65, 665, 2, 1, 0, 0, 61, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 80, 665, 1, 158, 665, 80, 665, 2, 0, 1, 0, 62, 665, 64, 665, 1, 2, 0, 0, 62, 665, 64, 665, 2, 1, 0, 0, 62, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 79, 665, 1, 159, 665, 79, 665, 2, 0, 1, 0, 63, 665, 63, 665, 1, 2, 0, 0, 63, 665, 63, 665, 2, 1, 0, 0, 63, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 78, 665, 1, 160, 665, 78, 665, 2, 0, 1, 0, 64, 665, 62, 665, 1, 2, 0, 0, 64, 665, 62, 665, 2, 1, 0, 0, 64, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 77, 665, 1, 161, 665, 77, 665, 2, 0, 1, 0, 65, 665, 61, 665, 1, 2, 0, 0, 65, 665, 61, 665, 2, 1, 0, 0, 65, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 76, 665, 1, 162, 665, 76, 665, 2, 0, 1, 0, 66, 665, 60, 665, 1, 2, 0, 0, 66, 665, 60, 665, 2, 1, 0, 0, 66, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 75, 665, 1, 163, 665, 75, 665, 2, 0, 1, 0, 67, 665, 59, 665, 1, 2, 0, 0, 67, 665, 59, 665, 2, 1, 0, 0, 67, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 74, 665, 1, 164, 665, 74, 665, 2, 0, 1, 0, 68, 665, 58, 665, 1, 2, 0, 0, 68, 665, 58, 665, 2, 1, 0, 0, 68, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 15, 4, 2, 0, 154, 665, 85, 665, 1, 154, 665, 85, 665, 2, 0, 1, 0, 58, 665, 69, 665, 1, 2, 0, 0, 58, 665, 69, 665, 2, 1, 0, 0, 58, 665, 69, 665, 1, 2, 0, 0, 64559ULL, 181, 665, 3, 1, 0, 0, 155, 665, 84, 665, 1, 155, 665, 84, 665, 2, 0, 1, 0, 59, 665, 68, 665, 1, 2, 0, 0, 59, 665, 68, 665, 2, 1, 0, 0, 59, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 83, 665, 1, 156, 665, 83, 665, 2, 0, 1, 0, 60, 665, 67, 665, 1, 2, 0, 0, 60, 665, 67, 665, 2, 1, 0, 0, 60, 665, 67, 665, 1, 2, 0, 0, 65534ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 82, 665, 1, 157, 665, 82, 665, 2, 0, 1, 0, 61, 665, 66, 665, 1, 2, 0, 0, 61, 665, 66, 665, 2, 1, 0, 0, 61, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 81, 665, 1, 158, 665, 81, 665, 2, 0, 1, 0, 62, 665, 65, 665, 1, 2, 0, 0, 62, 665, 65, 665, 2, 1, 0, 0, 62, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 80, 665, 1, 159, 665, 80, 665, 2, 0, 1, 0, 63, 665, 64, 665, 1, 2, 0, 0, 63, 665, 64, 665, 2, 1, 0, 0, 63, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 79, 665, 1, 160, 665, 79, 665, 2, 0, 1, 0, 64, 665, 63, 665, 1, 2, 0, 0, 64, 665, 63, 665, 2, 1, 0, 0, 64, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 78, 665, 1, 161, 665, 78, 665, 2, 0, 1, 0, 65, 665, 62, 665, 1, 2, 0, 0, 65, 665, 62, 665, 2, 1, 0, 0, 65, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 77, 665, 1, 162, 665, 77, 665, 2, 0, 1, 0, 66, 665, 61, 665, 1, 2, 0, 0, 66, 665, 61, 665, 2, 1, 0, 0, 66, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 76, 665, 1, 163, 665, 76, 665, 2, 0, 1, 0, 67, 665, 60, 665, 1, 2, 0, 0, 67, 665, 60, 665, 2, 1, 0, 0, 67, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 75, 665, 1, 164, 665, 75, 665, 2, 0, 1, 0, 68, 665, 59, 665, 1, 2, 0, 0, 68, 665, 59, 665, 2, 1, 0, 0, 68, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 74, 665, 1, 165, 665, 74, 665, 2, 0, 1, 0, 69, 665, 58, 665, 1, 2, 0, 0, 69, 665, 58, 665, 2, 1, 0, 0, 69, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 16, 3, 2, 0, 154, 665, 86, 665, 1, 154, 665, 86, 665, 2, 0, 1, 0, 58, 665, 70, 665, 1, 2, 0, 0, 58, 665, 70, 665, 2, 1, 0, 0, 58, 665, 70, 665, 1, 2, 0, 0, 64559ULL, 182, 665, 3, 1, 0, 0, 155, 665, 85, 665, 1, 155, 665, 85, 665, 2, 0, 1, 0, 59, 665, 69, 665, 1, 2, 0, 0, 59, 665, 69, 665, 2, 1, 0, 0, 59, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 84, 665, 1, 156, 665, 84, 665, 2, 0, 1, 0, 60, 665, 68, 665, 1, 2, 0, 0, 60, 665, 68, 665, 2, 1, 0, 0, 60, 665, 68, 665, 1, 2, 0, 0, 65534ULL, 180, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 83, 665, 1, 157, 665, 83, 665, 2, 0, 1, 0, 61, 665, 67, 665, 1, 2, 0, 0, 61, 665, 67, 665, 2, 1, 0, 0, 61, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 82, 665, 1, 158, 665, 82, 665, 2, 0, 1, 0, 62, 665, 66, 665, 1, 2, 0, 0, 62, 665, 66, 665, 2, 1, 0, 0, 62, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 81, 665, 1, 159, 665, 81, 665, 2, 0, 1, 0, 63, 665, 65, 665, 1, 2, 0, 0, 63, 665, 65, 665, 2, 1, 0, 0, 63, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 80, 665, 1, 160, 665, 80, 665, 2, 0, 1, 0, 64, 665, 64, 665, 1, 2, 0, 0, 64, 665, 64, 665, 2, 1, 0, 0, 64, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 79, 665, 1, 161, 665, 79, 665, 2, 0, 1, 0, 65, 665, 63, 665, 1, 2, 0, 0, 65, 665, 63, 665, 2, 1, 0, 0, 65, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 78, 665, 1, 162, 665, 78, 665, 2, 0, 1, 0, 66, 665, 62, 665, 1, 2, 0, 0, 66, 665, 62, 665, 2, 1, 0, 0, 66, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 77, 665, 1, 163, 665, 77, 665, 2, 0, 1, 0, 67, 665, 61, 665, 1, 2, 0, 0, 67, 665, 61, 665, 2, 1, 0, 0, 67, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 76, 665, 1, 164, 665, 76, 665, 2, 0, 1, 0, 68, 665, 60, 665, 1, 2, 0, 0, 68, 665, 60, 665, 2, 1, 0, 0, 68, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 75, 665, 1, 165, 665, 75, 665, 2, 0, 1, 0, 69, 665, 59, 665, 1, 2, 0, 0, 69, 665, 59, 665, 2, 1, 0, 0, 69, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 74, 665, 1, 166, 665, 74, 665, 2, 0, 1, 0, 70, 665, 58, 665, 1, 2, 0, 0, 70, 665, 58, 665, 2, 1, 0, 0, 70, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 17, 4, 2, 0, 154, 665, 87, 665, 1, 154, 665, 87, 665, 2, 0, 1, 0, 58, 665, 71, 665, 1, 2, 0, 0, 58, 665, 71, 665, 2, 1, 0, 0, 58, 665, 71, 665, 1, 2, 0, 0, 64559ULL, 183, 665, 3, 1, 0, 0, 155, 665, 86, 665, 1, 155, 665, 86, 665, 2, 0, 1, 0, 59, 665, 70, 665, 1, 2, 0, 0, 59, 665, 70, 665, 2, 1, 0, 0, 59, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 85, 665, 1, 156, 665, 85, 665, 2, 0, 1, 0, 60, 665, 69, 665, 1, 2, 0, 0, 60, 665, 69, 665, 2, 1, 0, 0, 60, 665, 69, 665, 1, 2, 0, 0, 65534ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 84, 665, 1, 157, 665, 84, 665, 2, 0, 1, 0, 61, 665, 68, 665, 1, 2, 0, 0, 61, 665, 68, 665, 2, 1, 0, 0, 61, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 83, 665, 1, 158, 665, 83, 665, 2, 0, 1, 0, 62, 665, 67, 665, 1, 2, 0, 0, 62, 665, 67, 665, 2, 1, 0, 0, 62, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 82, 665, 1, 159, 665, 82, 665, 2, 0, 1, 0, 63, 665, 66, 665, 1, 2, 0, 0, 63, 665, 66, 665, 2, 1, 0, 0, 63, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 81, 665, 1, 160, 665, 81, 665, 2, 0, 1, 0, 64, 665, 65, 665, 1, 2, 0, 0, 64, 665, 65, 665, 2, 1, 0, 0, 64, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 80, 665, 1, 161, 665, 80, 665, 2, 0, 1, 0, 65, 665, 64, 665, 1, 2, 0, 0, 65, 665, 64, 665, 2, 1, 0, 0, 65, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 79, 665, 1, 162, 665, 79, 665, 2, 0, 1, 0, 66, 665, 63, 665, 1, 2, 0, 0, 66, 665, 63, 665, 2, 1, 0, 0, 66, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 78, 665, 1, 163, 665, 78, 665, 2, 0, 1, 0, 67, 665, 62, 665, 1, 2, 0, 0, 67, 665, 62, 665, 2, 1, 0, 0, 67, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 77, 665, 1, 164, 665, 77, 665, 2, 0, 1, 0, 68, 665, 61, 665, 1, 2, 0, 0, 68, 665, 61, 665, 2, 1, 0, 0, 68, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 76, 665, 1, 165, 665, 76, 665, 2, 0, 1, 0, 69, 665, 60, 665, 1, 2, 0, 0, 69, 665, 60, 665, 2, 1, 0, 0, 69, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 75, 665, 1, 166, 665, 75, 665, 2, 0, 1, 0, 70, 665, 59, 665, 1, 2, 0, 0, 70, 665, 59, 665, 2, 1, 0, 0, 70, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 74, 665, 1, 167, 665, 74, 665, 2, 0, 1, 0, 71, 665, 58, 665, 1, 2, 0, 0, 71, 665, 58, 665, 2, 1, 0, 0, 71, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 18, 3, 2, 0, 154, 665, 88, 665, 1, 154, 665, 88, 665, 2, 0, 1, 0, 58, 665, 72, 665, 1, 2, 0, 0, 58, 665, 72, 665, 2, 1, 0, 0, 58, 665, 72, 665, 1, 2, 0, 0, 64559ULL, 184, 665, 3, 1, 0, 0, 155, 665, 87, 665, 1, 155, 665, 87, 665, 2, 0, 1, 0, 59, 665, 71, 665, 1, 2, 0, 0, 59, 665, 71, 665, 2, 1, 0, 0, 59, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 86, 665, 1, 156, 665, 86, 665, 2, 0, 1, 0, 60, 665, 70, 665, 1, 2, 0, 0, 60, 665, 70, 665, 2, 1, 0, 0, 60, 665, 70, 665, 1, 2, 0, 0, 65534ULL, 182, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 85, 665, 1, 157, 665, 85, 665, 2, 0, 1, 0, 61, 665, 69, 665, 1, 2, 0, 0, 61, 665, 69, 665, 2, 1, 0, 0, 61, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 84, 665, 1, 158, 665, 84, 665, 2, 0, 1, 0, 62, 665, 68, 665, 1, 2, 0, 0, 62, 665, 68, 665, 2, 1, 0, 0, 62, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 83, 665, 1, 159, 665, 83, 665, 2, 0, 1, 0, 63, 665, 67, 665, 1, 2, 0, 0, 63, 665, 67, 665, 2, 1, 0, 0, 63, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 82, 665, 1, 160, 665, 82, 665, 2, 0, 1, 0, 64, 665, 66, 665, 1, 2, 0, 0, 64, 665, 66, 665, 2, 1, 0, 0, 64, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 81, 665, 1, 161, 665, 81, 665, 2, 0, 1, 0, 65, 665, 65, 665, 1, 2, 0, 0, 65, 665, 65, 665, 2, 1, 0, 0, 65, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 80, 665, 1, 162, 665, 80, 665, 2, 0, 1, 0, 66, 665, 64, 665, 1, 2, 0, 0, 66, 665, 64, 665, 2, 1, 0, 0, 66, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 79, 665, 1, 163, 665, 79, 665, 2, 0, 1, 0, 67, 665, 63, 665, 1, 2, 0, 0, 67, 665, 63, 665, 2, 1, 0, 0, 67, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 78, 665, 1, 164, 665, 78, 665, 2, 0, 1, 0, 68, 665, 62, 665, 1, 2, 0, 0, 68, 665, 62, 665, 2, 1, 0, 0, 68, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 77, 665, 1, 165, 665, 77, 665, 2, 0, 1, 0, 69, 665, 61, 665, 1, 2, 0, 0, 69, 665, 61, 665, 2, 1, 0, 0, 69, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 76, 665, 1, 166, 665, 76, 665, 2, 0, 1, 0, 70, 665, 60, 665, 1, 2, 0, 0, 70, 665, 60, 665, 2, 1, 0, 0, 70, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 75, 665, 1, 167, 665, 75, 665, 2, 0, 1, 0, 71, 665, 59, 665, 1, 2, 0, 0, 71, 665, 59, 665, 2, 1, 0, 0, 71, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 74, 665, 1, 168, 665, 74, 665, 2, 0, 1, 0, 72, 665, 58, 665, 1, 2, 0, 0, 72, 665, 58, 665, 2, 1, 0, 0, 72, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 19, 4, 2, 0, 154, 665, 89, 665, 1, 154, 665, 89, 665, 2, 0, 1, 0, 58, 665, 73, 665, 1, 2, 0, 0, 58, 665, 73, 665, 2, 1, 0, 0, 58, 665, 73, 665, 1, 2, 0, 0, 64559ULL, 185, 665, 3, 1, 0, 0, 155, 665, 88, 665, 1, 155, 665, 88, 665, 2, 0, 1, 0, 59, 665, 72, 665, 1, 2, 0, 0, 59, 665, 72, 665, 2, 1, 0, 0, 59, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 156, 665, 87, 665, 1, 156, 665, 87, 665, 2, 0, 1, 0, 60, 665, 71, 665, 1, 2, 0, 0, 60, 665, 71, 665, 2, 1, 0, 0, 60, 665, 71, 665, 1, 2, 0, 0, 65534ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 157, 665, 86, 665, 1, 157, 665, 86, 665, 2, 0, 1, 0, 61, 665, 70, 665, 1, 2, 0, 0, 61, 665, 70, 665, 2, 1, 0, 0, 61, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 85, 665, 1, 158, 665, 85, 665, 2, 0, 1, 0, 62, 665, 69, 665, 1, 2, 0, 0, 62, 665, 69, 665, 2, 1, 0, 0, 62, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 84, 665, 1, 159, 665, 84, 665, 2, 0, 1, 0, 63, 665, 68, 665, 1, 2, 0, 0, 63, 665, 68, 665, 2, 1, 0, 0, 63, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 83, 665, 1, 160, 665, 83, 665, 2, 0, 1, 0, 64, 665, 67, 665, 1, 2, 0, 0, 64, 665, 67, 665, 2, 1, 0, 0, 64, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 82, 665, 1, 161, 665, 82, 665, 2, 0, 1, 0, 65, 665, 66, 665, 1, 2, 0, 0, 65, 665, 66, 665, 2, 1, 0, 0, 65, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 81, 665, 1, 162, 665, 81, 665, 2, 0, 1, 0, 66, 665, 65, 665, 1, 2, 0, 0, 66, 665, 65, 665, 2, 1, 0, 0, 66, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 80, 665, 1, 163, 665, 80, 665, 2, 0, 1, 0, 67, 665, 64, 665, 1, 2, 0, 0, 67, 665, 64, 665, 2, 1, 0, 0, 67, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 79, 665, 1, 164, 665, 79, 665, 2, 0, 1, 0, 68, 665, 63, 665, 1, 2, 0, 0, 68, 665, 63, 665, 2, 1, 0, 0, 68, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 78, 665, 1, 165, 665, 78, 665, 2, 0, 1, 0, 69, 665, 62, 665, 1, 2, 0, 0, 69, 665, 62, 665, 2, 1, 0, 0, 69, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 77, 665, 1, 166, 665, 77, 665, 2, 0, 1, 0, 70, 665, 61, 665, 1, 2, 0, 0, 70, 665, 61, 665, 2, 1, 0, 0, 70, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 76, 665, 1, 167, 665, 76, 665, 2, 0, 1, 0, 71, 665, 60, 665, 1, 2, 0, 0, 71, 665, 60, 665, 2, 1, 0, 0, 71, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 75, 665, 1, 168, 665, 75, 665, 2, 0, 1, 0, 72, 665, 59, 665, 1, 2, 0, 0, 72, 665, 59, 665, 2, 1, 0, 0, 72, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 74, 665, 1, 169, 665, 74, 665, 2, 0, 1, 0, 73, 665, 58, 665, 1, 2, 0, 0, 73, 665, 58, 665, 2, 1, 0, 0, 73, 665, 58, 665, 1, 2, 0, 0, 65535ULL, 170, 665, 2, 1, 0, 20, 3, 2, 0, 155, 665, 89, 665, 1, 155, 665, 89, 665, 2, 0, 1, 0, 59, 665, 73, 665, 1, 2, 0, 0, 59, 665, 73, 665, 2, 1, 0, 0, 59, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 156, 665, 88, 665, 1, 156, 665, 88, 665, 2, 0, 1, 0, 60, 665, 72, 665, 1, 2, 0, 0, 60, 665, 72, 665, 2, 1, 0, 0, 60, 665, 72, 665, 1, 2, 0, 0, 65534ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 157, 665, 87, 665, 1, 157, 665, 87, 665, 2, 0, 1, 0, 61, 665, 71, 665, 1, 2, 0, 0, 61, 665, 71, 665, 2, 1, 0, 0, 61, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 158, 665, 86, 665, 1, 158, 665, 86, 665, 2, 0, 1, 0, 62, 665, 70, 665, 1, 2, 0, 0, 62, 665, 70, 665, 2, 1, 0, 0, 62, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 159, 665, 85, 665, 1, 159, 665, 85, 665, 2, 0, 1, 0, 63, 665, 69, 665, 1, 2, 0, 0, 63, 665, 69, 665, 2, 1, 0, 0, 63, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 160, 665, 84, 665, 1, 160, 665, 84, 665, 2, 0, 1, 0, 64, 665, 68, 665, 1, 2, 0, 0, 64, 665, 68, 665, 2, 1, 0, 0, 64, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 161, 665, 83, 665, 1, 161, 665, 83, 665, 2, 0, 1, 0, 65, 665, 67, 665, 1, 2, 0, 0, 65, 665, 67, 665, 2, 1, 0, 0, 65, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 162, 665, 82, 665, 1, 162, 665, 82, 665, 2, 0, 1, 0, 66, 665, 66, 665, 1, 2, 0, 0, 66, 665, 66, 665, 2, 1, 0, 0, 66, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 81, 665, 1, 163, 665, 81, 665, 2, 0, 1, 0, 67, 665, 65, 665, 1, 2, 0, 0, 67, 665, 65, 665, 2, 1, 0, 0, 67, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 80, 665, 1, 164, 665, 80, 665, 2, 0, 1, 0, 68, 665, 64, 665, 1, 2, 0, 0, 68, 665, 64, 665, 2, 1, 0, 0, 68, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 79, 665, 1, 165, 665, 79, 665, 2, 0, 1, 0, 69, 665, 63, 665, 1, 2, 0, 0, 69, 665, 63, 665, 2, 1, 0, 0, 69, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 78, 665, 1, 166, 665, 78, 665, 2, 0, 1, 0, 70, 665, 62, 665, 1, 2, 0, 0, 70, 665, 62, 665, 2, 1, 0, 0, 70, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 77, 665, 1, 167, 665, 77, 665, 2, 0, 1, 0, 71, 665, 61, 665, 1, 2, 0, 0, 71, 665, 61, 665, 2, 1, 0, 0, 71, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 76, 665, 1, 168, 665, 76, 665, 2, 0, 1, 0, 72, 665, 60, 665, 1, 2, 0, 0, 72, 665, 60, 665, 2, 1, 0, 0, 72, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 75, 665, 1, 169, 665, 75, 665, 2, 0, 1, 0, 73, 665, 59, 665, 1, 2, 0, 0, 73, 665, 59, 665, 2, 1, 0, 0, 73, 665, 59, 665, 1, 2, 0, 0, 65535ULL, 171, 665, 2, 1, 0, 0, 4, 2, 21, 0, 258236ULL, 0, 156, 665, 89, 665, 1, 156, 665, 89, 665, 2, 0, 1, 0, 60, 665, 73, 665, 1, 2, 0, 0, 60, 665, 73, 665, 2, 1, 0, 0, 60, 665, 73, 665, 1, 2, 0, 0, 65534ULL, 185, 665, 3, 1, 0, 0, 157, 665, 88, 665, 1, 157, 665, 88, 665, 2, 0, 1, 0, 61, 665, 72, 665, 1, 2, 0, 0, 61, 665, 72, 665, 2, 1, 0, 0, 61, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 158, 665, 87, 665, 1, 158, 665, 87, 665, 2, 0, 1, 0, 62, 665, 71, 665, 1, 2, 0, 0, 62, 665, 71, 665, 2, 1, 0, 0, 62, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 159, 665, 86, 665, 1, 159, 665, 86, 665, 2, 0, 1, 0, 63, 665, 70, 665, 1, 2, 0, 0, 63, 665, 70, 665, 2, 1, 0, 0, 63, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 85, 665, 1, 160, 665, 85, 665, 2, 0, 1, 0, 64, 665, 69, 665, 1, 2, 0, 0, 64, 665, 69, 665, 2, 1, 0, 0, 64, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 84, 665, 1, 161, 665, 84, 665, 2, 0, 1, 0, 65, 665, 68, 665, 1, 2, 0, 0, 65, 665, 68, 665, 2, 1, 0, 0, 65, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 83, 665, 1, 162, 665, 83, 665, 2, 0, 1, 0, 66, 665, 67, 665, 1, 2, 0, 0, 66, 665, 67, 665, 2, 1, 0, 0, 66, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 82, 665, 1, 163, 665, 82, 665, 2, 0, 1, 0, 67, 665, 66, 665, 1, 2, 0, 0, 67, 665, 66, 665, 2, 1, 0, 0, 67, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 81, 665, 1, 164, 665, 81, 665, 2, 0, 1, 0, 68, 665, 65, 665, 1, 2, 0, 0, 68, 665, 65, 665, 2, 1, 0, 0, 68, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 80, 665, 1, 165, 665, 80, 665, 2, 0, 1, 0, 69, 665, 64, 665, 1, 2, 0, 0, 69, 665, 64, 665, 2, 1, 0, 0, 69, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 79, 665, 1, 166, 665, 79, 665, 2, 0, 1, 0, 70, 665, 63, 665, 1, 2, 0, 0, 70, 665, 63, 665, 2, 1, 0, 0, 70, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 78, 665, 1, 167, 665, 78, 665, 2, 0, 1, 0, 71, 665, 62, 665, 1, 2, 0, 0, 71, 665, 62, 665, 2, 1, 0, 0, 71, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 77, 665, 1, 168, 665, 77, 665, 2, 0, 1, 0, 72, 665, 61, 665, 1, 2, 0, 0, 72, 665, 61, 665, 2, 1, 0, 0, 72, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 76, 665, 1, 169, 665, 76, 665, 2, 0, 1, 0, 73, 665, 60, 665, 1, 2, 0, 0, 73, 665, 60, 665, 2, 1, 0, 0, 73, 665, 60, 665, 1, 2, 0, 0, 65535ULL, 172, 665, 2, 1, 0, 0, 3, 2, 22, 0, 262140ULL, 0, 157, 665, 89, 665, 1, 157, 665, 89, 665, 2, 0, 1, 0, 61, 665, 73, 665, 1, 2, 0, 0, 61, 665, 73, 665, 2, 1, 0, 0, 61, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 158, 665, 88, 665, 1, 158, 665, 88, 665, 2, 0, 1, 0, 62, 665, 72, 665, 1, 2, 0, 0, 62, 665, 72, 665, 2, 1, 0, 0, 62, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 159, 665, 87, 665, 1, 159, 665, 87, 665, 2, 0, 1, 0, 63, 665, 71, 665, 1, 2, 0, 0, 63, 665, 71, 665, 2, 1, 0, 0, 63, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 160, 665, 86, 665, 1, 160, 665, 86, 665, 2, 0, 1, 0, 64, 665, 70, 665, 1, 2, 0, 0, 64, 665, 70, 665, 2, 1, 0, 0, 64, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 161, 665, 85, 665, 1, 161, 665, 85, 665, 2, 0, 1, 0, 65, 665, 69, 665, 1, 2, 0, 0, 65, 665, 69, 665, 2, 1, 0, 0, 65, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 162, 665, 84, 665, 1, 162, 665, 84, 665, 2, 0, 1, 0, 66, 665, 68, 665, 1, 2, 0, 0, 66, 665, 68, 665, 2, 1, 0, 0, 66, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 83, 665, 1, 163, 665, 83, 665, 2, 0, 1, 0, 67, 665, 67, 665, 1, 2, 0, 0, 67, 665, 67, 665, 2, 1, 0, 0, 67, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 82, 665, 1, 164, 665, 82, 665, 2, 0, 1, 0, 68, 665, 66, 665, 1, 2, 0, 0, 68, 665, 66, 665, 2, 1, 0, 0, 68, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 81, 665, 1, 165, 665, 81, 665, 2, 0, 1, 0, 69, 665, 65, 665, 1, 2, 0, 0, 69, 665, 65, 665, 2, 1, 0, 0, 69, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 80, 665, 1, 166, 665, 80, 665, 2, 0, 1, 0, 70, 665, 64, 665, 1, 2, 0, 0, 70, 665, 64, 665, 2, 1, 0, 0, 70, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 79, 665, 1, 167, 665, 79, 665, 2, 0, 1, 0, 71, 665, 63, 665, 1, 2, 0, 0, 71, 665, 63, 665, 2, 1, 0, 0, 71, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 78, 665, 1, 168, 665, 78, 665, 2, 0, 1, 0, 72, 665, 62, 665, 1, 2, 0, 0, 72, 665, 62, 665, 2, 1, 0, 0, 72, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 77, 665, 1, 169, 665, 77, 665, 2, 0, 1, 0, 73, 665, 61, 665, 1, 2, 0, 0, 73, 665, 61, 665, 2, 1, 0, 0, 73, 665, 61, 665, 1, 2, 0, 0, 65535ULL, 173, 665, 2, 1, 0, 0, 4, 2, 23, 0, 262136ULL, 0, 158, 665, 89, 665, 1, 158, 665, 89, 665, 2, 0, 1, 0, 62, 665, 73, 665, 1, 2, 0, 0, 62, 665, 73, 665, 2, 1, 0, 0, 62, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 159, 665, 88, 665, 1, 159, 665, 88, 665, 2, 0, 1, 0, 63, 665, 72, 665, 1, 2, 0, 0, 63, 665, 72, 665, 2, 1, 0, 0, 63, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 160, 665, 87, 665, 1, 160, 665, 87, 665, 2, 0, 1, 0, 64, 665, 71, 665, 1, 2, 0, 0, 64, 665, 71, 665, 2, 1, 0, 0, 64, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 161, 665, 86, 665, 1, 161, 665, 86, 665, 2, 0, 1, 0, 65, 665, 70, 665, 1, 2, 0, 0, 65, 665, 70, 665, 2, 1, 0, 0, 65, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 85, 665, 1, 162, 665, 85, 665, 2, 0, 1, 0, 66, 665, 69, 665, 1, 2, 0, 0, 66, 665, 69, 665, 2, 1, 0, 0, 66, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 84, 665, 1, 163, 665, 84, 665, 2, 0, 1, 0, 67, 665, 68, 665, 1, 2, 0, 0, 67, 665, 68, 665, 2, 1, 0, 0, 67, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 83, 665, 1, 164, 665, 83, 665, 2, 0, 1, 0, 68, 665, 67, 665, 1, 2, 0, 0, 68, 665, 67, 665, 2, 1, 0, 0, 68, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 82, 665, 1, 165, 665, 82, 665, 2, 0, 1, 0, 69, 665, 66, 665, 1, 2, 0, 0, 69, 665, 66, 665, 2, 1, 0, 0, 69, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 81, 665, 1, 166, 665, 81, 665, 2, 0, 1, 0, 70, 665, 65, 665, 1, 2, 0, 0, 70, 665, 65, 665, 2, 1, 0, 0, 70, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 80, 665, 1, 167, 665, 80, 665, 2, 0, 1, 0, 71, 665, 64, 665, 1, 2, 0, 0, 71, 665, 64, 665, 2, 1, 0, 0, 71, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 79, 665, 1, 168, 665, 79, 665, 2, 0, 1, 0, 72, 665, 63, 665, 1, 2, 0, 0, 72, 665, 63, 665, 2, 1, 0, 0, 72, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 78, 665, 1, 169, 665, 78, 665, 2, 0, 1, 0, 73, 665, 62, 665, 1, 2, 0, 0, 73, 665, 62, 665, 2, 1, 0, 0, 73, 665, 62, 665, 1, 2, 0, 0, 65535ULL, 174, 665, 2, 1, 0, 0, 3, 2, 24, 0, 262140ULL, 0, 159, 665, 89, 665, 1, 159, 665, 89, 665, 2, 0, 1, 0, 63, 665, 73, 665, 1, 2, 0, 0, 63, 665, 73, 665, 2, 1, 0, 0, 63, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 160, 665, 88, 665, 1, 160, 665, 88, 665, 2, 0, 1, 0, 64, 665, 72, 665, 1, 2, 0, 0, 64, 665, 72, 665, 2, 1, 0, 0, 64, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 161, 665, 87, 665, 1, 161, 665, 87, 665, 2, 0, 1, 0, 65, 665, 71, 665, 1, 2, 0, 0, 65, 665, 71, 665, 2, 1, 0, 0, 65, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 162, 665, 86, 665, 1, 162, 665, 86, 665, 2, 0, 1, 0, 66, 665, 70, 665, 1, 2, 0, 0, 66, 665, 70, 665, 2, 1, 0, 0, 66, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 85, 665, 1, 163, 665, 85, 665, 2, 0, 1, 0, 67, 665, 69, 665, 1, 2, 0, 0, 67, 665, 69, 665, 2, 1, 0, 0, 67, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 84, 665, 1, 164, 665, 84, 665, 2, 0, 1, 0, 68, 665, 68, 665, 1, 2, 0, 0, 68, 665, 68, 665, 2, 1, 0, 0, 68, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 83, 665, 1, 165, 665, 83, 665, 2, 0, 1, 0, 69, 665, 67, 665, 1, 2, 0, 0, 69, 665, 67, 665, 2, 1, 0, 0, 69, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 82, 665, 1, 166, 665, 82, 665, 2, 0, 1, 0, 70, 665, 66, 665, 1, 2, 0, 0, 70, 665, 66, 665, 2, 1, 0, 0, 70, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 81, 665, 1, 167, 665, 81, 665, 2, 0, 1, 0, 71, 665, 65, 665, 1, 2, 0, 0, 71, 665, 65, 665, 2, 1, 0, 0, 71, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 80, 665, 1, 168, 665, 80, 665, 2, 0, 1, 0, 72, 665, 64, 665, 1, 2, 0, 0, 72, 665, 64, 665, 2, 1, 0, 0, 72, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 79, 665, 1, 169, 665, 79, 665, 2, 0, 1, 0, 73, 665, 63, 665, 1, 2, 0, 0, 73, 665, 63, 665, 2, 1, 0, 0, 73, 665, 63, 665, 1, 2, 0, 0, 65535ULL, 175, 665, 2, 1, 0, 0, 4, 2, 25, 0, 262140ULL, 0, 160, 665, 89, 665, 1, 160, 665, 89, 665, 2, 0, 1, 0, 64, 665, 73, 665, 1, 2, 0, 0, 64, 665, 73, 665, 2, 1, 0, 0, 64, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 161, 665, 88, 665, 1, 161, 665, 88, 665, 2, 0, 1, 0, 65, 665, 72, 665, 1, 2, 0, 0, 65, 665, 72, 665, 2, 1, 0, 0, 65, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 162, 665, 87, 665, 1, 162, 665, 87, 665, 2, 0, 1, 0, 66, 665, 71, 665, 1, 2, 0, 0, 66, 665, 71, 665, 2, 1, 0, 0, 66, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 163, 665, 86, 665, 1, 163, 665, 86, 665, 2, 0, 1, 0, 67, 665, 70, 665, 1, 2, 0, 0, 67, 665, 70, 665, 2, 1, 0, 0, 67, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 85, 665, 1, 164, 665, 85, 665, 2, 0, 1, 0, 68, 665, 69, 665, 1, 2, 0, 0, 68, 665, 69, 665, 2, 1, 0, 0, 68, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 84, 665, 1, 165, 665, 84, 665, 2, 0, 1, 0, 69, 665, 68, 665, 1, 2, 0, 0, 69, 665, 68, 665, 2, 1, 0, 0, 69, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 83, 665, 1, 166, 665, 83, 665, 2, 0, 1, 0, 70, 665, 67, 665, 1, 2, 0, 0, 70, 665, 67, 665, 2, 1, 0, 0, 70, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 82, 665, 1, 167, 665, 82, 665, 2, 0, 1, 0, 71, 665, 66, 665, 1, 2, 0, 0, 71, 665, 66, 665, 2, 1, 0, 0, 71, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 81, 665, 1, 168, 665, 81, 665, 2, 0, 1, 0, 72, 665, 65, 665, 1, 2, 0, 0, 72, 665, 65, 665, 2, 1, 0, 0, 72, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 80, 665, 1, 169, 665, 80, 665, 2, 0, 1, 0, 73, 665, 64, 665, 1, 2, 0, 0, 73, 665, 64, 665, 2, 1, 0, 0, 73, 665, 64, 665, 1, 2, 0, 0, 65535ULL, 176, 665, 2, 1, 0, 0, 3, 2, 26, 0, 262140ULL, 0, 161, 665, 89, 665, 1, 161, 665, 89, 665, 2, 0, 1, 0, 65, 665, 73, 665, 1, 2, 0, 0, 65, 665, 73, 665, 2, 1, 0, 0, 65, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 162, 665, 88, 665, 1, 162, 665, 88, 665, 2, 0, 1, 0, 66, 665, 72, 665, 1, 2, 0, 0, 66, 665, 72, 665, 2, 1, 0, 0, 66, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 163, 665, 87, 665, 1, 163, 665, 87, 665, 2, 0, 1, 0, 67, 665, 71, 665, 1, 2, 0, 0, 67, 665, 71, 665, 2, 1, 0, 0, 67, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 164, 665, 86, 665, 1, 164, 665, 86, 665, 2, 0, 1, 0, 68, 665, 70, 665, 1, 2, 0, 0, 68, 665, 70, 665, 2, 1, 0, 0, 68, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 85, 665, 1, 165, 665, 85, 665, 2, 0, 1, 0, 69, 665, 69, 665, 1, 2, 0, 0, 69, 665, 69, 665, 2, 1, 0, 0, 69, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 84, 665, 1, 166, 665, 84, 665, 2, 0, 1, 0, 70, 665, 68, 665, 1, 2, 0, 0, 70, 665, 68, 665, 2, 1, 0, 0, 70, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 83, 665, 1, 167, 665, 83, 665, 2, 0, 1, 0, 71, 665, 67, 665, 1, 2, 0, 0, 71, 665, 67, 665, 2, 1, 0, 0, 71, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 82, 665, 1, 168, 665, 82, 665, 2, 0, 1, 0, 72, 665, 66, 665, 1, 2, 0, 0, 72, 665, 66, 665, 2, 1, 0, 0, 72, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 81, 665, 1, 169, 665, 81, 665, 2, 0, 1, 0, 73, 665, 65, 665, 1, 2, 0, 0, 73, 665, 65, 665, 2, 1, 0, 0, 73, 665, 65, 665, 1, 2, 0, 0, 65535ULL, 177, 665, 2, 1, 0, 0, 4, 2, 27, 0, 262140ULL, 0, 162, 665, 89, 665, 1, 162, 665, 89, 665, 2, 0, 1, 0, 66, 665, 73, 665, 1, 2, 0, 0, 66, 665, 73, 665, 2, 1, 0, 0, 66, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 163, 665, 88, 665, 1, 163, 665, 88, 665, 2, 0, 1, 0, 67, 665, 72, 665, 1, 2, 0, 0, 67, 665, 72, 665, 2, 1, 0, 0, 67, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 164, 665, 87, 665, 1, 164, 665, 87, 665, 2, 0, 1, 0, 68, 665, 71, 665, 1, 2, 0, 0, 68, 665, 71, 665, 2, 1, 0, 0, 68, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 165, 665, 86, 665, 1, 165, 665, 86, 665, 2, 0, 1, 0, 69, 665, 70, 665, 1, 2, 0, 0, 69, 665, 70, 665, 2, 1, 0, 0, 69, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 85, 665, 1, 166, 665, 85, 665, 2, 0, 1, 0, 70, 665, 69, 665, 1, 2, 0, 0, 70, 665, 69, 665, 2, 1, 0, 0, 70, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 84, 665, 1, 167, 665, 84, 665, 2, 0, 1, 0, 71, 665, 68, 665, 1, 2, 0, 0, 71, 665, 68, 665, 2, 1, 0, 0, 71, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 83, 665, 1, 168, 665, 83, 665, 2, 0, 1, 0, 72, 665, 67, 665, 1, 2, 0, 0, 72, 665, 67, 665, 2, 1, 0, 0, 72, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 82, 665, 1, 169, 665, 82, 665, 2, 0, 1, 0, 73, 665, 66, 665, 1, 2, 0, 0, 73, 665, 66, 665, 2, 1, 0, 0, 73, 665, 66, 665, 1, 2, 0, 0, 65535ULL, 178, 665, 2, 1, 0, 0, 3, 2, 28, 0, 262140ULL, 0, 163, 665, 89, 665, 1, 163, 665, 89, 665, 2, 0, 1, 0, 67, 665, 73, 665, 1, 2, 0, 0, 67, 665, 73, 665, 2, 1, 0, 0, 67, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 164, 665, 88, 665, 1, 164, 665, 88, 665, 2, 0, 1, 0, 68, 665, 72, 665, 1, 2, 0, 0, 68, 665, 72, 665, 2, 1, 0, 0, 68, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 165, 665, 87, 665, 1, 165, 665, 87, 665, 2, 0, 1, 0, 69, 665, 71, 665, 1, 2, 0, 0, 69, 665, 71, 665, 2, 1, 0, 0, 69, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 166, 665, 86, 665, 1, 166, 665, 86, 665, 2, 0, 1, 0, 70, 665, 70, 665, 1, 2, 0, 0, 70, 665, 70, 665, 2, 1, 0, 0, 70, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 85, 665, 1, 167, 665, 85, 665, 2, 0, 1, 0, 71, 665, 69, 665, 1, 2, 0, 0, 71, 665, 69, 665, 2, 1, 0, 0, 71, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 84, 665, 1, 168, 665, 84, 665, 2, 0, 1, 0, 72, 665, 68, 665, 1, 2, 0, 0, 72, 665, 68, 665, 2, 1, 0, 0, 72, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 83, 665, 1, 169, 665, 83, 665, 2, 0, 1, 0, 73, 665, 67, 665, 1, 2, 0, 0, 73, 665, 67, 665, 2, 1, 0, 0, 73, 665, 67, 665, 1, 2, 0, 0, 65535ULL, 179, 665, 2, 1, 0, 0, 4, 2, 29, 0, 262140ULL, 0, 164, 665, 89, 665, 1, 164, 665, 89, 665, 2, 0, 1, 0, 68, 665, 73, 665, 1, 2, 0, 0, 68, 665, 73, 665, 2, 1, 0, 0, 68, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 165, 665, 88, 665, 1, 165, 665, 88, 665, 2, 0, 1, 0, 69, 665, 72, 665, 1, 2, 0, 0, 69, 665, 72, 665, 2, 1, 0, 0, 69, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 166, 665, 87, 665, 1, 166, 665, 87, 665, 2, 0, 1, 0, 70, 665, 71, 665, 1, 2, 0, 0, 70, 665, 71, 665, 2, 1, 0, 0, 70, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 167, 665, 86, 665, 1, 167, 665, 86, 665, 2, 0, 1, 0, 71, 665, 70, 665, 1, 2, 0, 0, 71, 665, 70, 665, 2, 1, 0, 0, 71, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 85, 665, 1, 168, 665, 85, 665, 2, 0, 1, 0, 72, 665, 69, 665, 1, 2, 0, 0, 72, 665, 69, 665, 2, 1, 0, 0, 72, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 84, 665, 1, 169, 665, 84, 665, 2, 0, 1, 0, 73, 665, 68, 665, 1, 2, 0, 0, 73, 665, 68, 665, 2, 1, 0, 0, 73, 665, 68, 665, 1, 2, 0, 0, 65535ULL, 180, 665, 2, 1, 0, 0, 3, 2, 30, 0, 262140ULL, 0, 165, 665, 89, 665, 1, 165, 665, 89, 665, 2, 0, 1, 0, 69, 665, 73, 665, 1, 2, 0, 0, 69, 665, 73, 665, 2, 1, 0, 0, 69, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 166, 665, 88, 665, 1, 166, 665, 88, 665, 2, 0, 1, 0, 70, 665, 72, 665, 1, 2, 0, 0, 70, 665, 72, 665, 2, 1, 0, 0, 70, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 167, 665, 87, 665, 1, 167, 665, 87, 665, 2, 0, 1, 0, 71, 665, 71, 665, 1, 2, 0, 0, 71, 665, 71, 665, 2, 1, 0, 0, 71, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 168, 665, 86, 665, 1, 168, 665, 86, 665, 2, 0, 1, 0, 72, 665, 70, 665, 1, 2, 0, 0, 72, 665, 70, 665, 2, 1, 0, 0, 72, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 85, 665, 1, 169, 665, 85, 665, 2, 0, 1, 0, 73, 665, 69, 665, 1, 2, 0, 0, 73, 665, 69, 665, 2, 1, 0, 0, 73, 665, 69, 665, 1, 2, 0, 0, 65535ULL, 181, 665, 2, 1, 0, 0, 4, 2, 31, 0, 262140ULL, 0, 166, 665, 89, 665, 1, 166, 665, 89, 665, 2, 0, 1, 0, 70, 665, 73, 665, 1, 2, 0, 0, 70, 665, 73, 665, 2, 1, 0, 0, 70, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 167, 665, 88, 665, 1, 167, 665, 88, 665, 2, 0, 1, 0, 71, 665, 72, 665, 1, 2, 0, 0, 71, 665, 72, 665, 2, 1, 0, 0, 71, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 168, 665, 87, 665, 1, 168, 665, 87, 665, 2, 0, 1, 0, 72, 665, 71, 665, 1, 2, 0, 0, 72, 665, 71, 665, 2, 1, 0, 0, 72, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 3, 4, 2, 0, 169, 665, 86, 665, 1, 169, 665, 86, 665, 2, 0, 1, 0, 73, 665, 70, 665, 1, 2, 0, 0, 73, 665, 70, 665, 2, 1, 0, 0, 73, 665, 70, 665, 1, 2, 0, 0, 65535ULL, 182, 665, 2, 1, 0, 0, 3, 2, 32, 0, 262140ULL, 0, 167, 665, 89, 665, 1, 167, 665, 89, 665, 2, 0, 1, 0, 71, 665, 73, 665, 1, 2, 0, 0, 71, 665, 73, 665, 2, 1, 0, 0, 71, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 168, 665, 88, 665, 1, 168, 665, 88, 665, 2, 0, 1, 0, 72, 665, 72, 665, 1, 2, 0, 0, 72, 665, 72, 665, 2, 1, 0, 0, 72, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 4, 3, 2, 0, 169, 665, 87, 665, 1, 169, 665, 87, 665, 2, 0, 1, 0, 73, 665, 71, 665, 1, 2, 0, 0, 73, 665, 71, 665, 2, 1, 0, 0, 73, 665, 71, 665, 1, 2, 0, 0, 65535ULL, 183, 665, 2, 1, 0, 0, 4, 2, 4, 0, 262140ULL, 0, 168, 665, 89, 665, 1, 168, 665, 89, 665, 2, 0, 1, 0, 72, 665, 73, 665, 1, 2, 0, 0, 72, 665, 73, 665, 2, 1, 0, 0, 72, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 3, 1, 0, 0, 169, 665, 88, 665, 1, 169, 665, 88, 665, 2, 0, 1, 0, 73, 665, 72, 665, 1, 2, 0, 0, 73, 665, 72, 665, 2, 1, 0, 0, 73, 665, 72, 665, 1, 2, 0, 0, 65535ULL, 184, 665, 2, 1, 0, 0, 3, 2, 3, 0, 262140ULL, 0, 169, 665, 89, 665, 1, 169, 665, 89, 665, 2, 0, 1, 0, 73, 665, 73, 665, 1, 2, 0, 0, 73, 665, 73, 665, 2, 1, 0, 0, 73, 665, 73, 665, 1, 2, 0, 0, 65535ULL, 185, 665, 2, 1, 0, 33, 2, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166149, 371, 1, 0, 0, 154, 665, 154, 665, 1, 64559ULL, 186, 665, 2, 0, 1, 0, 2, 58, 665, 1, 0, 90, 665, 5, 1, 122, 665, 0, 154, 665, 155, 665, 1, 64559ULL, 187, 665, 2, 0, 1, 0, 155, 665, 154, 665, 1, 65535ULL, 186, 665, 3, 0, 1, 0, 2, 3, 1, 0, 59, 665, 0, 1, 91, 665, 6, 0, 123, 665, 0, 154, 665, 156, 665, 1, 64559ULL, 188, 665, 2, 0, 1, 0, 155, 665, 155, 665, 1, 65535ULL, 187, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 154, 665, 1, 65534ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 60, 665, 0, 1, 92, 665, 7, 0, 124, 665, 0, 154, 665, 157, 665, 1, 64559ULL, 189, 665, 2, 0, 1, 0, 155, 665, 156, 665, 1, 65535ULL, 188, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 155, 665, 1, 65534ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 61, 665, 0, 1, 93, 665, 8, 0, 125, 665, 0, 154, 665, 158, 665, 1, 64559ULL, 190, 665, 2, 0, 1, 0, 155, 665, 157, 665, 1, 65535ULL, 189, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 156, 665, 1, 65534ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 62, 665, 0, 1, 94, 665, 9, 0, 126, 665, 0, 154, 665, 159, 665, 1, 64559ULL, 191, 665, 2, 0, 1, 0, 155, 665, 158, 665, 1, 65535ULL, 190, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 157, 665, 1, 65534ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 63, 665, 0, 1, 95, 665, 10, 0, 127, 665, 0, 154, 665, 160, 665, 1, 64559ULL, 192, 665, 2, 0, 1, 0, 155, 665, 159, 665, 1, 65535ULL, 191, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 158, 665, 1, 65534ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 64, 665, 0, 1, 96, 665, 11, 0, 128, 665, 0, 154, 665, 161, 665, 1, 64559ULL, 193, 665, 2, 0, 1, 0, 155, 665, 160, 665, 1, 65535ULL, 192, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 159, 665, 1, 65534ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 65, 665, 0, 1, 97, 665, 12, 0, 129, 665, 0, 154, 665, 162, 665, 1, 64559ULL, 194, 665, 2, 0, 1, 0, 155, 665, 161, 665, 1, 65535ULL, 193, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 160, 665, 1, 65534ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 66, 665, 0, 1, 98, 665, 13, 0, 130, 665, 0, 154, 665, 163, 665, 1, 64559ULL, 195, 665, 2, 0, 1, 0, 155, 665, 162, 665, 1, 65535ULL, 194, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 161, 665, 1, 65534ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 67, 665, 0, 1, 99, 665, 14, 0, 131, 665, 0, 154, 665, 164, 665, 1, 64559ULL, 196, 665, 2, 0, 1, 0, 155, 665, 163, 665, 1, 65535ULL, 195, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 162, 665, 1, 65534ULL, 194, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 68, 665, 0, 1, 100, 665, 15, 0, 132, 665, 0, 154, 665, 165, 665, 1, 64559ULL, 197, 665, 2, 0, 1, 0, 155, 665, 164, 665, 1, 65535ULL, 196, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 163, 665, 1, 65534ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 69, 665, 0, 1, 101, 665, 16, 0, 133, 665, 0, 154, 665, 166, 665, 1, 64559ULL, 198, 665, 2, 0, 1, 0, 155, 665, 165, 665, 1, 65535ULL, 197, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 164, 665, 1, 65534ULL, 196, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 70, 665, 0, 1, 102, 665, 17, 0, 134, 665, 0, 154, 665, 167, 665, 1, 64559ULL, 199, 665, 2, 0, 1, 0, 155, 665, 166, 665, 1, 65535ULL, 198, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 165, 665, 1, 65534ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 71, 665, 0, 1, 103, 665, 18, 0, 135, 665, 0, 154, 665, 168, 665, 1, 64559ULL, 200, 665, 2, 0, 1, 0, 155, 665, 167, 665, 1, 65535ULL, 199, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 166, 665, 1, 65534ULL, 198, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 4, 2, 1, 0, 72, 665, 0, 1, 104, 665, 19, 0, 136, 665, 0, 154, 665, 169, 665, 1, 64559ULL, 201, 665, 2, 0, 1, 0, 155, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 156, 665, 167, 665, 1, 65534ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 157, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 158, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 154, 665, 1, 65535ULL, 186, 665, 2, 0, 1, 0, 3, 2, 1, 0, 73, 665, 0, 1, 105, 665, 20, 0, 137, 665, 0, 155, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 156, 665, 168, 665, 1, 65534ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 157, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 158, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 159, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 160, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 161, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 162, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 163, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 155, 665, 1, 65535ULL, 187, 665, 2, 0, 1, 0, 4, 2, 21, 0, 258236ULL, 0, 156, 665, 169, 665, 1, 65534ULL, 201, 665, 2, 0, 1, 0, 157, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 158, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 159, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 160, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 156, 665, 1, 65535ULL, 188, 665, 2, 0, 1, 0, 3, 2, 22, 0, 262140ULL, 0, 157, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 158, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 159, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 160, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 161, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 162, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 163, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 157, 665, 1, 65535ULL, 189, 665, 2, 0, 1, 0, 4, 2, 23, 0, 262136ULL, 0, 158, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 159, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 160, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 161, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 162, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 158, 665, 1, 65535ULL, 190, 665, 2, 0, 1, 0, 3, 2, 24, 0, 262140ULL, 0, 159, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 160, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 161, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 162, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 163, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 159, 665, 1, 65535ULL, 191, 665, 2, 0, 1, 0, 4, 2, 25, 0, 262140ULL, 0, 160, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 161, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 162, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 163, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 164, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 160, 665, 1, 65535ULL, 192, 665, 2, 0, 1, 0, 3, 2, 26, 0, 262140ULL, 0, 161, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 162, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 163, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 164, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 165, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 161, 665, 1, 65535ULL, 193, 665, 2, 0, 1, 0, 4, 2, 27, 0, 262140ULL, 0, 162, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 163, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 164, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 165, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 166, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 162, 665, 1, 65535ULL, 194, 665, 2, 0, 1, 0, 3, 2, 28, 0, 262140ULL, 0, 163, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 164, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 165, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 166, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 167, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 163, 665, 1, 65535ULL, 195, 665, 2, 0, 1, 0, 4, 2, 29, 0, 262140ULL, 0, 164, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 165, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 166, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 167, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 168, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 164, 665, 1, 65535ULL, 196, 665, 2, 0, 1, 0, 3, 2, 30, 0, 262140ULL, 0, 165, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 166, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 167, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 168, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 4, 3, 2, 0, 169, 665, 165, 665, 1, 65535ULL, 197, 665, 2, 0, 1, 0, 4, 2, 31, 0, 262140ULL, 0, 166, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 167, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 168, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 3, 4, 2, 0, 169, 665, 166, 665, 1, 65535ULL, 198, 665, 2, 0, 1, 0, 3, 2, 32, 0, 262140ULL, 0, 167, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 168, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 4, 2, 3, 0, 169, 665, 167, 665, 1, 65535ULL, 199, 665, 2, 0, 1, 0, 4, 2, 4, 0, 262140ULL, 0, 168, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 0, 169, 665, 168, 665, 1, 65535ULL, 200, 665, 3, 0, 1, 0, 2, 3, 3, 0, 262140ULL, 0, 169, 665, 169, 665, 1, 65535ULL, 201, 665, 2, 0, 1, 33, 2, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166150, 371, 1, 0, 0, 154, 665, 58, 665, 1, 154, 665, 122, 665, 2, 0, 1, 0, 64559ULL, 202, 665, 1, 2, 0, 0, 1, 74, 665, 5, 0, 138, 665, 0, 154, 665, 59, 665, 1, 154, 665, 123, 665, 2, 0, 1, 0, 64559ULL, 203, 665, 3, 2, 0, 0, 155, 665, 58, 665, 1, 155, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 75, 665, 6, 1, 139, 665, 0, 154, 665, 60, 665, 1, 154, 665, 124, 665, 2, 0, 1, 0, 64559ULL, 204, 665, 3, 2, 0, 0, 155, 665, 59, 665, 1, 155, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 58, 665, 1, 156, 665, 122, 665, 2, 0, 1, 0, 65534ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 76, 665, 7, 1, 140, 665, 0, 154, 665, 61, 665, 1, 154, 665, 125, 665, 2, 0, 1, 0, 64559ULL, 205, 665, 3, 2, 0, 0, 155, 665, 60, 665, 1, 155, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 59, 665, 1, 156, 665, 123, 665, 2, 0, 1, 0, 65534ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 58, 665, 1, 157, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 77, 665, 8, 1, 141, 665, 0, 154, 665, 62, 665, 1, 154, 665, 126, 665, 2, 0, 1, 0, 64559ULL, 206, 665, 3, 2, 0, 0, 155, 665, 61, 665, 1, 155, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 60, 665, 1, 156, 665, 124, 665, 2, 0, 1, 0, 65534ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 59, 665, 1, 157, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 58, 665, 1, 158, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 78, 665, 9, 1, 142, 665, 0, 154, 665, 63, 665, 1, 154, 665, 127, 665, 2, 0, 1, 0, 64559ULL, 207, 665, 3, 2, 0, 0, 155, 665, 62, 665, 1, 155, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 61, 665, 1, 156, 665, 125, 665, 2, 0, 1, 0, 65534ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 60, 665, 1, 157, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 59, 665, 1, 158, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 58, 665, 1, 159, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 79, 665, 10, 1, 143, 665, 0, 154, 665, 64, 665, 1, 154, 665, 128, 665, 2, 0, 1, 0, 64559ULL, 208, 665, 3, 2, 0, 0, 155, 665, 63, 665, 1, 155, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 62, 665, 1, 156, 665, 126, 665, 2, 0, 1, 0, 65534ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 61, 665, 1, 157, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 60, 665, 1, 158, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 59, 665, 1, 159, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 58, 665, 1, 160, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 80, 665, 11, 1, 144, 665, 0, 154, 665, 65, 665, 1, 154, 665, 129, 665, 2, 0, 1, 0, 64559ULL, 209, 665, 3, 2, 0, 0, 155, 665, 64, 665, 1, 155, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 63, 665, 1, 156, 665, 127, 665, 2, 0, 1, 0, 65534ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 62, 665, 1, 157, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 61, 665, 1, 158, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 60, 665, 1, 159, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 59, 665, 1, 160, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 58, 665, 1, 161, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 81, 665, 12, 1, 145, 665, 0, 154, 665, 66, 665, 1, 154, 665, 130, 665, 2, 0, 1, 0, 64559ULL, 210, 665, 3, 2, 0, 0, 155, 665, 65, 665, 1, 155, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 64, 665, 1, 156, 665, 128, 665, 2, 0, 1, 0, 65534ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 63, 665, 1, 157, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 62, 665, 1, 158, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 61, 665, 1, 159, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 60, 665, 1, 160, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 59, 665, 1, 161, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 58, 665, 1, 162, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 82, 665, 13, 1, 146, 665, 0, 154, 665, 67, 665, 1, 154, 665, 131, 665, 2, 0, 1, 0, 64559ULL, 211, 665, 3, 2, 0, 0, 155, 665, 66, 665, 1, 155, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 65, 665, 1, 156, 665, 129, 665, 2, 0, 1, 0, 65534ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 64, 665, 1, 157, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 63, 665, 1, 158, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 62, 665, 1, 159, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 61, 665, 1, 160, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 60, 665, 1, 161, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 59, 665, 1, 162, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 58, 665, 1, 163, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 83, 665, 14, 1, 147, 665, 0, 154, 665, 68, 665, 1, 154, 665, 132, 665, 2, 0, 1, 0, 64559ULL, 212, 665, 3, 2, 0, 0, 155, 665, 67, 665, 1, 155, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 66, 665, 1, 156, 665, 130, 665, 2, 0, 1, 0, 65534ULL, 210, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 65, 665, 1, 157, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 64, 665, 1, 158, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 63, 665, 1, 159, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 62, 665, 1, 160, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 61, 665, 1, 161, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 60, 665, 1, 162, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 59, 665, 1, 163, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 58, 665, 1, 164, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 84, 665, 15, 1, 148, 665, 0, 154, 665, 69, 665, 1, 154, 665, 133, 665, 2, 0, 1, 0, 64559ULL, 213, 665, 3, 2, 0, 0, 155, 665, 68, 665, 1, 155, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 67, 665, 1, 156, 665, 131, 665, 2, 0, 1, 0, 65534ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 66, 665, 1, 157, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 65, 665, 1, 158, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 64, 665, 1, 159, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 63, 665, 1, 160, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 62, 665, 1, 161, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 61, 665, 1, 162, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 60, 665, 1, 163, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 59, 665, 1, 164, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 58, 665, 1, 165, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 85, 665, 16, 1, 149, 665, 0, 154, 665, 70, 665, 1, 154, 665, 134, 665, 2, 0, 1, 0, 64559ULL, 214, 665, 3, 2, 0, 0, 155, 665, 69, 665, 1, 155, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 68, 665, 1, 156, 665, 132, 665, 2, 0, 1, 0, 65534ULL, 212, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 67, 665, 1, 157, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 66, 665, 1, 158, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 65, 665, 1, 159, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 64, 665, 1, 160, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 63, 665, 1, 161, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 62, 665, 1, 162, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 61, 665, 1, 163, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 60, 665, 1, 164, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 59, 665, 1, 165, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 58, 665, 1, 166, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 86, 665, 17, 1, 150, 665, 0, 154, 665, 71, 665, 1, 154, 665, 135, 665, 2, 0, 1, 0, 64559ULL, 215, 665, 3, 2, 0, 0, 155, 665, 70, 665, 1, 155, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 69, 665, 1, 156, 665, 133, 665, 2, 0, 1, 0, 65534ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 68, 665, 1, 157, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 67, 665, 1, 158, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 66, 665, 1, 159, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 65, 665, 1, 160, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 64, 665, 1, 161, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 63, 665, 1, 162, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 62, 665, 1, 163, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 61, 665, 1, 164, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 60, 665, 1, 165, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 59, 665, 1, 166, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 58, 665, 1, 167, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 87, 665, 18, 1, 151, 665, 0, 154, 665, 72, 665, 1, 154, 665, 136, 665, 2, 0, 1, 0, 64559ULL, 216, 665, 3, 2, 0, 0, 155, 665, 71, 665, 1, 155, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 70, 665, 1, 156, 665, 134, 665, 2, 0, 1, 0, 65534ULL, 214, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 69, 665, 1, 157, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 68, 665, 1, 158, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 67, 665, 1, 159, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 66, 665, 1, 160, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 65, 665, 1, 161, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 64, 665, 1, 162, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 63, 665, 1, 163, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 62, 665, 1, 164, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 61, 665, 1, 165, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 60, 665, 1, 166, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 59, 665, 1, 167, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 58, 665, 1, 168, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 4, 1, 1, 0, 88, 665, 19, 1, 152, 665, 0, 154, 665, 73, 665, 1, 154, 665, 137, 665, 2, 0, 1, 0, 64559ULL, 217, 665, 3, 2, 0, 0, 155, 665, 72, 665, 1, 155, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 156, 665, 71, 665, 1, 156, 665, 135, 665, 2, 0, 1, 0, 65534ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 157, 665, 70, 665, 1, 157, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 69, 665, 1, 158, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 68, 665, 1, 159, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 67, 665, 1, 160, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 66, 665, 1, 161, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 65, 665, 1, 162, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 64, 665, 1, 163, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 63, 665, 1, 164, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 62, 665, 1, 165, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 61, 665, 1, 166, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 60, 665, 1, 167, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 59, 665, 1, 168, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 58, 665, 1, 169, 665, 122, 665, 2, 0, 1, 0, 65535ULL, 202, 665, 1, 2, 0, 0, 3, 1, 1, 0, 89, 665, 20, 1, 153, 665, 0, 155, 665, 73, 665, 1, 155, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 156, 665, 72, 665, 1, 156, 665, 136, 665, 2, 0, 1, 0, 65534ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 157, 665, 71, 665, 1, 157, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 158, 665, 70, 665, 1, 158, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 69, 665, 1, 159, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 68, 665, 1, 160, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 67, 665, 1, 161, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 66, 665, 1, 162, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 65, 665, 1, 163, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 64, 665, 1, 164, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 63, 665, 1, 165, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 62, 665, 1, 166, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 61, 665, 1, 167, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 60, 665, 1, 168, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 59, 665, 1, 169, 665, 123, 665, 2, 0, 1, 0, 65535ULL, 203, 665, 1, 2, 0, 0, 4, 1, 21, 0, 258236ULL, 0, 156, 665, 73, 665, 1, 156, 665, 137, 665, 2, 0, 1, 0, 65534ULL, 217, 665, 3, 2, 0, 0, 157, 665, 72, 665, 1, 157, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 158, 665, 71, 665, 1, 158, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 159, 665, 70, 665, 1, 159, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 69, 665, 1, 160, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 68, 665, 1, 161, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 67, 665, 1, 162, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 66, 665, 1, 163, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 65, 665, 1, 164, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 64, 665, 1, 165, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 63, 665, 1, 166, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 62, 665, 1, 167, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 61, 665, 1, 168, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 60, 665, 1, 169, 665, 124, 665, 2, 0, 1, 0, 65535ULL, 204, 665, 1, 2, 0, 0, 3, 1, 22, 0, 262140ULL, 0, 157, 665, 73, 665, 1, 157, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 158, 665, 72, 665, 1, 158, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 159, 665, 71, 665, 1, 159, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 160, 665, 70, 665, 1, 160, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 69, 665, 1, 161, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 68, 665, 1, 162, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 67, 665, 1, 163, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 66, 665, 1, 164, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 65, 665, 1, 165, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 64, 665, 1, 166, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 63, 665, 1, 167, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 62, 665, 1, 168, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 61, 665, 1, 169, 665, 125, 665, 2, 0, 1, 0, 65535ULL, 205, 665, 1, 2, 0, 0, 4, 1, 23, 0, 262136ULL, 0, 158, 665, 73, 665, 1, 158, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 159, 665, 72, 665, 1, 159, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 160, 665, 71, 665, 1, 160, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 161, 665, 70, 665, 1, 161, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 69, 665, 1, 162, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 68, 665, 1, 163, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 67, 665, 1, 164, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 66, 665, 1, 165, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 65, 665, 1, 166, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 64, 665, 1, 167, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 63, 665, 1, 168, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 62, 665, 1, 169, 665, 126, 665, 2, 0, 1, 0, 65535ULL, 206, 665, 1, 2, 0, 0, 3, 1, 24, 0, 262140ULL, 0, 159, 665, 73, 665, 1, 159, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 160, 665, 72, 665, 1, 160, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 161, 665, 71, 665, 1, 161, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 162, 665, 70, 665, 1, 162, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 69, 665, 1, 163, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 68, 665, 1, 164, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 67, 665, 1, 165, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 66, 665, 1, 166, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 65, 665, 1, 167, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 64, 665, 1, 168, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 63, 665, 1, 169, 665, 127, 665, 2, 0, 1, 0, 65535ULL, 207, 665, 1, 2, 0, 0, 4, 1, 25, 0, 262140ULL, 0, 160, 665, 73, 665, 1, 160, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 161, 665, 72, 665, 1, 161, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 162, 665, 71, 665, 1, 162, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 163, 665, 70, 665, 1, 163, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 69, 665, 1, 164, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 68, 665, 1, 165, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 67, 665, 1, 166, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 66, 665, 1, 167, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 65, 665, 1, 168, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 64, 665, 1, 169, 665, 128, 665, 2, 0, 1, 0, 65535ULL, 208, 665, 1, 2, 0, 0, 3, 1, 26, 0, 262140ULL, 0, 161, 665, 73, 665, 1, 161, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 162, 665, 72, 665, 1, 162, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 163, 665, 71, 665, 1, 163, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 164, 665, 70, 665, 1, 164, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 69, 665, 1, 165, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 68, 665, 1, 166, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 67, 665, 1, 167, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 66, 665, 1, 168, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 65, 665, 1, 169, 665, 129, 665, 2, 0, 1, 0, 65535ULL, 209, 665, 1, 2, 0, 0, 4, 1, 27, 0, 262140ULL, 0, 162, 665, 73, 665, 1, 162, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 163, 665, 72, 665, 1, 163, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 164, 665, 71, 665, 1, 164, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 165, 665, 70, 665, 1, 165, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 69, 665, 1, 166, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 68, 665, 1, 167, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 67, 665, 1, 168, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 66, 665, 1, 169, 665, 130, 665, 2, 0, 1, 0, 65535ULL, 210, 665, 1, 2, 0, 0, 3, 1, 28, 0, 262140ULL, 0, 163, 665, 73, 665, 1, 163, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 164, 665, 72, 665, 1, 164, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 165, 665, 71, 665, 1, 165, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 166, 665, 70, 665, 1, 166, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 69, 665, 1, 167, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 68, 665, 1, 168, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 67, 665, 1, 169, 665, 131, 665, 2, 0, 1, 0, 65535ULL, 211, 665, 1, 2, 0, 0, 4, 1, 29, 0, 262140ULL, 0, 164, 665, 73, 665, 1, 164, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 165, 665, 72, 665, 1, 165, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 166, 665, 71, 665, 1, 166, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 167, 665, 70, 665, 1, 167, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 69, 665, 1, 168, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 68, 665, 1, 169, 665, 132, 665, 2, 0, 1, 0, 65535ULL, 212, 665, 1, 2, 0, 0, 3, 1, 30, 0, 262140ULL, 0, 165, 665, 73, 665, 1, 165, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 166, 665, 72, 665, 1, 166, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 167, 665, 71, 665, 1, 167, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 168, 665, 70, 665, 1, 168, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 69, 665, 1, 169, 665, 133, 665, 2, 0, 1, 0, 65535ULL, 213, 665, 1, 2, 0, 0, 4, 1, 31, 0, 262140ULL, 0, 166, 665, 73, 665, 1, 166, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 167, 665, 72, 665, 1, 167, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 168, 665, 71, 665, 1, 168, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 3, 4, 1, 0, 169, 665, 70, 665, 1, 169, 665, 134, 665, 2, 0, 1, 0, 65535ULL, 214, 665, 1, 2, 0, 0, 3, 1, 32, 0, 262140ULL, 0, 167, 665, 73, 665, 1, 167, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 168, 665, 72, 665, 1, 168, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 4, 3, 1, 0, 169, 665, 71, 665, 1, 169, 665, 135, 665, 2, 0, 1, 0, 65535ULL, 215, 665, 1, 2, 0, 0, 4, 1, 4, 0, 262140ULL, 0, 168, 665, 73, 665, 1, 168, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 3, 2, 0, 0, 169, 665, 72, 665, 1, 169, 665, 136, 665, 2, 0, 1, 0, 65535ULL, 216, 665, 1, 2, 0, 0, 3, 1, 3, 0, 262140ULL, 0, 169, 665, 73, 665, 1, 169, 665, 137, 665, 2, 0, 1, 0, 65535ULL, 217, 665, 1, 2, 0, 33, 1, 262140ULL, 34, 18446744069414322181ULL, 0, 5, 5, 1, 6, 6, 2, 0, 1, 0, 7, 7, 1, 2, 0, 0, 8, 8, 2, 1, 0, 0, 9, 9, 1, 2, 0, 0, 10, 10, 2, 1, 0, 0, 11, 11, 1, 2, 0, 0, 12, 12, 2, 1, 0, 0, 13, 13, 1, 2, 0, 0, 14, 14, 2, 1, 0, 0, 15, 15, 1, 2, 0, 0, 16, 16, 2, 1, 0, 0, 17, 17, 1, 2, 0, 0, 18, 18, 2, 1, 0, 0, 19, 19, 1, 2, 0, 0, 20, 20, 2, 1, 0, 0, 21, 21, 1, 2, 0, 0, 22, 22, 2, 1, 0, 0, 23, 23, 1, 2, 0, 0, 24, 24, 2, 1, 0, 0, 25, 25, 1, 2, 0, 0, 26, 26, 2, 1, 0, 0, 27, 27, 1, 2, 0, 0, 28, 28, 2, 1, 0, 0, 29, 29, 1, 2, 0, 0, 30, 30, 2, 1, 0, 0, 31, 31, 1, 2, 0, 0, 32, 32, 2, 1, 0, 0, 4, 33, 1, 2, 0, 0, 3, 34, 2, 1, 0, 0, 33, 35, 1, 2, 0, 0, 34, 36, 6652166151, 371, 1, 0, 1, 267, 665, 126, 6652166152, 371, 1, 1, 0, 6652166152, 371, 6652166152, 371, 6652166153, 371, 6652166152, 371, 0, 2, 268, 665, 127, 6652166154, 371, 2, 2, 0, 6652166154, 371, 6652166154, 371, 6652166155, 371, 6652166154, 371, 0, 4, 269, 665, 128, 6652166156, 371, 4, 4, 0, 6652166156, 371, 6652166156, 371, 6652166157, 371, 6652166156, 371, 0, 5, 270, 665, 129, 6652166158, 371, 5, 5, 0, 6652166158, 371, 6652166158, 371, 6652166159, 371, 6652166158, 371, 0, 6, 271, 665, 130, 6652166160, 371, 6, 6, 0, 6652166160, 371, 6652166160, 371, 6652166161, 371, 6652166160, 371, 0, 7, 272, 665, 131, 6652166162, 371, 7, 7, 0, 6652166162, 371, 6652166162, 371, 6652166163, 371, 6652166162, 371, 0, 8, 273, 665, 132, 6652166164, 371, 8, 8, 0, 6652166164, 371, 6652166164, 371, 6652166165, 371, 6652166164, 371, 0, 9, 274, 665, 133, 6652166166, 371, 9, 9, 0, 6652166166, 371, 6652166166, 371, 6652166167, 371, 6652166166, 371, 0, 10, 275, 665, 134, 6652166168, 371, 10, 10, 0, 6652166168, 371, 6652166168, 371, 6652166169, 371, 6652166168, 371, 0, 11, 276, 665, 135, 6652166170, 371, 11, 11, 0, 6652166170, 371, 6652166170, 371, 6652166171, 371, 6652166170, 371, 0, 12, 277, 665, 136, 6652166172, 371, 12, 12, 0, 6652166172, 371, 6652166172, 371, 6652166173, 371, 6652166172, 371, 0, 13, 278, 665, 137, 6652166174, 371, 13, 13, 0, 6652166174, 371, 6652166174, 371, 6652166175, 371, 6652166174, 371, 0, 0, 6652166153, 371, 1, 14, 0, 3, 6652166155, 371, 2, 0, 2, 3, 1, 125, 0, 15, 1, 3, 2, 6652166157, 371, 4, 0, 4, 2, 1, 125, 0, 3, 1, 2, 2, 6652166159, 371, 5, 0, 5, 2, 1, 125, 0, 4, 1, 2, 2, 6652166161, 371, 6, 0, 6, 2, 1, 125, 0, 5, 1, 2, 2, 6652166163, 371, 7, 0, 7, 2, 1, 125, 0, 6, 1, 2, 2, 6652166165, 371, 8, 0, 8, 2, 1, 125, 0, 7, 1, 2, 2, 6652166167, 371, 9, 0, 9, 2, 1, 125, 0, 8, 1, 2, 2, 6652166169, 371, 10, 0, 10, 2, 1, 125, 0, 9, 1, 2, 2, 6652166171, 371, 11, 0, 11, 2, 1, 125, 0, 10, 1, 2, 2, 6652166173, 371, 12, 0, 12, 2, 1, 125, 0, 11, 1, 2, 2, 6652166175, 371, 13, 0, 13, 2, 1, 125, 0, 12, 1, 2, 0, 25ULL, 14, 1, 15ULL, 15, 2, 0, 1, 0, 41ULL, 3, 1, 2, 0, 0, 16ULL, 4, 2, 1, 0, 0, 2ULL, 5, 1, 2, 0, 0, 28ULL, 6, 2, 1, 0, 0, 13ULL, 7, 1, 2, 0, 0, 13ULL, 8, 2, 1, 0, 0, 39ULL, 9, 1, 2, 0, 0, 18ULL, 10, 2, 1, 0, 0, 34ULL, 11, 1, 2, 0, 0, 20ULL, 12, 6652166176, 371, 1, 0, 0, 20ULL, 14, 1, 17ULL, 15, 2, 0, 1, 0, 15ULL, 3, 1, 2, 0, 0, 41ULL, 4, 2, 1, 0, 0, 16ULL, 5, 1, 2, 0, 0, 2ULL, 6, 2, 1, 0, 0, 28ULL, 7, 1, 2, 0, 0, 13ULL, 8, 2, 1, 0, 0, 13ULL, 9, 1, 2, 0, 0, 39ULL, 10, 2, 1, 0, 0, 18ULL, 11, 1, 2, 0, 0, 34ULL, 12, 6652166177, 371, 1, 0, 0, 34ULL, 14, 1, 20ULL, 15, 2, 0, 1, 0, 17ULL, 3, 1, 2, 0, 0, 15ULL, 4, 2, 1, 0, 0, 41ULL, 5, 1, 2, 0, 0, 16ULL, 6, 2, 1, 0, 0, 2ULL, 7, 1, 2, 0, 0, 28ULL, 8, 2, 1, 0, 0, 13ULL, 9, 1, 2, 0, 0, 13ULL, 10, 2, 1, 0, 0, 39ULL, 11, 1, 2, 0, 0, 18ULL, 12, 6652166178, 371, 1, 0, 0, 18ULL, 14, 1, 34ULL, 15, 2, 0, 1, 0, 20ULL, 3, 1, 2, 0, 0, 17ULL, 4, 2, 1, 0, 0, 15ULL, 5, 1, 2, 0, 0, 41ULL, 6, 2, 1, 0, 0, 16ULL, 7, 1, 2, 0, 0, 2ULL, 8, 2, 1, 0, 0, 28ULL, 9, 1, 2, 0, 0, 13ULL, 10, 2, 1, 0, 0, 13ULL, 11, 1, 2, 0, 0, 39ULL, 12, 6652166179, 371, 1, 0, 0, 39ULL, 14, 1, 18ULL, 15, 2, 0, 1, 0, 34ULL, 3, 1, 2, 0, 0, 20ULL, 4, 2, 1, 0, 0, 17ULL, 5, 1, 2, 0, 0, 15ULL, 6, 2, 1, 0, 0, 41ULL, 7, 1, 2, 0, 0, 16ULL, 8, 2, 1, 0, 0, 2ULL, 9, 1, 2, 0, 0, 28ULL, 10, 2, 1, 0, 0, 13ULL, 11, 1, 2, 0, 0, 13ULL, 12, 6652166180, 371, 1, 0, 0, 13ULL, 14, 1, 39ULL, 15, 2, 0, 1, 0, 18ULL, 3, 1, 2, 0, 0, 34ULL, 4, 2, 1, 0, 0, 20ULL, 5, 1, 2, 0, 0, 17ULL, 6, 2, 1, 0, 0, 15ULL, 7, 1, 2, 0, 0, 41ULL, 8, 2, 1, 0, 0, 16ULL, 9, 1, 2, 0, 0, 2ULL, 10, 2, 1, 0, 0, 28ULL, 11, 1, 2, 0, 0, 13ULL, 12, 6652166181, 371, 1, 0, 0, 13ULL, 14, 1, 13ULL, 15, 2, 0, 1, 0, 39ULL, 3, 1, 2, 0, 0, 18ULL, 4, 2, 1, 0, 0, 34ULL, 5, 1, 2, 0, 0, 20ULL, 6, 2, 1, 0, 0, 17ULL, 7, 1, 2, 0, 0, 15ULL, 8, 2, 1, 0, 0, 41ULL, 9, 1, 2, 0, 0, 16ULL, 10, 2, 1, 0, 0, 2ULL, 11, 1, 2, 0, 0, 28ULL, 12, 6652166182, 371, 1, 0, 0, 28ULL, 14, 1, 13ULL, 15, 2, 0, 1, 0, 13ULL, 3, 1, 2, 0, 0, 39ULL, 4, 2, 1, 0, 0, 18ULL, 5, 1, 2, 0, 0, 34ULL, 6, 2, 1, 0, 0, 20ULL, 7, 1, 2, 0, 0, 17ULL, 8, 2, 1, 0, 0, 15ULL, 9, 1, 2, 0, 0, 41ULL, 10, 2, 1, 0, 0, 16ULL, 11, 1, 2, 0, 0, 2ULL, 12, 6652166183, 371, 1, 0, 0, 2ULL, 14, 1, 28ULL, 15, 2, 0, 1, 0, 13ULL, 3, 1, 2, 0, 0, 13ULL, 4, 2, 1, 0, 0, 39ULL, 5, 1, 2, 0, 0, 18ULL, 6, 2, 1, 0, 0, 34ULL, 7, 1, 2, 0, 0, 20ULL, 8, 2, 1, 0, 0, 17ULL, 9, 1, 2, 0, 0, 15ULL, 10, 2, 1, 0, 0, 41ULL, 11, 1, 2, 0, 0, 16ULL, 12, 6652166184, 371, 1, 0, 0, 16ULL, 14, 1, 2ULL, 15, 2, 0, 1, 0, 28ULL, 3, 1, 2, 0, 0, 13ULL, 4, 2, 1, 0, 0, 13ULL, 5, 1, 2, 0, 0, 39ULL, 6, 2, 1, 0, 0, 18ULL, 7, 1, 2, 0, 0, 34ULL, 8, 2, 1, 0, 0, 20ULL, 9, 1, 2, 0, 0, 17ULL, 10, 2, 1, 0, 0, 15ULL, 11, 1, 2, 0, 0, 41ULL, 12, 6652166185, 371, 1, 0, 0, 41ULL, 14, 1, 16ULL, 15, 2, 0, 1, 0, 2ULL, 3, 1, 2, 0, 0, 28ULL, 4, 2, 1, 0, 0, 13ULL, 5, 1, 2, 0, 0, 13ULL, 6, 2, 1, 0, 0, 39ULL, 7, 1, 2, 0, 0, 18ULL, 8, 2, 1, 0, 0, 34ULL, 9, 1, 2, 0, 0, 20ULL, 10, 2, 1, 0, 0, 17ULL, 11, 1, 2, 0, 0, 15ULL, 12, 6652166186, 371, 1, 0, 0, 15ULL, 14, 1, 41ULL, 15, 2, 0, 1, 0, 16ULL, 3, 1, 2, 0, 0, 2ULL, 4, 2, 1, 0, 0, 28ULL, 5, 1, 2, 0, 0, 13ULL, 6, 2, 1, 0, 0, 13ULL, 7, 1, 2, 0, 0, 39ULL, 8, 2, 1, 0, 0, 18ULL, 9, 1, 2, 0, 0, 34ULL, 10, 2, 1, 0, 0, 20ULL, 11, 1, 2, 0, 0, 17ULL, 12, 6652166187, 371, 1, 0, 0, 296, 665, 297, 665, 2, 1ULL, 0, 0, 2, 298, 665, 6652166188, 371, 0, 146, 0, 2, 298, 665, 1, 1ULL, 0, 0, 1, 294, 665, 1, 0, 2, 0, 128ULL, 6652166188, 371, 6652166189, 371, 1, 0, 0, 314, 665, 6652166189, 371, 6652166190, 371, 0, 322, 665, 0, 315, 665, 6652166189, 371, 6652166191, 371, 0, 323, 665, 0, 316, 665, 6652166189, 371, 6652166192, 371, 0, 324, 665, 0, 317, 665, 6652166189, 371, 6652166193, 371, 0, 325, 665, 0, 318, 665, 6652166189, 371, 6652166194, 371, 0, 326, 665, 0, 319, 665, 6652166189, 371, 6652166195, 371, 0, 327, 665, 0, 320, 665, 6652166189, 371, 6652166196, 371, 0, 328, 665, 0, 321, 665, 6652166189, 371, 6652166197, 371, 0, 329, 665, 0, 376, 665, 342, 665, 1, 377, 665, 346, 665, 2, 0, 1, 0, 378, 665, 350, 665, 1, 2, 0, 0, 379, 665, 354, 665, 2, 1, 0, 0, 380, 665, 358, 665, 1, 2, 0, 0, 383, 665, 366, 665, 2, 1, 0, 0, 381, 665, 362, 665, 1, 2, 0, 0, 384, 665, 330, 665, 2, 1, 0, 0, 382, 665, 370, 665, 1, 2, 0, 0, 385, 665, 357, 665, 2, 1, 0, 37, 2, 407, 665, 0, 37, 413, 665, 6652166198, 371, 1ULL, 0, 0, 2ULL, 429, 665, 1, 0, 428, 665, 0, 429, 665, 1, 1, 431, 665, 0, 0, 1, 428, 665, 6652166199, 371, 0, 0, 443, 665, 444, 665, 2, 1ULL, 0, 0, 2, 445, 665, 6652166200, 371, 0, 213, 0, 2, 445, 665, 6652166201, 371, 0, 214, 0, 2, 445, 665, 1, 1ULL, 0, 0, 1, 440, 665, 1, 0, 2, 0, 128ULL, 6652166200, 371, 6652166202, 371, 1, 0, 0, 461, 665, 6652166202, 371, 6652166203, 371, 0, 469, 665, 0, 462, 665, 6652166202, 371, 6652166204, 371, 0, 470, 665, 0, 463, 665, 6652166202, 371, 6652166205, 371, 0, 471, 665, 0, 464, 665, 6652166202, 371, 6652166206, 371, 0, 472, 665, 0, 465, 665, 6652166202, 371, 6652166207, 371, 0, 473, 665, 0, 466, 665, 6652166202, 371, 6652166208, 371, 0, 474, 665, 0, 467, 665, 6652166202, 371, 6652166209, 371, 0, 475, 665, 0, 468, 665, 6652166202, 371, 6652166210, 371, 0, 476, 665, 2, 479, 1, 8388608, 665, 480, 1, 8388608, 665, 0, 1ULL, 2, 1, 1ULL, 489, 665, 6652166211, 371, 0, 1, 0, 1ULL, 2, 6652166212, 371, 489, 665, 0, 0, 497, 665, 562, 665, 1, 505, 665, 563, 665, 2, 0, 1, 0, 513, 665, 564, 665, 1, 2, 0, 0, 506, 665, 565, 665, 2, 1, 0, 0, 521, 665, 566, 665, 1, 2, 0, 0, 529, 665, 567, 665, 2, 1, 0, 0, 561, 665, 569, 665, 1, 2, 0, 0, 537, 665, 568, 665, 2, 1, 0, 0, 538, 665, 570, 665, 1, 2, 0, 0, 539, 665, 571, 665, 2, 1, 0, 0, 540, 665, 572, 665, 1, 2, 0, 0, 541, 665, 573, 665, 2, 1, 0, 0, 574, 665, 45, 1, 2, 0, 0, 543, 665, 575, 665, 2, 1, 0, 0, 544, 665, 576, 665, 1, 2, 0, 0, 628, 665, 634, 665, 2, 1, 0, 0, 629, 665, 635, 665, 1, 2, 0, 0, 630, 665, 636, 665, 2, 1, 0, 0, 631, 665, 637, 665, 1, 2, 0, 0, 632, 665, 638, 665, 2, 1, 0, 0, 633, 665, 639, 665, 1, 2, 0, 0, 545, 665, 577, 665, 2, 1, 0, 54, 2, 553, 665, 0, 54, 652, 665, 6652166213, 371, 1ULL, 0, 0, 545, 665, 651, 665, 4, 1ULL, 0, 0, 1ULL, 4, 6652166214, 371, 624, 665, 0, 0, 1ULL, 627, 665, 1, 592, 665, 0, 0, 1ULL, 602, 665, 2, 593, 665, 0, 3, 1, 2, 0, 1ULL, 6652166213, 371, 1, 594, 665, 0, 6652166215, 371, 3, 1, 0, 599, 665, 529, 665, 1, 600, 665, 543, 665, 2, 0, 1, 3, 2, 595, 665, 0, 601, 665, 538, 665, 1, 262144ULL, 0, 0, 65536ULL, 597, 665, 2, 1, 0, 0, 597, 665, 539, 665, 1, 2, 0, 0, 131072ULL, 598, 665, 2, 1, 0, 53, 2, 3, 0, 653, 665, 53, 1, 655, 665, 0, 0, 543, 665, 53, 2, 626, 665, 0, 0, 1, 2, 6652166216, 371, 0, 53, 1, 542, 665, 1ULL, 0, 1ULL, 4, 2, 0, 624, 665, 6652166217, 371, 1, 2, 0, 458, 665, 460, 665, 1, 1ULL, 0, 6652166218, 371, 1, 215, 0, 311, 665, 313, 665, 1, 1ULL, 0, 6652166219, 371, 1, 147, 0, 6652166189, 371, 138, 1, 0, 286, 665, 17, 1, 0, 6652166189, 371, 139, 1, 0, 287, 665, 18, 1, 0, 6652166189, 371, 140, 1, 0, 288, 665, 19, 1, 0, 6652166189, 371, 141, 1, 0, 289, 665, 20, 1, 0, 6652166189, 371, 142, 1, 0, 290, 665, 21, 1, 0, 6652166189, 371, 143, 1, 0, 291, 665, 22, 1, 0, 6652166189, 371, 144, 1, 0, 292, 665, 23, 1, 0, 6652166189, 371, 145, 1, 0, 293, 665, 24, 1, 25, 305, 665, 26, 306, 665, 27, 307, 665, 28, 308, 665, 29, 301, 665, 30, 302, 665, 31, 303, 665, 32, 304, 665, 0, 267, 665, 1, 268, 665, 2, 269, 665, 3, 270, 665, 4, 271, 665, 5, 272, 665, 6, 273, 665, 7, 274, 665, 8, 275, 665, 9, 276, 665, 10, 277, 665, 11, 278, 665, 12, 279, 665, 13, 280, 665, 14, 281, 665, 15, 282, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 265, 1, 1, 0, 146, 0, 17, 0, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 1, 9814671409, 265, 1, 0, 0, 6652166365, 371, 9814671409, 265, 1, 0, 477, 1, 8388608, 665, 477, 665, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 489, 665, 2, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 45, 1ULL, 1, 0, 9814671376, 265, 1, 0, 1ULL, 1, 1, 0, 0, 2, 9814671376, 265, 2, 0, 1, 6652166220, 371, 2, 9814671376, 265, 11, 53, 12, 544, 665, 0, 521, 665, 613, 665, 13, 0, 614, 665, 14, 54, 0, 496, 665, 562, 665, 1, 504, 665, 563, 665, 2, 0, 1, 0, 512, 665, 564, 665, 1, 2, 0, 0, 513, 665, 565, 665, 2, 1, 0, 0, 520, 665, 566, 665, 1, 2, 0, 0, 528, 665, 567, 665, 2, 1, 0, 0, 536, 665, 568, 665, 1, 2, 0, 0, 560, 665, 569, 665, 2, 1, 0, 55, 2, 552, 665, 15, 55, 0, 495, 665, 562, 665, 1, 503, 665, 563, 665, 2, 0, 1, 0, 511, 665, 564, 665, 1, 2, 0, 0, 512, 665, 565, 665, 2, 1, 0, 0, 519, 665, 566, 665, 1, 2, 0, 0, 527, 665, 567, 665, 2, 1, 0, 0, 535, 665, 568, 665, 1, 2, 0, 0, 559, 665, 569, 665, 2, 1, 0, 56, 2, 551, 665, 16, 56, 0, 494, 665, 562, 665, 1, 502, 665, 563, 665, 2, 0, 1, 0, 510, 665, 564, 665, 1, 2, 0, 0, 511, 665, 565, 665, 2, 1, 0, 0, 518, 665, 566, 665, 1, 2, 0, 0, 526, 665, 567, 665, 2, 1, 0, 0, 534, 665, 568, 665, 1, 2, 0, 0, 558, 665, 569, 665, 2, 1, 0, 57, 2, 550, 665, 17, 57, 0, 493, 665, 562, 665, 1, 501, 665, 563, 665, 2, 0, 1, 0, 509, 665, 564, 665, 1, 2, 0, 0, 510, 665, 565, 665, 2, 1, 0, 0, 517, 665, 566, 665, 1, 2, 0, 0, 525, 665, 567, 665, 2, 1, 0, 0, 533, 665, 568, 665, 1, 2, 0, 0, 557, 665, 569, 665, 2, 1, 0, 58, 2, 549, 665, 18, 58, 0, 492, 665, 562, 665, 1, 500, 665, 563, 665, 2, 0, 1, 0, 508, 665, 564, 665, 1, 2, 0, 0, 509, 665, 565, 665, 2, 1, 0, 0, 516, 665, 566, 665, 1, 2, 0, 0, 524, 665, 567, 665, 2, 1, 0, 0, 532, 665, 568, 665, 1, 2, 0, 0, 556, 665, 569, 665, 2, 1, 0, 59, 2, 548, 665, 19, 59, 0, 491, 665, 562, 665, 1, 499, 665, 563, 665, 2, 0, 1, 0, 507, 665, 564, 665, 1, 2, 0, 0, 508, 665, 565, 665, 2, 1, 0, 0, 515, 665, 566, 665, 1, 2, 0, 0, 523, 665, 567, 665, 2, 1, 0, 0, 531, 665, 568, 665, 1, 2, 0, 0, 555, 665, 569, 665, 2, 1, 0, 60, 2, 547, 665, 20, 60, 0, 490, 665, 562, 665, 1, 498, 665, 563, 665, 2, 0, 1, 0, 506, 665, 564, 665, 1, 2, 0, 0, 507, 665, 565, 665, 2, 1, 0, 0, 514, 665, 566, 665, 1, 2, 0, 0, 522, 665, 567, 665, 2, 1, 0, 0, 530, 665, 568, 665, 1, 2, 0, 0, 554, 665, 569, 665, 2, 1, 0, 61, 2, 546, 665, 21, 61, 2, 442, 665, 0, 448, 665, 443, 665, 1, 0, 459, 665, 0, 1, 1ULL, 1, 459, 665, 3, 6652166203, 371, 4, 6652166204, 371, 5, 6652166205, 371, 6, 6652166206, 371, 7, 6652166207, 371, 8, 6652166208, 371, 9, 6652166209, 371, 10, 6652166210, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 6652166218, 371, 0, 9814671472, 265, 1, 1, 0, 613, 665, 614, 665, 0, 11, 0, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 1, 9814671472, 265, 1, 0, 0, 6652166368, 371, 9814671472, 265, 1, 11, 53, 12, 544, 665, 0, 521, 665, 617, 665, 13, 0, 618, 665, 14, 54, 15, 55, 16, 56, 17, 57, 18, 58, 19, 59, 20, 60, 21, 61, 2, 295, 665, 0, 310, 665, 296, 665, 1, 0, 312, 665, 0, 1, 1ULL, 1, 312, 665, 3, 6652166190, 371, 4, 6652166191, 371, 5, 6652166192, 371, 6, 6652166193, 371, 7, 6652166194, 371, 8, 6652166195, 371, 9, 6652166196, 371, 10, 6652166197, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 6652166219, 371, 0, 9814671475, 265, 1, 1, 0, 617, 665, 618, 665, 0, 11, 0, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 1, 9814671475, 265, 1, 0, 0, 6652166371, 371, 9814671475, 265, 1, 0, 1, 665, 1, 0, 665, 0, 0, 0, 9814671379, 265, 1, 0, 0, 3, 1, 2, 0, 0, 0, 9814671382, 265, 1, 0, 0, 3, 1, 8388608, 1, 2, 1, 8388608, 0, 0, 0, 9814671382, 1, 8388608, 265, 1, 0, 3, 9814671379, 265, 2, 0, 9814671382, 1, 8388608, 265, 3, 1, 9814671382, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166374, 371, 1, 0, 0, 46, 1, 54, 1, 8388608, 665, 2, 3, 1, 8388608, 665, 3, 4, 1, 8388608, 665, 4, 45, 665, 5, 2, 665, 6, 46, 665, 7, 47, 665, 8, 48, 665, 9, 49, 665, 10, 50, 665, 11, 51, 665, 12, 52, 665, 13, 53, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671385, 265, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 265, 13, 0, 0, 46, 1, 8388608, 1, 103, 1, 8388608, 2, 101, 1, 8388608, 3, 102, 1, 8388608, 4, 104, 1, 8388608, 5, 84, 1, 8388608, 6, 93, 1, 8388608, 7, 94, 1, 8388608, 8, 95, 1, 8388608, 9, 96, 1, 8388608, 10, 97, 1, 8388608, 11, 98, 1, 8388608, 12, 99, 1, 8388608, 13, 100, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 1, 8388608, 265, 13, 0, 3, 9814671385, 265, 2, 0, 9814671388, 1, 8388608, 265, 3, 1, 9814671388, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166377, 371, 1, 0, 0, 58, 665, 5, 1, 59, 665, 6, 2, 0, 1, 0, 60, 665, 7, 1, 2, 0, 0, 61, 665, 8, 2, 1, 0, 0, 62, 665, 9, 1, 2, 0, 0, 63, 665, 10, 2, 1, 0, 0, 64, 665, 11, 1, 2, 0, 0, 65, 665, 12, 2, 1, 0, 0, 66, 665, 13, 1, 2, 0, 0, 67, 665, 14, 2, 1, 0, 0, 68, 665, 15, 1, 2, 0, 0, 69, 665, 16, 2, 1, 0, 0, 70, 665, 17, 1, 2, 0, 0, 71, 665, 18, 2, 1, 0, 0, 72, 665, 19, 1, 2, 0, 0, 73, 665, 20, 2, 1, 0, 0, 74, 665, 21, 1, 2, 0, 0, 75, 665, 22, 2, 1, 0, 0, 76, 665, 23, 1, 2, 0, 0, 77, 665, 24, 2, 1, 0, 0, 78, 665, 25, 1, 2, 0, 0, 79, 665, 26, 2, 1, 0, 0, 80, 665, 27, 1, 2, 0, 0, 81, 665, 28, 2, 1, 0, 0, 82, 665, 29, 1, 2, 0, 0, 83, 665, 30, 2, 1, 0, 0, 84, 665, 31, 1, 2, 0, 0, 85, 665, 32, 2, 1, 0, 0, 86, 665, 33, 1, 2, 0, 0, 87, 665, 34, 2, 1, 0, 0, 88, 665, 35, 1, 2, 0, 0, 89, 665, 36, 2, 1, 0, 9814671360, 265, 2, 0, 4, 9814671361, 265, 0, 0, 4, 1, 8388608, 9814671361, 1, 8388608, 265, 0, 3, 9814671360, 265, 2, 0, 9814671361, 1, 8388608, 265, 3, 1, 9814671361, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166380, 371, 1, 0, 0, 90, 665, 5, 1, 91, 665, 6, 2, 0, 1, 0, 92, 665, 7, 1, 2, 0, 0, 93, 665, 8, 2, 1, 0, 0, 94, 665, 9, 1, 2, 0, 0, 95, 665, 10, 2, 1, 0, 0, 96, 665, 11, 1, 2, 0, 0, 97, 665, 12, 2, 1, 0, 0, 98, 665, 13, 1, 2, 0, 0, 99, 665, 14, 2, 1, 0, 0, 100, 665, 15, 1, 2, 0, 0, 101, 665, 16, 2, 1, 0, 0, 102, 665, 17, 1, 2, 0, 0, 103, 665, 18, 2, 1, 0, 0, 104, 665, 19, 1, 2, 0, 0, 105, 665, 20, 2, 1, 0, 0, 106, 665, 21, 1, 2, 0, 0, 107, 665, 22, 2, 1, 0, 0, 108, 665, 23, 1, 2, 0, 0, 109, 665, 24, 2, 1, 0, 0, 110, 665, 25, 1, 2, 0, 0, 111, 665, 26, 2, 1, 0, 0, 112, 665, 27, 1, 2, 0, 0, 113, 665, 28, 2, 1, 0, 0, 114, 665, 29, 1, 2, 0, 0, 115, 665, 30, 2, 1, 0, 0, 116, 665, 31, 1, 2, 0, 0, 117, 665, 32, 2, 1, 0, 0, 118, 665, 33, 1, 2, 0, 0, 119, 665, 34, 2, 1, 0, 0, 120, 665, 35, 1, 2, 0, 0, 121, 665, 36, 2, 1, 0, 9814671362, 265, 2, 0, 4, 9814671363, 265, 0, 0, 4, 1, 8388608, 9814671363, 1, 8388608, 265, 0, 3, 9814671362, 265, 2, 0, 9814671363, 1, 8388608, 265, 3, 1, 9814671363, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166383, 371, 1, 0, 0, 122, 665, 5, 1, 123, 665, 6, 2, 0, 1, 0, 124, 665, 7, 1, 2, 0, 0, 125, 665, 8, 2, 1, 0, 0, 126, 665, 9, 1, 2, 0, 0, 127, 665, 10, 2, 1, 0, 0, 128, 665, 11, 1, 2, 0, 0, 129, 665, 12, 2, 1, 0, 0, 130, 665, 13, 1, 2, 0, 0, 131, 665, 14, 2, 1, 0, 0, 132, 665, 15, 1, 2, 0, 0, 133, 665, 16, 2, 1, 0, 0, 134, 665, 17, 1, 2, 0, 0, 135, 665, 18, 2, 1, 0, 0, 136, 665, 19, 1, 2, 0, 0, 137, 665, 20, 2, 1, 0, 0, 138, 665, 21, 1, 2, 0, 0, 139, 665, 22, 2, 1, 0, 0, 140, 665, 23, 1, 2, 0, 0, 141, 665, 24, 2, 1, 0, 0, 142, 665, 25, 1, 2, 0, 0, 143, 665, 26, 2, 1, 0, 0, 144, 665, 27, 1, 2, 0, 0, 145, 665, 28, 2, 1, 0, 0, 146, 665, 29, 1, 2, 0, 0, 147, 665, 30, 2, 1, 0, 0, 148, 665, 31, 1, 2, 0, 0, 149, 665, 32, 2, 1, 0, 0, 150, 665, 33, 1, 2, 0, 0, 151, 665, 34, 2, 1, 0, 0, 152, 665, 35, 1, 2, 0, 0, 153, 665, 36, 2, 1, 0, 9814671364, 265, 2, 0, 4, 9814671365, 265, 0, 0, 4, 1, 8388608, 9814671365, 1, 8388608, 265, 0, 3, 9814671364, 265, 2, 0, 9814671365, 1, 8388608, 265, 3, 1, 9814671365, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166386, 371, 1, 0, 0, 154, 665, 5, 1, 155, 665, 6, 2, 0, 1, 0, 156, 665, 7, 1, 2, 0, 0, 157, 665, 8, 2, 1, 0, 0, 158, 665, 9, 1, 2, 0, 0, 159, 665, 10, 2, 1, 0, 0, 160, 665, 11, 1, 2, 0, 0, 161, 665, 12, 2, 1, 0, 0, 162, 665, 13, 1, 2, 0, 0, 163, 665, 14, 2, 1, 0, 0, 164, 665, 15, 1, 2, 0, 0, 165, 665, 16, 2, 1, 0, 0, 166, 665, 17, 1, 2, 0, 0, 167, 665, 18, 2, 1, 0, 0, 168, 665, 19, 1, 2, 0, 0, 169, 665, 20, 2, 1, 0, 0, 170, 665, 21, 1, 2, 0, 0, 171, 665, 22, 2, 1, 0, 0, 172, 665, 23, 1, 2, 0, 0, 173, 665, 24, 2, 1, 0, 0, 174, 665, 25, 1, 2, 0, 0, 175, 665, 26, 2, 1, 0, 0, 176, 665, 27, 1, 2, 0, 0, 177, 665, 28, 2, 1, 0, 0, 178, 665, 29, 1, 2, 0, 0, 179, 665, 30, 2, 1, 0, 0, 180, 665, 31, 1, 2, 0, 0, 181, 665, 32, 2, 1, 0, 0, 182, 665, 33, 1, 2, 0, 0, 183, 665, 34, 2, 1, 0, 0, 184, 665, 35, 1, 2, 0, 0, 186, 665, 36, 2, 1, 0, 9814671366, 265, 2, 0, 4, 9814671367, 265, 0, 0, 4, 1, 8388608, 9814671367, 1, 8388608, 265, 0, 3, 9814671366, 265, 2, 0, 9814671367, 1, 8388608, 265, 3, 1, 9814671367, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166389, 371, 1, 0, 0, 34, 35, 3, 0, 36, 0, 187, 665, 5, 1, 188, 665, 6, 2, 0, 1, 0, 189, 665, 7, 1, 2, 0, 0, 190, 665, 8, 2, 1, 0, 0, 191, 665, 9, 1, 2, 0, 0, 192, 665, 10, 2, 1, 0, 0, 193, 665, 11, 1, 2, 0, 0, 194, 665, 12, 2, 1, 0, 0, 195, 665, 13, 1, 2, 0, 0, 196, 665, 14, 2, 1, 0, 0, 197, 665, 15, 1, 2, 0, 0, 198, 665, 16, 2, 1, 0, 0, 199, 665, 17, 1, 2, 0, 0, 200, 665, 18, 2, 1, 0, 0, 202, 665, 19, 1, 2, 0, 0, 203, 665, 20, 2, 1, 0, 0, 204, 665, 21, 1, 2, 0, 0, 205, 665, 22, 2, 1, 0, 0, 206, 665, 23, 1, 2, 0, 0, 207, 665, 24, 2, 1, 0, 0, 208, 665, 25, 1, 2, 0, 0, 209, 665, 26, 2, 1, 0, 0, 210, 665, 27, 1, 2, 0, 0, 211, 665, 28, 2, 1, 0, 0, 212, 665, 29, 1, 2, 0, 0, 213, 665, 30, 2, 1, 0, 0, 214, 665, 31, 1, 2, 0, 0, 215, 665, 32, 2, 1, 0, 0, 216, 665, 33, 1, 2, 0, 0, 185, 665, 34, 2, 1, 0, 0, 201, 665, 35, 1, 2, 0, 0, 217, 665, 36, 2, 1, 0, 0, 3, 0, 9814671391, 265, 2, 0, 0, 106, 1, 105, 0, 0, 0, 9814671394, 265, 1, 0, 0, 106, 1, 8388608, 1, 105, 1, 8388608, 0, 0, 0, 9814671394, 1, 8388608, 265, 1, 0, 3, 9814671391, 265, 2, 0, 9814671394, 1, 8388608, 265, 3, 1, 9814671394, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166392, 371, 1, 0, 0, 225, 665, 9814671368, 265, 0, 0, 107, 9814671369, 265, 0, 0, 107, 1, 8388608, 9814671369, 1, 8388608, 265, 0, 3, 9814671368, 265, 2, 0, 9814671369, 1, 8388608, 265, 3, 1, 9814671369, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166395, 371, 1, 0, 0, 226, 665, 9814671370, 265, 0, 0, 107, 9814671371, 265, 0, 0, 107, 1, 8388608, 9814671371, 1, 8388608, 265, 0, 3, 9814671370, 265, 2, 0, 9814671371, 1, 8388608, 265, 3, 1, 9814671371, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166398, 371, 1, 0, 0, 227, 665, 9814671372, 265, 0, 0, 107, 9814671373, 265, 0, 0, 107, 1, 8388608, 9814671373, 1, 8388608, 265, 0, 3, 9814671372, 265, 2, 0, 9814671373, 1, 8388608, 265, 3, 1, 9814671373, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166401, 371, 1, 0, 0, 0ULL, 1, 258, 665, 2, 228, 665, 3, 230, 665, 4, 259, 665, 5, 0ULL, 6, 232, 665, 7, 260, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671397, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 1, 8388608, 265, 7, 0, 3, 9814671397, 265, 2, 0, 9814671400, 1, 8388608, 265, 3, 1, 9814671400, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166404, 371, 1, 0, 0, 266, 1, 8388608, 665, 265, 1, 8388608, 665, 1, 258, 665, 2, 229, 665, 3, 231, 665, 4, 260, 665, 5, 264, 665, 6, 233, 665, 7, 261, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671403, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 1, 8388608, 265, 7, 0, 3, 9814671403, 265, 2, 0, 9814671406, 1, 8388608, 265, 3, 1, 9814671406, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166407, 371, 1, 0, 0, 294, 665, 9814671374, 265, 0, 0, 2, 9814671375, 265, 0, 0, 2, 1, 8388608, 9814671375, 1, 8388608, 265, 0, 3, 9814671374, 265, 2, 0, 9814671375, 1, 8388608, 265, 3, 1, 9814671375, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166410, 371, 1, 0, 0, 267, 1, 8388608, 665, 1, 268, 1, 8388608, 665, 2, 269, 1, 8388608, 665, 3, 270, 1, 8388608, 665, 4, 271, 1, 8388608, 665, 5, 272, 1, 8388608, 665, 6, 273, 1, 8388608, 665, 7, 274, 1, 8388608, 665, 8, 275, 1, 8388608, 665, 9, 276, 1, 8388608, 665, 10, 277, 1, 8388608, 665, 11, 278, 1, 8388608, 665, 12, 279, 1, 8388608, 665, 13, 280, 1, 8388608, 665, 14, 281, 1, 8388608, 665, 15, 282, 1, 8388608, 665, 16, 123, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 1, 8388608, 265, 1, 1, 3, 6652166365, 371, 2, 0, 9814671409, 1, 8388608, 265, 3, 1, 9814671409, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166413, 371, 1, 0, 0, 311, 665, 1, 314, 665, 2, 315, 665, 3, 316, 665, 4, 317, 665, 5, 318, 665, 6, 319, 665, 7, 320, 665, 8, 321, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671412, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 1, 8388608, 265, 8, 0, 3, 9814671412, 265, 2, 0, 9814671415, 1, 8388608, 265, 3, 1, 9814671415, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166416, 371, 1, 0, 0, 397, 665, 1, 398, 665, 2, 400, 665, 3, 399, 665, 4, 401, 665, 5, 402, 665, 6, 403, 665, 7, 404, 665, 8, 405, 665, 9, 406, 665, 10, 407, 665, 11, 408, 665, 12, 409, 665, 13, 410, 665, 14, 411, 665, 15, 375, 665, 16, 384, 665, 17, 377, 665, 18, 376, 665, 19, 381, 665, 20, 382, 665, 21, 383, 665, 22, 380, 665, 23, 378, 665, 24, 379, 665, 25, 385, 665, 26, 386, 665, 27, 387, 665, 28, 396, 665, 29, 389, 665, 30, 388, 665, 31, 393, 665, 32, 395, 665, 33, 394, 665, 34, 392, 665, 35, 391, 665, 36, 390, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671418, 265, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 265, 36, 0, 0, 148, 1, 8388608, 1, 149, 1, 8388608, 2, 150, 1, 8388608, 3, 151, 1, 8388608, 4, 152, 1, 8388608, 5, 153, 1, 8388608, 6, 154, 1, 8388608, 7, 155, 1, 8388608, 8, 156, 1, 8388608, 9, 157, 1, 8388608, 10, 158, 1, 8388608, 11, 159, 1, 8388608, 12, 160, 1, 8388608, 13, 161, 1, 8388608, 14, 162, 1, 8388608, 15, 163, 1, 8388608, 16, 164, 1, 8388608, 17, 165, 1, 8388608, 18, 166, 1, 8388608, 19, 167, 1, 8388608, 20, 168, 1, 8388608, 21, 169, 1, 8388608, 22, 170, 1, 8388608, 23, 171, 1, 8388608, 24, 172, 1, 8388608, 25, 173, 1, 8388608, 26, 174, 1, 8388608, 27, 175, 1, 8388608, 28, 176, 1, 8388608, 29, 177, 1, 8388608, 30, 178, 1, 8388608, 31, 179, 1, 8388608, 32, 180, 1, 8388608, 33, 181, 1, 8388608, 34, 182, 1, 8388608, 35, 183, 1, 8388608, 36, 184, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 1, 8388608, 265, 36, 0, 3, 9814671418, 265, 2, 0, 9814671421, 1, 8388608, 265, 3, 1, 9814671421, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166419, 371, 1, 0, 0, 188, 1, 414, 665, 2, 418, 665, 3, 422, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671424, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 1, 8388608, 265, 3, 0, 3, 9814671424, 265, 2, 0, 9814671427, 1, 8388608, 265, 3, 1, 9814671427, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166422, 371, 1, 0, 0, 188, 1, 415, 665, 2, 419, 665, 3, 423, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671430, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 1, 8388608, 265, 3, 0, 3, 9814671430, 265, 2, 0, 9814671433, 1, 8388608, 265, 3, 1, 9814671433, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166425, 371, 1, 0, 0, 188, 1, 416, 665, 2, 420, 665, 3, 424, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671436, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 1, 8388608, 265, 3, 0, 3, 9814671436, 265, 2, 0, 9814671439, 1, 8388608, 265, 3, 1, 9814671439, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166428, 371, 1, 0, 0, 188, 1, 417, 665, 2, 421, 665, 3, 425, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671442, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 1, 8388608, 265, 3, 0, 3, 9814671442, 265, 2, 0, 9814671445, 1, 8388608, 265, 3, 1, 9814671445, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166431, 371, 1, 0, 3, 6652166202, 371, 4, 212, 5, 441, 665, 0, 430, 665, 1, 195, 2, 431, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 265, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 9814671451, 265, 1, 0, 0, 9814671448, 265, 9814671451, 265, 1, 0, 430, 1, 8388608, 665, 1, 195, 1, 8388608, 2, 431, 1, 8388608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 1, 8388608, 265, 2, 0, 3, 9814671448, 265, 2, 0, 9814671451, 1, 8388608, 265, 3, 1, 9814671451, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166434, 371, 1, 0, 9, 449, 665, 10, 450, 665, 11, 451, 665, 12, 452, 665, 13, 453, 665, 14, 454, 665, 15, 455, 665, 16, 456, 665, 17, 216, 0, 432, 665, 1, 433, 665, 2, 434, 665, 3, 435, 665, 4, 436, 665, 5, 437, 665, 6, 438, 665, 7, 439, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 265, 8, 0, 0, 6652166201, 371, 0, 9, 0, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 1, 9814671457, 265, 1, 0, 0, 9814671454, 265, 9814671457, 265, 1, 0, 432, 1, 8388608, 665, 1, 433, 1, 8388608, 665, 2, 434, 1, 8388608, 665, 3, 435, 1, 8388608, 665, 4, 436, 1, 8388608, 665, 5, 437, 1, 8388608, 665, 6, 438, 1, 8388608, 665, 7, 439, 1, 8388608, 665, 8, 196, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 1, 8388608, 265, 8, 0, 3, 9814671454, 265, 2, 0, 9814671457, 1, 8388608, 265, 3, 1, 9814671457, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166437, 371, 1, 0, 0, 458, 665, 1, 461, 665, 2, 462, 665, 3, 463, 665, 4, 464, 665, 5, 465, 665, 6, 466, 665, 7, 467, 665, 8, 468, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671460, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 1, 8388608, 265, 8, 0, 3, 9814671460, 265, 2, 0, 9814671463, 1, 8388608, 265, 3, 1, 9814671463, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166440, 371, 1, 0, 0, 641, 665, 9814671377, 265, 0, 0, 45, 9814671378, 265, 0, 0, 45, 1, 8388608, 9814671378, 1, 8388608, 265, 0, 3, 9814671377, 265, 2, 0, 9814671378, 1, 8388608, 265, 3, 1, 9814671378, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166443, 371, 1, 0, 3, 553, 665, 4, 552, 665, 5, 551, 665, 6, 550, 665, 7, 549, 665, 8, 548, 665, 9, 547, 665, 10, 546, 665, 11, 562, 665, 12, 563, 665, 13, 564, 665, 14, 565, 665, 15, 566, 665, 16, 567, 665, 17, 568, 665, 18, 569, 665, 19, 570, 665, 20, 571, 665, 21, 572, 665, 22, 573, 665, 23, 576, 665, 24, 574, 665, 25, 575, 665, 26, 577, 665, 27, 634, 665, 28, 635, 665, 29, 637, 665, 30, 636, 665, 31, 639, 665, 32, 638, 665, 0, 1ULL, 607, 665, 1, 2ULL, 608, 665, 2, 0, 1, 0, 4ULL, 609, 665, 1, 2, 0, 0, 8ULL, 623, 665, 2, 1, 0, 0, 16ULL, 621, 665, 1, 2, 0, 0, 32ULL, 613, 665, 2, 1, 0, 0, 64ULL, 616, 665, 1, 2, 0, 0, 128ULL, 615, 665, 2, 1, 0, 0, 256ULL, 617, 665, 1, 2, 0, 0, 512ULL, 620, 665, 2, 1, 0, 0, 1024ULL, 619, 665, 1, 2, 0, 0, 2048ULL, 599, 665, 2, 1, 0, 0, 4096ULL, 600, 665, 1, 2, 0, 0, 8192ULL, 598, 665, 2, 1, 0, 0, 16384ULL, 597, 665, 1, 2, 0, 0, 32768ULL, 591, 665, 2, 1, 0, 0, 65536ULL, 593, 665, 1, 2, 0, 0, 131072ULL, 592, 665, 2, 1, 0, 0, 262144ULL, 610, 665, 1, 2, 0, 0, 524288ULL, 611, 665, 2, 1, 0, 0, 1048576ULL, 612, 665, 1, 2, 0, 0, 2097152ULL, 603, 665, 2, 1, 0, 0, 4194304ULL, 604, 665, 1, 2, 0, 0, 8388608ULL, 624, 665, 2, 1, 0, 0, 16777216ULL, 578, 665, 1, 2, 0, 0, 33554432ULL, 579, 665, 2, 1, 0, 0, 67108864ULL, 580, 665, 1, 2, 0, 0, 134217728ULL, 584, 665, 2, 1, 0, 0, 268435456ULL, 581, 665, 1, 2, 0, 0, 536870912ULL, 582, 665, 2, 1, 0, 0, 1073741824ULL, 587, 665, 1, 2, 0, 0, 2147483648ULL, 589, 665, 2, 1, 0, 0, 4294967296ULL, 586, 665, 1, 2, 0, 0, 8589934592ULL, 590, 665, 2, 1, 0, 0, 17179869184ULL, 588, 665, 1, 2, 0, 0, 34359738368ULL, 585, 665, 2, 1, 0, 0, 68719476736ULL, 583, 665, 1, 2, 0, 0, 137438953472ULL, 606, 665, 2, 1, 0, 0, 274877906944ULL, 605, 665, 1, 2, 0, 0, 549755813888ULL, 601, 665, 2, 1, 0, 0, 1099511627776ULL, 655, 665, 1, 2, 0, 0, 2199023255552ULL, 594, 665, 2, 1, 0, 0, 4398046511104ULL, 625, 665, 1, 2, 0, 0, 8796093022208ULL, 626, 665, 2, 1, 0, 0, 17592186044416ULL, 614, 665, 1, 2, 0, 0, 35184372088832ULL, 618, 665, 2, 1, 0, 0, 70368744177664ULL, 656, 665, 1, 2, 0, 0, 1, 1, 595, 665, 2, 596, 665, 33, 622, 665, 34, 653, 665, 35, 654, 665, 36, 542, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671466, 265, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 265, 36, 0, 0, 47, 1, 8388608, 1, 48, 1, 8388608, 2, 49, 1, 8388608, 3, 50, 1, 8388608, 4, 51, 1, 8388608, 5, 52, 1, 8388608, 6, 53, 1, 8388608, 7, 54, 1, 8388608, 8, 56, 1, 8388608, 9, 57, 1, 8388608, 10, 58, 1, 8388608, 11, 59, 1, 8388608, 12, 60, 1, 8388608, 13, 61, 1, 8388608, 14, 62, 1, 8388608, 15, 63, 1, 8388608, 16, 64, 1, 8388608, 17, 65, 1, 8388608, 18, 66, 1, 8388608, 19, 67, 1, 8388608, 20, 68, 1, 8388608, 21, 69, 1, 8388608, 22, 70, 1, 8388608, 23, 71, 1, 8388608, 24, 72, 1, 8388608, 25, 73, 1, 8388608, 26, 74, 1, 8388608, 27, 75, 1, 8388608, 28, 76, 1, 8388608, 29, 77, 1, 8388608, 30, 83, 1, 8388608, 31, 55, 1, 8388608, 32, 78, 1, 8388608, 33, 79, 1, 8388608, 34, 80, 1, 8388608, 35, 81, 1, 8388608, 36, 82, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 1, 8388608, 265, 36, 0, 3, 9814671466, 265, 2, 0, 9814671469, 1, 8388608, 265, 3, 1, 9814671469, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166446, 371, 1, 0, 3, 442, 1, 8388608, 665, 0, 448, 1, 8388608, 665, 443, 1, 8388608, 665, 1, 0, 459, 1, 8388608, 665, 4, 1, 1ULL, 5, 459, 1, 8388608, 665, 0, 443, 1, 8388608, 665, 444, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 445, 1, 8388608, 665, 6652166200, 1, 8388608, 371, 213, 1, 8388608, 0, 0, 2, 445, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 440, 1, 8388608, 665, 1, 0, 2, 0, 6652166200, 1, 8388608, 371, 128ULL, 6652166202, 1, 8388608, 371, 1, 0, 0, 461, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166203, 1, 8388608, 371, 0, 469, 1, 8388608, 665, 2, 6652166203, 1, 8388608, 371, 0, 462, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166204, 1, 8388608, 371, 0, 470, 1, 8388608, 665, 6, 6652166204, 1, 8388608, 371, 0, 463, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166205, 1, 8388608, 371, 0, 471, 1, 8388608, 665, 7, 6652166205, 1, 8388608, 371, 0, 464, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166206, 1, 8388608, 371, 0, 472, 1, 8388608, 665, 8, 6652166206, 1, 8388608, 371, 0, 465, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166207, 1, 8388608, 371, 0, 473, 1, 8388608, 665, 9, 6652166207, 1, 8388608, 371, 0, 466, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166208, 1, 8388608, 371, 0, 474, 1, 8388608, 665, 10, 6652166208, 1, 8388608, 371, 0, 467, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166209, 1, 8388608, 371, 0, 475, 1, 8388608, 665, 11, 6652166209, 1, 8388608, 371, 0, 468, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166210, 1, 8388608, 371, 0, 476, 1, 8388608, 665, 12, 6652166210, 1, 8388608, 371, 0, 458, 1, 8388608, 665, 460, 1, 8388608, 665, 1, 1ULL, 0, 6652166218, 1, 8388608, 371, 215, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 1, 8388608, 371, 0, 9814671472, 1, 8388608, 265, 1, 1, 3, 6652166368, 371, 2, 0, 9814671472, 1, 8388608, 265, 3, 1, 9814671472, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166449, 371, 1, 0, 3, 295, 1, 8388608, 665, 0, 310, 1, 8388608, 665, 296, 1, 8388608, 665, 1, 0, 312, 1, 8388608, 665, 4, 1, 1ULL, 5, 312, 1, 8388608, 665, 0, 296, 1, 8388608, 665, 297, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 298, 1, 8388608, 665, 6652166188, 1, 8388608, 371, 146, 1, 8388608, 0, 0, 2, 298, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 294, 1, 8388608, 665, 1, 0, 2, 0, 6652166188, 1, 8388608, 371, 128ULL, 6652166189, 1, 8388608, 371, 1, 0, 0, 314, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166190, 1, 8388608, 371, 0, 322, 1, 8388608, 665, 2, 6652166190, 1, 8388608, 371, 0, 315, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166191, 1, 8388608, 371, 0, 323, 1, 8388608, 665, 6, 6652166191, 1, 8388608, 371, 0, 316, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166192, 1, 8388608, 371, 0, 324, 1, 8388608, 665, 7, 6652166192, 1, 8388608, 371, 0, 317, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166193, 1, 8388608, 371, 0, 325, 1, 8388608, 665, 8, 6652166193, 1, 8388608, 371, 0, 318, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166194, 1, 8388608, 371, 0, 326, 1, 8388608, 665, 9, 6652166194, 1, 8388608, 371, 0, 319, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166195, 1, 8388608, 371, 0, 327, 1, 8388608, 665, 10, 6652166195, 1, 8388608, 371, 0, 320, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166196, 1, 8388608, 371, 0, 328, 1, 8388608, 665, 11, 6652166196, 1, 8388608, 371, 0, 321, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166197, 1, 8388608, 371, 0, 329, 1, 8388608, 665, 12, 6652166197, 1, 8388608, 371, 0, 311, 1, 8388608, 665, 313, 1, 8388608, 665, 1, 1ULL, 0, 6652166219, 1, 8388608, 371, 147, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 1, 8388608, 371, 0, 9814671475, 1, 8388608, 265, 1, 1, 3, 6652166371, 371, 2, 0, 9814671475, 1, 8388608, 265, 3, 1, 9814671475, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166452, 371, 1, 0, 3, 0ULL, 4, 0ULL, 5, 1ULL, 6, 334, 665, 7, 335, 665, 8, 336, 665, 9, 337, 665, 10, 338, 665, 11, 339, 665, 12, 340, 665, 13, 341, 665, 14, 398, 665, 15, 0ULL, 16, 0ULL, 17, 0ULL, 18, 37, 0, 376, 665, 343, 665, 1, 377, 665, 347, 665, 2, 0, 1, 0, 378, 665, 351, 665, 1, 2, 0, 0, 379, 665, 355, 665, 2, 1, 0, 0, 380, 665, 359, 665, 1, 2, 0, 0, 383, 665, 367, 665, 2, 1, 0, 0, 381, 665, 363, 665, 1, 2, 0, 0, 384, 665, 331, 665, 2, 1, 0, 0, 385, 665, 354, 665, 1, 2, 0, 0, 1, 408, 665, 19, 0, 0, 376, 665, 344, 665, 1, 377, 665, 348, 665, 2, 0, 1, 0, 378, 665, 352, 665, 1, 2, 0, 0, 379, 665, 356, 665, 2, 1, 0, 0, 380, 665, 360, 665, 1, 2, 0, 0, 383, 665, 368, 665, 2, 1, 0, 0, 381, 665, 364, 665, 1, 2, 0, 0, 384, 665, 332, 665, 2, 1, 0, 0, 385, 665, 355, 665, 1, 2, 0, 0, 1, 409, 665, 20, 0, 0, 376, 665, 345, 665, 1, 377, 665, 349, 665, 2, 0, 1, 0, 378, 665, 353, 665, 1, 2, 0, 0, 379, 665, 357, 665, 2, 1, 0, 0, 380, 665, 361, 665, 1, 2, 0, 0, 383, 665, 369, 665, 2, 1, 0, 0, 381, 665, 365, 665, 1, 2, 0, 0, 384, 665, 333, 665, 2, 1, 0, 0, 385, 665, 356, 665, 1, 2, 0, 0, 1, 410, 665, 1, 0, 0, 397, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 6652166455, 371, 0, 3, 0, 54, 1, 55, 2, 56, 3, 57, 4, 58, 5, 59, 6, 60, 7, 61, 8, 605, 665, 620, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 6652166458, 371, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 0ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 54, 37, 55, 38, 56, 39, 57, 40, 58, 41, 59, 42, 60, 43, 61, 44, 607, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 6652166461, 371, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 54, 45, 55, 46, 56, 47, 57, 48, 58, 49, 59, 50, 60, 51, 61, 52, 608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166464, 371, 0, 3, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 497, 665, 21, 496, 665, 22, 495, 665, 23, 494, 665, 24, 493, 665, 25, 492, 665, 26, 491, 665, 27, 490, 665, 28, 505, 665, 29, 504, 665, 30, 503, 665, 31, 502, 665, 32, 501, 665, 33, 500, 665, 34, 499, 665, 35, 498, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 54, 45, 55, 46, 56, 47, 57, 48, 58, 49, 59, 50, 60, 51, 61, 52, 609, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166467, 371, 0, 3, 0, 622, 665, 1, 497, 665, 2, 496, 665, 3, 495, 665, 4, 494, 665, 5, 493, 665, 6, 492, 665, 7, 491, 665, 8, 490, 665, 9, 505, 665, 10, 504, 665, 11, 503, 665, 12, 502, 665, 13, 501, 665, 14, 500, 665, 15, 499, 665, 16, 498, 665, 17, 54, 18, 55, 19, 56, 20, 57, 21, 58, 22, 59, 23, 60, 24, 61, 25, 602, 665, 26, 621, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 6652166470, 371, 0, 3, 0, 53, 1, 54, 2, 615, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166473, 371, 0, 3, 0, 53, 1, 54, 2, 55, 3, 56, 4, 57, 5, 58, 6, 59, 7, 60, 8, 61, 9, 640, 665, 10, 616, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 6652166476, 371, 0, 3, 0, 53, 1, 54, 2, 619, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166479, 371, 0, 3, 1, 53, 0, 4294967296ULL, 55, 2, 54, 0, 0, 4294967296ULL, 57, 3, 56, 0, 0, 4294967296ULL, 59, 4, 58, 0, 0, 4294967296ULL, 61, 5, 60, 0, 0, 640, 665, 6, 620, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 6652166482, 371, 0, 3, 0, 53, 1, 45, 2, 604, 665, 3, 54, 4, 55, 5, 56, 6, 57, 7, 58, 8, 59, 9, 60, 10, 61, 11, 603, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 6652166485, 371, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 0, 661, 665, 5, 662, 665, 6, 663, 665, 7, 664, 665, 8, 54, 9, 55, 10, 56, 11, 57, 12, 58, 13, 59, 14, 60, 15, 61, 16, 640, 665, 17, 606, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 6652166488, 371, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 5, 661, 665, 6, 662, 665, 7, 663, 665, 8, 664, 665, 9, 521, 665, 10, 520, 665, 11, 519, 665, 12, 518, 665, 13, 517, 665, 14, 516, 665, 15, 515, 665, 16, 514, 665, 0, 4294967296ULL, 55, 17, 54, 0, 0, 4294967296ULL, 57, 18, 56, 0, 0, 4294967296ULL, 59, 19, 58, 0, 0, 4294967296ULL, 61, 20, 60, 0, 0, 640, 665, 21, 605, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 6652166491, 371, 0, 3, 0, 0ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 54, 19, 55, 20, 56, 21, 57, 22, 58, 23, 59, 24, 60, 25, 61, 26, 513, 665, 27, 610, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166494, 371, 0, 3, 0, 1ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 54, 19, 55, 20, 56, 21, 57, 22, 58, 23, 59, 24, 60, 25, 61, 26, 513, 665, 27, 521, 665, 28, 520, 665, 29, 519, 665, 30, 518, 665, 31, 517, 665, 32, 516, 665, 33, 515, 665, 34, 514, 665, 35, 529, 665, 36, 528, 665, 37, 527, 665, 38, 526, 665, 39, 525, 665, 40, 524, 665, 41, 523, 665, 42, 522, 665, 43, 611, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 6652166497, 371, 0, 3, 0, 0ULL, 1, 1ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 54, 11, 55, 12, 56, 13, 57, 14, 58, 15, 59, 16, 60, 17, 61, 18, 513, 665, 19, 521, 665, 20, 520, 665, 21, 519, 665, 22, 518, 665, 23, 517, 665, 24, 516, 665, 25, 515, 665, 26, 514, 665, 27, 612, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166500, 371, 0, 3, 0, 8589934592ULL, 417, 665, 1, 4194304ULL, 416, 665, 2, 0, 1, 0, 2048ULL, 415, 665, 1, 2, 0, 0, 1, 414, 665, 3, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 8589934592ULL, 421, 665, 1, 4194304ULL, 420, 665, 2, 0, 1, 0, 2048ULL, 419, 665, 1, 2, 0, 0, 1, 418, 665, 4, 0, 0, 12275445934081160404ULL, 3, 1, 0, 0, 4, 1, 1, 0, 2, 3, 2, 1, 0, 8589934592ULL, 425, 665, 1, 4194304ULL, 424, 665, 2, 0, 1, 0, 2048ULL, 423, 665, 1, 2, 0, 0, 1, 422, 665, 1, 0, 0, 4756475762779100925ULL, 3, 1, 0, 0, 1, 1, 1, 0, 2, 6652166503, 371, 3, 1, 0, 185, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 186, 0, 0, 3, 1, 4, 0, 0, 1, 2, 3, 2, 0, 0, 187, 0, 0, 3, 1, 1, 0, 0, 1, 2, 6652166506, 371, 3, 0, 1, 429, 665, 0, 3, 1, 1, 0, 2, 1, 2, 0, 12275445934081160404ULL, 3, 1, 0, 0, 6652166199, 371, 1, 1, 0, 2, 3, 2, 1, 2, 426, 665, 0, 4756475762779100925ULL, 3, 1, 0, 0, 2, 1, 1, 0, 2, 6652166509, 371, 3, 1, 0, 209, 0, 0, 3, 1, 1, 0, 2, 1, 2, 0, 210, 0, 0, 3, 1, 6652166199, 371, 0, 0, 1, 2, 3, 2, 0, 0, 211, 0, 0, 3, 1, 2, 0, 0, 1, 2, 6652166512, 371, 3, 0};
@@ -4,7 +4,7 @@
 #define NTEMP3_ 4
 
 
-uint64_t op3prev[NOPS_] = { 79, 79, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 81, 79, 79, 79, 79, 81, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 5, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 90, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 79, 82, 79, 79, 82, 79, 59, 12, 70, 88, 82, 59, 12, 70, 12, 44, 61, 89, 80, 83, 80, 59, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 1, 96, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 35, 35, 21, 47, 35, 0, 10, 78, 100, 32, 78, 22, 45, 87, 11, 78, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 50, 50, 0, 1, 50, 46, 53, 0, 50, 0, 53, 0, 0, 78, 79, 50, 1, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 54, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 79, 79, 79, 59, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 79, 79, 79, 59, 12, 43, 61, 18, 90, 78, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 82, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 79, 79, 79, 79, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 79, 79, 79, 79, 79, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 81, 81, 81, 81, 81, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 53, 0, 53, 0, 1, 78, 67, 12, 18, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 71, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 59, 12, 18, 98, 79, 67, 12, 18, 53, 56, 24, 47, 1, 100, 66, 68, 15, 18, 71, 79, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 59, 12, 18, 98};
+inline uint64_t op3prev[NOPS_] = { 79, 79, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 88, 82, 82, 59, 88, 83, 83, 59, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 81, 79, 79, 79, 79, 81, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 5, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 54, 1, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 90, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 82, 79, 79, 79, 59, 12, 70, 12, 70, 88, 82, 82, 82, 82, 59, 12, 70, 12, 70, 88, 83, 83, 83, 83, 59, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 50, 27, 1, 96, 1, 27, 56, 0, 53, 86, 79, 82, 79, 79, 82, 79, 59, 12, 70, 88, 82, 59, 12, 70, 12, 44, 61, 89, 80, 83, 80, 59, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 1, 96, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 35, 35, 21, 47, 35, 0, 10, 78, 100, 32, 78, 22, 45, 87, 11, 78, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 100, 82, 100, 83, 113, 16, 63, 15, 13, 70, 17, 71, 13, 98, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 98, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 88, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 103, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 50, 50, 0, 1, 50, 46, 53, 0, 50, 0, 53, 0, 0, 78, 79, 50, 1, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 54, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 87, 79, 50, 27, 96, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 64, 90, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 44, 61, 89, 80, 38, 23, 2, 80, 52, 27, 84, 111, 84, 27, 57, 0, 85, 101, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 114, 80, 52, 27, 111, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 65, 105, 20, 73, 19, 13, 70, 17, 71, 13, 98, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 98, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 50, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0, 1, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 79, 79, 79, 59, 12, 43, 61, 18, 90, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 78, 79, 59, 12, 43, 61, 18, 90, 79, 79, 79, 59, 12, 43, 61, 18, 90, 78, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 78, 82, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 79, 79, 79, 79, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 81, 79, 79, 79, 79, 79, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 4, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 81, 81, 81, 81, 81, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 70, 12, 43, 61, 18, 90, 53, 53, 0, 53, 0, 1, 78, 67, 12, 18, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 71, 53, 53, 0, 53, 0, 1, 78, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 59, 12, 18, 98, 79, 67, 12, 18, 53, 56, 24, 47, 1, 100, 66, 68, 15, 18, 71, 79, 66, 68, 12, 18, 98, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 59, 12, 18, 98};
 
 
-uint64_t args3prev[NARGS_] = { 0, 1, 665, 1, 0, 665, 0, 0, 0, 9814671379, 265, 1, 0, 0, 3, 1, 2, 0, 0, 0, 9814671382, 265, 1, 0, 0, 3, 1, 8388608, 1, 2, 1, 8388608, 0, 0, 0, 9814671382, 1, 8388608, 265, 1, 0, 3, 9814671379, 265, 2, 0, 9814671382, 1, 8388608, 265, 3, 1, 9814671382, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166374, 371, 1, 0, 0, 5578424343, 128, 3, 1, 5578424340, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424340, 1, 8388608, 128, 3, 1, 5578424343, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671478, 265, 3, 0, 0, 46, 1, 54, 1, 8388608, 665, 2, 3, 1, 8388608, 665, 3, 4, 1, 8388608, 665, 4, 45, 665, 5, 2, 665, 6, 46, 665, 7, 47, 665, 8, 48, 665, 9, 49, 665, 10, 50, 665, 11, 51, 665, 12, 52, 665, 13, 53, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671385, 265, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 265, 13, 0, 0, 46, 1, 8388608, 1, 103, 1, 8388608, 2, 101, 1, 8388608, 3, 102, 1, 8388608, 4, 104, 1, 8388608, 5, 84, 1, 8388608, 6, 93, 1, 8388608, 7, 94, 1, 8388608, 8, 95, 1, 8388608, 9, 96, 1, 8388608, 10, 97, 1, 8388608, 11, 98, 1, 8388608, 12, 99, 1, 8388608, 13, 100, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 1, 8388608, 265, 13, 0, 3, 9814671385, 265, 2, 0, 9814671388, 1, 8388608, 265, 3, 1, 9814671388, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166377, 371, 1, 0, 0, 5578424349, 128, 3, 1, 5578424346, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424346, 1, 8388608, 128, 3, 1, 5578424349, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671481, 265, 3, 0, 0, 58, 665, 5, 1, 59, 665, 6, 2, 0, 1, 0, 60, 665, 7, 1, 2, 0, 0, 61, 665, 8, 2, 1, 0, 0, 62, 665, 9, 1, 2, 0, 0, 63, 665, 10, 2, 1, 0, 0, 64, 665, 11, 1, 2, 0, 0, 65, 665, 12, 2, 1, 0, 0, 66, 665, 13, 1, 2, 0, 0, 67, 665, 14, 2, 1, 0, 0, 68, 665, 15, 1, 2, 0, 0, 69, 665, 16, 2, 1, 0, 0, 70, 665, 17, 1, 2, 0, 0, 71, 665, 18, 2, 1, 0, 0, 72, 665, 19, 1, 2, 0, 0, 73, 665, 20, 2, 1, 0, 0, 74, 665, 21, 1, 2, 0, 0, 75, 665, 22, 2, 1, 0, 0, 76, 665, 23, 1, 2, 0, 0, 77, 665, 24, 2, 1, 0, 0, 78, 665, 25, 1, 2, 0, 0, 79, 665, 26, 2, 1, 0, 0, 80, 665, 27, 1, 2, 0, 0, 81, 665, 28, 2, 1, 0, 0, 82, 665, 29, 1, 2, 0, 0, 83, 665, 30, 2, 1, 0, 0, 84, 665, 31, 1, 2, 0, 0, 85, 665, 32, 2, 1, 0, 0, 86, 665, 33, 1, 2, 0, 0, 87, 665, 34, 2, 1, 0, 0, 88, 665, 35, 1, 2, 0, 0, 89, 665, 36, 2, 1, 0, 9814671360, 265, 2, 0, 4, 9814671361, 265, 0, 0, 4, 1, 8388608, 9814671361, 1, 8388608, 265, 0, 3, 9814671360, 265, 2, 0, 9814671361, 1, 8388608, 265, 3, 1, 9814671361, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166380, 371, 1, 0, 0, 5578424321, 128, 3, 1, 5578424320, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424320, 1, 8388608, 128, 3, 1, 5578424321, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671484, 265, 3, 0, 0, 90, 665, 5, 1, 91, 665, 6, 2, 0, 1, 0, 92, 665, 7, 1, 2, 0, 0, 93, 665, 8, 2, 1, 0, 0, 94, 665, 9, 1, 2, 0, 0, 95, 665, 10, 2, 1, 0, 0, 96, 665, 11, 1, 2, 0, 0, 97, 665, 12, 2, 1, 0, 0, 98, 665, 13, 1, 2, 0, 0, 99, 665, 14, 2, 1, 0, 0, 100, 665, 15, 1, 2, 0, 0, 101, 665, 16, 2, 1, 0, 0, 102, 665, 17, 1, 2, 0, 0, 103, 665, 18, 2, 1, 0, 0, 104, 665, 19, 1, 2, 0, 0, 105, 665, 20, 2, 1, 0, 0, 106, 665, 21, 1, 2, 0, 0, 107, 665, 22, 2, 1, 0, 0, 108, 665, 23, 1, 2, 0, 0, 109, 665, 24, 2, 1, 0, 0, 110, 665, 25, 1, 2, 0, 0, 111, 665, 26, 2, 1, 0, 0, 112, 665, 27, 1, 2, 0, 0, 113, 665, 28, 2, 1, 0, 0, 114, 665, 29, 1, 2, 0, 0, 115, 665, 30, 2, 1, 0, 0, 116, 665, 31, 1, 2, 0, 0, 117, 665, 32, 2, 1, 0, 0, 118, 665, 33, 1, 2, 0, 0, 119, 665, 34, 2, 1, 0, 0, 120, 665, 35, 1, 2, 0, 0, 121, 665, 36, 2, 1, 0, 9814671362, 265, 2, 0, 4, 9814671363, 265, 0, 0, 4, 1, 8388608, 9814671363, 1, 8388608, 265, 0, 3, 9814671362, 265, 2, 0, 9814671363, 1, 8388608, 265, 3, 1, 9814671363, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166383, 371, 1, 0, 0, 5578424323, 128, 3, 1, 5578424322, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424322, 1, 8388608, 128, 3, 1, 5578424323, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671487, 265, 3, 0, 0, 122, 665, 5, 1, 123, 665, 6, 2, 0, 1, 0, 124, 665, 7, 1, 2, 0, 0, 125, 665, 8, 2, 1, 0, 0, 126, 665, 9, 1, 2, 0, 0, 127, 665, 10, 2, 1, 0, 0, 128, 665, 11, 1, 2, 0, 0, 129, 665, 12, 2, 1, 0, 0, 130, 665, 13, 1, 2, 0, 0, 131, 665, 14, 2, 1, 0, 0, 132, 665, 15, 1, 2, 0, 0, 133, 665, 16, 2, 1, 0, 0, 134, 665, 17, 1, 2, 0, 0, 135, 665, 18, 2, 1, 0, 0, 136, 665, 19, 1, 2, 0, 0, 137, 665, 20, 2, 1, 0, 0, 138, 665, 21, 1, 2, 0, 0, 139, 665, 22, 2, 1, 0, 0, 140, 665, 23, 1, 2, 0, 0, 141, 665, 24, 2, 1, 0, 0, 142, 665, 25, 1, 2, 0, 0, 143, 665, 26, 2, 1, 0, 0, 144, 665, 27, 1, 2, 0, 0, 145, 665, 28, 2, 1, 0, 0, 146, 665, 29, 1, 2, 0, 0, 147, 665, 30, 2, 1, 0, 0, 148, 665, 31, 1, 2, 0, 0, 149, 665, 32, 2, 1, 0, 0, 150, 665, 33, 1, 2, 0, 0, 151, 665, 34, 2, 1, 0, 0, 152, 665, 35, 1, 2, 0, 0, 153, 665, 36, 2, 1, 0, 9814671364, 265, 2, 0, 4, 9814671365, 265, 0, 0, 4, 1, 8388608, 9814671365, 1, 8388608, 265, 0, 3, 9814671364, 265, 2, 0, 9814671365, 1, 8388608, 265, 3, 1, 9814671365, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166386, 371, 1, 0, 0, 5578424325, 128, 3, 1, 5578424324, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424324, 1, 8388608, 128, 3, 1, 5578424325, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671490, 265, 3, 0, 0, 154, 665, 5, 1, 155, 665, 6, 2, 0, 1, 0, 156, 665, 7, 1, 2, 0, 0, 157, 665, 8, 2, 1, 0, 0, 158, 665, 9, 1, 2, 0, 0, 159, 665, 10, 2, 1, 0, 0, 160, 665, 11, 1, 2, 0, 0, 161, 665, 12, 2, 1, 0, 0, 162, 665, 13, 1, 2, 0, 0, 163, 665, 14, 2, 1, 0, 0, 164, 665, 15, 1, 2, 0, 0, 165, 665, 16, 2, 1, 0, 0, 166, 665, 17, 1, 2, 0, 0, 167, 665, 18, 2, 1, 0, 0, 168, 665, 19, 1, 2, 0, 0, 169, 665, 20, 2, 1, 0, 0, 170, 665, 21, 1, 2, 0, 0, 171, 665, 22, 2, 1, 0, 0, 172, 665, 23, 1, 2, 0, 0, 173, 665, 24, 2, 1, 0, 0, 174, 665, 25, 1, 2, 0, 0, 175, 665, 26, 2, 1, 0, 0, 176, 665, 27, 1, 2, 0, 0, 177, 665, 28, 2, 1, 0, 0, 178, 665, 29, 1, 2, 0, 0, 179, 665, 30, 2, 1, 0, 0, 180, 665, 31, 1, 2, 0, 0, 181, 665, 32, 2, 1, 0, 0, 182, 665, 33, 1, 2, 0, 0, 183, 665, 34, 2, 1, 0, 0, 184, 665, 35, 1, 2, 0, 0, 186, 665, 36, 2, 1, 0, 9814671366, 265, 2, 0, 4, 9814671367, 265, 0, 0, 4, 1, 8388608, 9814671367, 1, 8388608, 265, 0, 3, 9814671366, 265, 2, 0, 9814671367, 1, 8388608, 265, 3, 1, 9814671367, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166389, 371, 1, 0, 0, 5578424327, 128, 3, 1, 5578424326, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424326, 1, 8388608, 128, 3, 1, 5578424327, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671493, 265, 3, 0, 0, 34, 35, 3, 0, 36, 0, 187, 665, 5, 1, 188, 665, 6, 2, 0, 1, 0, 189, 665, 7, 1, 2, 0, 0, 190, 665, 8, 2, 1, 0, 0, 191, 665, 9, 1, 2, 0, 0, 192, 665, 10, 2, 1, 0, 0, 193, 665, 11, 1, 2, 0, 0, 194, 665, 12, 2, 1, 0, 0, 195, 665, 13, 1, 2, 0, 0, 196, 665, 14, 2, 1, 0, 0, 197, 665, 15, 1, 2, 0, 0, 198, 665, 16, 2, 1, 0, 0, 199, 665, 17, 1, 2, 0, 0, 200, 665, 18, 2, 1, 0, 0, 202, 665, 19, 1, 2, 0, 0, 203, 665, 20, 2, 1, 0, 0, 204, 665, 21, 1, 2, 0, 0, 205, 665, 22, 2, 1, 0, 0, 206, 665, 23, 1, 2, 0, 0, 207, 665, 24, 2, 1, 0, 0, 208, 665, 25, 1, 2, 0, 0, 209, 665, 26, 2, 1, 0, 0, 210, 665, 27, 1, 2, 0, 0, 211, 665, 28, 2, 1, 0, 0, 212, 665, 29, 1, 2, 0, 0, 213, 665, 30, 2, 1, 0, 0, 214, 665, 31, 1, 2, 0, 0, 215, 665, 32, 2, 1, 0, 0, 216, 665, 33, 1, 2, 0, 0, 185, 665, 34, 2, 1, 0, 0, 201, 665, 35, 1, 2, 0, 0, 217, 665, 36, 2, 1, 0, 0, 3, 0, 9814671391, 265, 2, 0, 0, 106, 1, 105, 0, 0, 0, 9814671394, 265, 1, 0, 0, 106, 1, 8388608, 1, 105, 1, 8388608, 0, 0, 0, 9814671394, 1, 8388608, 265, 1, 0, 3, 9814671391, 265, 2, 0, 9814671394, 1, 8388608, 265, 3, 1, 9814671394, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166392, 371, 1, 0, 0, 5578424355, 128, 3, 1, 5578424352, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424352, 1, 8388608, 128, 3, 1, 5578424355, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671496, 265, 3, 0, 0, 225, 665, 9814671368, 265, 0, 0, 107, 9814671369, 265, 0, 0, 107, 1, 8388608, 9814671369, 1, 8388608, 265, 0, 3, 9814671368, 265, 2, 0, 9814671369, 1, 8388608, 265, 3, 1, 9814671369, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166395, 371, 1, 0, 0, 5578424329, 128, 3, 1, 5578424328, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424328, 1, 8388608, 128, 3, 1, 5578424329, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671499, 265, 3, 0, 0, 226, 665, 9814671370, 265, 0, 0, 107, 9814671371, 265, 0, 0, 107, 1, 8388608, 9814671371, 1, 8388608, 265, 0, 3, 9814671370, 265, 2, 0, 9814671371, 1, 8388608, 265, 3, 1, 9814671371, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166398, 371, 1, 0, 0, 5578424331, 128, 3, 1, 5578424330, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424330, 1, 8388608, 128, 3, 1, 5578424331, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671502, 265, 3, 0, 0, 227, 665, 9814671372, 265, 0, 0, 107, 9814671373, 265, 0, 0, 107, 1, 8388608, 9814671373, 1, 8388608, 265, 0, 3, 9814671372, 265, 2, 0, 9814671373, 1, 8388608, 265, 3, 1, 9814671373, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166401, 371, 1, 0, 0, 5578424333, 128, 3, 1, 5578424332, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424332, 1, 8388608, 128, 3, 1, 5578424333, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671505, 265, 3, 0, 0, 0ULL, 1, 258, 665, 2, 228, 665, 3, 230, 665, 4, 259, 665, 5, 0ULL, 6, 232, 665, 7, 260, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671397, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 1, 8388608, 265, 7, 0, 3, 9814671397, 265, 2, 0, 9814671400, 1, 8388608, 265, 3, 1, 9814671400, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166404, 371, 1, 0, 0, 5578424361, 128, 3, 1, 5578424358, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424358, 1, 8388608, 128, 3, 1, 5578424361, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671508, 265, 3, 0, 0, 266, 1, 8388608, 665, 265, 1, 8388608, 665, 1, 258, 665, 2, 229, 665, 3, 231, 665, 4, 260, 665, 5, 264, 665, 6, 233, 665, 7, 261, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671403, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 1, 8388608, 265, 7, 0, 3, 9814671403, 265, 2, 0, 9814671406, 1, 8388608, 265, 3, 1, 9814671406, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166407, 371, 1, 0, 0, 5578424367, 128, 3, 1, 5578424364, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424364, 1, 8388608, 128, 3, 1, 5578424367, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671511, 265, 3, 0, 0, 294, 665, 9814671374, 265, 0, 0, 2, 9814671375, 265, 0, 0, 2, 1, 8388608, 9814671375, 1, 8388608, 265, 0, 3, 9814671374, 265, 2, 0, 9814671375, 1, 8388608, 265, 3, 1, 9814671375, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166410, 371, 1, 0, 0, 5578424335, 128, 3, 1, 5578424334, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424334, 1, 8388608, 128, 3, 1, 5578424335, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671514, 265, 3, 0, 0, 296, 665, 297, 665, 2, 1ULL, 0, 0, 2, 298, 665, 6652166188, 371, 0, 146, 0, 2, 298, 665, 1, 1ULL, 0, 0, 1, 294, 665, 1, 0, 2, 0, 128ULL, 6652166188, 371, 6652166189, 371, 1, 0, 0, 6652166189, 371, 138, 1, 0, 286, 665, 17, 1, 0, 6652166189, 371, 139, 1, 0, 287, 665, 18, 1, 0, 6652166189, 371, 140, 1, 0, 288, 665, 19, 1, 0, 6652166189, 371, 141, 1, 0, 289, 665, 20, 1, 0, 6652166189, 371, 142, 1, 0, 290, 665, 21, 1, 0, 6652166189, 371, 143, 1, 0, 291, 665, 22, 1, 0, 6652166189, 371, 144, 1, 0, 292, 665, 23, 1, 0, 6652166189, 371, 145, 1, 0, 293, 665, 24, 1, 25, 305, 665, 26, 306, 665, 27, 307, 665, 28, 308, 665, 29, 301, 665, 30, 302, 665, 31, 303, 665, 32, 304, 665, 0, 267, 665, 1, 268, 665, 2, 269, 665, 3, 270, 665, 4, 271, 665, 5, 272, 665, 6, 273, 665, 7, 274, 665, 8, 275, 665, 9, 276, 665, 10, 277, 665, 11, 278, 665, 12, 279, 665, 13, 280, 665, 14, 281, 665, 15, 282, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 265, 1, 1, 0, 146, 0, 17, 0, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 1, 9814671409, 265, 1, 0, 0, 6652166365, 371, 9814671409, 265, 1, 0, 267, 1, 8388608, 665, 1, 268, 1, 8388608, 665, 2, 269, 1, 8388608, 665, 3, 270, 1, 8388608, 665, 4, 271, 1, 8388608, 665, 5, 272, 1, 8388608, 665, 6, 273, 1, 8388608, 665, 7, 274, 1, 8388608, 665, 8, 275, 1, 8388608, 665, 9, 276, 1, 8388608, 665, 10, 277, 1, 8388608, 665, 11, 278, 1, 8388608, 665, 12, 279, 1, 8388608, 665, 13, 280, 1, 8388608, 665, 14, 281, 1, 8388608, 665, 15, 282, 1, 8388608, 665, 16, 123, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 1, 8388608, 265, 1, 1, 3, 6652166365, 371, 2, 0, 9814671409, 1, 8388608, 265, 3, 1, 9814671409, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166413, 371, 1, 0, 0, 5578424373, 128, 3, 1, 5578424370, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424370, 1, 8388608, 128, 3, 1, 5578424373, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671517, 265, 3, 0, 0, 311, 665, 1, 314, 665, 2, 315, 665, 3, 316, 665, 4, 317, 665, 5, 318, 665, 6, 319, 665, 7, 320, 665, 8, 321, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671412, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 1, 8388608, 265, 8, 0, 3, 9814671412, 265, 2, 0, 9814671415, 1, 8388608, 265, 3, 1, 9814671415, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166416, 371, 1, 0, 0, 5578424379, 128, 3, 1, 5578424376, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424376, 1, 8388608, 128, 3, 1, 5578424379, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671520, 265, 3, 0, 0, 397, 665, 1, 398, 665, 2, 400, 665, 3, 399, 665, 4, 401, 665, 5, 402, 665, 6, 403, 665, 7, 404, 665, 8, 405, 665, 9, 406, 665, 10, 407, 665, 11, 408, 665, 12, 409, 665, 13, 410, 665, 14, 411, 665, 15, 375, 665, 16, 384, 665, 17, 377, 665, 18, 376, 665, 19, 381, 665, 20, 382, 665, 21, 383, 665, 22, 380, 665, 23, 378, 665, 24, 379, 665, 25, 385, 665, 26, 386, 665, 27, 387, 665, 28, 396, 665, 29, 389, 665, 30, 388, 665, 31, 393, 665, 32, 395, 665, 33, 394, 665, 34, 392, 665, 35, 391, 665, 36, 390, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671418, 265, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 265, 36, 0, 0, 148, 1, 8388608, 1, 149, 1, 8388608, 2, 150, 1, 8388608, 3, 151, 1, 8388608, 4, 152, 1, 8388608, 5, 153, 1, 8388608, 6, 154, 1, 8388608, 7, 155, 1, 8388608, 8, 156, 1, 8388608, 9, 157, 1, 8388608, 10, 158, 1, 8388608, 11, 159, 1, 8388608, 12, 160, 1, 8388608, 13, 161, 1, 8388608, 14, 162, 1, 8388608, 15, 163, 1, 8388608, 16, 164, 1, 8388608, 17, 165, 1, 8388608, 18, 166, 1, 8388608, 19, 167, 1, 8388608, 20, 168, 1, 8388608, 21, 169, 1, 8388608, 22, 170, 1, 8388608, 23, 171, 1, 8388608, 24, 172, 1, 8388608, 25, 173, 1, 8388608, 26, 174, 1, 8388608, 27, 175, 1, 8388608, 28, 176, 1, 8388608, 29, 177, 1, 8388608, 30, 178, 1, 8388608, 31, 179, 1, 8388608, 32, 180, 1, 8388608, 33, 181, 1, 8388608, 34, 182, 1, 8388608, 35, 183, 1, 8388608, 36, 184, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 1, 8388608, 265, 36, 0, 3, 9814671418, 265, 2, 0, 9814671421, 1, 8388608, 265, 3, 1, 9814671421, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166419, 371, 1, 0, 0, 5578424385, 128, 3, 1, 5578424382, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424382, 1, 8388608, 128, 3, 1, 5578424385, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671523, 265, 3, 0, 0, 188, 1, 414, 665, 2, 418, 665, 3, 422, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671424, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 1, 8388608, 265, 3, 0, 3, 9814671424, 265, 2, 0, 9814671427, 1, 8388608, 265, 3, 1, 9814671427, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166422, 371, 1, 0, 0, 5578424391, 128, 3, 1, 5578424388, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424388, 1, 8388608, 128, 3, 1, 5578424391, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671526, 265, 3, 0, 0, 188, 1, 415, 665, 2, 419, 665, 3, 423, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671430, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 1, 8388608, 265, 3, 0, 3, 9814671430, 265, 2, 0, 9814671433, 1, 8388608, 265, 3, 1, 9814671433, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166425, 371, 1, 0, 0, 5578424397, 128, 3, 1, 5578424394, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424394, 1, 8388608, 128, 3, 1, 5578424397, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671529, 265, 3, 0, 0, 188, 1, 416, 665, 2, 420, 665, 3, 424, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671436, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 1, 8388608, 265, 3, 0, 3, 9814671436, 265, 2, 0, 9814671439, 1, 8388608, 265, 3, 1, 9814671439, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166428, 371, 1, 0, 0, 5578424403, 128, 3, 1, 5578424400, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424400, 1, 8388608, 128, 3, 1, 5578424403, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671532, 265, 3, 0, 0, 188, 1, 417, 665, 2, 421, 665, 3, 425, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671442, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 1, 8388608, 265, 3, 0, 3, 9814671442, 265, 2, 0, 9814671445, 1, 8388608, 265, 3, 1, 9814671445, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166431, 371, 1, 0, 0, 5578424409, 128, 3, 1, 5578424406, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424406, 1, 8388608, 128, 3, 1, 5578424409, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671535, 265, 3, 0, 0, 443, 665, 444, 665, 9, 1ULL, 0, 0, 9, 445, 665, 6652166200, 371, 0, 213, 0, 9, 445, 665, 1, 1ULL, 0, 0, 1, 440, 665, 1, 0, 9, 0, 128ULL, 6652166200, 371, 6652166202, 371, 1, 0, 3, 6652166202, 371, 4, 212, 5, 441, 665, 0, 430, 665, 1, 195, 2, 431, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 265, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 9814671451, 265, 1, 0, 0, 9814671448, 265, 9814671451, 265, 1, 0, 430, 1, 8388608, 665, 1, 195, 1, 8388608, 2, 431, 1, 8388608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 1, 8388608, 265, 2, 0, 3, 9814671448, 265, 2, 0, 9814671451, 1, 8388608, 265, 3, 1, 9814671451, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166434, 371, 1, 0, 0, 5578424415, 128, 3, 1, 5578424412, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424412, 1, 8388608, 128, 3, 1, 5578424415, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671538, 265, 3, 0, 10, 449, 665, 11, 450, 665, 12, 451, 665, 13, 452, 665, 14, 453, 665, 15, 454, 665, 16, 455, 665, 17, 456, 665, 18, 216, 0, 432, 665, 1, 433, 665, 2, 434, 665, 3, 435, 665, 4, 436, 665, 5, 437, 665, 6, 438, 665, 7, 439, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 265, 8, 0, 0, 9, 445, 665, 6652166201, 371, 0, 214, 0, 6652166201, 371, 0, 10, 0, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 9814671457, 265, 1, 0, 0, 9814671454, 265, 9814671457, 265, 1, 0, 432, 1, 8388608, 665, 1, 433, 1, 8388608, 665, 2, 434, 1, 8388608, 665, 3, 435, 1, 8388608, 665, 4, 436, 1, 8388608, 665, 5, 437, 1, 8388608, 665, 6, 438, 1, 8388608, 665, 7, 439, 1, 8388608, 665, 8, 196, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 1, 8388608, 265, 8, 0, 3, 9814671454, 265, 2, 0, 9814671457, 1, 8388608, 265, 3, 1, 9814671457, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166437, 371, 1, 0, 0, 5578424421, 128, 3, 1, 5578424418, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424418, 1, 8388608, 128, 3, 1, 5578424421, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671541, 265, 3, 0, 0, 458, 665, 1, 461, 665, 2, 462, 665, 3, 463, 665, 4, 464, 665, 5, 465, 665, 6, 466, 665, 7, 467, 665, 8, 468, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671460, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 1, 8388608, 265, 8, 0, 3, 9814671460, 265, 2, 0, 9814671463, 1, 8388608, 265, 3, 1, 9814671463, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166440, 371, 1, 0, 0, 5578424427, 128, 3, 1, 5578424424, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424424, 1, 8388608, 128, 3, 1, 5578424427, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671544, 265, 3, 0, 0, 477, 1, 8388608, 665, 477, 665, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 489, 665, 2, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 45, 1ULL, 1, 0, 9814671376, 265, 1, 0, 1ULL, 1, 1, 0, 0, 2, 9814671376, 265, 2, 0, 1, 6652166220, 371, 2, 9814671376, 265, 0, 45, 1, 8388608, 1ULL, 1, 0, 9814671376, 1, 8388608, 265, 1, 3, 6652166220, 371, 2, 0, 9814671376, 1, 8388608, 265, 3, 1, 9814671376, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 9814671547, 265, 1, 0, 0, 5578424337, 128, 3, 1, 5578424336, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424336, 1, 8388608, 128, 3, 1, 5578424337, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671550, 265, 3, 0, 0, 641, 665, 9814671377, 265, 0, 0, 45, 9814671378, 265, 0, 0, 45, 1, 8388608, 9814671378, 1, 8388608, 265, 0, 3, 9814671377, 265, 2, 0, 9814671378, 1, 8388608, 265, 3, 1, 9814671378, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166443, 371, 1, 0, 0, 5578424339, 128, 3, 1, 5578424338, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424338, 1, 8388608, 128, 3, 1, 5578424339, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671553, 265, 3, 0, 3, 553, 665, 4, 552, 665, 5, 551, 665, 6, 550, 665, 7, 549, 665, 8, 548, 665, 9, 547, 665, 10, 546, 665, 11, 562, 665, 12, 563, 665, 13, 564, 665, 14, 565, 665, 15, 566, 665, 16, 567, 665, 17, 568, 665, 18, 569, 665, 19, 570, 665, 20, 571, 665, 21, 572, 665, 22, 573, 665, 23, 576, 665, 24, 574, 665, 25, 575, 665, 26, 577, 665, 27, 634, 665, 28, 635, 665, 29, 637, 665, 30, 636, 665, 31, 639, 665, 32, 638, 665, 0, 1ULL, 607, 665, 1, 2ULL, 608, 665, 2, 0, 1, 0, 4ULL, 609, 665, 1, 2, 0, 0, 8ULL, 623, 665, 2, 1, 0, 0, 16ULL, 621, 665, 1, 2, 0, 0, 32ULL, 613, 665, 2, 1, 0, 0, 64ULL, 616, 665, 1, 2, 0, 0, 128ULL, 615, 665, 2, 1, 0, 0, 256ULL, 617, 665, 1, 2, 0, 0, 512ULL, 620, 665, 2, 1, 0, 0, 1024ULL, 619, 665, 1, 2, 0, 0, 2048ULL, 599, 665, 2, 1, 0, 0, 4096ULL, 600, 665, 1, 2, 0, 0, 8192ULL, 598, 665, 2, 1, 0, 0, 16384ULL, 597, 665, 1, 2, 0, 0, 32768ULL, 591, 665, 2, 1, 0, 0, 65536ULL, 593, 665, 1, 2, 0, 0, 131072ULL, 592, 665, 2, 1, 0, 0, 262144ULL, 610, 665, 1, 2, 0, 0, 524288ULL, 611, 665, 2, 1, 0, 0, 1048576ULL, 612, 665, 1, 2, 0, 0, 2097152ULL, 603, 665, 2, 1, 0, 0, 4194304ULL, 604, 665, 1, 2, 0, 0, 8388608ULL, 624, 665, 2, 1, 0, 0, 16777216ULL, 578, 665, 1, 2, 0, 0, 33554432ULL, 579, 665, 2, 1, 0, 0, 67108864ULL, 580, 665, 1, 2, 0, 0, 134217728ULL, 584, 665, 2, 1, 0, 0, 268435456ULL, 581, 665, 1, 2, 0, 0, 536870912ULL, 582, 665, 2, 1, 0, 0, 1073741824ULL, 587, 665, 1, 2, 0, 0, 2147483648ULL, 589, 665, 2, 1, 0, 0, 4294967296ULL, 586, 665, 1, 2, 0, 0, 8589934592ULL, 590, 665, 2, 1, 0, 0, 17179869184ULL, 588, 665, 1, 2, 0, 0, 34359738368ULL, 585, 665, 2, 1, 0, 0, 68719476736ULL, 583, 665, 1, 2, 0, 0, 137438953472ULL, 606, 665, 2, 1, 0, 0, 274877906944ULL, 605, 665, 1, 2, 0, 0, 549755813888ULL, 601, 665, 2, 1, 0, 0, 1099511627776ULL, 655, 665, 1, 2, 0, 0, 2199023255552ULL, 594, 665, 2, 1, 0, 0, 4398046511104ULL, 625, 665, 1, 2, 0, 0, 8796093022208ULL, 626, 665, 2, 1, 0, 0, 17592186044416ULL, 614, 665, 1, 2, 0, 0, 35184372088832ULL, 618, 665, 2, 1, 0, 0, 70368744177664ULL, 656, 665, 1, 2, 0, 0, 1, 1, 595, 665, 2, 596, 665, 33, 622, 665, 34, 653, 665, 35, 654, 665, 36, 542, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671466, 265, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 265, 36, 0, 0, 47, 1, 8388608, 1, 48, 1, 8388608, 2, 49, 1, 8388608, 3, 50, 1, 8388608, 4, 51, 1, 8388608, 5, 52, 1, 8388608, 6, 53, 1, 8388608, 7, 54, 1, 8388608, 8, 56, 1, 8388608, 9, 57, 1, 8388608, 10, 58, 1, 8388608, 11, 59, 1, 8388608, 12, 60, 1, 8388608, 13, 61, 1, 8388608, 14, 62, 1, 8388608, 15, 63, 1, 8388608, 16, 64, 1, 8388608, 17, 65, 1, 8388608, 18, 66, 1, 8388608, 19, 67, 1, 8388608, 20, 68, 1, 8388608, 21, 69, 1, 8388608, 22, 70, 1, 8388608, 23, 71, 1, 8388608, 24, 72, 1, 8388608, 25, 73, 1, 8388608, 26, 74, 1, 8388608, 27, 75, 1, 8388608, 28, 76, 1, 8388608, 29, 77, 1, 8388608, 30, 83, 1, 8388608, 31, 55, 1, 8388608, 32, 78, 1, 8388608, 33, 79, 1, 8388608, 34, 80, 1, 8388608, 35, 81, 1, 8388608, 36, 82, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 1, 8388608, 265, 36, 0, 3, 9814671466, 265, 2, 0, 9814671469, 1, 8388608, 265, 3, 1, 9814671469, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166446, 371, 1, 0, 0, 5578424433, 128, 3, 1, 5578424430, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424430, 1, 8388608, 128, 3, 1, 5578424433, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671556, 265, 3, 0, 0, 599, 665, 529, 665, 1, 600, 665, 543, 665, 2, 0, 1, 3, 2, 595, 665, 0, 601, 665, 538, 665, 1, 262144ULL, 0, 0, 65536ULL, 597, 665, 2, 1, 0, 0, 597, 665, 539, 665, 1, 2, 0, 0, 131072ULL, 598, 665, 2, 1, 0, 101, 2, 3, 13, 101, 14, 544, 665, 0, 521, 665, 613, 665, 15, 0, 614, 665, 0, 497, 665, 562, 665, 1, 505, 665, 563, 665, 2, 0, 1, 0, 513, 665, 564, 665, 1, 2, 0, 0, 506, 665, 565, 665, 2, 1, 0, 0, 521, 665, 566, 665, 1, 2, 0, 0, 529, 665, 567, 665, 2, 1, 0, 0, 561, 665, 569, 665, 1, 2, 0, 0, 537, 665, 568, 665, 2, 1, 0, 0, 538, 665, 570, 665, 1, 2, 0, 0, 539, 665, 571, 665, 2, 1, 0, 0, 540, 665, 572, 665, 1, 2, 0, 0, 541, 665, 573, 665, 2, 1, 0, 0, 574, 665, 45, 1, 2, 0, 0, 543, 665, 575, 665, 2, 1, 0, 0, 544, 665, 576, 665, 1, 2, 0, 0, 628, 665, 634, 665, 2, 1, 0, 0, 629, 665, 635, 665, 1, 2, 0, 0, 630, 665, 636, 665, 2, 1, 0, 0, 631, 665, 637, 665, 1, 2, 0, 0, 632, 665, 638, 665, 2, 1, 0, 0, 633, 665, 639, 665, 1, 2, 0, 0, 545, 665, 577, 665, 2, 1, 0, 102, 2, 553, 665, 16, 102, 0, 496, 665, 562, 665, 1, 504, 665, 563, 665, 2, 0, 1, 0, 512, 665, 564, 665, 1, 2, 0, 0, 513, 665, 565, 665, 2, 1, 0, 0, 520, 665, 566, 665, 1, 2, 0, 0, 528, 665, 567, 665, 2, 1, 0, 0, 536, 665, 568, 665, 1, 2, 0, 0, 560, 665, 569, 665, 2, 1, 0, 103, 2, 552, 665, 17, 103, 0, 495, 665, 562, 665, 1, 503, 665, 563, 665, 2, 0, 1, 0, 511, 665, 564, 665, 1, 2, 0, 0, 512, 665, 565, 665, 2, 1, 0, 0, 519, 665, 566, 665, 1, 2, 0, 0, 527, 665, 567, 665, 2, 1, 0, 0, 535, 665, 568, 665, 1, 2, 0, 0, 559, 665, 569, 665, 2, 1, 0, 104, 2, 551, 665, 18, 104, 0, 494, 665, 562, 665, 1, 502, 665, 563, 665, 2, 0, 1, 0, 510, 665, 564, 665, 1, 2, 0, 0, 511, 665, 565, 665, 2, 1, 0, 0, 518, 665, 566, 665, 1, 2, 0, 0, 526, 665, 567, 665, 2, 1, 0, 0, 534, 665, 568, 665, 1, 2, 0, 0, 558, 665, 569, 665, 2, 1, 0, 105, 2, 550, 665, 19, 105, 0, 493, 665, 562, 665, 1, 501, 665, 563, 665, 2, 0, 1, 0, 509, 665, 564, 665, 1, 2, 0, 0, 510, 665, 565, 665, 2, 1, 0, 0, 517, 665, 566, 665, 1, 2, 0, 0, 525, 665, 567, 665, 2, 1, 0, 0, 533, 665, 568, 665, 1, 2, 0, 0, 557, 665, 569, 665, 2, 1, 0, 106, 2, 549, 665, 20, 106, 0, 492, 665, 562, 665, 1, 500, 665, 563, 665, 2, 0, 1, 0, 508, 665, 564, 665, 1, 2, 0, 0, 509, 665, 565, 665, 2, 1, 0, 0, 516, 665, 566, 665, 1, 2, 0, 0, 524, 665, 567, 665, 2, 1, 0, 0, 532, 665, 568, 665, 1, 2, 0, 0, 556, 665, 569, 665, 2, 1, 0, 107, 2, 548, 665, 21, 107, 0, 491, 665, 562, 665, 1, 499, 665, 563, 665, 2, 0, 1, 0, 507, 665, 564, 665, 1, 2, 0, 0, 508, 665, 565, 665, 2, 1, 0, 0, 515, 665, 566, 665, 1, 2, 0, 0, 523, 665, 567, 665, 2, 1, 0, 0, 531, 665, 568, 665, 1, 2, 0, 0, 555, 665, 569, 665, 2, 1, 0, 108, 2, 547, 665, 22, 108, 0, 490, 665, 562, 665, 1, 498, 665, 563, 665, 2, 0, 1, 0, 506, 665, 564, 665, 1, 2, 0, 0, 507, 665, 565, 665, 2, 1, 0, 0, 514, 665, 566, 665, 1, 2, 0, 0, 522, 665, 567, 665, 2, 1, 0, 0, 530, 665, 568, 665, 1, 2, 0, 0, 554, 665, 569, 665, 2, 1, 0, 109, 2, 546, 665, 23, 109, 2, 442, 665, 0, 448, 665, 443, 665, 1, 0, 459, 665, 3, 1, 1ULL, 4, 459, 665, 0, 461, 665, 6652166202, 371, 6652166203, 371, 0, 469, 665, 5, 6652166203, 371, 0, 462, 665, 6652166202, 371, 6652166204, 371, 0, 470, 665, 6, 6652166204, 371, 0, 463, 665, 6652166202, 371, 6652166205, 371, 0, 471, 665, 7, 6652166205, 371, 0, 464, 665, 6652166202, 371, 6652166206, 371, 0, 472, 665, 8, 6652166206, 371, 0, 465, 665, 6652166202, 371, 6652166207, 371, 0, 473, 665, 9, 6652166207, 371, 0, 466, 665, 6652166202, 371, 6652166208, 371, 0, 474, 665, 10, 6652166208, 371, 0, 467, 665, 6652166202, 371, 6652166209, 371, 0, 475, 665, 11, 6652166209, 371, 0, 468, 665, 6652166202, 371, 6652166210, 371, 0, 476, 665, 12, 6652166210, 371, 0, 458, 665, 460, 665, 1, 1ULL, 0, 6652166218, 371, 1, 215, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 371, 0, 9814671472, 265, 1, 1, 0, 613, 665, 614, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671472, 265, 1, 0, 0, 6652166368, 371, 9814671472, 265, 1, 3, 442, 1, 8388608, 665, 0, 448, 1, 8388608, 665, 443, 1, 8388608, 665, 1, 0, 459, 1, 8388608, 665, 4, 1, 1ULL, 5, 459, 1, 8388608, 665, 0, 443, 1, 8388608, 665, 444, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 445, 1, 8388608, 665, 6652166200, 1, 8388608, 371, 213, 1, 8388608, 0, 0, 2, 445, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 440, 1, 8388608, 665, 1, 0, 2, 0, 6652166200, 1, 8388608, 371, 128ULL, 6652166202, 1, 8388608, 371, 1, 0, 0, 461, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166203, 1, 8388608, 371, 0, 469, 1, 8388608, 665, 2, 6652166203, 1, 8388608, 371, 0, 462, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166204, 1, 8388608, 371, 0, 470, 1, 8388608, 665, 6, 6652166204, 1, 8388608, 371, 0, 463, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166205, 1, 8388608, 371, 0, 471, 1, 8388608, 665, 7, 6652166205, 1, 8388608, 371, 0, 464, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166206, 1, 8388608, 371, 0, 472, 1, 8388608, 665, 8, 6652166206, 1, 8388608, 371, 0, 465, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166207, 1, 8388608, 371, 0, 473, 1, 8388608, 665, 9, 6652166207, 1, 8388608, 371, 0, 466, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166208, 1, 8388608, 371, 0, 474, 1, 8388608, 665, 10, 6652166208, 1, 8388608, 371, 0, 467, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166209, 1, 8388608, 371, 0, 475, 1, 8388608, 665, 11, 6652166209, 1, 8388608, 371, 0, 468, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166210, 1, 8388608, 371, 0, 476, 1, 8388608, 665, 12, 6652166210, 1, 8388608, 371, 0, 458, 1, 8388608, 665, 460, 1, 8388608, 665, 1, 1ULL, 0, 6652166218, 1, 8388608, 371, 215, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 1, 8388608, 371, 0, 9814671472, 1, 8388608, 265, 1, 1, 3, 6652166368, 371, 2, 0, 9814671472, 1, 8388608, 265, 3, 1, 9814671472, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166449, 371, 1, 0, 0, 5578424439, 128, 3, 1, 5578424436, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424436, 1, 8388608, 128, 3, 1, 5578424439, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671559, 265, 3, 0, 13, 101, 14, 544, 665, 0, 521, 665, 617, 665, 15, 0, 618, 665, 16, 102, 17, 103, 18, 104, 19, 105, 20, 106, 21, 107, 22, 108, 23, 109, 2, 295, 665, 0, 310, 665, 296, 665, 1, 0, 312, 665, 3, 1, 1ULL, 4, 312, 665, 0, 314, 665, 6652166189, 371, 6652166190, 371, 0, 322, 665, 5, 6652166190, 371, 0, 315, 665, 6652166189, 371, 6652166191, 371, 0, 323, 665, 6, 6652166191, 371, 0, 316, 665, 6652166189, 371, 6652166192, 371, 0, 324, 665, 7, 6652166192, 371, 0, 317, 665, 6652166189, 371, 6652166193, 371, 0, 325, 665, 8, 6652166193, 371, 0, 318, 665, 6652166189, 371, 6652166194, 371, 0, 326, 665, 9, 6652166194, 371, 0, 319, 665, 6652166189, 371, 6652166195, 371, 0, 327, 665, 10, 6652166195, 371, 0, 320, 665, 6652166189, 371, 6652166196, 371, 0, 328, 665, 11, 6652166196, 371, 0, 321, 665, 6652166189, 371, 6652166197, 371, 0, 329, 665, 12, 6652166197, 371, 0, 311, 665, 313, 665, 1, 1ULL, 0, 6652166219, 371, 1, 147, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 371, 0, 9814671475, 265, 1, 1, 0, 617, 665, 618, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671475, 265, 1, 0, 0, 6652166371, 371, 9814671475, 265, 1, 3, 295, 1, 8388608, 665, 0, 310, 1, 8388608, 665, 296, 1, 8388608, 665, 1, 0, 312, 1, 8388608, 665, 4, 1, 1ULL, 5, 312, 1, 8388608, 665, 0, 296, 1, 8388608, 665, 297, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 298, 1, 8388608, 665, 6652166188, 1, 8388608, 371, 146, 1, 8388608, 0, 0, 2, 298, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 294, 1, 8388608, 665, 1, 0, 2, 0, 6652166188, 1, 8388608, 371, 128ULL, 6652166189, 1, 8388608, 371, 1, 0, 0, 314, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166190, 1, 8388608, 371, 0, 322, 1, 8388608, 665, 2, 6652166190, 1, 8388608, 371, 0, 315, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166191, 1, 8388608, 371, 0, 323, 1, 8388608, 665, 6, 6652166191, 1, 8388608, 371, 0, 316, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166192, 1, 8388608, 371, 0, 324, 1, 8388608, 665, 7, 6652166192, 1, 8388608, 371, 0, 317, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166193, 1, 8388608, 371, 0, 325, 1, 8388608, 665, 8, 6652166193, 1, 8388608, 371, 0, 318, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166194, 1, 8388608, 371, 0, 326, 1, 8388608, 665, 9, 6652166194, 1, 8388608, 371, 0, 319, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166195, 1, 8388608, 371, 0, 327, 1, 8388608, 665, 10, 6652166195, 1, 8388608, 371, 0, 320, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166196, 1, 8388608, 371, 0, 328, 1, 8388608, 665, 11, 6652166196, 1, 8388608, 371, 0, 321, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166197, 1, 8388608, 371, 0, 329, 1, 8388608, 665, 12, 6652166197, 1, 8388608, 371, 0, 311, 1, 8388608, 665, 313, 1, 8388608, 665, 1, 1ULL, 0, 6652166219, 1, 8388608, 371, 147, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 1, 8388608, 371, 0, 9814671475, 1, 8388608, 265, 1, 1, 3, 6652166371, 371, 2, 0, 9814671475, 1, 8388608, 265, 3, 1, 9814671475, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166452, 371, 1, 0, 0, 5578424445, 128, 3, 1, 5578424442, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424442, 1, 8388608, 128, 3, 1, 5578424445, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671562, 265, 3, 0, 3, 0ULL, 4, 0ULL, 5, 1ULL, 6, 334, 665, 7, 335, 665, 8, 336, 665, 9, 337, 665, 10, 338, 665, 11, 339, 665, 12, 340, 665, 13, 341, 665, 14, 398, 665, 15, 0ULL, 16, 0ULL, 17, 0ULL, 0, 376, 665, 342, 665, 1, 377, 665, 346, 665, 2, 0, 1, 0, 378, 665, 350, 665, 1, 2, 0, 0, 379, 665, 354, 665, 2, 1, 0, 0, 380, 665, 358, 665, 1, 2, 0, 0, 383, 665, 366, 665, 2, 1, 0, 0, 381, 665, 362, 665, 1, 2, 0, 0, 384, 665, 330, 665, 2, 1, 0, 0, 382, 665, 370, 665, 1, 2, 0, 0, 385, 665, 357, 665, 2, 1, 0, 0, 2, 407, 665, 18, 0, 0, 376, 665, 343, 665, 1, 377, 665, 347, 665, 2, 0, 1, 0, 378, 665, 351, 665, 1, 2, 0, 0, 379, 665, 355, 665, 2, 1, 0, 0, 380, 665, 359, 665, 1, 2, 0, 0, 383, 665, 367, 665, 2, 1, 0, 0, 381, 665, 363, 665, 1, 2, 0, 0, 384, 665, 331, 665, 2, 1, 0, 0, 385, 665, 354, 665, 1, 2, 0, 0, 1, 408, 665, 19, 0, 0, 376, 665, 344, 665, 1, 377, 665, 348, 665, 2, 0, 1, 0, 378, 665, 352, 665, 1, 2, 0, 0, 379, 665, 356, 665, 2, 1, 0, 0, 380, 665, 360, 665, 1, 2, 0, 0, 383, 665, 368, 665, 2, 1, 0, 0, 381, 665, 364, 665, 1, 2, 0, 0, 384, 665, 332, 665, 2, 1, 0, 0, 385, 665, 355, 665, 1, 2, 0, 0, 1, 409, 665, 20, 0, 0, 376, 665, 345, 665, 1, 377, 665, 349, 665, 2, 0, 1, 0, 378, 665, 353, 665, 1, 2, 0, 0, 379, 665, 357, 665, 2, 1, 0, 0, 380, 665, 361, 665, 1, 2, 0, 0, 383, 665, 369, 665, 2, 1, 0, 0, 381, 665, 365, 665, 1, 2, 0, 0, 384, 665, 333, 665, 2, 1, 0, 0, 385, 665, 356, 665, 1, 2, 0, 0, 1, 410, 665, 1, 0, 0, 397, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 6652166455, 371, 0, 3, 0, 283, 665, 1, 284, 665, 2, 285, 665, 3, 267, 665, 4, 268, 665, 5, 269, 665, 6, 270, 665, 7, 271, 665, 8, 272, 665, 9, 273, 665, 10, 274, 665, 11, 275, 665, 12, 276, 665, 13, 277, 665, 14, 278, 665, 15, 279, 665, 16, 280, 665, 17, 281, 665, 18, 282, 665, 19, 285, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 9814671565, 265, 0, 3, 0, 102, 1, 103, 2, 104, 3, 105, 4, 106, 5, 107, 6, 108, 7, 109, 8, 605, 665, 620, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 6652166458, 371, 0, 3, 0, 234, 665, 1, 235, 665, 2, 236, 665, 3, 237, 665, 4, 238, 665, 5, 239, 665, 6, 240, 665, 7, 241, 665, 8, 266, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 9814671568, 265, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 0ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 102, 37, 103, 38, 104, 39, 105, 40, 106, 41, 107, 42, 108, 43, 109, 44, 607, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 6652166461, 371, 0, 3, 1, 221, 665, 2, 222, 665, 3, 223, 665, 4, 224, 665, 0, 65536ULL, 59, 665, 53, 0, 58, 665, 5, 53, 0, 65536ULL, 61, 665, 54, 0, 60, 665, 6, 54, 0, 65536ULL, 63, 665, 55, 0, 62, 665, 7, 55, 0, 65536ULL, 65, 665, 56, 0, 64, 665, 8, 56, 0, 65536ULL, 67, 665, 57, 0, 66, 665, 9, 57, 0, 65536ULL, 69, 665, 58, 0, 68, 665, 10, 58, 0, 65536ULL, 71, 665, 59, 0, 70, 665, 11, 59, 0, 65536ULL, 73, 665, 60, 0, 72, 665, 12, 60, 0, 65536ULL, 75, 665, 61, 0, 74, 665, 13, 61, 0, 65536ULL, 77, 665, 62, 0, 76, 665, 14, 62, 0, 65536ULL, 79, 665, 63, 0, 78, 665, 15, 63, 0, 65536ULL, 81, 665, 64, 0, 80, 665, 16, 64, 0, 65536ULL, 83, 665, 65, 0, 82, 665, 17, 65, 0, 65536ULL, 85, 665, 66, 0, 84, 665, 18, 66, 0, 65536ULL, 87, 665, 67, 0, 86, 665, 19, 67, 0, 65536ULL, 89, 665, 68, 0, 88, 665, 20, 68, 0, 65536ULL, 91, 665, 69, 0, 90, 665, 21, 69, 0, 65536ULL, 93, 665, 70, 0, 92, 665, 22, 70, 0, 65536ULL, 95, 665, 71, 0, 94, 665, 23, 71, 0, 65536ULL, 97, 665, 72, 0, 96, 665, 24, 72, 0, 65536ULL, 99, 665, 73, 0, 98, 665, 25, 73, 0, 65536ULL, 101, 665, 74, 0, 100, 665, 26, 74, 0, 65536ULL, 103, 665, 75, 0, 102, 665, 27, 75, 0, 65536ULL, 105, 665, 76, 0, 104, 665, 28, 76, 0, 65536ULL, 107, 665, 77, 0, 106, 665, 29, 77, 0, 65536ULL, 109, 665, 78, 0, 108, 665, 30, 78, 0, 65536ULL, 111, 665, 79, 0, 110, 665, 31, 79, 0, 65536ULL, 113, 665, 80, 0, 112, 665, 32, 80, 0, 65536ULL, 115, 665, 81, 0, 114, 665, 33, 81, 0, 65536ULL, 117, 665, 82, 0, 116, 665, 34, 82, 0, 65536ULL, 119, 665, 83, 0, 118, 665, 35, 83, 0, 65536ULL, 121, 665, 84, 0, 120, 665, 36, 84, 0, 65536ULL, 139, 665, 93, 0, 138, 665, 37, 93, 0, 65536ULL, 141, 665, 94, 0, 140, 665, 38, 94, 0, 65536ULL, 143, 665, 95, 0, 142, 665, 39, 95, 0, 65536ULL, 145, 665, 96, 0, 144, 665, 40, 96, 0, 65536ULL, 147, 665, 97, 0, 146, 665, 41, 97, 0, 65536ULL, 149, 665, 98, 0, 148, 665, 42, 98, 0, 65536ULL, 151, 665, 99, 0, 150, 665, 43, 99, 0, 65536ULL, 153, 665, 100, 0, 152, 665, 0, 100, 44, 218, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 9814671571, 265, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 102, 45, 103, 46, 104, 47, 105, 48, 106, 49, 107, 50, 108, 51, 109, 52, 608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166464, 371, 0, 3, 1, 221, 665, 2, 222, 665, 3, 223, 665, 4, 224, 665, 5, 53, 6, 54, 7, 55, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 78, 31, 79, 32, 80, 33, 81, 34, 82, 35, 83, 36, 84, 0, 65536ULL, 123, 665, 85, 0, 122, 665, 37, 85, 0, 65536ULL, 125, 665, 86, 0, 124, 665, 38, 86, 0, 65536ULL, 127, 665, 87, 0, 126, 665, 39, 87, 0, 65536ULL, 129, 665, 88, 0, 128, 665, 40, 88, 0, 65536ULL, 131, 665, 89, 0, 130, 665, 41, 89, 0, 65536ULL, 133, 665, 90, 0, 132, 665, 42, 90, 0, 65536ULL, 135, 665, 91, 0, 134, 665, 43, 91, 0, 65536ULL, 137, 665, 92, 0, 136, 665, 0, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 219, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 9814671574, 265, 0, 3, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 497, 665, 21, 496, 665, 22, 495, 665, 23, 494, 665, 24, 493, 665, 25, 492, 665, 26, 491, 665, 27, 490, 665, 28, 505, 665, 29, 504, 665, 30, 503, 665, 31, 502, 665, 32, 501, 665, 33, 500, 665, 34, 499, 665, 35, 498, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 102, 45, 103, 46, 104, 47, 105, 48, 106, 49, 107, 50, 108, 51, 109, 52, 609, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166467, 371, 0, 3, 0, 221, 665, 1, 222, 665, 2, 223, 665, 3, 224, 665, 4, 53, 5, 54, 6, 55, 7, 56, 8, 57, 9, 58, 10, 59, 11, 60, 12, 61, 13, 62, 14, 63, 15, 64, 16, 65, 17, 66, 18, 67, 19, 68, 20, 69, 21, 70, 22, 71, 23, 72, 24, 73, 25, 74, 26, 75, 27, 76, 28, 77, 29, 78, 30, 79, 31, 80, 32, 81, 33, 82, 34, 83, 35, 84, 36, 85, 37, 86, 38, 87, 39, 88, 40, 89, 41, 90, 42, 91, 43, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 220, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 9814671577, 265, 0, 3, 0, 622, 665, 1, 497, 665, 2, 496, 665, 3, 495, 665, 4, 494, 665, 5, 493, 665, 6, 492, 665, 7, 491, 665, 8, 490, 665, 9, 505, 665, 10, 504, 665, 11, 503, 665, 12, 502, 665, 13, 501, 665, 14, 500, 665, 15, 499, 665, 16, 498, 665, 17, 102, 18, 103, 19, 104, 20, 105, 21, 106, 22, 107, 23, 108, 24, 109, 25, 602, 665, 26, 621, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 6652166470, 371, 0, 3, 0, 263, 665, 1, 234, 665, 2, 235, 665, 3, 236, 665, 4, 237, 665, 5, 238, 665, 6, 239, 665, 7, 240, 665, 8, 241, 665, 9, 242, 665, 10, 243, 665, 11, 244, 665, 12, 245, 665, 13, 246, 665, 14, 247, 665, 15, 248, 665, 16, 249, 665, 17, 250, 665, 18, 251, 665, 19, 252, 665, 20, 253, 665, 21, 254, 665, 22, 255, 665, 23, 256, 665, 24, 257, 665, 25, 262, 665, 26, 265, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 9814671580, 265, 0, 3, 0, 101, 1, 102, 2, 615, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166473, 371, 0, 3, 0, 442, 665, 1, 448, 665, 2, 446, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 9814671583, 265, 0, 3, 0, 101, 1, 102, 2, 103, 3, 104, 4, 105, 5, 106, 6, 107, 7, 108, 8, 109, 9, 640, 665, 10, 616, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 6652166476, 371, 0, 3, 0, 442, 665, 1, 449, 665, 2, 450, 665, 3, 451, 665, 4, 452, 665, 5, 453, 665, 6, 454, 665, 7, 455, 665, 8, 456, 665, 9, 457, 665, 10, 447, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 9814671586, 265, 0, 3, 0, 101, 1, 102, 2, 619, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166479, 371, 0, 3, 0, 295, 665, 1, 310, 665, 2, 299, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 9814671589, 265, 0, 3, 1, 101, 0, 4294967296ULL, 103, 2, 102, 0, 0, 4294967296ULL, 105, 3, 104, 0, 0, 4294967296ULL, 107, 4, 106, 0, 0, 4294967296ULL, 109, 5, 108, 0, 0, 640, 665, 6, 620, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 6652166482, 371, 0, 3, 0, 295, 665, 1, 301, 665, 2, 302, 665, 3, 303, 665, 4, 304, 665, 5, 309, 665, 6, 300, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 9814671592, 265, 0, 3, 0, 101, 1, 45, 2, 604, 665, 3, 102, 4, 103, 5, 104, 6, 105, 7, 106, 8, 107, 9, 108, 10, 109, 11, 603, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 6652166485, 371, 0, 3, 0, 477, 665, 1, 478, 665, 2, 480, 665, 3, 481, 665, 4, 482, 665, 5, 483, 665, 6, 484, 665, 7, 485, 665, 8, 486, 665, 9, 487, 665, 10, 488, 665, 11, 479, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 9814671595, 265, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 513, 665, 4, 512, 665, 5, 511, 665, 6, 510, 665, 7, 509, 665, 8, 508, 665, 9, 507, 665, 10, 506, 665, 11, 0ULL, 12, 0ULL, 13, 0ULL, 14, 0ULL, 15, 657, 665, 16, 658, 665, 17, 659, 665, 18, 660, 665, 19, 606, 665, 605, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 9814671598, 265, 0, 3, 0, 283, 665, 1, 284, 665, 2, 285, 665, 3, 267, 665, 4, 268, 665, 5, 269, 665, 6, 270, 665, 7, 271, 665, 8, 272, 665, 9, 273, 665, 10, 274, 665, 11, 275, 665, 12, 276, 665, 13, 277, 665, 14, 278, 665, 15, 279, 665, 16, 280, 665, 17, 281, 665, 18, 282, 665, 19, 283, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 9814671601, 265, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 497, 665, 4, 496, 665, 5, 495, 665, 6, 494, 665, 7, 493, 665, 8, 0ULL, 9, 505, 665, 10, 504, 665, 11, 657, 665, 12, 658, 665, 13, 659, 665, 14, 660, 665, 15, 661, 665, 16, 662, 665, 17, 663, 665, 18, 664, 665, 19, 492, 665, 20, 491, 665, 21, 490, 665, 22, 503, 665, 23, 502, 665, 24, 501, 665, 25, 500, 665, 26, 499, 665, 27, 498, 665, 28, 606, 665, 605, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 9814671604, 265, 0, 3, 0, 283, 665, 1, 284, 665, 2, 285, 665, 3, 267, 665, 4, 268, 665, 5, 269, 665, 6, 270, 665, 7, 271, 665, 8, 272, 665, 9, 273, 665, 10, 274, 665, 11, 275, 665, 12, 276, 665, 13, 277, 665, 14, 278, 665, 15, 279, 665, 16, 280, 665, 17, 281, 665, 18, 282, 665, 19, 0ULL, 20, 0ULL, 21, 0ULL, 22, 0ULL, 23, 0ULL, 24, 0ULL, 25, 0ULL, 26, 0ULL, 27, 0ULL, 28, 284, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 9814671607, 265, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 0, 661, 665, 5, 662, 665, 6, 663, 665, 7, 664, 665, 8, 102, 9, 103, 10, 104, 11, 105, 12, 106, 13, 107, 14, 108, 15, 109, 16, 640, 665, 17, 606, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 6652166488, 371, 0, 3, 0, 342, 665, 1, 343, 665, 2, 344, 665, 3, 345, 665, 4, 362, 665, 5, 363, 665, 6, 364, 665, 7, 365, 665, 8, 350, 665, 9, 351, 665, 10, 352, 665, 11, 353, 665, 12, 354, 665, 13, 355, 665, 14, 356, 665, 15, 357, 665, 16, 412, 665, 2ULL, 17, 400, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 9814671610, 265, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 5, 661, 665, 6, 662, 665, 7, 663, 665, 8, 664, 665, 9, 521, 665, 10, 520, 665, 11, 519, 665, 12, 518, 665, 13, 517, 665, 14, 516, 665, 15, 515, 665, 16, 514, 665, 0, 4294967296ULL, 103, 17, 102, 0, 0, 4294967296ULL, 105, 18, 104, 0, 0, 4294967296ULL, 107, 19, 106, 0, 0, 4294967296ULL, 109, 20, 108, 0, 0, 640, 665, 21, 605, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 6652166491, 371, 0, 3, 0, 342, 665, 1, 343, 665, 2, 344, 665, 3, 345, 665, 4, 362, 665, 5, 363, 665, 6, 364, 665, 7, 365, 665, 8, 350, 665, 9, 351, 665, 10, 352, 665, 11, 353, 665, 12, 354, 665, 13, 355, 665, 14, 356, 665, 15, 357, 665, 16, 346, 665, 17, 347, 665, 18, 348, 665, 19, 349, 665, 20, 412, 665, 2ULL, 21, 399, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 9814671613, 265, 0, 3, 0, 0ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 102, 19, 103, 20, 104, 21, 105, 22, 106, 23, 107, 24, 108, 25, 109, 26, 513, 665, 27, 610, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166494, 371, 0, 3, 0, 3, 665, 1, 4, 665, 2, 5, 665, 3, 6, 665, 4, 7, 665, 5, 8, 665, 6, 9, 665, 7, 10, 665, 8, 11, 665, 9, 12, 665, 10, 13, 665, 11, 14, 665, 12, 15, 665, 13, 16, 665, 14, 17, 665, 15, 18, 665, 16, 19, 665, 17, 20, 665, 18, 37, 665, 19, 38, 665, 20, 39, 665, 21, 40, 665, 22, 41, 665, 23, 42, 665, 24, 43, 665, 25, 44, 665, 26, 54, 665, 27, 55, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 9814671616, 265, 0, 3, 0, 1ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 102, 19, 103, 20, 104, 21, 105, 22, 106, 23, 107, 24, 108, 25, 109, 26, 513, 665, 27, 521, 665, 28, 520, 665, 29, 519, 665, 30, 518, 665, 31, 517, 665, 32, 516, 665, 33, 515, 665, 34, 514, 665, 35, 529, 665, 36, 528, 665, 37, 527, 665, 38, 526, 665, 39, 525, 665, 40, 524, 665, 41, 523, 665, 42, 522, 665, 43, 611, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 6652166497, 371, 0, 3, 0, 3, 665, 1, 4, 665, 2, 5, 665, 3, 6, 665, 4, 7, 665, 5, 8, 665, 6, 9, 665, 7, 10, 665, 8, 11, 665, 9, 12, 665, 10, 13, 665, 11, 14, 665, 12, 15, 665, 13, 16, 665, 14, 17, 665, 15, 18, 665, 16, 19, 665, 17, 20, 665, 18, 37, 665, 19, 38, 665, 20, 39, 665, 21, 40, 665, 22, 41, 665, 23, 42, 665, 24, 43, 665, 25, 44, 665, 26, 54, 665, 27, 21, 665, 28, 22, 665, 29, 23, 665, 30, 24, 665, 31, 25, 665, 32, 26, 665, 33, 27, 665, 34, 28, 665, 35, 29, 665, 36, 30, 665, 37, 31, 665, 38, 32, 665, 39, 33, 665, 40, 34, 665, 41, 35, 665, 42, 36, 665, 43, 57, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 9814671619, 265, 0, 3, 0, 0ULL, 1, 1ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 102, 11, 103, 12, 104, 13, 105, 14, 106, 15, 107, 16, 108, 17, 109, 18, 513, 665, 19, 521, 665, 20, 520, 665, 21, 519, 665, 22, 518, 665, 23, 517, 665, 24, 516, 665, 25, 515, 665, 26, 514, 665, 27, 612, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166500, 371, 0, 3, 0, 3, 665, 1, 4, 665, 2, 5, 665, 3, 6, 665, 4, 7, 665, 5, 8, 665, 6, 9, 665, 7, 10, 665, 8, 11, 665, 9, 12, 665, 10, 37, 665, 11, 38, 665, 12, 39, 665, 13, 40, 665, 14, 41, 665, 15, 42, 665, 16, 43, 665, 17, 44, 665, 18, 54, 665, 19, 21, 665, 20, 22, 665, 21, 23, 665, 22, 24, 665, 23, 25, 665, 24, 26, 665, 25, 27, 665, 26, 28, 665, 27, 56, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 9814671622, 265, 0, 3, 0, 8589934592ULL, 417, 665, 1, 4194304ULL, 416, 665, 2, 0, 1, 0, 2048ULL, 415, 665, 1, 2, 0, 0, 1, 414, 665, 3, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 8589934592ULL, 421, 665, 1, 4194304ULL, 420, 665, 2, 0, 1, 0, 2048ULL, 419, 665, 1, 2, 0, 0, 1, 418, 665, 4, 0, 0, 12275445934081160404ULL, 3, 1, 0, 0, 4, 1, 1, 0, 2, 3, 2, 1, 0, 8589934592ULL, 425, 665, 1, 4194304ULL, 424, 665, 2, 0, 1, 0, 2048ULL, 423, 665, 1, 2, 0, 0, 1, 422, 665, 1, 0, 0, 4756475762779100925ULL, 3, 1, 0, 0, 1, 1, 1, 0, 2, 6652166503, 371, 3, 1, 0, 185, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 186, 0, 0, 3, 1, 4, 0, 0, 1, 2, 3, 2, 0, 0, 187, 0, 0, 3, 1, 1, 0, 0, 1, 2, 6652166506, 371, 3, 0, 2, 429, 665, 0, 3, 1, 2, 0, 2, 1, 2, 0, 2ULL, 429, 665, 1, 0, 428, 665, 0, 429, 665, 1, 1, 431, 665, 0, 0, 1, 428, 665, 6652166199, 371, 0, 0, 12275445934081160404ULL, 3, 1, 0, 0, 6652166199, 371, 1, 1, 0, 2, 3, 2, 1, 1, 426, 665, 0, 4756475762779100925ULL, 3, 1, 0, 0, 1, 1, 1, 0, 2, 6652166509, 371, 3, 1, 0, 209, 0, 0, 3, 1, 2, 0, 2, 1, 2, 0, 210, 0, 0, 3, 1, 6652166199, 371, 0, 0, 1, 2, 3, 2, 0, 0, 211, 0, 0, 3, 1, 1, 0, 0, 1, 2, 6652166512, 371, 3, 0};
+inline uint64_t args3prev[NARGS_] = { 0, 1, 665, 1, 0, 665, 0, 0, 0, 9814671379, 265, 1, 0, 0, 3, 1, 2, 0, 0, 0, 9814671382, 265, 1, 0, 0, 3, 1, 8388608, 1, 2, 1, 8388608, 0, 0, 0, 9814671382, 1, 8388608, 265, 1, 0, 3, 9814671379, 265, 2, 0, 9814671382, 1, 8388608, 265, 3, 1, 9814671382, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166374, 371, 1, 0, 0, 5578424343, 128, 3, 1, 5578424340, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424340, 1, 8388608, 128, 3, 1, 5578424343, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671478, 265, 3, 0, 0, 46, 1, 54, 1, 8388608, 665, 2, 3, 1, 8388608, 665, 3, 4, 1, 8388608, 665, 4, 45, 665, 5, 2, 665, 6, 46, 665, 7, 47, 665, 8, 48, 665, 9, 49, 665, 10, 50, 665, 11, 51, 665, 12, 52, 665, 13, 53, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671385, 265, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 265, 13, 0, 0, 46, 1, 8388608, 1, 103, 1, 8388608, 2, 101, 1, 8388608, 3, 102, 1, 8388608, 4, 104, 1, 8388608, 5, 84, 1, 8388608, 6, 93, 1, 8388608, 7, 94, 1, 8388608, 8, 95, 1, 8388608, 9, 96, 1, 8388608, 10, 97, 1, 8388608, 11, 98, 1, 8388608, 12, 99, 1, 8388608, 13, 100, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 9814671388, 1, 8388608, 265, 13, 0, 3, 9814671385, 265, 2, 0, 9814671388, 1, 8388608, 265, 3, 1, 9814671388, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166377, 371, 1, 0, 0, 5578424349, 128, 3, 1, 5578424346, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424346, 1, 8388608, 128, 3, 1, 5578424349, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671481, 265, 3, 0, 0, 58, 665, 5, 1, 59, 665, 6, 2, 0, 1, 0, 60, 665, 7, 1, 2, 0, 0, 61, 665, 8, 2, 1, 0, 0, 62, 665, 9, 1, 2, 0, 0, 63, 665, 10, 2, 1, 0, 0, 64, 665, 11, 1, 2, 0, 0, 65, 665, 12, 2, 1, 0, 0, 66, 665, 13, 1, 2, 0, 0, 67, 665, 14, 2, 1, 0, 0, 68, 665, 15, 1, 2, 0, 0, 69, 665, 16, 2, 1, 0, 0, 70, 665, 17, 1, 2, 0, 0, 71, 665, 18, 2, 1, 0, 0, 72, 665, 19, 1, 2, 0, 0, 73, 665, 20, 2, 1, 0, 0, 74, 665, 21, 1, 2, 0, 0, 75, 665, 22, 2, 1, 0, 0, 76, 665, 23, 1, 2, 0, 0, 77, 665, 24, 2, 1, 0, 0, 78, 665, 25, 1, 2, 0, 0, 79, 665, 26, 2, 1, 0, 0, 80, 665, 27, 1, 2, 0, 0, 81, 665, 28, 2, 1, 0, 0, 82, 665, 29, 1, 2, 0, 0, 83, 665, 30, 2, 1, 0, 0, 84, 665, 31, 1, 2, 0, 0, 85, 665, 32, 2, 1, 0, 0, 86, 665, 33, 1, 2, 0, 0, 87, 665, 34, 2, 1, 0, 0, 88, 665, 35, 1, 2, 0, 0, 89, 665, 36, 2, 1, 0, 9814671360, 265, 2, 0, 4, 9814671361, 265, 0, 0, 4, 1, 8388608, 9814671361, 1, 8388608, 265, 0, 3, 9814671360, 265, 2, 0, 9814671361, 1, 8388608, 265, 3, 1, 9814671361, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166380, 371, 1, 0, 0, 5578424321, 128, 3, 1, 5578424320, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424320, 1, 8388608, 128, 3, 1, 5578424321, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671484, 265, 3, 0, 0, 90, 665, 5, 1, 91, 665, 6, 2, 0, 1, 0, 92, 665, 7, 1, 2, 0, 0, 93, 665, 8, 2, 1, 0, 0, 94, 665, 9, 1, 2, 0, 0, 95, 665, 10, 2, 1, 0, 0, 96, 665, 11, 1, 2, 0, 0, 97, 665, 12, 2, 1, 0, 0, 98, 665, 13, 1, 2, 0, 0, 99, 665, 14, 2, 1, 0, 0, 100, 665, 15, 1, 2, 0, 0, 101, 665, 16, 2, 1, 0, 0, 102, 665, 17, 1, 2, 0, 0, 103, 665, 18, 2, 1, 0, 0, 104, 665, 19, 1, 2, 0, 0, 105, 665, 20, 2, 1, 0, 0, 106, 665, 21, 1, 2, 0, 0, 107, 665, 22, 2, 1, 0, 0, 108, 665, 23, 1, 2, 0, 0, 109, 665, 24, 2, 1, 0, 0, 110, 665, 25, 1, 2, 0, 0, 111, 665, 26, 2, 1, 0, 0, 112, 665, 27, 1, 2, 0, 0, 113, 665, 28, 2, 1, 0, 0, 114, 665, 29, 1, 2, 0, 0, 115, 665, 30, 2, 1, 0, 0, 116, 665, 31, 1, 2, 0, 0, 117, 665, 32, 2, 1, 0, 0, 118, 665, 33, 1, 2, 0, 0, 119, 665, 34, 2, 1, 0, 0, 120, 665, 35, 1, 2, 0, 0, 121, 665, 36, 2, 1, 0, 9814671362, 265, 2, 0, 4, 9814671363, 265, 0, 0, 4, 1, 8388608, 9814671363, 1, 8388608, 265, 0, 3, 9814671362, 265, 2, 0, 9814671363, 1, 8388608, 265, 3, 1, 9814671363, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166383, 371, 1, 0, 0, 5578424323, 128, 3, 1, 5578424322, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424322, 1, 8388608, 128, 3, 1, 5578424323, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671487, 265, 3, 0, 0, 122, 665, 5, 1, 123, 665, 6, 2, 0, 1, 0, 124, 665, 7, 1, 2, 0, 0, 125, 665, 8, 2, 1, 0, 0, 126, 665, 9, 1, 2, 0, 0, 127, 665, 10, 2, 1, 0, 0, 128, 665, 11, 1, 2, 0, 0, 129, 665, 12, 2, 1, 0, 0, 130, 665, 13, 1, 2, 0, 0, 131, 665, 14, 2, 1, 0, 0, 132, 665, 15, 1, 2, 0, 0, 133, 665, 16, 2, 1, 0, 0, 134, 665, 17, 1, 2, 0, 0, 135, 665, 18, 2, 1, 0, 0, 136, 665, 19, 1, 2, 0, 0, 137, 665, 20, 2, 1, 0, 0, 138, 665, 21, 1, 2, 0, 0, 139, 665, 22, 2, 1, 0, 0, 140, 665, 23, 1, 2, 0, 0, 141, 665, 24, 2, 1, 0, 0, 142, 665, 25, 1, 2, 0, 0, 143, 665, 26, 2, 1, 0, 0, 144, 665, 27, 1, 2, 0, 0, 145, 665, 28, 2, 1, 0, 0, 146, 665, 29, 1, 2, 0, 0, 147, 665, 30, 2, 1, 0, 0, 148, 665, 31, 1, 2, 0, 0, 149, 665, 32, 2, 1, 0, 0, 150, 665, 33, 1, 2, 0, 0, 151, 665, 34, 2, 1, 0, 0, 152, 665, 35, 1, 2, 0, 0, 153, 665, 36, 2, 1, 0, 9814671364, 265, 2, 0, 4, 9814671365, 265, 0, 0, 4, 1, 8388608, 9814671365, 1, 8388608, 265, 0, 3, 9814671364, 265, 2, 0, 9814671365, 1, 8388608, 265, 3, 1, 9814671365, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166386, 371, 1, 0, 0, 5578424325, 128, 3, 1, 5578424324, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424324, 1, 8388608, 128, 3, 1, 5578424325, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671490, 265, 3, 0, 0, 154, 665, 5, 1, 155, 665, 6, 2, 0, 1, 0, 156, 665, 7, 1, 2, 0, 0, 157, 665, 8, 2, 1, 0, 0, 158, 665, 9, 1, 2, 0, 0, 159, 665, 10, 2, 1, 0, 0, 160, 665, 11, 1, 2, 0, 0, 161, 665, 12, 2, 1, 0, 0, 162, 665, 13, 1, 2, 0, 0, 163, 665, 14, 2, 1, 0, 0, 164, 665, 15, 1, 2, 0, 0, 165, 665, 16, 2, 1, 0, 0, 166, 665, 17, 1, 2, 0, 0, 167, 665, 18, 2, 1, 0, 0, 168, 665, 19, 1, 2, 0, 0, 169, 665, 20, 2, 1, 0, 0, 170, 665, 21, 1, 2, 0, 0, 171, 665, 22, 2, 1, 0, 0, 172, 665, 23, 1, 2, 0, 0, 173, 665, 24, 2, 1, 0, 0, 174, 665, 25, 1, 2, 0, 0, 175, 665, 26, 2, 1, 0, 0, 176, 665, 27, 1, 2, 0, 0, 177, 665, 28, 2, 1, 0, 0, 178, 665, 29, 1, 2, 0, 0, 179, 665, 30, 2, 1, 0, 0, 180, 665, 31, 1, 2, 0, 0, 181, 665, 32, 2, 1, 0, 0, 182, 665, 33, 1, 2, 0, 0, 183, 665, 34, 2, 1, 0, 0, 184, 665, 35, 1, 2, 0, 0, 186, 665, 36, 2, 1, 0, 9814671366, 265, 2, 0, 4, 9814671367, 265, 0, 0, 4, 1, 8388608, 9814671367, 1, 8388608, 265, 0, 3, 9814671366, 265, 2, 0, 9814671367, 1, 8388608, 265, 3, 1, 9814671367, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166389, 371, 1, 0, 0, 5578424327, 128, 3, 1, 5578424326, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424326, 1, 8388608, 128, 3, 1, 5578424327, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671493, 265, 3, 0, 0, 34, 35, 3, 0, 36, 0, 187, 665, 5, 1, 188, 665, 6, 2, 0, 1, 0, 189, 665, 7, 1, 2, 0, 0, 190, 665, 8, 2, 1, 0, 0, 191, 665, 9, 1, 2, 0, 0, 192, 665, 10, 2, 1, 0, 0, 193, 665, 11, 1, 2, 0, 0, 194, 665, 12, 2, 1, 0, 0, 195, 665, 13, 1, 2, 0, 0, 196, 665, 14, 2, 1, 0, 0, 197, 665, 15, 1, 2, 0, 0, 198, 665, 16, 2, 1, 0, 0, 199, 665, 17, 1, 2, 0, 0, 200, 665, 18, 2, 1, 0, 0, 202, 665, 19, 1, 2, 0, 0, 203, 665, 20, 2, 1, 0, 0, 204, 665, 21, 1, 2, 0, 0, 205, 665, 22, 2, 1, 0, 0, 206, 665, 23, 1, 2, 0, 0, 207, 665, 24, 2, 1, 0, 0, 208, 665, 25, 1, 2, 0, 0, 209, 665, 26, 2, 1, 0, 0, 210, 665, 27, 1, 2, 0, 0, 211, 665, 28, 2, 1, 0, 0, 212, 665, 29, 1, 2, 0, 0, 213, 665, 30, 2, 1, 0, 0, 214, 665, 31, 1, 2, 0, 0, 215, 665, 32, 2, 1, 0, 0, 216, 665, 33, 1, 2, 0, 0, 185, 665, 34, 2, 1, 0, 0, 201, 665, 35, 1, 2, 0, 0, 217, 665, 36, 2, 1, 0, 0, 3, 0, 9814671391, 265, 2, 0, 0, 106, 1, 105, 0, 0, 0, 9814671394, 265, 1, 0, 0, 106, 1, 8388608, 1, 105, 1, 8388608, 0, 0, 0, 9814671394, 1, 8388608, 265, 1, 0, 3, 9814671391, 265, 2, 0, 9814671394, 1, 8388608, 265, 3, 1, 9814671394, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166392, 371, 1, 0, 0, 5578424355, 128, 3, 1, 5578424352, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424352, 1, 8388608, 128, 3, 1, 5578424355, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671496, 265, 3, 0, 0, 225, 665, 9814671368, 265, 0, 0, 107, 9814671369, 265, 0, 0, 107, 1, 8388608, 9814671369, 1, 8388608, 265, 0, 3, 9814671368, 265, 2, 0, 9814671369, 1, 8388608, 265, 3, 1, 9814671369, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166395, 371, 1, 0, 0, 5578424329, 128, 3, 1, 5578424328, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424328, 1, 8388608, 128, 3, 1, 5578424329, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671499, 265, 3, 0, 0, 226, 665, 9814671370, 265, 0, 0, 107, 9814671371, 265, 0, 0, 107, 1, 8388608, 9814671371, 1, 8388608, 265, 0, 3, 9814671370, 265, 2, 0, 9814671371, 1, 8388608, 265, 3, 1, 9814671371, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166398, 371, 1, 0, 0, 5578424331, 128, 3, 1, 5578424330, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424330, 1, 8388608, 128, 3, 1, 5578424331, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671502, 265, 3, 0, 0, 227, 665, 9814671372, 265, 0, 0, 107, 9814671373, 265, 0, 0, 107, 1, 8388608, 9814671373, 1, 8388608, 265, 0, 3, 9814671372, 265, 2, 0, 9814671373, 1, 8388608, 265, 3, 1, 9814671373, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166401, 371, 1, 0, 0, 5578424333, 128, 3, 1, 5578424332, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424332, 1, 8388608, 128, 3, 1, 5578424333, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671505, 265, 3, 0, 0, 0ULL, 1, 258, 665, 2, 228, 665, 3, 230, 665, 4, 259, 665, 5, 0ULL, 6, 232, 665, 7, 260, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671397, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671400, 1, 8388608, 265, 7, 0, 3, 9814671397, 265, 2, 0, 9814671400, 1, 8388608, 265, 3, 1, 9814671400, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166404, 371, 1, 0, 0, 5578424361, 128, 3, 1, 5578424358, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424358, 1, 8388608, 128, 3, 1, 5578424361, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671508, 265, 3, 0, 0, 266, 1, 8388608, 665, 265, 1, 8388608, 665, 1, 258, 665, 2, 229, 665, 3, 231, 665, 4, 260, 665, 5, 264, 665, 6, 233, 665, 7, 261, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671403, 265, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 265, 7, 0, 0, 110, 1, 8388608, 1, 108, 1, 8388608, 2, 3, 1, 8388608, 3, 2, 1, 8388608, 4, 109, 1, 8388608, 5, 111, 1, 8388608, 6, 112, 1, 8388608, 7, 113, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 9814671406, 1, 8388608, 265, 7, 0, 3, 9814671403, 265, 2, 0, 9814671406, 1, 8388608, 265, 3, 1, 9814671406, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166407, 371, 1, 0, 0, 5578424367, 128, 3, 1, 5578424364, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424364, 1, 8388608, 128, 3, 1, 5578424367, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671511, 265, 3, 0, 0, 294, 665, 9814671374, 265, 0, 0, 2, 9814671375, 265, 0, 0, 2, 1, 8388608, 9814671375, 1, 8388608, 265, 0, 3, 9814671374, 265, 2, 0, 9814671375, 1, 8388608, 265, 3, 1, 9814671375, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166410, 371, 1, 0, 0, 5578424335, 128, 3, 1, 5578424334, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424334, 1, 8388608, 128, 3, 1, 5578424335, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671514, 265, 3, 0, 0, 296, 665, 297, 665, 2, 1ULL, 0, 0, 2, 298, 665, 6652166188, 371, 0, 146, 0, 2, 298, 665, 1, 1ULL, 0, 0, 1, 294, 665, 1, 0, 2, 0, 128ULL, 6652166188, 371, 6652166189, 371, 1, 0, 0, 6652166189, 371, 138, 1, 0, 286, 665, 17, 1, 0, 6652166189, 371, 139, 1, 0, 287, 665, 18, 1, 0, 6652166189, 371, 140, 1, 0, 288, 665, 19, 1, 0, 6652166189, 371, 141, 1, 0, 289, 665, 20, 1, 0, 6652166189, 371, 142, 1, 0, 290, 665, 21, 1, 0, 6652166189, 371, 143, 1, 0, 291, 665, 22, 1, 0, 6652166189, 371, 144, 1, 0, 292, 665, 23, 1, 0, 6652166189, 371, 145, 1, 0, 293, 665, 24, 1, 25, 305, 665, 26, 306, 665, 27, 307, 665, 28, 308, 665, 29, 301, 665, 30, 302, 665, 31, 303, 665, 32, 304, 665, 0, 267, 665, 1, 268, 665, 2, 269, 665, 3, 270, 665, 4, 271, 665, 5, 272, 665, 6, 273, 665, 7, 274, 665, 8, 275, 665, 9, 276, 665, 10, 277, 665, 11, 278, 665, 12, 279, 665, 13, 280, 665, 14, 281, 665, 15, 282, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 265, 1, 1, 0, 146, 0, 17, 0, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 1, 9814671409, 265, 1, 0, 0, 6652166365, 371, 9814671409, 265, 1, 0, 267, 1, 8388608, 665, 1, 268, 1, 8388608, 665, 2, 269, 1, 8388608, 665, 3, 270, 1, 8388608, 665, 4, 271, 1, 8388608, 665, 5, 272, 1, 8388608, 665, 6, 273, 1, 8388608, 665, 7, 274, 1, 8388608, 665, 8, 275, 1, 8388608, 665, 9, 276, 1, 8388608, 665, 10, 277, 1, 8388608, 665, 11, 278, 1, 8388608, 665, 12, 279, 1, 8388608, 665, 13, 280, 1, 8388608, 665, 14, 281, 1, 8388608, 665, 15, 282, 1, 8388608, 665, 16, 123, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 9814671409, 1, 8388608, 265, 1, 1, 3, 6652166365, 371, 2, 0, 9814671409, 1, 8388608, 265, 3, 1, 9814671409, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166413, 371, 1, 0, 0, 5578424373, 128, 3, 1, 5578424370, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424370, 1, 8388608, 128, 3, 1, 5578424373, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671517, 265, 3, 0, 0, 311, 665, 1, 314, 665, 2, 315, 665, 3, 316, 665, 4, 317, 665, 5, 318, 665, 6, 319, 665, 7, 320, 665, 8, 321, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671412, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671415, 1, 8388608, 265, 8, 0, 3, 9814671412, 265, 2, 0, 9814671415, 1, 8388608, 265, 3, 1, 9814671415, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166416, 371, 1, 0, 0, 5578424379, 128, 3, 1, 5578424376, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424376, 1, 8388608, 128, 3, 1, 5578424379, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671520, 265, 3, 0, 0, 397, 665, 1, 398, 665, 2, 400, 665, 3, 399, 665, 4, 401, 665, 5, 402, 665, 6, 403, 665, 7, 404, 665, 8, 405, 665, 9, 406, 665, 10, 407, 665, 11, 408, 665, 12, 409, 665, 13, 410, 665, 14, 411, 665, 15, 375, 665, 16, 384, 665, 17, 377, 665, 18, 376, 665, 19, 381, 665, 20, 382, 665, 21, 383, 665, 22, 380, 665, 23, 378, 665, 24, 379, 665, 25, 385, 665, 26, 386, 665, 27, 387, 665, 28, 396, 665, 29, 389, 665, 30, 388, 665, 31, 393, 665, 32, 395, 665, 33, 394, 665, 34, 392, 665, 35, 391, 665, 36, 390, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671418, 265, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 265, 36, 0, 0, 148, 1, 8388608, 1, 149, 1, 8388608, 2, 150, 1, 8388608, 3, 151, 1, 8388608, 4, 152, 1, 8388608, 5, 153, 1, 8388608, 6, 154, 1, 8388608, 7, 155, 1, 8388608, 8, 156, 1, 8388608, 9, 157, 1, 8388608, 10, 158, 1, 8388608, 11, 159, 1, 8388608, 12, 160, 1, 8388608, 13, 161, 1, 8388608, 14, 162, 1, 8388608, 15, 163, 1, 8388608, 16, 164, 1, 8388608, 17, 165, 1, 8388608, 18, 166, 1, 8388608, 19, 167, 1, 8388608, 20, 168, 1, 8388608, 21, 169, 1, 8388608, 22, 170, 1, 8388608, 23, 171, 1, 8388608, 24, 172, 1, 8388608, 25, 173, 1, 8388608, 26, 174, 1, 8388608, 27, 175, 1, 8388608, 28, 176, 1, 8388608, 29, 177, 1, 8388608, 30, 178, 1, 8388608, 31, 179, 1, 8388608, 32, 180, 1, 8388608, 33, 181, 1, 8388608, 34, 182, 1, 8388608, 35, 183, 1, 8388608, 36, 184, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671421, 1, 8388608, 265, 36, 0, 3, 9814671418, 265, 2, 0, 9814671421, 1, 8388608, 265, 3, 1, 9814671421, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166419, 371, 1, 0, 0, 5578424385, 128, 3, 1, 5578424382, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424382, 1, 8388608, 128, 3, 1, 5578424385, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671523, 265, 3, 0, 0, 188, 1, 414, 665, 2, 418, 665, 3, 422, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671424, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671427, 1, 8388608, 265, 3, 0, 3, 9814671424, 265, 2, 0, 9814671427, 1, 8388608, 265, 3, 1, 9814671427, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166422, 371, 1, 0, 0, 5578424391, 128, 3, 1, 5578424388, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424388, 1, 8388608, 128, 3, 1, 5578424391, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671526, 265, 3, 0, 0, 188, 1, 415, 665, 2, 419, 665, 3, 423, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671430, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671433, 1, 8388608, 265, 3, 0, 3, 9814671430, 265, 2, 0, 9814671433, 1, 8388608, 265, 3, 1, 9814671433, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166425, 371, 1, 0, 0, 5578424397, 128, 3, 1, 5578424394, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424394, 1, 8388608, 128, 3, 1, 5578424397, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671529, 265, 3, 0, 0, 188, 1, 416, 665, 2, 420, 665, 3, 424, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671436, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671439, 1, 8388608, 265, 3, 0, 3, 9814671436, 265, 2, 0, 9814671439, 1, 8388608, 265, 3, 1, 9814671439, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166428, 371, 1, 0, 0, 5578424403, 128, 3, 1, 5578424400, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424400, 1, 8388608, 128, 3, 1, 5578424403, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671532, 265, 3, 0, 0, 188, 1, 417, 665, 2, 421, 665, 3, 425, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671442, 265, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 265, 3, 0, 0, 189, 1, 8388608, 1, 190, 1, 8388608, 2, 191, 1, 8388608, 3, 192, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 9814671445, 1, 8388608, 265, 3, 0, 3, 9814671442, 265, 2, 0, 9814671445, 1, 8388608, 265, 3, 1, 9814671445, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166431, 371, 1, 0, 0, 5578424409, 128, 3, 1, 5578424406, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424406, 1, 8388608, 128, 3, 1, 5578424409, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671535, 265, 3, 0, 0, 443, 665, 444, 665, 9, 1ULL, 0, 0, 9, 445, 665, 6652166200, 371, 0, 213, 0, 9, 445, 665, 1, 1ULL, 0, 0, 1, 440, 665, 1, 0, 9, 0, 128ULL, 6652166200, 371, 6652166202, 371, 1, 0, 3, 6652166202, 371, 4, 212, 5, 441, 665, 0, 430, 665, 1, 195, 2, 431, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 265, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 9814671451, 265, 1, 0, 0, 9814671448, 265, 9814671451, 265, 1, 0, 430, 1, 8388608, 665, 1, 195, 1, 8388608, 2, 431, 1, 8388608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 9814671451, 1, 8388608, 265, 2, 0, 3, 9814671448, 265, 2, 0, 9814671451, 1, 8388608, 265, 3, 1, 9814671451, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166434, 371, 1, 0, 0, 5578424415, 128, 3, 1, 5578424412, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424412, 1, 8388608, 128, 3, 1, 5578424415, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671538, 265, 3, 0, 10, 449, 665, 11, 450, 665, 12, 451, 665, 13, 452, 665, 14, 453, 665, 15, 454, 665, 16, 455, 665, 17, 456, 665, 18, 216, 0, 432, 665, 1, 433, 665, 2, 434, 665, 3, 435, 665, 4, 436, 665, 5, 437, 665, 6, 438, 665, 7, 439, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 265, 8, 0, 0, 9, 445, 665, 6652166201, 371, 0, 214, 0, 6652166201, 371, 0, 10, 0, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 9814671457, 265, 1, 0, 0, 9814671454, 265, 9814671457, 265, 1, 0, 432, 1, 8388608, 665, 1, 433, 1, 8388608, 665, 2, 434, 1, 8388608, 665, 3, 435, 1, 8388608, 665, 4, 436, 1, 8388608, 665, 5, 437, 1, 8388608, 665, 6, 438, 1, 8388608, 665, 7, 439, 1, 8388608, 665, 8, 196, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671457, 1, 8388608, 265, 8, 0, 3, 9814671454, 265, 2, 0, 9814671457, 1, 8388608, 265, 3, 1, 9814671457, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166437, 371, 1, 0, 0, 5578424421, 128, 3, 1, 5578424418, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424418, 1, 8388608, 128, 3, 1, 5578424421, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671541, 265, 3, 0, 0, 458, 665, 1, 461, 665, 2, 462, 665, 3, 463, 665, 4, 464, 665, 5, 465, 665, 6, 466, 665, 7, 467, 665, 8, 468, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671460, 265, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 265, 8, 0, 0, 46, 1, 8388608, 1, 37, 1, 8388608, 2, 38, 1, 8388608, 3, 39, 1, 8388608, 4, 40, 1, 8388608, 5, 41, 1, 8388608, 6, 42, 1, 8388608, 7, 43, 1, 8388608, 8, 44, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 9814671463, 1, 8388608, 265, 8, 0, 3, 9814671460, 265, 2, 0, 9814671463, 1, 8388608, 265, 3, 1, 9814671463, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166440, 371, 1, 0, 0, 5578424427, 128, 3, 1, 5578424424, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424424, 1, 8388608, 128, 3, 1, 5578424427, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671544, 265, 3, 0, 0, 477, 1, 8388608, 665, 477, 665, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 489, 665, 2, 1, 478, 1, 8388608, 665, 478, 665, 2, 0, 1, 0, 45, 1ULL, 1, 0, 9814671376, 265, 1, 0, 1ULL, 1, 1, 0, 0, 2, 9814671376, 265, 2, 0, 1, 6652166220, 371, 2, 9814671376, 265, 0, 45, 1, 8388608, 1ULL, 1, 0, 9814671376, 1, 8388608, 265, 1, 3, 6652166220, 371, 2, 0, 9814671376, 1, 8388608, 265, 3, 1, 9814671376, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 9814671547, 265, 1, 0, 0, 5578424337, 128, 3, 1, 5578424336, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424336, 1, 8388608, 128, 3, 1, 5578424337, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671550, 265, 3, 0, 0, 641, 665, 9814671377, 265, 0, 0, 45, 9814671378, 265, 0, 0, 45, 1, 8388608, 9814671378, 1, 8388608, 265, 0, 3, 9814671377, 265, 2, 0, 9814671378, 1, 8388608, 265, 3, 1, 9814671378, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166443, 371, 1, 0, 0, 5578424339, 128, 3, 1, 5578424338, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424338, 1, 8388608, 128, 3, 1, 5578424339, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671553, 265, 3, 0, 3, 553, 665, 4, 552, 665, 5, 551, 665, 6, 550, 665, 7, 549, 665, 8, 548, 665, 9, 547, 665, 10, 546, 665, 11, 562, 665, 12, 563, 665, 13, 564, 665, 14, 565, 665, 15, 566, 665, 16, 567, 665, 17, 568, 665, 18, 569, 665, 19, 570, 665, 20, 571, 665, 21, 572, 665, 22, 573, 665, 23, 576, 665, 24, 574, 665, 25, 575, 665, 26, 577, 665, 27, 634, 665, 28, 635, 665, 29, 637, 665, 30, 636, 665, 31, 639, 665, 32, 638, 665, 0, 1ULL, 607, 665, 1, 2ULL, 608, 665, 2, 0, 1, 0, 4ULL, 609, 665, 1, 2, 0, 0, 8ULL, 623, 665, 2, 1, 0, 0, 16ULL, 621, 665, 1, 2, 0, 0, 32ULL, 613, 665, 2, 1, 0, 0, 64ULL, 616, 665, 1, 2, 0, 0, 128ULL, 615, 665, 2, 1, 0, 0, 256ULL, 617, 665, 1, 2, 0, 0, 512ULL, 620, 665, 2, 1, 0, 0, 1024ULL, 619, 665, 1, 2, 0, 0, 2048ULL, 599, 665, 2, 1, 0, 0, 4096ULL, 600, 665, 1, 2, 0, 0, 8192ULL, 598, 665, 2, 1, 0, 0, 16384ULL, 597, 665, 1, 2, 0, 0, 32768ULL, 591, 665, 2, 1, 0, 0, 65536ULL, 593, 665, 1, 2, 0, 0, 131072ULL, 592, 665, 2, 1, 0, 0, 262144ULL, 610, 665, 1, 2, 0, 0, 524288ULL, 611, 665, 2, 1, 0, 0, 1048576ULL, 612, 665, 1, 2, 0, 0, 2097152ULL, 603, 665, 2, 1, 0, 0, 4194304ULL, 604, 665, 1, 2, 0, 0, 8388608ULL, 624, 665, 2, 1, 0, 0, 16777216ULL, 578, 665, 1, 2, 0, 0, 33554432ULL, 579, 665, 2, 1, 0, 0, 67108864ULL, 580, 665, 1, 2, 0, 0, 134217728ULL, 584, 665, 2, 1, 0, 0, 268435456ULL, 581, 665, 1, 2, 0, 0, 536870912ULL, 582, 665, 2, 1, 0, 0, 1073741824ULL, 587, 665, 1, 2, 0, 0, 2147483648ULL, 589, 665, 2, 1, 0, 0, 4294967296ULL, 586, 665, 1, 2, 0, 0, 8589934592ULL, 590, 665, 2, 1, 0, 0, 17179869184ULL, 588, 665, 1, 2, 0, 0, 34359738368ULL, 585, 665, 2, 1, 0, 0, 68719476736ULL, 583, 665, 1, 2, 0, 0, 137438953472ULL, 606, 665, 2, 1, 0, 0, 274877906944ULL, 605, 665, 1, 2, 0, 0, 549755813888ULL, 601, 665, 2, 1, 0, 0, 1099511627776ULL, 655, 665, 1, 2, 0, 0, 2199023255552ULL, 594, 665, 2, 1, 0, 0, 4398046511104ULL, 625, 665, 1, 2, 0, 0, 8796093022208ULL, 626, 665, 2, 1, 0, 0, 17592186044416ULL, 614, 665, 1, 2, 0, 0, 35184372088832ULL, 618, 665, 2, 1, 0, 0, 70368744177664ULL, 656, 665, 1, 2, 0, 0, 1, 1, 595, 665, 2, 596, 665, 33, 622, 665, 34, 653, 665, 35, 654, 665, 36, 542, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671466, 265, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 265, 36, 0, 0, 47, 1, 8388608, 1, 48, 1, 8388608, 2, 49, 1, 8388608, 3, 50, 1, 8388608, 4, 51, 1, 8388608, 5, 52, 1, 8388608, 6, 53, 1, 8388608, 7, 54, 1, 8388608, 8, 56, 1, 8388608, 9, 57, 1, 8388608, 10, 58, 1, 8388608, 11, 59, 1, 8388608, 12, 60, 1, 8388608, 13, 61, 1, 8388608, 14, 62, 1, 8388608, 15, 63, 1, 8388608, 16, 64, 1, 8388608, 17, 65, 1, 8388608, 18, 66, 1, 8388608, 19, 67, 1, 8388608, 20, 68, 1, 8388608, 21, 69, 1, 8388608, 22, 70, 1, 8388608, 23, 71, 1, 8388608, 24, 72, 1, 8388608, 25, 73, 1, 8388608, 26, 74, 1, 8388608, 27, 75, 1, 8388608, 28, 76, 1, 8388608, 29, 77, 1, 8388608, 30, 83, 1, 8388608, 31, 55, 1, 8388608, 32, 78, 1, 8388608, 33, 79, 1, 8388608, 34, 80, 1, 8388608, 35, 81, 1, 8388608, 36, 82, 1, 8388608, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 9814671469, 1, 8388608, 265, 36, 0, 3, 9814671466, 265, 2, 0, 9814671469, 1, 8388608, 265, 3, 1, 9814671469, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166446, 371, 1, 0, 0, 5578424433, 128, 3, 1, 5578424430, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424430, 1, 8388608, 128, 3, 1, 5578424433, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671556, 265, 3, 0, 0, 599, 665, 529, 665, 1, 600, 665, 543, 665, 2, 0, 1, 3, 2, 595, 665, 0, 601, 665, 538, 665, 1, 262144ULL, 0, 0, 65536ULL, 597, 665, 2, 1, 0, 0, 597, 665, 539, 665, 1, 2, 0, 0, 131072ULL, 598, 665, 2, 1, 0, 101, 2, 3, 13, 101, 14, 544, 665, 0, 521, 665, 613, 665, 15, 0, 614, 665, 0, 497, 665, 562, 665, 1, 505, 665, 563, 665, 2, 0, 1, 0, 513, 665, 564, 665, 1, 2, 0, 0, 506, 665, 565, 665, 2, 1, 0, 0, 521, 665, 566, 665, 1, 2, 0, 0, 529, 665, 567, 665, 2, 1, 0, 0, 561, 665, 569, 665, 1, 2, 0, 0, 537, 665, 568, 665, 2, 1, 0, 0, 538, 665, 570, 665, 1, 2, 0, 0, 539, 665, 571, 665, 2, 1, 0, 0, 540, 665, 572, 665, 1, 2, 0, 0, 541, 665, 573, 665, 2, 1, 0, 0, 574, 665, 45, 1, 2, 0, 0, 543, 665, 575, 665, 2, 1, 0, 0, 544, 665, 576, 665, 1, 2, 0, 0, 628, 665, 634, 665, 2, 1, 0, 0, 629, 665, 635, 665, 1, 2, 0, 0, 630, 665, 636, 665, 2, 1, 0, 0, 631, 665, 637, 665, 1, 2, 0, 0, 632, 665, 638, 665, 2, 1, 0, 0, 633, 665, 639, 665, 1, 2, 0, 0, 545, 665, 577, 665, 2, 1, 0, 102, 2, 553, 665, 16, 102, 0, 496, 665, 562, 665, 1, 504, 665, 563, 665, 2, 0, 1, 0, 512, 665, 564, 665, 1, 2, 0, 0, 513, 665, 565, 665, 2, 1, 0, 0, 520, 665, 566, 665, 1, 2, 0, 0, 528, 665, 567, 665, 2, 1, 0, 0, 536, 665, 568, 665, 1, 2, 0, 0, 560, 665, 569, 665, 2, 1, 0, 103, 2, 552, 665, 17, 103, 0, 495, 665, 562, 665, 1, 503, 665, 563, 665, 2, 0, 1, 0, 511, 665, 564, 665, 1, 2, 0, 0, 512, 665, 565, 665, 2, 1, 0, 0, 519, 665, 566, 665, 1, 2, 0, 0, 527, 665, 567, 665, 2, 1, 0, 0, 535, 665, 568, 665, 1, 2, 0, 0, 559, 665, 569, 665, 2, 1, 0, 104, 2, 551, 665, 18, 104, 0, 494, 665, 562, 665, 1, 502, 665, 563, 665, 2, 0, 1, 0, 510, 665, 564, 665, 1, 2, 0, 0, 511, 665, 565, 665, 2, 1, 0, 0, 518, 665, 566, 665, 1, 2, 0, 0, 526, 665, 567, 665, 2, 1, 0, 0, 534, 665, 568, 665, 1, 2, 0, 0, 558, 665, 569, 665, 2, 1, 0, 105, 2, 550, 665, 19, 105, 0, 493, 665, 562, 665, 1, 501, 665, 563, 665, 2, 0, 1, 0, 509, 665, 564, 665, 1, 2, 0, 0, 510, 665, 565, 665, 2, 1, 0, 0, 517, 665, 566, 665, 1, 2, 0, 0, 525, 665, 567, 665, 2, 1, 0, 0, 533, 665, 568, 665, 1, 2, 0, 0, 557, 665, 569, 665, 2, 1, 0, 106, 2, 549, 665, 20, 106, 0, 492, 665, 562, 665, 1, 500, 665, 563, 665, 2, 0, 1, 0, 508, 665, 564, 665, 1, 2, 0, 0, 509, 665, 565, 665, 2, 1, 0, 0, 516, 665, 566, 665, 1, 2, 0, 0, 524, 665, 567, 665, 2, 1, 0, 0, 532, 665, 568, 665, 1, 2, 0, 0, 556, 665, 569, 665, 2, 1, 0, 107, 2, 548, 665, 21, 107, 0, 491, 665, 562, 665, 1, 499, 665, 563, 665, 2, 0, 1, 0, 507, 665, 564, 665, 1, 2, 0, 0, 508, 665, 565, 665, 2, 1, 0, 0, 515, 665, 566, 665, 1, 2, 0, 0, 523, 665, 567, 665, 2, 1, 0, 0, 531, 665, 568, 665, 1, 2, 0, 0, 555, 665, 569, 665, 2, 1, 0, 108, 2, 547, 665, 22, 108, 0, 490, 665, 562, 665, 1, 498, 665, 563, 665, 2, 0, 1, 0, 506, 665, 564, 665, 1, 2, 0, 0, 507, 665, 565, 665, 2, 1, 0, 0, 514, 665, 566, 665, 1, 2, 0, 0, 522, 665, 567, 665, 2, 1, 0, 0, 530, 665, 568, 665, 1, 2, 0, 0, 554, 665, 569, 665, 2, 1, 0, 109, 2, 546, 665, 23, 109, 2, 442, 665, 0, 448, 665, 443, 665, 1, 0, 459, 665, 3, 1, 1ULL, 4, 459, 665, 0, 461, 665, 6652166202, 371, 6652166203, 371, 0, 469, 665, 5, 6652166203, 371, 0, 462, 665, 6652166202, 371, 6652166204, 371, 0, 470, 665, 6, 6652166204, 371, 0, 463, 665, 6652166202, 371, 6652166205, 371, 0, 471, 665, 7, 6652166205, 371, 0, 464, 665, 6652166202, 371, 6652166206, 371, 0, 472, 665, 8, 6652166206, 371, 0, 465, 665, 6652166202, 371, 6652166207, 371, 0, 473, 665, 9, 6652166207, 371, 0, 466, 665, 6652166202, 371, 6652166208, 371, 0, 474, 665, 10, 6652166208, 371, 0, 467, 665, 6652166202, 371, 6652166209, 371, 0, 475, 665, 11, 6652166209, 371, 0, 468, 665, 6652166202, 371, 6652166210, 371, 0, 476, 665, 12, 6652166210, 371, 0, 458, 665, 460, 665, 1, 1ULL, 0, 6652166218, 371, 1, 215, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 371, 0, 9814671472, 265, 1, 1, 0, 613, 665, 614, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671472, 265, 1, 0, 0, 6652166368, 371, 9814671472, 265, 1, 3, 442, 1, 8388608, 665, 0, 448, 1, 8388608, 665, 443, 1, 8388608, 665, 1, 0, 459, 1, 8388608, 665, 4, 1, 1ULL, 5, 459, 1, 8388608, 665, 0, 443, 1, 8388608, 665, 444, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 445, 1, 8388608, 665, 6652166200, 1, 8388608, 371, 213, 1, 8388608, 0, 0, 2, 445, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 440, 1, 8388608, 665, 1, 0, 2, 0, 6652166200, 1, 8388608, 371, 128ULL, 6652166202, 1, 8388608, 371, 1, 0, 0, 461, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166203, 1, 8388608, 371, 0, 469, 1, 8388608, 665, 2, 6652166203, 1, 8388608, 371, 0, 462, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166204, 1, 8388608, 371, 0, 470, 1, 8388608, 665, 6, 6652166204, 1, 8388608, 371, 0, 463, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166205, 1, 8388608, 371, 0, 471, 1, 8388608, 665, 7, 6652166205, 1, 8388608, 371, 0, 464, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166206, 1, 8388608, 371, 0, 472, 1, 8388608, 665, 8, 6652166206, 1, 8388608, 371, 0, 465, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166207, 1, 8388608, 371, 0, 473, 1, 8388608, 665, 9, 6652166207, 1, 8388608, 371, 0, 466, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166208, 1, 8388608, 371, 0, 474, 1, 8388608, 665, 10, 6652166208, 1, 8388608, 371, 0, 467, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166209, 1, 8388608, 371, 0, 475, 1, 8388608, 665, 11, 6652166209, 1, 8388608, 371, 0, 468, 1, 8388608, 665, 6652166202, 1, 8388608, 371, 6652166210, 1, 8388608, 371, 0, 476, 1, 8388608, 665, 12, 6652166210, 1, 8388608, 371, 0, 458, 1, 8388608, 665, 460, 1, 8388608, 665, 1, 1ULL, 0, 6652166218, 1, 8388608, 371, 215, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166218, 1, 8388608, 371, 0, 9814671472, 1, 8388608, 265, 1, 1, 3, 6652166368, 371, 2, 0, 9814671472, 1, 8388608, 265, 3, 1, 9814671472, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166449, 371, 1, 0, 0, 5578424439, 128, 3, 1, 5578424436, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424436, 1, 8388608, 128, 3, 1, 5578424439, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671559, 265, 3, 0, 13, 101, 14, 544, 665, 0, 521, 665, 617, 665, 15, 0, 618, 665, 16, 102, 17, 103, 18, 104, 19, 105, 20, 106, 21, 107, 22, 108, 23, 109, 2, 295, 665, 0, 310, 665, 296, 665, 1, 0, 312, 665, 3, 1, 1ULL, 4, 312, 665, 0, 314, 665, 6652166189, 371, 6652166190, 371, 0, 322, 665, 5, 6652166190, 371, 0, 315, 665, 6652166189, 371, 6652166191, 371, 0, 323, 665, 6, 6652166191, 371, 0, 316, 665, 6652166189, 371, 6652166192, 371, 0, 324, 665, 7, 6652166192, 371, 0, 317, 665, 6652166189, 371, 6652166193, 371, 0, 325, 665, 8, 6652166193, 371, 0, 318, 665, 6652166189, 371, 6652166194, 371, 0, 326, 665, 9, 6652166194, 371, 0, 319, 665, 6652166189, 371, 6652166195, 371, 0, 327, 665, 10, 6652166195, 371, 0, 320, 665, 6652166189, 371, 6652166196, 371, 0, 328, 665, 11, 6652166196, 371, 0, 321, 665, 6652166189, 371, 6652166197, 371, 0, 329, 665, 12, 6652166197, 371, 0, 311, 665, 313, 665, 1, 1ULL, 0, 6652166219, 371, 1, 147, 0, 2, 0, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 371, 0, 9814671475, 265, 1, 1, 0, 617, 665, 618, 665, 0, 13, 0, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 1, 9814671475, 265, 1, 0, 0, 6652166371, 371, 9814671475, 265, 1, 3, 295, 1, 8388608, 665, 0, 310, 1, 8388608, 665, 296, 1, 8388608, 665, 1, 0, 312, 1, 8388608, 665, 4, 1, 1ULL, 5, 312, 1, 8388608, 665, 0, 296, 1, 8388608, 665, 297, 1, 8388608, 665, 2, 1ULL, 0, 0, 2, 298, 1, 8388608, 665, 6652166188, 1, 8388608, 371, 146, 1, 8388608, 0, 0, 2, 298, 1, 8388608, 665, 1, 1ULL, 0, 0, 1, 294, 1, 8388608, 665, 1, 0, 2, 0, 6652166188, 1, 8388608, 371, 128ULL, 6652166189, 1, 8388608, 371, 1, 0, 0, 314, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166190, 1, 8388608, 371, 0, 322, 1, 8388608, 665, 2, 6652166190, 1, 8388608, 371, 0, 315, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166191, 1, 8388608, 371, 0, 323, 1, 8388608, 665, 6, 6652166191, 1, 8388608, 371, 0, 316, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166192, 1, 8388608, 371, 0, 324, 1, 8388608, 665, 7, 6652166192, 1, 8388608, 371, 0, 317, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166193, 1, 8388608, 371, 0, 325, 1, 8388608, 665, 8, 6652166193, 1, 8388608, 371, 0, 318, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166194, 1, 8388608, 371, 0, 326, 1, 8388608, 665, 9, 6652166194, 1, 8388608, 371, 0, 319, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166195, 1, 8388608, 371, 0, 327, 1, 8388608, 665, 10, 6652166195, 1, 8388608, 371, 0, 320, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166196, 1, 8388608, 371, 0, 328, 1, 8388608, 665, 11, 6652166196, 1, 8388608, 371, 0, 321, 1, 8388608, 665, 6652166189, 1, 8388608, 371, 6652166197, 1, 8388608, 371, 0, 329, 1, 8388608, 665, 12, 6652166197, 1, 8388608, 371, 0, 311, 1, 8388608, 665, 313, 1, 8388608, 665, 1, 1ULL, 0, 6652166219, 1, 8388608, 371, 147, 1, 8388608, 1, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 1, 1, 1, 6652166219, 1, 8388608, 371, 0, 9814671475, 1, 8388608, 265, 1, 1, 3, 6652166371, 371, 2, 0, 9814671475, 1, 8388608, 265, 3, 1, 9814671475, 265, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 6652166452, 371, 1, 0, 0, 5578424445, 128, 3, 1, 5578424442, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 5578424442, 1, 8388608, 128, 3, 1, 5578424445, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 9814671562, 265, 3, 0, 3, 0ULL, 4, 0ULL, 5, 1ULL, 6, 334, 665, 7, 335, 665, 8, 336, 665, 9, 337, 665, 10, 338, 665, 11, 339, 665, 12, 340, 665, 13, 341, 665, 14, 398, 665, 15, 0ULL, 16, 0ULL, 17, 0ULL, 0, 376, 665, 342, 665, 1, 377, 665, 346, 665, 2, 0, 1, 0, 378, 665, 350, 665, 1, 2, 0, 0, 379, 665, 354, 665, 2, 1, 0, 0, 380, 665, 358, 665, 1, 2, 0, 0, 383, 665, 366, 665, 2, 1, 0, 0, 381, 665, 362, 665, 1, 2, 0, 0, 384, 665, 330, 665, 2, 1, 0, 0, 382, 665, 370, 665, 1, 2, 0, 0, 385, 665, 357, 665, 2, 1, 0, 0, 2, 407, 665, 18, 0, 0, 376, 665, 343, 665, 1, 377, 665, 347, 665, 2, 0, 1, 0, 378, 665, 351, 665, 1, 2, 0, 0, 379, 665, 355, 665, 2, 1, 0, 0, 380, 665, 359, 665, 1, 2, 0, 0, 383, 665, 367, 665, 2, 1, 0, 0, 381, 665, 363, 665, 1, 2, 0, 0, 384, 665, 331, 665, 2, 1, 0, 0, 385, 665, 354, 665, 1, 2, 0, 0, 1, 408, 665, 19, 0, 0, 376, 665, 344, 665, 1, 377, 665, 348, 665, 2, 0, 1, 0, 378, 665, 352, 665, 1, 2, 0, 0, 379, 665, 356, 665, 2, 1, 0, 0, 380, 665, 360, 665, 1, 2, 0, 0, 383, 665, 368, 665, 2, 1, 0, 0, 381, 665, 364, 665, 1, 2, 0, 0, 384, 665, 332, 665, 2, 1, 0, 0, 385, 665, 355, 665, 1, 2, 0, 0, 1, 409, 665, 20, 0, 0, 376, 665, 345, 665, 1, 377, 665, 349, 665, 2, 0, 1, 0, 378, 665, 353, 665, 1, 2, 0, 0, 379, 665, 357, 665, 2, 1, 0, 0, 380, 665, 361, 665, 1, 2, 0, 0, 383, 665, 369, 665, 2, 1, 0, 0, 381, 665, 365, 665, 1, 2, 0, 0, 384, 665, 333, 665, 2, 1, 0, 0, 385, 665, 356, 665, 1, 2, 0, 0, 1, 410, 665, 1, 0, 0, 397, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 6652166455, 371, 0, 3, 0, 283, 665, 1, 284, 665, 2, 285, 665, 3, 267, 665, 4, 268, 665, 5, 269, 665, 6, 270, 665, 7, 271, 665, 8, 272, 665, 9, 273, 665, 10, 274, 665, 11, 275, 665, 12, 276, 665, 13, 277, 665, 14, 278, 665, 15, 279, 665, 16, 280, 665, 17, 281, 665, 18, 282, 665, 19, 285, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 9814671565, 265, 0, 3, 0, 102, 1, 103, 2, 104, 3, 105, 4, 106, 5, 107, 6, 108, 7, 109, 8, 605, 665, 620, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 6652166458, 371, 0, 3, 0, 234, 665, 1, 235, 665, 2, 236, 665, 3, 237, 665, 4, 238, 665, 5, 239, 665, 6, 240, 665, 7, 241, 665, 8, 266, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 9814671568, 265, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 0ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 102, 37, 103, 38, 104, 39, 105, 40, 106, 41, 107, 42, 108, 43, 109, 44, 607, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 6652166461, 371, 0, 3, 1, 221, 665, 2, 222, 665, 3, 223, 665, 4, 224, 665, 0, 65536ULL, 59, 665, 53, 0, 58, 665, 5, 53, 0, 65536ULL, 61, 665, 54, 0, 60, 665, 6, 54, 0, 65536ULL, 63, 665, 55, 0, 62, 665, 7, 55, 0, 65536ULL, 65, 665, 56, 0, 64, 665, 8, 56, 0, 65536ULL, 67, 665, 57, 0, 66, 665, 9, 57, 0, 65536ULL, 69, 665, 58, 0, 68, 665, 10, 58, 0, 65536ULL, 71, 665, 59, 0, 70, 665, 11, 59, 0, 65536ULL, 73, 665, 60, 0, 72, 665, 12, 60, 0, 65536ULL, 75, 665, 61, 0, 74, 665, 13, 61, 0, 65536ULL, 77, 665, 62, 0, 76, 665, 14, 62, 0, 65536ULL, 79, 665, 63, 0, 78, 665, 15, 63, 0, 65536ULL, 81, 665, 64, 0, 80, 665, 16, 64, 0, 65536ULL, 83, 665, 65, 0, 82, 665, 17, 65, 0, 65536ULL, 85, 665, 66, 0, 84, 665, 18, 66, 0, 65536ULL, 87, 665, 67, 0, 86, 665, 19, 67, 0, 65536ULL, 89, 665, 68, 0, 88, 665, 20, 68, 0, 65536ULL, 91, 665, 69, 0, 90, 665, 21, 69, 0, 65536ULL, 93, 665, 70, 0, 92, 665, 22, 70, 0, 65536ULL, 95, 665, 71, 0, 94, 665, 23, 71, 0, 65536ULL, 97, 665, 72, 0, 96, 665, 24, 72, 0, 65536ULL, 99, 665, 73, 0, 98, 665, 25, 73, 0, 65536ULL, 101, 665, 74, 0, 100, 665, 26, 74, 0, 65536ULL, 103, 665, 75, 0, 102, 665, 27, 75, 0, 65536ULL, 105, 665, 76, 0, 104, 665, 28, 76, 0, 65536ULL, 107, 665, 77, 0, 106, 665, 29, 77, 0, 65536ULL, 109, 665, 78, 0, 108, 665, 30, 78, 0, 65536ULL, 111, 665, 79, 0, 110, 665, 31, 79, 0, 65536ULL, 113, 665, 80, 0, 112, 665, 32, 80, 0, 65536ULL, 115, 665, 81, 0, 114, 665, 33, 81, 0, 65536ULL, 117, 665, 82, 0, 116, 665, 34, 82, 0, 65536ULL, 119, 665, 83, 0, 118, 665, 35, 83, 0, 65536ULL, 121, 665, 84, 0, 120, 665, 36, 84, 0, 65536ULL, 139, 665, 93, 0, 138, 665, 37, 93, 0, 65536ULL, 141, 665, 94, 0, 140, 665, 38, 94, 0, 65536ULL, 143, 665, 95, 0, 142, 665, 39, 95, 0, 65536ULL, 145, 665, 96, 0, 144, 665, 40, 96, 0, 65536ULL, 147, 665, 97, 0, 146, 665, 41, 97, 0, 65536ULL, 149, 665, 98, 0, 148, 665, 42, 98, 0, 65536ULL, 151, 665, 99, 0, 150, 665, 43, 99, 0, 65536ULL, 153, 665, 100, 0, 152, 665, 0, 100, 44, 218, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 9814671571, 265, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 513, 665, 21, 512, 665, 22, 511, 665, 23, 510, 665, 24, 509, 665, 25, 508, 665, 26, 507, 665, 27, 506, 665, 28, 521, 665, 29, 520, 665, 30, 519, 665, 31, 518, 665, 32, 517, 665, 33, 516, 665, 34, 515, 665, 35, 514, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 102, 45, 103, 46, 104, 47, 105, 48, 106, 49, 107, 50, 108, 51, 109, 52, 608, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166464, 371, 0, 3, 1, 221, 665, 2, 222, 665, 3, 223, 665, 4, 224, 665, 5, 53, 6, 54, 7, 55, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 78, 31, 79, 32, 80, 33, 81, 34, 82, 35, 83, 36, 84, 0, 65536ULL, 123, 665, 85, 0, 122, 665, 37, 85, 0, 65536ULL, 125, 665, 86, 0, 124, 665, 38, 86, 0, 65536ULL, 127, 665, 87, 0, 126, 665, 39, 87, 0, 65536ULL, 129, 665, 88, 0, 128, 665, 40, 88, 0, 65536ULL, 131, 665, 89, 0, 130, 665, 41, 89, 0, 65536ULL, 133, 665, 90, 0, 132, 665, 42, 90, 0, 65536ULL, 135, 665, 91, 0, 134, 665, 43, 91, 0, 65536ULL, 137, 665, 92, 0, 136, 665, 0, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 219, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 9814671574, 265, 0, 3, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 1ULL, 4, 497, 665, 5, 496, 665, 6, 495, 665, 7, 494, 665, 8, 493, 665, 9, 492, 665, 10, 491, 665, 11, 490, 665, 12, 505, 665, 13, 504, 665, 14, 503, 665, 15, 502, 665, 16, 501, 665, 17, 500, 665, 18, 499, 665, 19, 498, 665, 20, 497, 665, 21, 496, 665, 22, 495, 665, 23, 494, 665, 24, 493, 665, 25, 492, 665, 26, 491, 665, 27, 490, 665, 28, 505, 665, 29, 504, 665, 30, 503, 665, 31, 502, 665, 32, 501, 665, 33, 500, 665, 34, 499, 665, 35, 498, 665, 36, 529, 665, 37, 528, 665, 38, 527, 665, 39, 526, 665, 40, 525, 665, 41, 524, 665, 42, 523, 665, 43, 522, 665, 44, 102, 45, 103, 46, 104, 47, 105, 48, 106, 49, 107, 50, 108, 51, 109, 52, 609, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 6652166467, 371, 0, 3, 0, 221, 665, 1, 222, 665, 2, 223, 665, 3, 224, 665, 4, 53, 5, 54, 6, 55, 7, 56, 8, 57, 9, 58, 10, 59, 11, 60, 12, 61, 13, 62, 14, 63, 15, 64, 16, 65, 17, 66, 18, 67, 19, 68, 20, 69, 21, 70, 22, 71, 23, 72, 24, 73, 25, 74, 26, 75, 27, 76, 28, 77, 29, 78, 30, 79, 31, 80, 32, 81, 33, 82, 34, 83, 35, 84, 36, 85, 37, 86, 38, 87, 39, 88, 40, 89, 41, 90, 42, 91, 43, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 220, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 9814671577, 265, 0, 3, 0, 622, 665, 1, 497, 665, 2, 496, 665, 3, 495, 665, 4, 494, 665, 5, 493, 665, 6, 492, 665, 7, 491, 665, 8, 490, 665, 9, 505, 665, 10, 504, 665, 11, 503, 665, 12, 502, 665, 13, 501, 665, 14, 500, 665, 15, 499, 665, 16, 498, 665, 17, 102, 18, 103, 19, 104, 20, 105, 21, 106, 22, 107, 23, 108, 24, 109, 25, 602, 665, 26, 621, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 6652166470, 371, 0, 3, 0, 263, 665, 1, 234, 665, 2, 235, 665, 3, 236, 665, 4, 237, 665, 5, 238, 665, 6, 239, 665, 7, 240, 665, 8, 241, 665, 9, 242, 665, 10, 243, 665, 11, 244, 665, 12, 245, 665, 13, 246, 665, 14, 247, 665, 15, 248, 665, 16, 249, 665, 17, 250, 665, 18, 251, 665, 19, 252, 665, 20, 253, 665, 21, 254, 665, 22, 255, 665, 23, 256, 665, 24, 257, 665, 25, 262, 665, 26, 265, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 9814671580, 265, 0, 3, 0, 101, 1, 102, 2, 615, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166473, 371, 0, 3, 0, 442, 665, 1, 448, 665, 2, 446, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 9814671583, 265, 0, 3, 0, 101, 1, 102, 2, 103, 3, 104, 4, 105, 5, 106, 6, 107, 7, 108, 8, 109, 9, 640, 665, 10, 616, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 6652166476, 371, 0, 3, 0, 442, 665, 1, 449, 665, 2, 450, 665, 3, 451, 665, 4, 452, 665, 5, 453, 665, 6, 454, 665, 7, 455, 665, 8, 456, 665, 9, 457, 665, 10, 447, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 9814671586, 265, 0, 3, 0, 101, 1, 102, 2, 619, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 6652166479, 371, 0, 3, 0, 295, 665, 1, 310, 665, 2, 299, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 9814671589, 265, 0, 3, 1, 101, 0, 4294967296ULL, 103, 2, 102, 0, 0, 4294967296ULL, 105, 3, 104, 0, 0, 4294967296ULL, 107, 4, 106, 0, 0, 4294967296ULL, 109, 5, 108, 0, 0, 640, 665, 6, 620, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 6652166482, 371, 0, 3, 0, 295, 665, 1, 301, 665, 2, 302, 665, 3, 303, 665, 4, 304, 665, 5, 309, 665, 6, 300, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 9814671592, 265, 0, 3, 0, 101, 1, 45, 2, 604, 665, 3, 102, 4, 103, 5, 104, 6, 105, 7, 106, 8, 107, 9, 108, 10, 109, 11, 603, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 6652166485, 371, 0, 3, 0, 477, 665, 1, 478, 665, 2, 480, 665, 3, 481, 665, 4, 482, 665, 5, 483, 665, 6, 484, 665, 7, 485, 665, 8, 486, 665, 9, 487, 665, 10, 488, 665, 11, 479, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 9814671595, 265, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 513, 665, 4, 512, 665, 5, 511, 665, 6, 510, 665, 7, 509, 665, 8, 508, 665, 9, 507, 665, 10, 506, 665, 11, 0ULL, 12, 0ULL, 13, 0ULL, 14, 0ULL, 15, 657, 665, 16, 658, 665, 17, 659, 665, 18, 660, 665, 19, 606, 665, 605, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 9814671598, 265, 0, 3, 0, 283, 665, 1, 284, 665, 2, 285, 665, 3, 267, 665, 4, 268, 665, 5, 269, 665, 6, 270, 665, 7, 271, 665, 8, 272, 665, 9, 273, 665, 10, 274, 665, 11, 275, 665, 12, 276, 665, 13, 277, 665, 14, 278, 665, 15, 279, 665, 16, 280, 665, 17, 281, 665, 18, 282, 665, 19, 283, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 9814671601, 265, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 497, 665, 4, 496, 665, 5, 495, 665, 6, 494, 665, 7, 493, 665, 8, 0ULL, 9, 505, 665, 10, 504, 665, 11, 657, 665, 12, 658, 665, 13, 659, 665, 14, 660, 665, 15, 661, 665, 16, 662, 665, 17, 663, 665, 18, 664, 665, 19, 492, 665, 20, 491, 665, 21, 490, 665, 22, 503, 665, 23, 502, 665, 24, 501, 665, 25, 500, 665, 26, 499, 665, 27, 498, 665, 28, 606, 665, 605, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 9814671604, 265, 0, 3, 0, 283, 665, 1, 284, 665, 2, 285, 665, 3, 267, 665, 4, 268, 665, 5, 269, 665, 6, 270, 665, 7, 271, 665, 8, 272, 665, 9, 273, 665, 10, 274, 665, 11, 275, 665, 12, 276, 665, 13, 277, 665, 14, 278, 665, 15, 279, 665, 16, 280, 665, 17, 281, 665, 18, 282, 665, 19, 0ULL, 20, 0ULL, 21, 0ULL, 22, 0ULL, 23, 0ULL, 24, 0ULL, 25, 0ULL, 26, 0ULL, 27, 0ULL, 28, 284, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 9814671607, 265, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 0, 661, 665, 5, 662, 665, 6, 663, 665, 7, 664, 665, 8, 102, 9, 103, 10, 104, 11, 105, 12, 106, 13, 107, 14, 108, 15, 109, 16, 640, 665, 17, 606, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 6652166488, 371, 0, 3, 0, 342, 665, 1, 343, 665, 2, 344, 665, 3, 345, 665, 4, 362, 665, 5, 363, 665, 6, 364, 665, 7, 365, 665, 8, 350, 665, 9, 351, 665, 10, 352, 665, 11, 353, 665, 12, 354, 665, 13, 355, 665, 14, 356, 665, 15, 357, 665, 16, 412, 665, 2ULL, 17, 400, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 9814671610, 265, 0, 3, 0, 4294967296ULL, 536, 665, 1, 0, 537, 665, 0, 4294967296ULL, 534, 665, 2, 0, 535, 665, 0, 4294967296ULL, 532, 665, 3, 0, 533, 665, 0, 4294967296ULL, 530, 665, 4, 0, 531, 665, 5, 661, 665, 6, 662, 665, 7, 663, 665, 8, 664, 665, 9, 521, 665, 10, 520, 665, 11, 519, 665, 12, 518, 665, 13, 517, 665, 14, 516, 665, 15, 515, 665, 16, 514, 665, 0, 4294967296ULL, 103, 17, 102, 0, 0, 4294967296ULL, 105, 18, 104, 0, 0, 4294967296ULL, 107, 19, 106, 0, 0, 4294967296ULL, 109, 20, 108, 0, 0, 640, 665, 21, 605, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 6652166491, 371, 0, 3, 0, 342, 665, 1, 343, 665, 2, 344, 665, 3, 345, 665, 4, 362, 665, 5, 363, 665, 6, 364, 665, 7, 365, 665, 8, 350, 665, 9, 351, 665, 10, 352, 665, 11, 353, 665, 12, 354, 665, 13, 355, 665, 14, 356, 665, 15, 357, 665, 16, 346, 665, 17, 347, 665, 18, 348, 665, 19, 349, 665, 20, 412, 665, 2ULL, 21, 399, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 9814671613, 265, 0, 3, 0, 0ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 102, 19, 103, 20, 104, 21, 105, 22, 106, 23, 107, 24, 108, 25, 109, 26, 513, 665, 27, 610, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166494, 371, 0, 3, 0, 3, 665, 1, 4, 665, 2, 5, 665, 3, 6, 665, 4, 7, 665, 5, 8, 665, 6, 9, 665, 7, 10, 665, 8, 11, 665, 9, 12, 665, 10, 13, 665, 11, 14, 665, 12, 15, 665, 13, 16, 665, 14, 17, 665, 15, 18, 665, 16, 19, 665, 17, 20, 665, 18, 37, 665, 19, 38, 665, 20, 39, 665, 21, 40, 665, 22, 41, 665, 23, 42, 665, 24, 43, 665, 25, 44, 665, 26, 54, 665, 27, 55, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 9814671616, 265, 0, 3, 0, 1ULL, 1, 0ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 505, 665, 11, 504, 665, 12, 503, 665, 13, 502, 665, 14, 501, 665, 15, 500, 665, 16, 499, 665, 17, 498, 665, 18, 102, 19, 103, 20, 104, 21, 105, 22, 106, 23, 107, 24, 108, 25, 109, 26, 513, 665, 27, 521, 665, 28, 520, 665, 29, 519, 665, 30, 518, 665, 31, 517, 665, 32, 516, 665, 33, 515, 665, 34, 514, 665, 35, 529, 665, 36, 528, 665, 37, 527, 665, 38, 526, 665, 39, 525, 665, 40, 524, 665, 41, 523, 665, 42, 522, 665, 43, 611, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 6652166497, 371, 0, 3, 0, 3, 665, 1, 4, 665, 2, 5, 665, 3, 6, 665, 4, 7, 665, 5, 8, 665, 6, 9, 665, 7, 10, 665, 8, 11, 665, 9, 12, 665, 10, 13, 665, 11, 14, 665, 12, 15, 665, 13, 16, 665, 14, 17, 665, 15, 18, 665, 16, 19, 665, 17, 20, 665, 18, 37, 665, 19, 38, 665, 20, 39, 665, 21, 40, 665, 22, 41, 665, 23, 42, 665, 24, 43, 665, 25, 44, 665, 26, 54, 665, 27, 21, 665, 28, 22, 665, 29, 23, 665, 30, 24, 665, 31, 25, 665, 32, 26, 665, 33, 27, 665, 34, 28, 665, 35, 29, 665, 36, 30, 665, 37, 31, 665, 38, 32, 665, 39, 33, 665, 40, 34, 665, 41, 35, 665, 42, 36, 665, 43, 57, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 9814671619, 265, 0, 3, 0, 0ULL, 1, 1ULL, 2, 497, 665, 3, 496, 665, 4, 495, 665, 5, 494, 665, 6, 493, 665, 7, 492, 665, 8, 491, 665, 9, 490, 665, 10, 102, 11, 103, 12, 104, 13, 105, 14, 106, 15, 107, 16, 108, 17, 109, 18, 513, 665, 19, 521, 665, 20, 520, 665, 21, 519, 665, 22, 518, 665, 23, 517, 665, 24, 516, 665, 25, 515, 665, 26, 514, 665, 27, 612, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 6652166500, 371, 0, 3, 0, 3, 665, 1, 4, 665, 2, 5, 665, 3, 6, 665, 4, 7, 665, 5, 8, 665, 6, 9, 665, 7, 10, 665, 8, 11, 665, 9, 12, 665, 10, 37, 665, 11, 38, 665, 12, 39, 665, 13, 40, 665, 14, 41, 665, 15, 42, 665, 16, 43, 665, 17, 44, 665, 18, 54, 665, 19, 21, 665, 20, 22, 665, 21, 23, 665, 22, 24, 665, 23, 25, 665, 24, 26, 665, 25, 27, 665, 26, 28, 665, 27, 56, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 9814671622, 265, 0, 3, 0, 8589934592ULL, 417, 665, 1, 4194304ULL, 416, 665, 2, 0, 1, 0, 2048ULL, 415, 665, 1, 2, 0, 0, 1, 414, 665, 3, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 8589934592ULL, 421, 665, 1, 4194304ULL, 420, 665, 2, 0, 1, 0, 2048ULL, 419, 665, 1, 2, 0, 0, 1, 418, 665, 4, 0, 0, 12275445934081160404ULL, 3, 1, 0, 0, 4, 1, 1, 0, 2, 3, 2, 1, 0, 8589934592ULL, 425, 665, 1, 4194304ULL, 424, 665, 2, 0, 1, 0, 2048ULL, 423, 665, 1, 2, 0, 0, 1, 422, 665, 1, 0, 0, 4756475762779100925ULL, 3, 1, 0, 0, 1, 1, 1, 0, 2, 6652166503, 371, 3, 1, 0, 185, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 186, 0, 0, 3, 1, 4, 0, 0, 1, 2, 3, 2, 0, 0, 187, 0, 0, 3, 1, 1, 0, 0, 1, 2, 6652166506, 371, 3, 0, 2, 429, 665, 0, 3, 1, 2, 0, 2, 1, 2, 0, 2ULL, 429, 665, 1, 0, 428, 665, 0, 429, 665, 1, 1, 431, 665, 0, 0, 1, 428, 665, 6652166199, 371, 0, 0, 12275445934081160404ULL, 3, 1, 0, 0, 6652166199, 371, 1, 1, 0, 2, 3, 2, 1, 1, 426, 665, 0, 4756475762779100925ULL, 3, 1, 0, 0, 1, 1, 1, 0, 2, 6652166509, 371, 3, 1, 0, 209, 0, 0, 3, 1, 2, 0, 2, 1, 2, 0, 210, 0, 0, 3, 1, 6652166199, 371, 0, 0, 1, 2, 3, 2, 0, 0, 211, 0, 0, 3, 1, 1, 0, 0, 1, 2, 6652166512, 371, 3, 0};
@@ -8,7 +8,7 @@
 
 #define NR_ 4
 
-void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch)
+void ZkevmSteps::step42ns_parser_first_avx_args(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch, const uint64_t *args42)
 {
 #pragma omp parallel for
      for (uint64_t i = 0; i < nrows; i += nrowsBatch)
@@ -759,6 +759,11 @@ void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows,
      }
 }
 
+void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch)
+{
+     step42ns_parser_first_avx_args(params, nrows, nrowsBatch, args42);
+}
+
 void ZkevmSteps::step42ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch)
 {
 #pragma omp parallel for
@@ -4,7 +4,7 @@
 #define NTEMP3_ 170
 
 
-uint64_t op42[NOPS_] = { 82, 27, 57, 27, 56, 21, 27, 57, 27, 56, 21, 27, 57, 27, 56, 21, 27, 56, 26, 27, 56, 26, 27, 56, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 56, 26, 30, 56, 26, 4, 56, 26, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 30, 47, 26, 30, 47, 26, 30, 47, 26, 32, 48, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 47, 21, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 54, 26, 54, 26, 54, 26, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 8, 27, 56, 26, 27, 56, 26, 30, 47, 26, 30, 47, 26, 50, 26, 9, 35, 27, 45, 26, 27, 47, 25, 35, 35, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 24, 47, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 30, 45, 25, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 37, 49, 26, 37, 49, 26, 37, 49, 26, 37, 49, 26, 36, 32, 45, 26, 36, 32, 45, 26, 36, 32, 45, 26, 36, 32, 45, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 32, 47, 26, 32, 47, 26, 32, 47, 26, 30, 48, 28, 30, 45, 21, 50, 27, 56, 26, 1, 30, 45, 25, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 32, 48, 86, 86, 86, 32, 47, 21, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 32, 47, 7, 39, 45, 0, 1, 25, 51, 51, 21, 30, 48, 30, 47, 21, 35, 30, 45, 26, 33, 47, 29, 22, 45, 26, 50, 27, 47, 26, 27, 48, 28, 27, 45, 21, 27, 48, 27, 47, 21, 57, 29, 45, 21, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 56, 26, 30, 22, 40, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 22, 47, 1, 25, 30, 47, 26, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 47, 26, 50, 1, 37, 26, 45, 1, 2, 25, 54, 26, 53, 53, 0, 53, 0, 1, 58, 26, 53, 53, 0, 53, 0, 1, 27, 58, 26, 32, 56, 54, 0, 25, 30, 47, 26, 24, 58, 26, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 48, 32, 47, 21, 30, 47, 26, 30, 47, 26, 32, 56, 26, 30, 47, 26, 30, 48, 28, 30, 45, 21, 50, 27, 56, 26, 1, 30, 45, 25, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 32, 48, 32, 47, 21, 55, 30, 49, 21, 30, 49, 26, 51, 51, 21, 30, 48, 30, 47, 21, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 29, 22, 56, 26, 32, 47, 7, 39, 45, 0, 1, 25, 50, 27, 47, 26, 27, 48, 28, 27, 45, 21, 27, 48, 27, 47, 21, 57, 29, 45, 21, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 56, 26, 28, 47, 26, 30, 35, 45, 26, 28, 47, 26, 28, 47, 26, 30, 56, 26, 32, 28, 27, 45, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 54, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 53, 0, 47, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 1, 21, 50, 27, 56, 26, 47, 26, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 4, 21, 47, 4, 0, 25, 22, 47, 1, 25, 22, 47, 7, 22, 47, 0, 1, 25, 22, 47, 1, 25, 37, 21, 47, 37, 0, 25, 22, 47, 1, 4, 56, 0, 1, 1, 25, 50, 1, 50, 85, 0, 1, 1, 37, 47, 1, 37, 45, 22, 47, 0, 1, 25, 54, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 32, 47, 1, 1, 1, 25, 32, 47, 1, 1, 1, 25, 32, 47, 50, 0, 25, 32, 47, 50, 0, 25, 32, 47, 4, 1, 56, 0, 25, 32, 47, 1, 1, 1, 25, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 10, 78, 78, 11, 78, 78, 16, 59, 12, 13, 70, 17, 71, 13, 71, 74, 75, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 59, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 59, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 59, 87, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 79, 79, 79, 79, 4, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 75, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 81, 81, 81, 81, 81, 79, 59, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 81, 81, 81, 79, 79, 79, 79, 79, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 4, 59, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 75, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 87, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 77, 72, 42, 41, 60, 77, 72, 42, 30, 57, 51, 0, 51, 30, 56, 50, 85, 1, 22, 50, 50, 0, 1, 22, 50, 50, 85, 0, 1, 22, 50, 50, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 0, 22, 50, 50, 85, 85, 0, 22, 50, 50, 85, 0, 22, 50, 50, 0, 22, 50, 22, 30, 50, 50, 21, 53, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 0, 26, 81, 50, 53, 0, 22, 22, 22, 50, 53, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 0, 26, 50, 53, 0, 26, 81, 50, 50, 21, 53, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 47, 78, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 53, 56, 24, 47, 1, 52, 50, 50, 0, 1, 50, 46, 53, 85, 0, 53, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 87, 87, 87, 84, 84, 12, 43, 61, 18, 82, 35, 35, 21, 47, 35, 0, 78, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 84, 12, 43, 64, 18, 4, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 84, 12, 43, 64, 18, 4, 79, 79, 59, 12, 82, 82, 59, 12, 83, 83, 59, 12, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 87, 87, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 87, 87, 12, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 12, 82, 82, 59, 12, 83, 83, 59, 12, 79, 78, 82, 78, 83, 78, 79, 78, 82, 78, 83, 78, 79, 78, 82, 78, 83, 78, 81, 79, 79, 79, 79, 81, 79, 79, 59, 87, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 12, 5, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 12, 79, 78, 82, 78, 83, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 87, 87, 87, 84, 84, 12, 43, 61, 18, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 84, 12, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 79, 82, 79, 79, 82, 79, 59, 84, 12, 82, 59, 84, 12, 42, 61, 17, 80, 83, 80, 59, 84, 12, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 87, 84, 84, 84, 12, 79, 59, 87, 84, 84, 84, 12, 42, 61, 17, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 87, 84, 84, 84, 12, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 84, 12, 79, 78, 82, 78, 83, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 80, 38, 23, 2, 80, 80, 80, 80, 80, 80, 80, 80, 80, 59, 87, 87, 84, 12, 43, 65, 18, 80, 38, 23, 2, 80, 80, 80, 80, 80, 80, 80, 80, 80, 59, 87, 87, 84, 12, 43, 65, 18, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 78, 78, 78, 78, 78, 78, 78, 78, 4, 59, 87, 84, 84, 12, 43, 61, 18, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 87, 87, 87, 87, 12, 43, 61, 18, 78, 78, 79, 59, 12, 43, 61, 18, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 12, 43, 61, 18, 78, 78, 79, 59, 12, 43, 61, 18, 78, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 87, 12, 43, 61, 18, 78, 82, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 84, 12, 43, 61, 18, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 87, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 78, 67, 12, 18, 78, 66, 68, 12, 18, 71, 53, 53, 0, 53, 0, 1, 78, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 79, 67, 12, 18, 66, 68, 15, 18, 71, 79, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 5, 56, 37, 45, 0, 22, 84, 5, 56, 37, 45, 0, 22, 84, 31, 23, 45, 5, 56, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 1, 58, 22, 84, 1, 27, 56, 0, 53, 0, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 56, 27, 22, 84, 22, 84, 1, 58, 22, 84, 1, 58, 22, 84, 1, 27, 56, 0, 53, 0, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 27, 30, 45, 22, 84, 27, 56, 22, 84, 56, 27, 22, 84, 27, 47, 22, 84, 30, 47, 30, 47, 0, 30, 47, 0, 22, 84, 24, 47, 24, 47, 0, 0, 22, 84, 7, 27, 56, 21, 22, 84, 49, 22, 84, 49, 22, 84, 59, 87, 87, 87, 84, 84, 12, 42, 61, 17, 44, 17, 70, 21, 45, 0, 22, 84, 59, 87, 87, 84, 12, 42, 61, 17, 44, 17, 70, 59, 87, 87, 84, 12, 42, 61, 17, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 20, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 20, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 20, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 66, 68, 12, 18, 71, 44, 17, 70, 59, 12, 18, 71, 44, 17, 70, 66, 68, 12, 18, 71, 44, 17, 70, 59, 12, 18, 71, 44, 17, 69};
+inline uint64_t op42[NOPS_] = { 82, 27, 57, 27, 56, 21, 27, 57, 27, 56, 21, 27, 57, 27, 56, 21, 27, 56, 26, 27, 56, 26, 27, 56, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 56, 26, 30, 56, 26, 4, 56, 26, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 54, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 30, 47, 26, 30, 47, 26, 30, 47, 26, 32, 48, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 47, 21, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 54, 26, 54, 26, 54, 26, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 8, 27, 56, 26, 27, 56, 26, 30, 47, 26, 30, 47, 26, 50, 26, 9, 35, 27, 45, 26, 27, 47, 25, 35, 35, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 24, 47, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 25, 27, 47, 54, 0, 53, 49, 0, 30, 45, 25, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 35, 32, 45, 26, 37, 49, 26, 37, 49, 26, 37, 49, 26, 37, 49, 26, 36, 32, 45, 26, 36, 32, 45, 26, 36, 32, 45, 26, 36, 32, 45, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 32, 47, 26, 32, 47, 26, 32, 47, 26, 30, 48, 28, 30, 45, 21, 50, 27, 56, 26, 1, 30, 45, 25, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 32, 48, 86, 86, 86, 32, 47, 21, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 32, 47, 7, 39, 45, 0, 1, 25, 51, 51, 21, 30, 48, 30, 47, 21, 35, 30, 45, 26, 33, 47, 29, 22, 45, 26, 50, 27, 47, 26, 27, 48, 28, 27, 45, 21, 27, 48, 27, 47, 21, 57, 29, 45, 21, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 56, 26, 30, 22, 40, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 22, 47, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 53, 1, 22, 47, 1, 53, 30, 0, 22, 47, 1, 22, 47, 22, 47, 0, 22, 47, 0, 1, 25, 22, 47, 1, 25, 30, 47, 26, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 37, 47, 1, 22, 47, 22, 47, 0, 1, 25, 47, 26, 50, 1, 37, 26, 45, 1, 2, 25, 54, 26, 53, 53, 0, 53, 0, 1, 58, 26, 53, 53, 0, 53, 0, 1, 27, 58, 26, 32, 56, 54, 0, 25, 30, 47, 26, 24, 58, 26, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 47, 54, 0, 25, 32, 48, 32, 47, 21, 30, 47, 26, 30, 47, 26, 32, 56, 26, 30, 47, 26, 30, 48, 28, 30, 45, 21, 50, 27, 56, 26, 1, 30, 45, 25, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 32, 48, 32, 47, 21, 55, 30, 49, 21, 30, 49, 26, 51, 51, 21, 30, 48, 30, 47, 21, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 35, 30, 45, 26, 29, 22, 56, 26, 32, 47, 7, 39, 45, 0, 1, 25, 50, 27, 47, 26, 27, 48, 28, 27, 45, 21, 27, 48, 27, 47, 21, 57, 29, 45, 21, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 56, 26, 28, 47, 26, 30, 35, 45, 26, 28, 47, 26, 28, 47, 26, 30, 56, 26, 32, 28, 27, 45, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 30, 47, 26, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 54, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 53, 0, 47, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 1, 21, 50, 27, 56, 26, 47, 26, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 22, 47, 1, 25, 4, 21, 47, 4, 0, 25, 22, 47, 1, 25, 22, 47, 7, 22, 47, 0, 1, 25, 22, 47, 1, 25, 37, 21, 47, 37, 0, 25, 22, 47, 1, 4, 56, 0, 1, 1, 25, 50, 1, 50, 85, 0, 1, 1, 37, 47, 1, 37, 45, 22, 47, 0, 1, 25, 54, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 34, 58, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 30, 56, 26, 32, 47, 1, 1, 1, 25, 32, 47, 1, 1, 1, 25, 32, 47, 50, 0, 25, 32, 47, 50, 0, 25, 32, 47, 4, 1, 56, 0, 25, 32, 47, 1, 1, 1, 25, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 10, 78, 78, 11, 78, 78, 16, 59, 12, 13, 70, 17, 71, 13, 71, 74, 75, 42, 41, 60, 62, 15, 13, 70, 17, 63, 15, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 76, 19, 13, 70, 17, 73, 19, 13, 70, 17, 71, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 53, 1, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 59, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 59, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 59, 87, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 79, 79, 79, 79, 4, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 75, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 81, 81, 81, 81, 81, 81, 79, 59, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 81, 81, 81, 79, 79, 79, 79, 79, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 4, 59, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 18, 74, 75, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 7, 79, 59, 87, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 18, 74, 72, 42, 41, 60, 77, 72, 42, 41, 60, 77, 72, 42, 30, 57, 51, 0, 51, 30, 56, 50, 85, 1, 22, 50, 50, 0, 1, 22, 50, 50, 85, 0, 1, 22, 50, 50, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 85, 0, 22, 50, 50, 85, 85, 85, 0, 22, 50, 50, 85, 85, 0, 22, 50, 50, 85, 0, 22, 50, 50, 0, 22, 50, 22, 30, 50, 50, 21, 53, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 1, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 88, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 85, 50, 85, 21, 50, 21, 50, 21, 53, 0, 0, 26, 50, 50, 85, 21, 50, 21, 50, 21, 53, 0, 26, 81, 50, 53, 0, 22, 22, 22, 50, 53, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 22, 22, 22, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 85, 53, 0, 0, 26, 50, 53, 85, 53, 0, 0, 26, 50, 53, 0, 26, 81, 50, 50, 21, 53, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 22, 22, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 85, 50, 21, 53, 0, 0, 26, 50, 50, 21, 53, 0, 26, 81, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 47, 78, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 53, 56, 24, 47, 1, 52, 50, 50, 0, 1, 50, 46, 53, 85, 0, 53, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 87, 87, 87, 84, 84, 12, 43, 61, 18, 82, 35, 35, 21, 47, 35, 0, 78, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 84, 12, 43, 64, 18, 4, 78, 79, 50, 1, 78, 78, 78, 78, 78, 78, 78, 78, 79, 37, 22, 2, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 84, 12, 43, 64, 18, 4, 79, 79, 59, 12, 82, 82, 59, 12, 83, 83, 59, 12, 82, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 87, 87, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 87, 87, 12, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 78, 82, 78, 83, 78, 8, 3, 54, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 54, 0, 59, 12, 82, 82, 59, 12, 83, 83, 59, 12, 79, 78, 82, 78, 83, 78, 79, 78, 82, 78, 83, 78, 79, 78, 82, 78, 83, 78, 81, 79, 79, 79, 79, 81, 79, 79, 59, 87, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 12, 5, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 12, 79, 78, 82, 78, 83, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 87, 87, 87, 84, 84, 12, 43, 61, 18, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 84, 12, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 82, 79, 79, 79, 59, 84, 84, 12, 82, 82, 82, 82, 59, 84, 84, 12, 83, 83, 83, 83, 59, 84, 84, 12, 79, 82, 79, 79, 82, 79, 59, 84, 12, 82, 59, 84, 12, 42, 61, 17, 80, 83, 80, 59, 84, 12, 79, 79, 79, 79, 79, 79, 79, 79, 82, 79, 79, 79, 79, 79, 79, 79, 79, 82, 59, 87, 84, 84, 84, 12, 79, 59, 87, 84, 84, 84, 12, 42, 61, 17, 80, 80, 80, 80, 80, 80, 80, 80, 83, 59, 87, 84, 84, 84, 12, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 84, 84, 84, 12, 79, 78, 82, 78, 83, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 78, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 59, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 84, 12, 80, 38, 23, 2, 80, 80, 80, 80, 80, 80, 80, 80, 80, 59, 87, 87, 84, 12, 43, 65, 18, 80, 38, 23, 2, 80, 80, 80, 80, 80, 80, 80, 80, 80, 59, 87, 87, 84, 12, 43, 65, 18, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 81, 81, 81, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 84, 12, 43, 61, 18, 78, 78, 78, 78, 78, 78, 78, 78, 4, 59, 87, 84, 84, 12, 43, 61, 18, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 81, 81, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 12, 43, 61, 18, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 87, 87, 87, 87, 12, 43, 61, 18, 78, 78, 79, 59, 12, 43, 61, 18, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 12, 43, 61, 18, 78, 78, 79, 59, 12, 43, 61, 18, 78, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 87, 12, 43, 61, 18, 78, 82, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 59, 87, 87, 84, 12, 43, 61, 18, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 53, 1, 53, 1, 53, 1, 53, 1, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 46, 0, 46, 0, 46, 0, 46, 0, 79, 79, 59, 87, 87, 87, 87, 84, 84, 84, 12, 43, 61, 18, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 81, 81, 79, 79, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 59, 87, 87, 87, 87, 87, 87, 84, 12, 43, 61, 18, 78, 67, 12, 18, 78, 66, 68, 12, 18, 71, 53, 53, 0, 53, 0, 1, 78, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 79, 67, 12, 18, 66, 68, 15, 18, 71, 79, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 59, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 84, 84, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 17, 70, 5, 56, 37, 45, 0, 22, 84, 5, 56, 37, 45, 0, 22, 84, 31, 23, 45, 5, 56, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 49, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 45, 22, 84, 47, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 46, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0, 22, 84, 1, 58, 22, 84, 1, 27, 56, 0, 53, 0, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 56, 27, 22, 84, 22, 84, 1, 58, 22, 84, 1, 58, 22, 84, 1, 27, 56, 0, 53, 0, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 50, 1, 22, 84, 27, 30, 45, 22, 84, 27, 56, 22, 84, 56, 27, 22, 84, 27, 47, 22, 84, 30, 47, 30, 47, 0, 30, 47, 0, 22, 84, 24, 47, 24, 47, 0, 0, 22, 84, 7, 27, 56, 21, 22, 84, 49, 22, 84, 49, 22, 84, 59, 87, 87, 87, 84, 84, 12, 42, 61, 17, 44, 17, 70, 21, 45, 0, 22, 84, 59, 87, 87, 84, 12, 42, 61, 17, 44, 17, 70, 59, 87, 87, 84, 12, 42, 61, 17, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 20, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 14, 59, 12, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 20, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 20, 70, 17, 13, 70, 17, 71, 13, 71, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 18, 44, 17, 70, 66, 68, 12, 18, 71, 44, 17, 70, 59, 12, 18, 71, 44, 17, 70, 66, 68, 12, 18, 71, 44, 17, 70, 59, 12, 18, 71, 44, 17, 69};
 
 
-uint64_t args42[NARGS_] = { 3, 5, 0, 1ULL, 3, 1, 0, 12037652483, 2, 16777216, 665, 0, 1ULL, 3, 2, 0, 12037652483, 665, 122, 1, 2, 0, 1ULL, 3, 1, 0, 12037652534, 2, 16777216, 665, 0, 1ULL, 3, 2, 0, 12037652534, 665, 123, 1, 2, 0, 1ULL, 3, 1, 0, 12037652484, 2, 16777216, 665, 0, 1ULL, 3, 2, 0, 12037652484, 665, 124, 1, 2, 0, 1ULL, 3, 1, 0, 12037652535, 665, 125, 1, 0ULL, 0, 1ULL, 3, 1, 0, 12037652536, 665, 126, 1, 0ULL, 0, 1ULL, 3, 1, 0, 12037652537, 665, 127, 1, 0ULL, 0, 1ULL, 12037652535, 665, 1, 12037652535, 665, 0, 128, 1, 0ULL, 0, 1ULL, 12037652536, 665, 1, 12037652536, 665, 0, 129, 1, 0ULL, 0, 1ULL, 12037652537, 665, 1, 12037652537, 665, 0, 130, 1, 0ULL, 0, 1ULL, 12037652484, 665, 1, 0, 12037652536, 665, 131, 1, 0ULL, 0, 1ULL, 12037652483, 665, 1, 0, 12037652537, 665, 132, 1, 0ULL, 0, 12037652484, 665, 12037652483, 665, 1, 0, 12037652535, 665, 133, 1, 0ULL, 0, 1ULL, 3, 1, 0, 12037652485, 665, 0, 12037652480, 665, 85, 2, 1, 0, 134, 12037652485, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652486, 665, 0, 12037652480, 665, 86, 2, 1, 0, 135, 12037652486, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652487, 665, 0, 12037652480, 665, 87, 2, 1, 0, 136, 12037652487, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652488, 665, 0, 12037652480, 665, 88, 2, 1, 0, 137, 12037652488, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652489, 665, 0, 12037652480, 665, 89, 2, 1, 0, 138, 12037652489, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652490, 665, 0, 12037652480, 665, 90, 2, 1, 0, 139, 12037652490, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652491, 665, 0, 12037652480, 665, 91, 2, 1, 0, 140, 12037652491, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652492, 665, 0, 12037652480, 665, 92, 2, 1, 0, 141, 12037652492, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652493, 665, 0, 12037652481, 665, 85, 2, 1, 0, 142, 12037652493, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652494, 665, 0, 12037652481, 665, 86, 2, 1, 0, 143, 12037652494, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652495, 665, 0, 12037652481, 665, 87, 2, 1, 0, 144, 12037652495, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652496, 665, 0, 12037652481, 665, 88, 2, 1, 0, 145, 12037652496, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652497, 665, 0, 12037652481, 665, 89, 2, 1, 0, 146, 12037652497, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652498, 665, 0, 12037652481, 665, 90, 2, 1, 0, 147, 12037652498, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652499, 665, 0, 12037652481, 665, 91, 2, 1, 0, 148, 12037652499, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652500, 665, 0, 12037652481, 665, 92, 2, 1, 0, 149, 12037652500, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652501, 665, 0, 25341984768, 371, 85, 2, 1, 0, 150, 12037652501, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652502, 665, 0, 25341984768, 371, 86, 2, 1, 0, 151, 12037652502, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652503, 665, 0, 25341984768, 371, 87, 2, 1, 0, 152, 12037652503, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652504, 665, 0, 25341984768, 371, 88, 2, 1, 0, 153, 12037652504, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652505, 665, 0, 25341984768, 371, 89, 2, 1, 0, 154, 12037652505, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652506, 665, 0, 25341984768, 371, 90, 2, 1, 0, 155, 12037652506, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652507, 665, 0, 25341984768, 371, 91, 2, 1, 0, 156, 12037652507, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652508, 665, 0, 25341984768, 371, 92, 2, 1, 0, 157, 12037652508, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652509, 665, 0, 25341984769, 371, 85, 2, 1, 0, 158, 12037652509, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652510, 665, 0, 25341984769, 371, 86, 2, 1, 0, 159, 12037652510, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652511, 665, 0, 25341984769, 371, 87, 2, 1, 0, 160, 12037652511, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652512, 665, 0, 25341984769, 371, 88, 2, 1, 0, 161, 12037652512, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652513, 665, 0, 25341984769, 371, 89, 2, 1, 0, 162, 12037652513, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652514, 665, 0, 25341984769, 371, 90, 2, 1, 0, 163, 12037652514, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652515, 665, 0, 25341984769, 371, 91, 2, 1, 0, 164, 12037652515, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652516, 665, 0, 25341984769, 371, 92, 2, 1, 0, 165, 12037652516, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652517, 665, 0, 12037652526, 665, 25341984770, 371, 2, 1, 0, 166, 12037652517, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652518, 665, 0, 12037652527, 665, 25341984770, 371, 2, 1, 0, 167, 12037652518, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652519, 665, 0, 12037652528, 665, 25341984770, 371, 2, 1, 0, 168, 12037652519, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652520, 665, 0, 12037652529, 665, 25341984770, 371, 2, 1, 0, 169, 12037652520, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652521, 665, 0, 12037652530, 665, 25341984770, 371, 2, 1, 0, 170, 12037652521, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652522, 665, 0, 12037652531, 665, 25341984770, 371, 2, 1, 0, 171, 12037652522, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652523, 665, 0, 12037652532, 665, 25341984770, 371, 2, 1, 0, 172, 12037652523, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652524, 665, 0, 12037652533, 665, 25341984770, 371, 2, 1, 0, 173, 12037652524, 2, 16777216, 665, 2, 0, 1ULL, 12037652698, 665, 1, 12037652698, 665, 0, 174, 1, 0ULL, 0, 1ULL, 12037652699, 665, 1, 12037652699, 665, 0, 175, 1, 0ULL, 0, 1ULL, 12037652700, 665, 1, 12037652700, 665, 0, 176, 1, 0ULL, 0, 1ULL, 36, 1, 12037652538, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652538, 665, 0, 177, 1, 2, 0, 1ULL, 36, 1, 12037652539, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652539, 665, 0, 178, 1, 2, 0, 1ULL, 36, 1, 12037652540, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652540, 665, 0, 179, 1, 2, 0, 1ULL, 36, 1, 12037652541, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652541, 665, 0, 180, 1, 2, 0, 1ULL, 36, 1, 12037652542, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652542, 665, 0, 181, 1, 2, 0, 1ULL, 36, 1, 12037652543, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652543, 665, 0, 182, 1, 2, 0, 1ULL, 36, 1, 12037652544, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652544, 665, 0, 183, 1, 2, 0, 1ULL, 36, 1, 12037652545, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652545, 665, 0, 184, 1, 2, 0, 1ULL, 36, 1, 12037652546, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652546, 665, 0, 185, 1, 2, 0, 1ULL, 36, 1, 12037652547, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652547, 665, 0, 186, 1, 2, 0, 1ULL, 36, 1, 12037652548, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652548, 665, 0, 187, 1, 2, 0, 1ULL, 36, 1, 12037652549, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652549, 665, 0, 188, 1, 2, 0, 1ULL, 36, 1, 12037652550, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652550, 665, 0, 189, 1, 2, 0, 1ULL, 36, 1, 12037652551, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652551, 665, 0, 190, 1, 2, 0, 1ULL, 36, 1, 12037652552, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652552, 665, 0, 191, 1, 2, 0, 1ULL, 36, 1, 12037652553, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652553, 665, 0, 192, 1, 2, 0, 1ULL, 36, 1, 12037652554, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652554, 665, 0, 193, 1, 2, 0, 1ULL, 36, 1, 12037652555, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652555, 665, 0, 194, 1, 2, 0, 1ULL, 36, 1, 12037652556, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652556, 665, 0, 195, 1, 2, 0, 1ULL, 36, 1, 12037652557, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652557, 665, 0, 196, 1, 2, 0, 1ULL, 36, 1, 12037652558, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652558, 665, 0, 197, 1, 2, 0, 1ULL, 36, 1, 12037652559, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652559, 665, 0, 198, 1, 2, 0, 1ULL, 36, 1, 12037652560, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652560, 665, 0, 199, 1, 2, 0, 1ULL, 36, 1, 12037652561, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652561, 665, 0, 200, 1, 2, 0, 1ULL, 36, 1, 12037652562, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652562, 665, 0, 201, 1, 2, 0, 1ULL, 36, 1, 12037652563, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652563, 665, 0, 202, 1, 2, 0, 1ULL, 36, 1, 12037652564, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652564, 665, 0, 203, 1, 2, 0, 1ULL, 36, 1, 12037652565, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652565, 665, 0, 204, 1, 2, 0, 1ULL, 36, 1, 12037652566, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652566, 665, 0, 205, 1, 2, 0, 1ULL, 36, 1, 12037652567, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652567, 665, 0, 206, 1, 2, 0, 1ULL, 36, 1, 12037652568, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652568, 665, 0, 207, 1, 2, 0, 1ULL, 36, 1, 12037652569, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652569, 665, 0, 208, 1, 2, 0, 1ULL, 36, 1, 12037652570, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652570, 665, 0, 209, 1, 2, 0, 1ULL, 36, 1, 12037652571, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652571, 665, 0, 210, 1, 2, 0, 1ULL, 36, 1, 12037652572, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652572, 665, 0, 211, 1, 2, 0, 1ULL, 36, 1, 12037652573, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652573, 665, 0, 212, 1, 2, 0, 1ULL, 36, 1, 12037652574, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652574, 665, 0, 213, 1, 2, 0, 1ULL, 36, 1, 12037652575, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652575, 665, 0, 214, 1, 2, 0, 1ULL, 36, 1, 12037652576, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652576, 665, 0, 215, 1, 2, 0, 1ULL, 36, 1, 12037652577, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652577, 665, 0, 216, 1, 2, 0, 1ULL, 36, 1, 12037652578, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652578, 665, 0, 217, 1, 2, 0, 1ULL, 36, 1, 12037652579, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652579, 665, 0, 218, 1, 2, 0, 1ULL, 36, 1, 12037652580, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652580, 665, 0, 219, 1, 2, 0, 1ULL, 36, 1, 12037652581, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652581, 665, 0, 220, 1, 2, 0, 1ULL, 36, 1, 12037652582, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652582, 665, 0, 221, 1, 2, 0, 1ULL, 36, 1, 12037652583, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652583, 665, 0, 222, 1, 2, 0, 1ULL, 36, 1, 12037652584, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652584, 665, 0, 223, 1, 2, 0, 1ULL, 36, 1, 12037652585, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652585, 665, 0, 224, 1, 2, 0, 1ULL, 36, 1, 12037652586, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652586, 665, 0, 225, 1, 2, 0, 1ULL, 36, 1, 12037652587, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652587, 665, 0, 226, 1, 2, 0, 1ULL, 36, 1, 12037652588, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652588, 665, 0, 227, 1, 2, 0, 1ULL, 36, 1, 12037652589, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652589, 665, 0, 228, 1, 2, 0, 1ULL, 36, 1, 12037652590, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652590, 665, 0, 229, 1, 2, 0, 1ULL, 36, 1, 12037652591, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652591, 665, 0, 230, 1, 2, 0, 1ULL, 36, 1, 12037652592, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652592, 665, 0, 231, 1, 2, 0, 1ULL, 36, 1, 12037652593, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652593, 665, 0, 232, 1, 2, 0, 1ULL, 36, 1, 12037652594, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652594, 665, 0, 233, 1, 2, 0, 1ULL, 36, 1, 12037652595, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652595, 665, 0, 234, 1, 2, 0, 1ULL, 36, 1, 12037652596, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652596, 665, 0, 235, 1, 2, 0, 1ULL, 36, 1, 12037652597, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652597, 665, 0, 236, 1, 2, 0, 1ULL, 36, 1, 12037652598, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652598, 665, 0, 237, 1, 2, 0, 1ULL, 36, 1, 12037652599, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652599, 665, 0, 238, 1, 2, 0, 1ULL, 36, 1, 12037652600, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652600, 665, 0, 239, 1, 2, 0, 1ULL, 36, 1, 12037652601, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652601, 665, 0, 240, 1, 2, 0, 1ULL, 36, 1, 12037652602, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652602, 665, 0, 241, 1, 2, 0, 1ULL, 36, 1, 12037652603, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652603, 665, 0, 242, 1, 2, 0, 1ULL, 36, 1, 12037652604, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652604, 665, 0, 243, 1, 2, 0, 1ULL, 36, 1, 12037652605, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652605, 665, 0, 244, 1, 2, 0, 1ULL, 36, 1, 12037652606, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652606, 665, 0, 245, 1, 2, 0, 1ULL, 36, 1, 12037652607, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652607, 665, 0, 246, 1, 2, 0, 1ULL, 36, 1, 12037652608, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652608, 665, 0, 247, 1, 2, 0, 1ULL, 36, 1, 12037652609, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652609, 665, 0, 248, 1, 2, 0, 1ULL, 36, 1, 12037652610, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652610, 665, 0, 249, 1, 2, 0, 1ULL, 36, 1, 12037652611, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652611, 665, 0, 250, 1, 2, 0, 1ULL, 36, 1, 12037652612, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652612, 665, 0, 251, 1, 2, 0, 1ULL, 36, 1, 12037652613, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652613, 665, 0, 252, 1, 2, 0, 1ULL, 36, 1, 12037652614, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652614, 665, 0, 253, 1, 2, 0, 1ULL, 36, 1, 12037652615, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652615, 665, 0, 254, 1, 2, 0, 1ULL, 36, 1, 12037652616, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652616, 665, 0, 255, 1, 2, 0, 1ULL, 36, 1, 12037652617, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652617, 665, 0, 256, 1, 2, 0, 1ULL, 36, 1, 12037652618, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652618, 665, 0, 257, 1, 2, 0, 1ULL, 36, 1, 12037652619, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652619, 665, 0, 258, 1, 2, 0, 1ULL, 36, 1, 12037652620, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652620, 665, 0, 259, 1, 2, 0, 1ULL, 36, 1, 12037652621, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652621, 665, 0, 260, 1, 2, 0, 1ULL, 36, 1, 12037652622, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652622, 665, 0, 261, 1, 2, 0, 1ULL, 36, 1, 12037652623, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652623, 665, 0, 262, 1, 2, 0, 1ULL, 36, 1, 12037652624, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652624, 665, 0, 263, 1, 2, 0, 1ULL, 36, 1, 12037652625, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652625, 665, 0, 264, 1, 2, 0, 1ULL, 36, 1, 12037652626, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652626, 665, 0, 265, 1, 2, 0, 1ULL, 36, 1, 12037652627, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652627, 665, 0, 266, 1, 2, 0, 1ULL, 36, 1, 12037652628, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652628, 665, 0, 267, 1, 2, 0, 1ULL, 36, 1, 12037652629, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652629, 665, 0, 268, 1, 2, 0, 1ULL, 36, 1, 12037652630, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652630, 665, 0, 269, 1, 2, 0, 1ULL, 36, 1, 12037652631, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652631, 665, 0, 270, 1, 2, 0, 1ULL, 36, 1, 12037652632, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652632, 665, 0, 271, 1, 2, 0, 1ULL, 36, 1, 12037652633, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652633, 665, 0, 272, 1, 2, 0, 1ULL, 36, 1, 12037652634, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652634, 665, 0, 273, 1, 2, 0, 1ULL, 36, 1, 12037652635, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652635, 665, 0, 274, 1, 2, 0, 1ULL, 36, 1, 12037652636, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652636, 665, 0, 275, 1, 2, 0, 1ULL, 36, 1, 12037652637, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652637, 665, 0, 276, 1, 2, 0, 1ULL, 36, 1, 12037652638, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652638, 665, 0, 277, 1, 2, 0, 1ULL, 36, 1, 12037652639, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652639, 665, 0, 278, 1, 2, 0, 1ULL, 36, 1, 12037652640, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652640, 665, 0, 279, 1, 2, 0, 1ULL, 36, 1, 12037652641, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652641, 665, 0, 280, 1, 2, 0, 1ULL, 36, 1, 12037652642, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652642, 665, 0, 281, 1, 2, 0, 1ULL, 36, 1, 12037652643, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652643, 665, 0, 282, 1, 2, 0, 1ULL, 36, 1, 12037652644, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652644, 665, 0, 283, 1, 2, 0, 1ULL, 36, 1, 12037652645, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652645, 665, 0, 284, 1, 2, 0, 1ULL, 36, 1, 12037652646, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652646, 665, 0, 285, 1, 2, 0, 1ULL, 36, 1, 12037652647, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652647, 665, 0, 286, 1, 2, 0, 1ULL, 36, 1, 12037652648, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652648, 665, 0, 287, 1, 2, 0, 1ULL, 36, 1, 12037652649, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652649, 665, 0, 288, 1, 2, 0, 1ULL, 36, 1, 12037652650, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652650, 665, 0, 289, 1, 2, 0, 1ULL, 36, 1, 12037652651, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652651, 665, 0, 290, 1, 2, 0, 1ULL, 36, 1, 12037652652, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652652, 665, 0, 291, 1, 2, 0, 1ULL, 36, 1, 12037652653, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652653, 665, 0, 292, 1, 2, 0, 1ULL, 36, 1, 12037652654, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652654, 665, 0, 293, 1, 2, 0, 1ULL, 36, 1, 12037652655, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652655, 665, 0, 294, 1, 2, 0, 1ULL, 36, 1, 12037652656, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652656, 665, 0, 295, 1, 2, 0, 1ULL, 36, 1, 12037652657, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652657, 665, 0, 296, 1, 2, 0, 1ULL, 36, 1, 12037652658, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652658, 665, 0, 297, 1, 2, 0, 1ULL, 36, 1, 12037652659, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652659, 665, 0, 298, 1, 2, 0, 1ULL, 36, 1, 12037652660, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652660, 665, 0, 299, 1, 2, 0, 1ULL, 36, 1, 12037652661, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652661, 665, 0, 300, 1, 2, 0, 1ULL, 36, 1, 12037652662, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652662, 665, 0, 301, 1, 2, 0, 1ULL, 36, 1, 12037652663, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652663, 665, 0, 302, 1, 2, 0, 1ULL, 36, 1, 12037652664, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652664, 665, 0, 303, 1, 2, 0, 1ULL, 36, 1, 12037652665, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652665, 665, 0, 304, 1, 2, 0, 1ULL, 36, 1, 12037652666, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652666, 665, 0, 305, 1, 2, 0, 1ULL, 36, 1, 12037652667, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652667, 665, 0, 306, 1, 2, 0, 1ULL, 36, 1, 12037652668, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652668, 665, 0, 307, 1, 2, 0, 1ULL, 36, 1, 12037652669, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652669, 665, 0, 308, 1, 2, 0, 1ULL, 36, 1, 12037652670, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652670, 665, 0, 309, 1, 2, 0, 1ULL, 36, 1, 12037652671, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652671, 665, 0, 310, 1, 2, 0, 1ULL, 36, 1, 12037652672, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652672, 665, 0, 311, 1, 2, 0, 1ULL, 36, 1, 12037652673, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652673, 665, 0, 312, 1, 2, 0, 1ULL, 36, 1, 12037652674, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652674, 665, 0, 313, 1, 2, 0, 1ULL, 36, 1, 12037652675, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652675, 665, 0, 314, 1, 2, 0, 1ULL, 36, 1, 12037652676, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652676, 665, 0, 315, 1, 2, 0, 1ULL, 36, 1, 12037652677, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652677, 665, 0, 316, 1, 2, 0, 1ULL, 36, 1, 12037652678, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652678, 665, 0, 317, 1, 2, 0, 1ULL, 36, 1, 12037652679, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652679, 665, 0, 318, 1, 2, 0, 1ULL, 36, 1, 12037652680, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652680, 665, 0, 319, 1, 2, 0, 1ULL, 36, 1, 12037652681, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652681, 665, 0, 320, 1, 2, 0, 1ULL, 36, 1, 12037652682, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652682, 665, 0, 321, 1, 2, 0, 1ULL, 36, 1, 12037652683, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652683, 665, 0, 322, 1, 2, 0, 1ULL, 36, 1, 12037652684, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652684, 665, 0, 323, 1, 2, 0, 1ULL, 36, 1, 12037652685, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652685, 665, 0, 324, 1, 2, 0, 1ULL, 36, 1, 12037652686, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652686, 665, 0, 325, 1, 2, 0, 1ULL, 36, 1, 12037652687, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652687, 665, 0, 326, 1, 2, 0, 1ULL, 36, 1, 12037652688, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652688, 665, 0, 327, 1, 2, 0, 1ULL, 36, 1, 12037652689, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652689, 665, 0, 328, 1, 2, 0, 1ULL, 36, 1, 12037652690, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652690, 665, 0, 329, 1, 2, 0, 1ULL, 36, 1, 12037652691, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652691, 665, 0, 330, 1, 2, 0, 1ULL, 36, 1, 12037652692, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652692, 665, 0, 331, 1, 2, 0, 1ULL, 36, 1, 12037652693, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652693, 665, 0, 332, 1, 2, 0, 1ULL, 36, 1, 12037652694, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652694, 665, 0, 333, 1, 2, 0, 1ULL, 36, 1, 12037652695, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652695, 665, 0, 334, 1, 2, 0, 1ULL, 36, 1, 12037652696, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652696, 665, 0, 335, 1, 2, 0, 1ULL, 36, 1, 12037652697, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652697, 665, 0, 336, 1, 2, 0, 1ULL, 36, 1, 12037652701, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652701, 665, 0, 337, 1, 2, 0, 1ULL, 36, 1, 12037652702, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652702, 665, 0, 338, 1, 2, 0, 1ULL, 36, 1, 12037652703, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652703, 665, 0, 339, 1, 2, 0, 1ULL, 36, 1, 12037652704, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652704, 665, 0, 340, 1, 2, 0, 1ULL, 12037652701, 665, 1, 12037652701, 665, 0, 341, 1, 0ULL, 0, 1ULL, 12037652702, 665, 1, 12037652702, 665, 0, 342, 1, 0ULL, 0, 1ULL, 12037652703, 665, 1, 12037652703, 665, 0, 343, 1, 0ULL, 0, 1ULL, 12037652704, 665, 1, 12037652704, 665, 0, 344, 1, 0ULL, 0, 12037652705, 665, 5, 345, 0, 0ULL, 0, 12037652706, 665, 5, 346, 0, 0ULL, 0, 12037652707, 665, 5, 347, 0, 0ULL, 0, 25341984771, 371, 12037652705, 665, 1, 12037652701, 665, 0, 0, 12037652701, 665, 12037652705, 2, 16777216, 665, 2, 65536ULL, 0, 348, 1, 2, 0, 25341984772, 371, 12037652705, 665, 1, 12037652702, 665, 0, 0, 12037652702, 665, 12037652705, 2, 16777216, 665, 2, 65536ULL, 0, 349, 1, 2, 0, 25341984773, 371, 12037652705, 665, 1, 12037652703, 665, 0, 0, 12037652703, 665, 12037652705, 2, 16777216, 665, 2, 65536ULL, 0, 350, 1, 2, 0, 25341984774, 371, 12037652706, 665, 1, 12037652704, 665, 0, 0, 12037652704, 665, 12037652706, 2, 16777216, 665, 2, 65536ULL, 0, 351, 1, 2, 0, 25341984775, 371, 12037652707, 665, 1, 12037652704, 665, 0, 0, 12037652704, 665, 12037652707, 2, 16777216, 665, 2, 65536ULL, 0, 352, 1, 2, 4, 5, 21, 0, 1ULL, 4, 1, 0, 12037652745, 665, 353, 1, 0ULL, 0, 1ULL, 4, 1, 0, 12037652746, 665, 354, 1, 0ULL, 0, 1ULL, 12037652745, 665, 1, 12037652745, 665, 0, 355, 1, 0ULL, 0, 1ULL, 12037652746, 665, 1, 12037652746, 665, 0, 356, 1, 0ULL, 0, 12037652746, 665, 12037652745, 665, 357, 0, 0ULL, 3, 5, 2, 16777216, 21, 2, 16777216, 0, 12037652738, 2, 16777216, 665, 12037652738, 665, 1, 1ULL, 3, 2, 0, 1, 358, 2, 0ULL, 0, 1ULL, 3, 1, 12037652741, 665, 0, 359, 12037652739, 2, 16777216, 665, 1, 360, 12037652742, 2, 16777216, 665, 12037652741, 665, 361, 12037652743, 2, 16777216, 665, 12037652738, 665, 0, 1ULL, 4, 1, 12037652714, 665, 0, 0, 12037652708, 665, 114, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 114, 0, 2, 1, 362, 12037652714, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652715, 665, 0, 0, 12037652708, 665, 115, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 115, 0, 2, 1, 363, 12037652715, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652716, 665, 0, 0, 12037652708, 665, 116, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 116, 0, 2, 1, 364, 12037652716, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652717, 665, 0, 0, 12037652708, 665, 117, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 117, 0, 2, 1, 365, 12037652717, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652718, 665, 0, 0, 12037652708, 665, 118, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 118, 0, 2, 1, 366, 12037652718, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652719, 665, 0, 0, 12037652708, 665, 119, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 119, 0, 2, 1, 367, 12037652719, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652720, 665, 0, 0, 12037652708, 665, 120, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 120, 0, 2, 1, 368, 12037652720, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652721, 665, 0, 0, 12037652708, 665, 121, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 121, 0, 2, 1, 369, 12037652721, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652722, 665, 0, 0, 12037652710, 665, 114, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 114, 0, 2, 1, 370, 12037652722, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652723, 665, 0, 0, 12037652710, 665, 115, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 115, 0, 2, 1, 371, 12037652723, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652724, 665, 0, 0, 12037652710, 665, 116, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 116, 0, 2, 1, 372, 12037652724, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652725, 665, 0, 0, 12037652710, 665, 117, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 117, 0, 2, 1, 373, 12037652725, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652726, 665, 0, 0, 12037652710, 665, 118, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 118, 0, 2, 1, 374, 12037652726, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652727, 665, 0, 0, 12037652710, 665, 119, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 119, 0, 2, 1, 375, 12037652727, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652728, 665, 0, 0, 12037652710, 665, 120, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 120, 0, 2, 1, 376, 12037652728, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652729, 665, 0, 0, 12037652710, 665, 121, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 121, 0, 2, 1, 377, 12037652729, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652730, 665, 0, 0, 12037652712, 665, 114, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 114, 3, 2, 1, 0, 12037652741, 665, 3, 1, 12037652744, 665, 0, 0, 1, 3, 378, 12037652730, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652731, 665, 0, 0, 12037652712, 665, 115, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 115, 0, 2, 1, 379, 12037652731, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652732, 665, 0, 0, 12037652712, 665, 116, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 116, 0, 2, 1, 380, 12037652732, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652733, 665, 0, 0, 12037652712, 665, 117, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 117, 0, 2, 1, 381, 12037652733, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652734, 665, 0, 0, 12037652712, 665, 118, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 118, 0, 2, 1, 382, 12037652734, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652735, 665, 0, 0, 12037652712, 665, 119, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 119, 0, 2, 1, 383, 12037652735, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652736, 665, 0, 0, 12037652712, 665, 120, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 120, 0, 2, 1, 384, 12037652736, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652737, 665, 0, 0, 12037652712, 665, 121, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 121, 3, 2, 1, 0, 1ULL, 12037652744, 665, 1, 0, 3, 385, 12037652737, 2, 16777216, 665, 1, 0, 12037652747, 2, 16777216, 665, 25341984800, 371, 1, 1ULL, 122, 2, 0, 1, 386, 2, 0ULL, 0, 12037652748, 2, 16777216, 665, 25341984801, 371, 1, 1ULL, 122, 2, 0, 1, 387, 2, 0ULL, 0, 12037652749, 2, 16777216, 665, 25341984802, 371, 1, 1ULL, 122, 2, 0, 1, 388, 2, 0ULL, 0, 12037652750, 2, 16777216, 665, 25341984803, 371, 1, 1ULL, 122, 2, 0, 1, 389, 2, 0ULL, 0, 12037652751, 2, 16777216, 665, 25341984804, 371, 1, 1ULL, 122, 2, 0, 1, 390, 2, 0ULL, 0, 12037652752, 2, 16777216, 665, 25341984805, 371, 1, 1ULL, 122, 2, 0, 1, 391, 2, 0ULL, 0, 12037652753, 2, 16777216, 665, 25341984806, 371, 1, 1ULL, 122, 2, 0, 1, 392, 2, 0ULL, 0, 12037652754, 2, 16777216, 665, 25341984807, 371, 1, 1ULL, 122, 2, 0, 1, 393, 2, 0ULL, 0, 12037652755, 2, 16777216, 665, 25341984808, 371, 1, 1ULL, 122, 2, 0, 1, 394, 2, 0ULL, 0, 12037652756, 2, 16777216, 665, 25341984809, 371, 1, 1ULL, 122, 2, 0, 1, 395, 2, 0ULL, 0, 12037652757, 2, 16777216, 665, 25341984810, 371, 1, 1ULL, 122, 2, 0, 1, 396, 2, 0ULL, 0, 12037652758, 2, 16777216, 665, 25341984811, 371, 1, 1ULL, 122, 2, 0, 1, 397, 2, 0ULL, 0, 12037652759, 665, 12037652747, 665, 1, 0, 124, 398, 1, 0ULL, 0, 12037652760, 665, 12037652748, 665, 1, 0, 124, 399, 1, 0ULL, 0, 12037652761, 665, 12037652749, 665, 1, 0, 124, 400, 1, 0ULL, 0, 12037652762, 665, 12037652750, 665, 1, 0, 124, 401, 1, 0ULL, 0, 12037652759, 665, 12037652759, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 402, 2, 0ULL, 0, 12037652760, 665, 12037652760, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 403, 2, 0ULL, 0, 12037652761, 665, 12037652761, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 404, 2, 0ULL, 0, 12037652762, 665, 12037652762, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 405, 2, 0ULL, 0, 1ULL, 12037652763, 665, 1, 12037652763, 665, 0, 406, 1, 0ULL, 0, 1ULL, 12037652764, 665, 1, 12037652764, 665, 0, 407, 1, 0ULL, 0, 1ULL, 12037652765, 665, 1, 12037652765, 665, 0, 408, 1, 0ULL, 0, 1ULL, 123, 1, 12037652763, 665, 0, 409, 1, 0ULL, 0, 1ULL, 123, 1, 12037652764, 665, 0, 410, 1, 0ULL, 0, 1ULL, 123, 1, 12037652765, 665, 0, 411, 1, 0ULL, 0, 1ULL, 25341984812, 371, 2, 12037652776, 2, 16777216, 665, 0, 0, 12037652776, 665, 1ULL, 1, 1ULL, 25341984812, 371, 3, 0, 1, 412, 2, 3, 0, 12037652776, 665, 12037652777, 665, 904, 1ULL, 0, 0, 904, 12037652776, 665, 413, 0, 0ULL, 0, 904, 12037652778, 665, 1, 1ULL, 25341984812, 371, 2, 0, 1, 414, 12037652778, 2, 16777216, 665, 2, 0, 1ULL, 12037652778, 665, 1, 12037652778, 665, 0, 415, 1, 0ULL, 0, 1ULL, 12037652779, 665, 1, 12037652779, 665, 0, 416, 1, 0ULL, 0, 1ULL, 12037652780, 665, 1, 12037652780, 665, 0, 417, 1, 0ULL, 0, 1ULL, 25341984812, 371, 1, 12037652779, 665, 0, 418, 1, 0ULL, 0, 1ULL, 25341984812, 371, 1, 12037652780, 665, 0, 419, 1, 0ULL, 0, 25341984813, 371, 138, 101, 0, 12037652766, 665, 0, 1ULL, 146, 1, 101, 0, 420, 12037652766, 2, 16777216, 665, 1, 0, 25341984813, 371, 139, 102, 0, 12037652767, 665, 0, 1ULL, 146, 1, 102, 0, 421, 12037652767, 2, 16777216, 665, 1, 0, 25341984813, 371, 140, 103, 0, 12037652768, 665, 0, 1ULL, 146, 1, 103, 0, 422, 12037652768, 2, 16777216, 665, 1, 0, 25341984813, 371, 141, 104, 0, 12037652769, 665, 0, 1ULL, 146, 1, 104, 0, 423, 12037652769, 2, 16777216, 665, 1, 0, 25341984813, 371, 142, 105, 0, 12037652770, 665, 0, 1ULL, 146, 1, 105, 0, 424, 12037652770, 2, 16777216, 665, 1, 0, 25341984813, 371, 143, 106, 0, 12037652771, 665, 0, 1ULL, 146, 1, 106, 0, 425, 12037652771, 2, 16777216, 665, 1, 0, 25341984813, 371, 144, 107, 0, 12037652772, 665, 0, 1ULL, 146, 1, 107, 0, 426, 12037652772, 2, 16777216, 665, 1, 0, 25341984813, 371, 145, 108, 0, 12037652773, 665, 0, 1ULL, 146, 1, 108, 0, 427, 12037652773, 2, 16777216, 665, 1, 0, 1ULL, 146, 1, 12037652781, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652781, 665, 0, 428, 1, 2, 0, 1ULL, 146, 1, 12037652782, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652782, 665, 0, 429, 1, 2, 0, 1ULL, 146, 1, 12037652783, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652783, 665, 0, 430, 1, 2, 0, 1ULL, 146, 1, 12037652784, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652784, 665, 0, 431, 1, 2, 0, 12037652781, 665, 12037652785, 665, 1, 146, 0, 0, 1, 12037652785, 665, 1, 25341984812, 371, 12037652781, 665, 2, 0, 1, 432, 12037652785, 2, 16777216, 665, 2, 0, 12037652782, 665, 12037652786, 665, 1, 146, 0, 0, 1, 12037652786, 665, 1, 25341984812, 371, 12037652782, 665, 2, 0, 1, 433, 12037652786, 2, 16777216, 665, 2, 0, 12037652783, 665, 12037652787, 665, 1, 146, 0, 0, 1, 12037652787, 665, 1, 25341984812, 371, 12037652783, 665, 2, 0, 1, 434, 12037652787, 2, 16777216, 665, 2, 0, 12037652784, 665, 12037652788, 665, 1, 146, 0, 0, 1, 12037652788, 665, 1, 25341984812, 371, 12037652784, 665, 2, 0, 1, 435, 12037652788, 2, 16777216, 665, 2, 0, 1ULL, 146, 2, 12037652789, 665, 0, 0, 12037652789, 665, 1ULL, 1, 146, 25341984812, 371, 3, 0, 1, 0, 2, 3, 1, 0, 25341984812, 371, 436, 12037652789, 2, 16777216, 665, 1, 0, 25341984812, 371, 12037652790, 2, 16777216, 665, 1, 25341984812, 371, 12037652776, 2, 16777216, 665, 437, 0, 1, 0, 1ULL, 25341984812, 371, 1, 12037652790, 2, 16777216, 665, 0, 0, 1ULL, 25341984812, 371, 2, 12037652790, 665, 0, 438, 1, 2, 0, 12037652775, 2, 16777216, 665, 12037652775, 665, 1, 1ULL, 25341984812, 371, 2, 0, 1, 439, 2, 0ULL, 0, 1ULL, 0, 2, 16777216, 2, 25341984812, 371, 0, 0, 12037652775, 2, 16777216, 665, 1ULL, 1, 0, 12037652775, 665, 0, 1, 2, 440, 0, 0ULL, 0, 12037652791, 665, 12037652793, 665, 913, 1ULL, 0, 0, 12037652791, 665, 913, 441, 0, 0ULL, 0, 1ULL, 913, 2, 12037652791, 2, 16777216, 665, 0, 0, 12037652791, 665, 1ULL, 1, 1ULL, 913, 3, 0, 1, 442, 2, 3, 0, 1ULL, 913, 1, 12037652792, 2, 16777216, 665, 0, 0, 1ULL, 913, 2, 12037652792, 665, 0, 443, 1, 2, 1, 913, 12037652791, 2, 16777216, 665, 0, 12037652792, 2, 16777216, 665, 1ULL, 2, 913, 0, 444, 1, 2, 0, 1ULL, 913, 1, 25341984814, 371, 0, 445, 12037652802, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984815, 371, 0, 446, 12037652803, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984816, 371, 0, 447, 12037652804, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984817, 371, 0, 448, 12037652805, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984818, 371, 0, 449, 12037652806, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984819, 371, 0, 450, 12037652807, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984820, 371, 0, 451, 12037652808, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984821, 371, 0, 452, 12037652809, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 0, 25341984812, 371, 453, 1, 0ULL, 0, 1ULL, 12037652879, 665, 1, 0, 12037652880, 665, 0, 1, 0, 1, 12037652892, 665, 0, 0, 1, 12037652877, 665, 454, 12037652892, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652822, 665, 1, 12037652857, 665, 12037652826, 665, 2, 0, 1, 0, 12037652858, 665, 12037652830, 665, 1, 2, 0, 0, 12037652859, 665, 12037652834, 665, 2, 1, 0, 0, 12037652860, 665, 12037652838, 665, 1, 2, 0, 0, 12037652863, 665, 12037652846, 665, 2, 1, 0, 0, 12037652861, 665, 12037652842, 665, 1, 2, 0, 0, 12037652864, 665, 12037652810, 665, 2, 1, 0, 0, 12037652862, 665, 12037652850, 665, 1, 2, 0, 0, 12037652865, 665, 12037652837, 665, 2, 1, 0, 905, 2, 12037652887, 665, 0, 905, 12037652814, 665, 1, 12037652866, 665, 0, 0, 1, 12037652814, 665, 455, 12037652814, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652823, 665, 1, 12037652857, 665, 12037652827, 665, 2, 0, 1, 0, 12037652858, 665, 12037652831, 665, 1, 2, 0, 0, 12037652859, 665, 12037652835, 665, 2, 1, 0, 0, 12037652860, 665, 12037652839, 665, 1, 2, 0, 0, 12037652863, 665, 12037652847, 665, 2, 1, 0, 0, 12037652861, 665, 12037652843, 665, 1, 2, 0, 0, 12037652864, 665, 12037652811, 665, 2, 1, 0, 0, 12037652865, 665, 12037652834, 665, 1, 2, 0, 110, 1, 12037652888, 665, 0, 110, 12037652815, 665, 1, 12037652866, 665, 0, 0, 1, 12037652815, 665, 456, 12037652815, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652824, 665, 1, 12037652857, 665, 12037652828, 665, 2, 0, 1, 0, 12037652858, 665, 12037652832, 665, 1, 2, 0, 0, 12037652859, 665, 12037652836, 665, 2, 1, 0, 0, 12037652860, 665, 12037652840, 665, 1, 2, 0, 0, 12037652863, 665, 12037652848, 665, 2, 1, 0, 0, 12037652861, 665, 12037652844, 665, 1, 2, 0, 0, 12037652864, 665, 12037652812, 665, 2, 1, 0, 0, 12037652865, 665, 12037652835, 665, 1, 2, 0, 111, 1, 12037652889, 665, 0, 111, 12037652816, 665, 1, 12037652866, 665, 0, 0, 1, 12037652816, 665, 457, 12037652816, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652825, 665, 1, 12037652857, 665, 12037652829, 665, 2, 0, 1, 0, 12037652858, 665, 12037652833, 665, 1, 2, 0, 0, 12037652859, 665, 12037652837, 665, 2, 1, 0, 0, 12037652860, 665, 12037652841, 665, 1, 2, 0, 0, 12037652863, 665, 12037652849, 665, 2, 1, 0, 0, 12037652861, 665, 12037652845, 665, 1, 2, 0, 0, 12037652864, 665, 12037652813, 665, 2, 1, 0, 0, 12037652865, 665, 12037652836, 665, 1, 2, 0, 112, 1, 12037652890, 665, 0, 112, 12037652817, 665, 1, 12037652866, 665, 0, 0, 1, 12037652817, 665, 458, 12037652817, 2, 16777216, 665, 0, 0, 905, 12037652818, 665, 1, 12037652867, 665, 0, 0, 1, 12037652818, 665, 459, 12037652818, 2, 16777216, 665, 0, 0, 110, 12037652819, 665, 1, 12037652867, 665, 0, 0, 1, 12037652819, 665, 460, 12037652819, 2, 16777216, 665, 0, 0, 111, 12037652820, 665, 1, 12037652867, 665, 0, 0, 1, 12037652820, 665, 461, 12037652820, 2, 16777216, 665, 0, 0, 112, 12037652821, 665, 1, 12037652867, 665, 0, 0, 1, 12037652821, 665, 462, 12037652821, 2, 16777216, 665, 0, 0, 905, 12037652822, 665, 1, 12037652868, 665, 0, 0, 1, 12037652822, 665, 463, 12037652822, 2, 16777216, 665, 0, 0, 110, 12037652823, 665, 1, 12037652868, 665, 0, 0, 1, 12037652823, 665, 464, 12037652823, 2, 16777216, 665, 0, 0, 111, 12037652824, 665, 1, 12037652868, 665, 0, 0, 1, 12037652824, 665, 465, 12037652824, 2, 16777216, 665, 0, 0, 112, 12037652825, 665, 1, 12037652868, 665, 0, 0, 1, 12037652825, 665, 466, 12037652825, 2, 16777216, 665, 0, 0, 905, 12037652826, 665, 1, 12037652869, 665, 0, 0, 1, 12037652826, 665, 467, 12037652826, 2, 16777216, 665, 0, 0, 110, 12037652827, 665, 1, 12037652869, 665, 0, 0, 1, 12037652827, 665, 468, 12037652827, 2, 16777216, 665, 0, 0, 111, 12037652828, 665, 1, 12037652869, 665, 0, 0, 1, 12037652828, 665, 469, 12037652828, 2, 16777216, 665, 0, 0, 112, 12037652829, 665, 1, 12037652869, 665, 0, 0, 1, 12037652829, 665, 470, 12037652829, 2, 16777216, 665, 0, 0, 905, 12037652830, 665, 1, 12037652870, 665, 0, 0, 1, 12037652830, 665, 471, 12037652830, 2, 16777216, 665, 0, 0, 110, 12037652831, 665, 1, 12037652870, 665, 0, 0, 1, 12037652831, 665, 472, 12037652831, 2, 16777216, 665, 0, 0, 111, 12037652832, 665, 1, 12037652870, 665, 0, 0, 1, 12037652832, 665, 473, 12037652832, 2, 16777216, 665, 0, 0, 112, 12037652833, 665, 1, 12037652870, 665, 0, 0, 1, 12037652833, 665, 474, 12037652833, 2, 16777216, 665, 0, 0, 905, 12037652834, 665, 1, 12037652871, 665, 0, 0, 1, 12037652834, 665, 475, 12037652834, 2, 16777216, 665, 0, 0, 110, 12037652835, 665, 1, 12037652871, 665, 0, 0, 1, 12037652835, 665, 476, 12037652835, 2, 16777216, 665, 0, 0, 111, 12037652836, 665, 1, 12037652871, 665, 0, 0, 1, 12037652836, 665, 477, 12037652836, 2, 16777216, 665, 0, 0, 112, 12037652837, 665, 1, 12037652871, 665, 0, 0, 1, 12037652837, 665, 478, 12037652837, 2, 16777216, 665, 0, 0, 905, 12037652838, 665, 1, 12037652872, 665, 0, 0, 1, 12037652838, 665, 479, 12037652838, 2, 16777216, 665, 0, 0, 110, 12037652839, 665, 1, 12037652872, 665, 0, 0, 1, 12037652839, 665, 480, 12037652839, 2, 16777216, 665, 0, 0, 111, 12037652840, 665, 1, 12037652872, 665, 0, 0, 1, 12037652840, 665, 481, 12037652840, 2, 16777216, 665, 0, 0, 112, 12037652841, 665, 1, 12037652872, 665, 0, 0, 1, 12037652841, 665, 482, 12037652841, 2, 16777216, 665, 0, 0, 2ULL, 12037652842, 665, 1, 0, 12037652850, 665, 0, 1, 12037652842, 665, 1, 12037652851, 665, 0, 2, 1, 12037652842, 665, 0, 905, 12037652842, 665, 1, 12037652873, 665, 0, 0, 2, 12037652842, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652842, 665, 483, 12037652842, 2, 16777216, 665, 1, 0, 2ULL, 12037652843, 665, 1, 0, 12037652850, 665, 0, 1, 12037652843, 665, 1, 12037652852, 665, 0, 2, 1, 12037652843, 665, 0, 110, 12037652843, 665, 1, 12037652873, 665, 0, 0, 2, 12037652843, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652843, 665, 484, 12037652843, 2, 16777216, 665, 1, 0, 2ULL, 12037652844, 665, 1, 0, 12037652850, 665, 0, 1, 12037652844, 665, 1, 12037652853, 665, 0, 2, 1, 12037652844, 665, 0, 111, 12037652844, 665, 1, 12037652873, 665, 0, 0, 2, 12037652844, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652844, 665, 485, 12037652844, 2, 16777216, 665, 1, 0, 2ULL, 12037652845, 665, 1, 0, 12037652850, 665, 0, 1, 12037652845, 665, 1, 12037652854, 665, 0, 2, 1, 12037652845, 665, 0, 112, 12037652845, 665, 1, 12037652873, 665, 0, 0, 2, 12037652845, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652845, 665, 486, 12037652845, 2, 16777216, 665, 1, 0, 2ULL, 12037652846, 665, 1, 0, 12037652850, 665, 0, 1, 12037652846, 665, 1, 12037652851, 665, 0, 3, 1, 12037652846, 665, 0, 2ULL, 12037652846, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652846, 665, 1, 12037652851, 665, 0, 4, 1, 12037652846, 665, 0, 905, 12037652846, 665, 1, 12037652874, 665, 0, 0, 3, 12037652846, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652846, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652846, 665, 487, 12037652846, 2, 16777216, 665, 1, 0, 2ULL, 12037652847, 665, 1, 0, 12037652850, 665, 0, 1, 12037652847, 665, 1, 12037652852, 665, 0, 3, 1, 12037652847, 665, 0, 2ULL, 12037652847, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652847, 665, 1, 12037652852, 665, 0, 4, 1, 12037652847, 665, 0, 110, 12037652847, 665, 1, 12037652874, 665, 0, 0, 3, 12037652847, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652847, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652847, 665, 488, 12037652847, 2, 16777216, 665, 1, 0, 2ULL, 12037652848, 665, 1, 0, 12037652850, 665, 0, 1, 12037652848, 665, 1, 12037652853, 665, 0, 3, 1, 12037652848, 665, 0, 2ULL, 12037652848, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652848, 665, 1, 12037652853, 665, 0, 4, 1, 12037652848, 665, 0, 111, 12037652848, 665, 1, 12037652874, 665, 0, 0, 3, 12037652848, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652848, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652848, 665, 489, 12037652848, 2, 16777216, 665, 1, 0, 2ULL, 12037652849, 665, 1, 0, 12037652850, 665, 0, 1, 12037652849, 665, 1, 12037652854, 665, 0, 3, 1, 12037652849, 665, 0, 2ULL, 12037652849, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652849, 665, 1, 12037652854, 665, 0, 4, 1, 12037652849, 665, 0, 112, 12037652849, 665, 1, 12037652874, 665, 0, 0, 3, 12037652849, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652849, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652849, 665, 490, 12037652849, 2, 16777216, 665, 1, 0, 905, 12037652850, 665, 1, 12037652875, 665, 0, 0, 1, 12037652850, 665, 491, 12037652850, 2, 16777216, 665, 0, 0, 1ULL, 12037652850, 665, 1, 12037652850, 665, 0, 492, 1, 0ULL, 0, 12037652852, 665, 12037652851, 665, 1, 12037652884, 665, 0, 2, 1, 12037652851, 665, 0, 905, 12037652851, 665, 1, 12037652876, 665, 0, 0, 2, 12037652851, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652851, 665, 493, 12037652851, 2, 16777216, 665, 1, 0, 12037652853, 665, 12037652852, 665, 1, 12037652884, 665, 0, 2, 1, 12037652852, 665, 0, 110, 12037652852, 665, 1, 12037652876, 665, 0, 0, 2, 12037652852, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652852, 665, 494, 12037652852, 2, 16777216, 665, 1, 0, 12037652854, 665, 12037652853, 665, 1, 12037652884, 665, 0, 2, 1, 12037652853, 665, 0, 111, 12037652853, 665, 1, 12037652876, 665, 0, 0, 2, 12037652853, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652853, 665, 495, 12037652853, 2, 16777216, 665, 1, 0, 12037652851, 665, 12037652854, 665, 1, 12037652884, 665, 0, 2, 1, 12037652854, 665, 0, 112, 12037652854, 665, 1, 12037652876, 665, 0, 0, 2, 12037652854, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652854, 665, 496, 12037652854, 2, 16777216, 665, 1, 0, 25341984822, 371, 905, 497, 0, 0ULL, 0, 12037652885, 665, 25341984822, 371, 2, 0, 12037652886, 665, 0, 12037652891, 665, 12037652855, 665, 1, 0, 1ULL, 0, 2, 1, 1, 0, 12037652855, 665, 0, 1, 1ULL, 498, 12037652855, 2, 16777216, 665, 0, 0, 12037652855, 665, 0, 499, 0, 0ULL, 0, 8589934592ULL, 12037652897, 665, 1, 4194304ULL, 12037652896, 665, 2, 0, 1, 0, 2048ULL, 12037652895, 665, 1, 2, 0, 120, 1, 12037652894, 665, 0, 0, 120, 500, 0, 0ULL, 0, 8589934592ULL, 12037652901, 665, 1, 4194304ULL, 12037652900, 665, 2, 0, 1, 0, 2048ULL, 12037652899, 665, 1, 2, 0, 121, 1, 12037652898, 665, 0, 17592186044415ULL, 121, 1, 0, 0, 501, 1, 0ULL, 0, 1ULL, 193, 1, 0, 12037652907, 665, 0, 12037652906, 665, 194, 2, 1, 0, 502, 12037652907, 2, 16777216, 665, 2, 0, 1ULL, 12037652906, 665, 1, 12037652906, 665, 0, 503, 1, 0ULL, 0, 12037652907, 665, 120, 1, 193, 0, 504, 1, 0ULL, 0, 1ULL, 197, 1, 12037652910, 665, 0, 0, 12037652908, 665, 198, 2, 1, 0, 505, 12037652910, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652912, 665, 0, 0, 12037652909, 665, 201, 2, 1, 0, 506, 12037652912, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652913, 665, 0, 0, 12037652909, 665, 202, 2, 1, 0, 507, 12037652913, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652914, 665, 0, 0, 12037652909, 665, 203, 2, 1, 0, 508, 12037652914, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652915, 665, 0, 0, 12037652909, 665, 204, 2, 1, 0, 509, 12037652915, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652916, 665, 0, 0, 12037652909, 665, 205, 2, 1, 0, 510, 12037652916, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652917, 665, 0, 0, 12037652909, 665, 206, 2, 1, 0, 511, 12037652917, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652918, 665, 0, 0, 12037652909, 665, 207, 2, 1, 0, 512, 12037652918, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652919, 665, 0, 0, 12037652909, 665, 208, 2, 1, 0, 513, 12037652919, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652911, 2, 16777216, 665, 0, 0, 1ULL, 200, 2, 12037652911, 665, 0, 514, 1, 2, 0, 1ULL, 12037652911, 665, 1, 12037652911, 665, 0, 515, 1, 0ULL, 0, 1ULL, 12037652908, 665, 1, 12037652908, 665, 0, 516, 1, 0ULL, 0, 1ULL, 199, 1, 0, 12037652908, 665, 517, 1, 0ULL, 0, 1ULL, 12037652909, 665, 1, 12037652909, 665, 0, 518, 1, 0ULL, 0, 1ULL, 25341984824, 371, 2, 12037652923, 2, 16777216, 665, 0, 0, 12037652923, 665, 1ULL, 1, 1ULL, 25341984824, 371, 3, 0, 1, 519, 2, 3, 0, 12037652923, 665, 12037652924, 665, 907, 1ULL, 0, 0, 907, 12037652923, 665, 520, 0, 0ULL, 0, 907, 12037652925, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 521, 12037652925, 2, 16777216, 665, 2, 0, 1ULL, 12037652925, 665, 1, 12037652925, 665, 0, 522, 1, 0ULL, 0, 1ULL, 12037652926, 665, 1, 12037652926, 665, 0, 523, 1, 0ULL, 0, 1ULL, 12037652927, 665, 1, 12037652927, 665, 0, 524, 1, 0ULL, 0, 1ULL, 25341984825, 371, 1, 12037652926, 665, 0, 525, 1, 0ULL, 0, 1ULL, 25341984825, 371, 1, 12037652927, 665, 0, 526, 1, 0ULL, 0, 1ULL, 213, 1, 12037652921, 2, 16777216, 665, 0, 0, 1ULL, 213, 2, 12037652921, 665, 0, 527, 1, 2, 1, 12037652921, 2, 16777216, 665, 213, 0, 1ULL, 25341984824, 371, 2, 0, 213, 528, 1, 2, 0, 1ULL, 25341984824, 371, 1, 0, 217, 529, 1, 0ULL, 0, 25341984824, 371, 12037652928, 2, 16777216, 665, 1, 25341984824, 371, 12037652923, 2, 16777216, 665, 530, 0, 1, 0, 1ULL, 25341984824, 371, 1, 12037652928, 2, 16777216, 665, 0, 0, 1ULL, 25341984824, 371, 2, 12037652928, 665, 0, 531, 1, 2, 0, 12037652929, 2, 16777216, 665, 12037652929, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 532, 2, 0ULL, 0, 12037652930, 2, 16777216, 665, 12037652930, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 533, 2, 0ULL, 0, 12037652931, 2, 16777216, 665, 12037652931, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 534, 2, 0ULL, 0, 12037652932, 2, 16777216, 665, 12037652932, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 535, 2, 0ULL, 0, 12037652933, 2, 16777216, 665, 12037652933, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 536, 2, 0ULL, 0, 12037652934, 2, 16777216, 665, 12037652934, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 537, 2, 0ULL, 0, 12037652935, 2, 16777216, 665, 12037652935, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 538, 2, 0ULL, 0, 12037652936, 2, 16777216, 665, 12037652936, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 539, 2, 0ULL, 0, 12037652922, 2, 16777216, 665, 12037652922, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 540, 2, 0ULL, 0, 12037652922, 2, 16777216, 665, 1ULL, 1, 0, 12037652922, 665, 0, 1, 25341984825, 371, 541, 0, 0ULL, 0, 1ULL, 213, 2, 12037652937, 665, 0, 0, 12037652937, 665, 1ULL, 1, 213, 25341984824, 371, 3, 0, 1, 0, 2, 3, 1, 0, 25341984824, 371, 542, 12037652937, 2, 16777216, 665, 1, 0, 12037652938, 665, 12037652940, 665, 912, 1ULL, 0, 0, 12037652938, 665, 912, 543, 0, 0ULL, 0, 1ULL, 912, 2, 12037652938, 2, 16777216, 665, 0, 0, 12037652938, 665, 1ULL, 1, 1ULL, 912, 3, 0, 1, 544, 2, 3, 0, 1ULL, 912, 1, 12037652939, 2, 16777216, 665, 0, 0, 1ULL, 912, 2, 12037652939, 665, 0, 545, 1, 2, 1, 912, 12037652938, 2, 16777216, 665, 0, 12037652939, 2, 16777216, 665, 1ULL, 2, 912, 0, 546, 1, 2, 0, 1ULL, 912, 1, 25341984827, 371, 0, 547, 12037652949, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984828, 371, 0, 548, 12037652950, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984829, 371, 0, 549, 12037652951, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984830, 371, 0, 550, 12037652952, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984831, 371, 0, 551, 12037652953, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984832, 371, 0, 552, 12037652954, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984833, 371, 0, 553, 12037652955, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984834, 371, 0, 554, 12037652956, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 0, 25341984824, 371, 555, 1, 0ULL, 0, 12037652969, 665, 1ULL, 1, 12037652969, 665, 0, 556, 1, 0ULL, 0, 1ULL, 12037652969, 665, 1, 12037652957, 2, 16777216, 665, 12037652957, 665, 2, 0, 1, 557, 2, 0ULL, 0, 12037652959, 665, 1ULL, 1, 12037652959, 665, 0, 558, 1, 0ULL, 0, 12037652960, 665, 1ULL, 1, 12037652960, 665, 0, 559, 1, 0ULL, 0, 1ULL, 12037652959, 665, 1, 0, 12037652960, 665, 560, 1, 0ULL, 109, 1ULL, 1, 0, 12037652969, 665, 1ULL, 1, 1ULL, 109, 2, 0, 1, 561, 2, 0ULL, 0, 12037652961, 2, 16777216, 665, 12037652961, 665, 1, 25341984835, 371, 0, 562, 1, 0ULL, 0, 12037652962, 2, 16777216, 665, 12037652962, 665, 1, 25341984835, 371, 0, 563, 1, 0ULL, 0, 12037652963, 2, 16777216, 665, 12037652963, 665, 1, 25341984835, 371, 0, 564, 1, 0ULL, 0, 12037652964, 2, 16777216, 665, 12037652964, 665, 1, 25341984835, 371, 0, 565, 1, 0ULL, 0, 12037652965, 2, 16777216, 665, 12037652965, 665, 1, 25341984835, 371, 0, 566, 1, 0ULL, 0, 12037652966, 2, 16777216, 665, 12037652966, 665, 1, 25341984835, 371, 0, 567, 1, 0ULL, 0, 12037652967, 2, 16777216, 665, 12037652967, 665, 1, 25341984835, 371, 0, 568, 1, 0ULL, 0, 12037652968, 2, 16777216, 665, 12037652968, 665, 1, 25341984835, 371, 0, 569, 1, 0ULL, 0, 25341984836, 371, 12037652961, 2, 16777216, 665, 570, 0, 0ULL, 0, 25341984836, 371, 12037652962, 2, 16777216, 665, 571, 0, 0ULL, 0, 25341984836, 371, 12037652963, 2, 16777216, 665, 572, 0, 0ULL, 0, 25341984836, 371, 12037652964, 2, 16777216, 665, 573, 0, 0ULL, 0, 25341984836, 371, 12037652965, 2, 16777216, 665, 574, 0, 0ULL, 0, 25341984836, 371, 12037652966, 2, 16777216, 665, 575, 0, 0ULL, 0, 25341984836, 371, 12037652967, 2, 16777216, 665, 576, 0, 0ULL, 0, 25341984836, 371, 12037652968, 2, 16777216, 665, 577, 0, 0ULL, 0, 1ULL, 12037653107, 665, 1, 12037653107, 665, 0, 578, 1, 0ULL, 0, 1ULL, 12037653130, 665, 1, 12037653130, 665, 0, 579, 1, 0ULL, 0, 1ULL, 12037653129, 665, 1, 12037653129, 665, 0, 580, 1, 0ULL, 0, 1ULL, 12037653128, 665, 1, 12037653128, 665, 0, 581, 1, 0ULL, 0, 1ULL, 12037653127, 665, 1, 12037653127, 665, 0, 582, 1, 0ULL, 0, 1ULL, 12037653126, 665, 1, 12037653126, 665, 0, 583, 1, 0ULL, 0, 1ULL, 12037653125, 665, 1, 12037653125, 665, 0, 584, 1, 0ULL, 0, 1ULL, 12037653124, 665, 1, 12037653124, 665, 0, 585, 1, 0ULL, 0, 1ULL, 12037653123, 665, 1, 12037653123, 665, 0, 586, 1, 0ULL, 0, 1ULL, 12037653122, 665, 1, 12037653122, 665, 0, 587, 1, 0ULL, 0, 12037652977, 665, 12037653042, 665, 1, 12037652985, 665, 12037653043, 665, 2, 0, 1, 0, 12037652993, 665, 12037653044, 665, 1, 2, 0, 0, 12037652986, 665, 12037653045, 665, 2, 1, 0, 0, 12037653001, 665, 12037653046, 665, 1, 2, 0, 0, 12037653009, 665, 12037653047, 665, 2, 1, 0, 0, 12037653041, 665, 12037653049, 665, 1, 2, 0, 0, 12037653017, 665, 12037653048, 665, 2, 1, 0, 0, 12037653018, 665, 12037653050, 665, 1, 2, 0, 0, 12037653019, 665, 12037653051, 665, 2, 1, 0, 0, 12037653020, 665, 12037653052, 665, 1, 2, 0, 0, 12037653021, 665, 12037653053, 665, 2, 1, 0, 0, 12037653054, 665, 45, 1, 2, 0, 0, 12037653023, 665, 12037653055, 665, 2, 1, 0, 0, 12037653024, 665, 12037653056, 665, 1, 2, 0, 0, 12037653108, 665, 12037653114, 665, 2, 1, 0, 0, 12037653109, 665, 12037653115, 665, 1, 2, 0, 0, 12037653110, 665, 12037653116, 665, 2, 1, 0, 0, 12037653111, 665, 12037653117, 665, 1, 2, 0, 0, 12037653112, 665, 12037653118, 665, 2, 1, 0, 0, 12037653113, 665, 12037653119, 665, 1, 2, 0, 0, 12037653025, 665, 12037653057, 665, 2, 1, 0, 909, 2, 12037653033, 665, 0, 4294967296ULL, 12037653107, 665, 1, 0, 909, 3, 12037653072, 665, 1, 0, 2147483648ULL, 12037653130, 665, 1, 1073741824ULL, 12037653129, 665, 2, 0, 1, 0, 536870912ULL, 12037653128, 665, 1, 2, 0, 0, 268435456ULL, 12037653127, 665, 2, 1, 0, 0, 134217728ULL, 12037653126, 665, 1, 2, 0, 0, 67108864ULL, 12037653125, 665, 2, 1, 0, 0, 33554432ULL, 12037653124, 665, 1, 2, 0, 0, 16777216ULL, 12037653123, 665, 2, 1, 0, 0, 8388608ULL, 12037653122, 665, 1, 2, 0, 0, 1, 12037653121, 665, 588, 3, 0, 0, 12037653025, 665, 12037653131, 665, 911, 1ULL, 0, 0, 911, 12037653025, 665, 589, 0, 0ULL, 0, 25341984837, 371, 909, 590, 0, 0ULL, 0, 909, 12037652977, 665, 1, 12037653058, 665, 0, 0, 1, 12037652977, 665, 591, 12037652977, 2, 16777216, 665, 0, 0, 12037652976, 665, 12037653042, 665, 1, 12037652984, 665, 12037653043, 665, 2, 0, 1, 0, 12037652992, 665, 12037653044, 665, 1, 2, 0, 0, 12037652993, 665, 12037653045, 665, 2, 1, 0, 0, 12037653000, 665, 12037653046, 665, 1, 2, 0, 0, 12037653008, 665, 12037653047, 665, 2, 1, 0, 0, 12037653016, 665, 12037653048, 665, 1, 2, 0, 0, 12037653040, 665, 12037653049, 665, 2, 1, 0, 113, 2, 12037653032, 665, 0, 113, 12037652976, 665, 1, 12037653058, 665, 0, 0, 1, 12037652976, 665, 592, 12037652976, 2, 16777216, 665, 0, 0, 12037652975, 665, 12037653042, 665, 1, 12037652983, 665, 12037653043, 665, 2, 0, 1, 0, 12037652991, 665, 12037653044, 665, 1, 2, 0, 0, 12037652992, 665, 12037653045, 665, 2, 1, 0, 0, 12037652999, 665, 12037653046, 665, 1, 2, 0, 0, 12037653007, 665, 12037653047, 665, 2, 1, 0, 0, 12037653015, 665, 12037653048, 665, 1, 2, 0, 0, 12037653039, 665, 12037653049, 665, 2, 1, 0, 114, 2, 12037653031, 665, 0, 114, 12037652975, 665, 1, 12037653058, 665, 0, 0, 1, 12037652975, 665, 593, 12037652975, 2, 16777216, 665, 0, 0, 12037652974, 665, 12037653042, 665, 1, 12037652982, 665, 12037653043, 665, 2, 0, 1, 0, 12037652990, 665, 12037653044, 665, 1, 2, 0, 0, 12037652991, 665, 12037653045, 665, 2, 1, 0, 0, 12037652998, 665, 12037653046, 665, 1, 2, 0, 0, 12037653006, 665, 12037653047, 665, 2, 1, 0, 0, 12037653014, 665, 12037653048, 665, 1, 2, 0, 0, 12037653038, 665, 12037653049, 665, 2, 1, 0, 115, 2, 12037653030, 665, 0, 115, 12037652974, 665, 1, 12037653058, 665, 0, 0, 1, 12037652974, 665, 594, 12037652974, 2, 16777216, 665, 0, 0, 12037652973, 665, 12037653042, 665, 1, 12037652981, 665, 12037653043, 665, 2, 0, 1, 0, 12037652989, 665, 12037653044, 665, 1, 2, 0, 0, 12037652990, 665, 12037653045, 665, 2, 1, 0, 0, 12037652997, 665, 12037653046, 665, 1, 2, 0, 0, 12037653005, 665, 12037653047, 665, 2, 1, 0, 0, 12037653013, 665, 12037653048, 665, 1, 2, 0, 0, 12037653037, 665, 12037653049, 665, 2, 1, 0, 116, 2, 12037653029, 665, 0, 116, 12037652973, 665, 1, 12037653058, 665, 0, 0, 1, 12037652973, 665, 595, 12037652973, 2, 16777216, 665, 0, 0, 12037652972, 665, 12037653042, 665, 1, 12037652980, 665, 12037653043, 665, 2, 0, 1, 0, 12037652988, 665, 12037653044, 665, 1, 2, 0, 0, 12037652989, 665, 12037653045, 665, 2, 1, 0, 0, 12037652996, 665, 12037653046, 665, 1, 2, 0, 0, 12037653004, 665, 12037653047, 665, 2, 1, 0, 0, 12037653012, 665, 12037653048, 665, 1, 2, 0, 0, 12037653036, 665, 12037653049, 665, 2, 1, 0, 117, 2, 12037653028, 665, 0, 117, 12037652972, 665, 1, 12037653058, 665, 0, 0, 1, 12037652972, 665, 596, 12037652972, 2, 16777216, 665, 0, 0, 12037652971, 665, 12037653042, 665, 1, 12037652979, 665, 12037653043, 665, 2, 0, 1, 0, 12037652987, 665, 12037653044, 665, 1, 2, 0, 0, 12037652988, 665, 12037653045, 665, 2, 1, 0, 0, 12037652995, 665, 12037653046, 665, 1, 2, 0, 0, 12037653003, 665, 12037653047, 665, 2, 1, 0, 0, 12037653011, 665, 12037653048, 665, 1, 2, 0, 0, 12037653035, 665, 12037653049, 665, 2, 1, 0, 118, 2, 12037653027, 665, 0, 118, 12037652971, 665, 1, 12037653058, 665, 0, 0, 1, 12037652971, 665, 597, 12037652971, 2, 16777216, 665, 0, 0, 12037652970, 665, 12037653042, 665, 1, 12037652978, 665, 12037653043, 665, 2, 0, 1, 0, 12037652986, 665, 12037653044, 665, 1, 2, 0, 0, 12037652987, 665, 12037653045, 665, 2, 1, 0, 0, 12037652994, 665, 12037653046, 665, 1, 2, 0, 0, 12037653002, 665, 12037653047, 665, 2, 1, 0, 0, 12037653010, 665, 12037653048, 665, 1, 2, 0, 0, 12037653034, 665, 12037653049, 665, 2, 1, 0, 119, 2, 12037653026, 665, 0, 119, 12037652970, 665, 1, 12037653058, 665, 0, 0, 1, 12037652970, 665, 598, 12037652970, 2, 16777216, 665, 0, 0, 909, 12037652985, 665, 1, 12037653059, 665, 0, 0, 1, 12037652985, 665, 599, 12037652985, 2, 16777216, 665, 0, 0, 113, 12037652984, 665, 1, 12037653059, 665, 0, 0, 1, 12037652984, 665, 600, 12037652984, 2, 16777216, 665, 0, 0, 114, 12037652983, 665, 1, 12037653059, 665, 0, 0, 1, 12037652983, 665, 601, 12037652983, 2, 16777216, 665, 0, 0, 115, 12037652982, 665, 1, 12037653059, 665, 0, 0, 1, 12037652982, 665, 602, 12037652982, 2, 16777216, 665, 0, 0, 116, 12037652981, 665, 1, 12037653059, 665, 0, 0, 1, 12037652981, 665, 603, 12037652981, 2, 16777216, 665, 0, 0, 117, 12037652980, 665, 1, 12037653059, 665, 0, 0, 1, 12037652980, 665, 604, 12037652980, 2, 16777216, 665, 0, 0, 118, 12037652979, 665, 1, 12037653059, 665, 0, 0, 1, 12037652979, 665, 605, 12037652979, 2, 16777216, 665, 0, 0, 119, 12037652978, 665, 1, 12037653059, 665, 0, 0, 1, 12037652978, 665, 606, 12037652978, 2, 16777216, 665, 0, 0, 909, 12037652993, 665, 1, 12037653060, 665, 0, 0, 1, 12037652993, 665, 607, 12037652993, 2, 16777216, 665, 0, 0, 113, 12037652992, 665, 1, 12037653060, 665, 0, 0, 1, 12037652992, 665, 608, 12037652992, 2, 16777216, 665, 0, 0, 114, 12037652991, 665, 1, 12037653060, 665, 0, 0, 1, 12037652991, 665, 609, 12037652991, 2, 16777216, 665, 0, 0, 115, 12037652990, 665, 1, 12037653060, 665, 0, 0, 1, 12037652990, 665, 610, 12037652990, 2, 16777216, 665, 0, 0, 116, 12037652989, 665, 1, 12037653060, 665, 0, 0, 1, 12037652989, 665, 611, 12037652989, 2, 16777216, 665, 0, 0, 117, 12037652988, 665, 1, 12037653060, 665, 0, 0, 1, 12037652988, 665, 612, 12037652988, 2, 16777216, 665, 0, 0, 118, 12037652987, 665, 1, 12037653060, 665, 0, 0, 1, 12037652987, 665, 613, 12037652987, 2, 16777216, 665, 0, 0, 119, 12037652986, 665, 1, 12037653060, 665, 0, 0, 1, 12037652986, 665, 614, 12037652986, 2, 16777216, 665, 0, 0, 909, 12037653001, 665, 1, 12037653061, 665, 0, 0, 1, 12037653001, 665, 615, 12037653001, 2, 16777216, 665, 0, 0, 113, 12037653000, 665, 1, 12037653061, 665, 0, 0, 1, 12037653000, 665, 616, 12037653000, 2, 16777216, 665, 0, 0, 114, 12037652999, 665, 1, 12037653061, 665, 0, 0, 1, 12037652999, 665, 617, 12037652999, 2, 16777216, 665, 0, 0, 115, 12037652998, 665, 1, 12037653061, 665, 0, 0, 1, 12037652998, 665, 618, 12037652998, 2, 16777216, 665, 0, 0, 116, 12037652997, 665, 1, 12037653061, 665, 0, 0, 1, 12037652997, 665, 619, 12037652997, 2, 16777216, 665, 0, 0, 117, 12037652996, 665, 1, 12037653061, 665, 0, 0, 1, 12037652996, 665, 620, 12037652996, 2, 16777216, 665, 0, 0, 118, 12037652995, 665, 1, 12037653061, 665, 0, 0, 1, 12037652995, 665, 621, 12037652995, 2, 16777216, 665, 0, 0, 119, 12037652994, 665, 1, 12037653061, 665, 0, 0, 1, 12037652994, 665, 622, 12037652994, 2, 16777216, 665, 0, 0, 909, 12037653009, 665, 1, 12037653062, 665, 0, 0, 1, 12037653009, 665, 623, 12037653009, 2, 16777216, 665, 0, 0, 113, 12037653008, 665, 1, 12037653062, 665, 0, 0, 1, 12037653008, 665, 624, 12037653008, 2, 16777216, 665, 0, 0, 114, 12037653007, 665, 1, 12037653062, 665, 0, 0, 1, 12037653007, 665, 625, 12037653007, 2, 16777216, 665, 0, 0, 115, 12037653006, 665, 1, 12037653062, 665, 0, 0, 1, 12037653006, 665, 626, 12037653006, 2, 16777216, 665, 0, 0, 116, 12037653005, 665, 1, 12037653062, 665, 0, 0, 1, 12037653005, 665, 627, 12037653005, 2, 16777216, 665, 0, 0, 117, 12037653004, 665, 1, 12037653062, 665, 0, 0, 1, 12037653004, 665, 628, 12037653004, 2, 16777216, 665, 0, 0, 118, 12037653003, 665, 1, 12037653062, 665, 0, 0, 1, 12037653003, 665, 629, 12037653003, 2, 16777216, 665, 0, 0, 119, 12037653002, 665, 1, 12037653062, 665, 0, 0, 1, 12037653002, 665, 630, 12037653002, 2, 16777216, 665, 0, 0, 909, 12037653017, 665, 1, 12037653063, 665, 0, 0, 1, 12037653017, 665, 631, 12037653017, 2, 16777216, 665, 0, 0, 113, 12037653016, 665, 1, 12037653063, 665, 0, 0, 1, 12037653016, 665, 632, 12037653016, 2, 16777216, 665, 0, 0, 114, 12037653015, 665, 1, 12037653063, 665, 0, 0, 1, 12037653015, 665, 633, 12037653015, 2, 16777216, 665, 0, 0, 115, 12037653014, 665, 1, 12037653063, 665, 0, 0, 1, 12037653014, 665, 634, 12037653014, 2, 16777216, 665, 0, 0, 116, 12037653013, 665, 1, 12037653063, 665, 0, 0, 1, 12037653013, 665, 635, 12037653013, 2, 16777216, 665, 0, 0, 117, 12037653012, 665, 1, 12037653063, 665, 0, 0, 1, 12037653012, 665, 636, 12037653012, 2, 16777216, 665, 0, 0, 118, 12037653011, 665, 1, 12037653063, 665, 0, 0, 1, 12037653011, 665, 637, 12037653011, 2, 16777216, 665, 0, 0, 119, 12037653010, 665, 1, 12037653063, 665, 0, 0, 1, 12037653010, 665, 638, 12037653010, 2, 16777216, 665, 0, 0, 909, 12037653018, 665, 1, 12037653064, 665, 0, 0, 1, 12037653018, 665, 639, 12037653018, 2, 16777216, 665, 0, 0, 12037653019, 665, 12037653076, 665, 1, 909, 0, 0, 12037653065, 665, 1, 1, 12037653019, 665, 12037653076, 665, 2, 0, 1, 640, 12037653019, 2, 16777216, 665, 2, 0, 909, 12037653020, 665, 1, 12037653066, 665, 0, 0, 1, 12037653020, 665, 641, 12037653020, 2, 16777216, 665, 0, 0, 909, 12037653023, 665, 2, 12037653068, 665, 0, 0, 12037653022, 665, 1ULL, 1, 0, 12037653023, 665, 0, 12037653105, 665, 1, 1, 2, 0, 0, 1, 12037653023, 665, 642, 12037653023, 2, 16777216, 665, 0, 0, 909, 12037653021, 665, 1, 12037653067, 665, 0, 0, 1, 12037653021, 665, 643, 12037653021, 2, 16777216, 665, 0, 0, 12037653025, 665, 25341984838, 371, 1, 909, 0, 0, 12037653070, 665, 1, 1, 12037653025, 665, 25341984838, 371, 2, 0, 1, 644, 12037653025, 2, 16777216, 665, 2, 0, 909, 12037653024, 665, 1, 12037653069, 665, 0, 2, 1, 12037653024, 665, 0, 12037653093, 665, 12037653097, 665, 1, 0, 12037653001, 665, 0, 2, 1, 1, 0, 12037653094, 665, 0, 1, 12037653098, 665, 645, 12037653024, 2, 16777216, 665, 0, 0, 12037653072, 665, 12037653107, 665, 1, 0, 12037653071, 665, 0, 12037653073, 665, 12037653082, 665, 2, 1, 0, 0, 12037653074, 665, 25341984837, 371, 1, 2, 0, 0, 1, 12037653106, 665, 2, 0, 12037653105, 665, 0, 12037653134, 665, 25341984841, 371, 1, 12037653136, 665, 0, 3, 1, 25341984841, 371, 0, 25341984840, 371, 25341984841, 371, 1, 2, 0, 0, 3, 25341984841, 371, 2, 25341984839, 371, 0, 0, 1, 2, 1, 0, 25341984841, 371, 646, 12037653022, 2, 16777216, 665, 1, 0, 12037653022, 665, 0, 647, 0, 0ULL, 0, 12037652977, 665, 909, 1, 0, 12037653103, 665, 648, 1, 0ULL, 0, 12037652976, 665, 113, 1, 0, 12037653103, 665, 649, 1, 0ULL, 0, 12037652975, 665, 114, 1, 0, 12037653103, 665, 650, 1, 0ULL, 0, 12037652974, 665, 115, 1, 0, 12037653103, 665, 651, 1, 0ULL, 0, 12037652973, 665, 116, 1, 0, 12037653103, 665, 652, 1, 0ULL, 0, 12037652972, 665, 117, 1, 0, 12037653103, 665, 653, 1, 0ULL, 0, 12037652971, 665, 118, 1, 0, 12037653103, 665, 654, 1, 0ULL, 0, 12037652970, 665, 119, 1, 0, 12037653103, 665, 655, 1, 0ULL, 0, 12037652985, 665, 0, 1, 0, 0, 656, 1, 0ULL, 0, 12037652984, 665, 1, 1, 0, 0, 657, 1, 0ULL, 0, 12037652983, 665, 2, 1, 0, 0, 658, 1, 0ULL, 0, 12037652982, 665, 3, 1, 0, 0, 659, 1, 0ULL, 0, 12037652981, 665, 4, 1, 0, 0, 660, 1, 0ULL, 0, 12037652980, 665, 5, 1, 0, 0, 661, 1, 0ULL, 0, 12037652979, 665, 6, 1, 0, 0, 662, 1, 0ULL, 0, 12037652978, 665, 7, 1, 0, 0, 663, 1, 0ULL, 0, 12037652993, 665, 8, 1, 0, 0, 664, 1, 0ULL, 0, 12037652992, 665, 9, 1, 0, 0, 665, 1, 0ULL, 0, 12037652991, 665, 10, 1, 0, 0, 666, 1, 0ULL, 0, 12037652990, 665, 11, 1, 0, 0, 667, 1, 0ULL, 0, 12037652989, 665, 12, 1, 0, 0, 668, 1, 0ULL, 0, 12037652988, 665, 13, 1, 0, 0, 669, 1, 0ULL, 0, 12037652987, 665, 14, 1, 0, 0, 670, 1, 0ULL, 0, 12037652986, 665, 15, 1, 0, 0, 671, 1, 0ULL, 0, 12037653019, 665, 16, 1, 0, 0, 672, 1, 0ULL, 0, 12037653021, 665, 17, 1, 0, 0, 673, 1, 0ULL, 0, 12037653018, 665, 18, 1, 0, 0, 674, 1, 0ULL, 0, 12037653017, 665, 19, 1, 1, 0, 675, 1, 0ULL, 0, 12037653016, 665, 20, 1, 1, 0, 676, 1, 0ULL, 0, 12037653015, 665, 21, 1, 1, 0, 677, 1, 0ULL, 0, 12037653014, 665, 22, 1, 1, 0, 678, 1, 0ULL, 0, 12037653013, 665, 23, 1, 1, 0, 679, 1, 0ULL, 0, 12037653012, 665, 24, 1, 1, 0, 680, 1, 0ULL, 0, 12037653011, 665, 25, 1, 1, 0, 681, 1, 0ULL, 0, 12037653010, 665, 26, 1, 1, 0, 682, 1, 0ULL, 0, 12037653001, 665, 27, 1, 1, 0, 683, 1, 0ULL, 0, 12037653000, 665, 28, 1, 1, 0, 684, 1, 0ULL, 0, 12037652999, 665, 29, 1, 1, 0, 685, 1, 0ULL, 0, 12037652998, 665, 30, 1, 1, 0, 686, 1, 0ULL, 0, 12037652997, 665, 31, 1, 1, 0, 687, 1, 0ULL, 0, 12037652996, 665, 32, 1, 1, 0, 688, 1, 0ULL, 0, 12037652995, 665, 33, 1, 1, 0, 689, 1, 0ULL, 0, 12037652994, 665, 34, 1, 1, 0, 690, 1, 0ULL, 0, 12037653009, 665, 35, 1, 1, 0, 691, 1, 0ULL, 0, 12037653008, 665, 36, 1, 1, 0, 692, 1, 0ULL, 0, 12037653007, 665, 37, 1, 1, 0, 693, 1, 0ULL, 0, 12037653006, 665, 38, 1, 1, 0, 694, 1, 0ULL, 0, 12037653005, 665, 39, 1, 1, 0, 695, 1, 0ULL, 0, 12037653004, 665, 40, 1, 1, 0, 696, 1, 0ULL, 0, 12037653003, 665, 41, 1, 1, 0, 697, 1, 0ULL, 0, 12037653002, 665, 42, 1, 1, 0, 698, 1, 0ULL, 0, 12037653020, 665, 43, 1, 1, 0, 699, 1, 0ULL, 0, 1ULL, 12037653087, 665, 1, 0, 12037653087, 665, 700, 1, 0ULL, 0, 1ULL, 12037653088, 665, 1, 0, 12037653088, 665, 701, 1, 0ULL, 0, 1ULL, 12037653089, 665, 1, 0, 12037653089, 665, 702, 1, 0ULL, 0, 1ULL, 12037653103, 665, 1, 0, 12037653103, 665, 703, 1, 0ULL, 0, 1ULL, 12037653101, 665, 1, 0, 12037653101, 665, 704, 1, 0ULL, 0, 1ULL, 12037653093, 665, 1, 0, 12037653093, 665, 705, 1, 0ULL, 0, 1ULL, 12037653096, 665, 1, 0, 12037653096, 665, 706, 1, 0ULL, 0, 1ULL, 12037653095, 665, 1, 0, 12037653095, 665, 707, 1, 0ULL, 0, 1ULL, 12037653097, 665, 1, 0, 12037653097, 665, 708, 1, 0ULL, 0, 1ULL, 12037653100, 665, 1, 0, 12037653100, 665, 709, 1, 0ULL, 0, 1ULL, 12037653099, 665, 1, 0, 12037653099, 665, 710, 1, 0ULL, 0, 1ULL, 12037653079, 665, 1, 0, 12037653079, 665, 711, 1, 0ULL, 0, 1ULL, 12037653080, 665, 1, 0, 12037653080, 665, 712, 1, 0ULL, 0, 1ULL, 12037653078, 665, 1, 0, 12037653078, 665, 713, 1, 0ULL, 0, 1ULL, 12037653077, 665, 1, 0, 12037653077, 665, 714, 1, 0ULL, 0, 1ULL, 12037653071, 665, 1, 0, 12037653071, 665, 715, 1, 0ULL, 0, 1ULL, 12037653073, 665, 1, 0, 12037653073, 665, 716, 1, 0ULL, 0, 1ULL, 12037653072, 665, 1, 0, 12037653072, 665, 717, 1, 0ULL, 0, 1ULL, 12037653090, 665, 1, 0, 12037653090, 665, 718, 1, 0ULL, 0, 1ULL, 12037653091, 665, 1, 0, 12037653091, 665, 719, 1, 0ULL, 0, 1ULL, 12037653092, 665, 1, 0, 12037653092, 665, 720, 1, 0ULL, 0, 1ULL, 12037653083, 665, 1, 0, 12037653083, 665, 721, 1, 0ULL, 0, 1ULL, 12037653084, 665, 1, 0, 12037653084, 665, 722, 1, 0ULL, 0, 1ULL, 12037653104, 665, 1, 0, 12037653104, 665, 723, 1, 0ULL, 0, 1ULL, 12037653058, 665, 1, 0, 12037653058, 665, 724, 1, 0ULL, 0, 1ULL, 12037653059, 665, 1, 0, 12037653059, 665, 725, 1, 0ULL, 0, 1ULL, 12037653060, 665, 1, 0, 12037653060, 665, 726, 1, 0ULL, 0, 1ULL, 12037653064, 665, 1, 0, 12037653064, 665, 727, 1, 0ULL, 0, 1ULL, 12037653061, 665, 1, 0, 12037653061, 665, 728, 1, 0ULL, 0, 1ULL, 12037653062, 665, 1, 0, 12037653062, 665, 729, 1, 0ULL, 0, 1ULL, 12037653067, 665, 1, 0, 12037653067, 665, 730, 1, 0ULL, 0, 1ULL, 12037653069, 665, 1, 0, 12037653069, 665, 731, 1, 0ULL, 0, 1ULL, 12037653066, 665, 1, 0, 12037653066, 665, 732, 1, 0ULL, 0, 1ULL, 12037653070, 665, 1, 0, 12037653070, 665, 733, 1, 0ULL, 0, 1ULL, 12037653068, 665, 1, 0, 12037653068, 665, 734, 1, 0ULL, 0, 1ULL, 12037653065, 665, 1, 0, 12037653065, 665, 735, 1, 0ULL, 0, 1ULL, 12037653063, 665, 1, 0, 12037653063, 665, 736, 1, 0ULL, 0, 1ULL, 12037653086, 665, 1, 0, 12037653086, 665, 737, 1, 0ULL, 0, 1ULL, 12037653085, 665, 1, 0, 12037653085, 665, 738, 1, 0ULL, 0, 1ULL, 12037653081, 665, 1, 0, 12037653081, 665, 739, 1, 0ULL, 0, 1ULL, 12037653135, 665, 1, 0, 12037653135, 665, 740, 1, 0ULL, 0, 1ULL, 12037653074, 665, 1, 0, 12037653074, 665, 741, 1, 0ULL, 0, 1ULL, 12037653105, 665, 1, 0, 12037653105, 665, 742, 1, 0ULL, 0, 1ULL, 12037653106, 665, 1, 0, 12037653106, 665, 743, 1, 0ULL, 0, 1ULL, 12037653094, 665, 1, 0, 12037653094, 665, 744, 1, 0ULL, 0, 1ULL, 12037653098, 665, 1, 0, 12037653098, 665, 745, 1, 0ULL, 0, 1ULL, 12037653136, 665, 1, 0, 12037653136, 665, 746, 1, 0ULL, 0, 1ULL, 0, 1, 12037653108, 665, 0, 0, 1, 12037653087, 665, 1, 0, 12037653088, 665, 0, 1, 12037653089, 665, 747, 12037653108, 2, 16777216, 665, 0, 0, 1ULL, 0, 1, 12037653109, 665, 0, 0, 1, 12037653101, 665, 1, 0, 12037653085, 665, 0, 1, 12037653100, 665, 748, 12037653109, 2, 16777216, 665, 0, 0, 1ULL, 0, 1, 12037653111, 665, 0, 0, 12037653120, 665, 12037653096, 665, 2, 1, 0, 749, 12037653111, 2, 16777216, 665, 2, 0, 1ULL, 0, 1, 12037653113, 665, 0, 0, 12037653100, 665, 12037653120, 665, 2, 1, 0, 750, 12037653113, 2, 16777216, 665, 2, 0, 1ULL, 0, 2, 12037653112, 665, 0, 0, 12037653100, 665, 12037653086, 665, 1, 0, 12037653085, 665, 0, 1, 12037653120, 665, 1, 2, 0, 751, 12037653112, 2, 16777216, 665, 1, 0, 1ULL, 0, 1, 12037653110, 665, 0, 0, 1, 12037653090, 665, 1, 0, 12037653091, 665, 0, 1, 12037653092, 665, 752, 12037653110, 2, 16777216, 665, 0, 0, 25341984845, 371, 1ULL, 5, 0, 0, 0, 23194501143, 128, 3, 1, 23194501140, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501140, 2, 16777216, 128, 3, 1, 23194501143, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984845, 2, 16777216, 371, 1, 1, 25341984845, 371, 25341984998, 371, 6, 0, 1, 0, 25341984848, 371, 1ULL, 7, 0, 0, 0, 23194501149, 128, 3, 1, 23194501146, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501146, 2, 16777216, 128, 3, 1, 23194501149, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984848, 2, 16777216, 371, 1, 1, 25341984848, 371, 25341985001, 371, 8, 0, 1, 0, 25341984851, 371, 1ULL, 9, 0, 0, 0, 23194501121, 128, 3, 1, 23194501120, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501120, 2, 16777216, 128, 3, 1, 23194501121, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984851, 2, 16777216, 371, 1, 1, 25341984851, 371, 25341985004, 371, 10, 0, 1, 0, 25341984854, 371, 1ULL, 11, 0, 0, 0, 23194501123, 128, 3, 1, 23194501122, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501122, 2, 16777216, 128, 3, 1, 23194501123, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984854, 2, 16777216, 371, 1, 1, 25341984854, 371, 25341985007, 371, 12, 0, 1, 0, 25341984857, 371, 1ULL, 13, 0, 0, 0, 23194501125, 128, 3, 1, 23194501124, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501124, 2, 16777216, 128, 3, 1, 23194501125, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984857, 2, 16777216, 371, 1, 1, 25341984857, 371, 25341985010, 371, 14, 0, 1, 0, 25341984860, 371, 1ULL, 15, 0, 0, 0, 23194501127, 128, 3, 1, 23194501126, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501126, 2, 16777216, 128, 3, 1, 23194501127, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984860, 2, 16777216, 371, 1, 1, 25341984860, 371, 25341985013, 371, 16, 0, 1, 0, 25341984863, 371, 1ULL, 17, 0, 0, 0, 23194501155, 128, 3, 1, 23194501152, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501152, 2, 16777216, 128, 3, 1, 23194501155, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984863, 2, 16777216, 371, 1, 1, 25341984863, 371, 25341985016, 371, 18, 0, 1, 0, 25341984866, 371, 1ULL, 19, 0, 0, 0, 23194501129, 128, 3, 1, 23194501128, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501128, 2, 16777216, 128, 3, 1, 23194501129, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984866, 2, 16777216, 371, 1, 1, 25341984866, 371, 25341985019, 371, 20, 0, 1, 0, 25341984869, 371, 1ULL, 21, 0, 0, 0, 23194501131, 128, 3, 1, 23194501130, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501130, 2, 16777216, 128, 3, 1, 23194501131, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984869, 2, 16777216, 371, 1, 1, 25341984869, 371, 25341985022, 371, 22, 0, 1, 0, 25341984872, 371, 1ULL, 23, 0, 0, 0, 23194501133, 128, 3, 1, 23194501132, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501132, 2, 16777216, 128, 3, 1, 23194501133, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984872, 2, 16777216, 371, 1, 1, 25341984872, 371, 25341985025, 371, 24, 0, 1, 0, 25341984875, 371, 1ULL, 25, 0, 0, 0, 23194501161, 128, 3, 1, 23194501158, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501158, 2, 16777216, 128, 3, 1, 23194501161, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984875, 2, 16777216, 371, 1, 1, 25341984875, 371, 25341985028, 371, 26, 0, 1, 0, 25341984878, 371, 1ULL, 27, 0, 0, 0, 23194501167, 128, 3, 1, 23194501164, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501164, 2, 16777216, 128, 3, 1, 23194501167, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984878, 2, 16777216, 371, 1, 1, 25341984878, 371, 25341985031, 371, 28, 0, 1, 0, 25341984881, 371, 1ULL, 29, 0, 0, 0, 23194501135, 128, 3, 1, 23194501134, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501134, 2, 16777216, 128, 3, 1, 23194501135, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984881, 2, 16777216, 371, 1, 1, 25341984881, 371, 25341985034, 371, 30, 0, 1, 0, 25341984884, 371, 1ULL, 31, 0, 0, 0, 23194501173, 128, 3, 1, 23194501170, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501170, 2, 16777216, 128, 3, 1, 23194501173, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984884, 2, 16777216, 371, 1, 1, 25341984884, 371, 25341985037, 371, 32, 0, 1, 0, 25341984887, 371, 1ULL, 33, 0, 0, 0, 23194501179, 128, 3, 1, 23194501176, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501176, 2, 16777216, 128, 3, 1, 23194501179, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984887, 2, 16777216, 371, 1, 1, 25341984887, 371, 25341985040, 371, 34, 0, 1, 0, 25341984890, 371, 1ULL, 35, 0, 0, 0, 23194501185, 128, 3, 1, 23194501182, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501182, 2, 16777216, 128, 3, 1, 23194501185, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984890, 2, 16777216, 371, 1, 1, 25341984890, 371, 25341985043, 371, 36, 0, 1, 0, 25341984893, 371, 1ULL, 37, 0, 0, 0, 23194501191, 128, 3, 1, 23194501188, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501188, 2, 16777216, 128, 3, 1, 23194501191, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984893, 2, 16777216, 371, 1, 1, 25341984893, 371, 25341985046, 371, 38, 0, 1, 0, 25341984896, 371, 1ULL, 39, 0, 0, 0, 23194501197, 128, 3, 1, 23194501194, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501194, 2, 16777216, 128, 3, 1, 23194501197, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984896, 2, 16777216, 371, 1, 1, 25341984896, 371, 25341985049, 371, 40, 0, 1, 0, 25341984899, 371, 1ULL, 41, 0, 0, 0, 23194501203, 128, 3, 1, 23194501200, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501200, 2, 16777216, 128, 3, 1, 23194501203, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984899, 2, 16777216, 371, 1, 1, 25341984899, 371, 25341985052, 371, 42, 0, 1, 0, 25341984902, 371, 1ULL, 43, 0, 0, 0, 23194501209, 128, 3, 1, 23194501206, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501206, 2, 16777216, 128, 3, 1, 23194501209, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984902, 2, 16777216, 371, 1, 1, 25341984902, 371, 25341985055, 371, 44, 0, 1, 0, 25341984905, 371, 1ULL, 45, 0, 0, 0, 23194501215, 128, 3, 1, 23194501212, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501212, 2, 16777216, 128, 3, 1, 23194501215, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984905, 2, 16777216, 371, 1, 1, 25341984905, 371, 25341985058, 371, 46, 0, 1, 0, 25341984908, 371, 1ULL, 47, 0, 0, 0, 23194501221, 128, 3, 1, 23194501218, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501218, 2, 16777216, 128, 3, 1, 23194501221, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984908, 2, 16777216, 371, 1, 1, 25341984908, 371, 25341985061, 371, 48, 0, 1, 0, 25341984911, 371, 1ULL, 49, 0, 0, 0, 23194501227, 128, 3, 1, 23194501224, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501224, 2, 16777216, 128, 3, 1, 23194501227, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984911, 2, 16777216, 371, 1, 1, 25341984911, 371, 25341985064, 371, 50, 0, 1, 0, 25341984914, 371, 1ULL, 51, 0, 0, 0, 23194501137, 128, 3, 1, 23194501136, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501136, 2, 16777216, 128, 3, 1, 23194501137, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 4, 3, 0, 0, 45, 1ULL, 1, 0, 925, 1, 0, 45, 2, 16777216, 1ULL, 1, 0, 0, 1, 3, 25341984844, 371, 2, 0, 0, 3, 1, 925, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 25341984914, 2, 16777216, 371, 4, 1, 25341984914, 371, 2, 4, 0, 1, 0, 25341984917, 371, 1ULL, 52, 0, 0, 0, 23194501139, 128, 3, 1, 23194501138, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501138, 2, 16777216, 128, 3, 1, 23194501139, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984917, 2, 16777216, 371, 1, 1, 25341984917, 371, 25341985067, 371, 53, 0, 1, 0, 25341984920, 371, 1ULL, 54, 0, 0, 0, 23194501233, 128, 3, 1, 23194501230, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501230, 2, 16777216, 128, 3, 1, 23194501233, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984920, 2, 16777216, 371, 1, 1, 25341984920, 371, 25341985070, 371, 55, 0, 1, 0, 25341984923, 371, 1ULL, 56, 0, 0, 0, 23194501239, 128, 3, 1, 23194501236, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501236, 2, 16777216, 128, 3, 1, 23194501239, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984923, 2, 16777216, 371, 1, 1, 25341984923, 371, 25341985073, 371, 57, 0, 1, 0, 25341984926, 371, 1ULL, 58, 0, 0, 0, 23194501245, 128, 3, 1, 23194501242, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501242, 2, 16777216, 128, 3, 1, 23194501245, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984926, 2, 16777216, 371, 1, 1, 25341984926, 371, 25341985076, 371, 3, 0, 1, 0, 25341984929, 371, 1ULL, 59, 0, 0, 0, 12037652763, 665, 1, 12037652764, 665, 2, 12037652765, 665, 3, 12037652747, 665, 4, 12037652748, 665, 5, 12037652749, 665, 6, 12037652750, 665, 7, 12037652751, 665, 8, 12037652752, 665, 9, 12037652753, 665, 10, 12037652754, 665, 11, 12037652755, 665, 12, 12037652756, 665, 13, 12037652757, 665, 14, 12037652758, 665, 15, 12037652759, 665, 16, 12037652760, 665, 17, 12037652761, 665, 18, 12037652762, 665, 19, 12037652765, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 1, 0, 3, 0, 25341984929, 2, 16777216, 371, 1, 1, 25341984929, 371, 25341985079, 371, 60, 0, 1, 0, 25341984932, 371, 1ULL, 61, 0, 0, 0, 12037652714, 665, 1, 12037652715, 665, 2, 12037652716, 665, 3, 12037652717, 665, 4, 12037652718, 665, 5, 12037652719, 665, 6, 12037652720, 665, 7, 12037652721, 665, 8, 12037652746, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 1, 0, 3, 0, 25341984932, 2, 16777216, 371, 1, 1, 25341984932, 371, 25341985082, 371, 62, 0, 1, 0, 25341984935, 371, 1ULL, 63, 0, 0, 1, 12037652701, 665, 2, 12037652702, 665, 3, 12037652703, 665, 4, 12037652704, 665, 0, 65536ULL, 12037652539, 665, 53, 0, 12037652538, 665, 5, 53, 0, 65536ULL, 12037652541, 665, 54, 0, 12037652540, 665, 6, 54, 0, 65536ULL, 12037652543, 665, 55, 0, 12037652542, 665, 7, 55, 0, 65536ULL, 12037652545, 665, 56, 0, 12037652544, 665, 8, 56, 0, 65536ULL, 12037652547, 665, 57, 0, 12037652546, 665, 9, 57, 0, 65536ULL, 12037652549, 665, 58, 0, 12037652548, 665, 10, 58, 0, 65536ULL, 12037652551, 665, 59, 0, 12037652550, 665, 11, 59, 0, 65536ULL, 12037652553, 665, 60, 0, 12037652552, 665, 12, 60, 0, 65536ULL, 12037652555, 665, 61, 0, 12037652554, 665, 13, 61, 0, 65536ULL, 12037652557, 665, 62, 0, 12037652556, 665, 14, 62, 0, 65536ULL, 12037652559, 665, 63, 0, 12037652558, 665, 15, 63, 0, 65536ULL, 12037652561, 665, 64, 0, 12037652560, 665, 16, 64, 0, 65536ULL, 12037652563, 665, 65, 0, 12037652562, 665, 17, 65, 0, 65536ULL, 12037652565, 665, 66, 0, 12037652564, 665, 18, 66, 0, 65536ULL, 12037652567, 665, 67, 0, 12037652566, 665, 19, 67, 0, 65536ULL, 12037652569, 665, 68, 0, 12037652568, 665, 20, 68, 0, 65536ULL, 12037652571, 665, 69, 0, 12037652570, 665, 21, 69, 0, 65536ULL, 12037652573, 665, 70, 0, 12037652572, 665, 22, 70, 0, 65536ULL, 12037652575, 665, 71, 0, 12037652574, 665, 23, 71, 0, 65536ULL, 12037652577, 665, 72, 0, 12037652576, 665, 24, 72, 0, 65536ULL, 12037652579, 665, 73, 0, 12037652578, 665, 25, 73, 0, 65536ULL, 12037652581, 665, 74, 0, 12037652580, 665, 26, 74, 0, 65536ULL, 12037652583, 665, 75, 0, 12037652582, 665, 27, 75, 0, 65536ULL, 12037652585, 665, 76, 0, 12037652584, 665, 28, 76, 0, 65536ULL, 12037652587, 665, 77, 0, 12037652586, 665, 29, 77, 0, 65536ULL, 12037652589, 665, 78, 0, 12037652588, 665, 30, 78, 0, 65536ULL, 12037652591, 665, 79, 0, 12037652590, 665, 31, 79, 0, 65536ULL, 12037652593, 665, 80, 0, 12037652592, 665, 32, 80, 0, 65536ULL, 12037652595, 665, 81, 0, 12037652594, 665, 33, 81, 0, 65536ULL, 12037652597, 665, 82, 0, 12037652596, 665, 34, 82, 0, 65536ULL, 12037652599, 665, 83, 0, 12037652598, 665, 35, 83, 0, 65536ULL, 12037652601, 665, 84, 0, 12037652600, 665, 36, 84, 0, 65536ULL, 12037652619, 665, 93, 0, 12037652618, 665, 37, 93, 0, 65536ULL, 12037652621, 665, 94, 0, 12037652620, 665, 38, 94, 0, 65536ULL, 12037652623, 665, 95, 0, 12037652622, 665, 39, 95, 0, 65536ULL, 12037652625, 665, 96, 0, 12037652624, 665, 40, 96, 0, 65536ULL, 12037652627, 665, 97, 0, 12037652626, 665, 41, 97, 0, 65536ULL, 12037652629, 665, 98, 0, 12037652628, 665, 42, 98, 0, 65536ULL, 12037652631, 665, 99, 0, 12037652630, 665, 43, 99, 0, 65536ULL, 12037652633, 665, 100, 0, 12037652632, 665, 0, 100, 44, 12037652698, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 1, 0, 3, 0, 25341984935, 2, 16777216, 371, 1, 1, 25341984935, 371, 25341985085, 371, 64, 0, 1, 0, 25341984938, 371, 1ULL, 65, 0, 0, 1, 12037652701, 665, 2, 12037652702, 665, 3, 12037652703, 665, 4, 12037652704, 665, 5, 53, 6, 54, 7, 55, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 78, 31, 79, 32, 80, 33, 81, 34, 82, 35, 83, 36, 84, 0, 65536ULL, 12037652603, 665, 85, 0, 12037652602, 665, 37, 85, 0, 65536ULL, 12037652605, 665, 86, 0, 12037652604, 665, 38, 86, 0, 65536ULL, 12037652607, 665, 87, 0, 12037652606, 665, 39, 87, 0, 65536ULL, 12037652609, 665, 88, 0, 12037652608, 665, 40, 88, 0, 65536ULL, 12037652611, 665, 89, 0, 12037652610, 665, 41, 89, 0, 65536ULL, 12037652613, 665, 90, 0, 12037652612, 665, 42, 90, 0, 65536ULL, 12037652615, 665, 91, 0, 12037652614, 665, 43, 91, 0, 65536ULL, 12037652617, 665, 92, 0, 12037652616, 665, 0, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 12037652699, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 1, 0, 3, 0, 25341984938, 2, 16777216, 371, 1, 1, 25341984938, 371, 25341985088, 371, 66, 0, 1, 0, 25341984941, 371, 1ULL, 67, 0, 0, 0, 12037652701, 665, 1, 12037652702, 665, 2, 12037652703, 665, 3, 12037652704, 665, 4, 53, 5, 54, 6, 55, 7, 56, 8, 57, 9, 58, 10, 59, 11, 60, 12, 61, 13, 62, 14, 63, 15, 64, 16, 65, 17, 66, 18, 67, 19, 68, 20, 69, 21, 70, 22, 71, 23, 72, 24, 73, 25, 74, 26, 75, 27, 76, 28, 77, 29, 78, 30, 79, 31, 80, 32, 81, 33, 82, 34, 83, 35, 84, 36, 85, 37, 86, 38, 87, 39, 88, 40, 89, 41, 90, 42, 91, 43, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 12037652700, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 1, 0, 3, 0, 25341984941, 2, 16777216, 371, 1, 1, 25341984941, 371, 25341985091, 371, 68, 0, 1, 0, 25341984944, 371, 1ULL, 69, 0, 0, 0, 12037652743, 665, 1, 12037652714, 665, 2, 12037652715, 665, 3, 12037652716, 665, 4, 12037652717, 665, 5, 12037652718, 665, 6, 12037652719, 665, 7, 12037652720, 665, 8, 12037652721, 665, 9, 12037652722, 665, 10, 12037652723, 665, 11, 12037652724, 665, 12, 12037652725, 665, 13, 12037652726, 665, 14, 12037652727, 665, 15, 12037652728, 665, 16, 12037652729, 665, 17, 12037652730, 665, 18, 12037652731, 665, 19, 12037652732, 665, 20, 12037652733, 665, 21, 12037652734, 665, 22, 12037652735, 665, 23, 12037652736, 665, 24, 12037652737, 665, 25, 12037652742, 665, 26, 12037652745, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 1, 0, 3, 0, 25341984944, 2, 16777216, 371, 1, 1, 25341984944, 371, 25341985094, 371, 70, 0, 1, 0, 25341984947, 371, 1ULL, 71, 0, 0, 0, 12037652922, 665, 1, 12037652928, 665, 2, 12037652926, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 1, 0, 3, 0, 25341984947, 2, 16777216, 371, 1, 1, 25341984947, 371, 25341985097, 371, 72, 0, 1, 0, 25341984950, 371, 1ULL, 73, 0, 0, 0, 12037652922, 665, 1, 12037652929, 665, 2, 12037652930, 665, 3, 12037652931, 665, 4, 12037652932, 665, 5, 12037652933, 665, 6, 12037652934, 665, 7, 12037652935, 665, 8, 12037652936, 665, 9, 12037652937, 665, 10, 12037652927, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 1, 0, 3, 0, 25341984950, 2, 16777216, 371, 1, 1, 25341984950, 371, 25341985100, 371, 74, 0, 1, 0, 25341984953, 371, 1ULL, 75, 0, 0, 0, 12037652775, 665, 1, 12037652790, 665, 2, 12037652779, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 1, 0, 3, 0, 25341984953, 2, 16777216, 371, 1, 1, 25341984953, 371, 25341985103, 371, 76, 0, 1, 0, 25341984956, 371, 1ULL, 77, 0, 0, 0, 12037652775, 665, 1, 12037652781, 665, 2, 12037652782, 665, 3, 12037652783, 665, 4, 12037652784, 665, 5, 12037652789, 665, 6, 12037652780, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 1, 0, 3, 0, 25341984956, 2, 16777216, 371, 1, 1, 25341984956, 371, 25341985106, 371, 78, 0, 1, 0, 25341984959, 371, 1ULL, 79, 0, 0, 0, 12037652957, 665, 1, 12037652958, 665, 2, 12037652960, 665, 3, 12037652961, 665, 4, 12037652962, 665, 5, 12037652963, 665, 6, 12037652964, 665, 7, 12037652965, 665, 8, 12037652966, 665, 9, 12037652967, 665, 10, 12037652968, 665, 11, 12037652959, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 1, 0, 3, 0, 25341984959, 2, 16777216, 371, 1, 1, 25341984959, 371, 25341985109, 371, 80, 0, 1, 0, 25341984962, 371, 1ULL, 81, 0, 0, 0, 12037652763, 665, 1, 12037652764, 665, 2, 12037652765, 665, 3, 12037652747, 665, 4, 12037652748, 665, 5, 12037652749, 665, 6, 12037652750, 665, 7, 12037652751, 665, 8, 12037652752, 665, 9, 12037652753, 665, 10, 12037652754, 665, 11, 12037652755, 665, 12, 12037652756, 665, 13, 12037652757, 665, 14, 12037652758, 665, 15, 12037652759, 665, 16, 12037652760, 665, 17, 12037652761, 665, 18, 12037652762, 665, 19, 12037652763, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 2, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 12037652993, 665, 4, 12037652992, 665, 5, 12037652991, 665, 6, 12037652990, 665, 7, 12037652989, 665, 8, 12037652988, 665, 9, 12037652987, 665, 10, 12037652986, 665, 11, 0ULL, 12, 0ULL, 13, 0ULL, 14, 0ULL, 15, 12037653137, 665, 16, 12037653138, 665, 17, 12037653139, 665, 18, 12037653140, 665, 19, 12037653086, 665, 12037653085, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 1, 0, 3, 0, 25341984962, 2, 16777216, 371, 2, 2, 25341984962, 371, 1, 82, 0, 2, 0, 25341984965, 371, 1ULL, 83, 0, 0, 0, 12037652763, 665, 1, 12037652764, 665, 2, 12037652765, 665, 3, 12037652747, 665, 4, 12037652748, 665, 5, 12037652749, 665, 6, 12037652750, 665, 7, 12037652751, 665, 8, 12037652752, 665, 9, 12037652753, 665, 10, 12037652754, 665, 11, 12037652755, 665, 12, 12037652756, 665, 13, 12037652757, 665, 14, 12037652758, 665, 15, 12037652759, 665, 16, 12037652760, 665, 17, 12037652761, 665, 18, 12037652762, 665, 19, 0ULL, 20, 0ULL, 21, 0ULL, 22, 0ULL, 23, 0ULL, 24, 0ULL, 25, 0ULL, 26, 0ULL, 27, 0ULL, 28, 12037652764, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 2, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 12037652977, 665, 4, 12037652976, 665, 5, 12037652975, 665, 6, 12037652974, 665, 7, 12037652973, 665, 8, 0ULL, 9, 12037652985, 665, 10, 12037652984, 665, 11, 12037653137, 665, 12, 12037653138, 665, 13, 12037653139, 665, 14, 12037653140, 665, 15, 12037653141, 665, 16, 12037653142, 665, 17, 12037653143, 665, 18, 12037653144, 665, 19, 12037652972, 665, 20, 12037652971, 665, 21, 12037652970, 665, 22, 12037652983, 665, 23, 12037652982, 665, 24, 12037652981, 665, 25, 12037652980, 665, 26, 12037652979, 665, 27, 12037652978, 665, 28, 12037653086, 665, 12037653085, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 1, 0, 3, 0, 25341984965, 2, 16777216, 371, 2, 2, 25341984965, 371, 1, 84, 0, 2, 0, 25341984968, 371, 1ULL, 85, 0, 0, 0, 12037652822, 665, 1, 12037652823, 665, 2, 12037652824, 665, 3, 12037652825, 665, 4, 12037652842, 665, 5, 12037652843, 665, 6, 12037652844, 665, 7, 12037652845, 665, 8, 12037652830, 665, 9, 12037652831, 665, 10, 12037652832, 665, 11, 12037652833, 665, 12, 12037652834, 665, 13, 12037652835, 665, 14, 12037652836, 665, 15, 12037652837, 665, 16, 12037652892, 665, 2ULL, 17, 12037652880, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 1, 0, 3, 0, 25341984968, 2, 16777216, 371, 1, 1, 25341984968, 371, 25341985112, 371, 86, 0, 1, 0, 25341984971, 371, 1ULL, 87, 0, 0, 0, 12037652822, 665, 1, 12037652823, 665, 2, 12037652824, 665, 3, 12037652825, 665, 4, 12037652842, 665, 5, 12037652843, 665, 6, 12037652844, 665, 7, 12037652845, 665, 8, 12037652830, 665, 9, 12037652831, 665, 10, 12037652832, 665, 11, 12037652833, 665, 12, 12037652834, 665, 13, 12037652835, 665, 14, 12037652836, 665, 15, 12037652837, 665, 16, 12037652826, 665, 17, 12037652827, 665, 18, 12037652828, 665, 19, 12037652829, 665, 20, 12037652892, 665, 2ULL, 21, 12037652879, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 1, 0, 3, 0, 25341984971, 2, 16777216, 371, 1, 1, 25341984971, 371, 25341985115, 371, 88, 0, 1, 0, 25341984974, 371, 1ULL, 89, 0, 0, 0, 12037652483, 665, 1, 12037652484, 665, 2, 12037652485, 665, 3, 12037652486, 665, 4, 12037652487, 665, 5, 12037652488, 665, 6, 12037652489, 665, 7, 12037652490, 665, 8, 12037652491, 665, 9, 12037652492, 665, 10, 12037652493, 665, 11, 12037652494, 665, 12, 12037652495, 665, 13, 12037652496, 665, 14, 12037652497, 665, 15, 12037652498, 665, 16, 12037652499, 665, 17, 12037652500, 665, 18, 12037652517, 665, 19, 12037652518, 665, 20, 12037652519, 665, 21, 12037652520, 665, 22, 12037652521, 665, 23, 12037652522, 665, 24, 12037652523, 665, 25, 12037652524, 665, 26, 12037652534, 665, 27, 12037652535, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 1, 0, 3, 0, 25341984974, 2, 16777216, 371, 1, 1, 25341984974, 371, 25341985118, 371, 90, 0, 1, 0, 25341984977, 371, 1ULL, 91, 0, 0, 0, 12037652483, 665, 1, 12037652484, 665, 2, 12037652485, 665, 3, 12037652486, 665, 4, 12037652487, 665, 5, 12037652488, 665, 6, 12037652489, 665, 7, 12037652490, 665, 8, 12037652491, 665, 9, 12037652492, 665, 10, 12037652493, 665, 11, 12037652494, 665, 12, 12037652495, 665, 13, 12037652496, 665, 14, 12037652497, 665, 15, 12037652498, 665, 16, 12037652499, 665, 17, 12037652500, 665, 18, 12037652517, 665, 19, 12037652518, 665, 20, 12037652519, 665, 21, 12037652520, 665, 22, 12037652521, 665, 23, 12037652522, 665, 24, 12037652523, 665, 25, 12037652524, 665, 26, 12037652534, 665, 27, 12037652501, 665, 28, 12037652502, 665, 29, 12037652503, 665, 30, 12037652504, 665, 31, 12037652505, 665, 32, 12037652506, 665, 33, 12037652507, 665, 34, 12037652508, 665, 35, 12037652509, 665, 36, 12037652510, 665, 37, 12037652511, 665, 38, 12037652512, 665, 39, 12037652513, 665, 40, 12037652514, 665, 41, 12037652515, 665, 42, 12037652516, 665, 43, 12037652537, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 1, 0, 3, 0, 25341984977, 2, 16777216, 371, 1, 1, 25341984977, 371, 25341985121, 371, 92, 0, 1, 0, 25341984980, 371, 1ULL, 93, 0, 0, 0, 12037652483, 665, 1, 12037652484, 665, 2, 12037652485, 665, 3, 12037652486, 665, 4, 12037652487, 665, 5, 12037652488, 665, 6, 12037652489, 665, 7, 12037652490, 665, 8, 12037652491, 665, 9, 12037652492, 665, 10, 12037652517, 665, 11, 12037652518, 665, 12, 12037652519, 665, 13, 12037652520, 665, 14, 12037652521, 665, 15, 12037652522, 665, 16, 12037652523, 665, 17, 12037652524, 665, 18, 12037652534, 665, 19, 12037652501, 665, 20, 12037652502, 665, 21, 12037652503, 665, 22, 12037652504, 665, 23, 12037652505, 665, 24, 12037652506, 665, 25, 12037652507, 665, 26, 12037652508, 665, 27, 12037652536, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 1, 0, 3, 0, 25341984980, 2, 16777216, 371, 1, 1, 25341984980, 371, 25341985124, 371, 94, 0, 1, 0, 25341984983, 371, 1ULL, 95, 0, 0, 0, 25341984983, 2, 16777216, 371, 25341985130, 371, 1, 25341984983, 371, 25341985127, 371, 96, 0, 1, 0, 25341984986, 371, 1ULL, 97, 0, 0, 0, 25341984986, 2, 16777216, 371, 25341985136, 371, 1, 25341984986, 371, 25341985133, 371, 98, 0, 1, 0, 1ULL, 12037652525, 665, 1, 0, 12037652483, 2, 16777216, 665, 0, 12037652525, 665, 12037652484, 2, 16777216, 665, 53, 1, 0, 54, 12037652525, 665, 12037652483, 2, 16777216, 665, 0, 1ULL, 12037652525, 665, 1, 0, 12037652480, 665, 0, 12037652525, 665, 12037652481, 665, 55, 1, 0, 0, 12037652538, 665, 12037652554, 665, 1, 0, 12037652570, 665, 56, 1, 12037652618, 665, 0, 12037652538, 665, 12037652555, 665, 1, 12037652539, 665, 12037652554, 665, 2, 0, 1, 0, 2, 12037652571, 665, 57, 0, 12037652619, 665, 0, 12037652538, 665, 12037652556, 665, 1, 12037652539, 665, 12037652555, 665, 2, 0, 1, 0, 12037652540, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652572, 665, 58, 0, 12037652620, 665, 0, 12037652538, 665, 12037652557, 665, 1, 12037652539, 665, 12037652556, 665, 2, 0, 1, 0, 12037652540, 665, 12037652555, 665, 1, 2, 0, 0, 12037652541, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652573, 665, 59, 0, 12037652621, 665, 0, 12037652538, 665, 12037652558, 665, 1, 12037652539, 665, 12037652557, 665, 2, 0, 1, 0, 12037652540, 665, 12037652556, 665, 1, 2, 0, 0, 12037652541, 665, 12037652555, 665, 2, 1, 0, 0, 12037652542, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652574, 665, 60, 0, 12037652622, 665, 0, 12037652538, 665, 12037652559, 665, 1, 12037652539, 665, 12037652558, 665, 2, 0, 1, 0, 12037652540, 665, 12037652557, 665, 1, 2, 0, 0, 12037652541, 665, 12037652556, 665, 2, 1, 0, 0, 12037652542, 665, 12037652555, 665, 1, 2, 0, 0, 12037652543, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652575, 665, 61, 0, 12037652623, 665, 0, 12037652538, 665, 12037652560, 665, 1, 12037652539, 665, 12037652559, 665, 2, 0, 1, 0, 12037652540, 665, 12037652558, 665, 1, 2, 0, 0, 12037652541, 665, 12037652557, 665, 2, 1, 0, 0, 12037652542, 665, 12037652556, 665, 1, 2, 0, 0, 12037652543, 665, 12037652555, 665, 2, 1, 0, 0, 12037652544, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652576, 665, 62, 0, 12037652624, 665, 0, 12037652538, 665, 12037652561, 665, 1, 12037652539, 665, 12037652560, 665, 2, 0, 1, 0, 12037652540, 665, 12037652559, 665, 1, 2, 0, 0, 12037652541, 665, 12037652558, 665, 2, 1, 0, 0, 12037652542, 665, 12037652557, 665, 1, 2, 0, 0, 12037652543, 665, 12037652556, 665, 2, 1, 0, 0, 12037652544, 665, 12037652555, 665, 1, 2, 0, 0, 12037652545, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652577, 665, 63, 0, 12037652625, 665, 0, 12037652538, 665, 12037652562, 665, 1, 12037652539, 665, 12037652561, 665, 2, 0, 1, 0, 12037652540, 665, 12037652560, 665, 1, 2, 0, 0, 12037652541, 665, 12037652559, 665, 2, 1, 0, 0, 12037652542, 665, 12037652558, 665, 1, 2, 0, 0, 12037652543, 665, 12037652557, 665, 2, 1, 0, 0, 12037652544, 665, 12037652556, 665, 1, 2, 0, 0, 12037652545, 665, 12037652555, 665, 2, 1, 0, 0, 12037652546, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652578, 665, 64, 0, 12037652626, 665, 0, 12037652538, 665, 12037652563, 665, 1, 12037652539, 665, 12037652562, 665, 2, 0, 1, 0, 12037652540, 665, 12037652561, 665, 1, 2, 0, 0, 12037652541, 665, 12037652560, 665, 2, 1, 0, 0, 12037652542, 665, 12037652559, 665, 1, 2, 0, 0, 12037652543, 665, 12037652558, 665, 2, 1, 0, 0, 12037652544, 665, 12037652557, 665, 1, 2, 0, 0, 12037652545, 665, 12037652556, 665, 2, 1, 0, 0, 12037652546, 665, 12037652555, 665, 1, 2, 0, 0, 12037652547, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652579, 665, 65, 0, 12037652627, 665, 0, 12037652538, 665, 12037652564, 665, 1, 12037652539, 665, 12037652563, 665, 2, 0, 1, 0, 12037652540, 665, 12037652562, 665, 1, 2, 0, 0, 12037652541, 665, 12037652561, 665, 2, 1, 0, 0, 12037652542, 665, 12037652560, 665, 1, 2, 0, 0, 12037652543, 665, 12037652559, 665, 2, 1, 0, 0, 12037652544, 665, 12037652558, 665, 1, 2, 0, 0, 12037652545, 665, 12037652557, 665, 2, 1, 0, 0, 12037652546, 665, 12037652556, 665, 1, 2, 0, 0, 12037652547, 665, 12037652555, 665, 2, 1, 0, 0, 12037652548, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652580, 665, 66, 0, 12037652628, 665, 0, 12037652538, 665, 12037652565, 665, 1, 12037652539, 665, 12037652564, 665, 2, 0, 1, 0, 12037652540, 665, 12037652563, 665, 1, 2, 0, 0, 12037652541, 665, 12037652562, 665, 2, 1, 0, 0, 12037652542, 665, 12037652561, 665, 1, 2, 0, 0, 12037652543, 665, 12037652560, 665, 2, 1, 0, 0, 12037652544, 665, 12037652559, 665, 1, 2, 0, 0, 12037652545, 665, 12037652558, 665, 2, 1, 0, 0, 12037652546, 665, 12037652557, 665, 1, 2, 0, 0, 12037652547, 665, 12037652556, 665, 2, 1, 0, 0, 12037652548, 665, 12037652555, 665, 1, 2, 0, 0, 12037652549, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652581, 665, 67, 0, 12037652629, 665, 0, 12037652538, 665, 12037652566, 665, 1, 12037652539, 665, 12037652565, 665, 2, 0, 1, 0, 12037652540, 665, 12037652564, 665, 1, 2, 0, 0, 12037652541, 665, 12037652563, 665, 2, 1, 0, 0, 12037652542, 665, 12037652562, 665, 1, 2, 0, 0, 12037652543, 665, 12037652561, 665, 2, 1, 0, 0, 12037652544, 665, 12037652560, 665, 1, 2, 0, 0, 12037652545, 665, 12037652559, 665, 2, 1, 0, 0, 12037652546, 665, 12037652558, 665, 1, 2, 0, 0, 12037652547, 665, 12037652557, 665, 2, 1, 0, 0, 12037652548, 665, 12037652556, 665, 1, 2, 0, 0, 12037652549, 665, 12037652555, 665, 2, 1, 0, 0, 12037652550, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652582, 665, 68, 0, 12037652630, 665, 0, 12037652538, 665, 12037652567, 665, 1, 12037652539, 665, 12037652566, 665, 2, 0, 1, 0, 12037652540, 665, 12037652565, 665, 1, 2, 0, 0, 12037652541, 665, 12037652564, 665, 2, 1, 0, 0, 12037652542, 665, 12037652563, 665, 1, 2, 0, 0, 12037652543, 665, 12037652562, 665, 2, 1, 0, 0, 12037652544, 665, 12037652561, 665, 1, 2, 0, 0, 12037652545, 665, 12037652560, 665, 2, 1, 0, 0, 12037652546, 665, 12037652559, 665, 1, 2, 0, 0, 12037652547, 665, 12037652558, 665, 2, 1, 0, 0, 12037652548, 665, 12037652557, 665, 1, 2, 0, 0, 12037652549, 665, 12037652556, 665, 2, 1, 0, 0, 12037652550, 665, 12037652555, 665, 1, 2, 0, 0, 12037652551, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652583, 665, 69, 0, 12037652631, 665, 0, 12037652538, 665, 12037652568, 665, 1, 12037652539, 665, 12037652567, 665, 2, 0, 1, 0, 12037652540, 665, 12037652566, 665, 1, 2, 0, 0, 12037652541, 665, 12037652565, 665, 2, 1, 0, 0, 12037652542, 665, 12037652564, 665, 1, 2, 0, 0, 12037652543, 665, 12037652563, 665, 2, 1, 0, 0, 12037652544, 665, 12037652562, 665, 1, 2, 0, 0, 12037652545, 665, 12037652561, 665, 2, 1, 0, 0, 12037652546, 665, 12037652560, 665, 1, 2, 0, 0, 12037652547, 665, 12037652559, 665, 2, 1, 0, 0, 12037652548, 665, 12037652558, 665, 1, 2, 0, 0, 12037652549, 665, 12037652557, 665, 2, 1, 0, 0, 12037652550, 665, 12037652556, 665, 1, 2, 0, 0, 12037652551, 665, 12037652555, 665, 2, 1, 0, 0, 12037652552, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652584, 665, 70, 0, 12037652632, 665, 0, 12037652538, 665, 12037652569, 665, 1, 12037652539, 665, 12037652568, 665, 2, 0, 1, 0, 12037652540, 665, 12037652567, 665, 1, 2, 0, 0, 12037652541, 665, 12037652566, 665, 2, 1, 0, 0, 12037652542, 665, 12037652565, 665, 1, 2, 0, 0, 12037652543, 665, 12037652564, 665, 2, 1, 0, 0, 12037652544, 665, 12037652563, 665, 1, 2, 0, 0, 12037652545, 665, 12037652562, 665, 2, 1, 0, 0, 12037652546, 665, 12037652561, 665, 1, 2, 0, 0, 12037652547, 665, 12037652560, 665, 2, 1, 0, 0, 12037652548, 665, 12037652559, 665, 1, 2, 0, 0, 12037652549, 665, 12037652558, 665, 2, 1, 0, 0, 12037652550, 665, 12037652557, 665, 1, 2, 0, 0, 12037652551, 665, 12037652556, 665, 2, 1, 0, 0, 12037652552, 665, 12037652555, 665, 1, 2, 0, 0, 12037652553, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652585, 665, 71, 0, 12037652633, 665, 0, 12037652539, 665, 12037652569, 665, 1, 12037652540, 665, 12037652568, 665, 2, 0, 1, 0, 12037652541, 665, 12037652567, 665, 1, 2, 0, 0, 12037652542, 665, 12037652566, 665, 2, 1, 0, 0, 12037652543, 665, 12037652565, 665, 1, 2, 0, 0, 12037652544, 665, 12037652564, 665, 2, 1, 0, 0, 12037652545, 665, 12037652563, 665, 1, 2, 0, 0, 12037652546, 665, 12037652562, 665, 2, 1, 0, 0, 12037652547, 665, 12037652561, 665, 1, 2, 0, 0, 12037652548, 665, 12037652560, 665, 2, 1, 0, 0, 12037652549, 665, 12037652559, 665, 1, 2, 0, 0, 12037652550, 665, 12037652558, 665, 2, 1, 0, 0, 12037652551, 665, 12037652557, 665, 1, 2, 0, 0, 12037652552, 665, 12037652556, 665, 2, 1, 0, 0, 12037652553, 665, 12037652555, 665, 1, 2, 0, 72, 1, 12037652586, 665, 0, 12037652540, 665, 12037652569, 665, 1, 12037652541, 665, 12037652568, 665, 2, 0, 1, 0, 12037652542, 665, 12037652567, 665, 1, 2, 0, 0, 12037652543, 665, 12037652566, 665, 2, 1, 0, 0, 12037652544, 665, 12037652565, 665, 1, 2, 0, 0, 12037652545, 665, 12037652564, 665, 2, 1, 0, 0, 12037652546, 665, 12037652563, 665, 1, 2, 0, 0, 12037652547, 665, 12037652562, 665, 2, 1, 0, 0, 12037652548, 665, 12037652561, 665, 1, 2, 0, 0, 12037652549, 665, 12037652560, 665, 2, 1, 0, 0, 12037652550, 665, 12037652559, 665, 1, 2, 0, 0, 12037652551, 665, 12037652558, 665, 2, 1, 0, 0, 12037652552, 665, 12037652557, 665, 1, 2, 0, 0, 12037652553, 665, 12037652556, 665, 2, 1, 0, 73, 2, 12037652587, 665, 0, 12037652541, 665, 12037652569, 665, 1, 12037652542, 665, 12037652568, 665, 2, 0, 1, 0, 12037652543, 665, 12037652567, 665, 1, 2, 0, 0, 12037652544, 665, 12037652566, 665, 2, 1, 0, 0, 12037652545, 665, 12037652565, 665, 1, 2, 0, 0, 12037652546, 665, 12037652564, 665, 2, 1, 0, 0, 12037652547, 665, 12037652563, 665, 1, 2, 0, 0, 12037652548, 665, 12037652562, 665, 2, 1, 0, 0, 12037652549, 665, 12037652561, 665, 1, 2, 0, 0, 12037652550, 665, 12037652560, 665, 2, 1, 0, 0, 12037652551, 665, 12037652559, 665, 1, 2, 0, 0, 12037652552, 665, 12037652558, 665, 2, 1, 0, 0, 12037652553, 665, 12037652557, 665, 1, 2, 0, 74, 1, 12037652588, 665, 0, 12037652542, 665, 12037652569, 665, 1, 12037652543, 665, 12037652568, 665, 2, 0, 1, 0, 12037652544, 665, 12037652567, 665, 1, 2, 0, 0, 12037652545, 665, 12037652566, 665, 2, 1, 0, 0, 12037652546, 665, 12037652565, 665, 1, 2, 0, 0, 12037652547, 665, 12037652564, 665, 2, 1, 0, 0, 12037652548, 665, 12037652563, 665, 1, 2, 0, 0, 12037652549, 665, 12037652562, 665, 2, 1, 0, 0, 12037652550, 665, 12037652561, 665, 1, 2, 0, 0, 12037652551, 665, 12037652560, 665, 2, 1, 0, 0, 12037652552, 665, 12037652559, 665, 1, 2, 0, 0, 12037652553, 665, 12037652558, 665, 2, 1, 0, 75, 2, 12037652589, 665, 0, 12037652543, 665, 12037652569, 665, 1, 12037652544, 665, 12037652568, 665, 2, 0, 1, 0, 12037652545, 665, 12037652567, 665, 1, 2, 0, 0, 12037652546, 665, 12037652566, 665, 2, 1, 0, 0, 12037652547, 665, 12037652565, 665, 1, 2, 0, 0, 12037652548, 665, 12037652564, 665, 2, 1, 0, 0, 12037652549, 665, 12037652563, 665, 1, 2, 0, 0, 12037652550, 665, 12037652562, 665, 2, 1, 0, 0, 12037652551, 665, 12037652561, 665, 1, 2, 0, 0, 12037652552, 665, 12037652560, 665, 2, 1, 0, 0, 12037652553, 665, 12037652559, 665, 1, 2, 0, 76, 1, 12037652590, 665, 0, 12037652544, 665, 12037652569, 665, 1, 12037652545, 665, 12037652568, 665, 2, 0, 1, 0, 12037652546, 665, 12037652567, 665, 1, 2, 0, 0, 12037652547, 665, 12037652566, 665, 2, 1, 0, 0, 12037652548, 665, 12037652565, 665, 1, 2, 0, 0, 12037652549, 665, 12037652564, 665, 2, 1, 0, 0, 12037652550, 665, 12037652563, 665, 1, 2, 0, 0, 12037652551, 665, 12037652562, 665, 2, 1, 0, 0, 12037652552, 665, 12037652561, 665, 1, 2, 0, 0, 12037652553, 665, 12037652560, 665, 2, 1, 0, 77, 2, 12037652591, 665, 0, 12037652545, 665, 12037652569, 665, 1, 12037652546, 665, 12037652568, 665, 2, 0, 1, 0, 12037652547, 665, 12037652567, 665, 1, 2, 0, 0, 12037652548, 665, 12037652566, 665, 2, 1, 0, 0, 12037652549, 665, 12037652565, 665, 1, 2, 0, 0, 12037652550, 665, 12037652564, 665, 2, 1, 0, 0, 12037652551, 665, 12037652563, 665, 1, 2, 0, 0, 12037652552, 665, 12037652562, 665, 2, 1, 0, 0, 12037652553, 665, 12037652561, 665, 1, 2, 0, 78, 1, 12037652592, 665, 0, 12037652546, 665, 12037652569, 665, 1, 12037652547, 665, 12037652568, 665, 2, 0, 1, 0, 12037652548, 665, 12037652567, 665, 1, 2, 0, 0, 12037652549, 665, 12037652566, 665, 2, 1, 0, 0, 12037652550, 665, 12037652565, 665, 1, 2, 0, 0, 12037652551, 665, 12037652564, 665, 2, 1, 0, 0, 12037652552, 665, 12037652563, 665, 1, 2, 0, 0, 12037652553, 665, 12037652562, 665, 2, 1, 0, 79, 2, 12037652593, 665, 0, 12037652547, 665, 12037652569, 665, 1, 12037652548, 665, 12037652568, 665, 2, 0, 1, 0, 12037652549, 665, 12037652567, 665, 1, 2, 0, 0, 12037652550, 665, 12037652566, 665, 2, 1, 0, 0, 12037652551, 665, 12037652565, 665, 1, 2, 0, 0, 12037652552, 665, 12037652564, 665, 2, 1, 0, 0, 12037652553, 665, 12037652563, 665, 1, 2, 0, 80, 1, 12037652594, 665, 0, 12037652548, 665, 12037652569, 665, 1, 12037652549, 665, 12037652568, 665, 2, 0, 1, 0, 12037652550, 665, 12037652567, 665, 1, 2, 0, 0, 12037652551, 665, 12037652566, 665, 2, 1, 0, 0, 12037652552, 665, 12037652565, 665, 1, 2, 0, 0, 12037652553, 665, 12037652564, 665, 2, 1, 0, 81, 2, 12037652595, 665, 0, 12037652549, 665, 12037652569, 665, 1, 12037652550, 665, 12037652568, 665, 2, 0, 1, 0, 12037652551, 665, 12037652567, 665, 1, 2, 0, 0, 12037652552, 665, 12037652566, 665, 2, 1, 0, 0, 12037652553, 665, 12037652565, 665, 1, 2, 0, 82, 1, 12037652596, 665, 0, 12037652550, 665, 12037652569, 665, 1, 12037652551, 665, 12037652568, 665, 2, 0, 1, 0, 12037652552, 665, 12037652567, 665, 1, 2, 0, 0, 12037652553, 665, 12037652566, 665, 2, 1, 0, 83, 2, 12037652597, 665, 0, 12037652551, 665, 12037652569, 665, 1, 12037652552, 665, 12037652568, 665, 2, 0, 1, 0, 12037652553, 665, 12037652567, 665, 1, 2, 0, 84, 1, 12037652598, 665, 0, 12037652552, 665, 12037652569, 665, 1, 12037652553, 665, 12037652568, 665, 2, 0, 1, 85, 2, 12037652599, 665, 0, 12037652553, 665, 12037652569, 665, 86, 0, 12037652600, 665, 87, 0ULL, 12037652601, 665, 0, 12037652634, 665, 12037652570, 665, 1, 12037652634, 665, 12037652538, 665, 2, 0, 1, 0, 64559ULL, 12037652650, 665, 1, 2, 0, 0, 1, 12037652586, 665, 88, 0, 12037652554, 665, 0, 12037652634, 665, 12037652571, 665, 1, 12037652634, 665, 12037652539, 665, 2, 0, 1, 0, 64559ULL, 12037652651, 665, 3, 2, 0, 0, 12037652635, 665, 12037652570, 665, 1, 12037652635, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652587, 665, 89, 1, 12037652555, 665, 0, 12037652634, 665, 12037652572, 665, 1, 12037652634, 665, 12037652540, 665, 2, 0, 1, 0, 64559ULL, 12037652652, 665, 3, 2, 0, 0, 12037652635, 665, 12037652571, 665, 1, 12037652635, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652570, 665, 1, 12037652636, 665, 12037652538, 665, 2, 0, 1, 0, 65534ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652588, 665, 90, 1, 12037652556, 665, 0, 12037652634, 665, 12037652573, 665, 1, 12037652634, 665, 12037652541, 665, 2, 0, 1, 0, 64559ULL, 12037652653, 665, 3, 2, 0, 0, 12037652635, 665, 12037652572, 665, 1, 12037652635, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652571, 665, 1, 12037652636, 665, 12037652539, 665, 2, 0, 1, 0, 65534ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652570, 665, 1, 12037652637, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652589, 665, 91, 1, 12037652557, 665, 0, 12037652634, 665, 12037652574, 665, 1, 12037652634, 665, 12037652542, 665, 2, 0, 1, 0, 64559ULL, 12037652654, 665, 3, 2, 0, 0, 12037652635, 665, 12037652573, 665, 1, 12037652635, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652572, 665, 1, 12037652636, 665, 12037652540, 665, 2, 0, 1, 0, 65534ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652571, 665, 1, 12037652637, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652570, 665, 1, 12037652638, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652590, 665, 92, 1, 12037652558, 665, 0, 12037652634, 665, 12037652575, 665, 1, 12037652634, 665, 12037652543, 665, 2, 0, 1, 0, 64559ULL, 12037652655, 665, 3, 2, 0, 0, 12037652635, 665, 12037652574, 665, 1, 12037652635, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652573, 665, 1, 12037652636, 665, 12037652541, 665, 2, 0, 1, 0, 65534ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652572, 665, 1, 12037652637, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652571, 665, 1, 12037652638, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652570, 665, 1, 12037652639, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652591, 665, 93, 1, 12037652559, 665, 0, 12037652634, 665, 12037652576, 665, 1, 12037652634, 665, 12037652544, 665, 2, 0, 1, 0, 64559ULL, 12037652656, 665, 3, 2, 0, 0, 12037652635, 665, 12037652575, 665, 1, 12037652635, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652574, 665, 1, 12037652636, 665, 12037652542, 665, 2, 0, 1, 0, 65534ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652573, 665, 1, 12037652637, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652572, 665, 1, 12037652638, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652571, 665, 1, 12037652639, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652570, 665, 1, 12037652640, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652592, 665, 94, 1, 12037652560, 665, 0, 12037652634, 665, 12037652577, 665, 1, 12037652634, 665, 12037652545, 665, 2, 0, 1, 0, 64559ULL, 12037652657, 665, 3, 2, 0, 0, 12037652635, 665, 12037652576, 665, 1, 12037652635, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652575, 665, 1, 12037652636, 665, 12037652543, 665, 2, 0, 1, 0, 65534ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652574, 665, 1, 12037652637, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652573, 665, 1, 12037652638, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652572, 665, 1, 12037652639, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652571, 665, 1, 12037652640, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652570, 665, 1, 12037652641, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652593, 665, 95, 1, 12037652561, 665, 0, 12037652634, 665, 12037652578, 665, 1, 12037652634, 665, 12037652546, 665, 2, 0, 1, 0, 64559ULL, 12037652658, 665, 3, 2, 0, 0, 12037652635, 665, 12037652577, 665, 1, 12037652635, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652576, 665, 1, 12037652636, 665, 12037652544, 665, 2, 0, 1, 0, 65534ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652575, 665, 1, 12037652637, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652574, 665, 1, 12037652638, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652573, 665, 1, 12037652639, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652572, 665, 1, 12037652640, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652571, 665, 1, 12037652641, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652570, 665, 1, 12037652642, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652594, 665, 96, 1, 12037652562, 665, 0, 12037652634, 665, 12037652579, 665, 1, 12037652634, 665, 12037652547, 665, 2, 0, 1, 0, 64559ULL, 12037652659, 665, 3, 2, 0, 0, 12037652635, 665, 12037652578, 665, 1, 12037652635, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652577, 665, 1, 12037652636, 665, 12037652545, 665, 2, 0, 1, 0, 65534ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652576, 665, 1, 12037652637, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652575, 665, 1, 12037652638, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652574, 665, 1, 12037652639, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652573, 665, 1, 12037652640, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652572, 665, 1, 12037652641, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652571, 665, 1, 12037652642, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652570, 665, 1, 12037652643, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652595, 665, 97, 1, 12037652563, 665, 0, 12037652634, 665, 12037652580, 665, 1, 12037652634, 665, 12037652548, 665, 2, 0, 1, 0, 64559ULL, 12037652660, 665, 3, 2, 0, 0, 12037652635, 665, 12037652579, 665, 1, 12037652635, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652578, 665, 1, 12037652636, 665, 12037652546, 665, 2, 0, 1, 0, 65534ULL, 12037652658, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652577, 665, 1, 12037652637, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652576, 665, 1, 12037652638, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652575, 665, 1, 12037652639, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652574, 665, 1, 12037652640, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652573, 665, 1, 12037652641, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652572, 665, 1, 12037652642, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652571, 665, 1, 12037652643, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652570, 665, 1, 12037652644, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652596, 665, 98, 1, 12037652564, 665, 0, 12037652634, 665, 12037652581, 665, 1, 12037652634, 665, 12037652549, 665, 2, 0, 1, 0, 64559ULL, 12037652661, 665, 3, 2, 0, 0, 12037652635, 665, 12037652580, 665, 1, 12037652635, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652579, 665, 1, 12037652636, 665, 12037652547, 665, 2, 0, 1, 0, 65534ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652578, 665, 1, 12037652637, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652577, 665, 1, 12037652638, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652576, 665, 1, 12037652639, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652575, 665, 1, 12037652640, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652574, 665, 1, 12037652641, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652573, 665, 1, 12037652642, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652572, 665, 1, 12037652643, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652571, 665, 1, 12037652644, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652570, 665, 1, 12037652645, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652597, 665, 99, 1, 12037652565, 665, 0, 12037652634, 665, 12037652582, 665, 1, 12037652634, 665, 12037652550, 665, 2, 0, 1, 0, 64559ULL, 12037652662, 665, 3, 2, 0, 0, 12037652635, 665, 12037652581, 665, 1, 12037652635, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652580, 665, 1, 12037652636, 665, 12037652548, 665, 2, 0, 1, 0, 65534ULL, 12037652660, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652579, 665, 1, 12037652637, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652578, 665, 1, 12037652638, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652577, 665, 1, 12037652639, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652576, 665, 1, 12037652640, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652575, 665, 1, 12037652641, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652574, 665, 1, 12037652642, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652573, 665, 1, 12037652643, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652572, 665, 1, 12037652644, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652571, 665, 1, 12037652645, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652570, 665, 1, 12037652646, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652598, 665, 100, 1, 12037652566, 665, 0, 12037652634, 665, 12037652583, 665, 1, 12037652634, 665, 12037652551, 665, 2, 0, 1, 0, 64559ULL, 12037652663, 665, 3, 2, 0, 0, 12037652635, 665, 12037652582, 665, 1, 12037652635, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652581, 665, 1, 12037652636, 665, 12037652549, 665, 2, 0, 1, 0, 65534ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652580, 665, 1, 12037652637, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652579, 665, 1, 12037652638, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652578, 665, 1, 12037652639, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652577, 665, 1, 12037652640, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652576, 665, 1, 12037652641, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652575, 665, 1, 12037652642, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652574, 665, 1, 12037652643, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652573, 665, 1, 12037652644, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652572, 665, 1, 12037652645, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652571, 665, 1, 12037652646, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652570, 665, 1, 12037652647, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652599, 665, 753, 1, 12037652567, 665, 0, 12037652634, 665, 12037652584, 665, 1, 12037652634, 665, 12037652552, 665, 2, 0, 1, 0, 64559ULL, 12037652664, 665, 3, 2, 0, 0, 12037652635, 665, 12037652583, 665, 1, 12037652635, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652582, 665, 1, 12037652636, 665, 12037652550, 665, 2, 0, 1, 0, 65534ULL, 12037652662, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652581, 665, 1, 12037652637, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652580, 665, 1, 12037652638, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652579, 665, 1, 12037652639, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652578, 665, 1, 12037652640, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652577, 665, 1, 12037652641, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652576, 665, 1, 12037652642, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652575, 665, 1, 12037652643, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652574, 665, 1, 12037652644, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652573, 665, 1, 12037652645, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652572, 665, 1, 12037652646, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652571, 665, 1, 12037652647, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652570, 665, 1, 12037652648, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652600, 665, 754, 1, 12037652568, 665, 0, 12037652634, 665, 12037652585, 665, 1, 12037652634, 665, 12037652553, 665, 2, 0, 1, 0, 64559ULL, 12037652665, 665, 3, 2, 0, 0, 12037652635, 665, 12037652584, 665, 1, 12037652635, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652583, 665, 1, 12037652636, 665, 12037652551, 665, 2, 0, 1, 0, 65534ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652582, 665, 1, 12037652637, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652581, 665, 1, 12037652638, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652580, 665, 1, 12037652639, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652579, 665, 1, 12037652640, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652578, 665, 1, 12037652641, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652577, 665, 1, 12037652642, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652576, 665, 1, 12037652643, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652575, 665, 1, 12037652644, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652574, 665, 1, 12037652645, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652573, 665, 1, 12037652646, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652572, 665, 1, 12037652647, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652571, 665, 1, 12037652648, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652570, 665, 1, 12037652649, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652601, 665, 755, 1, 12037652569, 665, 0, 12037652635, 665, 12037652585, 665, 1, 12037652635, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652636, 665, 12037652584, 665, 1, 12037652636, 665, 12037652552, 665, 2, 0, 1, 0, 65534ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652637, 665, 12037652583, 665, 1, 12037652637, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652638, 665, 12037652582, 665, 1, 12037652638, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652581, 665, 1, 12037652639, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652580, 665, 1, 12037652640, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652579, 665, 1, 12037652641, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652578, 665, 1, 12037652642, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652577, 665, 1, 12037652643, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652576, 665, 1, 12037652644, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652575, 665, 1, 12037652645, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652574, 665, 1, 12037652646, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652573, 665, 1, 12037652647, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652572, 665, 1, 12037652648, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652571, 665, 1, 12037652649, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 0, 4, 1, 756, 0, 258236ULL, 0, 12037652636, 665, 12037652585, 665, 1, 12037652636, 665, 12037652553, 665, 2, 0, 1, 0, 65534ULL, 12037652665, 665, 3, 2, 0, 0, 12037652637, 665, 12037652584, 665, 1, 12037652637, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652583, 665, 1, 12037652638, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652582, 665, 1, 12037652639, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652581, 665, 1, 12037652640, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652580, 665, 1, 12037652641, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652579, 665, 1, 12037652642, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652578, 665, 1, 12037652643, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652577, 665, 1, 12037652644, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652576, 665, 1, 12037652645, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652575, 665, 1, 12037652646, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652574, 665, 1, 12037652647, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652573, 665, 1, 12037652648, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652572, 665, 1, 12037652649, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 0, 3, 1, 757, 0, 262140ULL, 0, 12037652637, 665, 12037652585, 665, 1, 12037652637, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652638, 665, 12037652584, 665, 1, 12037652638, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652583, 665, 1, 12037652639, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652582, 665, 1, 12037652640, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652581, 665, 1, 12037652641, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652580, 665, 1, 12037652642, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652579, 665, 1, 12037652643, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652578, 665, 1, 12037652644, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652577, 665, 1, 12037652645, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652576, 665, 1, 12037652646, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652575, 665, 1, 12037652647, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652574, 665, 1, 12037652648, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652573, 665, 1, 12037652649, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 0, 4, 1, 758, 0, 262136ULL, 0, 12037652638, 665, 12037652585, 665, 1, 12037652638, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652639, 665, 12037652584, 665, 1, 12037652639, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652583, 665, 1, 12037652640, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652582, 665, 1, 12037652641, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652581, 665, 1, 12037652642, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652580, 665, 1, 12037652643, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652579, 665, 1, 12037652644, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652578, 665, 1, 12037652645, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652577, 665, 1, 12037652646, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652576, 665, 1, 12037652647, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652575, 665, 1, 12037652648, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652574, 665, 1, 12037652649, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 0, 3, 1, 759, 0, 262140ULL, 0, 12037652639, 665, 12037652585, 665, 1, 12037652639, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652640, 665, 12037652584, 665, 1, 12037652640, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652583, 665, 1, 12037652641, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652582, 665, 1, 12037652642, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652581, 665, 1, 12037652643, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652580, 665, 1, 12037652644, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652579, 665, 1, 12037652645, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652578, 665, 1, 12037652646, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652577, 665, 1, 12037652647, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652576, 665, 1, 12037652648, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652575, 665, 1, 12037652649, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 0, 4, 1, 760, 0, 262140ULL, 0, 12037652640, 665, 12037652585, 665, 1, 12037652640, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652641, 665, 12037652584, 665, 1, 12037652641, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652583, 665, 1, 12037652642, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652582, 665, 1, 12037652643, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652581, 665, 1, 12037652644, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652580, 665, 1, 12037652645, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652579, 665, 1, 12037652646, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652578, 665, 1, 12037652647, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652577, 665, 1, 12037652648, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652576, 665, 1, 12037652649, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 0, 3, 1, 761, 0, 262140ULL, 0, 12037652641, 665, 12037652585, 665, 1, 12037652641, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652642, 665, 12037652584, 665, 1, 12037652642, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652583, 665, 1, 12037652643, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652582, 665, 1, 12037652644, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652581, 665, 1, 12037652645, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652580, 665, 1, 12037652646, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652579, 665, 1, 12037652647, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652578, 665, 1, 12037652648, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652577, 665, 1, 12037652649, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 0, 4, 1, 762, 0, 262140ULL, 0, 12037652642, 665, 12037652585, 665, 1, 12037652642, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652643, 665, 12037652584, 665, 1, 12037652643, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652583, 665, 1, 12037652644, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652582, 665, 1, 12037652645, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652581, 665, 1, 12037652646, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652580, 665, 1, 12037652647, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652579, 665, 1, 12037652648, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652578, 665, 1, 12037652649, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 0, 3, 1, 763, 0, 262140ULL, 0, 12037652643, 665, 12037652585, 665, 1, 12037652643, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652644, 665, 12037652584, 665, 1, 12037652644, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652583, 665, 1, 12037652645, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652582, 665, 1, 12037652646, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652581, 665, 1, 12037652647, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652580, 665, 1, 12037652648, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652579, 665, 1, 12037652649, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 0, 4, 1, 764, 0, 262140ULL, 0, 12037652644, 665, 12037652585, 665, 1, 12037652644, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652645, 665, 12037652584, 665, 1, 12037652645, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652583, 665, 1, 12037652646, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652582, 665, 1, 12037652647, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652581, 665, 1, 12037652648, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652580, 665, 1, 12037652649, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 0, 3, 1, 765, 0, 262140ULL, 0, 12037652645, 665, 12037652585, 665, 1, 12037652645, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652646, 665, 12037652584, 665, 1, 12037652646, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652583, 665, 1, 12037652647, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652582, 665, 1, 12037652648, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652581, 665, 1, 12037652649, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 0, 4, 1, 766, 0, 262140ULL, 0, 12037652646, 665, 12037652585, 665, 1, 12037652646, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652647, 665, 12037652584, 665, 1, 12037652647, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652583, 665, 1, 12037652648, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652582, 665, 1, 12037652649, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 0, 3, 1, 767, 0, 262140ULL, 0, 12037652647, 665, 12037652585, 665, 1, 12037652647, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652648, 665, 12037652584, 665, 1, 12037652648, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652583, 665, 1, 12037652649, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 0, 4, 1, 768, 0, 262140ULL, 0, 12037652648, 665, 12037652585, 665, 1, 12037652648, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652649, 665, 12037652584, 665, 1, 12037652649, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 0, 3, 1, 769, 0, 262140ULL, 0, 12037652649, 665, 12037652585, 665, 1, 12037652649, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 1, 2, 0, 770, 1, 262140ULL, 771, 18446744069414322181ULL, 0, 12037652634, 665, 12037652554, 665, 1, 12037652634, 665, 12037652554, 665, 2, 0, 1, 0, 12037652538, 665, 12037652538, 665, 1, 2, 0, 0, 12037652538, 665, 12037652538, 665, 2, 1, 0, 0, 12037652538, 665, 12037652538, 665, 1, 2, 0, 0, 64559ULL, 12037652650, 665, 772, 1, 0, 0, 12037652634, 665, 12037652555, 665, 1, 12037652634, 665, 12037652555, 665, 2, 0, 1, 0, 12037652538, 665, 12037652539, 665, 1, 2, 0, 0, 12037652538, 665, 12037652539, 665, 2, 1, 0, 0, 12037652538, 665, 12037652539, 665, 1, 2, 0, 0, 64559ULL, 12037652651, 665, 3, 1, 0, 0, 12037652635, 665, 12037652554, 665, 1, 12037652635, 665, 12037652554, 665, 2, 0, 1, 0, 12037652539, 665, 12037652538, 665, 1, 2, 0, 0, 12037652539, 665, 12037652538, 665, 2, 1, 0, 0, 12037652539, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 773, 3, 2, 0, 12037652634, 665, 12037652556, 665, 1, 12037652634, 665, 12037652556, 665, 2, 0, 1, 0, 12037652538, 665, 12037652540, 665, 1, 2, 0, 0, 12037652538, 665, 12037652540, 665, 2, 1, 0, 0, 12037652538, 665, 12037652540, 665, 1, 2, 0, 0, 64559ULL, 12037652652, 665, 3, 1, 0, 0, 12037652635, 665, 12037652555, 665, 1, 12037652635, 665, 12037652555, 665, 2, 0, 1, 0, 12037652539, 665, 12037652539, 665, 1, 2, 0, 0, 12037652539, 665, 12037652539, 665, 2, 1, 0, 0, 12037652539, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652554, 665, 1, 12037652636, 665, 12037652554, 665, 2, 0, 1, 0, 12037652540, 665, 12037652538, 665, 1, 2, 0, 0, 12037652540, 665, 12037652538, 665, 2, 1, 0, 0, 12037652540, 665, 12037652538, 665, 1, 2, 0, 0, 65534ULL, 12037652650, 665, 2, 1, 0, 774, 4, 2, 0, 12037652634, 665, 12037652557, 665, 1, 12037652634, 665, 12037652557, 665, 2, 0, 1, 0, 12037652538, 665, 12037652541, 665, 1, 2, 0, 0, 12037652538, 665, 12037652541, 665, 2, 1, 0, 0, 12037652538, 665, 12037652541, 665, 1, 2, 0, 0, 64559ULL, 12037652653, 665, 3, 1, 0, 0, 12037652635, 665, 12037652556, 665, 1, 12037652635, 665, 12037652556, 665, 2, 0, 1, 0, 12037652539, 665, 12037652540, 665, 1, 2, 0, 0, 12037652539, 665, 12037652540, 665, 2, 1, 0, 0, 12037652539, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652555, 665, 1, 12037652636, 665, 12037652555, 665, 2, 0, 1, 0, 12037652540, 665, 12037652539, 665, 1, 2, 0, 0, 12037652540, 665, 12037652539, 665, 2, 1, 0, 0, 12037652540, 665, 12037652539, 665, 1, 2, 0, 0, 65534ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652554, 665, 1, 12037652637, 665, 12037652554, 665, 2, 0, 1, 0, 12037652541, 665, 12037652538, 665, 1, 2, 0, 0, 12037652541, 665, 12037652538, 665, 2, 1, 0, 0, 12037652541, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 775, 3, 2, 0, 12037652634, 665, 12037652558, 665, 1, 12037652634, 665, 12037652558, 665, 2, 0, 1, 0, 12037652538, 665, 12037652542, 665, 1, 2, 0, 0, 12037652538, 665, 12037652542, 665, 2, 1, 0, 0, 12037652538, 665, 12037652542, 665, 1, 2, 0, 0, 64559ULL, 12037652654, 665, 3, 1, 0, 0, 12037652635, 665, 12037652557, 665, 1, 12037652635, 665, 12037652557, 665, 2, 0, 1, 0, 12037652539, 665, 12037652541, 665, 1, 2, 0, 0, 12037652539, 665, 12037652541, 665, 2, 1, 0, 0, 12037652539, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652556, 665, 1, 12037652636, 665, 12037652556, 665, 2, 0, 1, 0, 12037652540, 665, 12037652540, 665, 1, 2, 0, 0, 12037652540, 665, 12037652540, 665, 2, 1, 0, 0, 12037652540, 665, 12037652540, 665, 1, 2, 0, 0, 65534ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652555, 665, 1, 12037652637, 665, 12037652555, 665, 2, 0, 1, 0, 12037652541, 665, 12037652539, 665, 1, 2, 0, 0, 12037652541, 665, 12037652539, 665, 2, 1, 0, 0, 12037652541, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652554, 665, 1, 12037652638, 665, 12037652554, 665, 2, 0, 1, 0, 12037652542, 665, 12037652538, 665, 1, 2, 0, 0, 12037652542, 665, 12037652538, 665, 2, 1, 0, 0, 12037652542, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 776, 4, 2, 0, 12037652634, 665, 12037652559, 665, 1, 12037652634, 665, 12037652559, 665, 2, 0, 1, 0, 12037652538, 665, 12037652543, 665, 1, 2, 0, 0, 12037652538, 665, 12037652543, 665, 2, 1, 0, 0, 12037652538, 665, 12037652543, 665, 1, 2, 0, 0, 64559ULL, 12037652655, 665, 3, 1, 0, 0, 12037652635, 665, 12037652558, 665, 1, 12037652635, 665, 12037652558, 665, 2, 0, 1, 0, 12037652539, 665, 12037652542, 665, 1, 2, 0, 0, 12037652539, 665, 12037652542, 665, 2, 1, 0, 0, 12037652539, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652557, 665, 1, 12037652636, 665, 12037652557, 665, 2, 0, 1, 0, 12037652540, 665, 12037652541, 665, 1, 2, 0, 0, 12037652540, 665, 12037652541, 665, 2, 1, 0, 0, 12037652540, 665, 12037652541, 665, 1, 2, 0, 0, 65534ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652556, 665, 1, 12037652637, 665, 12037652556, 665, 2, 0, 1, 0, 12037652541, 665, 12037652540, 665, 1, 2, 0, 0, 12037652541, 665, 12037652540, 665, 2, 1, 0, 0, 12037652541, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652555, 665, 1, 12037652638, 665, 12037652555, 665, 2, 0, 1, 0, 12037652542, 665, 12037652539, 665, 1, 2, 0, 0, 12037652542, 665, 12037652539, 665, 2, 1, 0, 0, 12037652542, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652554, 665, 1, 12037652639, 665, 12037652554, 665, 2, 0, 1, 0, 12037652543, 665, 12037652538, 665, 1, 2, 0, 0, 12037652543, 665, 12037652538, 665, 2, 1, 0, 0, 12037652543, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 777, 3, 2, 0, 12037652634, 665, 12037652560, 665, 1, 12037652634, 665, 12037652560, 665, 2, 0, 1, 0, 12037652538, 665, 12037652544, 665, 1, 2, 0, 0, 12037652538, 665, 12037652544, 665, 2, 1, 0, 0, 12037652538, 665, 12037652544, 665, 1, 2, 0, 0, 64559ULL, 12037652656, 665, 3, 1, 0, 0, 12037652635, 665, 12037652559, 665, 1, 12037652635, 665, 12037652559, 665, 2, 0, 1, 0, 12037652539, 665, 12037652543, 665, 1, 2, 0, 0, 12037652539, 665, 12037652543, 665, 2, 1, 0, 0, 12037652539, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652558, 665, 1, 12037652636, 665, 12037652558, 665, 2, 0, 1, 0, 12037652540, 665, 12037652542, 665, 1, 2, 0, 0, 12037652540, 665, 12037652542, 665, 2, 1, 0, 0, 12037652540, 665, 12037652542, 665, 1, 2, 0, 0, 65534ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652557, 665, 1, 12037652637, 665, 12037652557, 665, 2, 0, 1, 0, 12037652541, 665, 12037652541, 665, 1, 2, 0, 0, 12037652541, 665, 12037652541, 665, 2, 1, 0, 0, 12037652541, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652556, 665, 1, 12037652638, 665, 12037652556, 665, 2, 0, 1, 0, 12037652542, 665, 12037652540, 665, 1, 2, 0, 0, 12037652542, 665, 12037652540, 665, 2, 1, 0, 0, 12037652542, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652555, 665, 1, 12037652639, 665, 12037652555, 665, 2, 0, 1, 0, 12037652543, 665, 12037652539, 665, 1, 2, 0, 0, 12037652543, 665, 12037652539, 665, 2, 1, 0, 0, 12037652543, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652554, 665, 1, 12037652640, 665, 12037652554, 665, 2, 0, 1, 0, 12037652544, 665, 12037652538, 665, 1, 2, 0, 0, 12037652544, 665, 12037652538, 665, 2, 1, 0, 0, 12037652544, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 778, 4, 2, 0, 12037652634, 665, 12037652561, 665, 1, 12037652634, 665, 12037652561, 665, 2, 0, 1, 0, 12037652538, 665, 12037652545, 665, 1, 2, 0, 0, 12037652538, 665, 12037652545, 665, 2, 1, 0, 0, 12037652538, 665, 12037652545, 665, 1, 2, 0, 0, 64559ULL, 12037652657, 665, 3, 1, 0, 0, 12037652635, 665, 12037652560, 665, 1, 12037652635, 665, 12037652560, 665, 2, 0, 1, 0, 12037652539, 665, 12037652544, 665, 1, 2, 0, 0, 12037652539, 665, 12037652544, 665, 2, 1, 0, 0, 12037652539, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652559, 665, 1, 12037652636, 665, 12037652559, 665, 2, 0, 1, 0, 12037652540, 665, 12037652543, 665, 1, 2, 0, 0, 12037652540, 665, 12037652543, 665, 2, 1, 0, 0, 12037652540, 665, 12037652543, 665, 1, 2, 0, 0, 65534ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652558, 665, 1, 12037652637, 665, 12037652558, 665, 2, 0, 1, 0, 12037652541, 665, 12037652542, 665, 1, 2, 0, 0, 12037652541, 665, 12037652542, 665, 2, 1, 0, 0, 12037652541, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652557, 665, 1, 12037652638, 665, 12037652557, 665, 2, 0, 1, 0, 12037652542, 665, 12037652541, 665, 1, 2, 0, 0, 12037652542, 665, 12037652541, 665, 2, 1, 0, 0, 12037652542, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652556, 665, 1, 12037652639, 665, 12037652556, 665, 2, 0, 1, 0, 12037652543, 665, 12037652540, 665, 1, 2, 0, 0, 12037652543, 665, 12037652540, 665, 2, 1, 0, 0, 12037652543, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652555, 665, 1, 12037652640, 665, 12037652555, 665, 2, 0, 1, 0, 12037652544, 665, 12037652539, 665, 1, 2, 0, 0, 12037652544, 665, 12037652539, 665, 2, 1, 0, 0, 12037652544, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652554, 665, 1, 12037652641, 665, 12037652554, 665, 2, 0, 1, 0, 12037652545, 665, 12037652538, 665, 1, 2, 0, 0, 12037652545, 665, 12037652538, 665, 2, 1, 0, 0, 12037652545, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 779, 3, 2, 0, 12037652634, 665, 12037652562, 665, 1, 12037652634, 665, 12037652562, 665, 2, 0, 1, 0, 12037652538, 665, 12037652546, 665, 1, 2, 0, 0, 12037652538, 665, 12037652546, 665, 2, 1, 0, 0, 12037652538, 665, 12037652546, 665, 1, 2, 0, 0, 64559ULL, 12037652658, 665, 3, 1, 0, 0, 12037652635, 665, 12037652561, 665, 1, 12037652635, 665, 12037652561, 665, 2, 0, 1, 0, 12037652539, 665, 12037652545, 665, 1, 2, 0, 0, 12037652539, 665, 12037652545, 665, 2, 1, 0, 0, 12037652539, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652560, 665, 1, 12037652636, 665, 12037652560, 665, 2, 0, 1, 0, 12037652540, 665, 12037652544, 665, 1, 2, 0, 0, 12037652540, 665, 12037652544, 665, 2, 1, 0, 0, 12037652540, 665, 12037652544, 665, 1, 2, 0, 0, 65534ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652559, 665, 1, 12037652637, 665, 12037652559, 665, 2, 0, 1, 0, 12037652541, 665, 12037652543, 665, 1, 2, 0, 0, 12037652541, 665, 12037652543, 665, 2, 1, 0, 0, 12037652541, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652558, 665, 1, 12037652638, 665, 12037652558, 665, 2, 0, 1, 0, 12037652542, 665, 12037652542, 665, 1, 2, 0, 0, 12037652542, 665, 12037652542, 665, 2, 1, 0, 0, 12037652542, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652557, 665, 1, 12037652639, 665, 12037652557, 665, 2, 0, 1, 0, 12037652543, 665, 12037652541, 665, 1, 2, 0, 0, 12037652543, 665, 12037652541, 665, 2, 1, 0, 0, 12037652543, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652556, 665, 1, 12037652640, 665, 12037652556, 665, 2, 0, 1, 0, 12037652544, 665, 12037652540, 665, 1, 2, 0, 0, 12037652544, 665, 12037652540, 665, 2, 1, 0, 0, 12037652544, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652555, 665, 1, 12037652641, 665, 12037652555, 665, 2, 0, 1, 0, 12037652545, 665, 12037652539, 665, 1, 2, 0, 0, 12037652545, 665, 12037652539, 665, 2, 1, 0, 0, 12037652545, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652554, 665, 1, 12037652642, 665, 12037652554, 665, 2, 0, 1, 0, 12037652546, 665, 12037652538, 665, 1, 2, 0, 0, 12037652546, 665, 12037652538, 665, 2, 1, 0, 0, 12037652546, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 780, 4, 2, 0, 12037652634, 665, 12037652563, 665, 1, 12037652634, 665, 12037652563, 665, 2, 0, 1, 0, 12037652538, 665, 12037652547, 665, 1, 2, 0, 0, 12037652538, 665, 12037652547, 665, 2, 1, 0, 0, 12037652538, 665, 12037652547, 665, 1, 2, 0, 0, 64559ULL, 12037652659, 665, 3, 1, 0, 0, 12037652635, 665, 12037652562, 665, 1, 12037652635, 665, 12037652562, 665, 2, 0, 1, 0, 12037652539, 665, 12037652546, 665, 1, 2, 0, 0, 12037652539, 665, 12037652546, 665, 2, 1, 0, 0, 12037652539, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652561, 665, 1, 12037652636, 665, 12037652561, 665, 2, 0, 1, 0, 12037652540, 665, 12037652545, 665, 1, 2, 0, 0, 12037652540, 665, 12037652545, 665, 2, 1, 0, 0, 12037652540, 665, 12037652545, 665, 1, 2, 0, 0, 65534ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652560, 665, 1, 12037652637, 665, 12037652560, 665, 2, 0, 1, 0, 12037652541, 665, 12037652544, 665, 1, 2, 0, 0, 12037652541, 665, 12037652544, 665, 2, 1, 0, 0, 12037652541, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652559, 665, 1, 12037652638, 665, 12037652559, 665, 2, 0, 1, 0, 12037652542, 665, 12037652543, 665, 1, 2, 0, 0, 12037652542, 665, 12037652543, 665, 2, 1, 0, 0, 12037652542, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652558, 665, 1, 12037652639, 665, 12037652558, 665, 2, 0, 1, 0, 12037652543, 665, 12037652542, 665, 1, 2, 0, 0, 12037652543, 665, 12037652542, 665, 2, 1, 0, 0, 12037652543, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652557, 665, 1, 12037652640, 665, 12037652557, 665, 2, 0, 1, 0, 12037652544, 665, 12037652541, 665, 1, 2, 0, 0, 12037652544, 665, 12037652541, 665, 2, 1, 0, 0, 12037652544, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652556, 665, 1, 12037652641, 665, 12037652556, 665, 2, 0, 1, 0, 12037652545, 665, 12037652540, 665, 1, 2, 0, 0, 12037652545, 665, 12037652540, 665, 2, 1, 0, 0, 12037652545, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652555, 665, 1, 12037652642, 665, 12037652555, 665, 2, 0, 1, 0, 12037652546, 665, 12037652539, 665, 1, 2, 0, 0, 12037652546, 665, 12037652539, 665, 2, 1, 0, 0, 12037652546, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652554, 665, 1, 12037652643, 665, 12037652554, 665, 2, 0, 1, 0, 12037652547, 665, 12037652538, 665, 1, 2, 0, 0, 12037652547, 665, 12037652538, 665, 2, 1, 0, 0, 12037652547, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 781, 3, 2, 0, 12037652634, 665, 12037652564, 665, 1, 12037652634, 665, 12037652564, 665, 2, 0, 1, 0, 12037652538, 665, 12037652548, 665, 1, 2, 0, 0, 12037652538, 665, 12037652548, 665, 2, 1, 0, 0, 12037652538, 665, 12037652548, 665, 1, 2, 0, 0, 64559ULL, 12037652660, 665, 3, 1, 0, 0, 12037652635, 665, 12037652563, 665, 1, 12037652635, 665, 12037652563, 665, 2, 0, 1, 0, 12037652539, 665, 12037652547, 665, 1, 2, 0, 0, 12037652539, 665, 12037652547, 665, 2, 1, 0, 0, 12037652539, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652562, 665, 1, 12037652636, 665, 12037652562, 665, 2, 0, 1, 0, 12037652540, 665, 12037652546, 665, 1, 2, 0, 0, 12037652540, 665, 12037652546, 665, 2, 1, 0, 0, 12037652540, 665, 12037652546, 665, 1, 2, 0, 0, 65534ULL, 12037652658, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652561, 665, 1, 12037652637, 665, 12037652561, 665, 2, 0, 1, 0, 12037652541, 665, 12037652545, 665, 1, 2, 0, 0, 12037652541, 665, 12037652545, 665, 2, 1, 0, 0, 12037652541, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652560, 665, 1, 12037652638, 665, 12037652560, 665, 2, 0, 1, 0, 12037652542, 665, 12037652544, 665, 1, 2, 0, 0, 12037652542, 665, 12037652544, 665, 2, 1, 0, 0, 12037652542, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652559, 665, 1, 12037652639, 665, 12037652559, 665, 2, 0, 1, 0, 12037652543, 665, 12037652543, 665, 1, 2, 0, 0, 12037652543, 665, 12037652543, 665, 2, 1, 0, 0, 12037652543, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652558, 665, 1, 12037652640, 665, 12037652558, 665, 2, 0, 1, 0, 12037652544, 665, 12037652542, 665, 1, 2, 0, 0, 12037652544, 665, 12037652542, 665, 2, 1, 0, 0, 12037652544, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652557, 665, 1, 12037652641, 665, 12037652557, 665, 2, 0, 1, 0, 12037652545, 665, 12037652541, 665, 1, 2, 0, 0, 12037652545, 665, 12037652541, 665, 2, 1, 0, 0, 12037652545, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652556, 665, 1, 12037652642, 665, 12037652556, 665, 2, 0, 1, 0, 12037652546, 665, 12037652540, 665, 1, 2, 0, 0, 12037652546, 665, 12037652540, 665, 2, 1, 0, 0, 12037652546, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652555, 665, 1, 12037652643, 665, 12037652555, 665, 2, 0, 1, 0, 12037652547, 665, 12037652539, 665, 1, 2, 0, 0, 12037652547, 665, 12037652539, 665, 2, 1, 0, 0, 12037652547, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652554, 665, 1, 12037652644, 665, 12037652554, 665, 2, 0, 1, 0, 12037652548, 665, 12037652538, 665, 1, 2, 0, 0, 12037652548, 665, 12037652538, 665, 2, 1, 0, 0, 12037652548, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 782, 4, 2, 0, 12037652634, 665, 12037652565, 665, 1, 12037652634, 665, 12037652565, 665, 2, 0, 1, 0, 12037652538, 665, 12037652549, 665, 1, 2, 0, 0, 12037652538, 665, 12037652549, 665, 2, 1, 0, 0, 12037652538, 665, 12037652549, 665, 1, 2, 0, 0, 64559ULL, 12037652661, 665, 3, 1, 0, 0, 12037652635, 665, 12037652564, 665, 1, 12037652635, 665, 12037652564, 665, 2, 0, 1, 0, 12037652539, 665, 12037652548, 665, 1, 2, 0, 0, 12037652539, 665, 12037652548, 665, 2, 1, 0, 0, 12037652539, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652563, 665, 1, 12037652636, 665, 12037652563, 665, 2, 0, 1, 0, 12037652540, 665, 12037652547, 665, 1, 2, 0, 0, 12037652540, 665, 12037652547, 665, 2, 1, 0, 0, 12037652540, 665, 12037652547, 665, 1, 2, 0, 0, 65534ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652562, 665, 1, 12037652637, 665, 12037652562, 665, 2, 0, 1, 0, 12037652541, 665, 12037652546, 665, 1, 2, 0, 0, 12037652541, 665, 12037652546, 665, 2, 1, 0, 0, 12037652541, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652561, 665, 1, 12037652638, 665, 12037652561, 665, 2, 0, 1, 0, 12037652542, 665, 12037652545, 665, 1, 2, 0, 0, 12037652542, 665, 12037652545, 665, 2, 1, 0, 0, 12037652542, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652560, 665, 1, 12037652639, 665, 12037652560, 665, 2, 0, 1, 0, 12037652543, 665, 12037652544, 665, 1, 2, 0, 0, 12037652543, 665, 12037652544, 665, 2, 1, 0, 0, 12037652543, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652559, 665, 1, 12037652640, 665, 12037652559, 665, 2, 0, 1, 0, 12037652544, 665, 12037652543, 665, 1, 2, 0, 0, 12037652544, 665, 12037652543, 665, 2, 1, 0, 0, 12037652544, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652558, 665, 1, 12037652641, 665, 12037652558, 665, 2, 0, 1, 0, 12037652545, 665, 12037652542, 665, 1, 2, 0, 0, 12037652545, 665, 12037652542, 665, 2, 1, 0, 0, 12037652545, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652557, 665, 1, 12037652642, 665, 12037652557, 665, 2, 0, 1, 0, 12037652546, 665, 12037652541, 665, 1, 2, 0, 0, 12037652546, 665, 12037652541, 665, 2, 1, 0, 0, 12037652546, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652556, 665, 1, 12037652643, 665, 12037652556, 665, 2, 0, 1, 0, 12037652547, 665, 12037652540, 665, 1, 2, 0, 0, 12037652547, 665, 12037652540, 665, 2, 1, 0, 0, 12037652547, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652555, 665, 1, 12037652644, 665, 12037652555, 665, 2, 0, 1, 0, 12037652548, 665, 12037652539, 665, 1, 2, 0, 0, 12037652548, 665, 12037652539, 665, 2, 1, 0, 0, 12037652548, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652554, 665, 1, 12037652645, 665, 12037652554, 665, 2, 0, 1, 0, 12037652549, 665, 12037652538, 665, 1, 2, 0, 0, 12037652549, 665, 12037652538, 665, 2, 1, 0, 0, 12037652549, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 783, 3, 2, 0, 12037652634, 665, 12037652566, 665, 1, 12037652634, 665, 12037652566, 665, 2, 0, 1, 0, 12037652538, 665, 12037652550, 665, 1, 2, 0, 0, 12037652538, 665, 12037652550, 665, 2, 1, 0, 0, 12037652538, 665, 12037652550, 665, 1, 2, 0, 0, 64559ULL, 12037652662, 665, 3, 1, 0, 0, 12037652635, 665, 12037652565, 665, 1, 12037652635, 665, 12037652565, 665, 2, 0, 1, 0, 12037652539, 665, 12037652549, 665, 1, 2, 0, 0, 12037652539, 665, 12037652549, 665, 2, 1, 0, 0, 12037652539, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652564, 665, 1, 12037652636, 665, 12037652564, 665, 2, 0, 1, 0, 12037652540, 665, 12037652548, 665, 1, 2, 0, 0, 12037652540, 665, 12037652548, 665, 2, 1, 0, 0, 12037652540, 665, 12037652548, 665, 1, 2, 0, 0, 65534ULL, 12037652660, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652563, 665, 1, 12037652637, 665, 12037652563, 665, 2, 0, 1, 0, 12037652541, 665, 12037652547, 665, 1, 2, 0, 0, 12037652541, 665, 12037652547, 665, 2, 1, 0, 0, 12037652541, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652562, 665, 1, 12037652638, 665, 12037652562, 665, 2, 0, 1, 0, 12037652542, 665, 12037652546, 665, 1, 2, 0, 0, 12037652542, 665, 12037652546, 665, 2, 1, 0, 0, 12037652542, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652561, 665, 1, 12037652639, 665, 12037652561, 665, 2, 0, 1, 0, 12037652543, 665, 12037652545, 665, 1, 2, 0, 0, 12037652543, 665, 12037652545, 665, 2, 1, 0, 0, 12037652543, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652560, 665, 1, 12037652640, 665, 12037652560, 665, 2, 0, 1, 0, 12037652544, 665, 12037652544, 665, 1, 2, 0, 0, 12037652544, 665, 12037652544, 665, 2, 1, 0, 0, 12037652544, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652559, 665, 1, 12037652641, 665, 12037652559, 665, 2, 0, 1, 0, 12037652545, 665, 12037652543, 665, 1, 2, 0, 0, 12037652545, 665, 12037652543, 665, 2, 1, 0, 0, 12037652545, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652558, 665, 1, 12037652642, 665, 12037652558, 665, 2, 0, 1, 0, 12037652546, 665, 12037652542, 665, 1, 2, 0, 0, 12037652546, 665, 12037652542, 665, 2, 1, 0, 0, 12037652546, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652557, 665, 1, 12037652643, 665, 12037652557, 665, 2, 0, 1, 0, 12037652547, 665, 12037652541, 665, 1, 2, 0, 0, 12037652547, 665, 12037652541, 665, 2, 1, 0, 0, 12037652547, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652556, 665, 1, 12037652644, 665, 12037652556, 665, 2, 0, 1, 0, 12037652548, 665, 12037652540, 665, 1, 2, 0, 0, 12037652548, 665, 12037652540, 665, 2, 1, 0, 0, 12037652548, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652555, 665, 1, 12037652645, 665, 12037652555, 665, 2, 0, 1, 0, 12037652549, 665, 12037652539, 665, 1, 2, 0, 0, 12037652549, 665, 12037652539, 665, 2, 1, 0, 0, 12037652549, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652554, 665, 1, 12037652646, 665, 12037652554, 665, 2, 0, 1, 0, 12037652550, 665, 12037652538, 665, 1, 2, 0, 0, 12037652550, 665, 12037652538, 665, 2, 1, 0, 0, 12037652550, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 784, 4, 2, 0, 12037652634, 665, 12037652567, 665, 1, 12037652634, 665, 12037652567, 665, 2, 0, 1, 0, 12037652538, 665, 12037652551, 665, 1, 2, 0, 0, 12037652538, 665, 12037652551, 665, 2, 1, 0, 0, 12037652538, 665, 12037652551, 665, 1, 2, 0, 0, 64559ULL, 12037652663, 665, 3, 1, 0, 0, 12037652635, 665, 12037652566, 665, 1, 12037652635, 665, 12037652566, 665, 2, 0, 1, 0, 12037652539, 665, 12037652550, 665, 1, 2, 0, 0, 12037652539, 665, 12037652550, 665, 2, 1, 0, 0, 12037652539, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652565, 665, 1, 12037652636, 665, 12037652565, 665, 2, 0, 1, 0, 12037652540, 665, 12037652549, 665, 1, 2, 0, 0, 12037652540, 665, 12037652549, 665, 2, 1, 0, 0, 12037652540, 665, 12037652549, 665, 1, 2, 0, 0, 65534ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652564, 665, 1, 12037652637, 665, 12037652564, 665, 2, 0, 1, 0, 12037652541, 665, 12037652548, 665, 1, 2, 0, 0, 12037652541, 665, 12037652548, 665, 2, 1, 0, 0, 12037652541, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652563, 665, 1, 12037652638, 665, 12037652563, 665, 2, 0, 1, 0, 12037652542, 665, 12037652547, 665, 1, 2, 0, 0, 12037652542, 665, 12037652547, 665, 2, 1, 0, 0, 12037652542, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652562, 665, 1, 12037652639, 665, 12037652562, 665, 2, 0, 1, 0, 12037652543, 665, 12037652546, 665, 1, 2, 0, 0, 12037652543, 665, 12037652546, 665, 2, 1, 0, 0, 12037652543, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652561, 665, 1, 12037652640, 665, 12037652561, 665, 2, 0, 1, 0, 12037652544, 665, 12037652545, 665, 1, 2, 0, 0, 12037652544, 665, 12037652545, 665, 2, 1, 0, 0, 12037652544, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652560, 665, 1, 12037652641, 665, 12037652560, 665, 2, 0, 1, 0, 12037652545, 665, 12037652544, 665, 1, 2, 0, 0, 12037652545, 665, 12037652544, 665, 2, 1, 0, 0, 12037652545, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652559, 665, 1, 12037652642, 665, 12037652559, 665, 2, 0, 1, 0, 12037652546, 665, 12037652543, 665, 1, 2, 0, 0, 12037652546, 665, 12037652543, 665, 2, 1, 0, 0, 12037652546, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652558, 665, 1, 12037652643, 665, 12037652558, 665, 2, 0, 1, 0, 12037652547, 665, 12037652542, 665, 1, 2, 0, 0, 12037652547, 665, 12037652542, 665, 2, 1, 0, 0, 12037652547, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652557, 665, 1, 12037652644, 665, 12037652557, 665, 2, 0, 1, 0, 12037652548, 665, 12037652541, 665, 1, 2, 0, 0, 12037652548, 665, 12037652541, 665, 2, 1, 0, 0, 12037652548, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652556, 665, 1, 12037652645, 665, 12037652556, 665, 2, 0, 1, 0, 12037652549, 665, 12037652540, 665, 1, 2, 0, 0, 12037652549, 665, 12037652540, 665, 2, 1, 0, 0, 12037652549, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652555, 665, 1, 12037652646, 665, 12037652555, 665, 2, 0, 1, 0, 12037652550, 665, 12037652539, 665, 1, 2, 0, 0, 12037652550, 665, 12037652539, 665, 2, 1, 0, 0, 12037652550, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652554, 665, 1, 12037652647, 665, 12037652554, 665, 2, 0, 1, 0, 12037652551, 665, 12037652538, 665, 1, 2, 0, 0, 12037652551, 665, 12037652538, 665, 2, 1, 0, 0, 12037652551, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 785, 3, 2, 0, 12037652634, 665, 12037652568, 665, 1, 12037652634, 665, 12037652568, 665, 2, 0, 1, 0, 12037652538, 665, 12037652552, 665, 1, 2, 0, 0, 12037652538, 665, 12037652552, 665, 2, 1, 0, 0, 12037652538, 665, 12037652552, 665, 1, 2, 0, 0, 64559ULL, 12037652664, 665, 3, 1, 0, 0, 12037652635, 665, 12037652567, 665, 1, 12037652635, 665, 12037652567, 665, 2, 0, 1, 0, 12037652539, 665, 12037652551, 665, 1, 2, 0, 0, 12037652539, 665, 12037652551, 665, 2, 1, 0, 0, 12037652539, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652566, 665, 1, 12037652636, 665, 12037652566, 665, 2, 0, 1, 0, 12037652540, 665, 12037652550, 665, 1, 2, 0, 0, 12037652540, 665, 12037652550, 665, 2, 1, 0, 0, 12037652540, 665, 12037652550, 665, 1, 2, 0, 0, 65534ULL, 12037652662, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652565, 665, 1, 12037652637, 665, 12037652565, 665, 2, 0, 1, 0, 12037652541, 665, 12037652549, 665, 1, 2, 0, 0, 12037652541, 665, 12037652549, 665, 2, 1, 0, 0, 12037652541, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652564, 665, 1, 12037652638, 665, 12037652564, 665, 2, 0, 1, 0, 12037652542, 665, 12037652548, 665, 1, 2, 0, 0, 12037652542, 665, 12037652548, 665, 2, 1, 0, 0, 12037652542, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652563, 665, 1, 12037652639, 665, 12037652563, 665, 2, 0, 1, 0, 12037652543, 665, 12037652547, 665, 1, 2, 0, 0, 12037652543, 665, 12037652547, 665, 2, 1, 0, 0, 12037652543, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652562, 665, 1, 12037652640, 665, 12037652562, 665, 2, 0, 1, 0, 12037652544, 665, 12037652546, 665, 1, 2, 0, 0, 12037652544, 665, 12037652546, 665, 2, 1, 0, 0, 12037652544, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652561, 665, 1, 12037652641, 665, 12037652561, 665, 2, 0, 1, 0, 12037652545, 665, 12037652545, 665, 1, 2, 0, 0, 12037652545, 665, 12037652545, 665, 2, 1, 0, 0, 12037652545, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652560, 665, 1, 12037652642, 665, 12037652560, 665, 2, 0, 1, 0, 12037652546, 665, 12037652544, 665, 1, 2, 0, 0, 12037652546, 665, 12037652544, 665, 2, 1, 0, 0, 12037652546, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652559, 665, 1, 12037652643, 665, 12037652559, 665, 2, 0, 1, 0, 12037652547, 665, 12037652543, 665, 1, 2, 0, 0, 12037652547, 665, 12037652543, 665, 2, 1, 0, 0, 12037652547, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652558, 665, 1, 12037652644, 665, 12037652558, 665, 2, 0, 1, 0, 12037652548, 665, 12037652542, 665, 1, 2, 0, 0, 12037652548, 665, 12037652542, 665, 2, 1, 0, 0, 12037652548, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652557, 665, 1, 12037652645, 665, 12037652557, 665, 2, 0, 1, 0, 12037652549, 665, 12037652541, 665, 1, 2, 0, 0, 12037652549, 665, 12037652541, 665, 2, 1, 0, 0, 12037652549, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652556, 665, 1, 12037652646, 665, 12037652556, 665, 2, 0, 1, 0, 12037652550, 665, 12037652540, 665, 1, 2, 0, 0, 12037652550, 665, 12037652540, 665, 2, 1, 0, 0, 12037652550, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652555, 665, 1, 12037652647, 665, 12037652555, 665, 2, 0, 1, 0, 12037652551, 665, 12037652539, 665, 1, 2, 0, 0, 12037652551, 665, 12037652539, 665, 2, 1, 0, 0, 12037652551, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652554, 665, 1, 12037652648, 665, 12037652554, 665, 2, 0, 1, 0, 12037652552, 665, 12037652538, 665, 1, 2, 0, 0, 12037652552, 665, 12037652538, 665, 2, 1, 0, 0, 12037652552, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 786, 4, 2, 0, 12037652634, 665, 12037652569, 665, 1, 12037652634, 665, 12037652569, 665, 2, 0, 1, 0, 12037652538, 665, 12037652553, 665, 1, 2, 0, 0, 12037652538, 665, 12037652553, 665, 2, 1, 0, 0, 12037652538, 665, 12037652553, 665, 1, 2, 0, 0, 64559ULL, 12037652665, 665, 3, 1, 0, 0, 12037652635, 665, 12037652568, 665, 1, 12037652635, 665, 12037652568, 665, 2, 0, 1, 0, 12037652539, 665, 12037652552, 665, 1, 2, 0, 0, 12037652539, 665, 12037652552, 665, 2, 1, 0, 0, 12037652539, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652567, 665, 1, 12037652636, 665, 12037652567, 665, 2, 0, 1, 0, 12037652540, 665, 12037652551, 665, 1, 2, 0, 0, 12037652540, 665, 12037652551, 665, 2, 1, 0, 0, 12037652540, 665, 12037652551, 665, 1, 2, 0, 0, 65534ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652566, 665, 1, 12037652637, 665, 12037652566, 665, 2, 0, 1, 0, 12037652541, 665, 12037652550, 665, 1, 2, 0, 0, 12037652541, 665, 12037652550, 665, 2, 1, 0, 0, 12037652541, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652565, 665, 1, 12037652638, 665, 12037652565, 665, 2, 0, 1, 0, 12037652542, 665, 12037652549, 665, 1, 2, 0, 0, 12037652542, 665, 12037652549, 665, 2, 1, 0, 0, 12037652542, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652564, 665, 1, 12037652639, 665, 12037652564, 665, 2, 0, 1, 0, 12037652543, 665, 12037652548, 665, 1, 2, 0, 0, 12037652543, 665, 12037652548, 665, 2, 1, 0, 0, 12037652543, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652563, 665, 1, 12037652640, 665, 12037652563, 665, 2, 0, 1, 0, 12037652544, 665, 12037652547, 665, 1, 2, 0, 0, 12037652544, 665, 12037652547, 665, 2, 1, 0, 0, 12037652544, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652562, 665, 1, 12037652641, 665, 12037652562, 665, 2, 0, 1, 0, 12037652545, 665, 12037652546, 665, 1, 2, 0, 0, 12037652545, 665, 12037652546, 665, 2, 1, 0, 0, 12037652545, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652561, 665, 1, 12037652642, 665, 12037652561, 665, 2, 0, 1, 0, 12037652546, 665, 12037652545, 665, 1, 2, 0, 0, 12037652546, 665, 12037652545, 665, 2, 1, 0, 0, 12037652546, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652560, 665, 1, 12037652643, 665, 12037652560, 665, 2, 0, 1, 0, 12037652547, 665, 12037652544, 665, 1, 2, 0, 0, 12037652547, 665, 12037652544, 665, 2, 1, 0, 0, 12037652547, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652559, 665, 1, 12037652644, 665, 12037652559, 665, 2, 0, 1, 0, 12037652548, 665, 12037652543, 665, 1, 2, 0, 0, 12037652548, 665, 12037652543, 665, 2, 1, 0, 0, 12037652548, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652558, 665, 1, 12037652645, 665, 12037652558, 665, 2, 0, 1, 0, 12037652549, 665, 12037652542, 665, 1, 2, 0, 0, 12037652549, 665, 12037652542, 665, 2, 1, 0, 0, 12037652549, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652557, 665, 1, 12037652646, 665, 12037652557, 665, 2, 0, 1, 0, 12037652550, 665, 12037652541, 665, 1, 2, 0, 0, 12037652550, 665, 12037652541, 665, 2, 1, 0, 0, 12037652550, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652556, 665, 1, 12037652647, 665, 12037652556, 665, 2, 0, 1, 0, 12037652551, 665, 12037652540, 665, 1, 2, 0, 0, 12037652551, 665, 12037652540, 665, 2, 1, 0, 0, 12037652551, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652555, 665, 1, 12037652648, 665, 12037652555, 665, 2, 0, 1, 0, 12037652552, 665, 12037652539, 665, 1, 2, 0, 0, 12037652552, 665, 12037652539, 665, 2, 1, 0, 0, 12037652552, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652554, 665, 1, 12037652649, 665, 12037652554, 665, 2, 0, 1, 0, 12037652553, 665, 12037652538, 665, 1, 2, 0, 0, 12037652553, 665, 12037652538, 665, 2, 1, 0, 0, 12037652553, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 787, 3, 2, 0, 12037652635, 665, 12037652569, 665, 1, 12037652635, 665, 12037652569, 665, 2, 0, 1, 0, 12037652539, 665, 12037652553, 665, 1, 2, 0, 0, 12037652539, 665, 12037652553, 665, 2, 1, 0, 0, 12037652539, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652636, 665, 12037652568, 665, 1, 12037652636, 665, 12037652568, 665, 2, 0, 1, 0, 12037652540, 665, 12037652552, 665, 1, 2, 0, 0, 12037652540, 665, 12037652552, 665, 2, 1, 0, 0, 12037652540, 665, 12037652552, 665, 1, 2, 0, 0, 65534ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652637, 665, 12037652567, 665, 1, 12037652637, 665, 12037652567, 665, 2, 0, 1, 0, 12037652541, 665, 12037652551, 665, 1, 2, 0, 0, 12037652541, 665, 12037652551, 665, 2, 1, 0, 0, 12037652541, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652638, 665, 12037652566, 665, 1, 12037652638, 665, 12037652566, 665, 2, 0, 1, 0, 12037652542, 665, 12037652550, 665, 1, 2, 0, 0, 12037652542, 665, 12037652550, 665, 2, 1, 0, 0, 12037652542, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652639, 665, 12037652565, 665, 1, 12037652639, 665, 12037652565, 665, 2, 0, 1, 0, 12037652543, 665, 12037652549, 665, 1, 2, 0, 0, 12037652543, 665, 12037652549, 665, 2, 1, 0, 0, 12037652543, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652640, 665, 12037652564, 665, 1, 12037652640, 665, 12037652564, 665, 2, 0, 1, 0, 12037652544, 665, 12037652548, 665, 1, 2, 0, 0, 12037652544, 665, 12037652548, 665, 2, 1, 0, 0, 12037652544, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652641, 665, 12037652563, 665, 1, 12037652641, 665, 12037652563, 665, 2, 0, 1, 0, 12037652545, 665, 12037652547, 665, 1, 2, 0, 0, 12037652545, 665, 12037652547, 665, 2, 1, 0, 0, 12037652545, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652642, 665, 12037652562, 665, 1, 12037652642, 665, 12037652562, 665, 2, 0, 1, 0, 12037652546, 665, 12037652546, 665, 1, 2, 0, 0, 12037652546, 665, 12037652546, 665, 2, 1, 0, 0, 12037652546, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652561, 665, 1, 12037652643, 665, 12037652561, 665, 2, 0, 1, 0, 12037652547, 665, 12037652545, 665, 1, 2, 0, 0, 12037652547, 665, 12037652545, 665, 2, 1, 0, 0, 12037652547, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652560, 665, 1, 12037652644, 665, 12037652560, 665, 2, 0, 1, 0, 12037652548, 665, 12037652544, 665, 1, 2, 0, 0, 12037652548, 665, 12037652544, 665, 2, 1, 0, 0, 12037652548, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652559, 665, 1, 12037652645, 665, 12037652559, 665, 2, 0, 1, 0, 12037652549, 665, 12037652543, 665, 1, 2, 0, 0, 12037652549, 665, 12037652543, 665, 2, 1, 0, 0, 12037652549, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652558, 665, 1, 12037652646, 665, 12037652558, 665, 2, 0, 1, 0, 12037652550, 665, 12037652542, 665, 1, 2, 0, 0, 12037652550, 665, 12037652542, 665, 2, 1, 0, 0, 12037652550, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652557, 665, 1, 12037652647, 665, 12037652557, 665, 2, 0, 1, 0, 12037652551, 665, 12037652541, 665, 1, 2, 0, 0, 12037652551, 665, 12037652541, 665, 2, 1, 0, 0, 12037652551, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652556, 665, 1, 12037652648, 665, 12037652556, 665, 2, 0, 1, 0, 12037652552, 665, 12037652540, 665, 1, 2, 0, 0, 12037652552, 665, 12037652540, 665, 2, 1, 0, 0, 12037652552, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652555, 665, 1, 12037652649, 665, 12037652555, 665, 2, 0, 1, 0, 12037652553, 665, 12037652539, 665, 1, 2, 0, 0, 12037652553, 665, 12037652539, 665, 2, 1, 0, 0, 12037652553, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 0, 4, 2, 788, 0, 258236ULL, 0, 12037652636, 665, 12037652569, 665, 1, 12037652636, 665, 12037652569, 665, 2, 0, 1, 0, 12037652540, 665, 12037652553, 665, 1, 2, 0, 0, 12037652540, 665, 12037652553, 665, 2, 1, 0, 0, 12037652540, 665, 12037652553, 665, 1, 2, 0, 0, 65534ULL, 12037652665, 665, 3, 1, 0, 0, 12037652637, 665, 12037652568, 665, 1, 12037652637, 665, 12037652568, 665, 2, 0, 1, 0, 12037652541, 665, 12037652552, 665, 1, 2, 0, 0, 12037652541, 665, 12037652552, 665, 2, 1, 0, 0, 12037652541, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652567, 665, 1, 12037652638, 665, 12037652567, 665, 2, 0, 1, 0, 12037652542, 665, 12037652551, 665, 1, 2, 0, 0, 12037652542, 665, 12037652551, 665, 2, 1, 0, 0, 12037652542, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652566, 665, 1, 12037652639, 665, 12037652566, 665, 2, 0, 1, 0, 12037652543, 665, 12037652550, 665, 1, 2, 0, 0, 12037652543, 665, 12037652550, 665, 2, 1, 0, 0, 12037652543, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652565, 665, 1, 12037652640, 665, 12037652565, 665, 2, 0, 1, 0, 12037652544, 665, 12037652549, 665, 1, 2, 0, 0, 12037652544, 665, 12037652549, 665, 2, 1, 0, 0, 12037652544, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652564, 665, 1, 12037652641, 665, 12037652564, 665, 2, 0, 1, 0, 12037652545, 665, 12037652548, 665, 1, 2, 0, 0, 12037652545, 665, 12037652548, 665, 2, 1, 0, 0, 12037652545, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652563, 665, 1, 12037652642, 665, 12037652563, 665, 2, 0, 1, 0, 12037652546, 665, 12037652547, 665, 1, 2, 0, 0, 12037652546, 665, 12037652547, 665, 2, 1, 0, 0, 12037652546, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652562, 665, 1, 12037652643, 665, 12037652562, 665, 2, 0, 1, 0, 12037652547, 665, 12037652546, 665, 1, 2, 0, 0, 12037652547, 665, 12037652546, 665, 2, 1, 0, 0, 12037652547, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652561, 665, 1, 12037652644, 665, 12037652561, 665, 2, 0, 1, 0, 12037652548, 665, 12037652545, 665, 1, 2, 0, 0, 12037652548, 665, 12037652545, 665, 2, 1, 0, 0, 12037652548, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652560, 665, 1, 12037652645, 665, 12037652560, 665, 2, 0, 1, 0, 12037652549, 665, 12037652544, 665, 1, 2, 0, 0, 12037652549, 665, 12037652544, 665, 2, 1, 0, 0, 12037652549, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652559, 665, 1, 12037652646, 665, 12037652559, 665, 2, 0, 1, 0, 12037652550, 665, 12037652543, 665, 1, 2, 0, 0, 12037652550, 665, 12037652543, 665, 2, 1, 0, 0, 12037652550, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652558, 665, 1, 12037652647, 665, 12037652558, 665, 2, 0, 1, 0, 12037652551, 665, 12037652542, 665, 1, 2, 0, 0, 12037652551, 665, 12037652542, 665, 2, 1, 0, 0, 12037652551, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652557, 665, 1, 12037652648, 665, 12037652557, 665, 2, 0, 1, 0, 12037652552, 665, 12037652541, 665, 1, 2, 0, 0, 12037652552, 665, 12037652541, 665, 2, 1, 0, 0, 12037652552, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652556, 665, 1, 12037652649, 665, 12037652556, 665, 2, 0, 1, 0, 12037652553, 665, 12037652540, 665, 1, 2, 0, 0, 12037652553, 665, 12037652540, 665, 2, 1, 0, 0, 12037652553, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 0, 3, 2, 789, 0, 262140ULL, 0, 12037652637, 665, 12037652569, 665, 1, 12037652637, 665, 12037652569, 665, 2, 0, 1, 0, 12037652541, 665, 12037652553, 665, 1, 2, 0, 0, 12037652541, 665, 12037652553, 665, 2, 1, 0, 0, 12037652541, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652638, 665, 12037652568, 665, 1, 12037652638, 665, 12037652568, 665, 2, 0, 1, 0, 12037652542, 665, 12037652552, 665, 1, 2, 0, 0, 12037652542, 665, 12037652552, 665, 2, 1, 0, 0, 12037652542, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652639, 665, 12037652567, 665, 1, 12037652639, 665, 12037652567, 665, 2, 0, 1, 0, 12037652543, 665, 12037652551, 665, 1, 2, 0, 0, 12037652543, 665, 12037652551, 665, 2, 1, 0, 0, 12037652543, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652640, 665, 12037652566, 665, 1, 12037652640, 665, 12037652566, 665, 2, 0, 1, 0, 12037652544, 665, 12037652550, 665, 1, 2, 0, 0, 12037652544, 665, 12037652550, 665, 2, 1, 0, 0, 12037652544, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652641, 665, 12037652565, 665, 1, 12037652641, 665, 12037652565, 665, 2, 0, 1, 0, 12037652545, 665, 12037652549, 665, 1, 2, 0, 0, 12037652545, 665, 12037652549, 665, 2, 1, 0, 0, 12037652545, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652642, 665, 12037652564, 665, 1, 12037652642, 665, 12037652564, 665, 2, 0, 1, 0, 12037652546, 665, 12037652548, 665, 1, 2, 0, 0, 12037652546, 665, 12037652548, 665, 2, 1, 0, 0, 12037652546, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652563, 665, 1, 12037652643, 665, 12037652563, 665, 2, 0, 1, 0, 12037652547, 665, 12037652547, 665, 1, 2, 0, 0, 12037652547, 665, 12037652547, 665, 2, 1, 0, 0, 12037652547, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652562, 665, 1, 12037652644, 665, 12037652562, 665, 2, 0, 1, 0, 12037652548, 665, 12037652546, 665, 1, 2, 0, 0, 12037652548, 665, 12037652546, 665, 2, 1, 0, 0, 12037652548, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652561, 665, 1, 12037652645, 665, 12037652561, 665, 2, 0, 1, 0, 12037652549, 665, 12037652545, 665, 1, 2, 0, 0, 12037652549, 665, 12037652545, 665, 2, 1, 0, 0, 12037652549, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652560, 665, 1, 12037652646, 665, 12037652560, 665, 2, 0, 1, 0, 12037652550, 665, 12037652544, 665, 1, 2, 0, 0, 12037652550, 665, 12037652544, 665, 2, 1, 0, 0, 12037652550, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652559, 665, 1, 12037652647, 665, 12037652559, 665, 2, 0, 1, 0, 12037652551, 665, 12037652543, 665, 1, 2, 0, 0, 12037652551, 665, 12037652543, 665, 2, 1, 0, 0, 12037652551, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652558, 665, 1, 12037652648, 665, 12037652558, 665, 2, 0, 1, 0, 12037652552, 665, 12037652542, 665, 1, 2, 0, 0, 12037652552, 665, 12037652542, 665, 2, 1, 0, 0, 12037652552, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652557, 665, 1, 12037652649, 665, 12037652557, 665, 2, 0, 1, 0, 12037652553, 665, 12037652541, 665, 1, 2, 0, 0, 12037652553, 665, 12037652541, 665, 2, 1, 0, 0, 12037652553, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 0, 4, 2, 790, 0, 262136ULL, 0, 12037652638, 665, 12037652569, 665, 1, 12037652638, 665, 12037652569, 665, 2, 0, 1, 0, 12037652542, 665, 12037652553, 665, 1, 2, 0, 0, 12037652542, 665, 12037652553, 665, 2, 1, 0, 0, 12037652542, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652639, 665, 12037652568, 665, 1, 12037652639, 665, 12037652568, 665, 2, 0, 1, 0, 12037652543, 665, 12037652552, 665, 1, 2, 0, 0, 12037652543, 665, 12037652552, 665, 2, 1, 0, 0, 12037652543, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652567, 665, 1, 12037652640, 665, 12037652567, 665, 2, 0, 1, 0, 12037652544, 665, 12037652551, 665, 1, 2, 0, 0, 12037652544, 665, 12037652551, 665, 2, 1, 0, 0, 12037652544, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652566, 665, 1, 12037652641, 665, 12037652566, 665, 2, 0, 1, 0, 12037652545, 665, 12037652550, 665, 1, 2, 0, 0, 12037652545, 665, 12037652550, 665, 2, 1, 0, 0, 12037652545, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652565, 665, 1, 12037652642, 665, 12037652565, 665, 2, 0, 1, 0, 12037652546, 665, 12037652549, 665, 1, 2, 0, 0, 12037652546, 665, 12037652549, 665, 2, 1, 0, 0, 12037652546, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652564, 665, 1, 12037652643, 665, 12037652564, 665, 2, 0, 1, 0, 12037652547, 665, 12037652548, 665, 1, 2, 0, 0, 12037652547, 665, 12037652548, 665, 2, 1, 0, 0, 12037652547, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652563, 665, 1, 12037652644, 665, 12037652563, 665, 2, 0, 1, 0, 12037652548, 665, 12037652547, 665, 1, 2, 0, 0, 12037652548, 665, 12037652547, 665, 2, 1, 0, 0, 12037652548, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652562, 665, 1, 12037652645, 665, 12037652562, 665, 2, 0, 1, 0, 12037652549, 665, 12037652546, 665, 1, 2, 0, 0, 12037652549, 665, 12037652546, 665, 2, 1, 0, 0, 12037652549, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652561, 665, 1, 12037652646, 665, 12037652561, 665, 2, 0, 1, 0, 12037652550, 665, 12037652545, 665, 1, 2, 0, 0, 12037652550, 665, 12037652545, 665, 2, 1, 0, 0, 12037652550, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652560, 665, 1, 12037652647, 665, 12037652560, 665, 2, 0, 1, 0, 12037652551, 665, 12037652544, 665, 1, 2, 0, 0, 12037652551, 665, 12037652544, 665, 2, 1, 0, 0, 12037652551, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652559, 665, 1, 12037652648, 665, 12037652559, 665, 2, 0, 1, 0, 12037652552, 665, 12037652543, 665, 1, 2, 0, 0, 12037652552, 665, 12037652543, 665, 2, 1, 0, 0, 12037652552, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652558, 665, 1, 12037652649, 665, 12037652558, 665, 2, 0, 1, 0, 12037652553, 665, 12037652542, 665, 1, 2, 0, 0, 12037652553, 665, 12037652542, 665, 2, 1, 0, 0, 12037652553, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 0, 3, 2, 791, 0, 262140ULL, 0, 12037652639, 665, 12037652569, 665, 1, 12037652639, 665, 12037652569, 665, 2, 0, 1, 0, 12037652543, 665, 12037652553, 665, 1, 2, 0, 0, 12037652543, 665, 12037652553, 665, 2, 1, 0, 0, 12037652543, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652640, 665, 12037652568, 665, 1, 12037652640, 665, 12037652568, 665, 2, 0, 1, 0, 12037652544, 665, 12037652552, 665, 1, 2, 0, 0, 12037652544, 665, 12037652552, 665, 2, 1, 0, 0, 12037652544, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652641, 665, 12037652567, 665, 1, 12037652641, 665, 12037652567, 665, 2, 0, 1, 0, 12037652545, 665, 12037652551, 665, 1, 2, 0, 0, 12037652545, 665, 12037652551, 665, 2, 1, 0, 0, 12037652545, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652642, 665, 12037652566, 665, 1, 12037652642, 665, 12037652566, 665, 2, 0, 1, 0, 12037652546, 665, 12037652550, 665, 1, 2, 0, 0, 12037652546, 665, 12037652550, 665, 2, 1, 0, 0, 12037652546, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652565, 665, 1, 12037652643, 665, 12037652565, 665, 2, 0, 1, 0, 12037652547, 665, 12037652549, 665, 1, 2, 0, 0, 12037652547, 665, 12037652549, 665, 2, 1, 0, 0, 12037652547, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652564, 665, 1, 12037652644, 665, 12037652564, 665, 2, 0, 1, 0, 12037652548, 665, 12037652548, 665, 1, 2, 0, 0, 12037652548, 665, 12037652548, 665, 2, 1, 0, 0, 12037652548, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652563, 665, 1, 12037652645, 665, 12037652563, 665, 2, 0, 1, 0, 12037652549, 665, 12037652547, 665, 1, 2, 0, 0, 12037652549, 665, 12037652547, 665, 2, 1, 0, 0, 12037652549, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652562, 665, 1, 12037652646, 665, 12037652562, 665, 2, 0, 1, 0, 12037652550, 665, 12037652546, 665, 1, 2, 0, 0, 12037652550, 665, 12037652546, 665, 2, 1, 0, 0, 12037652550, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652561, 665, 1, 12037652647, 665, 12037652561, 665, 2, 0, 1, 0, 12037652551, 665, 12037652545, 665, 1, 2, 0, 0, 12037652551, 665, 12037652545, 665, 2, 1, 0, 0, 12037652551, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652560, 665, 1, 12037652648, 665, 12037652560, 665, 2, 0, 1, 0, 12037652552, 665, 12037652544, 665, 1, 2, 0, 0, 12037652552, 665, 12037652544, 665, 2, 1, 0, 0, 12037652552, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652559, 665, 1, 12037652649, 665, 12037652559, 665, 2, 0, 1, 0, 12037652553, 665, 12037652543, 665, 1, 2, 0, 0, 12037652553, 665, 12037652543, 665, 2, 1, 0, 0, 12037652553, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 0, 4, 2, 792, 0, 262140ULL, 0, 12037652640, 665, 12037652569, 665, 1, 12037652640, 665, 12037652569, 665, 2, 0, 1, 0, 12037652544, 665, 12037652553, 665, 1, 2, 0, 0, 12037652544, 665, 12037652553, 665, 2, 1, 0, 0, 12037652544, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652641, 665, 12037652568, 665, 1, 12037652641, 665, 12037652568, 665, 2, 0, 1, 0, 12037652545, 665, 12037652552, 665, 1, 2, 0, 0, 12037652545, 665, 12037652552, 665, 2, 1, 0, 0, 12037652545, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652567, 665, 1, 12037652642, 665, 12037652567, 665, 2, 0, 1, 0, 12037652546, 665, 12037652551, 665, 1, 2, 0, 0, 12037652546, 665, 12037652551, 665, 2, 1, 0, 0, 12037652546, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652566, 665, 1, 12037652643, 665, 12037652566, 665, 2, 0, 1, 0, 12037652547, 665, 12037652550, 665, 1, 2, 0, 0, 12037652547, 665, 12037652550, 665, 2, 1, 0, 0, 12037652547, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652565, 665, 1, 12037652644, 665, 12037652565, 665, 2, 0, 1, 0, 12037652548, 665, 12037652549, 665, 1, 2, 0, 0, 12037652548, 665, 12037652549, 665, 2, 1, 0, 0, 12037652548, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652564, 665, 1, 12037652645, 665, 12037652564, 665, 2, 0, 1, 0, 12037652549, 665, 12037652548, 665, 1, 2, 0, 0, 12037652549, 665, 12037652548, 665, 2, 1, 0, 0, 12037652549, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652563, 665, 1, 12037652646, 665, 12037652563, 665, 2, 0, 1, 0, 12037652550, 665, 12037652547, 665, 1, 2, 0, 0, 12037652550, 665, 12037652547, 665, 2, 1, 0, 0, 12037652550, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652562, 665, 1, 12037652647, 665, 12037652562, 665, 2, 0, 1, 0, 12037652551, 665, 12037652546, 665, 1, 2, 0, 0, 12037652551, 665, 12037652546, 665, 2, 1, 0, 0, 12037652551, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652561, 665, 1, 12037652648, 665, 12037652561, 665, 2, 0, 1, 0, 12037652552, 665, 12037652545, 665, 1, 2, 0, 0, 12037652552, 665, 12037652545, 665, 2, 1, 0, 0, 12037652552, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652560, 665, 1, 12037652649, 665, 12037652560, 665, 2, 0, 1, 0, 12037652553, 665, 12037652544, 665, 1, 2, 0, 0, 12037652553, 665, 12037652544, 665, 2, 1, 0, 0, 12037652553, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 0, 3, 2, 793, 0, 262140ULL, 0, 12037652641, 665, 12037652569, 665, 1, 12037652641, 665, 12037652569, 665, 2, 0, 1, 0, 12037652545, 665, 12037652553, 665, 1, 2, 0, 0, 12037652545, 665, 12037652553, 665, 2, 1, 0, 0, 12037652545, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652642, 665, 12037652568, 665, 1, 12037652642, 665, 12037652568, 665, 2, 0, 1, 0, 12037652546, 665, 12037652552, 665, 1, 2, 0, 0, 12037652546, 665, 12037652552, 665, 2, 1, 0, 0, 12037652546, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652567, 665, 1, 12037652643, 665, 12037652567, 665, 2, 0, 1, 0, 12037652547, 665, 12037652551, 665, 1, 2, 0, 0, 12037652547, 665, 12037652551, 665, 2, 1, 0, 0, 12037652547, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652566, 665, 1, 12037652644, 665, 12037652566, 665, 2, 0, 1, 0, 12037652548, 665, 12037652550, 665, 1, 2, 0, 0, 12037652548, 665, 12037652550, 665, 2, 1, 0, 0, 12037652548, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652565, 665, 1, 12037652645, 665, 12037652565, 665, 2, 0, 1, 0, 12037652549, 665, 12037652549, 665, 1, 2, 0, 0, 12037652549, 665, 12037652549, 665, 2, 1, 0, 0, 12037652549, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652564, 665, 1, 12037652646, 665, 12037652564, 665, 2, 0, 1, 0, 12037652550, 665, 12037652548, 665, 1, 2, 0, 0, 12037652550, 665, 12037652548, 665, 2, 1, 0, 0, 12037652550, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652563, 665, 1, 12037652647, 665, 12037652563, 665, 2, 0, 1, 0, 12037652551, 665, 12037652547, 665, 1, 2, 0, 0, 12037652551, 665, 12037652547, 665, 2, 1, 0, 0, 12037652551, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652562, 665, 1, 12037652648, 665, 12037652562, 665, 2, 0, 1, 0, 12037652552, 665, 12037652546, 665, 1, 2, 0, 0, 12037652552, 665, 12037652546, 665, 2, 1, 0, 0, 12037652552, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652561, 665, 1, 12037652649, 665, 12037652561, 665, 2, 0, 1, 0, 12037652553, 665, 12037652545, 665, 1, 2, 0, 0, 12037652553, 665, 12037652545, 665, 2, 1, 0, 0, 12037652553, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 0, 4, 2, 794, 0, 262140ULL, 0, 12037652642, 665, 12037652569, 665, 1, 12037652642, 665, 12037652569, 665, 2, 0, 1, 0, 12037652546, 665, 12037652553, 665, 1, 2, 0, 0, 12037652546, 665, 12037652553, 665, 2, 1, 0, 0, 12037652546, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652643, 665, 12037652568, 665, 1, 12037652643, 665, 12037652568, 665, 2, 0, 1, 0, 12037652547, 665, 12037652552, 665, 1, 2, 0, 0, 12037652547, 665, 12037652552, 665, 2, 1, 0, 0, 12037652547, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652567, 665, 1, 12037652644, 665, 12037652567, 665, 2, 0, 1, 0, 12037652548, 665, 12037652551, 665, 1, 2, 0, 0, 12037652548, 665, 12037652551, 665, 2, 1, 0, 0, 12037652548, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652566, 665, 1, 12037652645, 665, 12037652566, 665, 2, 0, 1, 0, 12037652549, 665, 12037652550, 665, 1, 2, 0, 0, 12037652549, 665, 12037652550, 665, 2, 1, 0, 0, 12037652549, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652565, 665, 1, 12037652646, 665, 12037652565, 665, 2, 0, 1, 0, 12037652550, 665, 12037652549, 665, 1, 2, 0, 0, 12037652550, 665, 12037652549, 665, 2, 1, 0, 0, 12037652550, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652564, 665, 1, 12037652647, 665, 12037652564, 665, 2, 0, 1, 0, 12037652551, 665, 12037652548, 665, 1, 2, 0, 0, 12037652551, 665, 12037652548, 665, 2, 1, 0, 0, 12037652551, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652563, 665, 1, 12037652648, 665, 12037652563, 665, 2, 0, 1, 0, 12037652552, 665, 12037652547, 665, 1, 2, 0, 0, 12037652552, 665, 12037652547, 665, 2, 1, 0, 0, 12037652552, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652562, 665, 1, 12037652649, 665, 12037652562, 665, 2, 0, 1, 0, 12037652553, 665, 12037652546, 665, 1, 2, 0, 0, 12037652553, 665, 12037652546, 665, 2, 1, 0, 0, 12037652553, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 0, 3, 2, 795, 0, 262140ULL, 0, 12037652643, 665, 12037652569, 665, 1, 12037652643, 665, 12037652569, 665, 2, 0, 1, 0, 12037652547, 665, 12037652553, 665, 1, 2, 0, 0, 12037652547, 665, 12037652553, 665, 2, 1, 0, 0, 12037652547, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652644, 665, 12037652568, 665, 1, 12037652644, 665, 12037652568, 665, 2, 0, 1, 0, 12037652548, 665, 12037652552, 665, 1, 2, 0, 0, 12037652548, 665, 12037652552, 665, 2, 1, 0, 0, 12037652548, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652567, 665, 1, 12037652645, 665, 12037652567, 665, 2, 0, 1, 0, 12037652549, 665, 12037652551, 665, 1, 2, 0, 0, 12037652549, 665, 12037652551, 665, 2, 1, 0, 0, 12037652549, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652566, 665, 1, 12037652646, 665, 12037652566, 665, 2, 0, 1, 0, 12037652550, 665, 12037652550, 665, 1, 2, 0, 0, 12037652550, 665, 12037652550, 665, 2, 1, 0, 0, 12037652550, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652565, 665, 1, 12037652647, 665, 12037652565, 665, 2, 0, 1, 0, 12037652551, 665, 12037652549, 665, 1, 2, 0, 0, 12037652551, 665, 12037652549, 665, 2, 1, 0, 0, 12037652551, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652564, 665, 1, 12037652648, 665, 12037652564, 665, 2, 0, 1, 0, 12037652552, 665, 12037652548, 665, 1, 2, 0, 0, 12037652552, 665, 12037652548, 665, 2, 1, 0, 0, 12037652552, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652563, 665, 1, 12037652649, 665, 12037652563, 665, 2, 0, 1, 0, 12037652553, 665, 12037652547, 665, 1, 2, 0, 0, 12037652553, 665, 12037652547, 665, 2, 1, 0, 0, 12037652553, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 0, 4, 2, 796, 0, 262140ULL, 0, 12037652644, 665, 12037652569, 665, 1, 12037652644, 665, 12037652569, 665, 2, 0, 1, 0, 12037652548, 665, 12037652553, 665, 1, 2, 0, 0, 12037652548, 665, 12037652553, 665, 2, 1, 0, 0, 12037652548, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652645, 665, 12037652568, 665, 1, 12037652645, 665, 12037652568, 665, 2, 0, 1, 0, 12037652549, 665, 12037652552, 665, 1, 2, 0, 0, 12037652549, 665, 12037652552, 665, 2, 1, 0, 0, 12037652549, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652567, 665, 1, 12037652646, 665, 12037652567, 665, 2, 0, 1, 0, 12037652550, 665, 12037652551, 665, 1, 2, 0, 0, 12037652550, 665, 12037652551, 665, 2, 1, 0, 0, 12037652550, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652566, 665, 1, 12037652647, 665, 12037652566, 665, 2, 0, 1, 0, 12037652551, 665, 12037652550, 665, 1, 2, 0, 0, 12037652551, 665, 12037652550, 665, 2, 1, 0, 0, 12037652551, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652565, 665, 1, 12037652648, 665, 12037652565, 665, 2, 0, 1, 0, 12037652552, 665, 12037652549, 665, 1, 2, 0, 0, 12037652552, 665, 12037652549, 665, 2, 1, 0, 0, 12037652552, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652564, 665, 1, 12037652649, 665, 12037652564, 665, 2, 0, 1, 0, 12037652553, 665, 12037652548, 665, 1, 2, 0, 0, 12037652553, 665, 12037652548, 665, 2, 1, 0, 0, 12037652553, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 0, 3, 2, 797, 0, 262140ULL, 0, 12037652645, 665, 12037652569, 665, 1, 12037652645, 665, 12037652569, 665, 2, 0, 1, 0, 12037652549, 665, 12037652553, 665, 1, 2, 0, 0, 12037652549, 665, 12037652553, 665, 2, 1, 0, 0, 12037652549, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652646, 665, 12037652568, 665, 1, 12037652646, 665, 12037652568, 665, 2, 0, 1, 0, 12037652550, 665, 12037652552, 665, 1, 2, 0, 0, 12037652550, 665, 12037652552, 665, 2, 1, 0, 0, 12037652550, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652567, 665, 1, 12037652647, 665, 12037652567, 665, 2, 0, 1, 0, 12037652551, 665, 12037652551, 665, 1, 2, 0, 0, 12037652551, 665, 12037652551, 665, 2, 1, 0, 0, 12037652551, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652566, 665, 1, 12037652648, 665, 12037652566, 665, 2, 0, 1, 0, 12037652552, 665, 12037652550, 665, 1, 2, 0, 0, 12037652552, 665, 12037652550, 665, 2, 1, 0, 0, 12037652552, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652565, 665, 1, 12037652649, 665, 12037652565, 665, 2, 0, 1, 0, 12037652553, 665, 12037652549, 665, 1, 2, 0, 0, 12037652553, 665, 12037652549, 665, 2, 1, 0, 0, 12037652553, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 0, 4, 2, 798, 0, 262140ULL, 0, 12037652646, 665, 12037652569, 665, 1, 12037652646, 665, 12037652569, 665, 2, 0, 1, 0, 12037652550, 665, 12037652553, 665, 1, 2, 0, 0, 12037652550, 665, 12037652553, 665, 2, 1, 0, 0, 12037652550, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652647, 665, 12037652568, 665, 1, 12037652647, 665, 12037652568, 665, 2, 0, 1, 0, 12037652551, 665, 12037652552, 665, 1, 2, 0, 0, 12037652551, 665, 12037652552, 665, 2, 1, 0, 0, 12037652551, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652567, 665, 1, 12037652648, 665, 12037652567, 665, 2, 0, 1, 0, 12037652552, 665, 12037652551, 665, 1, 2, 0, 0, 12037652552, 665, 12037652551, 665, 2, 1, 0, 0, 12037652552, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652566, 665, 1, 12037652649, 665, 12037652566, 665, 2, 0, 1, 0, 12037652553, 665, 12037652550, 665, 1, 2, 0, 0, 12037652553, 665, 12037652550, 665, 2, 1, 0, 0, 12037652553, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 0, 3, 2, 799, 0, 262140ULL, 0, 12037652647, 665, 12037652569, 665, 1, 12037652647, 665, 12037652569, 665, 2, 0, 1, 0, 12037652551, 665, 12037652553, 665, 1, 2, 0, 0, 12037652551, 665, 12037652553, 665, 2, 1, 0, 0, 12037652551, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652648, 665, 12037652568, 665, 1, 12037652648, 665, 12037652568, 665, 2, 0, 1, 0, 12037652552, 665, 12037652552, 665, 1, 2, 0, 0, 12037652552, 665, 12037652552, 665, 2, 1, 0, 0, 12037652552, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652567, 665, 1, 12037652649, 665, 12037652567, 665, 2, 0, 1, 0, 12037652553, 665, 12037652551, 665, 1, 2, 0, 0, 12037652553, 665, 12037652551, 665, 2, 1, 0, 0, 12037652553, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 0, 4, 2, 800, 0, 262140ULL, 0, 12037652648, 665, 12037652569, 665, 1, 12037652648, 665, 12037652569, 665, 2, 0, 1, 0, 12037652552, 665, 12037652553, 665, 1, 2, 0, 0, 12037652552, 665, 12037652553, 665, 2, 1, 0, 0, 12037652552, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652649, 665, 12037652568, 665, 1, 12037652649, 665, 12037652568, 665, 2, 0, 1, 0, 12037652553, 665, 12037652552, 665, 1, 2, 0, 0, 12037652553, 665, 12037652552, 665, 2, 1, 0, 0, 12037652553, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 0, 3, 2, 801, 0, 262140ULL, 0, 12037652649, 665, 12037652569, 665, 1, 12037652649, 665, 12037652569, 665, 2, 0, 1, 0, 12037652553, 665, 12037652553, 665, 1, 2, 0, 0, 12037652553, 665, 12037652553, 665, 2, 1, 0, 0, 12037652553, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 2, 1, 0, 802, 2, 262140ULL, 803, 18446744069414322181ULL, 0, 12037652634, 665, 12037652634, 665, 1, 64559ULL, 12037652666, 665, 2, 0, 1, 0, 2, 12037652538, 665, 1, 0, 12037652570, 665, 804, 1, 12037652602, 665, 0, 12037652634, 665, 12037652635, 665, 1, 64559ULL, 12037652667, 665, 2, 0, 1, 0, 12037652635, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 3, 0, 1, 0, 2, 3, 1, 0, 12037652539, 665, 0, 1, 12037652571, 665, 805, 0, 12037652603, 665, 0, 12037652634, 665, 12037652636, 665, 1, 64559ULL, 12037652668, 665, 2, 0, 1, 0, 12037652635, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652634, 665, 1, 65534ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652540, 665, 0, 1, 12037652572, 665, 806, 0, 12037652604, 665, 0, 12037652634, 665, 12037652637, 665, 1, 64559ULL, 12037652669, 665, 2, 0, 1, 0, 12037652635, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652635, 665, 1, 65534ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652541, 665, 0, 1, 12037652573, 665, 807, 0, 12037652605, 665, 0, 12037652634, 665, 12037652638, 665, 1, 64559ULL, 12037652670, 665, 2, 0, 1, 0, 12037652635, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652636, 665, 1, 65534ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652542, 665, 0, 1, 12037652574, 665, 808, 0, 12037652606, 665, 0, 12037652634, 665, 12037652639, 665, 1, 64559ULL, 12037652671, 665, 2, 0, 1, 0, 12037652635, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652637, 665, 1, 65534ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652543, 665, 0, 1, 12037652575, 665, 809, 0, 12037652607, 665, 0, 12037652634, 665, 12037652640, 665, 1, 64559ULL, 12037652672, 665, 2, 0, 1, 0, 12037652635, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652638, 665, 1, 65534ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652544, 665, 0, 1, 12037652576, 665, 810, 0, 12037652608, 665, 0, 12037652634, 665, 12037652641, 665, 1, 64559ULL, 12037652673, 665, 2, 0, 1, 0, 12037652635, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652639, 665, 1, 65534ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652545, 665, 0, 1, 12037652577, 665, 811, 0, 12037652609, 665, 0, 12037652634, 665, 12037652642, 665, 1, 64559ULL, 12037652674, 665, 2, 0, 1, 0, 12037652635, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652640, 665, 1, 65534ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652546, 665, 0, 1, 12037652578, 665, 812, 0, 12037652610, 665, 0, 12037652634, 665, 12037652643, 665, 1, 64559ULL, 12037652675, 665, 2, 0, 1, 0, 12037652635, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652641, 665, 1, 65534ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652547, 665, 0, 1, 12037652579, 665, 813, 0, 12037652611, 665, 0, 12037652634, 665, 12037652644, 665, 1, 64559ULL, 12037652676, 665, 2, 0, 1, 0, 12037652635, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652642, 665, 1, 65534ULL, 12037652674, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652548, 665, 0, 1, 12037652580, 665, 814, 0, 12037652612, 665, 0, 12037652634, 665, 12037652645, 665, 1, 64559ULL, 12037652677, 665, 2, 0, 1, 0, 12037652635, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652643, 665, 1, 65534ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652549, 665, 0, 1, 12037652581, 665, 815, 0, 12037652613, 665, 0, 12037652634, 665, 12037652646, 665, 1, 64559ULL, 12037652678, 665, 2, 0, 1, 0, 12037652635, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652644, 665, 1, 65534ULL, 12037652676, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652550, 665, 0, 1, 12037652582, 665, 816, 0, 12037652614, 665, 0, 12037652634, 665, 12037652647, 665, 1, 64559ULL, 12037652679, 665, 2, 0, 1, 0, 12037652635, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652645, 665, 1, 65534ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652551, 665, 0, 1, 12037652583, 665, 817, 0, 12037652615, 665, 0, 12037652634, 665, 12037652648, 665, 1, 64559ULL, 12037652680, 665, 2, 0, 1, 0, 12037652635, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652646, 665, 1, 65534ULL, 12037652678, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652552, 665, 0, 1, 12037652584, 665, 818, 0, 12037652616, 665, 0, 12037652634, 665, 12037652649, 665, 1, 64559ULL, 12037652681, 665, 2, 0, 1, 0, 12037652635, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652647, 665, 1, 65534ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652553, 665, 0, 1, 12037652585, 665, 819, 0, 12037652617, 665, 0, 12037652635, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652636, 665, 12037652648, 665, 1, 65534ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652637, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652638, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652639, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652640, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652641, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652642, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652643, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 0, 4, 2, 820, 0, 258236ULL, 0, 12037652636, 665, 12037652649, 665, 1, 65534ULL, 12037652681, 665, 2, 0, 1, 0, 12037652637, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652638, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 0, 3, 2, 821, 0, 262140ULL, 0, 12037652637, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652638, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652639, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652640, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652641, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652642, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652643, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 0, 4, 2, 822, 0, 262136ULL, 0, 12037652638, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652639, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652640, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 0, 3, 2, 823, 0, 262140ULL, 0, 12037652639, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652640, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652641, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652642, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652643, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 0, 4, 2, 824, 0, 262140ULL, 0, 12037652640, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652641, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652642, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 0, 3, 2, 825, 0, 262140ULL, 0, 12037652641, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652642, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652643, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 0, 4, 2, 826, 0, 262140ULL, 0, 12037652642, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652643, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652644, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 0, 3, 2, 827, 0, 262140ULL, 0, 12037652643, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652644, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652645, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 0, 4, 2, 828, 0, 262140ULL, 0, 12037652644, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652645, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652646, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 0, 3, 2, 829, 0, 262140ULL, 0, 12037652645, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652646, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652647, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 0, 4, 2, 830, 0, 262140ULL, 0, 12037652646, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652647, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652648, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 0, 3, 2, 831, 0, 262140ULL, 0, 12037652647, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652648, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652649, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 0, 4, 2, 832, 0, 262140ULL, 0, 12037652648, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652649, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 0, 2, 3, 833, 0, 262140ULL, 0, 12037652649, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 834, 2, 262140ULL, 835, 18446744069414322181ULL, 0, 12037652634, 665, 12037652538, 665, 1, 12037652634, 665, 12037652602, 665, 2, 0, 1, 0, 64559ULL, 12037652682, 665, 1, 2, 0, 0, 1, 12037652554, 665, 836, 0, 12037652618, 665, 0, 12037652634, 665, 12037652539, 665, 1, 12037652634, 665, 12037652603, 665, 2, 0, 1, 0, 64559ULL, 12037652683, 665, 3, 2, 0, 0, 12037652635, 665, 12037652538, 665, 1, 12037652635, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652555, 665, 837, 1, 12037652619, 665, 0, 12037652634, 665, 12037652540, 665, 1, 12037652634, 665, 12037652604, 665, 2, 0, 1, 0, 64559ULL, 12037652684, 665, 3, 2, 0, 0, 12037652635, 665, 12037652539, 665, 1, 12037652635, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652538, 665, 1, 12037652636, 665, 12037652602, 665, 2, 0, 1, 0, 65534ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652556, 665, 838, 1, 12037652620, 665, 0, 12037652634, 665, 12037652541, 665, 1, 12037652634, 665, 12037652605, 665, 2, 0, 1, 0, 64559ULL, 12037652685, 665, 3, 2, 0, 0, 12037652635, 665, 12037652540, 665, 1, 12037652635, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652539, 665, 1, 12037652636, 665, 12037652603, 665, 2, 0, 1, 0, 65534ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652538, 665, 1, 12037652637, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652557, 665, 839, 1, 12037652621, 665, 0, 12037652634, 665, 12037652542, 665, 1, 12037652634, 665, 12037652606, 665, 2, 0, 1, 0, 64559ULL, 12037652686, 665, 3, 2, 0, 0, 12037652635, 665, 12037652541, 665, 1, 12037652635, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652540, 665, 1, 12037652636, 665, 12037652604, 665, 2, 0, 1, 0, 65534ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652539, 665, 1, 12037652637, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652538, 665, 1, 12037652638, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652558, 665, 840, 1, 12037652622, 665, 0, 12037652634, 665, 12037652543, 665, 1, 12037652634, 665, 12037652607, 665, 2, 0, 1, 0, 64559ULL, 12037652687, 665, 3, 2, 0, 0, 12037652635, 665, 12037652542, 665, 1, 12037652635, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652541, 665, 1, 12037652636, 665, 12037652605, 665, 2, 0, 1, 0, 65534ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652540, 665, 1, 12037652637, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652539, 665, 1, 12037652638, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652538, 665, 1, 12037652639, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652559, 665, 841, 1, 12037652623, 665, 0, 12037652634, 665, 12037652544, 665, 1, 12037652634, 665, 12037652608, 665, 2, 0, 1, 0, 64559ULL, 12037652688, 665, 3, 2, 0, 0, 12037652635, 665, 12037652543, 665, 1, 12037652635, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652542, 665, 1, 12037652636, 665, 12037652606, 665, 2, 0, 1, 0, 65534ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652541, 665, 1, 12037652637, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652540, 665, 1, 12037652638, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652539, 665, 1, 12037652639, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652538, 665, 1, 12037652640, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652560, 665, 842, 1, 12037652624, 665, 0, 12037652634, 665, 12037652545, 665, 1, 12037652634, 665, 12037652609, 665, 2, 0, 1, 0, 64559ULL, 12037652689, 665, 3, 2, 0, 0, 12037652635, 665, 12037652544, 665, 1, 12037652635, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652543, 665, 1, 12037652636, 665, 12037652607, 665, 2, 0, 1, 0, 65534ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652542, 665, 1, 12037652637, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652541, 665, 1, 12037652638, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652540, 665, 1, 12037652639, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652539, 665, 1, 12037652640, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652538, 665, 1, 12037652641, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652561, 665, 843, 1, 12037652625, 665, 0, 12037652634, 665, 12037652546, 665, 1, 12037652634, 665, 12037652610, 665, 2, 0, 1, 0, 64559ULL, 12037652690, 665, 3, 2, 0, 0, 12037652635, 665, 12037652545, 665, 1, 12037652635, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652544, 665, 1, 12037652636, 665, 12037652608, 665, 2, 0, 1, 0, 65534ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652543, 665, 1, 12037652637, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652542, 665, 1, 12037652638, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652541, 665, 1, 12037652639, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652540, 665, 1, 12037652640, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652539, 665, 1, 12037652641, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652538, 665, 1, 12037652642, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652562, 665, 844, 1, 12037652626, 665, 0, 12037652634, 665, 12037652547, 665, 1, 12037652634, 665, 12037652611, 665, 2, 0, 1, 0, 64559ULL, 12037652691, 665, 3, 2, 0, 0, 12037652635, 665, 12037652546, 665, 1, 12037652635, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652545, 665, 1, 12037652636, 665, 12037652609, 665, 2, 0, 1, 0, 65534ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652544, 665, 1, 12037652637, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652543, 665, 1, 12037652638, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652542, 665, 1, 12037652639, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652541, 665, 1, 12037652640, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652540, 665, 1, 12037652641, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652539, 665, 1, 12037652642, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652538, 665, 1, 12037652643, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652563, 665, 845, 1, 12037652627, 665, 0, 12037652634, 665, 12037652548, 665, 1, 12037652634, 665, 12037652612, 665, 2, 0, 1, 0, 64559ULL, 12037652692, 665, 3, 2, 0, 0, 12037652635, 665, 12037652547, 665, 1, 12037652635, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652546, 665, 1, 12037652636, 665, 12037652610, 665, 2, 0, 1, 0, 65534ULL, 12037652690, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652545, 665, 1, 12037652637, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652544, 665, 1, 12037652638, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652543, 665, 1, 12037652639, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652542, 665, 1, 12037652640, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652541, 665, 1, 12037652641, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652540, 665, 1, 12037652642, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652539, 665, 1, 12037652643, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652538, 665, 1, 12037652644, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652564, 665, 846, 1, 12037652628, 665, 0, 12037652634, 665, 12037652549, 665, 1, 12037652634, 665, 12037652613, 665, 2, 0, 1, 0, 64559ULL, 12037652693, 665, 3, 2, 0, 0, 12037652635, 665, 12037652548, 665, 1, 12037652635, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652547, 665, 1, 12037652636, 665, 12037652611, 665, 2, 0, 1, 0, 65534ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652546, 665, 1, 12037652637, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652545, 665, 1, 12037652638, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652544, 665, 1, 12037652639, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652543, 665, 1, 12037652640, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652542, 665, 1, 12037652641, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652541, 665, 1, 12037652642, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652540, 665, 1, 12037652643, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652539, 665, 1, 12037652644, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652538, 665, 1, 12037652645, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652565, 665, 847, 1, 12037652629, 665, 0, 12037652634, 665, 12037652550, 665, 1, 12037652634, 665, 12037652614, 665, 2, 0, 1, 0, 64559ULL, 12037652694, 665, 3, 2, 0, 0, 12037652635, 665, 12037652549, 665, 1, 12037652635, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652548, 665, 1, 12037652636, 665, 12037652612, 665, 2, 0, 1, 0, 65534ULL, 12037652692, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652547, 665, 1, 12037652637, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652546, 665, 1, 12037652638, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652545, 665, 1, 12037652639, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652544, 665, 1, 12037652640, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652543, 665, 1, 12037652641, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652542, 665, 1, 12037652642, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652541, 665, 1, 12037652643, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652540, 665, 1, 12037652644, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652539, 665, 1, 12037652645, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652538, 665, 1, 12037652646, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652566, 665, 848, 1, 12037652630, 665, 0, 12037652634, 665, 12037652551, 665, 1, 12037652634, 665, 12037652615, 665, 2, 0, 1, 0, 64559ULL, 12037652695, 665, 3, 2, 0, 0, 12037652635, 665, 12037652550, 665, 1, 12037652635, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652549, 665, 1, 12037652636, 665, 12037652613, 665, 2, 0, 1, 0, 65534ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652548, 665, 1, 12037652637, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652547, 665, 1, 12037652638, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652546, 665, 1, 12037652639, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652545, 665, 1, 12037652640, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652544, 665, 1, 12037652641, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652543, 665, 1, 12037652642, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652542, 665, 1, 12037652643, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652541, 665, 1, 12037652644, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652540, 665, 1, 12037652645, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652539, 665, 1, 12037652646, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652538, 665, 1, 12037652647, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652567, 665, 849, 1, 12037652631, 665, 0, 12037652634, 665, 12037652552, 665, 1, 12037652634, 665, 12037652616, 665, 2, 0, 1, 0, 64559ULL, 12037652696, 665, 3, 2, 0, 0, 12037652635, 665, 12037652551, 665, 1, 12037652635, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652550, 665, 1, 12037652636, 665, 12037652614, 665, 2, 0, 1, 0, 65534ULL, 12037652694, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652549, 665, 1, 12037652637, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652548, 665, 1, 12037652638, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652547, 665, 1, 12037652639, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652546, 665, 1, 12037652640, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652545, 665, 1, 12037652641, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652544, 665, 1, 12037652642, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652543, 665, 1, 12037652643, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652542, 665, 1, 12037652644, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652541, 665, 1, 12037652645, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652540, 665, 1, 12037652646, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652539, 665, 1, 12037652647, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652538, 665, 1, 12037652648, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652568, 665, 850, 1, 12037652632, 665, 0, 12037652634, 665, 12037652553, 665, 1, 12037652634, 665, 12037652617, 665, 2, 0, 1, 0, 64559ULL, 12037652697, 665, 3, 2, 0, 0, 12037652635, 665, 12037652552, 665, 1, 12037652635, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652551, 665, 1, 12037652636, 665, 12037652615, 665, 2, 0, 1, 0, 65534ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652550, 665, 1, 12037652637, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652549, 665, 1, 12037652638, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652548, 665, 1, 12037652639, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652547, 665, 1, 12037652640, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652546, 665, 1, 12037652641, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652545, 665, 1, 12037652642, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652544, 665, 1, 12037652643, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652543, 665, 1, 12037652644, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652542, 665, 1, 12037652645, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652541, 665, 1, 12037652646, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652540, 665, 1, 12037652647, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652539, 665, 1, 12037652648, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652538, 665, 1, 12037652649, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652569, 665, 851, 1, 12037652633, 665, 0, 12037652635, 665, 12037652553, 665, 1, 12037652635, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652636, 665, 12037652552, 665, 1, 12037652636, 665, 12037652616, 665, 2, 0, 1, 0, 65534ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652637, 665, 12037652551, 665, 1, 12037652637, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652638, 665, 12037652550, 665, 1, 12037652638, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652549, 665, 1, 12037652639, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652548, 665, 1, 12037652640, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652547, 665, 1, 12037652641, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652546, 665, 1, 12037652642, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652545, 665, 1, 12037652643, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652544, 665, 1, 12037652644, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652543, 665, 1, 12037652645, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652542, 665, 1, 12037652646, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652541, 665, 1, 12037652647, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652540, 665, 1, 12037652648, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652539, 665, 1, 12037652649, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 0, 4, 1, 852, 0, 258236ULL, 0, 12037652636, 665, 12037652553, 665, 1, 12037652636, 665, 12037652617, 665, 2, 0, 1, 0, 65534ULL, 12037652697, 665, 3, 2, 0, 0, 12037652637, 665, 12037652552, 665, 1, 12037652637, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652551, 665, 1, 12037652638, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652550, 665, 1, 12037652639, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652549, 665, 1, 12037652640, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652548, 665, 1, 12037652641, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652547, 665, 1, 12037652642, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652546, 665, 1, 12037652643, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652545, 665, 1, 12037652644, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652544, 665, 1, 12037652645, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652543, 665, 1, 12037652646, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652542, 665, 1, 12037652647, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652541, 665, 1, 12037652648, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652540, 665, 1, 12037652649, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 0, 3, 1, 853, 0, 262140ULL, 0, 12037652637, 665, 12037652553, 665, 1, 12037652637, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652638, 665, 12037652552, 665, 1, 12037652638, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652551, 665, 1, 12037652639, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652550, 665, 1, 12037652640, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652549, 665, 1, 12037652641, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652548, 665, 1, 12037652642, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652547, 665, 1, 12037652643, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652546, 665, 1, 12037652644, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652545, 665, 1, 12037652645, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652544, 665, 1, 12037652646, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652543, 665, 1, 12037652647, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652542, 665, 1, 12037652648, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652541, 665, 1, 12037652649, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 0, 4, 1, 854, 0, 262136ULL, 0, 12037652638, 665, 12037652553, 665, 1, 12037652638, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652639, 665, 12037652552, 665, 1, 12037652639, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652551, 665, 1, 12037652640, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652550, 665, 1, 12037652641, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652549, 665, 1, 12037652642, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652548, 665, 1, 12037652643, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652547, 665, 1, 12037652644, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652546, 665, 1, 12037652645, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652545, 665, 1, 12037652646, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652544, 665, 1, 12037652647, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652543, 665, 1, 12037652648, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652542, 665, 1, 12037652649, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 0, 3, 1, 855, 0, 262140ULL, 0, 12037652639, 665, 12037652553, 665, 1, 12037652639, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652640, 665, 12037652552, 665, 1, 12037652640, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652551, 665, 1, 12037652641, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652550, 665, 1, 12037652642, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652549, 665, 1, 12037652643, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652548, 665, 1, 12037652644, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652547, 665, 1, 12037652645, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652546, 665, 1, 12037652646, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652545, 665, 1, 12037652647, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652544, 665, 1, 12037652648, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652543, 665, 1, 12037652649, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 0, 4, 1, 856, 0, 262140ULL, 0, 12037652640, 665, 12037652553, 665, 1, 12037652640, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652641, 665, 12037652552, 665, 1, 12037652641, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652551, 665, 1, 12037652642, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652550, 665, 1, 12037652643, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652549, 665, 1, 12037652644, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652548, 665, 1, 12037652645, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652547, 665, 1, 12037652646, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652546, 665, 1, 12037652647, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652545, 665, 1, 12037652648, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652544, 665, 1, 12037652649, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 0, 3, 1, 857, 0, 262140ULL, 0, 12037652641, 665, 12037652553, 665, 1, 12037652641, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652642, 665, 12037652552, 665, 1, 12037652642, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652551, 665, 1, 12037652643, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652550, 665, 1, 12037652644, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652549, 665, 1, 12037652645, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652548, 665, 1, 12037652646, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652547, 665, 1, 12037652647, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652546, 665, 1, 12037652648, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652545, 665, 1, 12037652649, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 0, 4, 1, 858, 0, 262140ULL, 0, 12037652642, 665, 12037652553, 665, 1, 12037652642, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652643, 665, 12037652552, 665, 1, 12037652643, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652551, 665, 1, 12037652644, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652550, 665, 1, 12037652645, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652549, 665, 1, 12037652646, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652548, 665, 1, 12037652647, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652547, 665, 1, 12037652648, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652546, 665, 1, 12037652649, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 0, 3, 1, 859, 0, 262140ULL, 0, 12037652643, 665, 12037652553, 665, 1, 12037652643, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652644, 665, 12037652552, 665, 1, 12037652644, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652551, 665, 1, 12037652645, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652550, 665, 1, 12037652646, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652549, 665, 1, 12037652647, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652548, 665, 1, 12037652648, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652547, 665, 1, 12037652649, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 0, 4, 1, 860, 0, 262140ULL, 0, 12037652644, 665, 12037652553, 665, 1, 12037652644, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652645, 665, 12037652552, 665, 1, 12037652645, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652551, 665, 1, 12037652646, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652550, 665, 1, 12037652647, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652549, 665, 1, 12037652648, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652548, 665, 1, 12037652649, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 0, 3, 1, 861, 0, 262140ULL, 0, 12037652645, 665, 12037652553, 665, 1, 12037652645, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652646, 665, 12037652552, 665, 1, 12037652646, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652551, 665, 1, 12037652647, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652550, 665, 1, 12037652648, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652549, 665, 1, 12037652649, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 0, 4, 1, 862, 0, 262140ULL, 0, 12037652646, 665, 12037652553, 665, 1, 12037652646, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652647, 665, 12037652552, 665, 1, 12037652647, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652551, 665, 1, 12037652648, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652550, 665, 1, 12037652649, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 0, 3, 1, 863, 0, 262140ULL, 0, 12037652647, 665, 12037652553, 665, 1, 12037652647, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652648, 665, 12037652552, 665, 1, 12037652648, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652551, 665, 1, 12037652649, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 0, 4, 1, 864, 0, 262140ULL, 0, 12037652648, 665, 12037652553, 665, 1, 12037652648, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652649, 665, 12037652552, 665, 1, 12037652649, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 0, 3, 1, 865, 0, 262140ULL, 0, 12037652649, 665, 12037652553, 665, 1, 12037652649, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 1, 2, 0, 866, 1, 262140ULL, 867, 18446744069414322181ULL, 868, 12037652747, 665, 126, 869, 25341984776, 371, 25341984776, 371, 870, 12037652748, 665, 127, 871, 25341984778, 371, 25341984778, 371, 872, 12037652749, 665, 128, 873, 25341984780, 371, 25341984780, 371, 874, 12037652750, 665, 129, 875, 25341984782, 371, 25341984782, 371, 876, 12037652751, 665, 130, 877, 25341984784, 371, 25341984784, 371, 878, 12037652752, 665, 131, 879, 25341984786, 371, 25341984786, 371, 880, 12037652753, 665, 132, 881, 25341984788, 371, 25341984788, 371, 882, 12037652754, 665, 133, 883, 25341984790, 371, 25341984790, 371, 884, 12037652755, 665, 134, 885, 25341984792, 371, 25341984792, 371, 886, 12037652756, 665, 135, 887, 25341984794, 371, 25341984794, 371, 888, 12037652757, 665, 136, 889, 25341984796, 371, 25341984796, 371, 890, 12037652758, 665, 137, 891, 25341984798, 371, 25341984798, 371, 0, 25341984777, 371, 868, 892, 0, 2, 25341984779, 371, 870, 0, 870, 2, 1, 125, 0, 893, 1, 2, 2, 25341984781, 371, 872, 0, 872, 2, 1, 125, 0, 894, 1, 2, 2, 25341984783, 371, 874, 0, 874, 2, 1, 125, 0, 895, 1, 2, 2, 25341984785, 371, 876, 0, 876, 2, 1, 125, 0, 896, 1, 2, 2, 25341984787, 371, 878, 0, 878, 2, 1, 125, 0, 897, 1, 2, 2, 25341984789, 371, 880, 0, 880, 2, 1, 125, 0, 898, 1, 2, 2, 25341984791, 371, 882, 0, 882, 2, 1, 125, 0, 899, 1, 2, 2, 25341984793, 371, 884, 0, 884, 2, 1, 125, 0, 900, 1, 2, 2, 25341984795, 371, 886, 0, 886, 2, 1, 125, 0, 901, 1, 2, 2, 25341984797, 371, 888, 0, 888, 2, 1, 125, 0, 902, 1, 2, 2, 25341984799, 371, 890, 0, 890, 2, 1, 125, 0, 903, 1, 2, 0, 2ULL, 12037652909, 665, 1, 0, 12037652908, 665, 0, 12037652909, 665, 1, 1, 12037652911, 665, 0, 906, 1, 12037652908, 665, 908, 12037652959, 2, 16777216, 665, 12037652960, 2, 16777216, 665, 0, 12037653079, 665, 12037653009, 665, 1, 12037653080, 665, 12037653023, 665, 2, 0, 1, 3, 2, 12037653075, 665, 0, 12037653081, 665, 12037653018, 665, 1, 262144ULL, 0, 0, 65536ULL, 12037653077, 665, 2, 1, 0, 0, 12037653077, 665, 12037653019, 665, 1, 2, 0, 0, 131072ULL, 12037653078, 665, 2, 1, 0, 910, 2, 3, 914, 101, 101, 102, 102, 103, 103, 104, 104, 105, 105, 106, 106, 107, 107, 108, 108, 12037652785, 665, 915, 12037652786, 665, 916, 12037652787, 665, 917, 12037652788, 665, 918, 12037652781, 665, 919, 12037652782, 665, 920, 12037652783, 665, 921, 12037652784, 665, 0, 12037652747, 665, 1, 12037652748, 665, 2, 12037652749, 665, 3, 12037652750, 665, 4, 12037652751, 665, 5, 12037652752, 665, 6, 12037652753, 665, 7, 12037652754, 665, 8, 12037652755, 665, 9, 12037652756, 665, 10, 12037652757, 665, 11, 12037652758, 665, 12, 12037652759, 665, 13, 12037652760, 665, 14, 12037652761, 665, 15, 12037652762, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 115, 1, 1, 922, 146, 0, 12037652957, 2, 16777216, 665, 12037652957, 665, 1, 12037652958, 2, 16777216, 665, 12037652958, 665, 2, 0, 1, 0, 12037652969, 665, 2, 1, 12037652958, 2, 16777216, 665, 12037652958, 665, 923, 0, 1, 924, 109, 109, 910, 926, 12037653024, 665, 0, 12037653001, 665, 12037653093, 665, 927, 0, 12037653094, 665, 928, 909, 929, 113, 930, 114, 931, 115, 932, 116, 933, 117, 934, 118, 935, 119, 2, 12037652922, 665, 0, 12037652928, 665, 12037652923, 665, 1, 0, 12037652939, 665, 0, 1, 1ULL, 1, 12037652939, 665, 3, 25341984827, 371, 4, 25341984828, 371, 5, 25341984829, 371, 6, 25341984830, 371, 7, 25341984831, 371, 8, 25341984832, 371, 9, 25341984833, 371, 10, 25341984834, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984842, 371, 0, 147, 1, 1, 936, 12037653093, 665, 12037653094, 665, 937, 910, 938, 12037653024, 665, 0, 12037653001, 665, 12037653097, 665, 939, 0, 12037653098, 665, 940, 909, 941, 113, 942, 114, 943, 115, 944, 116, 945, 117, 946, 118, 947, 119, 2, 12037652775, 665, 0, 12037652790, 665, 12037652776, 665, 1, 0, 12037652792, 665, 0, 1, 1ULL, 1, 12037652792, 665, 3, 25341984814, 371, 4, 25341984815, 371, 5, 25341984816, 371, 6, 25341984817, 371, 7, 25341984818, 371, 8, 25341984819, 371, 9, 25341984820, 371, 10, 25341984821, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984843, 371, 0, 149, 1, 1, 948, 12037653097, 665, 12037653098, 665, 0, 12037652481, 665, 1, 12037652480, 665, 0, 0, 0, 99, 1, 0, 0, 3, 1, 2, 0, 0, 0, 101, 1, 0, 0, 3, 2, 16777216, 1, 2, 2, 16777216, 0, 0, 0, 100, 1, 0, 0, 46, 1, 12037652534, 2, 16777216, 665, 2, 12037652483, 2, 16777216, 665, 3, 12037652484, 2, 16777216, 665, 4, 12037652525, 665, 5, 12037652482, 665, 6, 12037652526, 665, 7, 12037652527, 665, 8, 12037652528, 665, 9, 12037652529, 665, 10, 12037652530, 665, 11, 12037652531, 665, 12, 12037652532, 665, 13, 12037652533, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 102, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 104, 13, 0, 0, 46, 2, 16777216, 1, 103, 2, 16777216, 2, 101, 2, 16777216, 3, 102, 2, 16777216, 4, 104, 2, 16777216, 5, 84, 2, 16777216, 6, 93, 2, 16777216, 7, 94, 2, 16777216, 8, 95, 2, 16777216, 9, 96, 2, 16777216, 10, 97, 2, 16777216, 11, 98, 2, 16777216, 12, 99, 2, 16777216, 13, 100, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 103, 13, 0, 0, 12037652538, 665, 5, 1, 12037652539, 665, 6, 2, 0, 1, 0, 12037652540, 665, 7, 1, 2, 0, 0, 12037652541, 665, 8, 2, 1, 0, 0, 12037652542, 665, 9, 1, 2, 0, 0, 12037652543, 665, 10, 2, 1, 0, 0, 12037652544, 665, 11, 1, 2, 0, 0, 12037652545, 665, 12, 2, 1, 0, 0, 12037652546, 665, 13, 1, 2, 0, 0, 12037652547, 665, 14, 2, 1, 0, 0, 12037652548, 665, 15, 1, 2, 0, 0, 12037652549, 665, 16, 2, 1, 0, 0, 12037652550, 665, 17, 1, 2, 0, 0, 12037652551, 665, 18, 2, 1, 0, 0, 12037652552, 665, 19, 1, 2, 0, 0, 12037652553, 665, 20, 2, 1, 0, 0, 12037652554, 665, 21, 1, 2, 0, 0, 12037652555, 665, 22, 2, 1, 0, 0, 12037652556, 665, 23, 1, 2, 0, 0, 12037652557, 665, 24, 2, 1, 0, 0, 12037652558, 665, 25, 1, 2, 0, 0, 12037652559, 665, 26, 2, 1, 0, 0, 12037652560, 665, 27, 1, 2, 0, 0, 12037652561, 665, 28, 2, 1, 0, 0, 12037652562, 665, 29, 1, 2, 0, 0, 12037652563, 665, 30, 2, 1, 0, 0, 12037652564, 665, 31, 1, 2, 0, 0, 12037652565, 665, 32, 2, 1, 0, 0, 12037652566, 665, 33, 1, 2, 0, 0, 12037652567, 665, 34, 2, 1, 0, 0, 12037652568, 665, 35, 1, 2, 0, 0, 12037652569, 665, 36, 2, 1, 0, 949, 2, 0, 4, 951, 0, 0, 4, 2, 16777216, 950, 0, 0, 12037652570, 665, 5, 1, 12037652571, 665, 6, 2, 0, 1, 0, 12037652572, 665, 7, 1, 2, 0, 0, 12037652573, 665, 8, 2, 1, 0, 0, 12037652574, 665, 9, 1, 2, 0, 0, 12037652575, 665, 10, 2, 1, 0, 0, 12037652576, 665, 11, 1, 2, 0, 0, 12037652577, 665, 12, 2, 1, 0, 0, 12037652578, 665, 13, 1, 2, 0, 0, 12037652579, 665, 14, 2, 1, 0, 0, 12037652580, 665, 15, 1, 2, 0, 0, 12037652581, 665, 16, 2, 1, 0, 0, 12037652582, 665, 17, 1, 2, 0, 0, 12037652583, 665, 18, 2, 1, 0, 0, 12037652584, 665, 19, 1, 2, 0, 0, 12037652585, 665, 20, 2, 1, 0, 0, 12037652586, 665, 21, 1, 2, 0, 0, 12037652587, 665, 22, 2, 1, 0, 0, 12037652588, 665, 23, 1, 2, 0, 0, 12037652589, 665, 24, 2, 1, 0, 0, 12037652590, 665, 25, 1, 2, 0, 0, 12037652591, 665, 26, 2, 1, 0, 0, 12037652592, 665, 27, 1, 2, 0, 0, 12037652593, 665, 28, 2, 1, 0, 0, 12037652594, 665, 29, 1, 2, 0, 0, 12037652595, 665, 30, 2, 1, 0, 0, 12037652596, 665, 31, 1, 2, 0, 0, 12037652597, 665, 32, 2, 1, 0, 0, 12037652598, 665, 33, 1, 2, 0, 0, 12037652599, 665, 34, 2, 1, 0, 0, 12037652600, 665, 35, 1, 2, 0, 0, 12037652601, 665, 36, 2, 1, 0, 952, 2, 0, 4, 954, 0, 0, 4, 2, 16777216, 953, 0, 0, 12037652602, 665, 5, 1, 12037652603, 665, 6, 2, 0, 1, 0, 12037652604, 665, 7, 1, 2, 0, 0, 12037652605, 665, 8, 2, 1, 0, 0, 12037652606, 665, 9, 1, 2, 0, 0, 12037652607, 665, 10, 2, 1, 0, 0, 12037652608, 665, 11, 1, 2, 0, 0, 12037652609, 665, 12, 2, 1, 0, 0, 12037652610, 665, 13, 1, 2, 0, 0, 12037652611, 665, 14, 2, 1, 0, 0, 12037652612, 665, 15, 1, 2, 0, 0, 12037652613, 665, 16, 2, 1, 0, 0, 12037652614, 665, 17, 1, 2, 0, 0, 12037652615, 665, 18, 2, 1, 0, 0, 12037652616, 665, 19, 1, 2, 0, 0, 12037652617, 665, 20, 2, 1, 0, 0, 12037652618, 665, 21, 1, 2, 0, 0, 12037652619, 665, 22, 2, 1, 0, 0, 12037652620, 665, 23, 1, 2, 0, 0, 12037652621, 665, 24, 2, 1, 0, 0, 12037652622, 665, 25, 1, 2, 0, 0, 12037652623, 665, 26, 2, 1, 0, 0, 12037652624, 665, 27, 1, 2, 0, 0, 12037652625, 665, 28, 2, 1, 0, 0, 12037652626, 665, 29, 1, 2, 0, 0, 12037652627, 665, 30, 2, 1, 0, 0, 12037652628, 665, 31, 1, 2, 0, 0, 12037652629, 665, 32, 2, 1, 0, 0, 12037652630, 665, 33, 1, 2, 0, 0, 12037652631, 665, 34, 2, 1, 0, 0, 12037652632, 665, 35, 1, 2, 0, 0, 12037652633, 665, 36, 2, 1, 0, 955, 2, 0, 4, 957, 0, 0, 4, 2, 16777216, 956, 0, 0, 12037652634, 665, 5, 1, 12037652635, 665, 6, 2, 0, 1, 0, 12037652636, 665, 7, 1, 2, 0, 0, 12037652637, 665, 8, 2, 1, 0, 0, 12037652638, 665, 9, 1, 2, 0, 0, 12037652639, 665, 10, 2, 1, 0, 0, 12037652640, 665, 11, 1, 2, 0, 0, 12037652641, 665, 12, 2, 1, 0, 0, 12037652642, 665, 13, 1, 2, 0, 0, 12037652643, 665, 14, 2, 1, 0, 0, 12037652644, 665, 15, 1, 2, 0, 0, 12037652645, 665, 16, 2, 1, 0, 0, 12037652646, 665, 17, 1, 2, 0, 0, 12037652647, 665, 18, 2, 1, 0, 0, 12037652648, 665, 19, 1, 2, 0, 0, 12037652649, 665, 20, 2, 1, 0, 0, 12037652650, 665, 21, 1, 2, 0, 0, 12037652651, 665, 22, 2, 1, 0, 0, 12037652652, 665, 23, 1, 2, 0, 0, 12037652653, 665, 24, 2, 1, 0, 0, 12037652654, 665, 25, 1, 2, 0, 0, 12037652655, 665, 26, 2, 1, 0, 0, 12037652656, 665, 27, 1, 2, 0, 0, 12037652657, 665, 28, 2, 1, 0, 0, 12037652658, 665, 29, 1, 2, 0, 0, 12037652659, 665, 30, 2, 1, 0, 0, 12037652660, 665, 31, 1, 2, 0, 0, 12037652661, 665, 32, 2, 1, 0, 0, 12037652662, 665, 33, 1, 2, 0, 0, 12037652663, 665, 34, 2, 1, 0, 0, 12037652664, 665, 35, 1, 2, 0, 0, 12037652666, 665, 36, 2, 1, 0, 958, 2, 0, 4, 960, 0, 0, 4, 2, 16777216, 959, 0, 0, 34, 35, 3, 0, 36, 0, 12037652667, 665, 5, 1, 12037652668, 665, 6, 2, 0, 1, 0, 12037652669, 665, 7, 1, 2, 0, 0, 12037652670, 665, 8, 2, 1, 0, 0, 12037652671, 665, 9, 1, 2, 0, 0, 12037652672, 665, 10, 2, 1, 0, 0, 12037652673, 665, 11, 1, 2, 0, 0, 12037652674, 665, 12, 2, 1, 0, 0, 12037652675, 665, 13, 1, 2, 0, 0, 12037652676, 665, 14, 2, 1, 0, 0, 12037652677, 665, 15, 1, 2, 0, 0, 12037652678, 665, 16, 2, 1, 0, 0, 12037652679, 665, 17, 1, 2, 0, 0, 12037652680, 665, 18, 2, 1, 0, 0, 12037652682, 665, 19, 1, 2, 0, 0, 12037652683, 665, 20, 2, 1, 0, 0, 12037652684, 665, 21, 1, 2, 0, 0, 12037652685, 665, 22, 2, 1, 0, 0, 12037652686, 665, 23, 1, 2, 0, 0, 12037652687, 665, 24, 2, 1, 0, 0, 12037652688, 665, 25, 1, 2, 0, 0, 12037652689, 665, 26, 2, 1, 0, 0, 12037652690, 665, 27, 1, 2, 0, 0, 12037652691, 665, 28, 2, 1, 0, 0, 12037652692, 665, 29, 1, 2, 0, 0, 12037652693, 665, 30, 2, 1, 0, 0, 12037652694, 665, 31, 1, 2, 0, 0, 12037652695, 665, 32, 2, 1, 0, 0, 12037652696, 665, 33, 1, 2, 0, 0, 12037652665, 665, 34, 2, 1, 0, 0, 12037652681, 665, 35, 1, 2, 0, 0, 12037652697, 665, 36, 2, 1, 0, 0, 3, 0, 105, 2, 0, 0, 106, 1, 105, 0, 0, 0, 107, 1, 0, 0, 106, 2, 16777216, 1, 105, 2, 16777216, 0, 0, 0, 106, 1, 0, 0, 12037652705, 665, 961, 0, 0, 107, 963, 0, 0, 107, 2, 16777216, 962, 0, 0, 12037652706, 665, 964, 0, 0, 107, 966, 0, 0, 107, 2, 16777216, 965, 0, 0, 12037652707, 665, 967, 0, 0, 107, 969, 0, 0, 107, 2, 16777216, 968, 0, 0, 0ULL, 1, 12037652738, 665, 2, 12037652708, 665, 3, 12037652710, 665, 4, 12037652739, 665, 5, 0ULL, 6, 12037652712, 665, 7, 12037652740, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 108, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 110, 7, 0, 0, 110, 2, 16777216, 1, 108, 2, 16777216, 2, 3, 2, 16777216, 3, 2, 2, 16777216, 4, 109, 2, 16777216, 5, 111, 2, 16777216, 6, 112, 2, 16777216, 7, 113, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 109, 7, 0, 0, 12037652746, 2, 16777216, 665, 12037652745, 2, 16777216, 665, 1, 12037652738, 665, 2, 12037652709, 665, 3, 12037652711, 665, 4, 12037652740, 665, 5, 12037652744, 665, 6, 12037652713, 665, 7, 12037652741, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 111, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 113, 7, 0, 0, 110, 2, 16777216, 1, 108, 2, 16777216, 2, 3, 2, 16777216, 3, 2, 2, 16777216, 4, 109, 2, 16777216, 5, 111, 2, 16777216, 6, 112, 2, 16777216, 7, 113, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 112, 7, 0, 0, 12037652774, 665, 970, 0, 0, 2, 972, 0, 0, 2, 2, 16777216, 971, 0, 0, 12037652747, 2, 16777216, 665, 1, 12037652748, 2, 16777216, 665, 2, 12037652749, 2, 16777216, 665, 3, 12037652750, 2, 16777216, 665, 4, 12037652751, 2, 16777216, 665, 5, 12037652752, 2, 16777216, 665, 6, 12037652753, 2, 16777216, 665, 7, 12037652754, 2, 16777216, 665, 8, 12037652755, 2, 16777216, 665, 9, 12037652756, 2, 16777216, 665, 10, 12037652757, 2, 16777216, 665, 11, 12037652758, 2, 16777216, 665, 12, 12037652759, 2, 16777216, 665, 13, 12037652760, 2, 16777216, 665, 14, 12037652761, 2, 16777216, 665, 15, 12037652762, 2, 16777216, 665, 16, 123, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 114, 1, 1, 0, 12037652791, 665, 1, 12037652794, 665, 2, 12037652795, 665, 3, 12037652796, 665, 4, 12037652797, 665, 5, 12037652798, 665, 6, 12037652799, 665, 7, 12037652800, 665, 8, 12037652801, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 116, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 118, 8, 0, 0, 46, 2, 16777216, 1, 37, 2, 16777216, 2, 38, 2, 16777216, 3, 39, 2, 16777216, 4, 40, 2, 16777216, 5, 41, 2, 16777216, 6, 42, 2, 16777216, 7, 43, 2, 16777216, 8, 44, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 117, 8, 0, 0, 12037652877, 665, 1, 12037652878, 665, 2, 12037652880, 665, 3, 12037652879, 665, 4, 12037652881, 665, 5, 12037652882, 665, 6, 12037652883, 665, 7, 12037652884, 665, 8, 12037652885, 665, 9, 12037652886, 665, 10, 12037652887, 665, 11, 12037652888, 665, 12, 12037652889, 665, 13, 12037652890, 665, 14, 12037652891, 665, 15, 12037652855, 665, 16, 12037652864, 665, 17, 12037652857, 665, 18, 12037652856, 665, 19, 12037652861, 665, 20, 12037652862, 665, 21, 12037652863, 665, 22, 12037652860, 665, 23, 12037652858, 665, 24, 12037652859, 665, 25, 12037652865, 665, 26, 12037652866, 665, 27, 12037652867, 665, 28, 12037652876, 665, 29, 12037652869, 665, 30, 12037652868, 665, 31, 12037652873, 665, 32, 12037652875, 665, 33, 12037652874, 665, 34, 12037652872, 665, 35, 12037652871, 665, 36, 12037652870, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 119, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 121, 36, 0, 0, 148, 2, 16777216, 1, 149, 2, 16777216, 2, 150, 2, 16777216, 3, 151, 2, 16777216, 4, 152, 2, 16777216, 5, 153, 2, 16777216, 6, 154, 2, 16777216, 7, 155, 2, 16777216, 8, 156, 2, 16777216, 9, 157, 2, 16777216, 10, 158, 2, 16777216, 11, 159, 2, 16777216, 12, 160, 2, 16777216, 13, 161, 2, 16777216, 14, 162, 2, 16777216, 15, 163, 2, 16777216, 16, 164, 2, 16777216, 17, 165, 2, 16777216, 18, 166, 2, 16777216, 19, 167, 2, 16777216, 20, 168, 2, 16777216, 21, 169, 2, 16777216, 22, 170, 2, 16777216, 23, 171, 2, 16777216, 24, 172, 2, 16777216, 25, 173, 2, 16777216, 26, 174, 2, 16777216, 27, 175, 2, 16777216, 28, 176, 2, 16777216, 29, 177, 2, 16777216, 30, 178, 2, 16777216, 31, 179, 2, 16777216, 32, 180, 2, 16777216, 33, 181, 2, 16777216, 34, 182, 2, 16777216, 35, 183, 2, 16777216, 36, 184, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 120, 36, 0, 0, 188, 1, 12037652894, 665, 2, 12037652898, 665, 3, 12037652902, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 122, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 124, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 123, 3, 0, 0, 188, 1, 12037652895, 665, 2, 12037652899, 665, 3, 12037652903, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 125, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 127, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 126, 3, 0, 0, 188, 1, 12037652896, 665, 2, 12037652900, 665, 3, 12037652904, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 128, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 130, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 129, 3, 0, 0, 188, 1, 12037652897, 665, 2, 12037652901, 665, 3, 12037652905, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 131, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 133, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 132, 3, 0, 3, 25341984826, 371, 4, 212, 5, 12037652921, 665, 0, 12037652910, 665, 1, 195, 2, 12037652911, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 136, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 136, 1, 0, 0, 134, 1, 136, 0, 12037652910, 2, 16777216, 665, 1, 195, 2, 16777216, 2, 12037652911, 2, 16777216, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 135, 2, 0, 9, 12037652929, 665, 10, 12037652930, 665, 11, 12037652931, 665, 12, 12037652932, 665, 13, 12037652933, 665, 14, 12037652934, 665, 15, 12037652935, 665, 16, 12037652936, 665, 17, 216, 0, 12037652912, 665, 1, 12037652913, 665, 2, 12037652914, 665, 3, 12037652915, 665, 4, 12037652916, 665, 5, 12037652917, 665, 6, 12037652918, 665, 7, 12037652919, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 139, 8, 0, 0, 25341984825, 371, 0, 9, 0, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 1, 139, 1, 0, 0, 137, 1, 139, 0, 12037652912, 2, 16777216, 665, 1, 12037652913, 2, 16777216, 665, 2, 12037652914, 2, 16777216, 665, 3, 12037652915, 2, 16777216, 665, 4, 12037652916, 2, 16777216, 665, 5, 12037652917, 2, 16777216, 665, 6, 12037652918, 2, 16777216, 665, 7, 12037652919, 2, 16777216, 665, 8, 196, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 138, 8, 0, 0, 12037652938, 665, 1, 12037652941, 665, 2, 12037652942, 665, 3, 12037652943, 665, 4, 12037652944, 665, 5, 12037652945, 665, 6, 12037652946, 665, 7, 12037652947, 665, 8, 12037652948, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 140, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 142, 8, 0, 0, 46, 2, 16777216, 1, 37, 2, 16777216, 2, 38, 2, 16777216, 3, 39, 2, 16777216, 4, 40, 2, 16777216, 5, 41, 2, 16777216, 6, 42, 2, 16777216, 7, 43, 2, 16777216, 8, 44, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 141, 8, 0, 0, 12037653121, 665, 973, 0, 0, 45, 975, 0, 0, 45, 2, 16777216, 974, 0, 3, 12037653033, 665, 4, 12037653032, 665, 5, 12037653031, 665, 6, 12037653030, 665, 7, 12037653029, 665, 8, 12037653028, 665, 9, 12037653027, 665, 10, 12037653026, 665, 11, 12037653042, 665, 12, 12037653043, 665, 13, 12037653044, 665, 14, 12037653045, 665, 15, 12037653046, 665, 16, 12037653047, 665, 17, 12037653048, 665, 18, 12037653049, 665, 19, 12037653050, 665, 20, 12037653051, 665, 21, 12037653052, 665, 22, 12037653053, 665, 23, 12037653056, 665, 24, 12037653054, 665, 25, 12037653055, 665, 26, 12037653057, 665, 27, 12037653114, 665, 28, 12037653115, 665, 29, 12037653117, 665, 30, 12037653116, 665, 31, 12037653119, 665, 32, 12037653118, 665, 0, 1ULL, 12037653087, 665, 1, 2ULL, 12037653088, 665, 2, 0, 1, 0, 4ULL, 12037653089, 665, 1, 2, 0, 0, 8ULL, 12037653103, 665, 2, 1, 0, 0, 16ULL, 12037653101, 665, 1, 2, 0, 0, 32ULL, 12037653093, 665, 2, 1, 0, 0, 64ULL, 12037653096, 665, 1, 2, 0, 0, 128ULL, 12037653095, 665, 2, 1, 0, 0, 256ULL, 12037653097, 665, 1, 2, 0, 0, 512ULL, 12037653100, 665, 2, 1, 0, 0, 1024ULL, 12037653099, 665, 1, 2, 0, 0, 2048ULL, 12037653079, 665, 2, 1, 0, 0, 4096ULL, 12037653080, 665, 1, 2, 0, 0, 8192ULL, 12037653078, 665, 2, 1, 0, 0, 16384ULL, 12037653077, 665, 1, 2, 0, 0, 32768ULL, 12037653071, 665, 2, 1, 0, 0, 65536ULL, 12037653073, 665, 1, 2, 0, 0, 131072ULL, 12037653072, 665, 2, 1, 0, 0, 262144ULL, 12037653090, 665, 1, 2, 0, 0, 524288ULL, 12037653091, 665, 2, 1, 0, 0, 1048576ULL, 12037653092, 665, 1, 2, 0, 0, 2097152ULL, 12037653083, 665, 2, 1, 0, 0, 4194304ULL, 12037653084, 665, 1, 2, 0, 0, 8388608ULL, 12037653104, 665, 2, 1, 0, 0, 16777216ULL, 12037653058, 665, 1, 2, 0, 0, 33554432ULL, 12037653059, 665, 2, 1, 0, 0, 67108864ULL, 12037653060, 665, 1, 2, 0, 0, 134217728ULL, 12037653064, 665, 2, 1, 0, 0, 268435456ULL, 12037653061, 665, 1, 2, 0, 0, 536870912ULL, 12037653062, 665, 2, 1, 0, 0, 1073741824ULL, 12037653067, 665, 1, 2, 0, 0, 2147483648ULL, 12037653069, 665, 2, 1, 0, 0, 4294967296ULL, 12037653066, 665, 1, 2, 0, 0, 8589934592ULL, 12037653070, 665, 2, 1, 0, 0, 17179869184ULL, 12037653068, 665, 1, 2, 0, 0, 34359738368ULL, 12037653065, 665, 2, 1, 0, 0, 68719476736ULL, 12037653063, 665, 1, 2, 0, 0, 137438953472ULL, 12037653086, 665, 2, 1, 0, 0, 274877906944ULL, 12037653085, 665, 1, 2, 0, 0, 549755813888ULL, 12037653081, 665, 2, 1, 0, 0, 1099511627776ULL, 12037653135, 665, 1, 2, 0, 0, 2199023255552ULL, 12037653074, 665, 2, 1, 0, 0, 4398046511104ULL, 12037653105, 665, 1, 2, 0, 0, 8796093022208ULL, 12037653106, 665, 2, 1, 0, 0, 17592186044416ULL, 12037653094, 665, 1, 2, 0, 0, 35184372088832ULL, 12037653098, 665, 2, 1, 0, 0, 70368744177664ULL, 12037653136, 665, 1, 2, 0, 0, 1, 1, 12037653075, 665, 2, 12037653076, 665, 33, 12037653102, 665, 34, 12037653133, 665, 35, 12037653134, 665, 36, 12037653022, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 143, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 145, 36, 0, 0, 47, 2, 16777216, 1, 48, 2, 16777216, 2, 49, 2, 16777216, 3, 50, 2, 16777216, 4, 51, 2, 16777216, 5, 52, 2, 16777216, 6, 53, 2, 16777216, 7, 54, 2, 16777216, 8, 56, 2, 16777216, 9, 57, 2, 16777216, 10, 58, 2, 16777216, 11, 59, 2, 16777216, 12, 60, 2, 16777216, 13, 61, 2, 16777216, 14, 62, 2, 16777216, 15, 63, 2, 16777216, 16, 64, 2, 16777216, 17, 65, 2, 16777216, 18, 66, 2, 16777216, 19, 67, 2, 16777216, 20, 68, 2, 16777216, 21, 69, 2, 16777216, 22, 70, 2, 16777216, 23, 71, 2, 16777216, 24, 72, 2, 16777216, 25, 73, 2, 16777216, 26, 74, 2, 16777216, 27, 75, 2, 16777216, 28, 76, 2, 16777216, 29, 77, 2, 16777216, 30, 83, 2, 16777216, 31, 55, 2, 16777216, 32, 78, 2, 16777216, 33, 79, 2, 16777216, 34, 80, 2, 16777216, 35, 81, 2, 16777216, 36, 82, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 144, 36, 0, 2, 12037652922, 2, 16777216, 665, 0, 12037652928, 2, 16777216, 665, 12037652923, 2, 16777216, 665, 1, 0, 12037652939, 2, 16777216, 665, 0, 1, 1ULL, 1, 12037652939, 2, 16777216, 665, 3, 25341984827, 2, 16777216, 371, 4, 25341984828, 2, 16777216, 371, 5, 25341984829, 2, 16777216, 371, 6, 25341984830, 2, 16777216, 371, 7, 25341984831, 2, 16777216, 371, 8, 25341984832, 2, 16777216, 371, 9, 25341984833, 2, 16777216, 371, 10, 25341984834, 2, 16777216, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984842, 2, 16777216, 371, 0, 146, 1, 1, 2, 12037652775, 2, 16777216, 665, 0, 12037652790, 2, 16777216, 665, 12037652776, 2, 16777216, 665, 1, 0, 12037652792, 2, 16777216, 665, 0, 1, 1ULL, 1, 12037652792, 2, 16777216, 665, 3, 25341984814, 2, 16777216, 371, 4, 25341984815, 2, 16777216, 371, 5, 25341984816, 2, 16777216, 371, 6, 25341984817, 2, 16777216, 371, 7, 25341984818, 2, 16777216, 371, 8, 25341984819, 2, 16777216, 371, 9, 25341984820, 2, 16777216, 371, 10, 25341984821, 2, 16777216, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984843, 2, 16777216, 371, 0, 148, 1, 1, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 12037652814, 665, 4, 12037652815, 665, 5, 12037652816, 665, 6, 12037652817, 665, 7, 12037652818, 665, 8, 12037652819, 665, 9, 12037652820, 665, 10, 12037652821, 665, 11, 12037652878, 665, 12, 0ULL, 13, 0ULL, 14, 0ULL, 15, 905, 16, 110, 17, 111, 18, 112, 19, 12037652877, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 150, 1, 1, 0, 909, 1, 113, 2, 114, 3, 115, 4, 116, 5, 117, 6, 118, 7, 119, 8, 12037653085, 665, 12037653100, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 151, 1, 1, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 0ULL, 4, 12037652977, 665, 5, 12037652976, 665, 6, 12037652975, 665, 7, 12037652974, 665, 8, 12037652973, 665, 9, 12037652972, 665, 10, 12037652971, 665, 11, 12037652970, 665, 12, 12037652985, 665, 13, 12037652984, 665, 14, 12037652983, 665, 15, 12037652982, 665, 16, 12037652981, 665, 17, 12037652980, 665, 18, 12037652979, 665, 19, 12037652978, 665, 20, 12037652993, 665, 21, 12037652992, 665, 22, 12037652991, 665, 23, 12037652990, 665, 24, 12037652989, 665, 25, 12037652988, 665, 26, 12037652987, 665, 27, 12037652986, 665, 28, 12037653001, 665, 29, 12037653000, 665, 30, 12037652999, 665, 31, 12037652998, 665, 32, 12037652997, 665, 33, 12037652996, 665, 34, 12037652995, 665, 35, 12037652994, 665, 36, 909, 37, 113, 38, 114, 39, 115, 40, 116, 41, 117, 42, 118, 43, 119, 44, 12037653087, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 1, 1, 1, 44, 0, 152, 1, 1, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 1ULL, 4, 12037652977, 665, 5, 12037652976, 665, 6, 12037652975, 665, 7, 12037652974, 665, 8, 12037652973, 665, 9, 12037652972, 665, 10, 12037652971, 665, 11, 12037652970, 665, 12, 12037652985, 665, 13, 12037652984, 665, 14, 12037652983, 665, 15, 12037652982, 665, 16, 12037652981, 665, 17, 12037652980, 665, 18, 12037652979, 665, 19, 12037652978, 665, 20, 12037652993, 665, 21, 12037652992, 665, 22, 12037652991, 665, 23, 12037652990, 665, 24, 12037652989, 665, 25, 12037652988, 665, 26, 12037652987, 665, 27, 12037652986, 665, 28, 12037653001, 665, 29, 12037653000, 665, 30, 12037652999, 665, 31, 12037652998, 665, 32, 12037652997, 665, 33, 12037652996, 665, 34, 12037652995, 665, 35, 12037652994, 665, 36, 12037653009, 665, 37, 12037653008, 665, 38, 12037653007, 665, 39, 12037653006, 665, 40, 12037653005, 665, 41, 12037653004, 665, 42, 12037653003, 665, 43, 12037653002, 665, 44, 909, 45, 113, 46, 114, 47, 115, 48, 116, 49, 117, 50, 118, 51, 119, 52, 12037653088, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 153, 1, 1, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 1ULL, 4, 12037652977, 665, 5, 12037652976, 665, 6, 12037652975, 665, 7, 12037652974, 665, 8, 12037652973, 665, 9, 12037652972, 665, 10, 12037652971, 665, 11, 12037652970, 665, 12, 12037652985, 665, 13, 12037652984, 665, 14, 12037652983, 665, 15, 12037652982, 665, 16, 12037652981, 665, 17, 12037652980, 665, 18, 12037652979, 665, 19, 12037652978, 665, 20, 12037652977, 665, 21, 12037652976, 665, 22, 12037652975, 665, 23, 12037652974, 665, 24, 12037652973, 665, 25, 12037652972, 665, 26, 12037652971, 665, 27, 12037652970, 665, 28, 12037652985, 665, 29, 12037652984, 665, 30, 12037652983, 665, 31, 12037652982, 665, 32, 12037652981, 665, 33, 12037652980, 665, 34, 12037652979, 665, 35, 12037652978, 665, 36, 12037653009, 665, 37, 12037653008, 665, 38, 12037653007, 665, 39, 12037653006, 665, 40, 12037653005, 665, 41, 12037653004, 665, 42, 12037653003, 665, 43, 12037653002, 665, 44, 909, 45, 113, 46, 114, 47, 115, 48, 116, 49, 117, 50, 118, 51, 119, 52, 12037653089, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 154, 1, 1, 0, 12037653102, 665, 1, 12037652977, 665, 2, 12037652976, 665, 3, 12037652975, 665, 4, 12037652974, 665, 5, 12037652973, 665, 6, 12037652972, 665, 7, 12037652971, 665, 8, 12037652970, 665, 9, 12037652985, 665, 10, 12037652984, 665, 11, 12037652983, 665, 12, 12037652982, 665, 13, 12037652981, 665, 14, 12037652980, 665, 15, 12037652979, 665, 16, 12037652978, 665, 17, 909, 18, 113, 19, 114, 20, 115, 21, 116, 22, 117, 23, 118, 24, 119, 25, 12037653082, 665, 26, 12037653101, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 155, 1, 1, 0, 910, 1, 909, 2, 12037653095, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 156, 1, 1, 0, 910, 1, 909, 2, 113, 3, 114, 4, 115, 5, 116, 6, 117, 7, 118, 8, 119, 9, 12037653120, 665, 10, 12037653096, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 157, 1, 1, 0, 910, 1, 909, 2, 12037653099, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 158, 1, 1, 1, 910, 0, 4294967296ULL, 113, 2, 909, 0, 0, 4294967296ULL, 115, 3, 114, 0, 0, 4294967296ULL, 117, 4, 116, 0, 0, 4294967296ULL, 119, 5, 118, 0, 0, 12037653120, 665, 6, 12037653100, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 6, 0, 159, 1, 1, 0, 910, 1, 45, 2, 12037653084, 665, 3, 909, 4, 113, 5, 114, 6, 115, 7, 116, 8, 117, 9, 118, 10, 119, 11, 12037653083, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 160, 1, 1, 0, 4294967296ULL, 12037653016, 665, 1, 0, 12037653017, 665, 0, 4294967296ULL, 12037653014, 665, 2, 0, 12037653015, 665, 0, 4294967296ULL, 12037653012, 665, 3, 0, 12037653013, 665, 0, 4294967296ULL, 12037653010, 665, 4, 0, 12037653011, 665, 0, 12037653141, 665, 5, 12037653142, 665, 6, 12037653143, 665, 7, 12037653144, 665, 8, 909, 9, 113, 10, 114, 11, 115, 12, 116, 13, 117, 14, 118, 15, 119, 16, 12037653120, 665, 17, 12037653086, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 161, 1, 1, 0, 4294967296ULL, 12037653016, 665, 1, 0, 12037653017, 665, 0, 4294967296ULL, 12037653014, 665, 2, 0, 12037653015, 665, 0, 4294967296ULL, 12037653012, 665, 3, 0, 12037653013, 665, 0, 4294967296ULL, 12037653010, 665, 4, 0, 12037653011, 665, 5, 12037653141, 665, 6, 12037653142, 665, 7, 12037653143, 665, 8, 12037653144, 665, 9, 12037653001, 665, 10, 12037653000, 665, 11, 12037652999, 665, 12, 12037652998, 665, 13, 12037652997, 665, 14, 12037652996, 665, 15, 12037652995, 665, 16, 12037652994, 665, 0, 4294967296ULL, 113, 17, 909, 0, 0, 4294967296ULL, 115, 18, 114, 0, 0, 4294967296ULL, 117, 19, 116, 0, 0, 4294967296ULL, 119, 20, 118, 0, 0, 12037653120, 665, 21, 12037653085, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 21, 0, 162, 1, 1, 0, 0ULL, 1, 0ULL, 2, 12037652977, 665, 3, 12037652976, 665, 4, 12037652975, 665, 5, 12037652974, 665, 6, 12037652973, 665, 7, 12037652972, 665, 8, 12037652971, 665, 9, 12037652970, 665, 10, 12037652985, 665, 11, 12037652984, 665, 12, 12037652983, 665, 13, 12037652982, 665, 14, 12037652981, 665, 15, 12037652980, 665, 16, 12037652979, 665, 17, 12037652978, 665, 18, 909, 19, 113, 20, 114, 21, 115, 22, 116, 23, 117, 24, 118, 25, 119, 26, 12037652993, 665, 27, 12037653090, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 163, 1, 1, 0, 1ULL, 1, 0ULL, 2, 12037652977, 665, 3, 12037652976, 665, 4, 12037652975, 665, 5, 12037652974, 665, 6, 12037652973, 665, 7, 12037652972, 665, 8, 12037652971, 665, 9, 12037652970, 665, 10, 12037652985, 665, 11, 12037652984, 665, 12, 12037652983, 665, 13, 12037652982, 665, 14, 12037652981, 665, 15, 12037652980, 665, 16, 12037652979, 665, 17, 12037652978, 665, 18, 909, 19, 113, 20, 114, 21, 115, 22, 116, 23, 117, 24, 118, 25, 119, 26, 12037652993, 665, 27, 12037653001, 665, 28, 12037653000, 665, 29, 12037652999, 665, 30, 12037652998, 665, 31, 12037652997, 665, 32, 12037652996, 665, 33, 12037652995, 665, 34, 12037652994, 665, 35, 12037653009, 665, 36, 12037653008, 665, 37, 12037653007, 665, 38, 12037653006, 665, 39, 12037653005, 665, 40, 12037653004, 665, 41, 12037653003, 665, 42, 12037653002, 665, 43, 12037653091, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 164, 1, 1, 0, 0ULL, 1, 1ULL, 2, 12037652977, 665, 3, 12037652976, 665, 4, 12037652975, 665, 5, 12037652974, 665, 6, 12037652973, 665, 7, 12037652972, 665, 8, 12037652971, 665, 9, 12037652970, 665, 10, 909, 11, 113, 12, 114, 13, 115, 14, 116, 15, 117, 16, 118, 17, 119, 18, 12037652993, 665, 19, 12037653001, 665, 20, 12037653000, 665, 21, 12037652999, 665, 22, 12037652998, 665, 23, 12037652997, 665, 24, 12037652996, 665, 25, 12037652995, 665, 26, 12037652994, 665, 27, 12037653092, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 165, 1, 1, 3, 120, 0, 3, 1, 3, 0, 2, 1, 2, 4, 121, 0, 12275445934081160404ULL, 3, 1, 0, 0, 4, 1, 1, 0, 2, 166, 2, 1, 0, 8589934592ULL, 12037652905, 665, 1, 4194304ULL, 12037652904, 665, 2, 0, 1, 0, 2048ULL, 12037652903, 665, 1, 2, 0, 0, 1, 12037652902, 665, 5, 0, 0, 185, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 186, 0, 0, 3, 1, 4, 0, 0, 1, 2, 167, 2, 0, 4, 187, 1, 12037652909, 665, 0, 3, 1, 1, 0, 2, 1, 2, 0, 12275445934081160404ULL, 3, 1, 0, 0, 25341984823, 371, 1, 1, 0, 2, 168, 2, 1, 7, 12037652906, 665, 0, 209, 0, 0, 3, 1, 1, 0, 2, 1, 2, 0, 210, 0, 0, 3, 1, 25341984823, 371, 0, 0, 1, 2, 169, 2, 0, 6, 211, 0, 122, 4, 1, 123, 0, 0, 4, 1, 1, 124, 0, 0, 4, 1, 1, 125, 0, 0, 4, 1, 1, 126, 0, 0, 4, 1, 1, 127, 0, 0, 4, 1, 1, 128, 0, 0, 4, 1, 1, 129, 0, 0, 4, 1, 1, 130, 0, 0, 4, 1, 1, 131, 0, 0, 4, 1, 1, 132, 0, 0, 4, 1, 1, 133, 0, 0, 4, 1, 1, 134, 0, 0, 4, 1, 1, 135, 0, 0, 4, 1, 1, 136, 0, 0, 4, 1, 1, 137, 0, 0, 4, 1, 1, 138, 0, 0, 4, 1, 1, 139, 0, 0, 4, 1, 1, 140, 0, 0, 4, 1, 1, 141, 0, 0, 4, 1, 1, 142, 0, 0, 4, 1, 1, 143, 0, 0, 4, 1, 1, 144, 0, 0, 4, 1, 1, 145, 0, 0, 4, 1, 1, 146, 0, 0, 4, 1, 1, 147, 0, 0, 4, 1, 1, 148, 0, 0, 4, 1, 1, 149, 0, 0, 4, 1, 1, 150, 0, 0, 4, 1, 1, 151, 0, 0, 4, 1, 1, 152, 0, 0, 4, 1, 1, 153, 0, 0, 4, 1, 1, 154, 0, 0, 4, 1, 1, 155, 0, 0, 4, 1, 1, 156, 0, 0, 4, 1, 1, 157, 0, 0, 4, 1, 1, 158, 0, 0, 4, 1, 1, 159, 0, 0, 4, 1, 1, 160, 0, 0, 4, 1, 1, 161, 0, 0, 4, 1, 1, 162, 0, 0, 4, 1, 1, 163, 0, 0, 4, 1, 1, 164, 0, 0, 4, 1, 1, 165, 0, 0, 4, 1, 1, 166, 0, 0, 4, 1, 1, 167, 0, 0, 4, 1, 1, 168, 0, 0, 4, 1, 1, 169, 0, 0, 4, 1, 1, 170, 0, 0, 4, 1, 1, 171, 0, 0, 4, 1, 1, 172, 0, 0, 4, 1, 1, 173, 0, 0, 4, 1, 1, 174, 0, 0, 4, 1, 1, 175, 0, 0, 4, 1, 1, 176, 0, 0, 4, 1, 1, 177, 0, 0, 4, 1, 1, 178, 0, 0, 4, 1, 1, 179, 0, 0, 4, 1, 1, 180, 0, 0, 4, 1, 1, 181, 0, 0, 4, 1, 1, 182, 0, 0, 4, 1, 1, 183, 0, 0, 4, 1, 1, 184, 0, 0, 4, 1, 1, 185, 0, 0, 4, 1, 1, 186, 0, 0, 4, 1, 1, 187, 0, 0, 4, 1, 1, 188, 0, 0, 4, 1, 1, 189, 0, 0, 4, 1, 1, 190, 0, 0, 4, 1, 1, 191, 0, 0, 4, 1, 1, 192, 0, 0, 4, 1, 1, 193, 0, 0, 4, 1, 1, 194, 0, 0, 4, 1, 1, 195, 0, 0, 4, 1, 1, 196, 0, 0, 4, 1, 1, 197, 0, 0, 4, 1, 1, 198, 0, 0, 4, 1, 1, 199, 0, 0, 4, 1, 1, 200, 0, 0, 4, 1, 1, 201, 0, 0, 4, 1, 1, 202, 0, 0, 4, 1, 1, 203, 0, 0, 4, 1, 1, 204, 0, 0, 4, 1, 1, 205, 0, 0, 4, 1, 1, 206, 0, 0, 4, 1, 1, 207, 0, 0, 4, 1, 1, 208, 0, 0, 4, 1, 1, 209, 0, 0, 4, 1, 1, 210, 0, 0, 4, 1, 1, 211, 0, 0, 4, 1, 1, 212, 0, 0, 4, 1, 1, 213, 0, 0, 4, 1, 1, 214, 0, 0, 4, 1, 1, 215, 0, 0, 4, 1, 1, 216, 0, 0, 4, 1, 1, 217, 0, 0, 4, 1, 1, 218, 0, 0, 4, 1, 1, 219, 0, 0, 4, 1, 1, 220, 0, 0, 4, 1, 1, 221, 0, 0, 4, 1, 1, 222, 0, 0, 4, 1, 1, 223, 0, 0, 4, 1, 1, 224, 0, 0, 4, 1, 1, 225, 0, 0, 4, 1, 1, 226, 0, 0, 4, 1, 1, 227, 0, 0, 4, 1, 1, 228, 0, 0, 4, 1, 1, 229, 0, 0, 4, 1, 1, 230, 0, 0, 4, 1, 1, 231, 0, 0, 4, 1, 1, 232, 0, 0, 4, 1, 1, 233, 0, 0, 4, 1, 1, 234, 0, 0, 4, 1, 1, 235, 0, 0, 4, 1, 1, 236, 0, 0, 4, 1, 1, 237, 0, 0, 4, 1, 1, 238, 0, 0, 4, 1, 1, 239, 0, 0, 4, 1, 1, 240, 0, 0, 4, 1, 1, 241, 0, 0, 4, 1, 1, 242, 0, 0, 4, 1, 1, 243, 0, 0, 4, 1, 1, 244, 0, 0, 4, 1, 1, 245, 0, 0, 4, 1, 1, 246, 0, 0, 4, 1, 1, 247, 0, 0, 4, 1, 1, 248, 0, 0, 4, 1, 1, 249, 0, 0, 4, 1, 1, 250, 0, 0, 4, 1, 1, 251, 0, 0, 4, 1, 1, 252, 0, 0, 4, 1, 1, 253, 0, 0, 4, 1, 1, 254, 0, 0, 4, 1, 1, 255, 0, 0, 4, 1, 1, 256, 0, 0, 4, 1, 1, 257, 0, 0, 4, 1, 1, 258, 0, 0, 4, 1, 1, 259, 0, 0, 4, 1, 1, 260, 0, 0, 4, 1, 1, 261, 0, 0, 4, 1, 1, 262, 0, 0, 4, 1, 1, 263, 0, 0, 4, 1, 1, 264, 0, 0, 4, 1, 1, 265, 0, 0, 4, 1, 1, 266, 0, 0, 4, 1, 1, 267, 0, 0, 4, 1, 1, 268, 0, 0, 4, 1, 1, 269, 0, 0, 4, 1, 1, 270, 0, 0, 4, 1, 1, 271, 0, 0, 4, 1, 1, 272, 0, 0, 4, 1, 1, 273, 0, 0, 4, 1, 1, 274, 0, 0, 4, 1, 1, 275, 0, 0, 4, 1, 1, 276, 0, 0, 4, 1, 1, 277, 0, 0, 4, 1, 1, 278, 0, 0, 4, 1, 1, 279, 0, 0, 4, 1, 1, 280, 0, 0, 4, 1, 1, 281, 0, 0, 4, 1, 1, 282, 0, 0, 4, 1, 1, 283, 0, 0, 4, 1, 1, 284, 0, 0, 4, 1, 1, 285, 0, 0, 4, 1, 1, 286, 0, 0, 4, 1, 1, 287, 0, 0, 4, 1, 1, 288, 0, 0, 4, 1, 1, 289, 0, 0, 4, 1, 1, 290, 0, 0, 4, 1, 1, 291, 0, 0, 4, 1, 1, 292, 0, 0, 4, 1, 1, 293, 0, 0, 4, 1, 1, 294, 0, 0, 4, 1, 1, 295, 0, 0, 4, 1, 1, 296, 0, 0, 4, 1, 1, 297, 0, 0, 4, 1, 1, 298, 0, 0, 4, 1, 1, 299, 0, 0, 4, 1, 1, 300, 0, 0, 4, 1, 1, 301, 0, 0, 4, 1, 1, 302, 0, 0, 4, 1, 1, 303, 0, 0, 4, 1, 1, 304, 0, 0, 4, 1, 1, 305, 0, 0, 4, 1, 1, 306, 0, 0, 4, 1, 1, 307, 0, 0, 4, 1, 1, 308, 0, 0, 4, 1, 1, 309, 0, 0, 4, 1, 1, 310, 0, 0, 4, 1, 1, 311, 0, 0, 4, 1, 1, 312, 0, 0, 4, 1, 1, 313, 0, 0, 4, 1, 1, 314, 0, 0, 4, 1, 1, 315, 0, 0, 4, 1, 1, 316, 0, 0, 4, 1, 1, 317, 0, 0, 4, 1, 1, 318, 0, 0, 4, 1, 1, 319, 0, 0, 4, 1, 1, 320, 0, 0, 4, 1, 1, 321, 0, 0, 4, 1, 1, 322, 0, 0, 4, 1, 1, 323, 0, 0, 4, 1, 1, 324, 0, 0, 4, 1, 1, 325, 0, 0, 4, 1, 1, 326, 0, 0, 4, 1, 1, 327, 0, 0, 4, 1, 1, 328, 0, 0, 4, 1, 1, 329, 0, 0, 4, 1, 1, 330, 0, 0, 4, 1, 1, 331, 0, 0, 4, 1, 1, 332, 0, 0, 4, 1, 1, 333, 0, 0, 4, 1, 1, 334, 0, 0, 4, 1, 1, 335, 0, 0, 4, 1, 1, 336, 0, 0, 4, 1, 1, 337, 0, 0, 4, 1, 1, 338, 0, 0, 4, 1, 1, 339, 0, 0, 4, 1, 1, 340, 0, 0, 4, 1, 1, 341, 0, 0, 4, 1, 1, 342, 0, 0, 4, 1, 1, 343, 0, 0, 4, 1, 1, 344, 0, 0, 4, 1, 1, 345, 0, 0, 4, 1, 1, 346, 0, 0, 4, 1, 1, 347, 0, 0, 4, 1, 1, 348, 0, 0, 4, 1, 1, 349, 0, 0, 4, 1, 1, 350, 0, 0, 4, 1, 1, 351, 0, 0, 4, 1, 1, 352, 0, 0, 4, 1, 1, 353, 0, 0, 4, 1, 1, 354, 0, 0, 4, 1, 1, 355, 0, 0, 4, 1, 1, 356, 0, 0, 4, 1, 1, 357, 0, 0, 4, 1, 1, 358, 0, 0, 4, 1, 1, 359, 0, 0, 4, 1, 1, 360, 0, 0, 4, 1, 1, 361, 0, 0, 4, 1, 1, 362, 0, 0, 4, 1, 1, 363, 0, 0, 4, 1, 1, 364, 0, 0, 4, 1, 1, 365, 0, 0, 4, 1, 1, 366, 0, 0, 4, 1, 1, 367, 0, 0, 4, 1, 1, 368, 0, 0, 4, 1, 1, 369, 0, 0, 4, 1, 1, 370, 0, 0, 4, 1, 1, 371, 0, 0, 4, 1, 1, 372, 0, 0, 4, 1, 1, 373, 0, 0, 4, 1, 1, 374, 0, 0, 4, 1, 1, 375, 0, 0, 4, 1, 1, 376, 0, 0, 4, 1, 1, 377, 0, 0, 4, 1, 1, 378, 0, 0, 4, 1, 1, 379, 0, 0, 4, 1, 1, 380, 0, 0, 4, 1, 1, 381, 0, 0, 4, 1, 1, 382, 0, 0, 4, 1, 1, 383, 0, 0, 4, 1, 1, 384, 0, 0, 4, 1, 1, 385, 0, 0, 4, 1, 1, 386, 0, 0, 4, 1, 1, 387, 0, 0, 4, 1, 1, 388, 0, 0, 4, 1, 1, 389, 0, 0, 4, 1, 1, 390, 0, 0, 4, 1, 1, 391, 0, 0, 4, 1, 1, 392, 0, 0, 4, 1, 1, 393, 0, 0, 4, 1, 1, 394, 0, 0, 4, 1, 1, 395, 0, 0, 4, 1, 1, 396, 0, 0, 4, 1, 1, 397, 0, 0, 4, 1, 1, 398, 0, 0, 4, 1, 1, 399, 0, 0, 4, 1, 1, 400, 0, 0, 4, 1, 1, 401, 0, 0, 4, 1, 1, 402, 0, 0, 4, 1, 1, 403, 0, 0, 4, 1, 1, 404, 0, 0, 4, 1, 1, 405, 0, 0, 4, 1, 1, 406, 0, 0, 4, 1, 1, 407, 0, 0, 4, 1, 1, 408, 0, 0, 4, 1, 1, 409, 0, 0, 4, 1, 1, 410, 0, 0, 4, 1, 1, 411, 0, 0, 4, 1, 1, 412, 0, 0, 4, 1, 1, 413, 0, 0, 4, 1, 1, 414, 0, 0, 4, 1, 1, 415, 0, 0, 4, 1, 1, 416, 0, 0, 4, 1, 1, 417, 0, 0, 4, 1, 1, 418, 0, 0, 4, 1, 1, 419, 0, 0, 4, 1, 1, 420, 0, 0, 4, 1, 1, 421, 0, 0, 4, 1, 1, 422, 0, 0, 4, 1, 1, 423, 0, 0, 4, 1, 1, 424, 0, 0, 4, 1, 1, 425, 0, 0, 4, 1, 1, 426, 0, 0, 4, 1, 1, 427, 0, 0, 4, 1, 1, 428, 0, 0, 4, 1, 1, 429, 0, 0, 4, 1, 1, 430, 0, 0, 4, 1, 1, 431, 0, 0, 4, 1, 1, 432, 0, 0, 4, 1, 1, 433, 0, 0, 4, 1, 1, 434, 0, 0, 4, 1, 1, 435, 0, 0, 4, 1, 1, 436, 0, 0, 4, 1, 1, 437, 0, 0, 4, 1, 1, 438, 0, 0, 4, 1, 1, 439, 0, 0, 4, 1, 1, 440, 0, 0, 4, 1, 1, 441, 0, 0, 4, 1, 1, 442, 0, 0, 4, 1, 1, 443, 0, 0, 4, 1, 1, 444, 0, 0, 4, 1, 1, 445, 0, 0, 4, 1, 1, 446, 0, 0, 4, 1, 1, 447, 0, 0, 4, 1, 1, 448, 0, 0, 4, 1, 1, 449, 0, 0, 4, 1, 1, 450, 0, 0, 4, 1, 1, 451, 0, 0, 4, 1, 1, 452, 0, 0, 4, 1, 1, 453, 0, 0, 4, 1, 1, 454, 0, 0, 4, 1, 1, 455, 0, 0, 4, 1, 1, 456, 0, 0, 4, 1, 1, 457, 0, 0, 4, 1, 1, 458, 0, 0, 4, 1, 1, 459, 0, 0, 4, 1, 1, 460, 0, 0, 4, 1, 1, 461, 0, 0, 4, 1, 1, 462, 0, 0, 4, 1, 1, 463, 0, 0, 4, 1, 1, 464, 0, 0, 4, 1, 1, 465, 0, 0, 4, 1, 1, 466, 0, 0, 4, 1, 1, 467, 0, 0, 4, 1, 1, 468, 0, 0, 4, 1, 1, 469, 0, 0, 4, 1, 1, 470, 0, 0, 4, 1, 1, 471, 0, 0, 4, 1, 1, 472, 0, 0, 4, 1, 1, 473, 0, 0, 4, 1, 1, 474, 0, 0, 4, 1, 1, 475, 0, 0, 4, 1, 1, 476, 0, 0, 4, 1, 1, 477, 0, 0, 4, 1, 1, 478, 0, 0, 4, 1, 1, 479, 0, 0, 4, 1, 1, 480, 0, 0, 4, 1, 1, 481, 0, 0, 4, 1, 1, 482, 0, 0, 4, 1, 1, 483, 0, 0, 4, 1, 1, 484, 0, 0, 4, 1, 1, 485, 0, 0, 4, 1, 1, 486, 0, 0, 4, 1, 1, 487, 0, 0, 4, 1, 1, 488, 0, 0, 4, 1, 1, 489, 0, 0, 4, 1, 1, 490, 0, 0, 4, 1, 1, 491, 0, 0, 4, 1, 1, 492, 0, 0, 4, 1, 1, 493, 0, 0, 4, 1, 1, 494, 0, 0, 4, 1, 1, 495, 0, 0, 4, 1, 1, 496, 0, 0, 4, 1, 1, 497, 0, 0, 4, 1, 1, 498, 0, 0, 4, 1, 1, 499, 0, 0, 4, 1, 1, 500, 0, 0, 4, 1, 1, 501, 0, 0, 4, 1, 1, 502, 0, 0, 4, 1, 1, 503, 0, 0, 4, 1, 1, 504, 0, 0, 4, 1, 1, 505, 0, 0, 4, 1, 1, 506, 0, 0, 4, 1, 1, 507, 0, 0, 4, 1, 1, 508, 0, 0, 4, 1, 1, 509, 0, 0, 4, 1, 1, 510, 0, 0, 4, 1, 1, 511, 0, 0, 4, 1, 1, 512, 0, 0, 4, 1, 1, 513, 0, 0, 4, 1, 1, 514, 0, 0, 4, 1, 1, 515, 0, 0, 4, 1, 1, 516, 0, 0, 4, 1, 1, 517, 0, 0, 4, 1, 1, 518, 0, 0, 4, 1, 1, 519, 0, 0, 4, 1, 1, 520, 0, 0, 4, 1, 1, 521, 0, 0, 4, 1, 1, 522, 0, 0, 4, 1, 1, 523, 0, 0, 4, 1, 1, 524, 0, 0, 4, 1, 1, 525, 0, 0, 4, 1, 1, 526, 0, 0, 4, 1, 1, 527, 0, 0, 4, 1, 1, 528, 0, 0, 4, 1, 1, 529, 0, 0, 4, 1, 1, 530, 0, 0, 4, 1, 1, 531, 0, 0, 4, 1, 1, 532, 0, 0, 4, 1, 1, 533, 0, 0, 4, 1, 1, 534, 0, 0, 4, 1, 1, 535, 0, 0, 4, 1, 1, 536, 0, 0, 4, 1, 1, 537, 0, 0, 4, 1, 1, 538, 0, 0, 4, 1, 1, 539, 0, 0, 4, 1, 1, 540, 0, 0, 4, 1, 1, 541, 0, 0, 4, 1, 1, 542, 0, 0, 4, 1, 1, 543, 0, 0, 4, 1, 1, 544, 0, 0, 4, 1, 1, 545, 0, 0, 4, 1, 1, 546, 0, 0, 4, 1, 1, 547, 0, 0, 4, 1, 1, 548, 0, 0, 4, 1, 1, 549, 0, 0, 4, 1, 1, 550, 0, 0, 4, 1, 1, 551, 0, 0, 4, 1, 1, 552, 0, 0, 4, 1, 1, 553, 0, 0, 4, 1, 1, 554, 0, 0, 4, 1, 1, 555, 0, 0, 4, 1, 1, 556, 0, 0, 4, 1, 1, 557, 0, 0, 4, 1, 1, 558, 0, 0, 4, 1, 1, 559, 0, 0, 4, 1, 1, 560, 0, 0, 4, 1, 1, 561, 0, 0, 4, 1, 1, 562, 0, 0, 4, 1, 1, 563, 0, 0, 4, 1, 1, 564, 0, 0, 4, 1, 1, 565, 0, 0, 4, 1, 1, 566, 0, 0, 4, 1, 1, 567, 0, 0, 4, 1, 1, 568, 0, 0, 4, 1, 1, 569, 0, 0, 4, 1, 1, 570, 0, 0, 4, 1, 1, 571, 0, 0, 4, 1, 1, 572, 0, 0, 4, 1, 1, 573, 0, 0, 4, 1, 1, 574, 0, 0, 4, 1, 1, 575, 0, 0, 4, 1, 1, 576, 0, 0, 4, 1, 1, 577, 0, 0, 4, 1, 1, 578, 0, 0, 4, 1, 1, 579, 0, 0, 4, 1, 1, 580, 0, 0, 4, 1, 1, 581, 0, 0, 4, 1, 1, 582, 0, 0, 4, 1, 1, 583, 0, 0, 4, 1, 1, 584, 0, 0, 4, 1, 1, 585, 0, 0, 4, 1, 1, 586, 0, 0, 4, 1, 1, 587, 0, 0, 4, 1, 1, 588, 0, 0, 4, 1, 1, 589, 0, 0, 4, 1, 1, 590, 0, 0, 4, 1, 1, 591, 0, 0, 4, 1, 1, 592, 0, 0, 4, 1, 1, 593, 0, 0, 4, 1, 1, 594, 0, 0, 4, 1, 1, 595, 0, 0, 4, 1, 1, 596, 0, 0, 4, 1, 1, 597, 0, 0, 4, 1, 1, 598, 0, 0, 4, 1, 1, 599, 0, 0, 4, 1, 1, 600, 0, 0, 4, 1, 1, 601, 0, 0, 4, 1, 1, 602, 0, 0, 4, 1, 1, 603, 0, 0, 4, 1, 1, 604, 0, 0, 4, 1, 1, 605, 0, 0, 4, 1, 1, 606, 0, 0, 4, 1, 1, 607, 0, 0, 4, 1, 1, 608, 0, 0, 4, 1, 1, 609, 0, 0, 4, 1, 1, 610, 0, 0, 4, 1, 1, 611, 0, 0, 4, 1, 1, 612, 0, 0, 4, 1, 1, 613, 0, 0, 4, 1, 1, 614, 0, 0, 4, 1, 1, 615, 0, 0, 4, 1, 1, 616, 0, 0, 4, 1, 1, 617, 0, 0, 4, 1, 1, 618, 0, 0, 4, 1, 1, 619, 0, 0, 4, 1, 1, 620, 0, 0, 4, 1, 1, 621, 0, 0, 4, 1, 1, 622, 0, 0, 4, 1, 1, 623, 0, 0, 4, 1, 1, 624, 0, 0, 4, 1, 1, 625, 0, 0, 4, 1, 1, 626, 0, 0, 4, 1, 1, 627, 0, 0, 4, 1, 1, 628, 0, 0, 4, 1, 1, 629, 0, 0, 4, 1, 1, 630, 0, 0, 4, 1, 1, 631, 0, 0, 4, 1, 1, 632, 0, 0, 4, 1, 1, 633, 0, 0, 4, 1, 1, 634, 0, 0, 4, 1, 1, 635, 0, 0, 4, 1, 1, 636, 0, 0, 4, 1, 1, 637, 0, 0, 4, 1, 1, 638, 0, 0, 4, 1, 1, 639, 0, 0, 4, 1, 1, 640, 0, 0, 4, 1, 1, 641, 0, 0, 4, 1, 1, 642, 0, 0, 4, 1, 1, 643, 0, 0, 4, 1, 1, 644, 0, 0, 4, 1, 1, 645, 0, 0, 4, 1, 1, 646, 0, 0, 4, 1, 1, 647, 0, 0, 4, 1, 1, 648, 0, 0, 4, 1, 1, 649, 0, 0, 4, 1, 1, 650, 0, 0, 4, 1, 1, 651, 0, 0, 4, 1, 1, 652, 0, 0, 4, 1, 1, 653, 0, 0, 4, 1, 1, 654, 0, 0, 4, 1, 1, 655, 0, 0, 4, 1, 1, 656, 0, 0, 4, 1, 1, 657, 0, 0, 4, 1, 1, 658, 0, 0, 4, 1, 1, 659, 0, 0, 4, 1, 1, 660, 0, 0, 4, 1, 1, 661, 0, 0, 4, 1, 1, 662, 0, 0, 4, 1, 1, 663, 0, 0, 4, 1, 1, 664, 0, 0, 4, 1, 1, 665, 0, 0, 4, 1, 1, 666, 0, 0, 4, 1, 1, 667, 0, 0, 4, 1, 1, 668, 0, 0, 4, 1, 1, 669, 0, 0, 4, 1, 1, 670, 0, 0, 4, 1, 1, 671, 0, 0, 4, 1, 1, 672, 0, 0, 4, 1, 1, 673, 0, 0, 4, 1, 1, 674, 0, 0, 4, 1, 1, 675, 0, 0, 4, 1, 1, 676, 0, 0, 4, 1, 1, 677, 0, 0, 4, 1, 1, 678, 0, 0, 4, 1, 1, 679, 0, 0, 4, 1, 1, 680, 0, 0, 4, 1, 1, 681, 0, 0, 4, 1, 1, 682, 0, 0, 4, 1, 1, 683, 0, 0, 4, 1, 1, 684, 0, 0, 4, 1, 1, 685, 0, 0, 4, 1, 1, 686, 0, 0, 4, 1, 1, 687, 0, 0, 4, 1, 1, 688, 0, 0, 4, 1, 1, 689, 0, 0, 4, 1, 1, 690, 0, 0, 4, 1, 1, 691, 0, 0, 4, 1, 1, 692, 0, 0, 4, 1, 1, 693, 0, 0, 4, 1, 1, 694, 0, 0, 4, 1, 1, 695, 0, 0, 4, 1, 1, 696, 0, 0, 4, 1, 1, 697, 0, 0, 4, 1, 1, 698, 0, 0, 4, 1, 1, 699, 0, 0, 4, 1, 1, 700, 0, 0, 4, 1, 1, 701, 0, 0, 4, 1, 1, 702, 0, 0, 4, 1, 1, 703, 0, 0, 4, 1, 1, 704, 0, 0, 4, 1, 1, 705, 0, 0, 4, 1, 1, 706, 0, 0, 4, 1, 1, 707, 0, 0, 4, 1, 1, 708, 0, 0, 4, 1, 1, 709, 0, 0, 4, 1, 1, 710, 0, 0, 4, 1, 1, 711, 0, 0, 4, 1, 1, 712, 0, 0, 4, 1, 1, 713, 0, 0, 4, 1, 1, 714, 0, 0, 4, 1, 1, 715, 0, 0, 4, 1, 1, 716, 0, 0, 4, 1, 1, 717, 0, 0, 4, 1, 1, 718, 0, 0, 4, 1, 1, 719, 0, 0, 4, 1, 1, 720, 0, 0, 4, 1, 1, 721, 0, 0, 4, 1, 1, 722, 0, 0, 4, 1, 1, 723, 0, 0, 4, 1, 1, 724, 0, 0, 4, 1, 1, 725, 0, 0, 4, 1, 1, 726, 0, 0, 4, 1, 1, 727, 0, 0, 4, 1, 1, 728, 0, 0, 4, 1, 1, 729, 0, 0, 4, 1, 1, 730, 0, 0, 4, 1, 1, 731, 0, 0, 4, 1, 1, 732, 0, 0, 4, 1, 1, 733, 0, 0, 4, 1, 1, 734, 0, 0, 4, 1, 1, 735, 0, 0, 4, 1, 1, 736, 0, 0, 4, 1, 1, 737, 0, 0, 4, 1, 1, 738, 0, 0, 4, 1, 1, 739, 0, 0, 4, 1, 1, 740, 0, 0, 4, 1, 1, 741, 0, 0, 4, 1, 1, 742, 0, 0, 4, 1, 1, 743, 0, 0, 4, 1, 1, 744, 0, 0, 4, 1, 1, 745, 0, 0, 4, 1, 1, 746, 0, 0, 4, 1, 1, 747, 0, 0, 4, 1, 1, 748, 0, 0, 4, 1, 1, 749, 0, 0, 4, 1, 1, 750, 0, 0, 4, 1, 1, 751, 0, 0, 4, 1, 1, 752, 0, 0, 4, 1, 1, 0, 5, 0, 4, 1, 1, 0, 6, 0, 4, 1, 1, 0, 7, 0, 4, 1, 1, 0, 8, 0, 4, 1, 1, 0, 9, 0, 4, 1, 1, 0, 10, 0, 4, 1, 1, 0, 11, 0, 4, 1, 1, 0, 12, 0, 4, 1, 1, 0, 13, 0, 4, 1, 1, 0, 14, 0, 4, 1, 1, 0, 15, 0, 4, 1, 1, 0, 16, 0, 4, 1, 1, 0, 17, 0, 4, 1, 1, 0, 18, 0, 4, 1, 1, 0, 19, 0, 4, 1, 1, 0, 20, 0, 4, 1, 1, 0, 21, 0, 4, 1, 1, 0, 22, 0, 4, 1, 1, 0, 23, 0, 4, 1, 1, 0, 24, 0, 4, 1, 1, 0, 25, 0, 4, 1, 1, 0, 26, 0, 4, 1, 1, 0, 27, 0, 4, 1, 1, 0, 28, 0, 4, 1, 1, 0, 29, 0, 4, 1, 1, 0, 30, 0, 4, 1, 1, 0, 31, 0, 4, 1, 1, 0, 32, 0, 4, 1, 1, 0, 33, 0, 4, 1, 1, 0, 34, 0, 4, 1, 1, 0, 35, 0, 4, 1, 1, 0, 36, 0, 4, 1, 1, 0, 37, 0, 4, 1, 1, 0, 38, 0, 4, 1, 1, 0, 39, 0, 4, 1, 1, 0, 40, 0, 4, 1, 1, 0, 41, 0, 4, 1, 1, 0, 42, 0, 4, 1, 1, 0, 43, 0, 4, 1, 1, 0, 44, 0, 4, 1, 1, 0, 45, 0, 4, 1, 1, 0, 46, 0, 4, 1, 1, 0, 47, 0, 4, 1, 1, 0, 48, 0, 4, 1, 1, 0, 49, 0, 4, 1, 1, 0, 50, 0, 4, 1, 1, 0, 51, 0, 4, 1, 1, 0, 4, 0, 4, 1, 1, 0, 52, 0, 4, 1, 1, 0, 53, 0, 4, 1, 1, 0, 54, 0, 4, 1, 1, 0, 55, 0, 4, 1, 1, 0, 56, 0, 4, 1, 1, 0, 57, 0, 4, 1, 1, 0, 58, 0, 4, 1, 1, 0, 3, 0, 4, 1, 1, 0, 59, 0, 4, 1, 1, 0, 60, 0, 4, 1, 1, 0, 61, 0, 4, 1, 1, 0, 62, 0, 4, 1, 1, 0, 63, 0, 4, 1, 1, 0, 64, 0, 4, 1, 1, 0, 65, 0, 4, 1, 1, 0, 66, 0, 4, 1, 1, 0, 67, 0, 4, 1, 1, 0, 68, 0, 4, 1, 1, 0, 69, 0, 4, 1, 1, 0, 70, 0, 4, 1, 1, 0, 71, 0, 4, 1, 1, 0, 72, 0, 4, 1, 1, 0, 73, 0, 4, 1, 1, 0, 74, 0, 4, 1, 1, 0, 75, 0, 4, 1, 1, 0, 76, 0, 4, 1, 1, 0, 77, 0, 4, 1, 1, 0, 78, 0, 4, 1, 1, 0, 79, 0, 4, 1, 1, 0, 80, 0, 4, 1, 1, 0, 81, 0, 4, 1, 1, 0, 82, 0, 4, 1, 1, 0, 83, 0, 4, 1, 1, 0, 84, 0, 4, 1, 1, 0, 85, 0, 4, 1, 1, 0, 86, 0, 4, 1, 1, 0, 87, 0, 4, 1, 1, 0, 88, 0, 4, 1, 1, 0, 89, 0, 4, 1, 1, 0, 90, 0, 4, 1, 1, 0, 91, 0, 4, 1, 1, 0, 92, 0, 4, 1, 1, 0, 93, 0, 4, 1, 1, 0, 94, 0, 4, 1, 1, 0, 95, 0, 4, 1, 1, 0, 96, 0, 4, 1, 1, 0, 97, 0, 4, 1, 1, 0, 98, 0, 4, 1, 0, 12037652484, 2, 16777216, 665, 12037652483, 2, 16777216, 665, 1, 0, 12037652480, 665, 0, 12037652482, 665, 12037652480, 665, 2, 53, 0, 0, 1, 2, 1, 0, 25341984768, 371, 1, 1, 0, 0, 4, 1, 0, 12037652484, 2, 16777216, 665, 12037652483, 2, 16777216, 665, 1, 0, 12037652481, 665, 0, 12037652482, 665, 12037652481, 665, 2, 54, 0, 0, 1, 2, 1, 0, 25341984769, 371, 1, 1, 0, 0, 4, 1, 0, 1ULL, 12037652483, 2, 16777216, 665, 1, 0, 12037652484, 2, 16777216, 665, 2, 1, 55, 0, 12037652483, 2, 16777216, 665, 12037652484, 2, 16777216, 665, 1, 0, 12037652482, 665, 0, 2, 1, 1, 0, 25341984770, 371, 1, 1, 0, 0, 4, 1, 0, 56, 5, 1, 57, 6, 2, 0, 1, 0, 58, 7, 1, 2, 0, 0, 59, 8, 2, 1, 0, 0, 60, 9, 1, 2, 0, 0, 61, 10, 2, 1, 0, 0, 62, 11, 1, 2, 0, 0, 63, 12, 2, 1, 0, 0, 64, 13, 1, 2, 0, 0, 65, 14, 2, 1, 0, 0, 66, 15, 1, 2, 0, 0, 67, 16, 2, 1, 0, 0, 68, 17, 1, 2, 0, 0, 69, 18, 2, 1, 0, 0, 70, 19, 1, 2, 0, 0, 71, 20, 2, 1, 0, 0, 72, 21, 1, 2, 0, 0, 73, 22, 2, 1, 0, 0, 74, 23, 1, 2, 0, 0, 75, 24, 2, 1, 0, 0, 76, 25, 1, 2, 0, 0, 77, 26, 2, 1, 0, 0, 78, 27, 1, 2, 0, 0, 79, 28, 2, 1, 0, 0, 80, 29, 1, 2, 0, 0, 81, 30, 2, 1, 0, 0, 82, 31, 1, 2, 0, 0, 83, 32, 2, 1, 0, 0, 84, 33, 1, 2, 0, 0, 85, 34, 2, 1, 0, 0, 86, 35, 1, 2, 0, 0, 87, 36, 2, 1, 0, 0, 2, 25341984771, 371, 1, 0, 0, 0, 4, 1, 0, 88, 5, 1, 89, 6, 2, 0, 1, 0, 90, 7, 1, 2, 0, 0, 91, 8, 2, 1, 0, 0, 92, 9, 1, 2, 0, 0, 93, 10, 2, 1, 0, 0, 94, 11, 1, 2, 0, 0, 95, 12, 2, 1, 0, 0, 96, 13, 1, 2, 0, 0, 97, 14, 2, 1, 0, 0, 98, 15, 1, 2, 0, 0, 99, 16, 2, 1, 0, 0, 100, 17, 1, 2, 0, 0, 753, 18, 2, 1, 0, 0, 754, 19, 1, 2, 0, 0, 755, 20, 2, 1, 0, 0, 756, 21, 1, 2, 0, 0, 757, 22, 2, 1, 0, 0, 758, 23, 1, 2, 0, 0, 759, 24, 2, 1, 0, 0, 760, 25, 1, 2, 0, 0, 761, 26, 2, 1, 0, 0, 762, 27, 1, 2, 0, 0, 763, 28, 2, 1, 0, 0, 764, 29, 1, 2, 0, 0, 765, 30, 2, 1, 0, 0, 766, 31, 1, 2, 0, 0, 767, 32, 2, 1, 0, 0, 768, 33, 1, 2, 0, 0, 769, 34, 2, 1, 0, 0, 770, 35, 1, 2, 0, 0, 771, 36, 2, 1, 0, 0, 2, 25341984772, 371, 1, 0, 0, 0, 4, 1, 0, 772, 5, 1, 773, 6, 2, 0, 1, 0, 774, 7, 1, 2, 0, 0, 775, 8, 2, 1, 0, 0, 776, 9, 1, 2, 0, 0, 777, 10, 2, 1, 0, 0, 778, 11, 1, 2, 0, 0, 779, 12, 2, 1, 0, 0, 780, 13, 1, 2, 0, 0, 781, 14, 2, 1, 0, 0, 782, 15, 1, 2, 0, 0, 783, 16, 2, 1, 0, 0, 784, 17, 1, 2, 0, 0, 785, 18, 2, 1, 0, 0, 786, 19, 1, 2, 0, 0, 787, 20, 2, 1, 0, 0, 788, 21, 1, 2, 0, 0, 789, 22, 2, 1, 0, 0, 790, 23, 1, 2, 0, 0, 791, 24, 2, 1, 0, 0, 792, 25, 1, 2, 0, 0, 793, 26, 2, 1, 0, 0, 794, 27, 1, 2, 0, 0, 795, 28, 2, 1, 0, 0, 796, 29, 1, 2, 0, 0, 797, 30, 2, 1, 0, 0, 798, 31, 1, 2, 0, 0, 799, 32, 2, 1, 0, 0, 800, 33, 1, 2, 0, 0, 801, 34, 2, 1, 0, 0, 802, 35, 1, 2, 0, 0, 803, 36, 2, 1, 0, 0, 2, 25341984773, 371, 1, 0, 0, 0, 4, 1, 0, 804, 5, 1, 805, 6, 2, 0, 1, 0, 806, 7, 1, 2, 0, 0, 807, 8, 2, 1, 0, 0, 808, 9, 1, 2, 0, 0, 809, 10, 2, 1, 0, 0, 810, 11, 1, 2, 0, 0, 811, 12, 2, 1, 0, 0, 812, 13, 1, 2, 0, 0, 813, 14, 2, 1, 0, 0, 814, 15, 1, 2, 0, 0, 815, 16, 2, 1, 0, 0, 816, 17, 1, 2, 0, 0, 817, 18, 2, 1, 0, 0, 818, 19, 1, 2, 0, 0, 819, 20, 2, 1, 0, 0, 820, 21, 1, 2, 0, 0, 821, 22, 2, 1, 0, 0, 822, 23, 1, 2, 0, 0, 823, 24, 2, 1, 0, 0, 824, 25, 1, 2, 0, 0, 825, 26, 2, 1, 0, 0, 826, 27, 1, 2, 0, 0, 827, 28, 2, 1, 0, 0, 828, 29, 1, 2, 0, 0, 829, 30, 2, 1, 0, 0, 830, 31, 1, 2, 0, 0, 831, 32, 2, 1, 0, 0, 832, 33, 1, 2, 0, 0, 833, 34, 2, 1, 0, 0, 834, 35, 1, 2, 0, 0, 835, 36, 2, 1, 0, 0, 2, 25341984774, 371, 1, 0, 0, 0, 4, 1, 0, 836, 5, 1, 837, 6, 2, 0, 1, 0, 838, 7, 1, 2, 0, 0, 839, 8, 2, 1, 0, 0, 840, 9, 1, 2, 0, 0, 841, 10, 2, 1, 0, 0, 842, 11, 1, 2, 0, 0, 843, 12, 2, 1, 0, 0, 844, 13, 1, 2, 0, 0, 845, 14, 2, 1, 0, 0, 846, 15, 1, 2, 0, 0, 847, 16, 2, 1, 0, 0, 848, 17, 1, 2, 0, 0, 849, 18, 2, 1, 0, 0, 850, 19, 1, 2, 0, 0, 851, 20, 2, 1, 0, 0, 852, 21, 1, 2, 0, 0, 853, 22, 2, 1, 0, 0, 854, 23, 1, 2, 0, 0, 855, 24, 2, 1, 0, 0, 856, 25, 1, 2, 0, 0, 857, 26, 2, 1, 0, 0, 858, 27, 1, 2, 0, 0, 859, 28, 2, 1, 0, 0, 860, 29, 1, 2, 0, 0, 861, 30, 2, 1, 0, 0, 862, 31, 1, 2, 0, 0, 863, 32, 2, 1, 0, 0, 864, 33, 1, 2, 0, 0, 865, 34, 2, 1, 0, 0, 866, 35, 1, 2, 0, 0, 867, 36, 2, 1, 0, 0, 2, 25341984775, 371, 1, 0, 0, 0, 4, 1, 0, 868, 868, 1, 0, 25341984776, 371, 1, 1, 0, 0, 4, 1, 0, 25341984776, 371, 869, 1, 0, 25341984777, 371, 1, 1, 0, 0, 4, 1, 0, 870, 870, 1, 0, 25341984778, 371, 1, 1, 0, 0, 4, 1, 0, 25341984778, 371, 871, 1, 0, 25341984779, 371, 1, 1, 0, 0, 4, 1, 0, 872, 872, 1, 0, 25341984780, 371, 1, 1, 0, 0, 4, 1, 0, 25341984780, 371, 873, 1, 0, 25341984781, 371, 1, 1, 0, 0, 4, 1, 0, 874, 874, 1, 0, 25341984782, 371, 1, 1, 0, 0, 4, 1, 0, 25341984782, 371, 875, 1, 0, 25341984783, 371, 1, 1, 0, 0, 4, 1, 0, 876, 876, 1, 0, 25341984784, 371, 1, 1, 0, 0, 4, 1, 0, 25341984784, 371, 877, 1, 0, 25341984785, 371, 1, 1, 0, 0, 4, 1, 0, 878, 878, 1, 0, 25341984786, 371, 1, 1, 0, 0, 4, 1, 0, 25341984786, 371, 879, 1, 0, 25341984787, 371, 1, 1, 0, 0, 4, 1, 0, 880, 880, 1, 0, 25341984788, 371, 1, 1, 0, 0, 4, 1, 0, 25341984788, 371, 881, 1, 0, 25341984789, 371, 1, 1, 0, 0, 4, 1, 0, 882, 882, 1, 0, 25341984790, 371, 1, 1, 0, 0, 4, 1, 0, 25341984790, 371, 883, 1, 0, 25341984791, 371, 1, 1, 0, 0, 4, 1, 0, 884, 884, 1, 0, 25341984792, 371, 1, 1, 0, 0, 4, 1, 0, 25341984792, 371, 885, 1, 0, 25341984793, 371, 1, 1, 0, 0, 4, 1, 0, 886, 886, 1, 0, 25341984794, 371, 1, 1, 0, 0, 4, 1, 0, 25341984794, 371, 887, 1, 0, 25341984795, 371, 1, 1, 0, 0, 4, 1, 0, 888, 888, 1, 0, 25341984796, 371, 1, 1, 0, 0, 4, 1, 0, 25341984796, 371, 889, 1, 0, 25341984797, 371, 1, 1, 0, 0, 4, 1, 0, 890, 890, 1, 0, 25341984798, 371, 1, 1, 0, 0, 4, 1, 0, 25341984798, 371, 891, 1, 0, 25341984799, 371, 1, 1, 0, 0, 4, 1, 0, 25ULL, 892, 1, 15ULL, 893, 2, 0, 1, 0, 41ULL, 894, 1, 2, 0, 0, 16ULL, 895, 2, 1, 0, 0, 2ULL, 896, 1, 2, 0, 0, 28ULL, 897, 2, 1, 0, 0, 13ULL, 898, 1, 2, 0, 0, 13ULL, 899, 2, 1, 0, 0, 39ULL, 900, 1, 2, 0, 0, 18ULL, 901, 2, 1, 0, 0, 34ULL, 902, 1, 2, 0, 0, 20ULL, 903, 2, 1, 0, 0, 2, 25341984800, 371, 1, 0, 0, 0, 4, 1, 0, 20ULL, 892, 1, 17ULL, 893, 2, 0, 1, 0, 15ULL, 894, 1, 2, 0, 0, 41ULL, 895, 2, 1, 0, 0, 16ULL, 896, 1, 2, 0, 0, 2ULL, 897, 2, 1, 0, 0, 28ULL, 898, 1, 2, 0, 0, 13ULL, 899, 2, 1, 0, 0, 13ULL, 900, 1, 2, 0, 0, 39ULL, 901, 2, 1, 0, 0, 18ULL, 902, 1, 2, 0, 0, 34ULL, 903, 2, 1, 0, 0, 2, 25341984801, 371, 1, 0, 0, 0, 4, 1, 0, 34ULL, 892, 1, 20ULL, 893, 2, 0, 1, 0, 17ULL, 894, 1, 2, 0, 0, 15ULL, 895, 2, 1, 0, 0, 41ULL, 896, 1, 2, 0, 0, 16ULL, 897, 2, 1, 0, 0, 2ULL, 898, 1, 2, 0, 0, 28ULL, 899, 2, 1, 0, 0, 13ULL, 900, 1, 2, 0, 0, 13ULL, 901, 2, 1, 0, 0, 39ULL, 902, 1, 2, 0, 0, 18ULL, 903, 2, 1, 0, 0, 2, 25341984802, 371, 1, 0, 0, 0, 4, 1, 0, 18ULL, 892, 1, 34ULL, 893, 2, 0, 1, 0, 20ULL, 894, 1, 2, 0, 0, 17ULL, 895, 2, 1, 0, 0, 15ULL, 896, 1, 2, 0, 0, 41ULL, 897, 2, 1, 0, 0, 16ULL, 898, 1, 2, 0, 0, 2ULL, 899, 2, 1, 0, 0, 28ULL, 900, 1, 2, 0, 0, 13ULL, 901, 2, 1, 0, 0, 13ULL, 902, 1, 2, 0, 0, 39ULL, 903, 2, 1, 0, 0, 2, 25341984803, 371, 1, 0, 0, 0, 4, 1, 0, 39ULL, 892, 1, 18ULL, 893, 2, 0, 1, 0, 34ULL, 894, 1, 2, 0, 0, 20ULL, 895, 2, 1, 0, 0, 17ULL, 896, 1, 2, 0, 0, 15ULL, 897, 2, 1, 0, 0, 41ULL, 898, 1, 2, 0, 0, 16ULL, 899, 2, 1, 0, 0, 2ULL, 900, 1, 2, 0, 0, 28ULL, 901, 2, 1, 0, 0, 13ULL, 902, 1, 2, 0, 0, 13ULL, 903, 2, 1, 0, 0, 2, 25341984804, 371, 1, 0, 0, 0, 4, 1, 0, 13ULL, 892, 1, 39ULL, 893, 2, 0, 1, 0, 18ULL, 894, 1, 2, 0, 0, 34ULL, 895, 2, 1, 0, 0, 20ULL, 896, 1, 2, 0, 0, 17ULL, 897, 2, 1, 0, 0, 15ULL, 898, 1, 2, 0, 0, 41ULL, 899, 2, 1, 0, 0, 16ULL, 900, 1, 2, 0, 0, 2ULL, 901, 2, 1, 0, 0, 28ULL, 902, 1, 2, 0, 0, 13ULL, 903, 2, 1, 0, 0, 2, 25341984805, 371, 1, 0, 0, 0, 4, 1, 0, 13ULL, 892, 1, 13ULL, 893, 2, 0, 1, 0, 39ULL, 894, 1, 2, 0, 0, 18ULL, 895, 2, 1, 0, 0, 34ULL, 896, 1, 2, 0, 0, 20ULL, 897, 2, 1, 0, 0, 17ULL, 898, 1, 2, 0, 0, 15ULL, 899, 2, 1, 0, 0, 41ULL, 900, 1, 2, 0, 0, 16ULL, 901, 2, 1, 0, 0, 2ULL, 902, 1, 2, 0, 0, 28ULL, 903, 2, 1, 0, 0, 2, 25341984806, 371, 1, 0, 0, 0, 4, 1, 0, 28ULL, 892, 1, 13ULL, 893, 2, 0, 1, 0, 13ULL, 894, 1, 2, 0, 0, 39ULL, 895, 2, 1, 0, 0, 18ULL, 896, 1, 2, 0, 0, 34ULL, 897, 2, 1, 0, 0, 20ULL, 898, 1, 2, 0, 0, 17ULL, 899, 2, 1, 0, 0, 15ULL, 900, 1, 2, 0, 0, 41ULL, 901, 2, 1, 0, 0, 16ULL, 902, 1, 2, 0, 0, 2ULL, 903, 2, 1, 0, 0, 2, 25341984807, 371, 1, 0, 0, 0, 4, 1, 0, 2ULL, 892, 1, 28ULL, 893, 2, 0, 1, 0, 13ULL, 894, 1, 2, 0, 0, 13ULL, 895, 2, 1, 0, 0, 39ULL, 896, 1, 2, 0, 0, 18ULL, 897, 2, 1, 0, 0, 34ULL, 898, 1, 2, 0, 0, 20ULL, 899, 2, 1, 0, 0, 17ULL, 900, 1, 2, 0, 0, 15ULL, 901, 2, 1, 0, 0, 41ULL, 902, 1, 2, 0, 0, 16ULL, 903, 2, 1, 0, 0, 2, 25341984808, 371, 1, 0, 0, 0, 4, 1, 0, 16ULL, 892, 1, 2ULL, 893, 2, 0, 1, 0, 28ULL, 894, 1, 2, 0, 0, 13ULL, 895, 2, 1, 0, 0, 13ULL, 896, 1, 2, 0, 0, 39ULL, 897, 2, 1, 0, 0, 18ULL, 898, 1, 2, 0, 0, 34ULL, 899, 2, 1, 0, 0, 20ULL, 900, 1, 2, 0, 0, 17ULL, 901, 2, 1, 0, 0, 15ULL, 902, 1, 2, 0, 0, 41ULL, 903, 2, 1, 0, 0, 2, 25341984809, 371, 1, 0, 0, 0, 4, 1, 0, 41ULL, 892, 1, 16ULL, 893, 2, 0, 1, 0, 2ULL, 894, 1, 2, 0, 0, 28ULL, 895, 2, 1, 0, 0, 13ULL, 896, 1, 2, 0, 0, 13ULL, 897, 2, 1, 0, 0, 39ULL, 898, 1, 2, 0, 0, 18ULL, 899, 2, 1, 0, 0, 34ULL, 900, 1, 2, 0, 0, 20ULL, 901, 2, 1, 0, 0, 17ULL, 902, 1, 2, 0, 0, 15ULL, 903, 2, 1, 0, 0, 2, 25341984810, 371, 1, 0, 0, 0, 4, 1, 0, 15ULL, 892, 1, 41ULL, 893, 2, 0, 1, 0, 16ULL, 894, 1, 2, 0, 0, 2ULL, 895, 2, 1, 0, 0, 28ULL, 896, 1, 2, 0, 0, 13ULL, 897, 2, 1, 0, 0, 13ULL, 898, 1, 2, 0, 0, 39ULL, 899, 2, 1, 0, 0, 18ULL, 900, 1, 2, 0, 0, 34ULL, 901, 2, 1, 0, 0, 20ULL, 902, 1, 2, 0, 0, 17ULL, 903, 2, 1, 0, 0, 2, 25341984811, 371, 1, 0, 0, 0, 4, 1, 0, 904, 12037652778, 665, 1, 146, 0, 0, 1, 25341984812, 371, 1, 0, 0, 0, 4, 1, 0, 904, 12037652778, 665, 1, 1ULL, 0, 0, 1, 12037652774, 665, 1, 0, 904, 0, 128ULL, 25341984812, 371, 2, 1, 0, 0, 2, 25341984813, 371, 1, 0, 0, 0, 4, 1, 0, 12037652794, 665, 25341984813, 371, 1, 0, 12037652802, 665, 0, 1, 25341984814, 371, 1, 0, 0, 0, 4, 1, 0, 12037652795, 665, 25341984813, 371, 1, 0, 12037652803, 665, 0, 1, 25341984815, 371, 1, 0, 0, 0, 4, 1, 0, 12037652796, 665, 25341984813, 371, 1, 0, 12037652804, 665, 0, 1, 25341984816, 371, 1, 0, 0, 0, 4, 1, 0, 12037652797, 665, 25341984813, 371, 1, 0, 12037652805, 665, 0, 1, 25341984817, 371, 1, 0, 0, 0, 4, 1, 0, 12037652798, 665, 25341984813, 371, 1, 0, 12037652806, 665, 0, 1, 25341984818, 371, 1, 0, 0, 0, 4, 1, 0, 12037652799, 665, 25341984813, 371, 1, 0, 12037652807, 665, 0, 1, 25341984819, 371, 1, 0, 0, 0, 4, 1, 0, 12037652800, 665, 25341984813, 371, 1, 0, 12037652808, 665, 0, 1, 25341984820, 371, 1, 0, 0, 0, 4, 1, 0, 12037652801, 665, 25341984813, 371, 1, 0, 12037652809, 665, 0, 1, 25341984821, 371, 1, 0, 0, 0, 4, 1, 0, 905, 12037652893, 665, 1, 1ULL, 0, 0, 1, 25341984822, 371, 1, 0, 0, 0, 4, 1, 0, 906, 25341984823, 371, 1, 0, 0, 0, 4, 1, 0, 907, 12037652925, 665, 1, 213, 0, 0, 1, 25341984824, 371, 1, 0, 0, 0, 4, 1, 0, 907, 12037652925, 665, 1, 214, 0, 0, 1, 25341984825, 371, 1, 0, 0, 0, 4, 1, 0, 907, 12037652925, 665, 1, 1ULL, 0, 0, 1, 12037652920, 665, 1, 0, 907, 0, 128ULL, 25341984824, 371, 2, 1, 0, 0, 2, 25341984826, 371, 1, 0, 0, 0, 4, 1, 0, 12037652941, 665, 25341984826, 371, 1, 0, 12037652949, 665, 0, 1, 25341984827, 371, 1, 0, 0, 0, 4, 1, 0, 12037652942, 665, 25341984826, 371, 1, 0, 12037652950, 665, 0, 1, 25341984828, 371, 1, 0, 0, 0, 4, 1, 0, 12037652943, 665, 25341984826, 371, 1, 0, 12037652951, 665, 0, 1, 25341984829, 371, 1, 0, 0, 0, 4, 1, 0, 12037652944, 665, 25341984826, 371, 1, 0, 12037652952, 665, 0, 1, 25341984830, 371, 1, 0, 0, 0, 4, 1, 0, 12037652945, 665, 25341984826, 371, 1, 0, 12037652953, 665, 0, 1, 25341984831, 371, 1, 0, 0, 0, 4, 1, 0, 12037652946, 665, 25341984826, 371, 1, 0, 12037652954, 665, 0, 1, 25341984832, 371, 1, 0, 0, 0, 4, 1, 0, 12037652947, 665, 25341984826, 371, 1, 0, 12037652955, 665, 0, 1, 25341984833, 371, 1, 0, 0, 0, 4, 1, 0, 12037652948, 665, 25341984826, 371, 1, 0, 12037652956, 665, 0, 1, 25341984834, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 908, 1, 1ULL, 12037652969, 665, 2, 0, 1, 0, 2, 25341984835, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 908, 1, 0, 12037652969, 665, 0, 1, 25341984836, 371, 1, 0, 0, 0, 4, 1, 0, 909, 12037653132, 665, 1, 1ULL, 0, 0, 1, 25341984837, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 911, 1, 12037653104, 665, 0, 0, 1, 25341984838, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 12037653107, 665, 1, 12037653072, 665, 0, 0, 1ULL, 12037653082, 665, 2, 12037653073, 665, 0, 3, 1, 2, 0, 1ULL, 25341984837, 371, 1, 12037653074, 665, 0, 0, 3, 1, 1, 0, 25341984839, 371, 1, 1, 0, 0, 4, 1, 0, 12037653133, 665, 910, 1, 12037653135, 665, 0, 0, 12037653023, 665, 910, 2, 12037653106, 665, 0, 0, 1, 2, 1, 0, 910, 0, 1, 25341984840, 371, 1, 0, 0, 0, 4, 1, 1, 12037653022, 665, 1ULL, 0, 1ULL, 911, 2, 0, 12037653104, 665, 0, 1, 2, 1, 0, 25341984841, 371, 1, 1, 0, 0, 4, 1, 0, 912, 215, 1, 0, 25341984842, 371, 1, 1, 0, 0, 4, 1, 0, 913, 147, 1, 0, 25341984843, 371, 1, 1, 0, 2, 4, 1, 0, 914, 0, 1, 101, 0, 0, 0, 1, 1, 102, 0, 0, 0, 1, 1, 103, 0, 0, 0, 1, 1, 104, 0, 0, 0, 1, 1, 105, 0, 0, 0, 1, 1, 106, 0, 0, 0, 1, 1, 107, 0, 0, 0, 1, 1, 108, 0, 0, 0, 1, 1, 915, 0, 0, 0, 1, 1, 916, 0, 0, 0, 1, 1, 917, 0, 0, 0, 1, 1, 918, 0, 0, 0, 1, 1, 919, 0, 0, 0, 1, 1, 920, 0, 0, 0, 1, 1, 921, 0, 0, 1, 115, 1, 922, 0, 0, 1, 115, 1, 0, 25341984989, 371, 0, 2, 1, 1, 4, 0, 0, 923, 925, 1, 0, 924, 0, 1, 925, 1, 0, 25341984844, 371, 0, 1, 1, 2, 4, 0, 0, 109, 0, 1, 926, 0, 0, 0, 1, 1, 927, 0, 0, 0, 1, 1, 928, 0, 0, 0, 1, 1, 929, 0, 0, 0, 1, 1, 930, 0, 0, 0, 1, 1, 931, 0, 0, 0, 1, 1, 932, 0, 0, 0, 1, 1, 933, 0, 0, 0, 1, 1, 934, 0, 0, 0, 1, 1, 935, 0, 0, 1, 147, 1, 936, 0, 0, 1, 147, 1, 0, 25341984992, 371, 0, 2, 1, 2, 4, 0, 0, 937, 0, 1, 938, 0, 0, 0, 1, 1, 939, 0, 0, 0, 1, 1, 940, 0, 0, 0, 1, 1, 941, 0, 0, 0, 1, 1, 942, 0, 0, 0, 1, 1, 943, 0, 0, 0, 1, 1, 944, 0, 0, 0, 1, 1, 945, 0, 0, 0, 1, 1, 946, 0, 0, 0, 1, 1, 947, 0, 0, 1, 149, 1, 948, 0, 0, 1, 149, 1, 0, 25341984995, 371, 0, 2, 1, 4, 4, 0, 3, 99, 2, 0, 3, 100, 1, 101, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341984998, 371, 1, 4, 0, 4, 4, 1, 3, 102, 2, 0, 3, 103, 1, 104, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985001, 371, 1, 4, 0, 4, 4, 1, 3, 949, 2, 0, 950, 3, 1, 951, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985004, 371, 1, 4, 0, 4, 4, 1, 3, 952, 2, 0, 953, 3, 1, 954, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985007, 371, 1, 4, 0, 4, 4, 1, 3, 955, 2, 0, 956, 3, 1, 957, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985010, 371, 1, 4, 0, 4, 4, 1, 3, 958, 2, 0, 959, 3, 1, 960, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985013, 371, 1, 4, 0, 4, 4, 1, 3, 105, 2, 0, 3, 106, 1, 107, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985016, 371, 1, 4, 0, 4, 4, 1, 3, 961, 2, 0, 962, 3, 1, 963, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985019, 371, 1, 4, 0, 4, 4, 1, 3, 964, 2, 0, 965, 3, 1, 966, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985022, 371, 1, 4, 0, 4, 4, 1, 3, 967, 2, 0, 968, 3, 1, 969, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985025, 371, 1, 4, 0, 4, 4, 1, 3, 108, 2, 0, 3, 109, 1, 110, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985028, 371, 1, 4, 0, 4, 4, 1, 3, 111, 2, 0, 3, 112, 1, 113, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985031, 371, 1, 4, 0, 4, 4, 1, 3, 970, 2, 0, 971, 3, 1, 972, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985034, 371, 1, 4, 0, 4, 4, 1, 3, 25341984989, 371, 2, 0, 3, 114, 1, 115, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985037, 371, 1, 4, 0, 4, 4, 1, 3, 116, 2, 0, 3, 117, 1, 118, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985040, 371, 1, 4, 0, 4, 4, 1, 3, 119, 2, 0, 3, 120, 1, 121, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985043, 371, 1, 4, 0, 4, 4, 1, 3, 122, 2, 0, 3, 123, 1, 124, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985046, 371, 1, 4, 0, 4, 4, 1, 3, 125, 2, 0, 3, 126, 1, 127, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985049, 371, 1, 4, 0, 4, 4, 1, 3, 128, 2, 0, 3, 129, 1, 130, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985052, 371, 1, 4, 0, 4, 4, 1, 3, 131, 2, 0, 3, 132, 1, 133, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985055, 371, 1, 4, 0, 4, 4, 1, 3, 134, 2, 0, 3, 135, 1, 136, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985058, 371, 1, 4, 0, 4, 4, 1, 3, 137, 2, 0, 3, 138, 1, 139, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985061, 371, 1, 4, 0, 4, 4, 1, 3, 140, 2, 0, 3, 141, 1, 142, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985064, 371, 1, 4, 0, 4, 4, 1, 3, 973, 2, 0, 974, 3, 1, 975, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985067, 371, 1, 4, 0, 4, 4, 1, 3, 143, 2, 0, 3, 144, 1, 145, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985070, 371, 1, 4, 0, 4, 4, 1, 3, 25341984992, 371, 2, 0, 3, 146, 1, 147, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985073, 371, 1, 4, 0, 4, 4, 1, 3, 25341984995, 371, 2, 0, 3, 148, 1, 149, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985076, 371, 1, 4, 0, 2, 4, 1, 0, 150, 3, 1, 0, 25341985079, 371, 0, 2, 1, 1, 4, 0, 0, 151, 3, 2, 0, 25341985082, 371, 0, 1, 2, 1, 4, 0, 0, 152, 3, 2, 0, 25341985085, 371, 0, 1, 2, 1, 4, 0, 0, 153, 3, 2, 0, 25341985088, 371, 0, 1, 2, 1, 4, 0, 0, 154, 3, 2, 0, 25341985091, 371, 0, 1, 2, 1, 4, 0, 0, 155, 3, 2, 0, 25341985094, 371, 0, 1, 2, 1, 4, 0, 0, 156, 3, 2, 0, 25341985097, 371, 0, 1, 2, 1, 4, 0, 0, 157, 3, 2, 0, 25341985100, 371, 0, 1, 2, 1, 4, 0, 0, 158, 3, 2, 0, 25341985103, 371, 0, 1, 2, 1, 4, 0, 0, 159, 3, 2, 0, 25341985106, 371, 0, 1, 2, 1, 4, 0, 0, 160, 3, 2, 0, 25341985109, 371, 0, 1, 2, 1, 4, 0, 0, 161, 3, 2, 0, 25341985112, 371, 0, 1, 2, 1, 4, 0, 0, 162, 3, 2, 0, 25341985115, 371, 0, 1, 2, 1, 4, 0, 0, 163, 3, 2, 0, 25341985118, 371, 0, 1, 2, 1, 4, 0, 0, 164, 3, 2, 0, 25341985121, 371, 0, 1, 2, 1, 4, 0, 0, 165, 3, 2, 0, 25341985124, 371, 0, 1, 2, 2, 4, 0, 0, 4756475762779100925ULL, 3, 1, 0, 0, 5, 1, 1, 0, 2, 0, 166, 1, 1, 0, 25341985127, 371, 0, 2, 1, 2, 4, 0, 0, 4, 3, 1, 5, 0, 0, 1, 2, 1, 167, 0, 0, 1, 25341985130, 371, 1, 2, 0, 2, 4, 1, 0, 4756475762779100925ULL, 3, 1, 0, 0, 7, 1, 1, 0, 2, 0, 168, 1, 1, 0, 25341985133, 371, 0, 2, 1, 2, 4, 0, 0, 6, 3, 1, 7, 0, 0, 1, 2, 1, 169, 0, 0, 1, 25341985136, 371, 1, 2, 0, 1};
+inline uint64_t args42[NARGS_] = { 3, 5, 0, 1ULL, 3, 1, 0, 12037652483, 2, 16777216, 665, 0, 1ULL, 3, 2, 0, 12037652483, 665, 122, 1, 2, 0, 1ULL, 3, 1, 0, 12037652534, 2, 16777216, 665, 0, 1ULL, 3, 2, 0, 12037652534, 665, 123, 1, 2, 0, 1ULL, 3, 1, 0, 12037652484, 2, 16777216, 665, 0, 1ULL, 3, 2, 0, 12037652484, 665, 124, 1, 2, 0, 1ULL, 3, 1, 0, 12037652535, 665, 125, 1, 0ULL, 0, 1ULL, 3, 1, 0, 12037652536, 665, 126, 1, 0ULL, 0, 1ULL, 3, 1, 0, 12037652537, 665, 127, 1, 0ULL, 0, 1ULL, 12037652535, 665, 1, 12037652535, 665, 0, 128, 1, 0ULL, 0, 1ULL, 12037652536, 665, 1, 12037652536, 665, 0, 129, 1, 0ULL, 0, 1ULL, 12037652537, 665, 1, 12037652537, 665, 0, 130, 1, 0ULL, 0, 1ULL, 12037652484, 665, 1, 0, 12037652536, 665, 131, 1, 0ULL, 0, 1ULL, 12037652483, 665, 1, 0, 12037652537, 665, 132, 1, 0ULL, 0, 12037652484, 665, 12037652483, 665, 1, 0, 12037652535, 665, 133, 1, 0ULL, 0, 1ULL, 3, 1, 0, 12037652485, 665, 0, 12037652480, 665, 85, 2, 1, 0, 134, 12037652485, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652486, 665, 0, 12037652480, 665, 86, 2, 1, 0, 135, 12037652486, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652487, 665, 0, 12037652480, 665, 87, 2, 1, 0, 136, 12037652487, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652488, 665, 0, 12037652480, 665, 88, 2, 1, 0, 137, 12037652488, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652489, 665, 0, 12037652480, 665, 89, 2, 1, 0, 138, 12037652489, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652490, 665, 0, 12037652480, 665, 90, 2, 1, 0, 139, 12037652490, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652491, 665, 0, 12037652480, 665, 91, 2, 1, 0, 140, 12037652491, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652492, 665, 0, 12037652480, 665, 92, 2, 1, 0, 141, 12037652492, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652493, 665, 0, 12037652481, 665, 85, 2, 1, 0, 142, 12037652493, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652494, 665, 0, 12037652481, 665, 86, 2, 1, 0, 143, 12037652494, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652495, 665, 0, 12037652481, 665, 87, 2, 1, 0, 144, 12037652495, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652496, 665, 0, 12037652481, 665, 88, 2, 1, 0, 145, 12037652496, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652497, 665, 0, 12037652481, 665, 89, 2, 1, 0, 146, 12037652497, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652498, 665, 0, 12037652481, 665, 90, 2, 1, 0, 147, 12037652498, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652499, 665, 0, 12037652481, 665, 91, 2, 1, 0, 148, 12037652499, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652500, 665, 0, 12037652481, 665, 92, 2, 1, 0, 149, 12037652500, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652501, 665, 0, 25341984768, 371, 85, 2, 1, 0, 150, 12037652501, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652502, 665, 0, 25341984768, 371, 86, 2, 1, 0, 151, 12037652502, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652503, 665, 0, 25341984768, 371, 87, 2, 1, 0, 152, 12037652503, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652504, 665, 0, 25341984768, 371, 88, 2, 1, 0, 153, 12037652504, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652505, 665, 0, 25341984768, 371, 89, 2, 1, 0, 154, 12037652505, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652506, 665, 0, 25341984768, 371, 90, 2, 1, 0, 155, 12037652506, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652507, 665, 0, 25341984768, 371, 91, 2, 1, 0, 156, 12037652507, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652508, 665, 0, 25341984768, 371, 92, 2, 1, 0, 157, 12037652508, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652509, 665, 0, 25341984769, 371, 85, 2, 1, 0, 158, 12037652509, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652510, 665, 0, 25341984769, 371, 86, 2, 1, 0, 159, 12037652510, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652511, 665, 0, 25341984769, 371, 87, 2, 1, 0, 160, 12037652511, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652512, 665, 0, 25341984769, 371, 88, 2, 1, 0, 161, 12037652512, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652513, 665, 0, 25341984769, 371, 89, 2, 1, 0, 162, 12037652513, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652514, 665, 0, 25341984769, 371, 90, 2, 1, 0, 163, 12037652514, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652515, 665, 0, 25341984769, 371, 91, 2, 1, 0, 164, 12037652515, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652516, 665, 0, 25341984769, 371, 92, 2, 1, 0, 165, 12037652516, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652517, 665, 0, 12037652526, 665, 25341984770, 371, 2, 1, 0, 166, 12037652517, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652518, 665, 0, 12037652527, 665, 25341984770, 371, 2, 1, 0, 167, 12037652518, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652519, 665, 0, 12037652528, 665, 25341984770, 371, 2, 1, 0, 168, 12037652519, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652520, 665, 0, 12037652529, 665, 25341984770, 371, 2, 1, 0, 169, 12037652520, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652521, 665, 0, 12037652530, 665, 25341984770, 371, 2, 1, 0, 170, 12037652521, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652522, 665, 0, 12037652531, 665, 25341984770, 371, 2, 1, 0, 171, 12037652522, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652523, 665, 0, 12037652532, 665, 25341984770, 371, 2, 1, 0, 172, 12037652523, 2, 16777216, 665, 2, 0, 1ULL, 3, 1, 0, 12037652524, 665, 0, 12037652533, 665, 25341984770, 371, 2, 1, 0, 173, 12037652524, 2, 16777216, 665, 2, 0, 1ULL, 12037652698, 665, 1, 12037652698, 665, 0, 174, 1, 0ULL, 0, 1ULL, 12037652699, 665, 1, 12037652699, 665, 0, 175, 1, 0ULL, 0, 1ULL, 12037652700, 665, 1, 12037652700, 665, 0, 176, 1, 0ULL, 0, 1ULL, 36, 1, 12037652538, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652538, 665, 0, 177, 1, 2, 0, 1ULL, 36, 1, 12037652539, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652539, 665, 0, 178, 1, 2, 0, 1ULL, 36, 1, 12037652540, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652540, 665, 0, 179, 1, 2, 0, 1ULL, 36, 1, 12037652541, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652541, 665, 0, 180, 1, 2, 0, 1ULL, 36, 1, 12037652542, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652542, 665, 0, 181, 1, 2, 0, 1ULL, 36, 1, 12037652543, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652543, 665, 0, 182, 1, 2, 0, 1ULL, 36, 1, 12037652544, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652544, 665, 0, 183, 1, 2, 0, 1ULL, 36, 1, 12037652545, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652545, 665, 0, 184, 1, 2, 0, 1ULL, 36, 1, 12037652546, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652546, 665, 0, 185, 1, 2, 0, 1ULL, 36, 1, 12037652547, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652547, 665, 0, 186, 1, 2, 0, 1ULL, 36, 1, 12037652548, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652548, 665, 0, 187, 1, 2, 0, 1ULL, 36, 1, 12037652549, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652549, 665, 0, 188, 1, 2, 0, 1ULL, 36, 1, 12037652550, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652550, 665, 0, 189, 1, 2, 0, 1ULL, 36, 1, 12037652551, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652551, 665, 0, 190, 1, 2, 0, 1ULL, 36, 1, 12037652552, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652552, 665, 0, 191, 1, 2, 0, 1ULL, 36, 1, 12037652553, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652553, 665, 0, 192, 1, 2, 0, 1ULL, 36, 1, 12037652554, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652554, 665, 0, 193, 1, 2, 0, 1ULL, 36, 1, 12037652555, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652555, 665, 0, 194, 1, 2, 0, 1ULL, 36, 1, 12037652556, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652556, 665, 0, 195, 1, 2, 0, 1ULL, 36, 1, 12037652557, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652557, 665, 0, 196, 1, 2, 0, 1ULL, 36, 1, 12037652558, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652558, 665, 0, 197, 1, 2, 0, 1ULL, 36, 1, 12037652559, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652559, 665, 0, 198, 1, 2, 0, 1ULL, 36, 1, 12037652560, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652560, 665, 0, 199, 1, 2, 0, 1ULL, 36, 1, 12037652561, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652561, 665, 0, 200, 1, 2, 0, 1ULL, 36, 1, 12037652562, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652562, 665, 0, 201, 1, 2, 0, 1ULL, 36, 1, 12037652563, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652563, 665, 0, 202, 1, 2, 0, 1ULL, 36, 1, 12037652564, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652564, 665, 0, 203, 1, 2, 0, 1ULL, 36, 1, 12037652565, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652565, 665, 0, 204, 1, 2, 0, 1ULL, 36, 1, 12037652566, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652566, 665, 0, 205, 1, 2, 0, 1ULL, 36, 1, 12037652567, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652567, 665, 0, 206, 1, 2, 0, 1ULL, 36, 1, 12037652568, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652568, 665, 0, 207, 1, 2, 0, 1ULL, 36, 1, 12037652569, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652569, 665, 0, 208, 1, 2, 0, 1ULL, 36, 1, 12037652570, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652570, 665, 0, 209, 1, 2, 0, 1ULL, 36, 1, 12037652571, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652571, 665, 0, 210, 1, 2, 0, 1ULL, 36, 1, 12037652572, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652572, 665, 0, 211, 1, 2, 0, 1ULL, 36, 1, 12037652573, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652573, 665, 0, 212, 1, 2, 0, 1ULL, 36, 1, 12037652574, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652574, 665, 0, 213, 1, 2, 0, 1ULL, 36, 1, 12037652575, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652575, 665, 0, 214, 1, 2, 0, 1ULL, 36, 1, 12037652576, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652576, 665, 0, 215, 1, 2, 0, 1ULL, 36, 1, 12037652577, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652577, 665, 0, 216, 1, 2, 0, 1ULL, 36, 1, 12037652578, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652578, 665, 0, 217, 1, 2, 0, 1ULL, 36, 1, 12037652579, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652579, 665, 0, 218, 1, 2, 0, 1ULL, 36, 1, 12037652580, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652580, 665, 0, 219, 1, 2, 0, 1ULL, 36, 1, 12037652581, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652581, 665, 0, 220, 1, 2, 0, 1ULL, 36, 1, 12037652582, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652582, 665, 0, 221, 1, 2, 0, 1ULL, 36, 1, 12037652583, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652583, 665, 0, 222, 1, 2, 0, 1ULL, 36, 1, 12037652584, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652584, 665, 0, 223, 1, 2, 0, 1ULL, 36, 1, 12037652585, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652585, 665, 0, 224, 1, 2, 0, 1ULL, 36, 1, 12037652586, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652586, 665, 0, 225, 1, 2, 0, 1ULL, 36, 1, 12037652587, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652587, 665, 0, 226, 1, 2, 0, 1ULL, 36, 1, 12037652588, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652588, 665, 0, 227, 1, 2, 0, 1ULL, 36, 1, 12037652589, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652589, 665, 0, 228, 1, 2, 0, 1ULL, 36, 1, 12037652590, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652590, 665, 0, 229, 1, 2, 0, 1ULL, 36, 1, 12037652591, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652591, 665, 0, 230, 1, 2, 0, 1ULL, 36, 1, 12037652592, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652592, 665, 0, 231, 1, 2, 0, 1ULL, 36, 1, 12037652593, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652593, 665, 0, 232, 1, 2, 0, 1ULL, 36, 1, 12037652594, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652594, 665, 0, 233, 1, 2, 0, 1ULL, 36, 1, 12037652595, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652595, 665, 0, 234, 1, 2, 0, 1ULL, 36, 1, 12037652596, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652596, 665, 0, 235, 1, 2, 0, 1ULL, 36, 1, 12037652597, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652597, 665, 0, 236, 1, 2, 0, 1ULL, 36, 1, 12037652598, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652598, 665, 0, 237, 1, 2, 0, 1ULL, 36, 1, 12037652599, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652599, 665, 0, 238, 1, 2, 0, 1ULL, 36, 1, 12037652600, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652600, 665, 0, 239, 1, 2, 0, 1ULL, 36, 1, 12037652601, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652601, 665, 0, 240, 1, 2, 0, 1ULL, 36, 1, 12037652602, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652602, 665, 0, 241, 1, 2, 0, 1ULL, 36, 1, 12037652603, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652603, 665, 0, 242, 1, 2, 0, 1ULL, 36, 1, 12037652604, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652604, 665, 0, 243, 1, 2, 0, 1ULL, 36, 1, 12037652605, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652605, 665, 0, 244, 1, 2, 0, 1ULL, 36, 1, 12037652606, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652606, 665, 0, 245, 1, 2, 0, 1ULL, 36, 1, 12037652607, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652607, 665, 0, 246, 1, 2, 0, 1ULL, 36, 1, 12037652608, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652608, 665, 0, 247, 1, 2, 0, 1ULL, 36, 1, 12037652609, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652609, 665, 0, 248, 1, 2, 0, 1ULL, 36, 1, 12037652610, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652610, 665, 0, 249, 1, 2, 0, 1ULL, 36, 1, 12037652611, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652611, 665, 0, 250, 1, 2, 0, 1ULL, 36, 1, 12037652612, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652612, 665, 0, 251, 1, 2, 0, 1ULL, 36, 1, 12037652613, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652613, 665, 0, 252, 1, 2, 0, 1ULL, 36, 1, 12037652614, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652614, 665, 0, 253, 1, 2, 0, 1ULL, 36, 1, 12037652615, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652615, 665, 0, 254, 1, 2, 0, 1ULL, 36, 1, 12037652616, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652616, 665, 0, 255, 1, 2, 0, 1ULL, 36, 1, 12037652617, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652617, 665, 0, 256, 1, 2, 0, 1ULL, 36, 1, 12037652618, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652618, 665, 0, 257, 1, 2, 0, 1ULL, 36, 1, 12037652619, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652619, 665, 0, 258, 1, 2, 0, 1ULL, 36, 1, 12037652620, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652620, 665, 0, 259, 1, 2, 0, 1ULL, 36, 1, 12037652621, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652621, 665, 0, 260, 1, 2, 0, 1ULL, 36, 1, 12037652622, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652622, 665, 0, 261, 1, 2, 0, 1ULL, 36, 1, 12037652623, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652623, 665, 0, 262, 1, 2, 0, 1ULL, 36, 1, 12037652624, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652624, 665, 0, 263, 1, 2, 0, 1ULL, 36, 1, 12037652625, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652625, 665, 0, 264, 1, 2, 0, 1ULL, 36, 1, 12037652626, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652626, 665, 0, 265, 1, 2, 0, 1ULL, 36, 1, 12037652627, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652627, 665, 0, 266, 1, 2, 0, 1ULL, 36, 1, 12037652628, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652628, 665, 0, 267, 1, 2, 0, 1ULL, 36, 1, 12037652629, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652629, 665, 0, 268, 1, 2, 0, 1ULL, 36, 1, 12037652630, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652630, 665, 0, 269, 1, 2, 0, 1ULL, 36, 1, 12037652631, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652631, 665, 0, 270, 1, 2, 0, 1ULL, 36, 1, 12037652632, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652632, 665, 0, 271, 1, 2, 0, 1ULL, 36, 1, 12037652633, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652633, 665, 0, 272, 1, 2, 0, 1ULL, 36, 1, 12037652634, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652634, 665, 0, 273, 1, 2, 0, 1ULL, 36, 1, 12037652635, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652635, 665, 0, 274, 1, 2, 0, 1ULL, 36, 1, 12037652636, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652636, 665, 0, 275, 1, 2, 0, 1ULL, 36, 1, 12037652637, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652637, 665, 0, 276, 1, 2, 0, 1ULL, 36, 1, 12037652638, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652638, 665, 0, 277, 1, 2, 0, 1ULL, 36, 1, 12037652639, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652639, 665, 0, 278, 1, 2, 0, 1ULL, 36, 1, 12037652640, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652640, 665, 0, 279, 1, 2, 0, 1ULL, 36, 1, 12037652641, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652641, 665, 0, 280, 1, 2, 0, 1ULL, 36, 1, 12037652642, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652642, 665, 0, 281, 1, 2, 0, 1ULL, 36, 1, 12037652643, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652643, 665, 0, 282, 1, 2, 0, 1ULL, 36, 1, 12037652644, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652644, 665, 0, 283, 1, 2, 0, 1ULL, 36, 1, 12037652645, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652645, 665, 0, 284, 1, 2, 0, 1ULL, 36, 1, 12037652646, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652646, 665, 0, 285, 1, 2, 0, 1ULL, 36, 1, 12037652647, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652647, 665, 0, 286, 1, 2, 0, 1ULL, 36, 1, 12037652648, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652648, 665, 0, 287, 1, 2, 0, 1ULL, 36, 1, 12037652649, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652649, 665, 0, 288, 1, 2, 0, 1ULL, 36, 1, 12037652650, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652650, 665, 0, 289, 1, 2, 0, 1ULL, 36, 1, 12037652651, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652651, 665, 0, 290, 1, 2, 0, 1ULL, 36, 1, 12037652652, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652652, 665, 0, 291, 1, 2, 0, 1ULL, 36, 1, 12037652653, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652653, 665, 0, 292, 1, 2, 0, 1ULL, 36, 1, 12037652654, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652654, 665, 0, 293, 1, 2, 0, 1ULL, 36, 1, 12037652655, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652655, 665, 0, 294, 1, 2, 0, 1ULL, 36, 1, 12037652656, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652656, 665, 0, 295, 1, 2, 0, 1ULL, 36, 1, 12037652657, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652657, 665, 0, 296, 1, 2, 0, 1ULL, 36, 1, 12037652658, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652658, 665, 0, 297, 1, 2, 0, 1ULL, 36, 1, 12037652659, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652659, 665, 0, 298, 1, 2, 0, 1ULL, 36, 1, 12037652660, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652660, 665, 0, 299, 1, 2, 0, 1ULL, 36, 1, 12037652661, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652661, 665, 0, 300, 1, 2, 0, 1ULL, 36, 1, 12037652662, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652662, 665, 0, 301, 1, 2, 0, 1ULL, 36, 1, 12037652663, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652663, 665, 0, 302, 1, 2, 0, 1ULL, 36, 1, 12037652664, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652664, 665, 0, 303, 1, 2, 0, 1ULL, 36, 1, 12037652665, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652665, 665, 0, 304, 1, 2, 0, 1ULL, 36, 1, 12037652666, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652666, 665, 0, 305, 1, 2, 0, 1ULL, 36, 1, 12037652667, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652667, 665, 0, 306, 1, 2, 0, 1ULL, 36, 1, 12037652668, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652668, 665, 0, 307, 1, 2, 0, 1ULL, 36, 1, 12037652669, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652669, 665, 0, 308, 1, 2, 0, 1ULL, 36, 1, 12037652670, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652670, 665, 0, 309, 1, 2, 0, 1ULL, 36, 1, 12037652671, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652671, 665, 0, 310, 1, 2, 0, 1ULL, 36, 1, 12037652672, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652672, 665, 0, 311, 1, 2, 0, 1ULL, 36, 1, 12037652673, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652673, 665, 0, 312, 1, 2, 0, 1ULL, 36, 1, 12037652674, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652674, 665, 0, 313, 1, 2, 0, 1ULL, 36, 1, 12037652675, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652675, 665, 0, 314, 1, 2, 0, 1ULL, 36, 1, 12037652676, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652676, 665, 0, 315, 1, 2, 0, 1ULL, 36, 1, 12037652677, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652677, 665, 0, 316, 1, 2, 0, 1ULL, 36, 1, 12037652678, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652678, 665, 0, 317, 1, 2, 0, 1ULL, 36, 1, 12037652679, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652679, 665, 0, 318, 1, 2, 0, 1ULL, 36, 1, 12037652680, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652680, 665, 0, 319, 1, 2, 0, 1ULL, 36, 1, 12037652681, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652681, 665, 0, 320, 1, 2, 0, 1ULL, 36, 1, 12037652682, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652682, 665, 0, 321, 1, 2, 0, 1ULL, 36, 1, 12037652683, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652683, 665, 0, 322, 1, 2, 0, 1ULL, 36, 1, 12037652684, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652684, 665, 0, 323, 1, 2, 0, 1ULL, 36, 1, 12037652685, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652685, 665, 0, 324, 1, 2, 0, 1ULL, 36, 1, 12037652686, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652686, 665, 0, 325, 1, 2, 0, 1ULL, 36, 1, 12037652687, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652687, 665, 0, 326, 1, 2, 0, 1ULL, 36, 1, 12037652688, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652688, 665, 0, 327, 1, 2, 0, 1ULL, 36, 1, 12037652689, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652689, 665, 0, 328, 1, 2, 0, 1ULL, 36, 1, 12037652690, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652690, 665, 0, 329, 1, 2, 0, 1ULL, 36, 1, 12037652691, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652691, 665, 0, 330, 1, 2, 0, 1ULL, 36, 1, 12037652692, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652692, 665, 0, 331, 1, 2, 0, 1ULL, 36, 1, 12037652693, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652693, 665, 0, 332, 1, 2, 0, 1ULL, 36, 1, 12037652694, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652694, 665, 0, 333, 1, 2, 0, 1ULL, 36, 1, 12037652695, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652695, 665, 0, 334, 1, 2, 0, 1ULL, 36, 1, 12037652696, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652696, 665, 0, 335, 1, 2, 0, 1ULL, 36, 1, 12037652697, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652697, 665, 0, 336, 1, 2, 0, 1ULL, 36, 1, 12037652701, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652701, 665, 0, 337, 1, 2, 0, 1ULL, 36, 1, 12037652702, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652702, 665, 0, 338, 1, 2, 0, 1ULL, 36, 1, 12037652703, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652703, 665, 0, 339, 1, 2, 0, 1ULL, 36, 1, 12037652704, 2, 16777216, 665, 0, 0, 1ULL, 36, 2, 12037652704, 665, 0, 340, 1, 2, 0, 1ULL, 12037652701, 665, 1, 12037652701, 665, 0, 341, 1, 0ULL, 0, 1ULL, 12037652702, 665, 1, 12037652702, 665, 0, 342, 1, 0ULL, 0, 1ULL, 12037652703, 665, 1, 12037652703, 665, 0, 343, 1, 0ULL, 0, 1ULL, 12037652704, 665, 1, 12037652704, 665, 0, 344, 1, 0ULL, 0, 12037652705, 665, 5, 345, 0, 0ULL, 0, 12037652706, 665, 5, 346, 0, 0ULL, 0, 12037652707, 665, 5, 347, 0, 0ULL, 0, 25341984771, 371, 12037652705, 665, 1, 12037652701, 665, 0, 0, 12037652701, 665, 12037652705, 2, 16777216, 665, 2, 65536ULL, 0, 348, 1, 2, 0, 25341984772, 371, 12037652705, 665, 1, 12037652702, 665, 0, 0, 12037652702, 665, 12037652705, 2, 16777216, 665, 2, 65536ULL, 0, 349, 1, 2, 0, 25341984773, 371, 12037652705, 665, 1, 12037652703, 665, 0, 0, 12037652703, 665, 12037652705, 2, 16777216, 665, 2, 65536ULL, 0, 350, 1, 2, 0, 25341984774, 371, 12037652706, 665, 1, 12037652704, 665, 0, 0, 12037652704, 665, 12037652706, 2, 16777216, 665, 2, 65536ULL, 0, 351, 1, 2, 0, 25341984775, 371, 12037652707, 665, 1, 12037652704, 665, 0, 0, 12037652704, 665, 12037652707, 2, 16777216, 665, 2, 65536ULL, 0, 352, 1, 2, 4, 5, 21, 0, 1ULL, 4, 1, 0, 12037652745, 665, 353, 1, 0ULL, 0, 1ULL, 4, 1, 0, 12037652746, 665, 354, 1, 0ULL, 0, 1ULL, 12037652745, 665, 1, 12037652745, 665, 0, 355, 1, 0ULL, 0, 1ULL, 12037652746, 665, 1, 12037652746, 665, 0, 356, 1, 0ULL, 0, 12037652746, 665, 12037652745, 665, 357, 0, 0ULL, 3, 5, 2, 16777216, 21, 2, 16777216, 0, 12037652738, 2, 16777216, 665, 12037652738, 665, 1, 1ULL, 3, 2, 0, 1, 358, 2, 0ULL, 0, 1ULL, 3, 1, 12037652741, 665, 0, 359, 12037652739, 2, 16777216, 665, 1, 360, 12037652742, 2, 16777216, 665, 12037652741, 665, 361, 12037652743, 2, 16777216, 665, 12037652738, 665, 0, 1ULL, 4, 1, 12037652714, 665, 0, 0, 12037652708, 665, 114, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 114, 0, 2, 1, 362, 12037652714, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652715, 665, 0, 0, 12037652708, 665, 115, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 115, 0, 2, 1, 363, 12037652715, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652716, 665, 0, 0, 12037652708, 665, 116, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 116, 0, 2, 1, 364, 12037652716, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652717, 665, 0, 0, 12037652708, 665, 117, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 117, 0, 2, 1, 365, 12037652717, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652718, 665, 0, 0, 12037652708, 665, 118, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 118, 0, 2, 1, 366, 12037652718, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652719, 665, 0, 0, 12037652708, 665, 119, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 119, 0, 2, 1, 367, 12037652719, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652720, 665, 0, 0, 12037652708, 665, 120, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 120, 0, 2, 1, 368, 12037652720, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652721, 665, 0, 0, 12037652708, 665, 121, 2, 1, 0, 0, 256ULL, 12037652709, 665, 1, 0, 121, 0, 2, 1, 369, 12037652721, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652722, 665, 0, 0, 12037652710, 665, 114, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 114, 0, 2, 1, 370, 12037652722, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652723, 665, 0, 0, 12037652710, 665, 115, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 115, 0, 2, 1, 371, 12037652723, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652724, 665, 0, 0, 12037652710, 665, 116, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 116, 0, 2, 1, 372, 12037652724, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652725, 665, 0, 0, 12037652710, 665, 117, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 117, 0, 2, 1, 373, 12037652725, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652726, 665, 0, 0, 12037652710, 665, 118, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 118, 0, 2, 1, 374, 12037652726, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652727, 665, 0, 0, 12037652710, 665, 119, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 119, 0, 2, 1, 375, 12037652727, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652728, 665, 0, 0, 12037652710, 665, 120, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 120, 0, 2, 1, 376, 12037652728, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652729, 665, 0, 0, 12037652710, 665, 121, 2, 1, 0, 0, 256ULL, 12037652711, 665, 1, 0, 121, 0, 2, 1, 377, 12037652729, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652730, 665, 0, 0, 12037652712, 665, 114, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 114, 3, 2, 1, 0, 12037652741, 665, 3, 1, 12037652744, 665, 0, 0, 1, 3, 378, 12037652730, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652731, 665, 0, 0, 12037652712, 665, 115, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 115, 0, 2, 1, 379, 12037652731, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652732, 665, 0, 0, 12037652712, 665, 116, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 116, 0, 2, 1, 380, 12037652732, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652733, 665, 0, 0, 12037652712, 665, 117, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 117, 0, 2, 1, 381, 12037652733, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652734, 665, 0, 0, 12037652712, 665, 118, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 118, 0, 2, 1, 382, 12037652734, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652735, 665, 0, 0, 12037652712, 665, 119, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 119, 0, 2, 1, 383, 12037652735, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652736, 665, 0, 0, 12037652712, 665, 120, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 120, 0, 2, 1, 384, 12037652736, 2, 16777216, 665, 0, 0, 1ULL, 4, 1, 12037652737, 665, 0, 0, 12037652712, 665, 121, 2, 1, 0, 0, 256ULL, 12037652713, 665, 1, 0, 121, 3, 2, 1, 0, 1ULL, 12037652744, 665, 1, 0, 3, 385, 12037652737, 2, 16777216, 665, 1, 0, 12037652747, 2, 16777216, 665, 25341984800, 371, 1, 1ULL, 122, 2, 0, 1, 386, 2, 0ULL, 0, 12037652748, 2, 16777216, 665, 25341984801, 371, 1, 1ULL, 122, 2, 0, 1, 387, 2, 0ULL, 0, 12037652749, 2, 16777216, 665, 25341984802, 371, 1, 1ULL, 122, 2, 0, 1, 388, 2, 0ULL, 0, 12037652750, 2, 16777216, 665, 25341984803, 371, 1, 1ULL, 122, 2, 0, 1, 389, 2, 0ULL, 0, 12037652751, 2, 16777216, 665, 25341984804, 371, 1, 1ULL, 122, 2, 0, 1, 390, 2, 0ULL, 0, 12037652752, 2, 16777216, 665, 25341984805, 371, 1, 1ULL, 122, 2, 0, 1, 391, 2, 0ULL, 0, 12037652753, 2, 16777216, 665, 25341984806, 371, 1, 1ULL, 122, 2, 0, 1, 392, 2, 0ULL, 0, 12037652754, 2, 16777216, 665, 25341984807, 371, 1, 1ULL, 122, 2, 0, 1, 393, 2, 0ULL, 0, 12037652755, 2, 16777216, 665, 25341984808, 371, 1, 1ULL, 122, 2, 0, 1, 394, 2, 0ULL, 0, 12037652756, 2, 16777216, 665, 25341984809, 371, 1, 1ULL, 122, 2, 0, 1, 395, 2, 0ULL, 0, 12037652757, 2, 16777216, 665, 25341984810, 371, 1, 1ULL, 122, 2, 0, 1, 396, 2, 0ULL, 0, 12037652758, 2, 16777216, 665, 25341984811, 371, 1, 1ULL, 122, 2, 0, 1, 397, 2, 0ULL, 0, 12037652759, 665, 12037652747, 665, 1, 0, 124, 398, 1, 0ULL, 0, 12037652760, 665, 12037652748, 665, 1, 0, 124, 399, 1, 0ULL, 0, 12037652761, 665, 12037652749, 665, 1, 0, 124, 400, 1, 0ULL, 0, 12037652762, 665, 12037652750, 665, 1, 0, 124, 401, 1, 0ULL, 0, 12037652759, 665, 12037652759, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 402, 2, 0ULL, 0, 12037652760, 665, 12037652760, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 403, 2, 0ULL, 0, 12037652761, 665, 12037652761, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 404, 2, 0ULL, 0, 12037652762, 665, 12037652762, 2, 16777216, 665, 1, 1ULL, 122, 2, 0, 1, 405, 2, 0ULL, 0, 1ULL, 12037652763, 665, 1, 12037652763, 665, 0, 406, 1, 0ULL, 0, 1ULL, 12037652764, 665, 1, 12037652764, 665, 0, 407, 1, 0ULL, 0, 1ULL, 12037652765, 665, 1, 12037652765, 665, 0, 408, 1, 0ULL, 0, 1ULL, 123, 1, 12037652763, 665, 0, 409, 1, 0ULL, 0, 1ULL, 123, 1, 12037652764, 665, 0, 410, 1, 0ULL, 0, 1ULL, 123, 1, 12037652765, 665, 0, 411, 1, 0ULL, 0, 1ULL, 25341984812, 371, 2, 12037652776, 2, 16777216, 665, 0, 0, 12037652776, 665, 1ULL, 1, 1ULL, 25341984812, 371, 3, 0, 1, 412, 2, 3, 0, 12037652776, 665, 12037652777, 665, 904, 1ULL, 0, 0, 904, 12037652776, 665, 413, 0, 0ULL, 0, 904, 12037652778, 665, 1, 1ULL, 25341984812, 371, 2, 0, 1, 414, 12037652778, 2, 16777216, 665, 2, 0, 1ULL, 12037652778, 665, 1, 12037652778, 665, 0, 415, 1, 0ULL, 0, 1ULL, 12037652779, 665, 1, 12037652779, 665, 0, 416, 1, 0ULL, 0, 1ULL, 12037652780, 665, 1, 12037652780, 665, 0, 417, 1, 0ULL, 0, 1ULL, 25341984812, 371, 1, 12037652779, 665, 0, 418, 1, 0ULL, 0, 1ULL, 25341984812, 371, 1, 12037652780, 665, 0, 419, 1, 0ULL, 0, 25341984813, 371, 138, 101, 0, 12037652766, 665, 0, 1ULL, 146, 1, 101, 0, 420, 12037652766, 2, 16777216, 665, 1, 0, 25341984813, 371, 139, 102, 0, 12037652767, 665, 0, 1ULL, 146, 1, 102, 0, 421, 12037652767, 2, 16777216, 665, 1, 0, 25341984813, 371, 140, 103, 0, 12037652768, 665, 0, 1ULL, 146, 1, 103, 0, 422, 12037652768, 2, 16777216, 665, 1, 0, 25341984813, 371, 141, 104, 0, 12037652769, 665, 0, 1ULL, 146, 1, 104, 0, 423, 12037652769, 2, 16777216, 665, 1, 0, 25341984813, 371, 142, 105, 0, 12037652770, 665, 0, 1ULL, 146, 1, 105, 0, 424, 12037652770, 2, 16777216, 665, 1, 0, 25341984813, 371, 143, 106, 0, 12037652771, 665, 0, 1ULL, 146, 1, 106, 0, 425, 12037652771, 2, 16777216, 665, 1, 0, 25341984813, 371, 144, 107, 0, 12037652772, 665, 0, 1ULL, 146, 1, 107, 0, 426, 12037652772, 2, 16777216, 665, 1, 0, 25341984813, 371, 145, 108, 0, 12037652773, 665, 0, 1ULL, 146, 1, 108, 0, 427, 12037652773, 2, 16777216, 665, 1, 0, 1ULL, 146, 1, 12037652781, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652781, 665, 0, 428, 1, 2, 0, 1ULL, 146, 1, 12037652782, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652782, 665, 0, 429, 1, 2, 0, 1ULL, 146, 1, 12037652783, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652783, 665, 0, 430, 1, 2, 0, 1ULL, 146, 1, 12037652784, 2, 16777216, 665, 0, 0, 1ULL, 146, 2, 12037652784, 665, 0, 431, 1, 2, 0, 12037652781, 665, 12037652785, 665, 1, 146, 0, 0, 1, 12037652785, 665, 1, 25341984812, 371, 12037652781, 665, 2, 0, 1, 432, 12037652785, 2, 16777216, 665, 2, 0, 12037652782, 665, 12037652786, 665, 1, 146, 0, 0, 1, 12037652786, 665, 1, 25341984812, 371, 12037652782, 665, 2, 0, 1, 433, 12037652786, 2, 16777216, 665, 2, 0, 12037652783, 665, 12037652787, 665, 1, 146, 0, 0, 1, 12037652787, 665, 1, 25341984812, 371, 12037652783, 665, 2, 0, 1, 434, 12037652787, 2, 16777216, 665, 2, 0, 12037652784, 665, 12037652788, 665, 1, 146, 0, 0, 1, 12037652788, 665, 1, 25341984812, 371, 12037652784, 665, 2, 0, 1, 435, 12037652788, 2, 16777216, 665, 2, 0, 1ULL, 146, 2, 12037652789, 665, 0, 0, 12037652789, 665, 1ULL, 1, 146, 25341984812, 371, 3, 0, 1, 0, 2, 3, 1, 0, 25341984812, 371, 436, 12037652789, 2, 16777216, 665, 1, 0, 25341984812, 371, 12037652790, 2, 16777216, 665, 1, 25341984812, 371, 12037652776, 2, 16777216, 665, 437, 0, 1, 0, 1ULL, 25341984812, 371, 1, 12037652790, 2, 16777216, 665, 0, 0, 1ULL, 25341984812, 371, 2, 12037652790, 665, 0, 438, 1, 2, 0, 12037652775, 2, 16777216, 665, 12037652775, 665, 1, 1ULL, 25341984812, 371, 2, 0, 1, 439, 2, 0ULL, 0, 1ULL, 0, 2, 16777216, 2, 25341984812, 371, 0, 0, 12037652775, 2, 16777216, 665, 1ULL, 1, 0, 12037652775, 665, 0, 1, 2, 440, 0, 0ULL, 0, 12037652791, 665, 12037652793, 665, 913, 1ULL, 0, 0, 12037652791, 665, 913, 441, 0, 0ULL, 0, 1ULL, 913, 2, 12037652791, 2, 16777216, 665, 0, 0, 12037652791, 665, 1ULL, 1, 1ULL, 913, 3, 0, 1, 442, 2, 3, 0, 1ULL, 913, 1, 12037652792, 2, 16777216, 665, 0, 0, 1ULL, 913, 2, 12037652792, 665, 0, 443, 1, 2, 1, 913, 12037652791, 2, 16777216, 665, 0, 12037652792, 2, 16777216, 665, 1ULL, 2, 913, 0, 444, 1, 2, 0, 1ULL, 913, 1, 25341984814, 371, 0, 445, 12037652802, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984815, 371, 0, 446, 12037652803, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984816, 371, 0, 447, 12037652804, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984817, 371, 0, 448, 12037652805, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984818, 371, 0, 449, 12037652806, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984819, 371, 0, 450, 12037652807, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984820, 371, 0, 451, 12037652808, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 25341984821, 371, 0, 452, 12037652809, 2, 16777216, 665, 1, 0, 1ULL, 913, 1, 0, 25341984812, 371, 453, 1, 0ULL, 0, 1ULL, 12037652879, 665, 1, 0, 12037652880, 665, 0, 1, 0, 1, 12037652892, 665, 0, 0, 1, 12037652877, 665, 454, 12037652892, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652822, 665, 1, 12037652857, 665, 12037652826, 665, 2, 0, 1, 0, 12037652858, 665, 12037652830, 665, 1, 2, 0, 0, 12037652859, 665, 12037652834, 665, 2, 1, 0, 0, 12037652860, 665, 12037652838, 665, 1, 2, 0, 0, 12037652863, 665, 12037652846, 665, 2, 1, 0, 0, 12037652861, 665, 12037652842, 665, 1, 2, 0, 0, 12037652864, 665, 12037652810, 665, 2, 1, 0, 0, 12037652862, 665, 12037652850, 665, 1, 2, 0, 0, 12037652865, 665, 12037652837, 665, 2, 1, 0, 905, 2, 12037652887, 665, 0, 905, 12037652814, 665, 1, 12037652866, 665, 0, 0, 1, 12037652814, 665, 455, 12037652814, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652823, 665, 1, 12037652857, 665, 12037652827, 665, 2, 0, 1, 0, 12037652858, 665, 12037652831, 665, 1, 2, 0, 0, 12037652859, 665, 12037652835, 665, 2, 1, 0, 0, 12037652860, 665, 12037652839, 665, 1, 2, 0, 0, 12037652863, 665, 12037652847, 665, 2, 1, 0, 0, 12037652861, 665, 12037652843, 665, 1, 2, 0, 0, 12037652864, 665, 12037652811, 665, 2, 1, 0, 0, 12037652865, 665, 12037652834, 665, 1, 2, 0, 110, 1, 12037652888, 665, 0, 110, 12037652815, 665, 1, 12037652866, 665, 0, 0, 1, 12037652815, 665, 456, 12037652815, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652824, 665, 1, 12037652857, 665, 12037652828, 665, 2, 0, 1, 0, 12037652858, 665, 12037652832, 665, 1, 2, 0, 0, 12037652859, 665, 12037652836, 665, 2, 1, 0, 0, 12037652860, 665, 12037652840, 665, 1, 2, 0, 0, 12037652863, 665, 12037652848, 665, 2, 1, 0, 0, 12037652861, 665, 12037652844, 665, 1, 2, 0, 0, 12037652864, 665, 12037652812, 665, 2, 1, 0, 0, 12037652865, 665, 12037652835, 665, 1, 2, 0, 111, 1, 12037652889, 665, 0, 111, 12037652816, 665, 1, 12037652866, 665, 0, 0, 1, 12037652816, 665, 457, 12037652816, 2, 16777216, 665, 0, 0, 12037652856, 665, 12037652825, 665, 1, 12037652857, 665, 12037652829, 665, 2, 0, 1, 0, 12037652858, 665, 12037652833, 665, 1, 2, 0, 0, 12037652859, 665, 12037652837, 665, 2, 1, 0, 0, 12037652860, 665, 12037652841, 665, 1, 2, 0, 0, 12037652863, 665, 12037652849, 665, 2, 1, 0, 0, 12037652861, 665, 12037652845, 665, 1, 2, 0, 0, 12037652864, 665, 12037652813, 665, 2, 1, 0, 0, 12037652865, 665, 12037652836, 665, 1, 2, 0, 112, 1, 12037652890, 665, 0, 112, 12037652817, 665, 1, 12037652866, 665, 0, 0, 1, 12037652817, 665, 458, 12037652817, 2, 16777216, 665, 0, 0, 905, 12037652818, 665, 1, 12037652867, 665, 0, 0, 1, 12037652818, 665, 459, 12037652818, 2, 16777216, 665, 0, 0, 110, 12037652819, 665, 1, 12037652867, 665, 0, 0, 1, 12037652819, 665, 460, 12037652819, 2, 16777216, 665, 0, 0, 111, 12037652820, 665, 1, 12037652867, 665, 0, 0, 1, 12037652820, 665, 461, 12037652820, 2, 16777216, 665, 0, 0, 112, 12037652821, 665, 1, 12037652867, 665, 0, 0, 1, 12037652821, 665, 462, 12037652821, 2, 16777216, 665, 0, 0, 905, 12037652822, 665, 1, 12037652868, 665, 0, 0, 1, 12037652822, 665, 463, 12037652822, 2, 16777216, 665, 0, 0, 110, 12037652823, 665, 1, 12037652868, 665, 0, 0, 1, 12037652823, 665, 464, 12037652823, 2, 16777216, 665, 0, 0, 111, 12037652824, 665, 1, 12037652868, 665, 0, 0, 1, 12037652824, 665, 465, 12037652824, 2, 16777216, 665, 0, 0, 112, 12037652825, 665, 1, 12037652868, 665, 0, 0, 1, 12037652825, 665, 466, 12037652825, 2, 16777216, 665, 0, 0, 905, 12037652826, 665, 1, 12037652869, 665, 0, 0, 1, 12037652826, 665, 467, 12037652826, 2, 16777216, 665, 0, 0, 110, 12037652827, 665, 1, 12037652869, 665, 0, 0, 1, 12037652827, 665, 468, 12037652827, 2, 16777216, 665, 0, 0, 111, 12037652828, 665, 1, 12037652869, 665, 0, 0, 1, 12037652828, 665, 469, 12037652828, 2, 16777216, 665, 0, 0, 112, 12037652829, 665, 1, 12037652869, 665, 0, 0, 1, 12037652829, 665, 470, 12037652829, 2, 16777216, 665, 0, 0, 905, 12037652830, 665, 1, 12037652870, 665, 0, 0, 1, 12037652830, 665, 471, 12037652830, 2, 16777216, 665, 0, 0, 110, 12037652831, 665, 1, 12037652870, 665, 0, 0, 1, 12037652831, 665, 472, 12037652831, 2, 16777216, 665, 0, 0, 111, 12037652832, 665, 1, 12037652870, 665, 0, 0, 1, 12037652832, 665, 473, 12037652832, 2, 16777216, 665, 0, 0, 112, 12037652833, 665, 1, 12037652870, 665, 0, 0, 1, 12037652833, 665, 474, 12037652833, 2, 16777216, 665, 0, 0, 905, 12037652834, 665, 1, 12037652871, 665, 0, 0, 1, 12037652834, 665, 475, 12037652834, 2, 16777216, 665, 0, 0, 110, 12037652835, 665, 1, 12037652871, 665, 0, 0, 1, 12037652835, 665, 476, 12037652835, 2, 16777216, 665, 0, 0, 111, 12037652836, 665, 1, 12037652871, 665, 0, 0, 1, 12037652836, 665, 477, 12037652836, 2, 16777216, 665, 0, 0, 112, 12037652837, 665, 1, 12037652871, 665, 0, 0, 1, 12037652837, 665, 478, 12037652837, 2, 16777216, 665, 0, 0, 905, 12037652838, 665, 1, 12037652872, 665, 0, 0, 1, 12037652838, 665, 479, 12037652838, 2, 16777216, 665, 0, 0, 110, 12037652839, 665, 1, 12037652872, 665, 0, 0, 1, 12037652839, 665, 480, 12037652839, 2, 16777216, 665, 0, 0, 111, 12037652840, 665, 1, 12037652872, 665, 0, 0, 1, 12037652840, 665, 481, 12037652840, 2, 16777216, 665, 0, 0, 112, 12037652841, 665, 1, 12037652872, 665, 0, 0, 1, 12037652841, 665, 482, 12037652841, 2, 16777216, 665, 0, 0, 2ULL, 12037652842, 665, 1, 0, 12037652850, 665, 0, 1, 12037652842, 665, 1, 12037652851, 665, 0, 2, 1, 12037652842, 665, 0, 905, 12037652842, 665, 1, 12037652873, 665, 0, 0, 2, 12037652842, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652842, 665, 483, 12037652842, 2, 16777216, 665, 1, 0, 2ULL, 12037652843, 665, 1, 0, 12037652850, 665, 0, 1, 12037652843, 665, 1, 12037652852, 665, 0, 2, 1, 12037652843, 665, 0, 110, 12037652843, 665, 1, 12037652873, 665, 0, 0, 2, 12037652843, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652843, 665, 484, 12037652843, 2, 16777216, 665, 1, 0, 2ULL, 12037652844, 665, 1, 0, 12037652850, 665, 0, 1, 12037652844, 665, 1, 12037652853, 665, 0, 2, 1, 12037652844, 665, 0, 111, 12037652844, 665, 1, 12037652873, 665, 0, 0, 2, 12037652844, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652844, 665, 485, 12037652844, 2, 16777216, 665, 1, 0, 2ULL, 12037652845, 665, 1, 0, 12037652850, 665, 0, 1, 12037652845, 665, 1, 12037652854, 665, 0, 2, 1, 12037652845, 665, 0, 112, 12037652845, 665, 1, 12037652873, 665, 0, 0, 2, 12037652845, 665, 2, 12037652881, 665, 0, 0, 1, 2, 1, 0, 12037652845, 665, 486, 12037652845, 2, 16777216, 665, 1, 0, 2ULL, 12037652846, 665, 1, 0, 12037652850, 665, 0, 1, 12037652846, 665, 1, 12037652851, 665, 0, 3, 1, 12037652846, 665, 0, 2ULL, 12037652846, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652846, 665, 1, 12037652851, 665, 0, 4, 1, 12037652846, 665, 0, 905, 12037652846, 665, 1, 12037652874, 665, 0, 0, 3, 12037652846, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652846, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652846, 665, 487, 12037652846, 2, 16777216, 665, 1, 0, 2ULL, 12037652847, 665, 1, 0, 12037652850, 665, 0, 1, 12037652847, 665, 1, 12037652852, 665, 0, 3, 1, 12037652847, 665, 0, 2ULL, 12037652847, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652847, 665, 1, 12037652852, 665, 0, 4, 1, 12037652847, 665, 0, 110, 12037652847, 665, 1, 12037652874, 665, 0, 0, 3, 12037652847, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652847, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652847, 665, 488, 12037652847, 2, 16777216, 665, 1, 0, 2ULL, 12037652848, 665, 1, 0, 12037652850, 665, 0, 1, 12037652848, 665, 1, 12037652853, 665, 0, 3, 1, 12037652848, 665, 0, 2ULL, 12037652848, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652848, 665, 1, 12037652853, 665, 0, 4, 1, 12037652848, 665, 0, 111, 12037652848, 665, 1, 12037652874, 665, 0, 0, 3, 12037652848, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652848, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652848, 665, 489, 12037652848, 2, 16777216, 665, 1, 0, 2ULL, 12037652849, 665, 1, 0, 12037652850, 665, 0, 1, 12037652849, 665, 1, 12037652854, 665, 0, 3, 1, 12037652849, 665, 0, 2ULL, 12037652849, 665, 1, 1ULL, 12037652850, 665, 2, 0, 1, 0, 2, 12037652849, 665, 1, 12037652854, 665, 0, 4, 1, 12037652849, 665, 0, 112, 12037652849, 665, 1, 12037652874, 665, 0, 0, 3, 12037652849, 665, 2, 12037652882, 665, 0, 3, 1, 2, 0, 4, 12037652849, 665, 1, 12037652883, 665, 0, 0, 3, 1, 1, 0, 12037652849, 665, 490, 12037652849, 2, 16777216, 665, 1, 0, 905, 12037652850, 665, 1, 12037652875, 665, 0, 0, 1, 12037652850, 665, 491, 12037652850, 2, 16777216, 665, 0, 0, 1ULL, 12037652850, 665, 1, 12037652850, 665, 0, 492, 1, 0ULL, 0, 12037652852, 665, 12037652851, 665, 1, 12037652884, 665, 0, 2, 1, 12037652851, 665, 0, 905, 12037652851, 665, 1, 12037652876, 665, 0, 0, 2, 12037652851, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652851, 665, 493, 12037652851, 2, 16777216, 665, 1, 0, 12037652853, 665, 12037652852, 665, 1, 12037652884, 665, 0, 2, 1, 12037652852, 665, 0, 110, 12037652852, 665, 1, 12037652876, 665, 0, 0, 2, 12037652852, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652852, 665, 494, 12037652852, 2, 16777216, 665, 1, 0, 12037652854, 665, 12037652853, 665, 1, 12037652884, 665, 0, 2, 1, 12037652853, 665, 0, 111, 12037652853, 665, 1, 12037652876, 665, 0, 0, 2, 12037652853, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652853, 665, 495, 12037652853, 2, 16777216, 665, 1, 0, 12037652851, 665, 12037652854, 665, 1, 12037652884, 665, 0, 2, 1, 12037652854, 665, 0, 112, 12037652854, 665, 1, 12037652876, 665, 0, 0, 2, 12037652854, 665, 2, 12037652884, 665, 0, 0, 1, 2, 1, 0, 12037652854, 665, 496, 12037652854, 2, 16777216, 665, 1, 0, 25341984822, 371, 905, 497, 0, 0ULL, 0, 12037652885, 665, 25341984822, 371, 2, 0, 12037652886, 665, 0, 12037652891, 665, 12037652855, 665, 1, 0, 1ULL, 0, 2, 1, 1, 0, 12037652855, 665, 0, 1, 1ULL, 498, 12037652855, 2, 16777216, 665, 0, 0, 12037652855, 665, 0, 499, 0, 0ULL, 0, 8589934592ULL, 12037652897, 665, 1, 4194304ULL, 12037652896, 665, 2, 0, 1, 0, 2048ULL, 12037652895, 665, 1, 2, 0, 120, 1, 12037652894, 665, 0, 0, 120, 500, 0, 0ULL, 0, 8589934592ULL, 12037652901, 665, 1, 4194304ULL, 12037652900, 665, 2, 0, 1, 0, 2048ULL, 12037652899, 665, 1, 2, 0, 121, 1, 12037652898, 665, 0, 17592186044415ULL, 121, 1, 0, 0, 501, 1, 0ULL, 0, 1ULL, 193, 1, 0, 12037652907, 665, 0, 12037652906, 665, 194, 2, 1, 0, 502, 12037652907, 2, 16777216, 665, 2, 0, 1ULL, 12037652906, 665, 1, 12037652906, 665, 0, 503, 1, 0ULL, 0, 12037652907, 665, 120, 1, 193, 0, 504, 1, 0ULL, 0, 1ULL, 197, 1, 12037652910, 665, 0, 0, 12037652908, 665, 198, 2, 1, 0, 505, 12037652910, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652912, 665, 0, 0, 12037652909, 665, 201, 2, 1, 0, 506, 12037652912, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652913, 665, 0, 0, 12037652909, 665, 202, 2, 1, 0, 507, 12037652913, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652914, 665, 0, 0, 12037652909, 665, 203, 2, 1, 0, 508, 12037652914, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652915, 665, 0, 0, 12037652909, 665, 204, 2, 1, 0, 509, 12037652915, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652916, 665, 0, 0, 12037652909, 665, 205, 2, 1, 0, 510, 12037652916, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652917, 665, 0, 0, 12037652909, 665, 206, 2, 1, 0, 511, 12037652917, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652918, 665, 0, 0, 12037652909, 665, 207, 2, 1, 0, 512, 12037652918, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652919, 665, 0, 0, 12037652909, 665, 208, 2, 1, 0, 513, 12037652919, 2, 16777216, 665, 2, 0, 1ULL, 200, 1, 12037652911, 2, 16777216, 665, 0, 0, 1ULL, 200, 2, 12037652911, 665, 0, 514, 1, 2, 0, 1ULL, 12037652911, 665, 1, 12037652911, 665, 0, 515, 1, 0ULL, 0, 1ULL, 12037652908, 665, 1, 12037652908, 665, 0, 516, 1, 0ULL, 0, 1ULL, 199, 1, 0, 12037652908, 665, 517, 1, 0ULL, 0, 1ULL, 12037652909, 665, 1, 12037652909, 665, 0, 518, 1, 0ULL, 0, 1ULL, 25341984824, 371, 2, 12037652923, 2, 16777216, 665, 0, 0, 12037652923, 665, 1ULL, 1, 1ULL, 25341984824, 371, 3, 0, 1, 519, 2, 3, 0, 12037652923, 665, 12037652924, 665, 907, 1ULL, 0, 0, 907, 12037652923, 665, 520, 0, 0ULL, 0, 907, 12037652925, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 521, 12037652925, 2, 16777216, 665, 2, 0, 1ULL, 12037652925, 665, 1, 12037652925, 665, 0, 522, 1, 0ULL, 0, 1ULL, 12037652926, 665, 1, 12037652926, 665, 0, 523, 1, 0ULL, 0, 1ULL, 12037652927, 665, 1, 12037652927, 665, 0, 524, 1, 0ULL, 0, 1ULL, 25341984825, 371, 1, 12037652926, 665, 0, 525, 1, 0ULL, 0, 1ULL, 25341984825, 371, 1, 12037652927, 665, 0, 526, 1, 0ULL, 0, 1ULL, 213, 1, 12037652921, 2, 16777216, 665, 0, 0, 1ULL, 213, 2, 12037652921, 665, 0, 527, 1, 2, 1, 12037652921, 2, 16777216, 665, 213, 0, 1ULL, 25341984824, 371, 2, 0, 213, 528, 1, 2, 0, 1ULL, 25341984824, 371, 1, 0, 217, 529, 1, 0ULL, 0, 25341984824, 371, 12037652928, 2, 16777216, 665, 1, 25341984824, 371, 12037652923, 2, 16777216, 665, 530, 0, 1, 0, 1ULL, 25341984824, 371, 1, 12037652928, 2, 16777216, 665, 0, 0, 1ULL, 25341984824, 371, 2, 12037652928, 665, 0, 531, 1, 2, 0, 12037652929, 2, 16777216, 665, 12037652929, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 532, 2, 0ULL, 0, 12037652930, 2, 16777216, 665, 12037652930, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 533, 2, 0ULL, 0, 12037652931, 2, 16777216, 665, 12037652931, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 534, 2, 0ULL, 0, 12037652932, 2, 16777216, 665, 12037652932, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 535, 2, 0ULL, 0, 12037652933, 2, 16777216, 665, 12037652933, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 536, 2, 0ULL, 0, 12037652934, 2, 16777216, 665, 12037652934, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 537, 2, 0ULL, 0, 12037652935, 2, 16777216, 665, 12037652935, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 538, 2, 0ULL, 0, 12037652936, 2, 16777216, 665, 12037652936, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 539, 2, 0ULL, 0, 12037652922, 2, 16777216, 665, 12037652922, 665, 1, 1ULL, 25341984824, 371, 2, 0, 1, 540, 2, 0ULL, 0, 12037652922, 2, 16777216, 665, 1ULL, 1, 0, 12037652922, 665, 0, 1, 25341984825, 371, 541, 0, 0ULL, 0, 1ULL, 213, 2, 12037652937, 665, 0, 0, 12037652937, 665, 1ULL, 1, 213, 25341984824, 371, 3, 0, 1, 0, 2, 3, 1, 0, 25341984824, 371, 542, 12037652937, 2, 16777216, 665, 1, 0, 12037652938, 665, 12037652940, 665, 912, 1ULL, 0, 0, 12037652938, 665, 912, 543, 0, 0ULL, 0, 1ULL, 912, 2, 12037652938, 2, 16777216, 665, 0, 0, 12037652938, 665, 1ULL, 1, 1ULL, 912, 3, 0, 1, 544, 2, 3, 0, 1ULL, 912, 1, 12037652939, 2, 16777216, 665, 0, 0, 1ULL, 912, 2, 12037652939, 665, 0, 545, 1, 2, 1, 912, 12037652938, 2, 16777216, 665, 0, 12037652939, 2, 16777216, 665, 1ULL, 2, 912, 0, 546, 1, 2, 0, 1ULL, 912, 1, 25341984827, 371, 0, 547, 12037652949, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984828, 371, 0, 548, 12037652950, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984829, 371, 0, 549, 12037652951, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984830, 371, 0, 550, 12037652952, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984831, 371, 0, 551, 12037652953, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984832, 371, 0, 552, 12037652954, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984833, 371, 0, 553, 12037652955, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 25341984834, 371, 0, 554, 12037652956, 2, 16777216, 665, 1, 0, 1ULL, 912, 1, 0, 25341984824, 371, 555, 1, 0ULL, 0, 12037652969, 665, 1ULL, 1, 12037652969, 665, 0, 556, 1, 0ULL, 0, 1ULL, 12037652969, 665, 1, 12037652957, 2, 16777216, 665, 12037652957, 665, 2, 0, 1, 557, 2, 0ULL, 0, 12037652959, 665, 1ULL, 1, 12037652959, 665, 0, 558, 1, 0ULL, 0, 12037652960, 665, 1ULL, 1, 12037652960, 665, 0, 559, 1, 0ULL, 0, 1ULL, 12037652959, 665, 1, 0, 12037652960, 665, 560, 1, 0ULL, 109, 1ULL, 1, 0, 12037652969, 665, 1ULL, 1, 1ULL, 109, 2, 0, 1, 561, 2, 0ULL, 0, 12037652961, 2, 16777216, 665, 12037652961, 665, 1, 25341984835, 371, 0, 562, 1, 0ULL, 0, 12037652962, 2, 16777216, 665, 12037652962, 665, 1, 25341984835, 371, 0, 563, 1, 0ULL, 0, 12037652963, 2, 16777216, 665, 12037652963, 665, 1, 25341984835, 371, 0, 564, 1, 0ULL, 0, 12037652964, 2, 16777216, 665, 12037652964, 665, 1, 25341984835, 371, 0, 565, 1, 0ULL, 0, 12037652965, 2, 16777216, 665, 12037652965, 665, 1, 25341984835, 371, 0, 566, 1, 0ULL, 0, 12037652966, 2, 16777216, 665, 12037652966, 665, 1, 25341984835, 371, 0, 567, 1, 0ULL, 0, 12037652967, 2, 16777216, 665, 12037652967, 665, 1, 25341984835, 371, 0, 568, 1, 0ULL, 0, 12037652968, 2, 16777216, 665, 12037652968, 665, 1, 25341984835, 371, 0, 569, 1, 0ULL, 0, 25341984836, 371, 12037652961, 2, 16777216, 665, 570, 0, 0ULL, 0, 25341984836, 371, 12037652962, 2, 16777216, 665, 571, 0, 0ULL, 0, 25341984836, 371, 12037652963, 2, 16777216, 665, 572, 0, 0ULL, 0, 25341984836, 371, 12037652964, 2, 16777216, 665, 573, 0, 0ULL, 0, 25341984836, 371, 12037652965, 2, 16777216, 665, 574, 0, 0ULL, 0, 25341984836, 371, 12037652966, 2, 16777216, 665, 575, 0, 0ULL, 0, 25341984836, 371, 12037652967, 2, 16777216, 665, 576, 0, 0ULL, 0, 25341984836, 371, 12037652968, 2, 16777216, 665, 577, 0, 0ULL, 0, 1ULL, 12037653107, 665, 1, 12037653107, 665, 0, 578, 1, 0ULL, 0, 1ULL, 12037653130, 665, 1, 12037653130, 665, 0, 579, 1, 0ULL, 0, 1ULL, 12037653129, 665, 1, 12037653129, 665, 0, 580, 1, 0ULL, 0, 1ULL, 12037653128, 665, 1, 12037653128, 665, 0, 581, 1, 0ULL, 0, 1ULL, 12037653127, 665, 1, 12037653127, 665, 0, 582, 1, 0ULL, 0, 1ULL, 12037653126, 665, 1, 12037653126, 665, 0, 583, 1, 0ULL, 0, 1ULL, 12037653125, 665, 1, 12037653125, 665, 0, 584, 1, 0ULL, 0, 1ULL, 12037653124, 665, 1, 12037653124, 665, 0, 585, 1, 0ULL, 0, 1ULL, 12037653123, 665, 1, 12037653123, 665, 0, 586, 1, 0ULL, 0, 1ULL, 12037653122, 665, 1, 12037653122, 665, 0, 587, 1, 0ULL, 0, 12037652977, 665, 12037653042, 665, 1, 12037652985, 665, 12037653043, 665, 2, 0, 1, 0, 12037652993, 665, 12037653044, 665, 1, 2, 0, 0, 12037652986, 665, 12037653045, 665, 2, 1, 0, 0, 12037653001, 665, 12037653046, 665, 1, 2, 0, 0, 12037653009, 665, 12037653047, 665, 2, 1, 0, 0, 12037653041, 665, 12037653049, 665, 1, 2, 0, 0, 12037653017, 665, 12037653048, 665, 2, 1, 0, 0, 12037653018, 665, 12037653050, 665, 1, 2, 0, 0, 12037653019, 665, 12037653051, 665, 2, 1, 0, 0, 12037653020, 665, 12037653052, 665, 1, 2, 0, 0, 12037653021, 665, 12037653053, 665, 2, 1, 0, 0, 12037653054, 665, 45, 1, 2, 0, 0, 12037653023, 665, 12037653055, 665, 2, 1, 0, 0, 12037653024, 665, 12037653056, 665, 1, 2, 0, 0, 12037653108, 665, 12037653114, 665, 2, 1, 0, 0, 12037653109, 665, 12037653115, 665, 1, 2, 0, 0, 12037653110, 665, 12037653116, 665, 2, 1, 0, 0, 12037653111, 665, 12037653117, 665, 1, 2, 0, 0, 12037653112, 665, 12037653118, 665, 2, 1, 0, 0, 12037653113, 665, 12037653119, 665, 1, 2, 0, 0, 12037653025, 665, 12037653057, 665, 2, 1, 0, 909, 2, 12037653033, 665, 0, 4294967296ULL, 12037653107, 665, 1, 0, 909, 3, 12037653072, 665, 1, 0, 2147483648ULL, 12037653130, 665, 1, 1073741824ULL, 12037653129, 665, 2, 0, 1, 0, 536870912ULL, 12037653128, 665, 1, 2, 0, 0, 268435456ULL, 12037653127, 665, 2, 1, 0, 0, 134217728ULL, 12037653126, 665, 1, 2, 0, 0, 67108864ULL, 12037653125, 665, 2, 1, 0, 0, 33554432ULL, 12037653124, 665, 1, 2, 0, 0, 16777216ULL, 12037653123, 665, 2, 1, 0, 0, 8388608ULL, 12037653122, 665, 1, 2, 0, 0, 1, 12037653121, 665, 588, 3, 0, 0, 12037653025, 665, 12037653131, 665, 911, 1ULL, 0, 0, 911, 12037653025, 665, 589, 0, 0ULL, 0, 25341984837, 371, 909, 590, 0, 0ULL, 0, 909, 12037652977, 665, 1, 12037653058, 665, 0, 0, 1, 12037652977, 665, 591, 12037652977, 2, 16777216, 665, 0, 0, 12037652976, 665, 12037653042, 665, 1, 12037652984, 665, 12037653043, 665, 2, 0, 1, 0, 12037652992, 665, 12037653044, 665, 1, 2, 0, 0, 12037652993, 665, 12037653045, 665, 2, 1, 0, 0, 12037653000, 665, 12037653046, 665, 1, 2, 0, 0, 12037653008, 665, 12037653047, 665, 2, 1, 0, 0, 12037653016, 665, 12037653048, 665, 1, 2, 0, 0, 12037653040, 665, 12037653049, 665, 2, 1, 0, 113, 2, 12037653032, 665, 0, 113, 12037652976, 665, 1, 12037653058, 665, 0, 0, 1, 12037652976, 665, 592, 12037652976, 2, 16777216, 665, 0, 0, 12037652975, 665, 12037653042, 665, 1, 12037652983, 665, 12037653043, 665, 2, 0, 1, 0, 12037652991, 665, 12037653044, 665, 1, 2, 0, 0, 12037652992, 665, 12037653045, 665, 2, 1, 0, 0, 12037652999, 665, 12037653046, 665, 1, 2, 0, 0, 12037653007, 665, 12037653047, 665, 2, 1, 0, 0, 12037653015, 665, 12037653048, 665, 1, 2, 0, 0, 12037653039, 665, 12037653049, 665, 2, 1, 0, 114, 2, 12037653031, 665, 0, 114, 12037652975, 665, 1, 12037653058, 665, 0, 0, 1, 12037652975, 665, 593, 12037652975, 2, 16777216, 665, 0, 0, 12037652974, 665, 12037653042, 665, 1, 12037652982, 665, 12037653043, 665, 2, 0, 1, 0, 12037652990, 665, 12037653044, 665, 1, 2, 0, 0, 12037652991, 665, 12037653045, 665, 2, 1, 0, 0, 12037652998, 665, 12037653046, 665, 1, 2, 0, 0, 12037653006, 665, 12037653047, 665, 2, 1, 0, 0, 12037653014, 665, 12037653048, 665, 1, 2, 0, 0, 12037653038, 665, 12037653049, 665, 2, 1, 0, 115, 2, 12037653030, 665, 0, 115, 12037652974, 665, 1, 12037653058, 665, 0, 0, 1, 12037652974, 665, 594, 12037652974, 2, 16777216, 665, 0, 0, 12037652973, 665, 12037653042, 665, 1, 12037652981, 665, 12037653043, 665, 2, 0, 1, 0, 12037652989, 665, 12037653044, 665, 1, 2, 0, 0, 12037652990, 665, 12037653045, 665, 2, 1, 0, 0, 12037652997, 665, 12037653046, 665, 1, 2, 0, 0, 12037653005, 665, 12037653047, 665, 2, 1, 0, 0, 12037653013, 665, 12037653048, 665, 1, 2, 0, 0, 12037653037, 665, 12037653049, 665, 2, 1, 0, 116, 2, 12037653029, 665, 0, 116, 12037652973, 665, 1, 12037653058, 665, 0, 0, 1, 12037652973, 665, 595, 12037652973, 2, 16777216, 665, 0, 0, 12037652972, 665, 12037653042, 665, 1, 12037652980, 665, 12037653043, 665, 2, 0, 1, 0, 12037652988, 665, 12037653044, 665, 1, 2, 0, 0, 12037652989, 665, 12037653045, 665, 2, 1, 0, 0, 12037652996, 665, 12037653046, 665, 1, 2, 0, 0, 12037653004, 665, 12037653047, 665, 2, 1, 0, 0, 12037653012, 665, 12037653048, 665, 1, 2, 0, 0, 12037653036, 665, 12037653049, 665, 2, 1, 0, 117, 2, 12037653028, 665, 0, 117, 12037652972, 665, 1, 12037653058, 665, 0, 0, 1, 12037652972, 665, 596, 12037652972, 2, 16777216, 665, 0, 0, 12037652971, 665, 12037653042, 665, 1, 12037652979, 665, 12037653043, 665, 2, 0, 1, 0, 12037652987, 665, 12037653044, 665, 1, 2, 0, 0, 12037652988, 665, 12037653045, 665, 2, 1, 0, 0, 12037652995, 665, 12037653046, 665, 1, 2, 0, 0, 12037653003, 665, 12037653047, 665, 2, 1, 0, 0, 12037653011, 665, 12037653048, 665, 1, 2, 0, 0, 12037653035, 665, 12037653049, 665, 2, 1, 0, 118, 2, 12037653027, 665, 0, 118, 12037652971, 665, 1, 12037653058, 665, 0, 0, 1, 12037652971, 665, 597, 12037652971, 2, 16777216, 665, 0, 0, 12037652970, 665, 12037653042, 665, 1, 12037652978, 665, 12037653043, 665, 2, 0, 1, 0, 12037652986, 665, 12037653044, 665, 1, 2, 0, 0, 12037652987, 665, 12037653045, 665, 2, 1, 0, 0, 12037652994, 665, 12037653046, 665, 1, 2, 0, 0, 12037653002, 665, 12037653047, 665, 2, 1, 0, 0, 12037653010, 665, 12037653048, 665, 1, 2, 0, 0, 12037653034, 665, 12037653049, 665, 2, 1, 0, 119, 2, 12037653026, 665, 0, 119, 12037652970, 665, 1, 12037653058, 665, 0, 0, 1, 12037652970, 665, 598, 12037652970, 2, 16777216, 665, 0, 0, 909, 12037652985, 665, 1, 12037653059, 665, 0, 0, 1, 12037652985, 665, 599, 12037652985, 2, 16777216, 665, 0, 0, 113, 12037652984, 665, 1, 12037653059, 665, 0, 0, 1, 12037652984, 665, 600, 12037652984, 2, 16777216, 665, 0, 0, 114, 12037652983, 665, 1, 12037653059, 665, 0, 0, 1, 12037652983, 665, 601, 12037652983, 2, 16777216, 665, 0, 0, 115, 12037652982, 665, 1, 12037653059, 665, 0, 0, 1, 12037652982, 665, 602, 12037652982, 2, 16777216, 665, 0, 0, 116, 12037652981, 665, 1, 12037653059, 665, 0, 0, 1, 12037652981, 665, 603, 12037652981, 2, 16777216, 665, 0, 0, 117, 12037652980, 665, 1, 12037653059, 665, 0, 0, 1, 12037652980, 665, 604, 12037652980, 2, 16777216, 665, 0, 0, 118, 12037652979, 665, 1, 12037653059, 665, 0, 0, 1, 12037652979, 665, 605, 12037652979, 2, 16777216, 665, 0, 0, 119, 12037652978, 665, 1, 12037653059, 665, 0, 0, 1, 12037652978, 665, 606, 12037652978, 2, 16777216, 665, 0, 0, 909, 12037652993, 665, 1, 12037653060, 665, 0, 0, 1, 12037652993, 665, 607, 12037652993, 2, 16777216, 665, 0, 0, 113, 12037652992, 665, 1, 12037653060, 665, 0, 0, 1, 12037652992, 665, 608, 12037652992, 2, 16777216, 665, 0, 0, 114, 12037652991, 665, 1, 12037653060, 665, 0, 0, 1, 12037652991, 665, 609, 12037652991, 2, 16777216, 665, 0, 0, 115, 12037652990, 665, 1, 12037653060, 665, 0, 0, 1, 12037652990, 665, 610, 12037652990, 2, 16777216, 665, 0, 0, 116, 12037652989, 665, 1, 12037653060, 665, 0, 0, 1, 12037652989, 665, 611, 12037652989, 2, 16777216, 665, 0, 0, 117, 12037652988, 665, 1, 12037653060, 665, 0, 0, 1, 12037652988, 665, 612, 12037652988, 2, 16777216, 665, 0, 0, 118, 12037652987, 665, 1, 12037653060, 665, 0, 0, 1, 12037652987, 665, 613, 12037652987, 2, 16777216, 665, 0, 0, 119, 12037652986, 665, 1, 12037653060, 665, 0, 0, 1, 12037652986, 665, 614, 12037652986, 2, 16777216, 665, 0, 0, 909, 12037653001, 665, 1, 12037653061, 665, 0, 0, 1, 12037653001, 665, 615, 12037653001, 2, 16777216, 665, 0, 0, 113, 12037653000, 665, 1, 12037653061, 665, 0, 0, 1, 12037653000, 665, 616, 12037653000, 2, 16777216, 665, 0, 0, 114, 12037652999, 665, 1, 12037653061, 665, 0, 0, 1, 12037652999, 665, 617, 12037652999, 2, 16777216, 665, 0, 0, 115, 12037652998, 665, 1, 12037653061, 665, 0, 0, 1, 12037652998, 665, 618, 12037652998, 2, 16777216, 665, 0, 0, 116, 12037652997, 665, 1, 12037653061, 665, 0, 0, 1, 12037652997, 665, 619, 12037652997, 2, 16777216, 665, 0, 0, 117, 12037652996, 665, 1, 12037653061, 665, 0, 0, 1, 12037652996, 665, 620, 12037652996, 2, 16777216, 665, 0, 0, 118, 12037652995, 665, 1, 12037653061, 665, 0, 0, 1, 12037652995, 665, 621, 12037652995, 2, 16777216, 665, 0, 0, 119, 12037652994, 665, 1, 12037653061, 665, 0, 0, 1, 12037652994, 665, 622, 12037652994, 2, 16777216, 665, 0, 0, 909, 12037653009, 665, 1, 12037653062, 665, 0, 0, 1, 12037653009, 665, 623, 12037653009, 2, 16777216, 665, 0, 0, 113, 12037653008, 665, 1, 12037653062, 665, 0, 0, 1, 12037653008, 665, 624, 12037653008, 2, 16777216, 665, 0, 0, 114, 12037653007, 665, 1, 12037653062, 665, 0, 0, 1, 12037653007, 665, 625, 12037653007, 2, 16777216, 665, 0, 0, 115, 12037653006, 665, 1, 12037653062, 665, 0, 0, 1, 12037653006, 665, 626, 12037653006, 2, 16777216, 665, 0, 0, 116, 12037653005, 665, 1, 12037653062, 665, 0, 0, 1, 12037653005, 665, 627, 12037653005, 2, 16777216, 665, 0, 0, 117, 12037653004, 665, 1, 12037653062, 665, 0, 0, 1, 12037653004, 665, 628, 12037653004, 2, 16777216, 665, 0, 0, 118, 12037653003, 665, 1, 12037653062, 665, 0, 0, 1, 12037653003, 665, 629, 12037653003, 2, 16777216, 665, 0, 0, 119, 12037653002, 665, 1, 12037653062, 665, 0, 0, 1, 12037653002, 665, 630, 12037653002, 2, 16777216, 665, 0, 0, 909, 12037653017, 665, 1, 12037653063, 665, 0, 0, 1, 12037653017, 665, 631, 12037653017, 2, 16777216, 665, 0, 0, 113, 12037653016, 665, 1, 12037653063, 665, 0, 0, 1, 12037653016, 665, 632, 12037653016, 2, 16777216, 665, 0, 0, 114, 12037653015, 665, 1, 12037653063, 665, 0, 0, 1, 12037653015, 665, 633, 12037653015, 2, 16777216, 665, 0, 0, 115, 12037653014, 665, 1, 12037653063, 665, 0, 0, 1, 12037653014, 665, 634, 12037653014, 2, 16777216, 665, 0, 0, 116, 12037653013, 665, 1, 12037653063, 665, 0, 0, 1, 12037653013, 665, 635, 12037653013, 2, 16777216, 665, 0, 0, 117, 12037653012, 665, 1, 12037653063, 665, 0, 0, 1, 12037653012, 665, 636, 12037653012, 2, 16777216, 665, 0, 0, 118, 12037653011, 665, 1, 12037653063, 665, 0, 0, 1, 12037653011, 665, 637, 12037653011, 2, 16777216, 665, 0, 0, 119, 12037653010, 665, 1, 12037653063, 665, 0, 0, 1, 12037653010, 665, 638, 12037653010, 2, 16777216, 665, 0, 0, 909, 12037653018, 665, 1, 12037653064, 665, 0, 0, 1, 12037653018, 665, 639, 12037653018, 2, 16777216, 665, 0, 0, 12037653019, 665, 12037653076, 665, 1, 909, 0, 0, 12037653065, 665, 1, 1, 12037653019, 665, 12037653076, 665, 2, 0, 1, 640, 12037653019, 2, 16777216, 665, 2, 0, 909, 12037653020, 665, 1, 12037653066, 665, 0, 0, 1, 12037653020, 665, 641, 12037653020, 2, 16777216, 665, 0, 0, 909, 12037653023, 665, 2, 12037653068, 665, 0, 0, 12037653022, 665, 1ULL, 1, 0, 12037653023, 665, 0, 12037653105, 665, 1, 1, 2, 0, 0, 1, 12037653023, 665, 642, 12037653023, 2, 16777216, 665, 0, 0, 909, 12037653021, 665, 1, 12037653067, 665, 0, 0, 1, 12037653021, 665, 643, 12037653021, 2, 16777216, 665, 0, 0, 12037653025, 665, 25341984838, 371, 1, 909, 0, 0, 12037653070, 665, 1, 1, 12037653025, 665, 25341984838, 371, 2, 0, 1, 644, 12037653025, 2, 16777216, 665, 2, 0, 909, 12037653024, 665, 1, 12037653069, 665, 0, 2, 1, 12037653024, 665, 0, 12037653093, 665, 12037653097, 665, 1, 0, 12037653001, 665, 0, 2, 1, 1, 0, 12037653094, 665, 0, 1, 12037653098, 665, 645, 12037653024, 2, 16777216, 665, 0, 0, 12037653072, 665, 12037653107, 665, 1, 0, 12037653071, 665, 0, 12037653073, 665, 12037653082, 665, 2, 1, 0, 0, 12037653074, 665, 25341984837, 371, 1, 2, 0, 0, 1, 12037653106, 665, 2, 0, 12037653105, 665, 0, 12037653134, 665, 25341984841, 371, 1, 12037653136, 665, 0, 3, 1, 25341984841, 371, 0, 25341984840, 371, 25341984841, 371, 1, 2, 0, 0, 3, 25341984841, 371, 2, 25341984839, 371, 0, 0, 1, 2, 1, 0, 25341984841, 371, 646, 12037653022, 2, 16777216, 665, 1, 0, 12037653022, 665, 0, 647, 0, 0ULL, 0, 12037652977, 665, 909, 1, 0, 12037653103, 665, 648, 1, 0ULL, 0, 12037652976, 665, 113, 1, 0, 12037653103, 665, 649, 1, 0ULL, 0, 12037652975, 665, 114, 1, 0, 12037653103, 665, 650, 1, 0ULL, 0, 12037652974, 665, 115, 1, 0, 12037653103, 665, 651, 1, 0ULL, 0, 12037652973, 665, 116, 1, 0, 12037653103, 665, 652, 1, 0ULL, 0, 12037652972, 665, 117, 1, 0, 12037653103, 665, 653, 1, 0ULL, 0, 12037652971, 665, 118, 1, 0, 12037653103, 665, 654, 1, 0ULL, 0, 12037652970, 665, 119, 1, 0, 12037653103, 665, 655, 1, 0ULL, 0, 12037652985, 665, 0, 1, 0, 0, 656, 1, 0ULL, 0, 12037652984, 665, 1, 1, 0, 0, 657, 1, 0ULL, 0, 12037652983, 665, 2, 1, 0, 0, 658, 1, 0ULL, 0, 12037652982, 665, 3, 1, 0, 0, 659, 1, 0ULL, 0, 12037652981, 665, 4, 1, 0, 0, 660, 1, 0ULL, 0, 12037652980, 665, 5, 1, 0, 0, 661, 1, 0ULL, 0, 12037652979, 665, 6, 1, 0, 0, 662, 1, 0ULL, 0, 12037652978, 665, 7, 1, 0, 0, 663, 1, 0ULL, 0, 12037652993, 665, 8, 1, 0, 0, 664, 1, 0ULL, 0, 12037652992, 665, 9, 1, 0, 0, 665, 1, 0ULL, 0, 12037652991, 665, 10, 1, 0, 0, 666, 1, 0ULL, 0, 12037652990, 665, 11, 1, 0, 0, 667, 1, 0ULL, 0, 12037652989, 665, 12, 1, 0, 0, 668, 1, 0ULL, 0, 12037652988, 665, 13, 1, 0, 0, 669, 1, 0ULL, 0, 12037652987, 665, 14, 1, 0, 0, 670, 1, 0ULL, 0, 12037652986, 665, 15, 1, 0, 0, 671, 1, 0ULL, 0, 12037653019, 665, 16, 1, 0, 0, 672, 1, 0ULL, 0, 12037653021, 665, 17, 1, 0, 0, 673, 1, 0ULL, 0, 12037653018, 665, 18, 1, 0, 0, 674, 1, 0ULL, 0, 12037653017, 665, 19, 1, 1, 0, 675, 1, 0ULL, 0, 12037653016, 665, 20, 1, 1, 0, 676, 1, 0ULL, 0, 12037653015, 665, 21, 1, 1, 0, 677, 1, 0ULL, 0, 12037653014, 665, 22, 1, 1, 0, 678, 1, 0ULL, 0, 12037653013, 665, 23, 1, 1, 0, 679, 1, 0ULL, 0, 12037653012, 665, 24, 1, 1, 0, 680, 1, 0ULL, 0, 12037653011, 665, 25, 1, 1, 0, 681, 1, 0ULL, 0, 12037653010, 665, 26, 1, 1, 0, 682, 1, 0ULL, 0, 12037653001, 665, 27, 1, 1, 0, 683, 1, 0ULL, 0, 12037653000, 665, 28, 1, 1, 0, 684, 1, 0ULL, 0, 12037652999, 665, 29, 1, 1, 0, 685, 1, 0ULL, 0, 12037652998, 665, 30, 1, 1, 0, 686, 1, 0ULL, 0, 12037652997, 665, 31, 1, 1, 0, 687, 1, 0ULL, 0, 12037652996, 665, 32, 1, 1, 0, 688, 1, 0ULL, 0, 12037652995, 665, 33, 1, 1, 0, 689, 1, 0ULL, 0, 12037652994, 665, 34, 1, 1, 0, 690, 1, 0ULL, 0, 12037653009, 665, 35, 1, 1, 0, 691, 1, 0ULL, 0, 12037653008, 665, 36, 1, 1, 0, 692, 1, 0ULL, 0, 12037653007, 665, 37, 1, 1, 0, 693, 1, 0ULL, 0, 12037653006, 665, 38, 1, 1, 0, 694, 1, 0ULL, 0, 12037653005, 665, 39, 1, 1, 0, 695, 1, 0ULL, 0, 12037653004, 665, 40, 1, 1, 0, 696, 1, 0ULL, 0, 12037653003, 665, 41, 1, 1, 0, 697, 1, 0ULL, 0, 12037653002, 665, 42, 1, 1, 0, 698, 1, 0ULL, 0, 12037653020, 665, 43, 1, 1, 0, 699, 1, 0ULL, 0, 1ULL, 12037653087, 665, 1, 0, 12037653087, 665, 700, 1, 0ULL, 0, 1ULL, 12037653088, 665, 1, 0, 12037653088, 665, 701, 1, 0ULL, 0, 1ULL, 12037653089, 665, 1, 0, 12037653089, 665, 702, 1, 0ULL, 0, 1ULL, 12037653103, 665, 1, 0, 12037653103, 665, 703, 1, 0ULL, 0, 1ULL, 12037653101, 665, 1, 0, 12037653101, 665, 704, 1, 0ULL, 0, 1ULL, 12037653093, 665, 1, 0, 12037653093, 665, 705, 1, 0ULL, 0, 1ULL, 12037653096, 665, 1, 0, 12037653096, 665, 706, 1, 0ULL, 0, 1ULL, 12037653095, 665, 1, 0, 12037653095, 665, 707, 1, 0ULL, 0, 1ULL, 12037653097, 665, 1, 0, 12037653097, 665, 708, 1, 0ULL, 0, 1ULL, 12037653100, 665, 1, 0, 12037653100, 665, 709, 1, 0ULL, 0, 1ULL, 12037653099, 665, 1, 0, 12037653099, 665, 710, 1, 0ULL, 0, 1ULL, 12037653079, 665, 1, 0, 12037653079, 665, 711, 1, 0ULL, 0, 1ULL, 12037653080, 665, 1, 0, 12037653080, 665, 712, 1, 0ULL, 0, 1ULL, 12037653078, 665, 1, 0, 12037653078, 665, 713, 1, 0ULL, 0, 1ULL, 12037653077, 665, 1, 0, 12037653077, 665, 714, 1, 0ULL, 0, 1ULL, 12037653071, 665, 1, 0, 12037653071, 665, 715, 1, 0ULL, 0, 1ULL, 12037653073, 665, 1, 0, 12037653073, 665, 716, 1, 0ULL, 0, 1ULL, 12037653072, 665, 1, 0, 12037653072, 665, 717, 1, 0ULL, 0, 1ULL, 12037653090, 665, 1, 0, 12037653090, 665, 718, 1, 0ULL, 0, 1ULL, 12037653091, 665, 1, 0, 12037653091, 665, 719, 1, 0ULL, 0, 1ULL, 12037653092, 665, 1, 0, 12037653092, 665, 720, 1, 0ULL, 0, 1ULL, 12037653083, 665, 1, 0, 12037653083, 665, 721, 1, 0ULL, 0, 1ULL, 12037653084, 665, 1, 0, 12037653084, 665, 722, 1, 0ULL, 0, 1ULL, 12037653104, 665, 1, 0, 12037653104, 665, 723, 1, 0ULL, 0, 1ULL, 12037653058, 665, 1, 0, 12037653058, 665, 724, 1, 0ULL, 0, 1ULL, 12037653059, 665, 1, 0, 12037653059, 665, 725, 1, 0ULL, 0, 1ULL, 12037653060, 665, 1, 0, 12037653060, 665, 726, 1, 0ULL, 0, 1ULL, 12037653064, 665, 1, 0, 12037653064, 665, 727, 1, 0ULL, 0, 1ULL, 12037653061, 665, 1, 0, 12037653061, 665, 728, 1, 0ULL, 0, 1ULL, 12037653062, 665, 1, 0, 12037653062, 665, 729, 1, 0ULL, 0, 1ULL, 12037653067, 665, 1, 0, 12037653067, 665, 730, 1, 0ULL, 0, 1ULL, 12037653069, 665, 1, 0, 12037653069, 665, 731, 1, 0ULL, 0, 1ULL, 12037653066, 665, 1, 0, 12037653066, 665, 732, 1, 0ULL, 0, 1ULL, 12037653070, 665, 1, 0, 12037653070, 665, 733, 1, 0ULL, 0, 1ULL, 12037653068, 665, 1, 0, 12037653068, 665, 734, 1, 0ULL, 0, 1ULL, 12037653065, 665, 1, 0, 12037653065, 665, 735, 1, 0ULL, 0, 1ULL, 12037653063, 665, 1, 0, 12037653063, 665, 736, 1, 0ULL, 0, 1ULL, 12037653086, 665, 1, 0, 12037653086, 665, 737, 1, 0ULL, 0, 1ULL, 12037653085, 665, 1, 0, 12037653085, 665, 738, 1, 0ULL, 0, 1ULL, 12037653081, 665, 1, 0, 12037653081, 665, 739, 1, 0ULL, 0, 1ULL, 12037653135, 665, 1, 0, 12037653135, 665, 740, 1, 0ULL, 0, 1ULL, 12037653074, 665, 1, 0, 12037653074, 665, 741, 1, 0ULL, 0, 1ULL, 12037653105, 665, 1, 0, 12037653105, 665, 742, 1, 0ULL, 0, 1ULL, 12037653106, 665, 1, 0, 12037653106, 665, 743, 1, 0ULL, 0, 1ULL, 12037653094, 665, 1, 0, 12037653094, 665, 744, 1, 0ULL, 0, 1ULL, 12037653098, 665, 1, 0, 12037653098, 665, 745, 1, 0ULL, 0, 1ULL, 12037653136, 665, 1, 0, 12037653136, 665, 746, 1, 0ULL, 0, 1ULL, 0, 1, 12037653108, 665, 0, 0, 1, 12037653087, 665, 1, 0, 12037653088, 665, 0, 1, 12037653089, 665, 747, 12037653108, 2, 16777216, 665, 0, 0, 1ULL, 0, 1, 12037653109, 665, 0, 0, 1, 12037653101, 665, 1, 0, 12037653085, 665, 0, 1, 12037653100, 665, 748, 12037653109, 2, 16777216, 665, 0, 0, 1ULL, 0, 1, 12037653111, 665, 0, 0, 12037653120, 665, 12037653096, 665, 2, 1, 0, 749, 12037653111, 2, 16777216, 665, 2, 0, 1ULL, 0, 1, 12037653113, 665, 0, 0, 12037653100, 665, 12037653120, 665, 2, 1, 0, 750, 12037653113, 2, 16777216, 665, 2, 0, 1ULL, 0, 2, 12037653112, 665, 0, 0, 12037653100, 665, 12037653086, 665, 1, 0, 12037653085, 665, 0, 1, 12037653120, 665, 1, 2, 0, 751, 12037653112, 2, 16777216, 665, 1, 0, 1ULL, 0, 1, 12037653110, 665, 0, 0, 1, 12037653090, 665, 1, 0, 12037653091, 665, 0, 1, 12037653092, 665, 752, 12037653110, 2, 16777216, 665, 0, 0, 25341984845, 371, 1ULL, 5, 0, 0, 0, 23194501143, 128, 3, 1, 23194501140, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501140, 2, 16777216, 128, 3, 1, 23194501143, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984845, 2, 16777216, 371, 1, 1, 25341984845, 371, 25341984998, 371, 6, 0, 1, 0, 25341984848, 371, 1ULL, 7, 0, 0, 0, 23194501149, 128, 3, 1, 23194501146, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501146, 2, 16777216, 128, 3, 1, 23194501149, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984848, 2, 16777216, 371, 1, 1, 25341984848, 371, 25341985001, 371, 8, 0, 1, 0, 25341984851, 371, 1ULL, 9, 0, 0, 0, 23194501121, 128, 3, 1, 23194501120, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501120, 2, 16777216, 128, 3, 1, 23194501121, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984851, 2, 16777216, 371, 1, 1, 25341984851, 371, 25341985004, 371, 10, 0, 1, 0, 25341984854, 371, 1ULL, 11, 0, 0, 0, 23194501123, 128, 3, 1, 23194501122, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501122, 2, 16777216, 128, 3, 1, 23194501123, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984854, 2, 16777216, 371, 1, 1, 25341984854, 371, 25341985007, 371, 12, 0, 1, 0, 25341984857, 371, 1ULL, 13, 0, 0, 0, 23194501125, 128, 3, 1, 23194501124, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501124, 2, 16777216, 128, 3, 1, 23194501125, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984857, 2, 16777216, 371, 1, 1, 25341984857, 371, 25341985010, 371, 14, 0, 1, 0, 25341984860, 371, 1ULL, 15, 0, 0, 0, 23194501127, 128, 3, 1, 23194501126, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501126, 2, 16777216, 128, 3, 1, 23194501127, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984860, 2, 16777216, 371, 1, 1, 25341984860, 371, 25341985013, 371, 16, 0, 1, 0, 25341984863, 371, 1ULL, 17, 0, 0, 0, 23194501155, 128, 3, 1, 23194501152, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501152, 2, 16777216, 128, 3, 1, 23194501155, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984863, 2, 16777216, 371, 1, 1, 25341984863, 371, 25341985016, 371, 18, 0, 1, 0, 25341984866, 371, 1ULL, 19, 0, 0, 0, 23194501129, 128, 3, 1, 23194501128, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501128, 2, 16777216, 128, 3, 1, 23194501129, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984866, 2, 16777216, 371, 1, 1, 25341984866, 371, 25341985019, 371, 20, 0, 1, 0, 25341984869, 371, 1ULL, 21, 0, 0, 0, 23194501131, 128, 3, 1, 23194501130, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501130, 2, 16777216, 128, 3, 1, 23194501131, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984869, 2, 16777216, 371, 1, 1, 25341984869, 371, 25341985022, 371, 22, 0, 1, 0, 25341984872, 371, 1ULL, 23, 0, 0, 0, 23194501133, 128, 3, 1, 23194501132, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501132, 2, 16777216, 128, 3, 1, 23194501133, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984872, 2, 16777216, 371, 1, 1, 25341984872, 371, 25341985025, 371, 24, 0, 1, 0, 25341984875, 371, 1ULL, 25, 0, 0, 0, 23194501161, 128, 3, 1, 23194501158, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501158, 2, 16777216, 128, 3, 1, 23194501161, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984875, 2, 16777216, 371, 1, 1, 25341984875, 371, 25341985028, 371, 26, 0, 1, 0, 25341984878, 371, 1ULL, 27, 0, 0, 0, 23194501167, 128, 3, 1, 23194501164, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501164, 2, 16777216, 128, 3, 1, 23194501167, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984878, 2, 16777216, 371, 1, 1, 25341984878, 371, 25341985031, 371, 28, 0, 1, 0, 25341984881, 371, 1ULL, 29, 0, 0, 0, 23194501135, 128, 3, 1, 23194501134, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501134, 2, 16777216, 128, 3, 1, 23194501135, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984881, 2, 16777216, 371, 1, 1, 25341984881, 371, 25341985034, 371, 30, 0, 1, 0, 25341984884, 371, 1ULL, 31, 0, 0, 0, 23194501173, 128, 3, 1, 23194501170, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501170, 2, 16777216, 128, 3, 1, 23194501173, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984884, 2, 16777216, 371, 1, 1, 25341984884, 371, 25341985037, 371, 32, 0, 1, 0, 25341984887, 371, 1ULL, 33, 0, 0, 0, 23194501179, 128, 3, 1, 23194501176, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501176, 2, 16777216, 128, 3, 1, 23194501179, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984887, 2, 16777216, 371, 1, 1, 25341984887, 371, 25341985040, 371, 34, 0, 1, 0, 25341984890, 371, 1ULL, 35, 0, 0, 0, 23194501185, 128, 3, 1, 23194501182, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501182, 2, 16777216, 128, 3, 1, 23194501185, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984890, 2, 16777216, 371, 1, 1, 25341984890, 371, 25341985043, 371, 36, 0, 1, 0, 25341984893, 371, 1ULL, 37, 0, 0, 0, 23194501191, 128, 3, 1, 23194501188, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501188, 2, 16777216, 128, 3, 1, 23194501191, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984893, 2, 16777216, 371, 1, 1, 25341984893, 371, 25341985046, 371, 38, 0, 1, 0, 25341984896, 371, 1ULL, 39, 0, 0, 0, 23194501197, 128, 3, 1, 23194501194, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501194, 2, 16777216, 128, 3, 1, 23194501197, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984896, 2, 16777216, 371, 1, 1, 25341984896, 371, 25341985049, 371, 40, 0, 1, 0, 25341984899, 371, 1ULL, 41, 0, 0, 0, 23194501203, 128, 3, 1, 23194501200, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501200, 2, 16777216, 128, 3, 1, 23194501203, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984899, 2, 16777216, 371, 1, 1, 25341984899, 371, 25341985052, 371, 42, 0, 1, 0, 25341984902, 371, 1ULL, 43, 0, 0, 0, 23194501209, 128, 3, 1, 23194501206, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501206, 2, 16777216, 128, 3, 1, 23194501209, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984902, 2, 16777216, 371, 1, 1, 25341984902, 371, 25341985055, 371, 44, 0, 1, 0, 25341984905, 371, 1ULL, 45, 0, 0, 0, 23194501215, 128, 3, 1, 23194501212, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501212, 2, 16777216, 128, 3, 1, 23194501215, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984905, 2, 16777216, 371, 1, 1, 25341984905, 371, 25341985058, 371, 46, 0, 1, 0, 25341984908, 371, 1ULL, 47, 0, 0, 0, 23194501221, 128, 3, 1, 23194501218, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501218, 2, 16777216, 128, 3, 1, 23194501221, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984908, 2, 16777216, 371, 1, 1, 25341984908, 371, 25341985061, 371, 48, 0, 1, 0, 25341984911, 371, 1ULL, 49, 0, 0, 0, 23194501227, 128, 3, 1, 23194501224, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501224, 2, 16777216, 128, 3, 1, 23194501227, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984911, 2, 16777216, 371, 1, 1, 25341984911, 371, 25341985064, 371, 50, 0, 1, 0, 25341984914, 371, 1ULL, 51, 0, 0, 0, 23194501137, 128, 3, 1, 23194501136, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501136, 2, 16777216, 128, 3, 1, 23194501137, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 4, 3, 0, 0, 45, 1ULL, 1, 0, 925, 1, 0, 45, 2, 16777216, 1ULL, 1, 0, 0, 1, 3, 25341984844, 371, 2, 0, 0, 3, 1, 925, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 25341984914, 2, 16777216, 371, 4, 1, 25341984914, 371, 2, 4, 0, 1, 0, 25341984917, 371, 1ULL, 52, 0, 0, 0, 23194501139, 128, 3, 1, 23194501138, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501138, 2, 16777216, 128, 3, 1, 23194501139, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984917, 2, 16777216, 371, 1, 1, 25341984917, 371, 25341985067, 371, 53, 0, 1, 0, 25341984920, 371, 1ULL, 54, 0, 0, 0, 23194501233, 128, 3, 1, 23194501230, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501230, 2, 16777216, 128, 3, 1, 23194501233, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984920, 2, 16777216, 371, 1, 1, 25341984920, 371, 25341985070, 371, 55, 0, 1, 0, 25341984923, 371, 1ULL, 56, 0, 0, 0, 23194501239, 128, 3, 1, 23194501236, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501236, 2, 16777216, 128, 3, 1, 23194501239, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984923, 2, 16777216, 371, 1, 1, 25341984923, 371, 25341985073, 371, 57, 0, 1, 0, 25341984926, 371, 1ULL, 58, 0, 0, 0, 23194501245, 128, 3, 1, 23194501242, 128, 0, 0, 1ULL, 3, 2, 2, 0, 3, 1, 2, 0, 23194501242, 2, 16777216, 128, 3, 1, 23194501245, 128, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 25341984926, 2, 16777216, 371, 1, 1, 25341984926, 371, 25341985076, 371, 3, 0, 1, 0, 25341984929, 371, 1ULL, 59, 0, 0, 0, 12037652763, 665, 1, 12037652764, 665, 2, 12037652765, 665, 3, 12037652747, 665, 4, 12037652748, 665, 5, 12037652749, 665, 6, 12037652750, 665, 7, 12037652751, 665, 8, 12037652752, 665, 9, 12037652753, 665, 10, 12037652754, 665, 11, 12037652755, 665, 12, 12037652756, 665, 13, 12037652757, 665, 14, 12037652758, 665, 15, 12037652759, 665, 16, 12037652760, 665, 17, 12037652761, 665, 18, 12037652762, 665, 19, 12037652765, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 1, 0, 3, 0, 25341984929, 2, 16777216, 371, 1, 1, 25341984929, 371, 25341985079, 371, 60, 0, 1, 0, 25341984932, 371, 1ULL, 61, 0, 0, 0, 12037652714, 665, 1, 12037652715, 665, 2, 12037652716, 665, 3, 12037652717, 665, 4, 12037652718, 665, 5, 12037652719, 665, 6, 12037652720, 665, 7, 12037652721, 665, 8, 12037652746, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 0, 1, 1, 1, 0, 3, 0, 25341984932, 2, 16777216, 371, 1, 1, 25341984932, 371, 25341985082, 371, 62, 0, 1, 0, 25341984935, 371, 1ULL, 63, 0, 0, 1, 12037652701, 665, 2, 12037652702, 665, 3, 12037652703, 665, 4, 12037652704, 665, 0, 65536ULL, 12037652539, 665, 53, 0, 12037652538, 665, 5, 53, 0, 65536ULL, 12037652541, 665, 54, 0, 12037652540, 665, 6, 54, 0, 65536ULL, 12037652543, 665, 55, 0, 12037652542, 665, 7, 55, 0, 65536ULL, 12037652545, 665, 56, 0, 12037652544, 665, 8, 56, 0, 65536ULL, 12037652547, 665, 57, 0, 12037652546, 665, 9, 57, 0, 65536ULL, 12037652549, 665, 58, 0, 12037652548, 665, 10, 58, 0, 65536ULL, 12037652551, 665, 59, 0, 12037652550, 665, 11, 59, 0, 65536ULL, 12037652553, 665, 60, 0, 12037652552, 665, 12, 60, 0, 65536ULL, 12037652555, 665, 61, 0, 12037652554, 665, 13, 61, 0, 65536ULL, 12037652557, 665, 62, 0, 12037652556, 665, 14, 62, 0, 65536ULL, 12037652559, 665, 63, 0, 12037652558, 665, 15, 63, 0, 65536ULL, 12037652561, 665, 64, 0, 12037652560, 665, 16, 64, 0, 65536ULL, 12037652563, 665, 65, 0, 12037652562, 665, 17, 65, 0, 65536ULL, 12037652565, 665, 66, 0, 12037652564, 665, 18, 66, 0, 65536ULL, 12037652567, 665, 67, 0, 12037652566, 665, 19, 67, 0, 65536ULL, 12037652569, 665, 68, 0, 12037652568, 665, 20, 68, 0, 65536ULL, 12037652571, 665, 69, 0, 12037652570, 665, 21, 69, 0, 65536ULL, 12037652573, 665, 70, 0, 12037652572, 665, 22, 70, 0, 65536ULL, 12037652575, 665, 71, 0, 12037652574, 665, 23, 71, 0, 65536ULL, 12037652577, 665, 72, 0, 12037652576, 665, 24, 72, 0, 65536ULL, 12037652579, 665, 73, 0, 12037652578, 665, 25, 73, 0, 65536ULL, 12037652581, 665, 74, 0, 12037652580, 665, 26, 74, 0, 65536ULL, 12037652583, 665, 75, 0, 12037652582, 665, 27, 75, 0, 65536ULL, 12037652585, 665, 76, 0, 12037652584, 665, 28, 76, 0, 65536ULL, 12037652587, 665, 77, 0, 12037652586, 665, 29, 77, 0, 65536ULL, 12037652589, 665, 78, 0, 12037652588, 665, 30, 78, 0, 65536ULL, 12037652591, 665, 79, 0, 12037652590, 665, 31, 79, 0, 65536ULL, 12037652593, 665, 80, 0, 12037652592, 665, 32, 80, 0, 65536ULL, 12037652595, 665, 81, 0, 12037652594, 665, 33, 81, 0, 65536ULL, 12037652597, 665, 82, 0, 12037652596, 665, 34, 82, 0, 65536ULL, 12037652599, 665, 83, 0, 12037652598, 665, 35, 83, 0, 65536ULL, 12037652601, 665, 84, 0, 12037652600, 665, 36, 84, 0, 65536ULL, 12037652619, 665, 93, 0, 12037652618, 665, 37, 93, 0, 65536ULL, 12037652621, 665, 94, 0, 12037652620, 665, 38, 94, 0, 65536ULL, 12037652623, 665, 95, 0, 12037652622, 665, 39, 95, 0, 65536ULL, 12037652625, 665, 96, 0, 12037652624, 665, 40, 96, 0, 65536ULL, 12037652627, 665, 97, 0, 12037652626, 665, 41, 97, 0, 65536ULL, 12037652629, 665, 98, 0, 12037652628, 665, 42, 98, 0, 65536ULL, 12037652631, 665, 99, 0, 12037652630, 665, 43, 99, 0, 65536ULL, 12037652633, 665, 100, 0, 12037652632, 665, 0, 100, 44, 12037652698, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 44, 0, 0, 1, 1, 1, 0, 3, 0, 25341984935, 2, 16777216, 371, 1, 1, 25341984935, 371, 25341985085, 371, 64, 0, 1, 0, 25341984938, 371, 1ULL, 65, 0, 0, 1, 12037652701, 665, 2, 12037652702, 665, 3, 12037652703, 665, 4, 12037652704, 665, 5, 53, 6, 54, 7, 55, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 78, 31, 79, 32, 80, 33, 81, 34, 82, 35, 83, 36, 84, 0, 65536ULL, 12037652603, 665, 85, 0, 12037652602, 665, 37, 85, 0, 65536ULL, 12037652605, 665, 86, 0, 12037652604, 665, 38, 86, 0, 65536ULL, 12037652607, 665, 87, 0, 12037652606, 665, 39, 87, 0, 65536ULL, 12037652609, 665, 88, 0, 12037652608, 665, 40, 88, 0, 65536ULL, 12037652611, 665, 89, 0, 12037652610, 665, 41, 89, 0, 65536ULL, 12037652613, 665, 90, 0, 12037652612, 665, 42, 90, 0, 65536ULL, 12037652615, 665, 91, 0, 12037652614, 665, 43, 91, 0, 65536ULL, 12037652617, 665, 92, 0, 12037652616, 665, 0, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 12037652699, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 1, 0, 3, 0, 25341984938, 2, 16777216, 371, 1, 1, 25341984938, 371, 25341985088, 371, 66, 0, 1, 0, 25341984941, 371, 1ULL, 67, 0, 0, 0, 12037652701, 665, 1, 12037652702, 665, 2, 12037652703, 665, 3, 12037652704, 665, 4, 53, 5, 54, 6, 55, 7, 56, 8, 57, 9, 58, 10, 59, 11, 60, 12, 61, 13, 62, 14, 63, 15, 64, 16, 65, 17, 66, 18, 67, 19, 68, 20, 69, 21, 70, 22, 71, 23, 72, 24, 73, 25, 74, 26, 75, 27, 76, 28, 77, 29, 78, 30, 79, 31, 80, 32, 81, 33, 82, 34, 83, 35, 84, 36, 85, 37, 86, 38, 87, 39, 88, 40, 89, 41, 90, 42, 91, 43, 92, 44, 93, 45, 94, 46, 95, 47, 96, 48, 97, 49, 98, 50, 99, 51, 100, 52, 12037652700, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 0, 1, 1, 1, 0, 3, 0, 25341984941, 2, 16777216, 371, 1, 1, 25341984941, 371, 25341985091, 371, 68, 0, 1, 0, 25341984944, 371, 1ULL, 69, 0, 0, 0, 12037652743, 665, 1, 12037652714, 665, 2, 12037652715, 665, 3, 12037652716, 665, 4, 12037652717, 665, 5, 12037652718, 665, 6, 12037652719, 665, 7, 12037652720, 665, 8, 12037652721, 665, 9, 12037652722, 665, 10, 12037652723, 665, 11, 12037652724, 665, 12, 12037652725, 665, 13, 12037652726, 665, 14, 12037652727, 665, 15, 12037652728, 665, 16, 12037652729, 665, 17, 12037652730, 665, 18, 12037652731, 665, 19, 12037652732, 665, 20, 12037652733, 665, 21, 12037652734, 665, 22, 12037652735, 665, 23, 12037652736, 665, 24, 12037652737, 665, 25, 12037652742, 665, 26, 12037652745, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 0, 1, 1, 1, 0, 3, 0, 25341984944, 2, 16777216, 371, 1, 1, 25341984944, 371, 25341985094, 371, 70, 0, 1, 0, 25341984947, 371, 1ULL, 71, 0, 0, 0, 12037652922, 665, 1, 12037652928, 665, 2, 12037652926, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 1, 0, 3, 0, 25341984947, 2, 16777216, 371, 1, 1, 25341984947, 371, 25341985097, 371, 72, 0, 1, 0, 25341984950, 371, 1ULL, 73, 0, 0, 0, 12037652922, 665, 1, 12037652929, 665, 2, 12037652930, 665, 3, 12037652931, 665, 4, 12037652932, 665, 5, 12037652933, 665, 6, 12037652934, 665, 7, 12037652935, 665, 8, 12037652936, 665, 9, 12037652937, 665, 10, 12037652927, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 0, 1, 1, 1, 0, 3, 0, 25341984950, 2, 16777216, 371, 1, 1, 25341984950, 371, 25341985100, 371, 74, 0, 1, 0, 25341984953, 371, 1ULL, 75, 0, 0, 0, 12037652775, 665, 1, 12037652790, 665, 2, 12037652779, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 1, 1, 1, 0, 3, 0, 25341984953, 2, 16777216, 371, 1, 1, 25341984953, 371, 25341985103, 371, 76, 0, 1, 0, 25341984956, 371, 1ULL, 77, 0, 0, 0, 12037652775, 665, 1, 12037652781, 665, 2, 12037652782, 665, 3, 12037652783, 665, 4, 12037652784, 665, 5, 12037652789, 665, 6, 12037652780, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 1, 1, 6, 0, 0, 1, 1, 1, 0, 3, 0, 25341984956, 2, 16777216, 371, 1, 1, 25341984956, 371, 25341985106, 371, 78, 0, 1, 0, 25341984959, 371, 1ULL, 79, 0, 0, 0, 12037652957, 665, 1, 12037652958, 665, 2, 12037652960, 665, 3, 12037652961, 665, 4, 12037652962, 665, 5, 12037652963, 665, 6, 12037652964, 665, 7, 12037652965, 665, 8, 12037652966, 665, 9, 12037652967, 665, 10, 12037652968, 665, 11, 12037652959, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 0, 1, 1, 1, 0, 3, 0, 25341984959, 2, 16777216, 371, 1, 1, 25341984959, 371, 25341985109, 371, 80, 0, 1, 0, 25341984962, 371, 1ULL, 81, 0, 0, 0, 12037652763, 665, 1, 12037652764, 665, 2, 12037652765, 665, 3, 12037652747, 665, 4, 12037652748, 665, 5, 12037652749, 665, 6, 12037652750, 665, 7, 12037652751, 665, 8, 12037652752, 665, 9, 12037652753, 665, 10, 12037652754, 665, 11, 12037652755, 665, 12, 12037652756, 665, 13, 12037652757, 665, 14, 12037652758, 665, 15, 12037652759, 665, 16, 12037652760, 665, 17, 12037652761, 665, 18, 12037652762, 665, 19, 12037652763, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 2, 0, 3, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 12037652993, 665, 4, 12037652992, 665, 5, 12037652991, 665, 6, 12037652990, 665, 7, 12037652989, 665, 8, 12037652988, 665, 9, 12037652987, 665, 10, 12037652986, 665, 11, 0ULL, 12, 0ULL, 13, 0ULL, 14, 0ULL, 15, 12037653137, 665, 16, 12037653138, 665, 17, 12037653139, 665, 18, 12037653140, 665, 19, 12037653086, 665, 12037653085, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 0, 1, 1, 1, 0, 3, 0, 25341984962, 2, 16777216, 371, 2, 2, 25341984962, 371, 1, 82, 0, 2, 0, 25341984965, 371, 1ULL, 83, 0, 0, 0, 12037652763, 665, 1, 12037652764, 665, 2, 12037652765, 665, 3, 12037652747, 665, 4, 12037652748, 665, 5, 12037652749, 665, 6, 12037652750, 665, 7, 12037652751, 665, 8, 12037652752, 665, 9, 12037652753, 665, 10, 12037652754, 665, 11, 12037652755, 665, 12, 12037652756, 665, 13, 12037652757, 665, 14, 12037652758, 665, 15, 12037652759, 665, 16, 12037652760, 665, 17, 12037652761, 665, 18, 12037652762, 665, 19, 0ULL, 20, 0ULL, 21, 0ULL, 22, 0ULL, 23, 0ULL, 24, 0ULL, 25, 0ULL, 26, 0ULL, 27, 0ULL, 28, 12037652764, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 2, 0, 3, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 12037652977, 665, 4, 12037652976, 665, 5, 12037652975, 665, 6, 12037652974, 665, 7, 12037652973, 665, 8, 0ULL, 9, 12037652985, 665, 10, 12037652984, 665, 11, 12037653137, 665, 12, 12037653138, 665, 13, 12037653139, 665, 14, 12037653140, 665, 15, 12037653141, 665, 16, 12037653142, 665, 17, 12037653143, 665, 18, 12037653144, 665, 19, 12037652972, 665, 20, 12037652971, 665, 21, 12037652970, 665, 22, 12037652983, 665, 23, 12037652982, 665, 24, 12037652981, 665, 25, 12037652980, 665, 26, 12037652979, 665, 27, 12037652978, 665, 28, 12037653086, 665, 12037653085, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 1, 1, 1, 28, 0, 0, 1, 1, 1, 0, 3, 0, 25341984965, 2, 16777216, 371, 2, 2, 25341984965, 371, 1, 84, 0, 2, 0, 25341984968, 371, 1ULL, 85, 0, 0, 0, 12037652822, 665, 1, 12037652823, 665, 2, 12037652824, 665, 3, 12037652825, 665, 4, 12037652842, 665, 5, 12037652843, 665, 6, 12037652844, 665, 7, 12037652845, 665, 8, 12037652830, 665, 9, 12037652831, 665, 10, 12037652832, 665, 11, 12037652833, 665, 12, 12037652834, 665, 13, 12037652835, 665, 14, 12037652836, 665, 15, 12037652837, 665, 16, 12037652892, 665, 2ULL, 17, 12037652880, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 0, 1, 1, 1, 0, 3, 0, 25341984968, 2, 16777216, 371, 1, 1, 25341984968, 371, 25341985112, 371, 86, 0, 1, 0, 25341984971, 371, 1ULL, 87, 0, 0, 0, 12037652822, 665, 1, 12037652823, 665, 2, 12037652824, 665, 3, 12037652825, 665, 4, 12037652842, 665, 5, 12037652843, 665, 6, 12037652844, 665, 7, 12037652845, 665, 8, 12037652830, 665, 9, 12037652831, 665, 10, 12037652832, 665, 11, 12037652833, 665, 12, 12037652834, 665, 13, 12037652835, 665, 14, 12037652836, 665, 15, 12037652837, 665, 16, 12037652826, 665, 17, 12037652827, 665, 18, 12037652828, 665, 19, 12037652829, 665, 20, 12037652892, 665, 2ULL, 21, 12037652879, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 1, 1, 1, 21, 0, 0, 1, 1, 1, 0, 3, 0, 25341984971, 2, 16777216, 371, 1, 1, 25341984971, 371, 25341985115, 371, 88, 0, 1, 0, 25341984974, 371, 1ULL, 89, 0, 0, 0, 12037652483, 665, 1, 12037652484, 665, 2, 12037652485, 665, 3, 12037652486, 665, 4, 12037652487, 665, 5, 12037652488, 665, 6, 12037652489, 665, 7, 12037652490, 665, 8, 12037652491, 665, 9, 12037652492, 665, 10, 12037652493, 665, 11, 12037652494, 665, 12, 12037652495, 665, 13, 12037652496, 665, 14, 12037652497, 665, 15, 12037652498, 665, 16, 12037652499, 665, 17, 12037652500, 665, 18, 12037652517, 665, 19, 12037652518, 665, 20, 12037652519, 665, 21, 12037652520, 665, 22, 12037652521, 665, 23, 12037652522, 665, 24, 12037652523, 665, 25, 12037652524, 665, 26, 12037652534, 665, 27, 12037652535, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 1, 0, 3, 0, 25341984974, 2, 16777216, 371, 1, 1, 25341984974, 371, 25341985118, 371, 90, 0, 1, 0, 25341984977, 371, 1ULL, 91, 0, 0, 0, 12037652483, 665, 1, 12037652484, 665, 2, 12037652485, 665, 3, 12037652486, 665, 4, 12037652487, 665, 5, 12037652488, 665, 6, 12037652489, 665, 7, 12037652490, 665, 8, 12037652491, 665, 9, 12037652492, 665, 10, 12037652493, 665, 11, 12037652494, 665, 12, 12037652495, 665, 13, 12037652496, 665, 14, 12037652497, 665, 15, 12037652498, 665, 16, 12037652499, 665, 17, 12037652500, 665, 18, 12037652517, 665, 19, 12037652518, 665, 20, 12037652519, 665, 21, 12037652520, 665, 22, 12037652521, 665, 23, 12037652522, 665, 24, 12037652523, 665, 25, 12037652524, 665, 26, 12037652534, 665, 27, 12037652501, 665, 28, 12037652502, 665, 29, 12037652503, 665, 30, 12037652504, 665, 31, 12037652505, 665, 32, 12037652506, 665, 33, 12037652507, 665, 34, 12037652508, 665, 35, 12037652509, 665, 36, 12037652510, 665, 37, 12037652511, 665, 38, 12037652512, 665, 39, 12037652513, 665, 40, 12037652514, 665, 41, 12037652515, 665, 42, 12037652516, 665, 43, 12037652537, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 0, 1, 1, 1, 0, 3, 0, 25341984977, 2, 16777216, 371, 1, 1, 25341984977, 371, 25341985121, 371, 92, 0, 1, 0, 25341984980, 371, 1ULL, 93, 0, 0, 0, 12037652483, 665, 1, 12037652484, 665, 2, 12037652485, 665, 3, 12037652486, 665, 4, 12037652487, 665, 5, 12037652488, 665, 6, 12037652489, 665, 7, 12037652490, 665, 8, 12037652491, 665, 9, 12037652492, 665, 10, 12037652517, 665, 11, 12037652518, 665, 12, 12037652519, 665, 13, 12037652520, 665, 14, 12037652521, 665, 15, 12037652522, 665, 16, 12037652523, 665, 17, 12037652524, 665, 18, 12037652534, 665, 19, 12037652501, 665, 20, 12037652502, 665, 21, 12037652503, 665, 22, 12037652504, 665, 23, 12037652505, 665, 24, 12037652506, 665, 25, 12037652507, 665, 26, 12037652508, 665, 27, 12037652536, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 0, 1, 1, 1, 0, 3, 0, 25341984980, 2, 16777216, 371, 1, 1, 25341984980, 371, 25341985124, 371, 94, 0, 1, 0, 25341984983, 371, 1ULL, 95, 0, 0, 0, 25341984983, 2, 16777216, 371, 25341985130, 371, 1, 25341984983, 371, 25341985127, 371, 96, 0, 1, 0, 25341984986, 371, 1ULL, 97, 0, 0, 0, 25341984986, 2, 16777216, 371, 25341985136, 371, 1, 25341984986, 371, 25341985133, 371, 98, 0, 1, 0, 1ULL, 12037652525, 665, 1, 0, 12037652483, 2, 16777216, 665, 0, 12037652525, 665, 12037652484, 2, 16777216, 665, 53, 1, 0, 54, 12037652525, 665, 12037652483, 2, 16777216, 665, 0, 1ULL, 12037652525, 665, 1, 0, 12037652480, 665, 0, 12037652525, 665, 12037652481, 665, 55, 1, 0, 0, 12037652538, 665, 12037652554, 665, 1, 0, 12037652570, 665, 56, 1, 12037652618, 665, 0, 12037652538, 665, 12037652555, 665, 1, 12037652539, 665, 12037652554, 665, 2, 0, 1, 0, 2, 12037652571, 665, 57, 0, 12037652619, 665, 0, 12037652538, 665, 12037652556, 665, 1, 12037652539, 665, 12037652555, 665, 2, 0, 1, 0, 12037652540, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652572, 665, 58, 0, 12037652620, 665, 0, 12037652538, 665, 12037652557, 665, 1, 12037652539, 665, 12037652556, 665, 2, 0, 1, 0, 12037652540, 665, 12037652555, 665, 1, 2, 0, 0, 12037652541, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652573, 665, 59, 0, 12037652621, 665, 0, 12037652538, 665, 12037652558, 665, 1, 12037652539, 665, 12037652557, 665, 2, 0, 1, 0, 12037652540, 665, 12037652556, 665, 1, 2, 0, 0, 12037652541, 665, 12037652555, 665, 2, 1, 0, 0, 12037652542, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652574, 665, 60, 0, 12037652622, 665, 0, 12037652538, 665, 12037652559, 665, 1, 12037652539, 665, 12037652558, 665, 2, 0, 1, 0, 12037652540, 665, 12037652557, 665, 1, 2, 0, 0, 12037652541, 665, 12037652556, 665, 2, 1, 0, 0, 12037652542, 665, 12037652555, 665, 1, 2, 0, 0, 12037652543, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652575, 665, 61, 0, 12037652623, 665, 0, 12037652538, 665, 12037652560, 665, 1, 12037652539, 665, 12037652559, 665, 2, 0, 1, 0, 12037652540, 665, 12037652558, 665, 1, 2, 0, 0, 12037652541, 665, 12037652557, 665, 2, 1, 0, 0, 12037652542, 665, 12037652556, 665, 1, 2, 0, 0, 12037652543, 665, 12037652555, 665, 2, 1, 0, 0, 12037652544, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652576, 665, 62, 0, 12037652624, 665, 0, 12037652538, 665, 12037652561, 665, 1, 12037652539, 665, 12037652560, 665, 2, 0, 1, 0, 12037652540, 665, 12037652559, 665, 1, 2, 0, 0, 12037652541, 665, 12037652558, 665, 2, 1, 0, 0, 12037652542, 665, 12037652557, 665, 1, 2, 0, 0, 12037652543, 665, 12037652556, 665, 2, 1, 0, 0, 12037652544, 665, 12037652555, 665, 1, 2, 0, 0, 12037652545, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652577, 665, 63, 0, 12037652625, 665, 0, 12037652538, 665, 12037652562, 665, 1, 12037652539, 665, 12037652561, 665, 2, 0, 1, 0, 12037652540, 665, 12037652560, 665, 1, 2, 0, 0, 12037652541, 665, 12037652559, 665, 2, 1, 0, 0, 12037652542, 665, 12037652558, 665, 1, 2, 0, 0, 12037652543, 665, 12037652557, 665, 2, 1, 0, 0, 12037652544, 665, 12037652556, 665, 1, 2, 0, 0, 12037652545, 665, 12037652555, 665, 2, 1, 0, 0, 12037652546, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652578, 665, 64, 0, 12037652626, 665, 0, 12037652538, 665, 12037652563, 665, 1, 12037652539, 665, 12037652562, 665, 2, 0, 1, 0, 12037652540, 665, 12037652561, 665, 1, 2, 0, 0, 12037652541, 665, 12037652560, 665, 2, 1, 0, 0, 12037652542, 665, 12037652559, 665, 1, 2, 0, 0, 12037652543, 665, 12037652558, 665, 2, 1, 0, 0, 12037652544, 665, 12037652557, 665, 1, 2, 0, 0, 12037652545, 665, 12037652556, 665, 2, 1, 0, 0, 12037652546, 665, 12037652555, 665, 1, 2, 0, 0, 12037652547, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652579, 665, 65, 0, 12037652627, 665, 0, 12037652538, 665, 12037652564, 665, 1, 12037652539, 665, 12037652563, 665, 2, 0, 1, 0, 12037652540, 665, 12037652562, 665, 1, 2, 0, 0, 12037652541, 665, 12037652561, 665, 2, 1, 0, 0, 12037652542, 665, 12037652560, 665, 1, 2, 0, 0, 12037652543, 665, 12037652559, 665, 2, 1, 0, 0, 12037652544, 665, 12037652558, 665, 1, 2, 0, 0, 12037652545, 665, 12037652557, 665, 2, 1, 0, 0, 12037652546, 665, 12037652556, 665, 1, 2, 0, 0, 12037652547, 665, 12037652555, 665, 2, 1, 0, 0, 12037652548, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652580, 665, 66, 0, 12037652628, 665, 0, 12037652538, 665, 12037652565, 665, 1, 12037652539, 665, 12037652564, 665, 2, 0, 1, 0, 12037652540, 665, 12037652563, 665, 1, 2, 0, 0, 12037652541, 665, 12037652562, 665, 2, 1, 0, 0, 12037652542, 665, 12037652561, 665, 1, 2, 0, 0, 12037652543, 665, 12037652560, 665, 2, 1, 0, 0, 12037652544, 665, 12037652559, 665, 1, 2, 0, 0, 12037652545, 665, 12037652558, 665, 2, 1, 0, 0, 12037652546, 665, 12037652557, 665, 1, 2, 0, 0, 12037652547, 665, 12037652556, 665, 2, 1, 0, 0, 12037652548, 665, 12037652555, 665, 1, 2, 0, 0, 12037652549, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652581, 665, 67, 0, 12037652629, 665, 0, 12037652538, 665, 12037652566, 665, 1, 12037652539, 665, 12037652565, 665, 2, 0, 1, 0, 12037652540, 665, 12037652564, 665, 1, 2, 0, 0, 12037652541, 665, 12037652563, 665, 2, 1, 0, 0, 12037652542, 665, 12037652562, 665, 1, 2, 0, 0, 12037652543, 665, 12037652561, 665, 2, 1, 0, 0, 12037652544, 665, 12037652560, 665, 1, 2, 0, 0, 12037652545, 665, 12037652559, 665, 2, 1, 0, 0, 12037652546, 665, 12037652558, 665, 1, 2, 0, 0, 12037652547, 665, 12037652557, 665, 2, 1, 0, 0, 12037652548, 665, 12037652556, 665, 1, 2, 0, 0, 12037652549, 665, 12037652555, 665, 2, 1, 0, 0, 12037652550, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652582, 665, 68, 0, 12037652630, 665, 0, 12037652538, 665, 12037652567, 665, 1, 12037652539, 665, 12037652566, 665, 2, 0, 1, 0, 12037652540, 665, 12037652565, 665, 1, 2, 0, 0, 12037652541, 665, 12037652564, 665, 2, 1, 0, 0, 12037652542, 665, 12037652563, 665, 1, 2, 0, 0, 12037652543, 665, 12037652562, 665, 2, 1, 0, 0, 12037652544, 665, 12037652561, 665, 1, 2, 0, 0, 12037652545, 665, 12037652560, 665, 2, 1, 0, 0, 12037652546, 665, 12037652559, 665, 1, 2, 0, 0, 12037652547, 665, 12037652558, 665, 2, 1, 0, 0, 12037652548, 665, 12037652557, 665, 1, 2, 0, 0, 12037652549, 665, 12037652556, 665, 2, 1, 0, 0, 12037652550, 665, 12037652555, 665, 1, 2, 0, 0, 12037652551, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652583, 665, 69, 0, 12037652631, 665, 0, 12037652538, 665, 12037652568, 665, 1, 12037652539, 665, 12037652567, 665, 2, 0, 1, 0, 12037652540, 665, 12037652566, 665, 1, 2, 0, 0, 12037652541, 665, 12037652565, 665, 2, 1, 0, 0, 12037652542, 665, 12037652564, 665, 1, 2, 0, 0, 12037652543, 665, 12037652563, 665, 2, 1, 0, 0, 12037652544, 665, 12037652562, 665, 1, 2, 0, 0, 12037652545, 665, 12037652561, 665, 2, 1, 0, 0, 12037652546, 665, 12037652560, 665, 1, 2, 0, 0, 12037652547, 665, 12037652559, 665, 2, 1, 0, 0, 12037652548, 665, 12037652558, 665, 1, 2, 0, 0, 12037652549, 665, 12037652557, 665, 2, 1, 0, 0, 12037652550, 665, 12037652556, 665, 1, 2, 0, 0, 12037652551, 665, 12037652555, 665, 2, 1, 0, 0, 12037652552, 665, 12037652554, 665, 1, 2, 0, 0, 1, 12037652584, 665, 70, 0, 12037652632, 665, 0, 12037652538, 665, 12037652569, 665, 1, 12037652539, 665, 12037652568, 665, 2, 0, 1, 0, 12037652540, 665, 12037652567, 665, 1, 2, 0, 0, 12037652541, 665, 12037652566, 665, 2, 1, 0, 0, 12037652542, 665, 12037652565, 665, 1, 2, 0, 0, 12037652543, 665, 12037652564, 665, 2, 1, 0, 0, 12037652544, 665, 12037652563, 665, 1, 2, 0, 0, 12037652545, 665, 12037652562, 665, 2, 1, 0, 0, 12037652546, 665, 12037652561, 665, 1, 2, 0, 0, 12037652547, 665, 12037652560, 665, 2, 1, 0, 0, 12037652548, 665, 12037652559, 665, 1, 2, 0, 0, 12037652549, 665, 12037652558, 665, 2, 1, 0, 0, 12037652550, 665, 12037652557, 665, 1, 2, 0, 0, 12037652551, 665, 12037652556, 665, 2, 1, 0, 0, 12037652552, 665, 12037652555, 665, 1, 2, 0, 0, 12037652553, 665, 12037652554, 665, 2, 1, 0, 0, 2, 12037652585, 665, 71, 0, 12037652633, 665, 0, 12037652539, 665, 12037652569, 665, 1, 12037652540, 665, 12037652568, 665, 2, 0, 1, 0, 12037652541, 665, 12037652567, 665, 1, 2, 0, 0, 12037652542, 665, 12037652566, 665, 2, 1, 0, 0, 12037652543, 665, 12037652565, 665, 1, 2, 0, 0, 12037652544, 665, 12037652564, 665, 2, 1, 0, 0, 12037652545, 665, 12037652563, 665, 1, 2, 0, 0, 12037652546, 665, 12037652562, 665, 2, 1, 0, 0, 12037652547, 665, 12037652561, 665, 1, 2, 0, 0, 12037652548, 665, 12037652560, 665, 2, 1, 0, 0, 12037652549, 665, 12037652559, 665, 1, 2, 0, 0, 12037652550, 665, 12037652558, 665, 2, 1, 0, 0, 12037652551, 665, 12037652557, 665, 1, 2, 0, 0, 12037652552, 665, 12037652556, 665, 2, 1, 0, 0, 12037652553, 665, 12037652555, 665, 1, 2, 0, 72, 1, 12037652586, 665, 0, 12037652540, 665, 12037652569, 665, 1, 12037652541, 665, 12037652568, 665, 2, 0, 1, 0, 12037652542, 665, 12037652567, 665, 1, 2, 0, 0, 12037652543, 665, 12037652566, 665, 2, 1, 0, 0, 12037652544, 665, 12037652565, 665, 1, 2, 0, 0, 12037652545, 665, 12037652564, 665, 2, 1, 0, 0, 12037652546, 665, 12037652563, 665, 1, 2, 0, 0, 12037652547, 665, 12037652562, 665, 2, 1, 0, 0, 12037652548, 665, 12037652561, 665, 1, 2, 0, 0, 12037652549, 665, 12037652560, 665, 2, 1, 0, 0, 12037652550, 665, 12037652559, 665, 1, 2, 0, 0, 12037652551, 665, 12037652558, 665, 2, 1, 0, 0, 12037652552, 665, 12037652557, 665, 1, 2, 0, 0, 12037652553, 665, 12037652556, 665, 2, 1, 0, 73, 2, 12037652587, 665, 0, 12037652541, 665, 12037652569, 665, 1, 12037652542, 665, 12037652568, 665, 2, 0, 1, 0, 12037652543, 665, 12037652567, 665, 1, 2, 0, 0, 12037652544, 665, 12037652566, 665, 2, 1, 0, 0, 12037652545, 665, 12037652565, 665, 1, 2, 0, 0, 12037652546, 665, 12037652564, 665, 2, 1, 0, 0, 12037652547, 665, 12037652563, 665, 1, 2, 0, 0, 12037652548, 665, 12037652562, 665, 2, 1, 0, 0, 12037652549, 665, 12037652561, 665, 1, 2, 0, 0, 12037652550, 665, 12037652560, 665, 2, 1, 0, 0, 12037652551, 665, 12037652559, 665, 1, 2, 0, 0, 12037652552, 665, 12037652558, 665, 2, 1, 0, 0, 12037652553, 665, 12037652557, 665, 1, 2, 0, 74, 1, 12037652588, 665, 0, 12037652542, 665, 12037652569, 665, 1, 12037652543, 665, 12037652568, 665, 2, 0, 1, 0, 12037652544, 665, 12037652567, 665, 1, 2, 0, 0, 12037652545, 665, 12037652566, 665, 2, 1, 0, 0, 12037652546, 665, 12037652565, 665, 1, 2, 0, 0, 12037652547, 665, 12037652564, 665, 2, 1, 0, 0, 12037652548, 665, 12037652563, 665, 1, 2, 0, 0, 12037652549, 665, 12037652562, 665, 2, 1, 0, 0, 12037652550, 665, 12037652561, 665, 1, 2, 0, 0, 12037652551, 665, 12037652560, 665, 2, 1, 0, 0, 12037652552, 665, 12037652559, 665, 1, 2, 0, 0, 12037652553, 665, 12037652558, 665, 2, 1, 0, 75, 2, 12037652589, 665, 0, 12037652543, 665, 12037652569, 665, 1, 12037652544, 665, 12037652568, 665, 2, 0, 1, 0, 12037652545, 665, 12037652567, 665, 1, 2, 0, 0, 12037652546, 665, 12037652566, 665, 2, 1, 0, 0, 12037652547, 665, 12037652565, 665, 1, 2, 0, 0, 12037652548, 665, 12037652564, 665, 2, 1, 0, 0, 12037652549, 665, 12037652563, 665, 1, 2, 0, 0, 12037652550, 665, 12037652562, 665, 2, 1, 0, 0, 12037652551, 665, 12037652561, 665, 1, 2, 0, 0, 12037652552, 665, 12037652560, 665, 2, 1, 0, 0, 12037652553, 665, 12037652559, 665, 1, 2, 0, 76, 1, 12037652590, 665, 0, 12037652544, 665, 12037652569, 665, 1, 12037652545, 665, 12037652568, 665, 2, 0, 1, 0, 12037652546, 665, 12037652567, 665, 1, 2, 0, 0, 12037652547, 665, 12037652566, 665, 2, 1, 0, 0, 12037652548, 665, 12037652565, 665, 1, 2, 0, 0, 12037652549, 665, 12037652564, 665, 2, 1, 0, 0, 12037652550, 665, 12037652563, 665, 1, 2, 0, 0, 12037652551, 665, 12037652562, 665, 2, 1, 0, 0, 12037652552, 665, 12037652561, 665, 1, 2, 0, 0, 12037652553, 665, 12037652560, 665, 2, 1, 0, 77, 2, 12037652591, 665, 0, 12037652545, 665, 12037652569, 665, 1, 12037652546, 665, 12037652568, 665, 2, 0, 1, 0, 12037652547, 665, 12037652567, 665, 1, 2, 0, 0, 12037652548, 665, 12037652566, 665, 2, 1, 0, 0, 12037652549, 665, 12037652565, 665, 1, 2, 0, 0, 12037652550, 665, 12037652564, 665, 2, 1, 0, 0, 12037652551, 665, 12037652563, 665, 1, 2, 0, 0, 12037652552, 665, 12037652562, 665, 2, 1, 0, 0, 12037652553, 665, 12037652561, 665, 1, 2, 0, 78, 1, 12037652592, 665, 0, 12037652546, 665, 12037652569, 665, 1, 12037652547, 665, 12037652568, 665, 2, 0, 1, 0, 12037652548, 665, 12037652567, 665, 1, 2, 0, 0, 12037652549, 665, 12037652566, 665, 2, 1, 0, 0, 12037652550, 665, 12037652565, 665, 1, 2, 0, 0, 12037652551, 665, 12037652564, 665, 2, 1, 0, 0, 12037652552, 665, 12037652563, 665, 1, 2, 0, 0, 12037652553, 665, 12037652562, 665, 2, 1, 0, 79, 2, 12037652593, 665, 0, 12037652547, 665, 12037652569, 665, 1, 12037652548, 665, 12037652568, 665, 2, 0, 1, 0, 12037652549, 665, 12037652567, 665, 1, 2, 0, 0, 12037652550, 665, 12037652566, 665, 2, 1, 0, 0, 12037652551, 665, 12037652565, 665, 1, 2, 0, 0, 12037652552, 665, 12037652564, 665, 2, 1, 0, 0, 12037652553, 665, 12037652563, 665, 1, 2, 0, 80, 1, 12037652594, 665, 0, 12037652548, 665, 12037652569, 665, 1, 12037652549, 665, 12037652568, 665, 2, 0, 1, 0, 12037652550, 665, 12037652567, 665, 1, 2, 0, 0, 12037652551, 665, 12037652566, 665, 2, 1, 0, 0, 12037652552, 665, 12037652565, 665, 1, 2, 0, 0, 12037652553, 665, 12037652564, 665, 2, 1, 0, 81, 2, 12037652595, 665, 0, 12037652549, 665, 12037652569, 665, 1, 12037652550, 665, 12037652568, 665, 2, 0, 1, 0, 12037652551, 665, 12037652567, 665, 1, 2, 0, 0, 12037652552, 665, 12037652566, 665, 2, 1, 0, 0, 12037652553, 665, 12037652565, 665, 1, 2, 0, 82, 1, 12037652596, 665, 0, 12037652550, 665, 12037652569, 665, 1, 12037652551, 665, 12037652568, 665, 2, 0, 1, 0, 12037652552, 665, 12037652567, 665, 1, 2, 0, 0, 12037652553, 665, 12037652566, 665, 2, 1, 0, 83, 2, 12037652597, 665, 0, 12037652551, 665, 12037652569, 665, 1, 12037652552, 665, 12037652568, 665, 2, 0, 1, 0, 12037652553, 665, 12037652567, 665, 1, 2, 0, 84, 1, 12037652598, 665, 0, 12037652552, 665, 12037652569, 665, 1, 12037652553, 665, 12037652568, 665, 2, 0, 1, 85, 2, 12037652599, 665, 0, 12037652553, 665, 12037652569, 665, 86, 0, 12037652600, 665, 87, 0ULL, 12037652601, 665, 0, 12037652634, 665, 12037652570, 665, 1, 12037652634, 665, 12037652538, 665, 2, 0, 1, 0, 64559ULL, 12037652650, 665, 1, 2, 0, 0, 1, 12037652586, 665, 88, 0, 12037652554, 665, 0, 12037652634, 665, 12037652571, 665, 1, 12037652634, 665, 12037652539, 665, 2, 0, 1, 0, 64559ULL, 12037652651, 665, 3, 2, 0, 0, 12037652635, 665, 12037652570, 665, 1, 12037652635, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652587, 665, 89, 1, 12037652555, 665, 0, 12037652634, 665, 12037652572, 665, 1, 12037652634, 665, 12037652540, 665, 2, 0, 1, 0, 64559ULL, 12037652652, 665, 3, 2, 0, 0, 12037652635, 665, 12037652571, 665, 1, 12037652635, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652570, 665, 1, 12037652636, 665, 12037652538, 665, 2, 0, 1, 0, 65534ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652588, 665, 90, 1, 12037652556, 665, 0, 12037652634, 665, 12037652573, 665, 1, 12037652634, 665, 12037652541, 665, 2, 0, 1, 0, 64559ULL, 12037652653, 665, 3, 2, 0, 0, 12037652635, 665, 12037652572, 665, 1, 12037652635, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652571, 665, 1, 12037652636, 665, 12037652539, 665, 2, 0, 1, 0, 65534ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652570, 665, 1, 12037652637, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652589, 665, 91, 1, 12037652557, 665, 0, 12037652634, 665, 12037652574, 665, 1, 12037652634, 665, 12037652542, 665, 2, 0, 1, 0, 64559ULL, 12037652654, 665, 3, 2, 0, 0, 12037652635, 665, 12037652573, 665, 1, 12037652635, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652572, 665, 1, 12037652636, 665, 12037652540, 665, 2, 0, 1, 0, 65534ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652571, 665, 1, 12037652637, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652570, 665, 1, 12037652638, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652590, 665, 92, 1, 12037652558, 665, 0, 12037652634, 665, 12037652575, 665, 1, 12037652634, 665, 12037652543, 665, 2, 0, 1, 0, 64559ULL, 12037652655, 665, 3, 2, 0, 0, 12037652635, 665, 12037652574, 665, 1, 12037652635, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652573, 665, 1, 12037652636, 665, 12037652541, 665, 2, 0, 1, 0, 65534ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652572, 665, 1, 12037652637, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652571, 665, 1, 12037652638, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652570, 665, 1, 12037652639, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652591, 665, 93, 1, 12037652559, 665, 0, 12037652634, 665, 12037652576, 665, 1, 12037652634, 665, 12037652544, 665, 2, 0, 1, 0, 64559ULL, 12037652656, 665, 3, 2, 0, 0, 12037652635, 665, 12037652575, 665, 1, 12037652635, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652574, 665, 1, 12037652636, 665, 12037652542, 665, 2, 0, 1, 0, 65534ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652573, 665, 1, 12037652637, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652572, 665, 1, 12037652638, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652571, 665, 1, 12037652639, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652570, 665, 1, 12037652640, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652592, 665, 94, 1, 12037652560, 665, 0, 12037652634, 665, 12037652577, 665, 1, 12037652634, 665, 12037652545, 665, 2, 0, 1, 0, 64559ULL, 12037652657, 665, 3, 2, 0, 0, 12037652635, 665, 12037652576, 665, 1, 12037652635, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652575, 665, 1, 12037652636, 665, 12037652543, 665, 2, 0, 1, 0, 65534ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652574, 665, 1, 12037652637, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652573, 665, 1, 12037652638, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652572, 665, 1, 12037652639, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652571, 665, 1, 12037652640, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652570, 665, 1, 12037652641, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652593, 665, 95, 1, 12037652561, 665, 0, 12037652634, 665, 12037652578, 665, 1, 12037652634, 665, 12037652546, 665, 2, 0, 1, 0, 64559ULL, 12037652658, 665, 3, 2, 0, 0, 12037652635, 665, 12037652577, 665, 1, 12037652635, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652576, 665, 1, 12037652636, 665, 12037652544, 665, 2, 0, 1, 0, 65534ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652575, 665, 1, 12037652637, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652574, 665, 1, 12037652638, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652573, 665, 1, 12037652639, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652572, 665, 1, 12037652640, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652571, 665, 1, 12037652641, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652570, 665, 1, 12037652642, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652594, 665, 96, 1, 12037652562, 665, 0, 12037652634, 665, 12037652579, 665, 1, 12037652634, 665, 12037652547, 665, 2, 0, 1, 0, 64559ULL, 12037652659, 665, 3, 2, 0, 0, 12037652635, 665, 12037652578, 665, 1, 12037652635, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652577, 665, 1, 12037652636, 665, 12037652545, 665, 2, 0, 1, 0, 65534ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652576, 665, 1, 12037652637, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652575, 665, 1, 12037652638, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652574, 665, 1, 12037652639, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652573, 665, 1, 12037652640, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652572, 665, 1, 12037652641, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652571, 665, 1, 12037652642, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652570, 665, 1, 12037652643, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652595, 665, 97, 1, 12037652563, 665, 0, 12037652634, 665, 12037652580, 665, 1, 12037652634, 665, 12037652548, 665, 2, 0, 1, 0, 64559ULL, 12037652660, 665, 3, 2, 0, 0, 12037652635, 665, 12037652579, 665, 1, 12037652635, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652578, 665, 1, 12037652636, 665, 12037652546, 665, 2, 0, 1, 0, 65534ULL, 12037652658, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652577, 665, 1, 12037652637, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652576, 665, 1, 12037652638, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652575, 665, 1, 12037652639, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652574, 665, 1, 12037652640, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652573, 665, 1, 12037652641, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652572, 665, 1, 12037652642, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652571, 665, 1, 12037652643, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652570, 665, 1, 12037652644, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652596, 665, 98, 1, 12037652564, 665, 0, 12037652634, 665, 12037652581, 665, 1, 12037652634, 665, 12037652549, 665, 2, 0, 1, 0, 64559ULL, 12037652661, 665, 3, 2, 0, 0, 12037652635, 665, 12037652580, 665, 1, 12037652635, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652579, 665, 1, 12037652636, 665, 12037652547, 665, 2, 0, 1, 0, 65534ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652578, 665, 1, 12037652637, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652577, 665, 1, 12037652638, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652576, 665, 1, 12037652639, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652575, 665, 1, 12037652640, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652574, 665, 1, 12037652641, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652573, 665, 1, 12037652642, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652572, 665, 1, 12037652643, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652571, 665, 1, 12037652644, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652570, 665, 1, 12037652645, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652597, 665, 99, 1, 12037652565, 665, 0, 12037652634, 665, 12037652582, 665, 1, 12037652634, 665, 12037652550, 665, 2, 0, 1, 0, 64559ULL, 12037652662, 665, 3, 2, 0, 0, 12037652635, 665, 12037652581, 665, 1, 12037652635, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652580, 665, 1, 12037652636, 665, 12037652548, 665, 2, 0, 1, 0, 65534ULL, 12037652660, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652579, 665, 1, 12037652637, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652578, 665, 1, 12037652638, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652577, 665, 1, 12037652639, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652576, 665, 1, 12037652640, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652575, 665, 1, 12037652641, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652574, 665, 1, 12037652642, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652573, 665, 1, 12037652643, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652572, 665, 1, 12037652644, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652571, 665, 1, 12037652645, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652570, 665, 1, 12037652646, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652598, 665, 100, 1, 12037652566, 665, 0, 12037652634, 665, 12037652583, 665, 1, 12037652634, 665, 12037652551, 665, 2, 0, 1, 0, 64559ULL, 12037652663, 665, 3, 2, 0, 0, 12037652635, 665, 12037652582, 665, 1, 12037652635, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652581, 665, 1, 12037652636, 665, 12037652549, 665, 2, 0, 1, 0, 65534ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652580, 665, 1, 12037652637, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652579, 665, 1, 12037652638, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652578, 665, 1, 12037652639, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652577, 665, 1, 12037652640, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652576, 665, 1, 12037652641, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652575, 665, 1, 12037652642, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652574, 665, 1, 12037652643, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652573, 665, 1, 12037652644, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652572, 665, 1, 12037652645, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652571, 665, 1, 12037652646, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652570, 665, 1, 12037652647, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652599, 665, 753, 1, 12037652567, 665, 0, 12037652634, 665, 12037652584, 665, 1, 12037652634, 665, 12037652552, 665, 2, 0, 1, 0, 64559ULL, 12037652664, 665, 3, 2, 0, 0, 12037652635, 665, 12037652583, 665, 1, 12037652635, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652582, 665, 1, 12037652636, 665, 12037652550, 665, 2, 0, 1, 0, 65534ULL, 12037652662, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652581, 665, 1, 12037652637, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652580, 665, 1, 12037652638, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652579, 665, 1, 12037652639, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652578, 665, 1, 12037652640, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652577, 665, 1, 12037652641, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652576, 665, 1, 12037652642, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652575, 665, 1, 12037652643, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652574, 665, 1, 12037652644, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652573, 665, 1, 12037652645, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652572, 665, 1, 12037652646, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652571, 665, 1, 12037652647, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652570, 665, 1, 12037652648, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652600, 665, 754, 1, 12037652568, 665, 0, 12037652634, 665, 12037652585, 665, 1, 12037652634, 665, 12037652553, 665, 2, 0, 1, 0, 64559ULL, 12037652665, 665, 3, 2, 0, 0, 12037652635, 665, 12037652584, 665, 1, 12037652635, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652583, 665, 1, 12037652636, 665, 12037652551, 665, 2, 0, 1, 0, 65534ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652582, 665, 1, 12037652637, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652581, 665, 1, 12037652638, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652580, 665, 1, 12037652639, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652579, 665, 1, 12037652640, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652578, 665, 1, 12037652641, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652577, 665, 1, 12037652642, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652576, 665, 1, 12037652643, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652575, 665, 1, 12037652644, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652574, 665, 1, 12037652645, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652573, 665, 1, 12037652646, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652572, 665, 1, 12037652647, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652571, 665, 1, 12037652648, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652570, 665, 1, 12037652649, 665, 12037652538, 665, 2, 0, 1, 0, 65535ULL, 12037652650, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652601, 665, 755, 1, 12037652569, 665, 0, 12037652635, 665, 12037652585, 665, 1, 12037652635, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652636, 665, 12037652584, 665, 1, 12037652636, 665, 12037652552, 665, 2, 0, 1, 0, 65534ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652637, 665, 12037652583, 665, 1, 12037652637, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652638, 665, 12037652582, 665, 1, 12037652638, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652581, 665, 1, 12037652639, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652580, 665, 1, 12037652640, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652579, 665, 1, 12037652641, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652578, 665, 1, 12037652642, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652577, 665, 1, 12037652643, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652576, 665, 1, 12037652644, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652575, 665, 1, 12037652645, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652574, 665, 1, 12037652646, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652573, 665, 1, 12037652647, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652572, 665, 1, 12037652648, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652571, 665, 1, 12037652649, 665, 12037652539, 665, 2, 0, 1, 0, 65535ULL, 12037652651, 665, 1, 2, 0, 0, 4, 1, 756, 0, 258236ULL, 0, 12037652636, 665, 12037652585, 665, 1, 12037652636, 665, 12037652553, 665, 2, 0, 1, 0, 65534ULL, 12037652665, 665, 3, 2, 0, 0, 12037652637, 665, 12037652584, 665, 1, 12037652637, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652583, 665, 1, 12037652638, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652582, 665, 1, 12037652639, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652581, 665, 1, 12037652640, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652580, 665, 1, 12037652641, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652579, 665, 1, 12037652642, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652578, 665, 1, 12037652643, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652577, 665, 1, 12037652644, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652576, 665, 1, 12037652645, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652575, 665, 1, 12037652646, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652574, 665, 1, 12037652647, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652573, 665, 1, 12037652648, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652572, 665, 1, 12037652649, 665, 12037652540, 665, 2, 0, 1, 0, 65535ULL, 12037652652, 665, 1, 2, 0, 0, 3, 1, 757, 0, 262140ULL, 0, 12037652637, 665, 12037652585, 665, 1, 12037652637, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652638, 665, 12037652584, 665, 1, 12037652638, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652583, 665, 1, 12037652639, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652582, 665, 1, 12037652640, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652581, 665, 1, 12037652641, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652580, 665, 1, 12037652642, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652579, 665, 1, 12037652643, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652578, 665, 1, 12037652644, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652577, 665, 1, 12037652645, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652576, 665, 1, 12037652646, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652575, 665, 1, 12037652647, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652574, 665, 1, 12037652648, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652573, 665, 1, 12037652649, 665, 12037652541, 665, 2, 0, 1, 0, 65535ULL, 12037652653, 665, 1, 2, 0, 0, 4, 1, 758, 0, 262136ULL, 0, 12037652638, 665, 12037652585, 665, 1, 12037652638, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652639, 665, 12037652584, 665, 1, 12037652639, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652583, 665, 1, 12037652640, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652582, 665, 1, 12037652641, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652581, 665, 1, 12037652642, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652580, 665, 1, 12037652643, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652579, 665, 1, 12037652644, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652578, 665, 1, 12037652645, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652577, 665, 1, 12037652646, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652576, 665, 1, 12037652647, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652575, 665, 1, 12037652648, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652574, 665, 1, 12037652649, 665, 12037652542, 665, 2, 0, 1, 0, 65535ULL, 12037652654, 665, 1, 2, 0, 0, 3, 1, 759, 0, 262140ULL, 0, 12037652639, 665, 12037652585, 665, 1, 12037652639, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652640, 665, 12037652584, 665, 1, 12037652640, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652583, 665, 1, 12037652641, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652582, 665, 1, 12037652642, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652581, 665, 1, 12037652643, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652580, 665, 1, 12037652644, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652579, 665, 1, 12037652645, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652578, 665, 1, 12037652646, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652577, 665, 1, 12037652647, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652576, 665, 1, 12037652648, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652575, 665, 1, 12037652649, 665, 12037652543, 665, 2, 0, 1, 0, 65535ULL, 12037652655, 665, 1, 2, 0, 0, 4, 1, 760, 0, 262140ULL, 0, 12037652640, 665, 12037652585, 665, 1, 12037652640, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652641, 665, 12037652584, 665, 1, 12037652641, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652583, 665, 1, 12037652642, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652582, 665, 1, 12037652643, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652581, 665, 1, 12037652644, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652580, 665, 1, 12037652645, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652579, 665, 1, 12037652646, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652578, 665, 1, 12037652647, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652577, 665, 1, 12037652648, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652576, 665, 1, 12037652649, 665, 12037652544, 665, 2, 0, 1, 0, 65535ULL, 12037652656, 665, 1, 2, 0, 0, 3, 1, 761, 0, 262140ULL, 0, 12037652641, 665, 12037652585, 665, 1, 12037652641, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652642, 665, 12037652584, 665, 1, 12037652642, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652583, 665, 1, 12037652643, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652582, 665, 1, 12037652644, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652581, 665, 1, 12037652645, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652580, 665, 1, 12037652646, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652579, 665, 1, 12037652647, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652578, 665, 1, 12037652648, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652577, 665, 1, 12037652649, 665, 12037652545, 665, 2, 0, 1, 0, 65535ULL, 12037652657, 665, 1, 2, 0, 0, 4, 1, 762, 0, 262140ULL, 0, 12037652642, 665, 12037652585, 665, 1, 12037652642, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652643, 665, 12037652584, 665, 1, 12037652643, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652583, 665, 1, 12037652644, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652582, 665, 1, 12037652645, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652581, 665, 1, 12037652646, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652580, 665, 1, 12037652647, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652579, 665, 1, 12037652648, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652578, 665, 1, 12037652649, 665, 12037652546, 665, 2, 0, 1, 0, 65535ULL, 12037652658, 665, 1, 2, 0, 0, 3, 1, 763, 0, 262140ULL, 0, 12037652643, 665, 12037652585, 665, 1, 12037652643, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652644, 665, 12037652584, 665, 1, 12037652644, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652583, 665, 1, 12037652645, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652582, 665, 1, 12037652646, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652581, 665, 1, 12037652647, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652580, 665, 1, 12037652648, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652579, 665, 1, 12037652649, 665, 12037652547, 665, 2, 0, 1, 0, 65535ULL, 12037652659, 665, 1, 2, 0, 0, 4, 1, 764, 0, 262140ULL, 0, 12037652644, 665, 12037652585, 665, 1, 12037652644, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652645, 665, 12037652584, 665, 1, 12037652645, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652583, 665, 1, 12037652646, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652582, 665, 1, 12037652647, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652581, 665, 1, 12037652648, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652580, 665, 1, 12037652649, 665, 12037652548, 665, 2, 0, 1, 0, 65535ULL, 12037652660, 665, 1, 2, 0, 0, 3, 1, 765, 0, 262140ULL, 0, 12037652645, 665, 12037652585, 665, 1, 12037652645, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652646, 665, 12037652584, 665, 1, 12037652646, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652583, 665, 1, 12037652647, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652582, 665, 1, 12037652648, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652581, 665, 1, 12037652649, 665, 12037652549, 665, 2, 0, 1, 0, 65535ULL, 12037652661, 665, 1, 2, 0, 0, 4, 1, 766, 0, 262140ULL, 0, 12037652646, 665, 12037652585, 665, 1, 12037652646, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652647, 665, 12037652584, 665, 1, 12037652647, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652583, 665, 1, 12037652648, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652582, 665, 1, 12037652649, 665, 12037652550, 665, 2, 0, 1, 0, 65535ULL, 12037652662, 665, 1, 2, 0, 0, 3, 1, 767, 0, 262140ULL, 0, 12037652647, 665, 12037652585, 665, 1, 12037652647, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652648, 665, 12037652584, 665, 1, 12037652648, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652583, 665, 1, 12037652649, 665, 12037652551, 665, 2, 0, 1, 0, 65535ULL, 12037652663, 665, 1, 2, 0, 0, 4, 1, 768, 0, 262140ULL, 0, 12037652648, 665, 12037652585, 665, 1, 12037652648, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 3, 2, 0, 0, 12037652649, 665, 12037652584, 665, 1, 12037652649, 665, 12037652552, 665, 2, 0, 1, 0, 65535ULL, 12037652664, 665, 1, 2, 0, 0, 3, 1, 769, 0, 262140ULL, 0, 12037652649, 665, 12037652585, 665, 1, 12037652649, 665, 12037652553, 665, 2, 0, 1, 0, 65535ULL, 12037652665, 665, 1, 2, 0, 770, 1, 262140ULL, 771, 18446744069414322181ULL, 0, 12037652634, 665, 12037652554, 665, 1, 12037652634, 665, 12037652554, 665, 2, 0, 1, 0, 12037652538, 665, 12037652538, 665, 1, 2, 0, 0, 12037652538, 665, 12037652538, 665, 2, 1, 0, 0, 12037652538, 665, 12037652538, 665, 1, 2, 0, 0, 64559ULL, 12037652650, 665, 772, 1, 0, 0, 12037652634, 665, 12037652555, 665, 1, 12037652634, 665, 12037652555, 665, 2, 0, 1, 0, 12037652538, 665, 12037652539, 665, 1, 2, 0, 0, 12037652538, 665, 12037652539, 665, 2, 1, 0, 0, 12037652538, 665, 12037652539, 665, 1, 2, 0, 0, 64559ULL, 12037652651, 665, 3, 1, 0, 0, 12037652635, 665, 12037652554, 665, 1, 12037652635, 665, 12037652554, 665, 2, 0, 1, 0, 12037652539, 665, 12037652538, 665, 1, 2, 0, 0, 12037652539, 665, 12037652538, 665, 2, 1, 0, 0, 12037652539, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 773, 3, 2, 0, 12037652634, 665, 12037652556, 665, 1, 12037652634, 665, 12037652556, 665, 2, 0, 1, 0, 12037652538, 665, 12037652540, 665, 1, 2, 0, 0, 12037652538, 665, 12037652540, 665, 2, 1, 0, 0, 12037652538, 665, 12037652540, 665, 1, 2, 0, 0, 64559ULL, 12037652652, 665, 3, 1, 0, 0, 12037652635, 665, 12037652555, 665, 1, 12037652635, 665, 12037652555, 665, 2, 0, 1, 0, 12037652539, 665, 12037652539, 665, 1, 2, 0, 0, 12037652539, 665, 12037652539, 665, 2, 1, 0, 0, 12037652539, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652554, 665, 1, 12037652636, 665, 12037652554, 665, 2, 0, 1, 0, 12037652540, 665, 12037652538, 665, 1, 2, 0, 0, 12037652540, 665, 12037652538, 665, 2, 1, 0, 0, 12037652540, 665, 12037652538, 665, 1, 2, 0, 0, 65534ULL, 12037652650, 665, 2, 1, 0, 774, 4, 2, 0, 12037652634, 665, 12037652557, 665, 1, 12037652634, 665, 12037652557, 665, 2, 0, 1, 0, 12037652538, 665, 12037652541, 665, 1, 2, 0, 0, 12037652538, 665, 12037652541, 665, 2, 1, 0, 0, 12037652538, 665, 12037652541, 665, 1, 2, 0, 0, 64559ULL, 12037652653, 665, 3, 1, 0, 0, 12037652635, 665, 12037652556, 665, 1, 12037652635, 665, 12037652556, 665, 2, 0, 1, 0, 12037652539, 665, 12037652540, 665, 1, 2, 0, 0, 12037652539, 665, 12037652540, 665, 2, 1, 0, 0, 12037652539, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652555, 665, 1, 12037652636, 665, 12037652555, 665, 2, 0, 1, 0, 12037652540, 665, 12037652539, 665, 1, 2, 0, 0, 12037652540, 665, 12037652539, 665, 2, 1, 0, 0, 12037652540, 665, 12037652539, 665, 1, 2, 0, 0, 65534ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652554, 665, 1, 12037652637, 665, 12037652554, 665, 2, 0, 1, 0, 12037652541, 665, 12037652538, 665, 1, 2, 0, 0, 12037652541, 665, 12037652538, 665, 2, 1, 0, 0, 12037652541, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 775, 3, 2, 0, 12037652634, 665, 12037652558, 665, 1, 12037652634, 665, 12037652558, 665, 2, 0, 1, 0, 12037652538, 665, 12037652542, 665, 1, 2, 0, 0, 12037652538, 665, 12037652542, 665, 2, 1, 0, 0, 12037652538, 665, 12037652542, 665, 1, 2, 0, 0, 64559ULL, 12037652654, 665, 3, 1, 0, 0, 12037652635, 665, 12037652557, 665, 1, 12037652635, 665, 12037652557, 665, 2, 0, 1, 0, 12037652539, 665, 12037652541, 665, 1, 2, 0, 0, 12037652539, 665, 12037652541, 665, 2, 1, 0, 0, 12037652539, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652556, 665, 1, 12037652636, 665, 12037652556, 665, 2, 0, 1, 0, 12037652540, 665, 12037652540, 665, 1, 2, 0, 0, 12037652540, 665, 12037652540, 665, 2, 1, 0, 0, 12037652540, 665, 12037652540, 665, 1, 2, 0, 0, 65534ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652555, 665, 1, 12037652637, 665, 12037652555, 665, 2, 0, 1, 0, 12037652541, 665, 12037652539, 665, 1, 2, 0, 0, 12037652541, 665, 12037652539, 665, 2, 1, 0, 0, 12037652541, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652554, 665, 1, 12037652638, 665, 12037652554, 665, 2, 0, 1, 0, 12037652542, 665, 12037652538, 665, 1, 2, 0, 0, 12037652542, 665, 12037652538, 665, 2, 1, 0, 0, 12037652542, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 776, 4, 2, 0, 12037652634, 665, 12037652559, 665, 1, 12037652634, 665, 12037652559, 665, 2, 0, 1, 0, 12037652538, 665, 12037652543, 665, 1, 2, 0, 0, 12037652538, 665, 12037652543, 665, 2, 1, 0, 0, 12037652538, 665, 12037652543, 665, 1, 2, 0, 0, 64559ULL, 12037652655, 665, 3, 1, 0, 0, 12037652635, 665, 12037652558, 665, 1, 12037652635, 665, 12037652558, 665, 2, 0, 1, 0, 12037652539, 665, 12037652542, 665, 1, 2, 0, 0, 12037652539, 665, 12037652542, 665, 2, 1, 0, 0, 12037652539, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652557, 665, 1, 12037652636, 665, 12037652557, 665, 2, 0, 1, 0, 12037652540, 665, 12037652541, 665, 1, 2, 0, 0, 12037652540, 665, 12037652541, 665, 2, 1, 0, 0, 12037652540, 665, 12037652541, 665, 1, 2, 0, 0, 65534ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652556, 665, 1, 12037652637, 665, 12037652556, 665, 2, 0, 1, 0, 12037652541, 665, 12037652540, 665, 1, 2, 0, 0, 12037652541, 665, 12037652540, 665, 2, 1, 0, 0, 12037652541, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652555, 665, 1, 12037652638, 665, 12037652555, 665, 2, 0, 1, 0, 12037652542, 665, 12037652539, 665, 1, 2, 0, 0, 12037652542, 665, 12037652539, 665, 2, 1, 0, 0, 12037652542, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652554, 665, 1, 12037652639, 665, 12037652554, 665, 2, 0, 1, 0, 12037652543, 665, 12037652538, 665, 1, 2, 0, 0, 12037652543, 665, 12037652538, 665, 2, 1, 0, 0, 12037652543, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 777, 3, 2, 0, 12037652634, 665, 12037652560, 665, 1, 12037652634, 665, 12037652560, 665, 2, 0, 1, 0, 12037652538, 665, 12037652544, 665, 1, 2, 0, 0, 12037652538, 665, 12037652544, 665, 2, 1, 0, 0, 12037652538, 665, 12037652544, 665, 1, 2, 0, 0, 64559ULL, 12037652656, 665, 3, 1, 0, 0, 12037652635, 665, 12037652559, 665, 1, 12037652635, 665, 12037652559, 665, 2, 0, 1, 0, 12037652539, 665, 12037652543, 665, 1, 2, 0, 0, 12037652539, 665, 12037652543, 665, 2, 1, 0, 0, 12037652539, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652558, 665, 1, 12037652636, 665, 12037652558, 665, 2, 0, 1, 0, 12037652540, 665, 12037652542, 665, 1, 2, 0, 0, 12037652540, 665, 12037652542, 665, 2, 1, 0, 0, 12037652540, 665, 12037652542, 665, 1, 2, 0, 0, 65534ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652557, 665, 1, 12037652637, 665, 12037652557, 665, 2, 0, 1, 0, 12037652541, 665, 12037652541, 665, 1, 2, 0, 0, 12037652541, 665, 12037652541, 665, 2, 1, 0, 0, 12037652541, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652556, 665, 1, 12037652638, 665, 12037652556, 665, 2, 0, 1, 0, 12037652542, 665, 12037652540, 665, 1, 2, 0, 0, 12037652542, 665, 12037652540, 665, 2, 1, 0, 0, 12037652542, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652555, 665, 1, 12037652639, 665, 12037652555, 665, 2, 0, 1, 0, 12037652543, 665, 12037652539, 665, 1, 2, 0, 0, 12037652543, 665, 12037652539, 665, 2, 1, 0, 0, 12037652543, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652554, 665, 1, 12037652640, 665, 12037652554, 665, 2, 0, 1, 0, 12037652544, 665, 12037652538, 665, 1, 2, 0, 0, 12037652544, 665, 12037652538, 665, 2, 1, 0, 0, 12037652544, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 778, 4, 2, 0, 12037652634, 665, 12037652561, 665, 1, 12037652634, 665, 12037652561, 665, 2, 0, 1, 0, 12037652538, 665, 12037652545, 665, 1, 2, 0, 0, 12037652538, 665, 12037652545, 665, 2, 1, 0, 0, 12037652538, 665, 12037652545, 665, 1, 2, 0, 0, 64559ULL, 12037652657, 665, 3, 1, 0, 0, 12037652635, 665, 12037652560, 665, 1, 12037652635, 665, 12037652560, 665, 2, 0, 1, 0, 12037652539, 665, 12037652544, 665, 1, 2, 0, 0, 12037652539, 665, 12037652544, 665, 2, 1, 0, 0, 12037652539, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652559, 665, 1, 12037652636, 665, 12037652559, 665, 2, 0, 1, 0, 12037652540, 665, 12037652543, 665, 1, 2, 0, 0, 12037652540, 665, 12037652543, 665, 2, 1, 0, 0, 12037652540, 665, 12037652543, 665, 1, 2, 0, 0, 65534ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652558, 665, 1, 12037652637, 665, 12037652558, 665, 2, 0, 1, 0, 12037652541, 665, 12037652542, 665, 1, 2, 0, 0, 12037652541, 665, 12037652542, 665, 2, 1, 0, 0, 12037652541, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652557, 665, 1, 12037652638, 665, 12037652557, 665, 2, 0, 1, 0, 12037652542, 665, 12037652541, 665, 1, 2, 0, 0, 12037652542, 665, 12037652541, 665, 2, 1, 0, 0, 12037652542, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652556, 665, 1, 12037652639, 665, 12037652556, 665, 2, 0, 1, 0, 12037652543, 665, 12037652540, 665, 1, 2, 0, 0, 12037652543, 665, 12037652540, 665, 2, 1, 0, 0, 12037652543, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652555, 665, 1, 12037652640, 665, 12037652555, 665, 2, 0, 1, 0, 12037652544, 665, 12037652539, 665, 1, 2, 0, 0, 12037652544, 665, 12037652539, 665, 2, 1, 0, 0, 12037652544, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652554, 665, 1, 12037652641, 665, 12037652554, 665, 2, 0, 1, 0, 12037652545, 665, 12037652538, 665, 1, 2, 0, 0, 12037652545, 665, 12037652538, 665, 2, 1, 0, 0, 12037652545, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 779, 3, 2, 0, 12037652634, 665, 12037652562, 665, 1, 12037652634, 665, 12037652562, 665, 2, 0, 1, 0, 12037652538, 665, 12037652546, 665, 1, 2, 0, 0, 12037652538, 665, 12037652546, 665, 2, 1, 0, 0, 12037652538, 665, 12037652546, 665, 1, 2, 0, 0, 64559ULL, 12037652658, 665, 3, 1, 0, 0, 12037652635, 665, 12037652561, 665, 1, 12037652635, 665, 12037652561, 665, 2, 0, 1, 0, 12037652539, 665, 12037652545, 665, 1, 2, 0, 0, 12037652539, 665, 12037652545, 665, 2, 1, 0, 0, 12037652539, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652560, 665, 1, 12037652636, 665, 12037652560, 665, 2, 0, 1, 0, 12037652540, 665, 12037652544, 665, 1, 2, 0, 0, 12037652540, 665, 12037652544, 665, 2, 1, 0, 0, 12037652540, 665, 12037652544, 665, 1, 2, 0, 0, 65534ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652559, 665, 1, 12037652637, 665, 12037652559, 665, 2, 0, 1, 0, 12037652541, 665, 12037652543, 665, 1, 2, 0, 0, 12037652541, 665, 12037652543, 665, 2, 1, 0, 0, 12037652541, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652558, 665, 1, 12037652638, 665, 12037652558, 665, 2, 0, 1, 0, 12037652542, 665, 12037652542, 665, 1, 2, 0, 0, 12037652542, 665, 12037652542, 665, 2, 1, 0, 0, 12037652542, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652557, 665, 1, 12037652639, 665, 12037652557, 665, 2, 0, 1, 0, 12037652543, 665, 12037652541, 665, 1, 2, 0, 0, 12037652543, 665, 12037652541, 665, 2, 1, 0, 0, 12037652543, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652556, 665, 1, 12037652640, 665, 12037652556, 665, 2, 0, 1, 0, 12037652544, 665, 12037652540, 665, 1, 2, 0, 0, 12037652544, 665, 12037652540, 665, 2, 1, 0, 0, 12037652544, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652555, 665, 1, 12037652641, 665, 12037652555, 665, 2, 0, 1, 0, 12037652545, 665, 12037652539, 665, 1, 2, 0, 0, 12037652545, 665, 12037652539, 665, 2, 1, 0, 0, 12037652545, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652554, 665, 1, 12037652642, 665, 12037652554, 665, 2, 0, 1, 0, 12037652546, 665, 12037652538, 665, 1, 2, 0, 0, 12037652546, 665, 12037652538, 665, 2, 1, 0, 0, 12037652546, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 780, 4, 2, 0, 12037652634, 665, 12037652563, 665, 1, 12037652634, 665, 12037652563, 665, 2, 0, 1, 0, 12037652538, 665, 12037652547, 665, 1, 2, 0, 0, 12037652538, 665, 12037652547, 665, 2, 1, 0, 0, 12037652538, 665, 12037652547, 665, 1, 2, 0, 0, 64559ULL, 12037652659, 665, 3, 1, 0, 0, 12037652635, 665, 12037652562, 665, 1, 12037652635, 665, 12037652562, 665, 2, 0, 1, 0, 12037652539, 665, 12037652546, 665, 1, 2, 0, 0, 12037652539, 665, 12037652546, 665, 2, 1, 0, 0, 12037652539, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652561, 665, 1, 12037652636, 665, 12037652561, 665, 2, 0, 1, 0, 12037652540, 665, 12037652545, 665, 1, 2, 0, 0, 12037652540, 665, 12037652545, 665, 2, 1, 0, 0, 12037652540, 665, 12037652545, 665, 1, 2, 0, 0, 65534ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652560, 665, 1, 12037652637, 665, 12037652560, 665, 2, 0, 1, 0, 12037652541, 665, 12037652544, 665, 1, 2, 0, 0, 12037652541, 665, 12037652544, 665, 2, 1, 0, 0, 12037652541, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652559, 665, 1, 12037652638, 665, 12037652559, 665, 2, 0, 1, 0, 12037652542, 665, 12037652543, 665, 1, 2, 0, 0, 12037652542, 665, 12037652543, 665, 2, 1, 0, 0, 12037652542, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652558, 665, 1, 12037652639, 665, 12037652558, 665, 2, 0, 1, 0, 12037652543, 665, 12037652542, 665, 1, 2, 0, 0, 12037652543, 665, 12037652542, 665, 2, 1, 0, 0, 12037652543, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652557, 665, 1, 12037652640, 665, 12037652557, 665, 2, 0, 1, 0, 12037652544, 665, 12037652541, 665, 1, 2, 0, 0, 12037652544, 665, 12037652541, 665, 2, 1, 0, 0, 12037652544, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652556, 665, 1, 12037652641, 665, 12037652556, 665, 2, 0, 1, 0, 12037652545, 665, 12037652540, 665, 1, 2, 0, 0, 12037652545, 665, 12037652540, 665, 2, 1, 0, 0, 12037652545, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652555, 665, 1, 12037652642, 665, 12037652555, 665, 2, 0, 1, 0, 12037652546, 665, 12037652539, 665, 1, 2, 0, 0, 12037652546, 665, 12037652539, 665, 2, 1, 0, 0, 12037652546, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652554, 665, 1, 12037652643, 665, 12037652554, 665, 2, 0, 1, 0, 12037652547, 665, 12037652538, 665, 1, 2, 0, 0, 12037652547, 665, 12037652538, 665, 2, 1, 0, 0, 12037652547, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 781, 3, 2, 0, 12037652634, 665, 12037652564, 665, 1, 12037652634, 665, 12037652564, 665, 2, 0, 1, 0, 12037652538, 665, 12037652548, 665, 1, 2, 0, 0, 12037652538, 665, 12037652548, 665, 2, 1, 0, 0, 12037652538, 665, 12037652548, 665, 1, 2, 0, 0, 64559ULL, 12037652660, 665, 3, 1, 0, 0, 12037652635, 665, 12037652563, 665, 1, 12037652635, 665, 12037652563, 665, 2, 0, 1, 0, 12037652539, 665, 12037652547, 665, 1, 2, 0, 0, 12037652539, 665, 12037652547, 665, 2, 1, 0, 0, 12037652539, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652562, 665, 1, 12037652636, 665, 12037652562, 665, 2, 0, 1, 0, 12037652540, 665, 12037652546, 665, 1, 2, 0, 0, 12037652540, 665, 12037652546, 665, 2, 1, 0, 0, 12037652540, 665, 12037652546, 665, 1, 2, 0, 0, 65534ULL, 12037652658, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652561, 665, 1, 12037652637, 665, 12037652561, 665, 2, 0, 1, 0, 12037652541, 665, 12037652545, 665, 1, 2, 0, 0, 12037652541, 665, 12037652545, 665, 2, 1, 0, 0, 12037652541, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652560, 665, 1, 12037652638, 665, 12037652560, 665, 2, 0, 1, 0, 12037652542, 665, 12037652544, 665, 1, 2, 0, 0, 12037652542, 665, 12037652544, 665, 2, 1, 0, 0, 12037652542, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652559, 665, 1, 12037652639, 665, 12037652559, 665, 2, 0, 1, 0, 12037652543, 665, 12037652543, 665, 1, 2, 0, 0, 12037652543, 665, 12037652543, 665, 2, 1, 0, 0, 12037652543, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652558, 665, 1, 12037652640, 665, 12037652558, 665, 2, 0, 1, 0, 12037652544, 665, 12037652542, 665, 1, 2, 0, 0, 12037652544, 665, 12037652542, 665, 2, 1, 0, 0, 12037652544, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652557, 665, 1, 12037652641, 665, 12037652557, 665, 2, 0, 1, 0, 12037652545, 665, 12037652541, 665, 1, 2, 0, 0, 12037652545, 665, 12037652541, 665, 2, 1, 0, 0, 12037652545, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652556, 665, 1, 12037652642, 665, 12037652556, 665, 2, 0, 1, 0, 12037652546, 665, 12037652540, 665, 1, 2, 0, 0, 12037652546, 665, 12037652540, 665, 2, 1, 0, 0, 12037652546, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652555, 665, 1, 12037652643, 665, 12037652555, 665, 2, 0, 1, 0, 12037652547, 665, 12037652539, 665, 1, 2, 0, 0, 12037652547, 665, 12037652539, 665, 2, 1, 0, 0, 12037652547, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652554, 665, 1, 12037652644, 665, 12037652554, 665, 2, 0, 1, 0, 12037652548, 665, 12037652538, 665, 1, 2, 0, 0, 12037652548, 665, 12037652538, 665, 2, 1, 0, 0, 12037652548, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 782, 4, 2, 0, 12037652634, 665, 12037652565, 665, 1, 12037652634, 665, 12037652565, 665, 2, 0, 1, 0, 12037652538, 665, 12037652549, 665, 1, 2, 0, 0, 12037652538, 665, 12037652549, 665, 2, 1, 0, 0, 12037652538, 665, 12037652549, 665, 1, 2, 0, 0, 64559ULL, 12037652661, 665, 3, 1, 0, 0, 12037652635, 665, 12037652564, 665, 1, 12037652635, 665, 12037652564, 665, 2, 0, 1, 0, 12037652539, 665, 12037652548, 665, 1, 2, 0, 0, 12037652539, 665, 12037652548, 665, 2, 1, 0, 0, 12037652539, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652563, 665, 1, 12037652636, 665, 12037652563, 665, 2, 0, 1, 0, 12037652540, 665, 12037652547, 665, 1, 2, 0, 0, 12037652540, 665, 12037652547, 665, 2, 1, 0, 0, 12037652540, 665, 12037652547, 665, 1, 2, 0, 0, 65534ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652562, 665, 1, 12037652637, 665, 12037652562, 665, 2, 0, 1, 0, 12037652541, 665, 12037652546, 665, 1, 2, 0, 0, 12037652541, 665, 12037652546, 665, 2, 1, 0, 0, 12037652541, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652561, 665, 1, 12037652638, 665, 12037652561, 665, 2, 0, 1, 0, 12037652542, 665, 12037652545, 665, 1, 2, 0, 0, 12037652542, 665, 12037652545, 665, 2, 1, 0, 0, 12037652542, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652560, 665, 1, 12037652639, 665, 12037652560, 665, 2, 0, 1, 0, 12037652543, 665, 12037652544, 665, 1, 2, 0, 0, 12037652543, 665, 12037652544, 665, 2, 1, 0, 0, 12037652543, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652559, 665, 1, 12037652640, 665, 12037652559, 665, 2, 0, 1, 0, 12037652544, 665, 12037652543, 665, 1, 2, 0, 0, 12037652544, 665, 12037652543, 665, 2, 1, 0, 0, 12037652544, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652558, 665, 1, 12037652641, 665, 12037652558, 665, 2, 0, 1, 0, 12037652545, 665, 12037652542, 665, 1, 2, 0, 0, 12037652545, 665, 12037652542, 665, 2, 1, 0, 0, 12037652545, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652557, 665, 1, 12037652642, 665, 12037652557, 665, 2, 0, 1, 0, 12037652546, 665, 12037652541, 665, 1, 2, 0, 0, 12037652546, 665, 12037652541, 665, 2, 1, 0, 0, 12037652546, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652556, 665, 1, 12037652643, 665, 12037652556, 665, 2, 0, 1, 0, 12037652547, 665, 12037652540, 665, 1, 2, 0, 0, 12037652547, 665, 12037652540, 665, 2, 1, 0, 0, 12037652547, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652555, 665, 1, 12037652644, 665, 12037652555, 665, 2, 0, 1, 0, 12037652548, 665, 12037652539, 665, 1, 2, 0, 0, 12037652548, 665, 12037652539, 665, 2, 1, 0, 0, 12037652548, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652554, 665, 1, 12037652645, 665, 12037652554, 665, 2, 0, 1, 0, 12037652549, 665, 12037652538, 665, 1, 2, 0, 0, 12037652549, 665, 12037652538, 665, 2, 1, 0, 0, 12037652549, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 783, 3, 2, 0, 12037652634, 665, 12037652566, 665, 1, 12037652634, 665, 12037652566, 665, 2, 0, 1, 0, 12037652538, 665, 12037652550, 665, 1, 2, 0, 0, 12037652538, 665, 12037652550, 665, 2, 1, 0, 0, 12037652538, 665, 12037652550, 665, 1, 2, 0, 0, 64559ULL, 12037652662, 665, 3, 1, 0, 0, 12037652635, 665, 12037652565, 665, 1, 12037652635, 665, 12037652565, 665, 2, 0, 1, 0, 12037652539, 665, 12037652549, 665, 1, 2, 0, 0, 12037652539, 665, 12037652549, 665, 2, 1, 0, 0, 12037652539, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652564, 665, 1, 12037652636, 665, 12037652564, 665, 2, 0, 1, 0, 12037652540, 665, 12037652548, 665, 1, 2, 0, 0, 12037652540, 665, 12037652548, 665, 2, 1, 0, 0, 12037652540, 665, 12037652548, 665, 1, 2, 0, 0, 65534ULL, 12037652660, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652563, 665, 1, 12037652637, 665, 12037652563, 665, 2, 0, 1, 0, 12037652541, 665, 12037652547, 665, 1, 2, 0, 0, 12037652541, 665, 12037652547, 665, 2, 1, 0, 0, 12037652541, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652562, 665, 1, 12037652638, 665, 12037652562, 665, 2, 0, 1, 0, 12037652542, 665, 12037652546, 665, 1, 2, 0, 0, 12037652542, 665, 12037652546, 665, 2, 1, 0, 0, 12037652542, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652561, 665, 1, 12037652639, 665, 12037652561, 665, 2, 0, 1, 0, 12037652543, 665, 12037652545, 665, 1, 2, 0, 0, 12037652543, 665, 12037652545, 665, 2, 1, 0, 0, 12037652543, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652560, 665, 1, 12037652640, 665, 12037652560, 665, 2, 0, 1, 0, 12037652544, 665, 12037652544, 665, 1, 2, 0, 0, 12037652544, 665, 12037652544, 665, 2, 1, 0, 0, 12037652544, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652559, 665, 1, 12037652641, 665, 12037652559, 665, 2, 0, 1, 0, 12037652545, 665, 12037652543, 665, 1, 2, 0, 0, 12037652545, 665, 12037652543, 665, 2, 1, 0, 0, 12037652545, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652558, 665, 1, 12037652642, 665, 12037652558, 665, 2, 0, 1, 0, 12037652546, 665, 12037652542, 665, 1, 2, 0, 0, 12037652546, 665, 12037652542, 665, 2, 1, 0, 0, 12037652546, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652557, 665, 1, 12037652643, 665, 12037652557, 665, 2, 0, 1, 0, 12037652547, 665, 12037652541, 665, 1, 2, 0, 0, 12037652547, 665, 12037652541, 665, 2, 1, 0, 0, 12037652547, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652556, 665, 1, 12037652644, 665, 12037652556, 665, 2, 0, 1, 0, 12037652548, 665, 12037652540, 665, 1, 2, 0, 0, 12037652548, 665, 12037652540, 665, 2, 1, 0, 0, 12037652548, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652555, 665, 1, 12037652645, 665, 12037652555, 665, 2, 0, 1, 0, 12037652549, 665, 12037652539, 665, 1, 2, 0, 0, 12037652549, 665, 12037652539, 665, 2, 1, 0, 0, 12037652549, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652554, 665, 1, 12037652646, 665, 12037652554, 665, 2, 0, 1, 0, 12037652550, 665, 12037652538, 665, 1, 2, 0, 0, 12037652550, 665, 12037652538, 665, 2, 1, 0, 0, 12037652550, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 784, 4, 2, 0, 12037652634, 665, 12037652567, 665, 1, 12037652634, 665, 12037652567, 665, 2, 0, 1, 0, 12037652538, 665, 12037652551, 665, 1, 2, 0, 0, 12037652538, 665, 12037652551, 665, 2, 1, 0, 0, 12037652538, 665, 12037652551, 665, 1, 2, 0, 0, 64559ULL, 12037652663, 665, 3, 1, 0, 0, 12037652635, 665, 12037652566, 665, 1, 12037652635, 665, 12037652566, 665, 2, 0, 1, 0, 12037652539, 665, 12037652550, 665, 1, 2, 0, 0, 12037652539, 665, 12037652550, 665, 2, 1, 0, 0, 12037652539, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652565, 665, 1, 12037652636, 665, 12037652565, 665, 2, 0, 1, 0, 12037652540, 665, 12037652549, 665, 1, 2, 0, 0, 12037652540, 665, 12037652549, 665, 2, 1, 0, 0, 12037652540, 665, 12037652549, 665, 1, 2, 0, 0, 65534ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652564, 665, 1, 12037652637, 665, 12037652564, 665, 2, 0, 1, 0, 12037652541, 665, 12037652548, 665, 1, 2, 0, 0, 12037652541, 665, 12037652548, 665, 2, 1, 0, 0, 12037652541, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652563, 665, 1, 12037652638, 665, 12037652563, 665, 2, 0, 1, 0, 12037652542, 665, 12037652547, 665, 1, 2, 0, 0, 12037652542, 665, 12037652547, 665, 2, 1, 0, 0, 12037652542, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652562, 665, 1, 12037652639, 665, 12037652562, 665, 2, 0, 1, 0, 12037652543, 665, 12037652546, 665, 1, 2, 0, 0, 12037652543, 665, 12037652546, 665, 2, 1, 0, 0, 12037652543, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652561, 665, 1, 12037652640, 665, 12037652561, 665, 2, 0, 1, 0, 12037652544, 665, 12037652545, 665, 1, 2, 0, 0, 12037652544, 665, 12037652545, 665, 2, 1, 0, 0, 12037652544, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652560, 665, 1, 12037652641, 665, 12037652560, 665, 2, 0, 1, 0, 12037652545, 665, 12037652544, 665, 1, 2, 0, 0, 12037652545, 665, 12037652544, 665, 2, 1, 0, 0, 12037652545, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652559, 665, 1, 12037652642, 665, 12037652559, 665, 2, 0, 1, 0, 12037652546, 665, 12037652543, 665, 1, 2, 0, 0, 12037652546, 665, 12037652543, 665, 2, 1, 0, 0, 12037652546, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652558, 665, 1, 12037652643, 665, 12037652558, 665, 2, 0, 1, 0, 12037652547, 665, 12037652542, 665, 1, 2, 0, 0, 12037652547, 665, 12037652542, 665, 2, 1, 0, 0, 12037652547, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652557, 665, 1, 12037652644, 665, 12037652557, 665, 2, 0, 1, 0, 12037652548, 665, 12037652541, 665, 1, 2, 0, 0, 12037652548, 665, 12037652541, 665, 2, 1, 0, 0, 12037652548, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652556, 665, 1, 12037652645, 665, 12037652556, 665, 2, 0, 1, 0, 12037652549, 665, 12037652540, 665, 1, 2, 0, 0, 12037652549, 665, 12037652540, 665, 2, 1, 0, 0, 12037652549, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652555, 665, 1, 12037652646, 665, 12037652555, 665, 2, 0, 1, 0, 12037652550, 665, 12037652539, 665, 1, 2, 0, 0, 12037652550, 665, 12037652539, 665, 2, 1, 0, 0, 12037652550, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652554, 665, 1, 12037652647, 665, 12037652554, 665, 2, 0, 1, 0, 12037652551, 665, 12037652538, 665, 1, 2, 0, 0, 12037652551, 665, 12037652538, 665, 2, 1, 0, 0, 12037652551, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 785, 3, 2, 0, 12037652634, 665, 12037652568, 665, 1, 12037652634, 665, 12037652568, 665, 2, 0, 1, 0, 12037652538, 665, 12037652552, 665, 1, 2, 0, 0, 12037652538, 665, 12037652552, 665, 2, 1, 0, 0, 12037652538, 665, 12037652552, 665, 1, 2, 0, 0, 64559ULL, 12037652664, 665, 3, 1, 0, 0, 12037652635, 665, 12037652567, 665, 1, 12037652635, 665, 12037652567, 665, 2, 0, 1, 0, 12037652539, 665, 12037652551, 665, 1, 2, 0, 0, 12037652539, 665, 12037652551, 665, 2, 1, 0, 0, 12037652539, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652566, 665, 1, 12037652636, 665, 12037652566, 665, 2, 0, 1, 0, 12037652540, 665, 12037652550, 665, 1, 2, 0, 0, 12037652540, 665, 12037652550, 665, 2, 1, 0, 0, 12037652540, 665, 12037652550, 665, 1, 2, 0, 0, 65534ULL, 12037652662, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652565, 665, 1, 12037652637, 665, 12037652565, 665, 2, 0, 1, 0, 12037652541, 665, 12037652549, 665, 1, 2, 0, 0, 12037652541, 665, 12037652549, 665, 2, 1, 0, 0, 12037652541, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652564, 665, 1, 12037652638, 665, 12037652564, 665, 2, 0, 1, 0, 12037652542, 665, 12037652548, 665, 1, 2, 0, 0, 12037652542, 665, 12037652548, 665, 2, 1, 0, 0, 12037652542, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652563, 665, 1, 12037652639, 665, 12037652563, 665, 2, 0, 1, 0, 12037652543, 665, 12037652547, 665, 1, 2, 0, 0, 12037652543, 665, 12037652547, 665, 2, 1, 0, 0, 12037652543, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652562, 665, 1, 12037652640, 665, 12037652562, 665, 2, 0, 1, 0, 12037652544, 665, 12037652546, 665, 1, 2, 0, 0, 12037652544, 665, 12037652546, 665, 2, 1, 0, 0, 12037652544, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652561, 665, 1, 12037652641, 665, 12037652561, 665, 2, 0, 1, 0, 12037652545, 665, 12037652545, 665, 1, 2, 0, 0, 12037652545, 665, 12037652545, 665, 2, 1, 0, 0, 12037652545, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652560, 665, 1, 12037652642, 665, 12037652560, 665, 2, 0, 1, 0, 12037652546, 665, 12037652544, 665, 1, 2, 0, 0, 12037652546, 665, 12037652544, 665, 2, 1, 0, 0, 12037652546, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652559, 665, 1, 12037652643, 665, 12037652559, 665, 2, 0, 1, 0, 12037652547, 665, 12037652543, 665, 1, 2, 0, 0, 12037652547, 665, 12037652543, 665, 2, 1, 0, 0, 12037652547, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652558, 665, 1, 12037652644, 665, 12037652558, 665, 2, 0, 1, 0, 12037652548, 665, 12037652542, 665, 1, 2, 0, 0, 12037652548, 665, 12037652542, 665, 2, 1, 0, 0, 12037652548, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652557, 665, 1, 12037652645, 665, 12037652557, 665, 2, 0, 1, 0, 12037652549, 665, 12037652541, 665, 1, 2, 0, 0, 12037652549, 665, 12037652541, 665, 2, 1, 0, 0, 12037652549, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652556, 665, 1, 12037652646, 665, 12037652556, 665, 2, 0, 1, 0, 12037652550, 665, 12037652540, 665, 1, 2, 0, 0, 12037652550, 665, 12037652540, 665, 2, 1, 0, 0, 12037652550, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652555, 665, 1, 12037652647, 665, 12037652555, 665, 2, 0, 1, 0, 12037652551, 665, 12037652539, 665, 1, 2, 0, 0, 12037652551, 665, 12037652539, 665, 2, 1, 0, 0, 12037652551, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652554, 665, 1, 12037652648, 665, 12037652554, 665, 2, 0, 1, 0, 12037652552, 665, 12037652538, 665, 1, 2, 0, 0, 12037652552, 665, 12037652538, 665, 2, 1, 0, 0, 12037652552, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 786, 4, 2, 0, 12037652634, 665, 12037652569, 665, 1, 12037652634, 665, 12037652569, 665, 2, 0, 1, 0, 12037652538, 665, 12037652553, 665, 1, 2, 0, 0, 12037652538, 665, 12037652553, 665, 2, 1, 0, 0, 12037652538, 665, 12037652553, 665, 1, 2, 0, 0, 64559ULL, 12037652665, 665, 3, 1, 0, 0, 12037652635, 665, 12037652568, 665, 1, 12037652635, 665, 12037652568, 665, 2, 0, 1, 0, 12037652539, 665, 12037652552, 665, 1, 2, 0, 0, 12037652539, 665, 12037652552, 665, 2, 1, 0, 0, 12037652539, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652636, 665, 12037652567, 665, 1, 12037652636, 665, 12037652567, 665, 2, 0, 1, 0, 12037652540, 665, 12037652551, 665, 1, 2, 0, 0, 12037652540, 665, 12037652551, 665, 2, 1, 0, 0, 12037652540, 665, 12037652551, 665, 1, 2, 0, 0, 65534ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652637, 665, 12037652566, 665, 1, 12037652637, 665, 12037652566, 665, 2, 0, 1, 0, 12037652541, 665, 12037652550, 665, 1, 2, 0, 0, 12037652541, 665, 12037652550, 665, 2, 1, 0, 0, 12037652541, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652565, 665, 1, 12037652638, 665, 12037652565, 665, 2, 0, 1, 0, 12037652542, 665, 12037652549, 665, 1, 2, 0, 0, 12037652542, 665, 12037652549, 665, 2, 1, 0, 0, 12037652542, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652564, 665, 1, 12037652639, 665, 12037652564, 665, 2, 0, 1, 0, 12037652543, 665, 12037652548, 665, 1, 2, 0, 0, 12037652543, 665, 12037652548, 665, 2, 1, 0, 0, 12037652543, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652563, 665, 1, 12037652640, 665, 12037652563, 665, 2, 0, 1, 0, 12037652544, 665, 12037652547, 665, 1, 2, 0, 0, 12037652544, 665, 12037652547, 665, 2, 1, 0, 0, 12037652544, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652562, 665, 1, 12037652641, 665, 12037652562, 665, 2, 0, 1, 0, 12037652545, 665, 12037652546, 665, 1, 2, 0, 0, 12037652545, 665, 12037652546, 665, 2, 1, 0, 0, 12037652545, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652561, 665, 1, 12037652642, 665, 12037652561, 665, 2, 0, 1, 0, 12037652546, 665, 12037652545, 665, 1, 2, 0, 0, 12037652546, 665, 12037652545, 665, 2, 1, 0, 0, 12037652546, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652560, 665, 1, 12037652643, 665, 12037652560, 665, 2, 0, 1, 0, 12037652547, 665, 12037652544, 665, 1, 2, 0, 0, 12037652547, 665, 12037652544, 665, 2, 1, 0, 0, 12037652547, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652559, 665, 1, 12037652644, 665, 12037652559, 665, 2, 0, 1, 0, 12037652548, 665, 12037652543, 665, 1, 2, 0, 0, 12037652548, 665, 12037652543, 665, 2, 1, 0, 0, 12037652548, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652558, 665, 1, 12037652645, 665, 12037652558, 665, 2, 0, 1, 0, 12037652549, 665, 12037652542, 665, 1, 2, 0, 0, 12037652549, 665, 12037652542, 665, 2, 1, 0, 0, 12037652549, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652557, 665, 1, 12037652646, 665, 12037652557, 665, 2, 0, 1, 0, 12037652550, 665, 12037652541, 665, 1, 2, 0, 0, 12037652550, 665, 12037652541, 665, 2, 1, 0, 0, 12037652550, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652556, 665, 1, 12037652647, 665, 12037652556, 665, 2, 0, 1, 0, 12037652551, 665, 12037652540, 665, 1, 2, 0, 0, 12037652551, 665, 12037652540, 665, 2, 1, 0, 0, 12037652551, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652555, 665, 1, 12037652648, 665, 12037652555, 665, 2, 0, 1, 0, 12037652552, 665, 12037652539, 665, 1, 2, 0, 0, 12037652552, 665, 12037652539, 665, 2, 1, 0, 0, 12037652552, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652554, 665, 1, 12037652649, 665, 12037652554, 665, 2, 0, 1, 0, 12037652553, 665, 12037652538, 665, 1, 2, 0, 0, 12037652553, 665, 12037652538, 665, 2, 1, 0, 0, 12037652553, 665, 12037652538, 665, 1, 2, 0, 0, 65535ULL, 12037652650, 665, 2, 1, 0, 787, 3, 2, 0, 12037652635, 665, 12037652569, 665, 1, 12037652635, 665, 12037652569, 665, 2, 0, 1, 0, 12037652539, 665, 12037652553, 665, 1, 2, 0, 0, 12037652539, 665, 12037652553, 665, 2, 1, 0, 0, 12037652539, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652636, 665, 12037652568, 665, 1, 12037652636, 665, 12037652568, 665, 2, 0, 1, 0, 12037652540, 665, 12037652552, 665, 1, 2, 0, 0, 12037652540, 665, 12037652552, 665, 2, 1, 0, 0, 12037652540, 665, 12037652552, 665, 1, 2, 0, 0, 65534ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652637, 665, 12037652567, 665, 1, 12037652637, 665, 12037652567, 665, 2, 0, 1, 0, 12037652541, 665, 12037652551, 665, 1, 2, 0, 0, 12037652541, 665, 12037652551, 665, 2, 1, 0, 0, 12037652541, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652638, 665, 12037652566, 665, 1, 12037652638, 665, 12037652566, 665, 2, 0, 1, 0, 12037652542, 665, 12037652550, 665, 1, 2, 0, 0, 12037652542, 665, 12037652550, 665, 2, 1, 0, 0, 12037652542, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652639, 665, 12037652565, 665, 1, 12037652639, 665, 12037652565, 665, 2, 0, 1, 0, 12037652543, 665, 12037652549, 665, 1, 2, 0, 0, 12037652543, 665, 12037652549, 665, 2, 1, 0, 0, 12037652543, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652640, 665, 12037652564, 665, 1, 12037652640, 665, 12037652564, 665, 2, 0, 1, 0, 12037652544, 665, 12037652548, 665, 1, 2, 0, 0, 12037652544, 665, 12037652548, 665, 2, 1, 0, 0, 12037652544, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652641, 665, 12037652563, 665, 1, 12037652641, 665, 12037652563, 665, 2, 0, 1, 0, 12037652545, 665, 12037652547, 665, 1, 2, 0, 0, 12037652545, 665, 12037652547, 665, 2, 1, 0, 0, 12037652545, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652642, 665, 12037652562, 665, 1, 12037652642, 665, 12037652562, 665, 2, 0, 1, 0, 12037652546, 665, 12037652546, 665, 1, 2, 0, 0, 12037652546, 665, 12037652546, 665, 2, 1, 0, 0, 12037652546, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652561, 665, 1, 12037652643, 665, 12037652561, 665, 2, 0, 1, 0, 12037652547, 665, 12037652545, 665, 1, 2, 0, 0, 12037652547, 665, 12037652545, 665, 2, 1, 0, 0, 12037652547, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652560, 665, 1, 12037652644, 665, 12037652560, 665, 2, 0, 1, 0, 12037652548, 665, 12037652544, 665, 1, 2, 0, 0, 12037652548, 665, 12037652544, 665, 2, 1, 0, 0, 12037652548, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652559, 665, 1, 12037652645, 665, 12037652559, 665, 2, 0, 1, 0, 12037652549, 665, 12037652543, 665, 1, 2, 0, 0, 12037652549, 665, 12037652543, 665, 2, 1, 0, 0, 12037652549, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652558, 665, 1, 12037652646, 665, 12037652558, 665, 2, 0, 1, 0, 12037652550, 665, 12037652542, 665, 1, 2, 0, 0, 12037652550, 665, 12037652542, 665, 2, 1, 0, 0, 12037652550, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652557, 665, 1, 12037652647, 665, 12037652557, 665, 2, 0, 1, 0, 12037652551, 665, 12037652541, 665, 1, 2, 0, 0, 12037652551, 665, 12037652541, 665, 2, 1, 0, 0, 12037652551, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652556, 665, 1, 12037652648, 665, 12037652556, 665, 2, 0, 1, 0, 12037652552, 665, 12037652540, 665, 1, 2, 0, 0, 12037652552, 665, 12037652540, 665, 2, 1, 0, 0, 12037652552, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652555, 665, 1, 12037652649, 665, 12037652555, 665, 2, 0, 1, 0, 12037652553, 665, 12037652539, 665, 1, 2, 0, 0, 12037652553, 665, 12037652539, 665, 2, 1, 0, 0, 12037652553, 665, 12037652539, 665, 1, 2, 0, 0, 65535ULL, 12037652651, 665, 2, 1, 0, 0, 4, 2, 788, 0, 258236ULL, 0, 12037652636, 665, 12037652569, 665, 1, 12037652636, 665, 12037652569, 665, 2, 0, 1, 0, 12037652540, 665, 12037652553, 665, 1, 2, 0, 0, 12037652540, 665, 12037652553, 665, 2, 1, 0, 0, 12037652540, 665, 12037652553, 665, 1, 2, 0, 0, 65534ULL, 12037652665, 665, 3, 1, 0, 0, 12037652637, 665, 12037652568, 665, 1, 12037652637, 665, 12037652568, 665, 2, 0, 1, 0, 12037652541, 665, 12037652552, 665, 1, 2, 0, 0, 12037652541, 665, 12037652552, 665, 2, 1, 0, 0, 12037652541, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652638, 665, 12037652567, 665, 1, 12037652638, 665, 12037652567, 665, 2, 0, 1, 0, 12037652542, 665, 12037652551, 665, 1, 2, 0, 0, 12037652542, 665, 12037652551, 665, 2, 1, 0, 0, 12037652542, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652639, 665, 12037652566, 665, 1, 12037652639, 665, 12037652566, 665, 2, 0, 1, 0, 12037652543, 665, 12037652550, 665, 1, 2, 0, 0, 12037652543, 665, 12037652550, 665, 2, 1, 0, 0, 12037652543, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652565, 665, 1, 12037652640, 665, 12037652565, 665, 2, 0, 1, 0, 12037652544, 665, 12037652549, 665, 1, 2, 0, 0, 12037652544, 665, 12037652549, 665, 2, 1, 0, 0, 12037652544, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652564, 665, 1, 12037652641, 665, 12037652564, 665, 2, 0, 1, 0, 12037652545, 665, 12037652548, 665, 1, 2, 0, 0, 12037652545, 665, 12037652548, 665, 2, 1, 0, 0, 12037652545, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652563, 665, 1, 12037652642, 665, 12037652563, 665, 2, 0, 1, 0, 12037652546, 665, 12037652547, 665, 1, 2, 0, 0, 12037652546, 665, 12037652547, 665, 2, 1, 0, 0, 12037652546, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652562, 665, 1, 12037652643, 665, 12037652562, 665, 2, 0, 1, 0, 12037652547, 665, 12037652546, 665, 1, 2, 0, 0, 12037652547, 665, 12037652546, 665, 2, 1, 0, 0, 12037652547, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652561, 665, 1, 12037652644, 665, 12037652561, 665, 2, 0, 1, 0, 12037652548, 665, 12037652545, 665, 1, 2, 0, 0, 12037652548, 665, 12037652545, 665, 2, 1, 0, 0, 12037652548, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652560, 665, 1, 12037652645, 665, 12037652560, 665, 2, 0, 1, 0, 12037652549, 665, 12037652544, 665, 1, 2, 0, 0, 12037652549, 665, 12037652544, 665, 2, 1, 0, 0, 12037652549, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652559, 665, 1, 12037652646, 665, 12037652559, 665, 2, 0, 1, 0, 12037652550, 665, 12037652543, 665, 1, 2, 0, 0, 12037652550, 665, 12037652543, 665, 2, 1, 0, 0, 12037652550, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652558, 665, 1, 12037652647, 665, 12037652558, 665, 2, 0, 1, 0, 12037652551, 665, 12037652542, 665, 1, 2, 0, 0, 12037652551, 665, 12037652542, 665, 2, 1, 0, 0, 12037652551, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652557, 665, 1, 12037652648, 665, 12037652557, 665, 2, 0, 1, 0, 12037652552, 665, 12037652541, 665, 1, 2, 0, 0, 12037652552, 665, 12037652541, 665, 2, 1, 0, 0, 12037652552, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652556, 665, 1, 12037652649, 665, 12037652556, 665, 2, 0, 1, 0, 12037652553, 665, 12037652540, 665, 1, 2, 0, 0, 12037652553, 665, 12037652540, 665, 2, 1, 0, 0, 12037652553, 665, 12037652540, 665, 1, 2, 0, 0, 65535ULL, 12037652652, 665, 2, 1, 0, 0, 3, 2, 789, 0, 262140ULL, 0, 12037652637, 665, 12037652569, 665, 1, 12037652637, 665, 12037652569, 665, 2, 0, 1, 0, 12037652541, 665, 12037652553, 665, 1, 2, 0, 0, 12037652541, 665, 12037652553, 665, 2, 1, 0, 0, 12037652541, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652638, 665, 12037652568, 665, 1, 12037652638, 665, 12037652568, 665, 2, 0, 1, 0, 12037652542, 665, 12037652552, 665, 1, 2, 0, 0, 12037652542, 665, 12037652552, 665, 2, 1, 0, 0, 12037652542, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652639, 665, 12037652567, 665, 1, 12037652639, 665, 12037652567, 665, 2, 0, 1, 0, 12037652543, 665, 12037652551, 665, 1, 2, 0, 0, 12037652543, 665, 12037652551, 665, 2, 1, 0, 0, 12037652543, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652640, 665, 12037652566, 665, 1, 12037652640, 665, 12037652566, 665, 2, 0, 1, 0, 12037652544, 665, 12037652550, 665, 1, 2, 0, 0, 12037652544, 665, 12037652550, 665, 2, 1, 0, 0, 12037652544, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652641, 665, 12037652565, 665, 1, 12037652641, 665, 12037652565, 665, 2, 0, 1, 0, 12037652545, 665, 12037652549, 665, 1, 2, 0, 0, 12037652545, 665, 12037652549, 665, 2, 1, 0, 0, 12037652545, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652642, 665, 12037652564, 665, 1, 12037652642, 665, 12037652564, 665, 2, 0, 1, 0, 12037652546, 665, 12037652548, 665, 1, 2, 0, 0, 12037652546, 665, 12037652548, 665, 2, 1, 0, 0, 12037652546, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652563, 665, 1, 12037652643, 665, 12037652563, 665, 2, 0, 1, 0, 12037652547, 665, 12037652547, 665, 1, 2, 0, 0, 12037652547, 665, 12037652547, 665, 2, 1, 0, 0, 12037652547, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652562, 665, 1, 12037652644, 665, 12037652562, 665, 2, 0, 1, 0, 12037652548, 665, 12037652546, 665, 1, 2, 0, 0, 12037652548, 665, 12037652546, 665, 2, 1, 0, 0, 12037652548, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652561, 665, 1, 12037652645, 665, 12037652561, 665, 2, 0, 1, 0, 12037652549, 665, 12037652545, 665, 1, 2, 0, 0, 12037652549, 665, 12037652545, 665, 2, 1, 0, 0, 12037652549, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652560, 665, 1, 12037652646, 665, 12037652560, 665, 2, 0, 1, 0, 12037652550, 665, 12037652544, 665, 1, 2, 0, 0, 12037652550, 665, 12037652544, 665, 2, 1, 0, 0, 12037652550, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652559, 665, 1, 12037652647, 665, 12037652559, 665, 2, 0, 1, 0, 12037652551, 665, 12037652543, 665, 1, 2, 0, 0, 12037652551, 665, 12037652543, 665, 2, 1, 0, 0, 12037652551, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652558, 665, 1, 12037652648, 665, 12037652558, 665, 2, 0, 1, 0, 12037652552, 665, 12037652542, 665, 1, 2, 0, 0, 12037652552, 665, 12037652542, 665, 2, 1, 0, 0, 12037652552, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652557, 665, 1, 12037652649, 665, 12037652557, 665, 2, 0, 1, 0, 12037652553, 665, 12037652541, 665, 1, 2, 0, 0, 12037652553, 665, 12037652541, 665, 2, 1, 0, 0, 12037652553, 665, 12037652541, 665, 1, 2, 0, 0, 65535ULL, 12037652653, 665, 2, 1, 0, 0, 4, 2, 790, 0, 262136ULL, 0, 12037652638, 665, 12037652569, 665, 1, 12037652638, 665, 12037652569, 665, 2, 0, 1, 0, 12037652542, 665, 12037652553, 665, 1, 2, 0, 0, 12037652542, 665, 12037652553, 665, 2, 1, 0, 0, 12037652542, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652639, 665, 12037652568, 665, 1, 12037652639, 665, 12037652568, 665, 2, 0, 1, 0, 12037652543, 665, 12037652552, 665, 1, 2, 0, 0, 12037652543, 665, 12037652552, 665, 2, 1, 0, 0, 12037652543, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652640, 665, 12037652567, 665, 1, 12037652640, 665, 12037652567, 665, 2, 0, 1, 0, 12037652544, 665, 12037652551, 665, 1, 2, 0, 0, 12037652544, 665, 12037652551, 665, 2, 1, 0, 0, 12037652544, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652641, 665, 12037652566, 665, 1, 12037652641, 665, 12037652566, 665, 2, 0, 1, 0, 12037652545, 665, 12037652550, 665, 1, 2, 0, 0, 12037652545, 665, 12037652550, 665, 2, 1, 0, 0, 12037652545, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652565, 665, 1, 12037652642, 665, 12037652565, 665, 2, 0, 1, 0, 12037652546, 665, 12037652549, 665, 1, 2, 0, 0, 12037652546, 665, 12037652549, 665, 2, 1, 0, 0, 12037652546, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652564, 665, 1, 12037652643, 665, 12037652564, 665, 2, 0, 1, 0, 12037652547, 665, 12037652548, 665, 1, 2, 0, 0, 12037652547, 665, 12037652548, 665, 2, 1, 0, 0, 12037652547, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652563, 665, 1, 12037652644, 665, 12037652563, 665, 2, 0, 1, 0, 12037652548, 665, 12037652547, 665, 1, 2, 0, 0, 12037652548, 665, 12037652547, 665, 2, 1, 0, 0, 12037652548, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652562, 665, 1, 12037652645, 665, 12037652562, 665, 2, 0, 1, 0, 12037652549, 665, 12037652546, 665, 1, 2, 0, 0, 12037652549, 665, 12037652546, 665, 2, 1, 0, 0, 12037652549, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652561, 665, 1, 12037652646, 665, 12037652561, 665, 2, 0, 1, 0, 12037652550, 665, 12037652545, 665, 1, 2, 0, 0, 12037652550, 665, 12037652545, 665, 2, 1, 0, 0, 12037652550, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652560, 665, 1, 12037652647, 665, 12037652560, 665, 2, 0, 1, 0, 12037652551, 665, 12037652544, 665, 1, 2, 0, 0, 12037652551, 665, 12037652544, 665, 2, 1, 0, 0, 12037652551, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652559, 665, 1, 12037652648, 665, 12037652559, 665, 2, 0, 1, 0, 12037652552, 665, 12037652543, 665, 1, 2, 0, 0, 12037652552, 665, 12037652543, 665, 2, 1, 0, 0, 12037652552, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652558, 665, 1, 12037652649, 665, 12037652558, 665, 2, 0, 1, 0, 12037652553, 665, 12037652542, 665, 1, 2, 0, 0, 12037652553, 665, 12037652542, 665, 2, 1, 0, 0, 12037652553, 665, 12037652542, 665, 1, 2, 0, 0, 65535ULL, 12037652654, 665, 2, 1, 0, 0, 3, 2, 791, 0, 262140ULL, 0, 12037652639, 665, 12037652569, 665, 1, 12037652639, 665, 12037652569, 665, 2, 0, 1, 0, 12037652543, 665, 12037652553, 665, 1, 2, 0, 0, 12037652543, 665, 12037652553, 665, 2, 1, 0, 0, 12037652543, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652640, 665, 12037652568, 665, 1, 12037652640, 665, 12037652568, 665, 2, 0, 1, 0, 12037652544, 665, 12037652552, 665, 1, 2, 0, 0, 12037652544, 665, 12037652552, 665, 2, 1, 0, 0, 12037652544, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652641, 665, 12037652567, 665, 1, 12037652641, 665, 12037652567, 665, 2, 0, 1, 0, 12037652545, 665, 12037652551, 665, 1, 2, 0, 0, 12037652545, 665, 12037652551, 665, 2, 1, 0, 0, 12037652545, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652642, 665, 12037652566, 665, 1, 12037652642, 665, 12037652566, 665, 2, 0, 1, 0, 12037652546, 665, 12037652550, 665, 1, 2, 0, 0, 12037652546, 665, 12037652550, 665, 2, 1, 0, 0, 12037652546, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652565, 665, 1, 12037652643, 665, 12037652565, 665, 2, 0, 1, 0, 12037652547, 665, 12037652549, 665, 1, 2, 0, 0, 12037652547, 665, 12037652549, 665, 2, 1, 0, 0, 12037652547, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652564, 665, 1, 12037652644, 665, 12037652564, 665, 2, 0, 1, 0, 12037652548, 665, 12037652548, 665, 1, 2, 0, 0, 12037652548, 665, 12037652548, 665, 2, 1, 0, 0, 12037652548, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652563, 665, 1, 12037652645, 665, 12037652563, 665, 2, 0, 1, 0, 12037652549, 665, 12037652547, 665, 1, 2, 0, 0, 12037652549, 665, 12037652547, 665, 2, 1, 0, 0, 12037652549, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652562, 665, 1, 12037652646, 665, 12037652562, 665, 2, 0, 1, 0, 12037652550, 665, 12037652546, 665, 1, 2, 0, 0, 12037652550, 665, 12037652546, 665, 2, 1, 0, 0, 12037652550, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652561, 665, 1, 12037652647, 665, 12037652561, 665, 2, 0, 1, 0, 12037652551, 665, 12037652545, 665, 1, 2, 0, 0, 12037652551, 665, 12037652545, 665, 2, 1, 0, 0, 12037652551, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652560, 665, 1, 12037652648, 665, 12037652560, 665, 2, 0, 1, 0, 12037652552, 665, 12037652544, 665, 1, 2, 0, 0, 12037652552, 665, 12037652544, 665, 2, 1, 0, 0, 12037652552, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652559, 665, 1, 12037652649, 665, 12037652559, 665, 2, 0, 1, 0, 12037652553, 665, 12037652543, 665, 1, 2, 0, 0, 12037652553, 665, 12037652543, 665, 2, 1, 0, 0, 12037652553, 665, 12037652543, 665, 1, 2, 0, 0, 65535ULL, 12037652655, 665, 2, 1, 0, 0, 4, 2, 792, 0, 262140ULL, 0, 12037652640, 665, 12037652569, 665, 1, 12037652640, 665, 12037652569, 665, 2, 0, 1, 0, 12037652544, 665, 12037652553, 665, 1, 2, 0, 0, 12037652544, 665, 12037652553, 665, 2, 1, 0, 0, 12037652544, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652641, 665, 12037652568, 665, 1, 12037652641, 665, 12037652568, 665, 2, 0, 1, 0, 12037652545, 665, 12037652552, 665, 1, 2, 0, 0, 12037652545, 665, 12037652552, 665, 2, 1, 0, 0, 12037652545, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652642, 665, 12037652567, 665, 1, 12037652642, 665, 12037652567, 665, 2, 0, 1, 0, 12037652546, 665, 12037652551, 665, 1, 2, 0, 0, 12037652546, 665, 12037652551, 665, 2, 1, 0, 0, 12037652546, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652643, 665, 12037652566, 665, 1, 12037652643, 665, 12037652566, 665, 2, 0, 1, 0, 12037652547, 665, 12037652550, 665, 1, 2, 0, 0, 12037652547, 665, 12037652550, 665, 2, 1, 0, 0, 12037652547, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652565, 665, 1, 12037652644, 665, 12037652565, 665, 2, 0, 1, 0, 12037652548, 665, 12037652549, 665, 1, 2, 0, 0, 12037652548, 665, 12037652549, 665, 2, 1, 0, 0, 12037652548, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652564, 665, 1, 12037652645, 665, 12037652564, 665, 2, 0, 1, 0, 12037652549, 665, 12037652548, 665, 1, 2, 0, 0, 12037652549, 665, 12037652548, 665, 2, 1, 0, 0, 12037652549, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652563, 665, 1, 12037652646, 665, 12037652563, 665, 2, 0, 1, 0, 12037652550, 665, 12037652547, 665, 1, 2, 0, 0, 12037652550, 665, 12037652547, 665, 2, 1, 0, 0, 12037652550, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652562, 665, 1, 12037652647, 665, 12037652562, 665, 2, 0, 1, 0, 12037652551, 665, 12037652546, 665, 1, 2, 0, 0, 12037652551, 665, 12037652546, 665, 2, 1, 0, 0, 12037652551, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652561, 665, 1, 12037652648, 665, 12037652561, 665, 2, 0, 1, 0, 12037652552, 665, 12037652545, 665, 1, 2, 0, 0, 12037652552, 665, 12037652545, 665, 2, 1, 0, 0, 12037652552, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652560, 665, 1, 12037652649, 665, 12037652560, 665, 2, 0, 1, 0, 12037652553, 665, 12037652544, 665, 1, 2, 0, 0, 12037652553, 665, 12037652544, 665, 2, 1, 0, 0, 12037652553, 665, 12037652544, 665, 1, 2, 0, 0, 65535ULL, 12037652656, 665, 2, 1, 0, 0, 3, 2, 793, 0, 262140ULL, 0, 12037652641, 665, 12037652569, 665, 1, 12037652641, 665, 12037652569, 665, 2, 0, 1, 0, 12037652545, 665, 12037652553, 665, 1, 2, 0, 0, 12037652545, 665, 12037652553, 665, 2, 1, 0, 0, 12037652545, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652642, 665, 12037652568, 665, 1, 12037652642, 665, 12037652568, 665, 2, 0, 1, 0, 12037652546, 665, 12037652552, 665, 1, 2, 0, 0, 12037652546, 665, 12037652552, 665, 2, 1, 0, 0, 12037652546, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652643, 665, 12037652567, 665, 1, 12037652643, 665, 12037652567, 665, 2, 0, 1, 0, 12037652547, 665, 12037652551, 665, 1, 2, 0, 0, 12037652547, 665, 12037652551, 665, 2, 1, 0, 0, 12037652547, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652644, 665, 12037652566, 665, 1, 12037652644, 665, 12037652566, 665, 2, 0, 1, 0, 12037652548, 665, 12037652550, 665, 1, 2, 0, 0, 12037652548, 665, 12037652550, 665, 2, 1, 0, 0, 12037652548, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652565, 665, 1, 12037652645, 665, 12037652565, 665, 2, 0, 1, 0, 12037652549, 665, 12037652549, 665, 1, 2, 0, 0, 12037652549, 665, 12037652549, 665, 2, 1, 0, 0, 12037652549, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652564, 665, 1, 12037652646, 665, 12037652564, 665, 2, 0, 1, 0, 12037652550, 665, 12037652548, 665, 1, 2, 0, 0, 12037652550, 665, 12037652548, 665, 2, 1, 0, 0, 12037652550, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652563, 665, 1, 12037652647, 665, 12037652563, 665, 2, 0, 1, 0, 12037652551, 665, 12037652547, 665, 1, 2, 0, 0, 12037652551, 665, 12037652547, 665, 2, 1, 0, 0, 12037652551, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652562, 665, 1, 12037652648, 665, 12037652562, 665, 2, 0, 1, 0, 12037652552, 665, 12037652546, 665, 1, 2, 0, 0, 12037652552, 665, 12037652546, 665, 2, 1, 0, 0, 12037652552, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652561, 665, 1, 12037652649, 665, 12037652561, 665, 2, 0, 1, 0, 12037652553, 665, 12037652545, 665, 1, 2, 0, 0, 12037652553, 665, 12037652545, 665, 2, 1, 0, 0, 12037652553, 665, 12037652545, 665, 1, 2, 0, 0, 65535ULL, 12037652657, 665, 2, 1, 0, 0, 4, 2, 794, 0, 262140ULL, 0, 12037652642, 665, 12037652569, 665, 1, 12037652642, 665, 12037652569, 665, 2, 0, 1, 0, 12037652546, 665, 12037652553, 665, 1, 2, 0, 0, 12037652546, 665, 12037652553, 665, 2, 1, 0, 0, 12037652546, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652643, 665, 12037652568, 665, 1, 12037652643, 665, 12037652568, 665, 2, 0, 1, 0, 12037652547, 665, 12037652552, 665, 1, 2, 0, 0, 12037652547, 665, 12037652552, 665, 2, 1, 0, 0, 12037652547, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652644, 665, 12037652567, 665, 1, 12037652644, 665, 12037652567, 665, 2, 0, 1, 0, 12037652548, 665, 12037652551, 665, 1, 2, 0, 0, 12037652548, 665, 12037652551, 665, 2, 1, 0, 0, 12037652548, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652645, 665, 12037652566, 665, 1, 12037652645, 665, 12037652566, 665, 2, 0, 1, 0, 12037652549, 665, 12037652550, 665, 1, 2, 0, 0, 12037652549, 665, 12037652550, 665, 2, 1, 0, 0, 12037652549, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652565, 665, 1, 12037652646, 665, 12037652565, 665, 2, 0, 1, 0, 12037652550, 665, 12037652549, 665, 1, 2, 0, 0, 12037652550, 665, 12037652549, 665, 2, 1, 0, 0, 12037652550, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652564, 665, 1, 12037652647, 665, 12037652564, 665, 2, 0, 1, 0, 12037652551, 665, 12037652548, 665, 1, 2, 0, 0, 12037652551, 665, 12037652548, 665, 2, 1, 0, 0, 12037652551, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652563, 665, 1, 12037652648, 665, 12037652563, 665, 2, 0, 1, 0, 12037652552, 665, 12037652547, 665, 1, 2, 0, 0, 12037652552, 665, 12037652547, 665, 2, 1, 0, 0, 12037652552, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652562, 665, 1, 12037652649, 665, 12037652562, 665, 2, 0, 1, 0, 12037652553, 665, 12037652546, 665, 1, 2, 0, 0, 12037652553, 665, 12037652546, 665, 2, 1, 0, 0, 12037652553, 665, 12037652546, 665, 1, 2, 0, 0, 65535ULL, 12037652658, 665, 2, 1, 0, 0, 3, 2, 795, 0, 262140ULL, 0, 12037652643, 665, 12037652569, 665, 1, 12037652643, 665, 12037652569, 665, 2, 0, 1, 0, 12037652547, 665, 12037652553, 665, 1, 2, 0, 0, 12037652547, 665, 12037652553, 665, 2, 1, 0, 0, 12037652547, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652644, 665, 12037652568, 665, 1, 12037652644, 665, 12037652568, 665, 2, 0, 1, 0, 12037652548, 665, 12037652552, 665, 1, 2, 0, 0, 12037652548, 665, 12037652552, 665, 2, 1, 0, 0, 12037652548, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652645, 665, 12037652567, 665, 1, 12037652645, 665, 12037652567, 665, 2, 0, 1, 0, 12037652549, 665, 12037652551, 665, 1, 2, 0, 0, 12037652549, 665, 12037652551, 665, 2, 1, 0, 0, 12037652549, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652646, 665, 12037652566, 665, 1, 12037652646, 665, 12037652566, 665, 2, 0, 1, 0, 12037652550, 665, 12037652550, 665, 1, 2, 0, 0, 12037652550, 665, 12037652550, 665, 2, 1, 0, 0, 12037652550, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652565, 665, 1, 12037652647, 665, 12037652565, 665, 2, 0, 1, 0, 12037652551, 665, 12037652549, 665, 1, 2, 0, 0, 12037652551, 665, 12037652549, 665, 2, 1, 0, 0, 12037652551, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652564, 665, 1, 12037652648, 665, 12037652564, 665, 2, 0, 1, 0, 12037652552, 665, 12037652548, 665, 1, 2, 0, 0, 12037652552, 665, 12037652548, 665, 2, 1, 0, 0, 12037652552, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652563, 665, 1, 12037652649, 665, 12037652563, 665, 2, 0, 1, 0, 12037652553, 665, 12037652547, 665, 1, 2, 0, 0, 12037652553, 665, 12037652547, 665, 2, 1, 0, 0, 12037652553, 665, 12037652547, 665, 1, 2, 0, 0, 65535ULL, 12037652659, 665, 2, 1, 0, 0, 4, 2, 796, 0, 262140ULL, 0, 12037652644, 665, 12037652569, 665, 1, 12037652644, 665, 12037652569, 665, 2, 0, 1, 0, 12037652548, 665, 12037652553, 665, 1, 2, 0, 0, 12037652548, 665, 12037652553, 665, 2, 1, 0, 0, 12037652548, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652645, 665, 12037652568, 665, 1, 12037652645, 665, 12037652568, 665, 2, 0, 1, 0, 12037652549, 665, 12037652552, 665, 1, 2, 0, 0, 12037652549, 665, 12037652552, 665, 2, 1, 0, 0, 12037652549, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652646, 665, 12037652567, 665, 1, 12037652646, 665, 12037652567, 665, 2, 0, 1, 0, 12037652550, 665, 12037652551, 665, 1, 2, 0, 0, 12037652550, 665, 12037652551, 665, 2, 1, 0, 0, 12037652550, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652647, 665, 12037652566, 665, 1, 12037652647, 665, 12037652566, 665, 2, 0, 1, 0, 12037652551, 665, 12037652550, 665, 1, 2, 0, 0, 12037652551, 665, 12037652550, 665, 2, 1, 0, 0, 12037652551, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652565, 665, 1, 12037652648, 665, 12037652565, 665, 2, 0, 1, 0, 12037652552, 665, 12037652549, 665, 1, 2, 0, 0, 12037652552, 665, 12037652549, 665, 2, 1, 0, 0, 12037652552, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652564, 665, 1, 12037652649, 665, 12037652564, 665, 2, 0, 1, 0, 12037652553, 665, 12037652548, 665, 1, 2, 0, 0, 12037652553, 665, 12037652548, 665, 2, 1, 0, 0, 12037652553, 665, 12037652548, 665, 1, 2, 0, 0, 65535ULL, 12037652660, 665, 2, 1, 0, 0, 3, 2, 797, 0, 262140ULL, 0, 12037652645, 665, 12037652569, 665, 1, 12037652645, 665, 12037652569, 665, 2, 0, 1, 0, 12037652549, 665, 12037652553, 665, 1, 2, 0, 0, 12037652549, 665, 12037652553, 665, 2, 1, 0, 0, 12037652549, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652646, 665, 12037652568, 665, 1, 12037652646, 665, 12037652568, 665, 2, 0, 1, 0, 12037652550, 665, 12037652552, 665, 1, 2, 0, 0, 12037652550, 665, 12037652552, 665, 2, 1, 0, 0, 12037652550, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652647, 665, 12037652567, 665, 1, 12037652647, 665, 12037652567, 665, 2, 0, 1, 0, 12037652551, 665, 12037652551, 665, 1, 2, 0, 0, 12037652551, 665, 12037652551, 665, 2, 1, 0, 0, 12037652551, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652648, 665, 12037652566, 665, 1, 12037652648, 665, 12037652566, 665, 2, 0, 1, 0, 12037652552, 665, 12037652550, 665, 1, 2, 0, 0, 12037652552, 665, 12037652550, 665, 2, 1, 0, 0, 12037652552, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652565, 665, 1, 12037652649, 665, 12037652565, 665, 2, 0, 1, 0, 12037652553, 665, 12037652549, 665, 1, 2, 0, 0, 12037652553, 665, 12037652549, 665, 2, 1, 0, 0, 12037652553, 665, 12037652549, 665, 1, 2, 0, 0, 65535ULL, 12037652661, 665, 2, 1, 0, 0, 4, 2, 798, 0, 262140ULL, 0, 12037652646, 665, 12037652569, 665, 1, 12037652646, 665, 12037652569, 665, 2, 0, 1, 0, 12037652550, 665, 12037652553, 665, 1, 2, 0, 0, 12037652550, 665, 12037652553, 665, 2, 1, 0, 0, 12037652550, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652647, 665, 12037652568, 665, 1, 12037652647, 665, 12037652568, 665, 2, 0, 1, 0, 12037652551, 665, 12037652552, 665, 1, 2, 0, 0, 12037652551, 665, 12037652552, 665, 2, 1, 0, 0, 12037652551, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652648, 665, 12037652567, 665, 1, 12037652648, 665, 12037652567, 665, 2, 0, 1, 0, 12037652552, 665, 12037652551, 665, 1, 2, 0, 0, 12037652552, 665, 12037652551, 665, 2, 1, 0, 0, 12037652552, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 3, 4, 2, 0, 12037652649, 665, 12037652566, 665, 1, 12037652649, 665, 12037652566, 665, 2, 0, 1, 0, 12037652553, 665, 12037652550, 665, 1, 2, 0, 0, 12037652553, 665, 12037652550, 665, 2, 1, 0, 0, 12037652553, 665, 12037652550, 665, 1, 2, 0, 0, 65535ULL, 12037652662, 665, 2, 1, 0, 0, 3, 2, 799, 0, 262140ULL, 0, 12037652647, 665, 12037652569, 665, 1, 12037652647, 665, 12037652569, 665, 2, 0, 1, 0, 12037652551, 665, 12037652553, 665, 1, 2, 0, 0, 12037652551, 665, 12037652553, 665, 2, 1, 0, 0, 12037652551, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652648, 665, 12037652568, 665, 1, 12037652648, 665, 12037652568, 665, 2, 0, 1, 0, 12037652552, 665, 12037652552, 665, 1, 2, 0, 0, 12037652552, 665, 12037652552, 665, 2, 1, 0, 0, 12037652552, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 4, 3, 2, 0, 12037652649, 665, 12037652567, 665, 1, 12037652649, 665, 12037652567, 665, 2, 0, 1, 0, 12037652553, 665, 12037652551, 665, 1, 2, 0, 0, 12037652553, 665, 12037652551, 665, 2, 1, 0, 0, 12037652553, 665, 12037652551, 665, 1, 2, 0, 0, 65535ULL, 12037652663, 665, 2, 1, 0, 0, 4, 2, 800, 0, 262140ULL, 0, 12037652648, 665, 12037652569, 665, 1, 12037652648, 665, 12037652569, 665, 2, 0, 1, 0, 12037652552, 665, 12037652553, 665, 1, 2, 0, 0, 12037652552, 665, 12037652553, 665, 2, 1, 0, 0, 12037652552, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 3, 1, 0, 0, 12037652649, 665, 12037652568, 665, 1, 12037652649, 665, 12037652568, 665, 2, 0, 1, 0, 12037652553, 665, 12037652552, 665, 1, 2, 0, 0, 12037652553, 665, 12037652552, 665, 2, 1, 0, 0, 12037652553, 665, 12037652552, 665, 1, 2, 0, 0, 65535ULL, 12037652664, 665, 2, 1, 0, 0, 3, 2, 801, 0, 262140ULL, 0, 12037652649, 665, 12037652569, 665, 1, 12037652649, 665, 12037652569, 665, 2, 0, 1, 0, 12037652553, 665, 12037652553, 665, 1, 2, 0, 0, 12037652553, 665, 12037652553, 665, 2, 1, 0, 0, 12037652553, 665, 12037652553, 665, 1, 2, 0, 0, 65535ULL, 12037652665, 665, 2, 1, 0, 802, 2, 262140ULL, 803, 18446744069414322181ULL, 0, 12037652634, 665, 12037652634, 665, 1, 64559ULL, 12037652666, 665, 2, 0, 1, 0, 2, 12037652538, 665, 1, 0, 12037652570, 665, 804, 1, 12037652602, 665, 0, 12037652634, 665, 12037652635, 665, 1, 64559ULL, 12037652667, 665, 2, 0, 1, 0, 12037652635, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 3, 0, 1, 0, 2, 3, 1, 0, 12037652539, 665, 0, 1, 12037652571, 665, 805, 0, 12037652603, 665, 0, 12037652634, 665, 12037652636, 665, 1, 64559ULL, 12037652668, 665, 2, 0, 1, 0, 12037652635, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652634, 665, 1, 65534ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652540, 665, 0, 1, 12037652572, 665, 806, 0, 12037652604, 665, 0, 12037652634, 665, 12037652637, 665, 1, 64559ULL, 12037652669, 665, 2, 0, 1, 0, 12037652635, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652635, 665, 1, 65534ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652541, 665, 0, 1, 12037652573, 665, 807, 0, 12037652605, 665, 0, 12037652634, 665, 12037652638, 665, 1, 64559ULL, 12037652670, 665, 2, 0, 1, 0, 12037652635, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652636, 665, 1, 65534ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652542, 665, 0, 1, 12037652574, 665, 808, 0, 12037652606, 665, 0, 12037652634, 665, 12037652639, 665, 1, 64559ULL, 12037652671, 665, 2, 0, 1, 0, 12037652635, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652637, 665, 1, 65534ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652543, 665, 0, 1, 12037652575, 665, 809, 0, 12037652607, 665, 0, 12037652634, 665, 12037652640, 665, 1, 64559ULL, 12037652672, 665, 2, 0, 1, 0, 12037652635, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652638, 665, 1, 65534ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652544, 665, 0, 1, 12037652576, 665, 810, 0, 12037652608, 665, 0, 12037652634, 665, 12037652641, 665, 1, 64559ULL, 12037652673, 665, 2, 0, 1, 0, 12037652635, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652639, 665, 1, 65534ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652545, 665, 0, 1, 12037652577, 665, 811, 0, 12037652609, 665, 0, 12037652634, 665, 12037652642, 665, 1, 64559ULL, 12037652674, 665, 2, 0, 1, 0, 12037652635, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652640, 665, 1, 65534ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652546, 665, 0, 1, 12037652578, 665, 812, 0, 12037652610, 665, 0, 12037652634, 665, 12037652643, 665, 1, 64559ULL, 12037652675, 665, 2, 0, 1, 0, 12037652635, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652641, 665, 1, 65534ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652547, 665, 0, 1, 12037652579, 665, 813, 0, 12037652611, 665, 0, 12037652634, 665, 12037652644, 665, 1, 64559ULL, 12037652676, 665, 2, 0, 1, 0, 12037652635, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652642, 665, 1, 65534ULL, 12037652674, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652548, 665, 0, 1, 12037652580, 665, 814, 0, 12037652612, 665, 0, 12037652634, 665, 12037652645, 665, 1, 64559ULL, 12037652677, 665, 2, 0, 1, 0, 12037652635, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652643, 665, 1, 65534ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652549, 665, 0, 1, 12037652581, 665, 815, 0, 12037652613, 665, 0, 12037652634, 665, 12037652646, 665, 1, 64559ULL, 12037652678, 665, 2, 0, 1, 0, 12037652635, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652644, 665, 1, 65534ULL, 12037652676, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652550, 665, 0, 1, 12037652582, 665, 816, 0, 12037652614, 665, 0, 12037652634, 665, 12037652647, 665, 1, 64559ULL, 12037652679, 665, 2, 0, 1, 0, 12037652635, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652645, 665, 1, 65534ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652551, 665, 0, 1, 12037652583, 665, 817, 0, 12037652615, 665, 0, 12037652634, 665, 12037652648, 665, 1, 64559ULL, 12037652680, 665, 2, 0, 1, 0, 12037652635, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652646, 665, 1, 65534ULL, 12037652678, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 4, 2, 1, 0, 12037652552, 665, 0, 1, 12037652584, 665, 818, 0, 12037652616, 665, 0, 12037652634, 665, 12037652649, 665, 1, 64559ULL, 12037652681, 665, 2, 0, 1, 0, 12037652635, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652636, 665, 12037652647, 665, 1, 65534ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652637, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652638, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652634, 665, 1, 65535ULL, 12037652666, 665, 2, 0, 1, 0, 3, 2, 1, 0, 12037652553, 665, 0, 1, 12037652585, 665, 819, 0, 12037652617, 665, 0, 12037652635, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652636, 665, 12037652648, 665, 1, 65534ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652637, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652638, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652639, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652640, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652641, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652642, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652643, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652635, 665, 1, 65535ULL, 12037652667, 665, 2, 0, 1, 0, 4, 2, 820, 0, 258236ULL, 0, 12037652636, 665, 12037652649, 665, 1, 65534ULL, 12037652681, 665, 2, 0, 1, 0, 12037652637, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652638, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652639, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652640, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652636, 665, 1, 65535ULL, 12037652668, 665, 2, 0, 1, 0, 3, 2, 821, 0, 262140ULL, 0, 12037652637, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652638, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652639, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652640, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652641, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652642, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652643, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652637, 665, 1, 65535ULL, 12037652669, 665, 2, 0, 1, 0, 4, 2, 822, 0, 262136ULL, 0, 12037652638, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652639, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652640, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652641, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652642, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652638, 665, 1, 65535ULL, 12037652670, 665, 2, 0, 1, 0, 3, 2, 823, 0, 262140ULL, 0, 12037652639, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652640, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652641, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652642, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652643, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652639, 665, 1, 65535ULL, 12037652671, 665, 2, 0, 1, 0, 4, 2, 824, 0, 262140ULL, 0, 12037652640, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652641, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652642, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652643, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652644, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652640, 665, 1, 65535ULL, 12037652672, 665, 2, 0, 1, 0, 3, 2, 825, 0, 262140ULL, 0, 12037652641, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652642, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652643, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652644, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652645, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652641, 665, 1, 65535ULL, 12037652673, 665, 2, 0, 1, 0, 4, 2, 826, 0, 262140ULL, 0, 12037652642, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652643, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652644, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652645, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652646, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652642, 665, 1, 65535ULL, 12037652674, 665, 2, 0, 1, 0, 3, 2, 827, 0, 262140ULL, 0, 12037652643, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652644, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652645, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652646, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652647, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652643, 665, 1, 65535ULL, 12037652675, 665, 2, 0, 1, 0, 4, 2, 828, 0, 262140ULL, 0, 12037652644, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652645, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652646, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652647, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652648, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652644, 665, 1, 65535ULL, 12037652676, 665, 2, 0, 1, 0, 3, 2, 829, 0, 262140ULL, 0, 12037652645, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652646, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652647, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652648, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 4, 3, 2, 0, 12037652649, 665, 12037652645, 665, 1, 65535ULL, 12037652677, 665, 2, 0, 1, 0, 4, 2, 830, 0, 262140ULL, 0, 12037652646, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652647, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652648, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 3, 4, 2, 0, 12037652649, 665, 12037652646, 665, 1, 65535ULL, 12037652678, 665, 2, 0, 1, 0, 3, 2, 831, 0, 262140ULL, 0, 12037652647, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652648, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 4, 2, 3, 0, 12037652649, 665, 12037652647, 665, 1, 65535ULL, 12037652679, 665, 2, 0, 1, 0, 4, 2, 832, 0, 262140ULL, 0, 12037652648, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 0, 12037652649, 665, 12037652648, 665, 1, 65535ULL, 12037652680, 665, 3, 0, 1, 0, 2, 3, 833, 0, 262140ULL, 0, 12037652649, 665, 12037652649, 665, 1, 65535ULL, 12037652681, 665, 2, 0, 1, 834, 2, 262140ULL, 835, 18446744069414322181ULL, 0, 12037652634, 665, 12037652538, 665, 1, 12037652634, 665, 12037652602, 665, 2, 0, 1, 0, 64559ULL, 12037652682, 665, 1, 2, 0, 0, 1, 12037652554, 665, 836, 0, 12037652618, 665, 0, 12037652634, 665, 12037652539, 665, 1, 12037652634, 665, 12037652603, 665, 2, 0, 1, 0, 64559ULL, 12037652683, 665, 3, 2, 0, 0, 12037652635, 665, 12037652538, 665, 1, 12037652635, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652555, 665, 837, 1, 12037652619, 665, 0, 12037652634, 665, 12037652540, 665, 1, 12037652634, 665, 12037652604, 665, 2, 0, 1, 0, 64559ULL, 12037652684, 665, 3, 2, 0, 0, 12037652635, 665, 12037652539, 665, 1, 12037652635, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652538, 665, 1, 12037652636, 665, 12037652602, 665, 2, 0, 1, 0, 65534ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652556, 665, 838, 1, 12037652620, 665, 0, 12037652634, 665, 12037652541, 665, 1, 12037652634, 665, 12037652605, 665, 2, 0, 1, 0, 64559ULL, 12037652685, 665, 3, 2, 0, 0, 12037652635, 665, 12037652540, 665, 1, 12037652635, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652539, 665, 1, 12037652636, 665, 12037652603, 665, 2, 0, 1, 0, 65534ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652538, 665, 1, 12037652637, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652557, 665, 839, 1, 12037652621, 665, 0, 12037652634, 665, 12037652542, 665, 1, 12037652634, 665, 12037652606, 665, 2, 0, 1, 0, 64559ULL, 12037652686, 665, 3, 2, 0, 0, 12037652635, 665, 12037652541, 665, 1, 12037652635, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652540, 665, 1, 12037652636, 665, 12037652604, 665, 2, 0, 1, 0, 65534ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652539, 665, 1, 12037652637, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652538, 665, 1, 12037652638, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652558, 665, 840, 1, 12037652622, 665, 0, 12037652634, 665, 12037652543, 665, 1, 12037652634, 665, 12037652607, 665, 2, 0, 1, 0, 64559ULL, 12037652687, 665, 3, 2, 0, 0, 12037652635, 665, 12037652542, 665, 1, 12037652635, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652541, 665, 1, 12037652636, 665, 12037652605, 665, 2, 0, 1, 0, 65534ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652540, 665, 1, 12037652637, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652539, 665, 1, 12037652638, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652538, 665, 1, 12037652639, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652559, 665, 841, 1, 12037652623, 665, 0, 12037652634, 665, 12037652544, 665, 1, 12037652634, 665, 12037652608, 665, 2, 0, 1, 0, 64559ULL, 12037652688, 665, 3, 2, 0, 0, 12037652635, 665, 12037652543, 665, 1, 12037652635, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652542, 665, 1, 12037652636, 665, 12037652606, 665, 2, 0, 1, 0, 65534ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652541, 665, 1, 12037652637, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652540, 665, 1, 12037652638, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652539, 665, 1, 12037652639, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652538, 665, 1, 12037652640, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652560, 665, 842, 1, 12037652624, 665, 0, 12037652634, 665, 12037652545, 665, 1, 12037652634, 665, 12037652609, 665, 2, 0, 1, 0, 64559ULL, 12037652689, 665, 3, 2, 0, 0, 12037652635, 665, 12037652544, 665, 1, 12037652635, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652543, 665, 1, 12037652636, 665, 12037652607, 665, 2, 0, 1, 0, 65534ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652542, 665, 1, 12037652637, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652541, 665, 1, 12037652638, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652540, 665, 1, 12037652639, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652539, 665, 1, 12037652640, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652538, 665, 1, 12037652641, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652561, 665, 843, 1, 12037652625, 665, 0, 12037652634, 665, 12037652546, 665, 1, 12037652634, 665, 12037652610, 665, 2, 0, 1, 0, 64559ULL, 12037652690, 665, 3, 2, 0, 0, 12037652635, 665, 12037652545, 665, 1, 12037652635, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652544, 665, 1, 12037652636, 665, 12037652608, 665, 2, 0, 1, 0, 65534ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652543, 665, 1, 12037652637, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652542, 665, 1, 12037652638, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652541, 665, 1, 12037652639, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652540, 665, 1, 12037652640, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652539, 665, 1, 12037652641, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652538, 665, 1, 12037652642, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652562, 665, 844, 1, 12037652626, 665, 0, 12037652634, 665, 12037652547, 665, 1, 12037652634, 665, 12037652611, 665, 2, 0, 1, 0, 64559ULL, 12037652691, 665, 3, 2, 0, 0, 12037652635, 665, 12037652546, 665, 1, 12037652635, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652545, 665, 1, 12037652636, 665, 12037652609, 665, 2, 0, 1, 0, 65534ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652544, 665, 1, 12037652637, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652543, 665, 1, 12037652638, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652542, 665, 1, 12037652639, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652541, 665, 1, 12037652640, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652540, 665, 1, 12037652641, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652539, 665, 1, 12037652642, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652538, 665, 1, 12037652643, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652563, 665, 845, 1, 12037652627, 665, 0, 12037652634, 665, 12037652548, 665, 1, 12037652634, 665, 12037652612, 665, 2, 0, 1, 0, 64559ULL, 12037652692, 665, 3, 2, 0, 0, 12037652635, 665, 12037652547, 665, 1, 12037652635, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652546, 665, 1, 12037652636, 665, 12037652610, 665, 2, 0, 1, 0, 65534ULL, 12037652690, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652545, 665, 1, 12037652637, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652544, 665, 1, 12037652638, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652543, 665, 1, 12037652639, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652542, 665, 1, 12037652640, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652541, 665, 1, 12037652641, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652540, 665, 1, 12037652642, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652539, 665, 1, 12037652643, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652538, 665, 1, 12037652644, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652564, 665, 846, 1, 12037652628, 665, 0, 12037652634, 665, 12037652549, 665, 1, 12037652634, 665, 12037652613, 665, 2, 0, 1, 0, 64559ULL, 12037652693, 665, 3, 2, 0, 0, 12037652635, 665, 12037652548, 665, 1, 12037652635, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652547, 665, 1, 12037652636, 665, 12037652611, 665, 2, 0, 1, 0, 65534ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652546, 665, 1, 12037652637, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652545, 665, 1, 12037652638, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652544, 665, 1, 12037652639, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652543, 665, 1, 12037652640, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652542, 665, 1, 12037652641, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652541, 665, 1, 12037652642, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652540, 665, 1, 12037652643, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652539, 665, 1, 12037652644, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652538, 665, 1, 12037652645, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652565, 665, 847, 1, 12037652629, 665, 0, 12037652634, 665, 12037652550, 665, 1, 12037652634, 665, 12037652614, 665, 2, 0, 1, 0, 64559ULL, 12037652694, 665, 3, 2, 0, 0, 12037652635, 665, 12037652549, 665, 1, 12037652635, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652548, 665, 1, 12037652636, 665, 12037652612, 665, 2, 0, 1, 0, 65534ULL, 12037652692, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652547, 665, 1, 12037652637, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652546, 665, 1, 12037652638, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652545, 665, 1, 12037652639, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652544, 665, 1, 12037652640, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652543, 665, 1, 12037652641, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652542, 665, 1, 12037652642, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652541, 665, 1, 12037652643, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652540, 665, 1, 12037652644, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652539, 665, 1, 12037652645, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652538, 665, 1, 12037652646, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652566, 665, 848, 1, 12037652630, 665, 0, 12037652634, 665, 12037652551, 665, 1, 12037652634, 665, 12037652615, 665, 2, 0, 1, 0, 64559ULL, 12037652695, 665, 3, 2, 0, 0, 12037652635, 665, 12037652550, 665, 1, 12037652635, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652549, 665, 1, 12037652636, 665, 12037652613, 665, 2, 0, 1, 0, 65534ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652548, 665, 1, 12037652637, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652547, 665, 1, 12037652638, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652546, 665, 1, 12037652639, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652545, 665, 1, 12037652640, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652544, 665, 1, 12037652641, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652543, 665, 1, 12037652642, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652542, 665, 1, 12037652643, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652541, 665, 1, 12037652644, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652540, 665, 1, 12037652645, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652539, 665, 1, 12037652646, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652538, 665, 1, 12037652647, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652567, 665, 849, 1, 12037652631, 665, 0, 12037652634, 665, 12037652552, 665, 1, 12037652634, 665, 12037652616, 665, 2, 0, 1, 0, 64559ULL, 12037652696, 665, 3, 2, 0, 0, 12037652635, 665, 12037652551, 665, 1, 12037652635, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652550, 665, 1, 12037652636, 665, 12037652614, 665, 2, 0, 1, 0, 65534ULL, 12037652694, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652549, 665, 1, 12037652637, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652548, 665, 1, 12037652638, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652547, 665, 1, 12037652639, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652546, 665, 1, 12037652640, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652545, 665, 1, 12037652641, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652544, 665, 1, 12037652642, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652543, 665, 1, 12037652643, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652542, 665, 1, 12037652644, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652541, 665, 1, 12037652645, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652540, 665, 1, 12037652646, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652539, 665, 1, 12037652647, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652538, 665, 1, 12037652648, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 4, 1, 1, 0, 12037652568, 665, 850, 1, 12037652632, 665, 0, 12037652634, 665, 12037652553, 665, 1, 12037652634, 665, 12037652617, 665, 2, 0, 1, 0, 64559ULL, 12037652697, 665, 3, 2, 0, 0, 12037652635, 665, 12037652552, 665, 1, 12037652635, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652636, 665, 12037652551, 665, 1, 12037652636, 665, 12037652615, 665, 2, 0, 1, 0, 65534ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652637, 665, 12037652550, 665, 1, 12037652637, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652549, 665, 1, 12037652638, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652548, 665, 1, 12037652639, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652547, 665, 1, 12037652640, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652546, 665, 1, 12037652641, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652545, 665, 1, 12037652642, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652544, 665, 1, 12037652643, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652543, 665, 1, 12037652644, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652542, 665, 1, 12037652645, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652541, 665, 1, 12037652646, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652540, 665, 1, 12037652647, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652539, 665, 1, 12037652648, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652538, 665, 1, 12037652649, 665, 12037652602, 665, 2, 0, 1, 0, 65535ULL, 12037652682, 665, 1, 2, 0, 0, 3, 1, 1, 0, 12037652569, 665, 851, 1, 12037652633, 665, 0, 12037652635, 665, 12037652553, 665, 1, 12037652635, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652636, 665, 12037652552, 665, 1, 12037652636, 665, 12037652616, 665, 2, 0, 1, 0, 65534ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652637, 665, 12037652551, 665, 1, 12037652637, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652638, 665, 12037652550, 665, 1, 12037652638, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652549, 665, 1, 12037652639, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652548, 665, 1, 12037652640, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652547, 665, 1, 12037652641, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652546, 665, 1, 12037652642, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652545, 665, 1, 12037652643, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652544, 665, 1, 12037652644, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652543, 665, 1, 12037652645, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652542, 665, 1, 12037652646, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652541, 665, 1, 12037652647, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652540, 665, 1, 12037652648, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652539, 665, 1, 12037652649, 665, 12037652603, 665, 2, 0, 1, 0, 65535ULL, 12037652683, 665, 1, 2, 0, 0, 4, 1, 852, 0, 258236ULL, 0, 12037652636, 665, 12037652553, 665, 1, 12037652636, 665, 12037652617, 665, 2, 0, 1, 0, 65534ULL, 12037652697, 665, 3, 2, 0, 0, 12037652637, 665, 12037652552, 665, 1, 12037652637, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652638, 665, 12037652551, 665, 1, 12037652638, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652639, 665, 12037652550, 665, 1, 12037652639, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652549, 665, 1, 12037652640, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652548, 665, 1, 12037652641, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652547, 665, 1, 12037652642, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652546, 665, 1, 12037652643, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652545, 665, 1, 12037652644, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652544, 665, 1, 12037652645, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652543, 665, 1, 12037652646, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652542, 665, 1, 12037652647, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652541, 665, 1, 12037652648, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652540, 665, 1, 12037652649, 665, 12037652604, 665, 2, 0, 1, 0, 65535ULL, 12037652684, 665, 1, 2, 0, 0, 3, 1, 853, 0, 262140ULL, 0, 12037652637, 665, 12037652553, 665, 1, 12037652637, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652638, 665, 12037652552, 665, 1, 12037652638, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652639, 665, 12037652551, 665, 1, 12037652639, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652640, 665, 12037652550, 665, 1, 12037652640, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652549, 665, 1, 12037652641, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652548, 665, 1, 12037652642, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652547, 665, 1, 12037652643, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652546, 665, 1, 12037652644, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652545, 665, 1, 12037652645, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652544, 665, 1, 12037652646, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652543, 665, 1, 12037652647, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652542, 665, 1, 12037652648, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652541, 665, 1, 12037652649, 665, 12037652605, 665, 2, 0, 1, 0, 65535ULL, 12037652685, 665, 1, 2, 0, 0, 4, 1, 854, 0, 262136ULL, 0, 12037652638, 665, 12037652553, 665, 1, 12037652638, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652639, 665, 12037652552, 665, 1, 12037652639, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652640, 665, 12037652551, 665, 1, 12037652640, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652641, 665, 12037652550, 665, 1, 12037652641, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652549, 665, 1, 12037652642, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652548, 665, 1, 12037652643, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652547, 665, 1, 12037652644, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652546, 665, 1, 12037652645, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652545, 665, 1, 12037652646, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652544, 665, 1, 12037652647, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652543, 665, 1, 12037652648, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652542, 665, 1, 12037652649, 665, 12037652606, 665, 2, 0, 1, 0, 65535ULL, 12037652686, 665, 1, 2, 0, 0, 3, 1, 855, 0, 262140ULL, 0, 12037652639, 665, 12037652553, 665, 1, 12037652639, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652640, 665, 12037652552, 665, 1, 12037652640, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652641, 665, 12037652551, 665, 1, 12037652641, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652642, 665, 12037652550, 665, 1, 12037652642, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652549, 665, 1, 12037652643, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652548, 665, 1, 12037652644, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652547, 665, 1, 12037652645, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652546, 665, 1, 12037652646, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652545, 665, 1, 12037652647, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652544, 665, 1, 12037652648, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652543, 665, 1, 12037652649, 665, 12037652607, 665, 2, 0, 1, 0, 65535ULL, 12037652687, 665, 1, 2, 0, 0, 4, 1, 856, 0, 262140ULL, 0, 12037652640, 665, 12037652553, 665, 1, 12037652640, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652641, 665, 12037652552, 665, 1, 12037652641, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652642, 665, 12037652551, 665, 1, 12037652642, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652643, 665, 12037652550, 665, 1, 12037652643, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652549, 665, 1, 12037652644, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652548, 665, 1, 12037652645, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652547, 665, 1, 12037652646, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652546, 665, 1, 12037652647, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652545, 665, 1, 12037652648, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652544, 665, 1, 12037652649, 665, 12037652608, 665, 2, 0, 1, 0, 65535ULL, 12037652688, 665, 1, 2, 0, 0, 3, 1, 857, 0, 262140ULL, 0, 12037652641, 665, 12037652553, 665, 1, 12037652641, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652642, 665, 12037652552, 665, 1, 12037652642, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652643, 665, 12037652551, 665, 1, 12037652643, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652644, 665, 12037652550, 665, 1, 12037652644, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652549, 665, 1, 12037652645, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652548, 665, 1, 12037652646, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652547, 665, 1, 12037652647, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652546, 665, 1, 12037652648, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652545, 665, 1, 12037652649, 665, 12037652609, 665, 2, 0, 1, 0, 65535ULL, 12037652689, 665, 1, 2, 0, 0, 4, 1, 858, 0, 262140ULL, 0, 12037652642, 665, 12037652553, 665, 1, 12037652642, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652643, 665, 12037652552, 665, 1, 12037652643, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652644, 665, 12037652551, 665, 1, 12037652644, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652645, 665, 12037652550, 665, 1, 12037652645, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652549, 665, 1, 12037652646, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652548, 665, 1, 12037652647, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652547, 665, 1, 12037652648, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652546, 665, 1, 12037652649, 665, 12037652610, 665, 2, 0, 1, 0, 65535ULL, 12037652690, 665, 1, 2, 0, 0, 3, 1, 859, 0, 262140ULL, 0, 12037652643, 665, 12037652553, 665, 1, 12037652643, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652644, 665, 12037652552, 665, 1, 12037652644, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652645, 665, 12037652551, 665, 1, 12037652645, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652646, 665, 12037652550, 665, 1, 12037652646, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652549, 665, 1, 12037652647, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652548, 665, 1, 12037652648, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652547, 665, 1, 12037652649, 665, 12037652611, 665, 2, 0, 1, 0, 65535ULL, 12037652691, 665, 1, 2, 0, 0, 4, 1, 860, 0, 262140ULL, 0, 12037652644, 665, 12037652553, 665, 1, 12037652644, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652645, 665, 12037652552, 665, 1, 12037652645, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652646, 665, 12037652551, 665, 1, 12037652646, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652647, 665, 12037652550, 665, 1, 12037652647, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652549, 665, 1, 12037652648, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652548, 665, 1, 12037652649, 665, 12037652612, 665, 2, 0, 1, 0, 65535ULL, 12037652692, 665, 1, 2, 0, 0, 3, 1, 861, 0, 262140ULL, 0, 12037652645, 665, 12037652553, 665, 1, 12037652645, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652646, 665, 12037652552, 665, 1, 12037652646, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652647, 665, 12037652551, 665, 1, 12037652647, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652648, 665, 12037652550, 665, 1, 12037652648, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652549, 665, 1, 12037652649, 665, 12037652613, 665, 2, 0, 1, 0, 65535ULL, 12037652693, 665, 1, 2, 0, 0, 4, 1, 862, 0, 262140ULL, 0, 12037652646, 665, 12037652553, 665, 1, 12037652646, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652647, 665, 12037652552, 665, 1, 12037652647, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652648, 665, 12037652551, 665, 1, 12037652648, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 3, 4, 1, 0, 12037652649, 665, 12037652550, 665, 1, 12037652649, 665, 12037652614, 665, 2, 0, 1, 0, 65535ULL, 12037652694, 665, 1, 2, 0, 0, 3, 1, 863, 0, 262140ULL, 0, 12037652647, 665, 12037652553, 665, 1, 12037652647, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652648, 665, 12037652552, 665, 1, 12037652648, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 4, 3, 1, 0, 12037652649, 665, 12037652551, 665, 1, 12037652649, 665, 12037652615, 665, 2, 0, 1, 0, 65535ULL, 12037652695, 665, 1, 2, 0, 0, 4, 1, 864, 0, 262140ULL, 0, 12037652648, 665, 12037652553, 665, 1, 12037652648, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 3, 2, 0, 0, 12037652649, 665, 12037652552, 665, 1, 12037652649, 665, 12037652616, 665, 2, 0, 1, 0, 65535ULL, 12037652696, 665, 1, 2, 0, 0, 3, 1, 865, 0, 262140ULL, 0, 12037652649, 665, 12037652553, 665, 1, 12037652649, 665, 12037652617, 665, 2, 0, 1, 0, 65535ULL, 12037652697, 665, 1, 2, 0, 866, 1, 262140ULL, 867, 18446744069414322181ULL, 868, 12037652747, 665, 126, 869, 25341984776, 371, 25341984776, 371, 870, 12037652748, 665, 127, 871, 25341984778, 371, 25341984778, 371, 872, 12037652749, 665, 128, 873, 25341984780, 371, 25341984780, 371, 874, 12037652750, 665, 129, 875, 25341984782, 371, 25341984782, 371, 876, 12037652751, 665, 130, 877, 25341984784, 371, 25341984784, 371, 878, 12037652752, 665, 131, 879, 25341984786, 371, 25341984786, 371, 880, 12037652753, 665, 132, 881, 25341984788, 371, 25341984788, 371, 882, 12037652754, 665, 133, 883, 25341984790, 371, 25341984790, 371, 884, 12037652755, 665, 134, 885, 25341984792, 371, 25341984792, 371, 886, 12037652756, 665, 135, 887, 25341984794, 371, 25341984794, 371, 888, 12037652757, 665, 136, 889, 25341984796, 371, 25341984796, 371, 890, 12037652758, 665, 137, 891, 25341984798, 371, 25341984798, 371, 0, 25341984777, 371, 868, 892, 0, 2, 25341984779, 371, 870, 0, 870, 2, 1, 125, 0, 893, 1, 2, 2, 25341984781, 371, 872, 0, 872, 2, 1, 125, 0, 894, 1, 2, 2, 25341984783, 371, 874, 0, 874, 2, 1, 125, 0, 895, 1, 2, 2, 25341984785, 371, 876, 0, 876, 2, 1, 125, 0, 896, 1, 2, 2, 25341984787, 371, 878, 0, 878, 2, 1, 125, 0, 897, 1, 2, 2, 25341984789, 371, 880, 0, 880, 2, 1, 125, 0, 898, 1, 2, 2, 25341984791, 371, 882, 0, 882, 2, 1, 125, 0, 899, 1, 2, 2, 25341984793, 371, 884, 0, 884, 2, 1, 125, 0, 900, 1, 2, 2, 25341984795, 371, 886, 0, 886, 2, 1, 125, 0, 901, 1, 2, 2, 25341984797, 371, 888, 0, 888, 2, 1, 125, 0, 902, 1, 2, 2, 25341984799, 371, 890, 0, 890, 2, 1, 125, 0, 903, 1, 2, 0, 2ULL, 12037652909, 665, 1, 0, 12037652908, 665, 0, 12037652909, 665, 1, 1, 12037652911, 665, 0, 906, 1, 12037652908, 665, 908, 12037652959, 2, 16777216, 665, 12037652960, 2, 16777216, 665, 0, 12037653079, 665, 12037653009, 665, 1, 12037653080, 665, 12037653023, 665, 2, 0, 1, 3, 2, 12037653075, 665, 0, 12037653081, 665, 12037653018, 665, 1, 262144ULL, 0, 0, 65536ULL, 12037653077, 665, 2, 1, 0, 0, 12037653077, 665, 12037653019, 665, 1, 2, 0, 0, 131072ULL, 12037653078, 665, 2, 1, 0, 910, 2, 3, 914, 101, 101, 102, 102, 103, 103, 104, 104, 105, 105, 106, 106, 107, 107, 108, 108, 12037652785, 665, 915, 12037652786, 665, 916, 12037652787, 665, 917, 12037652788, 665, 918, 12037652781, 665, 919, 12037652782, 665, 920, 12037652783, 665, 921, 12037652784, 665, 0, 12037652747, 665, 1, 12037652748, 665, 2, 12037652749, 665, 3, 12037652750, 665, 4, 12037652751, 665, 5, 12037652752, 665, 6, 12037652753, 665, 7, 12037652754, 665, 8, 12037652755, 665, 9, 12037652756, 665, 10, 12037652757, 665, 11, 12037652758, 665, 12, 12037652759, 665, 13, 12037652760, 665, 14, 12037652761, 665, 15, 12037652762, 665, 16, 123, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 115, 1, 1, 922, 146, 0, 12037652957, 2, 16777216, 665, 12037652957, 665, 1, 12037652958, 2, 16777216, 665, 12037652958, 665, 2, 0, 1, 0, 12037652969, 665, 2, 1, 12037652958, 2, 16777216, 665, 12037652958, 665, 923, 0, 1, 924, 109, 109, 910, 926, 12037653024, 665, 0, 12037653001, 665, 12037653093, 665, 927, 0, 12037653094, 665, 928, 909, 929, 113, 930, 114, 931, 115, 932, 116, 933, 117, 934, 118, 935, 119, 2, 12037652922, 665, 0, 12037652928, 665, 12037652923, 665, 1, 0, 12037652939, 665, 0, 1, 1ULL, 1, 12037652939, 665, 3, 25341984827, 371, 4, 25341984828, 371, 5, 25341984829, 371, 6, 25341984830, 371, 7, 25341984831, 371, 8, 25341984832, 371, 9, 25341984833, 371, 10, 25341984834, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984842, 371, 0, 147, 1, 1, 936, 12037653093, 665, 12037653094, 665, 937, 910, 938, 12037653024, 665, 0, 12037653001, 665, 12037653097, 665, 939, 0, 12037653098, 665, 940, 909, 941, 113, 942, 114, 943, 115, 944, 116, 945, 117, 946, 118, 947, 119, 2, 12037652775, 665, 0, 12037652790, 665, 12037652776, 665, 1, 0, 12037652792, 665, 0, 1, 1ULL, 1, 12037652792, 665, 3, 25341984814, 371, 4, 25341984815, 371, 5, 25341984816, 371, 6, 25341984817, 371, 7, 25341984818, 371, 8, 25341984819, 371, 9, 25341984820, 371, 10, 25341984821, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984843, 371, 0, 149, 1, 1, 948, 12037653097, 665, 12037653098, 665, 0, 12037652481, 665, 1, 12037652480, 665, 0, 0, 0, 99, 1, 0, 0, 3, 1, 2, 0, 0, 0, 101, 1, 0, 0, 3, 2, 16777216, 1, 2, 2, 16777216, 0, 0, 0, 100, 1, 0, 0, 46, 1, 12037652534, 2, 16777216, 665, 2, 12037652483, 2, 16777216, 665, 3, 12037652484, 2, 16777216, 665, 4, 12037652525, 665, 5, 12037652482, 665, 6, 12037652526, 665, 7, 12037652527, 665, 8, 12037652528, 665, 9, 12037652529, 665, 10, 12037652530, 665, 11, 12037652531, 665, 12, 12037652532, 665, 13, 12037652533, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 102, 13, 0, 0, 46, 1, 103, 2, 101, 3, 102, 4, 104, 5, 84, 6, 93, 7, 94, 8, 95, 9, 96, 10, 97, 11, 98, 12, 99, 13, 100, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 104, 13, 0, 0, 46, 2, 16777216, 1, 103, 2, 16777216, 2, 101, 2, 16777216, 3, 102, 2, 16777216, 4, 104, 2, 16777216, 5, 84, 2, 16777216, 6, 93, 2, 16777216, 7, 94, 2, 16777216, 8, 95, 2, 16777216, 9, 96, 2, 16777216, 10, 97, 2, 16777216, 11, 98, 2, 16777216, 12, 99, 2, 16777216, 13, 100, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 103, 13, 0, 0, 12037652538, 665, 5, 1, 12037652539, 665, 6, 2, 0, 1, 0, 12037652540, 665, 7, 1, 2, 0, 0, 12037652541, 665, 8, 2, 1, 0, 0, 12037652542, 665, 9, 1, 2, 0, 0, 12037652543, 665, 10, 2, 1, 0, 0, 12037652544, 665, 11, 1, 2, 0, 0, 12037652545, 665, 12, 2, 1, 0, 0, 12037652546, 665, 13, 1, 2, 0, 0, 12037652547, 665, 14, 2, 1, 0, 0, 12037652548, 665, 15, 1, 2, 0, 0, 12037652549, 665, 16, 2, 1, 0, 0, 12037652550, 665, 17, 1, 2, 0, 0, 12037652551, 665, 18, 2, 1, 0, 0, 12037652552, 665, 19, 1, 2, 0, 0, 12037652553, 665, 20, 2, 1, 0, 0, 12037652554, 665, 21, 1, 2, 0, 0, 12037652555, 665, 22, 2, 1, 0, 0, 12037652556, 665, 23, 1, 2, 0, 0, 12037652557, 665, 24, 2, 1, 0, 0, 12037652558, 665, 25, 1, 2, 0, 0, 12037652559, 665, 26, 2, 1, 0, 0, 12037652560, 665, 27, 1, 2, 0, 0, 12037652561, 665, 28, 2, 1, 0, 0, 12037652562, 665, 29, 1, 2, 0, 0, 12037652563, 665, 30, 2, 1, 0, 0, 12037652564, 665, 31, 1, 2, 0, 0, 12037652565, 665, 32, 2, 1, 0, 0, 12037652566, 665, 33, 1, 2, 0, 0, 12037652567, 665, 34, 2, 1, 0, 0, 12037652568, 665, 35, 1, 2, 0, 0, 12037652569, 665, 36, 2, 1, 0, 949, 2, 0, 4, 951, 0, 0, 4, 2, 16777216, 950, 0, 0, 12037652570, 665, 5, 1, 12037652571, 665, 6, 2, 0, 1, 0, 12037652572, 665, 7, 1, 2, 0, 0, 12037652573, 665, 8, 2, 1, 0, 0, 12037652574, 665, 9, 1, 2, 0, 0, 12037652575, 665, 10, 2, 1, 0, 0, 12037652576, 665, 11, 1, 2, 0, 0, 12037652577, 665, 12, 2, 1, 0, 0, 12037652578, 665, 13, 1, 2, 0, 0, 12037652579, 665, 14, 2, 1, 0, 0, 12037652580, 665, 15, 1, 2, 0, 0, 12037652581, 665, 16, 2, 1, 0, 0, 12037652582, 665, 17, 1, 2, 0, 0, 12037652583, 665, 18, 2, 1, 0, 0, 12037652584, 665, 19, 1, 2, 0, 0, 12037652585, 665, 20, 2, 1, 0, 0, 12037652586, 665, 21, 1, 2, 0, 0, 12037652587, 665, 22, 2, 1, 0, 0, 12037652588, 665, 23, 1, 2, 0, 0, 12037652589, 665, 24, 2, 1, 0, 0, 12037652590, 665, 25, 1, 2, 0, 0, 12037652591, 665, 26, 2, 1, 0, 0, 12037652592, 665, 27, 1, 2, 0, 0, 12037652593, 665, 28, 2, 1, 0, 0, 12037652594, 665, 29, 1, 2, 0, 0, 12037652595, 665, 30, 2, 1, 0, 0, 12037652596, 665, 31, 1, 2, 0, 0, 12037652597, 665, 32, 2, 1, 0, 0, 12037652598, 665, 33, 1, 2, 0, 0, 12037652599, 665, 34, 2, 1, 0, 0, 12037652600, 665, 35, 1, 2, 0, 0, 12037652601, 665, 36, 2, 1, 0, 952, 2, 0, 4, 954, 0, 0, 4, 2, 16777216, 953, 0, 0, 12037652602, 665, 5, 1, 12037652603, 665, 6, 2, 0, 1, 0, 12037652604, 665, 7, 1, 2, 0, 0, 12037652605, 665, 8, 2, 1, 0, 0, 12037652606, 665, 9, 1, 2, 0, 0, 12037652607, 665, 10, 2, 1, 0, 0, 12037652608, 665, 11, 1, 2, 0, 0, 12037652609, 665, 12, 2, 1, 0, 0, 12037652610, 665, 13, 1, 2, 0, 0, 12037652611, 665, 14, 2, 1, 0, 0, 12037652612, 665, 15, 1, 2, 0, 0, 12037652613, 665, 16, 2, 1, 0, 0, 12037652614, 665, 17, 1, 2, 0, 0, 12037652615, 665, 18, 2, 1, 0, 0, 12037652616, 665, 19, 1, 2, 0, 0, 12037652617, 665, 20, 2, 1, 0, 0, 12037652618, 665, 21, 1, 2, 0, 0, 12037652619, 665, 22, 2, 1, 0, 0, 12037652620, 665, 23, 1, 2, 0, 0, 12037652621, 665, 24, 2, 1, 0, 0, 12037652622, 665, 25, 1, 2, 0, 0, 12037652623, 665, 26, 2, 1, 0, 0, 12037652624, 665, 27, 1, 2, 0, 0, 12037652625, 665, 28, 2, 1, 0, 0, 12037652626, 665, 29, 1, 2, 0, 0, 12037652627, 665, 30, 2, 1, 0, 0, 12037652628, 665, 31, 1, 2, 0, 0, 12037652629, 665, 32, 2, 1, 0, 0, 12037652630, 665, 33, 1, 2, 0, 0, 12037652631, 665, 34, 2, 1, 0, 0, 12037652632, 665, 35, 1, 2, 0, 0, 12037652633, 665, 36, 2, 1, 0, 955, 2, 0, 4, 957, 0, 0, 4, 2, 16777216, 956, 0, 0, 12037652634, 665, 5, 1, 12037652635, 665, 6, 2, 0, 1, 0, 12037652636, 665, 7, 1, 2, 0, 0, 12037652637, 665, 8, 2, 1, 0, 0, 12037652638, 665, 9, 1, 2, 0, 0, 12037652639, 665, 10, 2, 1, 0, 0, 12037652640, 665, 11, 1, 2, 0, 0, 12037652641, 665, 12, 2, 1, 0, 0, 12037652642, 665, 13, 1, 2, 0, 0, 12037652643, 665, 14, 2, 1, 0, 0, 12037652644, 665, 15, 1, 2, 0, 0, 12037652645, 665, 16, 2, 1, 0, 0, 12037652646, 665, 17, 1, 2, 0, 0, 12037652647, 665, 18, 2, 1, 0, 0, 12037652648, 665, 19, 1, 2, 0, 0, 12037652649, 665, 20, 2, 1, 0, 0, 12037652650, 665, 21, 1, 2, 0, 0, 12037652651, 665, 22, 2, 1, 0, 0, 12037652652, 665, 23, 1, 2, 0, 0, 12037652653, 665, 24, 2, 1, 0, 0, 12037652654, 665, 25, 1, 2, 0, 0, 12037652655, 665, 26, 2, 1, 0, 0, 12037652656, 665, 27, 1, 2, 0, 0, 12037652657, 665, 28, 2, 1, 0, 0, 12037652658, 665, 29, 1, 2, 0, 0, 12037652659, 665, 30, 2, 1, 0, 0, 12037652660, 665, 31, 1, 2, 0, 0, 12037652661, 665, 32, 2, 1, 0, 0, 12037652662, 665, 33, 1, 2, 0, 0, 12037652663, 665, 34, 2, 1, 0, 0, 12037652664, 665, 35, 1, 2, 0, 0, 12037652666, 665, 36, 2, 1, 0, 958, 2, 0, 4, 960, 0, 0, 4, 2, 16777216, 959, 0, 0, 34, 35, 3, 0, 36, 0, 12037652667, 665, 5, 1, 12037652668, 665, 6, 2, 0, 1, 0, 12037652669, 665, 7, 1, 2, 0, 0, 12037652670, 665, 8, 2, 1, 0, 0, 12037652671, 665, 9, 1, 2, 0, 0, 12037652672, 665, 10, 2, 1, 0, 0, 12037652673, 665, 11, 1, 2, 0, 0, 12037652674, 665, 12, 2, 1, 0, 0, 12037652675, 665, 13, 1, 2, 0, 0, 12037652676, 665, 14, 2, 1, 0, 0, 12037652677, 665, 15, 1, 2, 0, 0, 12037652678, 665, 16, 2, 1, 0, 0, 12037652679, 665, 17, 1, 2, 0, 0, 12037652680, 665, 18, 2, 1, 0, 0, 12037652682, 665, 19, 1, 2, 0, 0, 12037652683, 665, 20, 2, 1, 0, 0, 12037652684, 665, 21, 1, 2, 0, 0, 12037652685, 665, 22, 2, 1, 0, 0, 12037652686, 665, 23, 1, 2, 0, 0, 12037652687, 665, 24, 2, 1, 0, 0, 12037652688, 665, 25, 1, 2, 0, 0, 12037652689, 665, 26, 2, 1, 0, 0, 12037652690, 665, 27, 1, 2, 0, 0, 12037652691, 665, 28, 2, 1, 0, 0, 12037652692, 665, 29, 1, 2, 0, 0, 12037652693, 665, 30, 2, 1, 0, 0, 12037652694, 665, 31, 1, 2, 0, 0, 12037652695, 665, 32, 2, 1, 0, 0, 12037652696, 665, 33, 1, 2, 0, 0, 12037652665, 665, 34, 2, 1, 0, 0, 12037652681, 665, 35, 1, 2, 0, 0, 12037652697, 665, 36, 2, 1, 0, 0, 3, 0, 105, 2, 0, 0, 106, 1, 105, 0, 0, 0, 107, 1, 0, 0, 106, 2, 16777216, 1, 105, 2, 16777216, 0, 0, 0, 106, 1, 0, 0, 12037652705, 665, 961, 0, 0, 107, 963, 0, 0, 107, 2, 16777216, 962, 0, 0, 12037652706, 665, 964, 0, 0, 107, 966, 0, 0, 107, 2, 16777216, 965, 0, 0, 12037652707, 665, 967, 0, 0, 107, 969, 0, 0, 107, 2, 16777216, 968, 0, 0, 0ULL, 1, 12037652738, 665, 2, 12037652708, 665, 3, 12037652710, 665, 4, 12037652739, 665, 5, 0ULL, 6, 12037652712, 665, 7, 12037652740, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 108, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 110, 7, 0, 0, 110, 2, 16777216, 1, 108, 2, 16777216, 2, 3, 2, 16777216, 3, 2, 2, 16777216, 4, 109, 2, 16777216, 5, 111, 2, 16777216, 6, 112, 2, 16777216, 7, 113, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 109, 7, 0, 0, 12037652746, 2, 16777216, 665, 12037652745, 2, 16777216, 665, 1, 12037652738, 665, 2, 12037652709, 665, 3, 12037652711, 665, 4, 12037652740, 665, 5, 12037652744, 665, 6, 12037652713, 665, 7, 12037652741, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 111, 7, 0, 0, 110, 1, 108, 2, 3, 3, 2, 4, 109, 5, 111, 6, 112, 7, 113, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 113, 7, 0, 0, 110, 2, 16777216, 1, 108, 2, 16777216, 2, 3, 2, 16777216, 3, 2, 2, 16777216, 4, 109, 2, 16777216, 5, 111, 2, 16777216, 6, 112, 2, 16777216, 7, 113, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 112, 7, 0, 0, 12037652774, 665, 970, 0, 0, 2, 972, 0, 0, 2, 2, 16777216, 971, 0, 0, 12037652747, 2, 16777216, 665, 1, 12037652748, 2, 16777216, 665, 2, 12037652749, 2, 16777216, 665, 3, 12037652750, 2, 16777216, 665, 4, 12037652751, 2, 16777216, 665, 5, 12037652752, 2, 16777216, 665, 6, 12037652753, 2, 16777216, 665, 7, 12037652754, 2, 16777216, 665, 8, 12037652755, 2, 16777216, 665, 9, 12037652756, 2, 16777216, 665, 10, 12037652757, 2, 16777216, 665, 11, 12037652758, 2, 16777216, 665, 12, 12037652759, 2, 16777216, 665, 13, 12037652760, 2, 16777216, 665, 14, 12037652761, 2, 16777216, 665, 15, 12037652762, 2, 16777216, 665, 16, 123, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 1, 1, 1, 16, 0, 114, 1, 1, 0, 12037652791, 665, 1, 12037652794, 665, 2, 12037652795, 665, 3, 12037652796, 665, 4, 12037652797, 665, 5, 12037652798, 665, 6, 12037652799, 665, 7, 12037652800, 665, 8, 12037652801, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 116, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 118, 8, 0, 0, 46, 2, 16777216, 1, 37, 2, 16777216, 2, 38, 2, 16777216, 3, 39, 2, 16777216, 4, 40, 2, 16777216, 5, 41, 2, 16777216, 6, 42, 2, 16777216, 7, 43, 2, 16777216, 8, 44, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 117, 8, 0, 0, 12037652877, 665, 1, 12037652878, 665, 2, 12037652880, 665, 3, 12037652879, 665, 4, 12037652881, 665, 5, 12037652882, 665, 6, 12037652883, 665, 7, 12037652884, 665, 8, 12037652885, 665, 9, 12037652886, 665, 10, 12037652887, 665, 11, 12037652888, 665, 12, 12037652889, 665, 13, 12037652890, 665, 14, 12037652891, 665, 15, 12037652855, 665, 16, 12037652864, 665, 17, 12037652857, 665, 18, 12037652856, 665, 19, 12037652861, 665, 20, 12037652862, 665, 21, 12037652863, 665, 22, 12037652860, 665, 23, 12037652858, 665, 24, 12037652859, 665, 25, 12037652865, 665, 26, 12037652866, 665, 27, 12037652867, 665, 28, 12037652876, 665, 29, 12037652869, 665, 30, 12037652868, 665, 31, 12037652873, 665, 32, 12037652875, 665, 33, 12037652874, 665, 34, 12037652872, 665, 35, 12037652871, 665, 36, 12037652870, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 119, 36, 0, 0, 148, 1, 149, 2, 150, 3, 151, 4, 152, 5, 153, 6, 154, 7, 155, 8, 156, 9, 157, 10, 158, 11, 159, 12, 160, 13, 161, 14, 162, 15, 163, 16, 164, 17, 165, 18, 166, 19, 167, 20, 168, 21, 169, 22, 170, 23, 171, 24, 172, 25, 173, 26, 174, 27, 175, 28, 176, 29, 177, 30, 178, 31, 179, 32, 180, 33, 181, 34, 182, 35, 183, 36, 184, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 121, 36, 0, 0, 148, 2, 16777216, 1, 149, 2, 16777216, 2, 150, 2, 16777216, 3, 151, 2, 16777216, 4, 152, 2, 16777216, 5, 153, 2, 16777216, 6, 154, 2, 16777216, 7, 155, 2, 16777216, 8, 156, 2, 16777216, 9, 157, 2, 16777216, 10, 158, 2, 16777216, 11, 159, 2, 16777216, 12, 160, 2, 16777216, 13, 161, 2, 16777216, 14, 162, 2, 16777216, 15, 163, 2, 16777216, 16, 164, 2, 16777216, 17, 165, 2, 16777216, 18, 166, 2, 16777216, 19, 167, 2, 16777216, 20, 168, 2, 16777216, 21, 169, 2, 16777216, 22, 170, 2, 16777216, 23, 171, 2, 16777216, 24, 172, 2, 16777216, 25, 173, 2, 16777216, 26, 174, 2, 16777216, 27, 175, 2, 16777216, 28, 176, 2, 16777216, 29, 177, 2, 16777216, 30, 178, 2, 16777216, 31, 179, 2, 16777216, 32, 180, 2, 16777216, 33, 181, 2, 16777216, 34, 182, 2, 16777216, 35, 183, 2, 16777216, 36, 184, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 120, 36, 0, 0, 188, 1, 12037652894, 665, 2, 12037652898, 665, 3, 12037652902, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 122, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 124, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 123, 3, 0, 0, 188, 1, 12037652895, 665, 2, 12037652899, 665, 3, 12037652903, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 125, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 127, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 126, 3, 0, 0, 188, 1, 12037652896, 665, 2, 12037652900, 665, 3, 12037652904, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 128, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 130, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 129, 3, 0, 0, 188, 1, 12037652897, 665, 2, 12037652901, 665, 3, 12037652905, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 131, 3, 0, 0, 189, 1, 190, 2, 191, 3, 192, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 133, 3, 0, 0, 189, 2, 16777216, 1, 190, 2, 16777216, 2, 191, 2, 16777216, 3, 192, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 132, 3, 0, 3, 25341984826, 371, 4, 212, 5, 12037652921, 665, 0, 12037652910, 665, 1, 195, 2, 12037652911, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 136, 2, 0, 0, 215, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 1, 136, 1, 0, 0, 134, 1, 136, 0, 12037652910, 2, 16777216, 665, 1, 195, 2, 16777216, 2, 12037652911, 2, 16777216, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 135, 2, 0, 9, 12037652929, 665, 10, 12037652930, 665, 11, 12037652931, 665, 12, 12037652932, 665, 13, 12037652933, 665, 14, 12037652934, 665, 15, 12037652935, 665, 16, 12037652936, 665, 17, 216, 0, 12037652912, 665, 1, 12037652913, 665, 2, 12037652914, 665, 3, 12037652915, 665, 4, 12037652916, 665, 5, 12037652917, 665, 6, 12037652918, 665, 7, 12037652919, 665, 8, 196, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 139, 8, 0, 0, 25341984825, 371, 0, 9, 0, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 1, 139, 1, 0, 0, 137, 1, 139, 0, 12037652912, 2, 16777216, 665, 1, 12037652913, 2, 16777216, 665, 2, 12037652914, 2, 16777216, 665, 3, 12037652915, 2, 16777216, 665, 4, 12037652916, 2, 16777216, 665, 5, 12037652917, 2, 16777216, 665, 6, 12037652918, 2, 16777216, 665, 7, 12037652919, 2, 16777216, 665, 8, 196, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 138, 8, 0, 0, 12037652938, 665, 1, 12037652941, 665, 2, 12037652942, 665, 3, 12037652943, 665, 4, 12037652944, 665, 5, 12037652945, 665, 6, 12037652946, 665, 7, 12037652947, 665, 8, 12037652948, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 140, 8, 0, 0, 46, 1, 37, 2, 38, 3, 39, 4, 40, 5, 41, 6, 42, 7, 43, 8, 44, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 142, 8, 0, 0, 46, 2, 16777216, 1, 37, 2, 16777216, 2, 38, 2, 16777216, 3, 39, 2, 16777216, 4, 40, 2, 16777216, 5, 41, 2, 16777216, 6, 42, 2, 16777216, 7, 43, 2, 16777216, 8, 44, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 141, 8, 0, 0, 12037653121, 665, 973, 0, 0, 45, 975, 0, 0, 45, 2, 16777216, 974, 0, 3, 12037653033, 665, 4, 12037653032, 665, 5, 12037653031, 665, 6, 12037653030, 665, 7, 12037653029, 665, 8, 12037653028, 665, 9, 12037653027, 665, 10, 12037653026, 665, 11, 12037653042, 665, 12, 12037653043, 665, 13, 12037653044, 665, 14, 12037653045, 665, 15, 12037653046, 665, 16, 12037653047, 665, 17, 12037653048, 665, 18, 12037653049, 665, 19, 12037653050, 665, 20, 12037653051, 665, 21, 12037653052, 665, 22, 12037653053, 665, 23, 12037653056, 665, 24, 12037653054, 665, 25, 12037653055, 665, 26, 12037653057, 665, 27, 12037653114, 665, 28, 12037653115, 665, 29, 12037653117, 665, 30, 12037653116, 665, 31, 12037653119, 665, 32, 12037653118, 665, 0, 1ULL, 12037653087, 665, 1, 2ULL, 12037653088, 665, 2, 0, 1, 0, 4ULL, 12037653089, 665, 1, 2, 0, 0, 8ULL, 12037653103, 665, 2, 1, 0, 0, 16ULL, 12037653101, 665, 1, 2, 0, 0, 32ULL, 12037653093, 665, 2, 1, 0, 0, 64ULL, 12037653096, 665, 1, 2, 0, 0, 128ULL, 12037653095, 665, 2, 1, 0, 0, 256ULL, 12037653097, 665, 1, 2, 0, 0, 512ULL, 12037653100, 665, 2, 1, 0, 0, 1024ULL, 12037653099, 665, 1, 2, 0, 0, 2048ULL, 12037653079, 665, 2, 1, 0, 0, 4096ULL, 12037653080, 665, 1, 2, 0, 0, 8192ULL, 12037653078, 665, 2, 1, 0, 0, 16384ULL, 12037653077, 665, 1, 2, 0, 0, 32768ULL, 12037653071, 665, 2, 1, 0, 0, 65536ULL, 12037653073, 665, 1, 2, 0, 0, 131072ULL, 12037653072, 665, 2, 1, 0, 0, 262144ULL, 12037653090, 665, 1, 2, 0, 0, 524288ULL, 12037653091, 665, 2, 1, 0, 0, 1048576ULL, 12037653092, 665, 1, 2, 0, 0, 2097152ULL, 12037653083, 665, 2, 1, 0, 0, 4194304ULL, 12037653084, 665, 1, 2, 0, 0, 8388608ULL, 12037653104, 665, 2, 1, 0, 0, 16777216ULL, 12037653058, 665, 1, 2, 0, 0, 33554432ULL, 12037653059, 665, 2, 1, 0, 0, 67108864ULL, 12037653060, 665, 1, 2, 0, 0, 134217728ULL, 12037653064, 665, 2, 1, 0, 0, 268435456ULL, 12037653061, 665, 1, 2, 0, 0, 536870912ULL, 12037653062, 665, 2, 1, 0, 0, 1073741824ULL, 12037653067, 665, 1, 2, 0, 0, 2147483648ULL, 12037653069, 665, 2, 1, 0, 0, 4294967296ULL, 12037653066, 665, 1, 2, 0, 0, 8589934592ULL, 12037653070, 665, 2, 1, 0, 0, 17179869184ULL, 12037653068, 665, 1, 2, 0, 0, 34359738368ULL, 12037653065, 665, 2, 1, 0, 0, 68719476736ULL, 12037653063, 665, 1, 2, 0, 0, 137438953472ULL, 12037653086, 665, 2, 1, 0, 0, 274877906944ULL, 12037653085, 665, 1, 2, 0, 0, 549755813888ULL, 12037653081, 665, 2, 1, 0, 0, 1099511627776ULL, 12037653135, 665, 1, 2, 0, 0, 2199023255552ULL, 12037653074, 665, 2, 1, 0, 0, 4398046511104ULL, 12037653105, 665, 1, 2, 0, 0, 8796093022208ULL, 12037653106, 665, 2, 1, 0, 0, 17592186044416ULL, 12037653094, 665, 1, 2, 0, 0, 35184372088832ULL, 12037653098, 665, 2, 1, 0, 0, 70368744177664ULL, 12037653136, 665, 1, 2, 0, 0, 1, 1, 12037653075, 665, 2, 12037653076, 665, 33, 12037653102, 665, 34, 12037653133, 665, 35, 12037653134, 665, 36, 12037653022, 665, 0, 3, 0, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 143, 36, 0, 0, 47, 1, 48, 2, 49, 3, 50, 4, 51, 5, 52, 6, 53, 7, 54, 8, 56, 9, 57, 10, 58, 11, 59, 12, 60, 13, 61, 14, 62, 15, 63, 16, 64, 17, 65, 18, 66, 19, 67, 20, 68, 21, 69, 22, 70, 23, 71, 24, 72, 25, 73, 26, 74, 27, 75, 28, 76, 29, 77, 30, 83, 31, 55, 32, 78, 33, 79, 34, 80, 35, 81, 36, 82, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 145, 36, 0, 0, 47, 2, 16777216, 1, 48, 2, 16777216, 2, 49, 2, 16777216, 3, 50, 2, 16777216, 4, 51, 2, 16777216, 5, 52, 2, 16777216, 6, 53, 2, 16777216, 7, 54, 2, 16777216, 8, 56, 2, 16777216, 9, 57, 2, 16777216, 10, 58, 2, 16777216, 11, 59, 2, 16777216, 12, 60, 2, 16777216, 13, 61, 2, 16777216, 14, 62, 2, 16777216, 15, 63, 2, 16777216, 16, 64, 2, 16777216, 17, 65, 2, 16777216, 18, 66, 2, 16777216, 19, 67, 2, 16777216, 20, 68, 2, 16777216, 21, 69, 2, 16777216, 22, 70, 2, 16777216, 23, 71, 2, 16777216, 24, 72, 2, 16777216, 25, 73, 2, 16777216, 26, 74, 2, 16777216, 27, 75, 2, 16777216, 28, 76, 2, 16777216, 29, 77, 2, 16777216, 30, 83, 2, 16777216, 31, 55, 2, 16777216, 32, 78, 2, 16777216, 33, 79, 2, 16777216, 34, 80, 2, 16777216, 35, 81, 2, 16777216, 36, 82, 2, 16777216, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 144, 36, 0, 2, 12037652922, 2, 16777216, 665, 0, 12037652928, 2, 16777216, 665, 12037652923, 2, 16777216, 665, 1, 0, 12037652939, 2, 16777216, 665, 0, 1, 1ULL, 1, 12037652939, 2, 16777216, 665, 3, 25341984827, 2, 16777216, 371, 4, 25341984828, 2, 16777216, 371, 5, 25341984829, 2, 16777216, 371, 6, 25341984830, 2, 16777216, 371, 7, 25341984831, 2, 16777216, 371, 8, 25341984832, 2, 16777216, 371, 9, 25341984833, 2, 16777216, 371, 10, 25341984834, 2, 16777216, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984842, 2, 16777216, 371, 0, 146, 1, 1, 2, 12037652775, 2, 16777216, 665, 0, 12037652790, 2, 16777216, 665, 12037652776, 2, 16777216, 665, 1, 0, 12037652792, 2, 16777216, 665, 0, 1, 1ULL, 1, 12037652792, 2, 16777216, 665, 3, 25341984814, 2, 16777216, 371, 4, 25341984815, 2, 16777216, 371, 5, 25341984816, 2, 16777216, 371, 6, 25341984817, 2, 16777216, 371, 7, 25341984818, 2, 16777216, 371, 8, 25341984819, 2, 16777216, 371, 9, 25341984820, 2, 16777216, 371, 10, 25341984821, 2, 16777216, 371, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 25341984843, 2, 16777216, 371, 0, 148, 1, 1, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 12037652814, 665, 4, 12037652815, 665, 5, 12037652816, 665, 6, 12037652817, 665, 7, 12037652818, 665, 8, 12037652819, 665, 9, 12037652820, 665, 10, 12037652821, 665, 11, 12037652878, 665, 12, 0ULL, 13, 0ULL, 14, 0ULL, 15, 905, 16, 110, 17, 111, 18, 112, 19, 12037652877, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 1, 1, 1, 19, 0, 150, 1, 1, 0, 909, 1, 113, 2, 114, 3, 115, 4, 116, 5, 117, 6, 118, 7, 119, 8, 12037653085, 665, 12037653100, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 1, 1, 1, 8, 0, 151, 1, 1, 0, 1ULL, 1, 0ULL, 2, 0ULL, 3, 0ULL, 4, 12037652977, 665, 5, 12037652976, 665, 6, 12037652975, 665, 7, 12037652974, 665, 8, 12037652973, 665, 9, 12037652972, 665, 10, 12037652971, 665, 11, 12037652970, 665, 12, 12037652985, 665, 13, 12037652984, 665, 14, 12037652983, 665, 15, 12037652982, 665, 16, 12037652981, 665, 17, 12037652980, 665, 18, 12037652979, 665, 19, 12037652978, 665, 20, 12037652993, 665, 21, 12037652992, 665, 22, 12037652991, 665, 23, 12037652990, 665, 24, 12037652989, 665, 25, 12037652988, 665, 26, 12037652987, 665, 27, 12037652986, 665, 28, 12037653001, 665, 29, 12037653000, 665, 30, 12037652999, 665, 31, 12037652998, 665, 32, 12037652997, 665, 33, 12037652996, 665, 34, 12037652995, 665, 35, 12037652994, 665, 36, 909, 37, 113, 38, 114, 39, 115, 40, 116, 41, 117, 42, 118, 43, 119, 44, 12037653087, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 1, 1, 1, 44, 0, 152, 1, 1, 0, 0ULL, 1, 1ULL, 2, 0ULL, 3, 1ULL, 4, 12037652977, 665, 5, 12037652976, 665, 6, 12037652975, 665, 7, 12037652974, 665, 8, 12037652973, 665, 9, 12037652972, 665, 10, 12037652971, 665, 11, 12037652970, 665, 12, 12037652985, 665, 13, 12037652984, 665, 14, 12037652983, 665, 15, 12037652982, 665, 16, 12037652981, 665, 17, 12037652980, 665, 18, 12037652979, 665, 19, 12037652978, 665, 20, 12037652993, 665, 21, 12037652992, 665, 22, 12037652991, 665, 23, 12037652990, 665, 24, 12037652989, 665, 25, 12037652988, 665, 26, 12037652987, 665, 27, 12037652986, 665, 28, 12037653001, 665, 29, 12037653000, 665, 30, 12037652999, 665, 31, 12037652998, 665, 32, 12037652997, 665, 33, 12037652996, 665, 34, 12037652995, 665, 35, 12037652994, 665, 36, 12037653009, 665, 37, 12037653008, 665, 38, 12037653007, 665, 39, 12037653006, 665, 40, 12037653005, 665, 41, 12037653004, 665, 42, 12037653003, 665, 43, 12037653002, 665, 44, 909, 45, 113, 46, 114, 47, 115, 48, 116, 49, 117, 50, 118, 51, 119, 52, 12037653088, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 153, 1, 1, 0, 0ULL, 1, 0ULL, 2, 1ULL, 3, 1ULL, 4, 12037652977, 665, 5, 12037652976, 665, 6, 12037652975, 665, 7, 12037652974, 665, 8, 12037652973, 665, 9, 12037652972, 665, 10, 12037652971, 665, 11, 12037652970, 665, 12, 12037652985, 665, 13, 12037652984, 665, 14, 12037652983, 665, 15, 12037652982, 665, 16, 12037652981, 665, 17, 12037652980, 665, 18, 12037652979, 665, 19, 12037652978, 665, 20, 12037652977, 665, 21, 12037652976, 665, 22, 12037652975, 665, 23, 12037652974, 665, 24, 12037652973, 665, 25, 12037652972, 665, 26, 12037652971, 665, 27, 12037652970, 665, 28, 12037652985, 665, 29, 12037652984, 665, 30, 12037652983, 665, 31, 12037652982, 665, 32, 12037652981, 665, 33, 12037652980, 665, 34, 12037652979, 665, 35, 12037652978, 665, 36, 12037653009, 665, 37, 12037653008, 665, 38, 12037653007, 665, 39, 12037653006, 665, 40, 12037653005, 665, 41, 12037653004, 665, 42, 12037653003, 665, 43, 12037653002, 665, 44, 909, 45, 113, 46, 114, 47, 115, 48, 116, 49, 117, 50, 118, 51, 119, 52, 12037653089, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 0, 1, 1, 43, 0, 0, 0, 1, 1, 44, 0, 0, 0, 1, 1, 45, 0, 0, 0, 1, 1, 46, 0, 0, 0, 1, 1, 47, 0, 0, 0, 1, 1, 48, 0, 0, 0, 1, 1, 49, 0, 0, 0, 1, 1, 50, 0, 0, 0, 1, 1, 51, 0, 0, 1, 1, 1, 52, 0, 154, 1, 1, 0, 12037653102, 665, 1, 12037652977, 665, 2, 12037652976, 665, 3, 12037652975, 665, 4, 12037652974, 665, 5, 12037652973, 665, 6, 12037652972, 665, 7, 12037652971, 665, 8, 12037652970, 665, 9, 12037652985, 665, 10, 12037652984, 665, 11, 12037652983, 665, 12, 12037652982, 665, 13, 12037652981, 665, 14, 12037652980, 665, 15, 12037652979, 665, 16, 12037652978, 665, 17, 909, 18, 113, 19, 114, 20, 115, 21, 116, 22, 117, 23, 118, 24, 119, 25, 12037653082, 665, 26, 12037653101, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 1, 1, 1, 26, 0, 155, 1, 1, 0, 910, 1, 909, 2, 12037653095, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 156, 1, 1, 0, 910, 1, 909, 2, 113, 3, 114, 4, 115, 5, 116, 6, 117, 7, 118, 8, 119, 9, 12037653120, 665, 10, 12037653096, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 1, 1, 1, 10, 0, 157, 1, 1, 0, 910, 1, 909, 2, 12037653099, 665, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 0, 158, 1, 1, 1, 910, 0, 4294967296ULL, 113, 2, 909, 0, 0, 4294967296ULL, 115, 3, 114, 0, 0, 4294967296ULL, 117, 4, 116, 0, 0, 4294967296ULL, 119, 5, 118, 0, 0, 12037653120, 665, 6, 12037653100, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 6, 0, 159, 1, 1, 0, 910, 1, 45, 2, 12037653084, 665, 3, 909, 4, 113, 5, 114, 6, 115, 7, 116, 8, 117, 9, 118, 10, 119, 11, 12037653083, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 1, 1, 1, 11, 0, 160, 1, 1, 0, 4294967296ULL, 12037653016, 665, 1, 0, 12037653017, 665, 0, 4294967296ULL, 12037653014, 665, 2, 0, 12037653015, 665, 0, 4294967296ULL, 12037653012, 665, 3, 0, 12037653013, 665, 0, 4294967296ULL, 12037653010, 665, 4, 0, 12037653011, 665, 0, 12037653141, 665, 5, 12037653142, 665, 6, 12037653143, 665, 7, 12037653144, 665, 8, 909, 9, 113, 10, 114, 11, 115, 12, 116, 13, 117, 14, 118, 15, 119, 16, 12037653120, 665, 17, 12037653086, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 1, 1, 1, 17, 0, 161, 1, 1, 0, 4294967296ULL, 12037653016, 665, 1, 0, 12037653017, 665, 0, 4294967296ULL, 12037653014, 665, 2, 0, 12037653015, 665, 0, 4294967296ULL, 12037653012, 665, 3, 0, 12037653013, 665, 0, 4294967296ULL, 12037653010, 665, 4, 0, 12037653011, 665, 5, 12037653141, 665, 6, 12037653142, 665, 7, 12037653143, 665, 8, 12037653144, 665, 9, 12037653001, 665, 10, 12037653000, 665, 11, 12037652999, 665, 12, 12037652998, 665, 13, 12037652997, 665, 14, 12037652996, 665, 15, 12037652995, 665, 16, 12037652994, 665, 0, 4294967296ULL, 113, 17, 909, 0, 0, 4294967296ULL, 115, 18, 114, 0, 0, 4294967296ULL, 117, 19, 116, 0, 0, 4294967296ULL, 119, 20, 118, 0, 0, 12037653120, 665, 21, 12037653085, 665, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 21, 0, 162, 1, 1, 0, 0ULL, 1, 0ULL, 2, 12037652977, 665, 3, 12037652976, 665, 4, 12037652975, 665, 5, 12037652974, 665, 6, 12037652973, 665, 7, 12037652972, 665, 8, 12037652971, 665, 9, 12037652970, 665, 10, 12037652985, 665, 11, 12037652984, 665, 12, 12037652983, 665, 13, 12037652982, 665, 14, 12037652981, 665, 15, 12037652980, 665, 16, 12037652979, 665, 17, 12037652978, 665, 18, 909, 19, 113, 20, 114, 21, 115, 22, 116, 23, 117, 24, 118, 25, 119, 26, 12037652993, 665, 27, 12037653090, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 163, 1, 1, 0, 1ULL, 1, 0ULL, 2, 12037652977, 665, 3, 12037652976, 665, 4, 12037652975, 665, 5, 12037652974, 665, 6, 12037652973, 665, 7, 12037652972, 665, 8, 12037652971, 665, 9, 12037652970, 665, 10, 12037652985, 665, 11, 12037652984, 665, 12, 12037652983, 665, 13, 12037652982, 665, 14, 12037652981, 665, 15, 12037652980, 665, 16, 12037652979, 665, 17, 12037652978, 665, 18, 909, 19, 113, 20, 114, 21, 115, 22, 116, 23, 117, 24, 118, 25, 119, 26, 12037652993, 665, 27, 12037653001, 665, 28, 12037653000, 665, 29, 12037652999, 665, 30, 12037652998, 665, 31, 12037652997, 665, 32, 12037652996, 665, 33, 12037652995, 665, 34, 12037652994, 665, 35, 12037653009, 665, 36, 12037653008, 665, 37, 12037653007, 665, 38, 12037653006, 665, 39, 12037653005, 665, 40, 12037653004, 665, 41, 12037653003, 665, 42, 12037653002, 665, 43, 12037653091, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 0, 1, 1, 27, 0, 0, 0, 1, 1, 28, 0, 0, 0, 1, 1, 29, 0, 0, 0, 1, 1, 30, 0, 0, 0, 1, 1, 31, 0, 0, 0, 1, 1, 32, 0, 0, 0, 1, 1, 33, 0, 0, 0, 1, 1, 34, 0, 0, 0, 1, 1, 35, 0, 0, 0, 1, 1, 36, 0, 0, 0, 1, 1, 37, 0, 0, 0, 1, 1, 38, 0, 0, 0, 1, 1, 39, 0, 0, 0, 1, 1, 40, 0, 0, 0, 1, 1, 41, 0, 0, 0, 1, 1, 42, 0, 0, 1, 1, 1, 43, 0, 164, 1, 1, 0, 0ULL, 1, 1ULL, 2, 12037652977, 665, 3, 12037652976, 665, 4, 12037652975, 665, 5, 12037652974, 665, 6, 12037652973, 665, 7, 12037652972, 665, 8, 12037652971, 665, 9, 12037652970, 665, 10, 909, 11, 113, 12, 114, 13, 115, 14, 116, 15, 117, 16, 118, 17, 119, 18, 12037652993, 665, 19, 12037653001, 665, 20, 12037653000, 665, 21, 12037652999, 665, 22, 12037652998, 665, 23, 12037652997, 665, 24, 12037652996, 665, 25, 12037652995, 665, 26, 12037652994, 665, 27, 12037653092, 665, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 1, 3, 0, 0, 0, 1, 1, 4, 0, 0, 0, 1, 1, 5, 0, 0, 0, 1, 1, 6, 0, 0, 0, 1, 1, 7, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 9, 0, 0, 0, 1, 1, 10, 0, 0, 0, 1, 1, 11, 0, 0, 0, 1, 1, 12, 0, 0, 0, 1, 1, 13, 0, 0, 0, 1, 1, 14, 0, 0, 0, 1, 1, 15, 0, 0, 0, 1, 1, 16, 0, 0, 0, 1, 1, 17, 0, 0, 0, 1, 1, 18, 0, 0, 0, 1, 1, 19, 0, 0, 0, 1, 1, 20, 0, 0, 0, 1, 1, 21, 0, 0, 0, 1, 1, 22, 0, 0, 0, 1, 1, 23, 0, 0, 0, 1, 1, 24, 0, 0, 0, 1, 1, 25, 0, 0, 0, 1, 1, 26, 0, 0, 1, 1, 1, 27, 0, 165, 1, 1, 3, 120, 0, 3, 1, 3, 0, 2, 1, 2, 4, 121, 0, 12275445934081160404ULL, 3, 1, 0, 0, 4, 1, 1, 0, 2, 166, 2, 1, 0, 8589934592ULL, 12037652905, 665, 1, 4194304ULL, 12037652904, 665, 2, 0, 1, 0, 2048ULL, 12037652903, 665, 1, 2, 0, 0, 1, 12037652902, 665, 5, 0, 0, 185, 0, 0, 3, 1, 3, 0, 2, 1, 2, 0, 186, 0, 0, 3, 1, 4, 0, 0, 1, 2, 167, 2, 0, 4, 187, 1, 12037652909, 665, 0, 3, 1, 1, 0, 2, 1, 2, 0, 12275445934081160404ULL, 3, 1, 0, 0, 25341984823, 371, 1, 1, 0, 2, 168, 2, 1, 7, 12037652906, 665, 0, 209, 0, 0, 3, 1, 1, 0, 2, 1, 2, 0, 210, 0, 0, 3, 1, 25341984823, 371, 0, 0, 1, 2, 169, 2, 0, 6, 211, 0, 122, 4, 1, 123, 0, 0, 4, 1, 1, 124, 0, 0, 4, 1, 1, 125, 0, 0, 4, 1, 1, 126, 0, 0, 4, 1, 1, 127, 0, 0, 4, 1, 1, 128, 0, 0, 4, 1, 1, 129, 0, 0, 4, 1, 1, 130, 0, 0, 4, 1, 1, 131, 0, 0, 4, 1, 1, 132, 0, 0, 4, 1, 1, 133, 0, 0, 4, 1, 1, 134, 0, 0, 4, 1, 1, 135, 0, 0, 4, 1, 1, 136, 0, 0, 4, 1, 1, 137, 0, 0, 4, 1, 1, 138, 0, 0, 4, 1, 1, 139, 0, 0, 4, 1, 1, 140, 0, 0, 4, 1, 1, 141, 0, 0, 4, 1, 1, 142, 0, 0, 4, 1, 1, 143, 0, 0, 4, 1, 1, 144, 0, 0, 4, 1, 1, 145, 0, 0, 4, 1, 1, 146, 0, 0, 4, 1, 1, 147, 0, 0, 4, 1, 1, 148, 0, 0, 4, 1, 1, 149, 0, 0, 4, 1, 1, 150, 0, 0, 4, 1, 1, 151, 0, 0, 4, 1, 1, 152, 0, 0, 4, 1, 1, 153, 0, 0, 4, 1, 1, 154, 0, 0, 4, 1, 1, 155, 0, 0, 4, 1, 1, 156, 0, 0, 4, 1, 1, 157, 0, 0, 4, 1, 1, 158, 0, 0, 4, 1, 1, 159, 0, 0, 4, 1, 1, 160, 0, 0, 4, 1, 1, 161, 0, 0, 4, 1, 1, 162, 0, 0, 4, 1, 1, 163, 0, 0, 4, 1, 1, 164, 0, 0, 4, 1, 1, 165, 0, 0, 4, 1, 1, 166, 0, 0, 4, 1, 1, 167, 0, 0, 4, 1, 1, 168, 0, 0, 4, 1, 1, 169, 0, 0, 4, 1, 1, 170, 0, 0, 4, 1, 1, 171, 0, 0, 4, 1, 1, 172, 0, 0, 4, 1, 1, 173, 0, 0, 4, 1, 1, 174, 0, 0, 4, 1, 1, 175, 0, 0, 4, 1, 1, 176, 0, 0, 4, 1, 1, 177, 0, 0, 4, 1, 1, 178, 0, 0, 4, 1, 1, 179, 0, 0, 4, 1, 1, 180, 0, 0, 4, 1, 1, 181, 0, 0, 4, 1, 1, 182, 0, 0, 4, 1, 1, 183, 0, 0, 4, 1, 1, 184, 0, 0, 4, 1, 1, 185, 0, 0, 4, 1, 1, 186, 0, 0, 4, 1, 1, 187, 0, 0, 4, 1, 1, 188, 0, 0, 4, 1, 1, 189, 0, 0, 4, 1, 1, 190, 0, 0, 4, 1, 1, 191, 0, 0, 4, 1, 1, 192, 0, 0, 4, 1, 1, 193, 0, 0, 4, 1, 1, 194, 0, 0, 4, 1, 1, 195, 0, 0, 4, 1, 1, 196, 0, 0, 4, 1, 1, 197, 0, 0, 4, 1, 1, 198, 0, 0, 4, 1, 1, 199, 0, 0, 4, 1, 1, 200, 0, 0, 4, 1, 1, 201, 0, 0, 4, 1, 1, 202, 0, 0, 4, 1, 1, 203, 0, 0, 4, 1, 1, 204, 0, 0, 4, 1, 1, 205, 0, 0, 4, 1, 1, 206, 0, 0, 4, 1, 1, 207, 0, 0, 4, 1, 1, 208, 0, 0, 4, 1, 1, 209, 0, 0, 4, 1, 1, 210, 0, 0, 4, 1, 1, 211, 0, 0, 4, 1, 1, 212, 0, 0, 4, 1, 1, 213, 0, 0, 4, 1, 1, 214, 0, 0, 4, 1, 1, 215, 0, 0, 4, 1, 1, 216, 0, 0, 4, 1, 1, 217, 0, 0, 4, 1, 1, 218, 0, 0, 4, 1, 1, 219, 0, 0, 4, 1, 1, 220, 0, 0, 4, 1, 1, 221, 0, 0, 4, 1, 1, 222, 0, 0, 4, 1, 1, 223, 0, 0, 4, 1, 1, 224, 0, 0, 4, 1, 1, 225, 0, 0, 4, 1, 1, 226, 0, 0, 4, 1, 1, 227, 0, 0, 4, 1, 1, 228, 0, 0, 4, 1, 1, 229, 0, 0, 4, 1, 1, 230, 0, 0, 4, 1, 1, 231, 0, 0, 4, 1, 1, 232, 0, 0, 4, 1, 1, 233, 0, 0, 4, 1, 1, 234, 0, 0, 4, 1, 1, 235, 0, 0, 4, 1, 1, 236, 0, 0, 4, 1, 1, 237, 0, 0, 4, 1, 1, 238, 0, 0, 4, 1, 1, 239, 0, 0, 4, 1, 1, 240, 0, 0, 4, 1, 1, 241, 0, 0, 4, 1, 1, 242, 0, 0, 4, 1, 1, 243, 0, 0, 4, 1, 1, 244, 0, 0, 4, 1, 1, 245, 0, 0, 4, 1, 1, 246, 0, 0, 4, 1, 1, 247, 0, 0, 4, 1, 1, 248, 0, 0, 4, 1, 1, 249, 0, 0, 4, 1, 1, 250, 0, 0, 4, 1, 1, 251, 0, 0, 4, 1, 1, 252, 0, 0, 4, 1, 1, 253, 0, 0, 4, 1, 1, 254, 0, 0, 4, 1, 1, 255, 0, 0, 4, 1, 1, 256, 0, 0, 4, 1, 1, 257, 0, 0, 4, 1, 1, 258, 0, 0, 4, 1, 1, 259, 0, 0, 4, 1, 1, 260, 0, 0, 4, 1, 1, 261, 0, 0, 4, 1, 1, 262, 0, 0, 4, 1, 1, 263, 0, 0, 4, 1, 1, 264, 0, 0, 4, 1, 1, 265, 0, 0, 4, 1, 1, 266, 0, 0, 4, 1, 1, 267, 0, 0, 4, 1, 1, 268, 0, 0, 4, 1, 1, 269, 0, 0, 4, 1, 1, 270, 0, 0, 4, 1, 1, 271, 0, 0, 4, 1, 1, 272, 0, 0, 4, 1, 1, 273, 0, 0, 4, 1, 1, 274, 0, 0, 4, 1, 1, 275, 0, 0, 4, 1, 1, 276, 0, 0, 4, 1, 1, 277, 0, 0, 4, 1, 1, 278, 0, 0, 4, 1, 1, 279, 0, 0, 4, 1, 1, 280, 0, 0, 4, 1, 1, 281, 0, 0, 4, 1, 1, 282, 0, 0, 4, 1, 1, 283, 0, 0, 4, 1, 1, 284, 0, 0, 4, 1, 1, 285, 0, 0, 4, 1, 1, 286, 0, 0, 4, 1, 1, 287, 0, 0, 4, 1, 1, 288, 0, 0, 4, 1, 1, 289, 0, 0, 4, 1, 1, 290, 0, 0, 4, 1, 1, 291, 0, 0, 4, 1, 1, 292, 0, 0, 4, 1, 1, 293, 0, 0, 4, 1, 1, 294, 0, 0, 4, 1, 1, 295, 0, 0, 4, 1, 1, 296, 0, 0, 4, 1, 1, 297, 0, 0, 4, 1, 1, 298, 0, 0, 4, 1, 1, 299, 0, 0, 4, 1, 1, 300, 0, 0, 4, 1, 1, 301, 0, 0, 4, 1, 1, 302, 0, 0, 4, 1, 1, 303, 0, 0, 4, 1, 1, 304, 0, 0, 4, 1, 1, 305, 0, 0, 4, 1, 1, 306, 0, 0, 4, 1, 1, 307, 0, 0, 4, 1, 1, 308, 0, 0, 4, 1, 1, 309, 0, 0, 4, 1, 1, 310, 0, 0, 4, 1, 1, 311, 0, 0, 4, 1, 1, 312, 0, 0, 4, 1, 1, 313, 0, 0, 4, 1, 1, 314, 0, 0, 4, 1, 1, 315, 0, 0, 4, 1, 1, 316, 0, 0, 4, 1, 1, 317, 0, 0, 4, 1, 1, 318, 0, 0, 4, 1, 1, 319, 0, 0, 4, 1, 1, 320, 0, 0, 4, 1, 1, 321, 0, 0, 4, 1, 1, 322, 0, 0, 4, 1, 1, 323, 0, 0, 4, 1, 1, 324, 0, 0, 4, 1, 1, 325, 0, 0, 4, 1, 1, 326, 0, 0, 4, 1, 1, 327, 0, 0, 4, 1, 1, 328, 0, 0, 4, 1, 1, 329, 0, 0, 4, 1, 1, 330, 0, 0, 4, 1, 1, 331, 0, 0, 4, 1, 1, 332, 0, 0, 4, 1, 1, 333, 0, 0, 4, 1, 1, 334, 0, 0, 4, 1, 1, 335, 0, 0, 4, 1, 1, 336, 0, 0, 4, 1, 1, 337, 0, 0, 4, 1, 1, 338, 0, 0, 4, 1, 1, 339, 0, 0, 4, 1, 1, 340, 0, 0, 4, 1, 1, 341, 0, 0, 4, 1, 1, 342, 0, 0, 4, 1, 1, 343, 0, 0, 4, 1, 1, 344, 0, 0, 4, 1, 1, 345, 0, 0, 4, 1, 1, 346, 0, 0, 4, 1, 1, 347, 0, 0, 4, 1, 1, 348, 0, 0, 4, 1, 1, 349, 0, 0, 4, 1, 1, 350, 0, 0, 4, 1, 1, 351, 0, 0, 4, 1, 1, 352, 0, 0, 4, 1, 1, 353, 0, 0, 4, 1, 1, 354, 0, 0, 4, 1, 1, 355, 0, 0, 4, 1, 1, 356, 0, 0, 4, 1, 1, 357, 0, 0, 4, 1, 1, 358, 0, 0, 4, 1, 1, 359, 0, 0, 4, 1, 1, 360, 0, 0, 4, 1, 1, 361, 0, 0, 4, 1, 1, 362, 0, 0, 4, 1, 1, 363, 0, 0, 4, 1, 1, 364, 0, 0, 4, 1, 1, 365, 0, 0, 4, 1, 1, 366, 0, 0, 4, 1, 1, 367, 0, 0, 4, 1, 1, 368, 0, 0, 4, 1, 1, 369, 0, 0, 4, 1, 1, 370, 0, 0, 4, 1, 1, 371, 0, 0, 4, 1, 1, 372, 0, 0, 4, 1, 1, 373, 0, 0, 4, 1, 1, 374, 0, 0, 4, 1, 1, 375, 0, 0, 4, 1, 1, 376, 0, 0, 4, 1, 1, 377, 0, 0, 4, 1, 1, 378, 0, 0, 4, 1, 1, 379, 0, 0, 4, 1, 1, 380, 0, 0, 4, 1, 1, 381, 0, 0, 4, 1, 1, 382, 0, 0, 4, 1, 1, 383, 0, 0, 4, 1, 1, 384, 0, 0, 4, 1, 1, 385, 0, 0, 4, 1, 1, 386, 0, 0, 4, 1, 1, 387, 0, 0, 4, 1, 1, 388, 0, 0, 4, 1, 1, 389, 0, 0, 4, 1, 1, 390, 0, 0, 4, 1, 1, 391, 0, 0, 4, 1, 1, 392, 0, 0, 4, 1, 1, 393, 0, 0, 4, 1, 1, 394, 0, 0, 4, 1, 1, 395, 0, 0, 4, 1, 1, 396, 0, 0, 4, 1, 1, 397, 0, 0, 4, 1, 1, 398, 0, 0, 4, 1, 1, 399, 0, 0, 4, 1, 1, 400, 0, 0, 4, 1, 1, 401, 0, 0, 4, 1, 1, 402, 0, 0, 4, 1, 1, 403, 0, 0, 4, 1, 1, 404, 0, 0, 4, 1, 1, 405, 0, 0, 4, 1, 1, 406, 0, 0, 4, 1, 1, 407, 0, 0, 4, 1, 1, 408, 0, 0, 4, 1, 1, 409, 0, 0, 4, 1, 1, 410, 0, 0, 4, 1, 1, 411, 0, 0, 4, 1, 1, 412, 0, 0, 4, 1, 1, 413, 0, 0, 4, 1, 1, 414, 0, 0, 4, 1, 1, 415, 0, 0, 4, 1, 1, 416, 0, 0, 4, 1, 1, 417, 0, 0, 4, 1, 1, 418, 0, 0, 4, 1, 1, 419, 0, 0, 4, 1, 1, 420, 0, 0, 4, 1, 1, 421, 0, 0, 4, 1, 1, 422, 0, 0, 4, 1, 1, 423, 0, 0, 4, 1, 1, 424, 0, 0, 4, 1, 1, 425, 0, 0, 4, 1, 1, 426, 0, 0, 4, 1, 1, 427, 0, 0, 4, 1, 1, 428, 0, 0, 4, 1, 1, 429, 0, 0, 4, 1, 1, 430, 0, 0, 4, 1, 1, 431, 0, 0, 4, 1, 1, 432, 0, 0, 4, 1, 1, 433, 0, 0, 4, 1, 1, 434, 0, 0, 4, 1, 1, 435, 0, 0, 4, 1, 1, 436, 0, 0, 4, 1, 1, 437, 0, 0, 4, 1, 1, 438, 0, 0, 4, 1, 1, 439, 0, 0, 4, 1, 1, 440, 0, 0, 4, 1, 1, 441, 0, 0, 4, 1, 1, 442, 0, 0, 4, 1, 1, 443, 0, 0, 4, 1, 1, 444, 0, 0, 4, 1, 1, 445, 0, 0, 4, 1, 1, 446, 0, 0, 4, 1, 1, 447, 0, 0, 4, 1, 1, 448, 0, 0, 4, 1, 1, 449, 0, 0, 4, 1, 1, 450, 0, 0, 4, 1, 1, 451, 0, 0, 4, 1, 1, 452, 0, 0, 4, 1, 1, 453, 0, 0, 4, 1, 1, 454, 0, 0, 4, 1, 1, 455, 0, 0, 4, 1, 1, 456, 0, 0, 4, 1, 1, 457, 0, 0, 4, 1, 1, 458, 0, 0, 4, 1, 1, 459, 0, 0, 4, 1, 1, 460, 0, 0, 4, 1, 1, 461, 0, 0, 4, 1, 1, 462, 0, 0, 4, 1, 1, 463, 0, 0, 4, 1, 1, 464, 0, 0, 4, 1, 1, 465, 0, 0, 4, 1, 1, 466, 0, 0, 4, 1, 1, 467, 0, 0, 4, 1, 1, 468, 0, 0, 4, 1, 1, 469, 0, 0, 4, 1, 1, 470, 0, 0, 4, 1, 1, 471, 0, 0, 4, 1, 1, 472, 0, 0, 4, 1, 1, 473, 0, 0, 4, 1, 1, 474, 0, 0, 4, 1, 1, 475, 0, 0, 4, 1, 1, 476, 0, 0, 4, 1, 1, 477, 0, 0, 4, 1, 1, 478, 0, 0, 4, 1, 1, 479, 0, 0, 4, 1, 1, 480, 0, 0, 4, 1, 1, 481, 0, 0, 4, 1, 1, 482, 0, 0, 4, 1, 1, 483, 0, 0, 4, 1, 1, 484, 0, 0, 4, 1, 1, 485, 0, 0, 4, 1, 1, 486, 0, 0, 4, 1, 1, 487, 0, 0, 4, 1, 1, 488, 0, 0, 4, 1, 1, 489, 0, 0, 4, 1, 1, 490, 0, 0, 4, 1, 1, 491, 0, 0, 4, 1, 1, 492, 0, 0, 4, 1, 1, 493, 0, 0, 4, 1, 1, 494, 0, 0, 4, 1, 1, 495, 0, 0, 4, 1, 1, 496, 0, 0, 4, 1, 1, 497, 0, 0, 4, 1, 1, 498, 0, 0, 4, 1, 1, 499, 0, 0, 4, 1, 1, 500, 0, 0, 4, 1, 1, 501, 0, 0, 4, 1, 1, 502, 0, 0, 4, 1, 1, 503, 0, 0, 4, 1, 1, 504, 0, 0, 4, 1, 1, 505, 0, 0, 4, 1, 1, 506, 0, 0, 4, 1, 1, 507, 0, 0, 4, 1, 1, 508, 0, 0, 4, 1, 1, 509, 0, 0, 4, 1, 1, 510, 0, 0, 4, 1, 1, 511, 0, 0, 4, 1, 1, 512, 0, 0, 4, 1, 1, 513, 0, 0, 4, 1, 1, 514, 0, 0, 4, 1, 1, 515, 0, 0, 4, 1, 1, 516, 0, 0, 4, 1, 1, 517, 0, 0, 4, 1, 1, 518, 0, 0, 4, 1, 1, 519, 0, 0, 4, 1, 1, 520, 0, 0, 4, 1, 1, 521, 0, 0, 4, 1, 1, 522, 0, 0, 4, 1, 1, 523, 0, 0, 4, 1, 1, 524, 0, 0, 4, 1, 1, 525, 0, 0, 4, 1, 1, 526, 0, 0, 4, 1, 1, 527, 0, 0, 4, 1, 1, 528, 0, 0, 4, 1, 1, 529, 0, 0, 4, 1, 1, 530, 0, 0, 4, 1, 1, 531, 0, 0, 4, 1, 1, 532, 0, 0, 4, 1, 1, 533, 0, 0, 4, 1, 1, 534, 0, 0, 4, 1, 1, 535, 0, 0, 4, 1, 1, 536, 0, 0, 4, 1, 1, 537, 0, 0, 4, 1, 1, 538, 0, 0, 4, 1, 1, 539, 0, 0, 4, 1, 1, 540, 0, 0, 4, 1, 1, 541, 0, 0, 4, 1, 1, 542, 0, 0, 4, 1, 1, 543, 0, 0, 4, 1, 1, 544, 0, 0, 4, 1, 1, 545, 0, 0, 4, 1, 1, 546, 0, 0, 4, 1, 1, 547, 0, 0, 4, 1, 1, 548, 0, 0, 4, 1, 1, 549, 0, 0, 4, 1, 1, 550, 0, 0, 4, 1, 1, 551, 0, 0, 4, 1, 1, 552, 0, 0, 4, 1, 1, 553, 0, 0, 4, 1, 1, 554, 0, 0, 4, 1, 1, 555, 0, 0, 4, 1, 1, 556, 0, 0, 4, 1, 1, 557, 0, 0, 4, 1, 1, 558, 0, 0, 4, 1, 1, 559, 0, 0, 4, 1, 1, 560, 0, 0, 4, 1, 1, 561, 0, 0, 4, 1, 1, 562, 0, 0, 4, 1, 1, 563, 0, 0, 4, 1, 1, 564, 0, 0, 4, 1, 1, 565, 0, 0, 4, 1, 1, 566, 0, 0, 4, 1, 1, 567, 0, 0, 4, 1, 1, 568, 0, 0, 4, 1, 1, 569, 0, 0, 4, 1, 1, 570, 0, 0, 4, 1, 1, 571, 0, 0, 4, 1, 1, 572, 0, 0, 4, 1, 1, 573, 0, 0, 4, 1, 1, 574, 0, 0, 4, 1, 1, 575, 0, 0, 4, 1, 1, 576, 0, 0, 4, 1, 1, 577, 0, 0, 4, 1, 1, 578, 0, 0, 4, 1, 1, 579, 0, 0, 4, 1, 1, 580, 0, 0, 4, 1, 1, 581, 0, 0, 4, 1, 1, 582, 0, 0, 4, 1, 1, 583, 0, 0, 4, 1, 1, 584, 0, 0, 4, 1, 1, 585, 0, 0, 4, 1, 1, 586, 0, 0, 4, 1, 1, 587, 0, 0, 4, 1, 1, 588, 0, 0, 4, 1, 1, 589, 0, 0, 4, 1, 1, 590, 0, 0, 4, 1, 1, 591, 0, 0, 4, 1, 1, 592, 0, 0, 4, 1, 1, 593, 0, 0, 4, 1, 1, 594, 0, 0, 4, 1, 1, 595, 0, 0, 4, 1, 1, 596, 0, 0, 4, 1, 1, 597, 0, 0, 4, 1, 1, 598, 0, 0, 4, 1, 1, 599, 0, 0, 4, 1, 1, 600, 0, 0, 4, 1, 1, 601, 0, 0, 4, 1, 1, 602, 0, 0, 4, 1, 1, 603, 0, 0, 4, 1, 1, 604, 0, 0, 4, 1, 1, 605, 0, 0, 4, 1, 1, 606, 0, 0, 4, 1, 1, 607, 0, 0, 4, 1, 1, 608, 0, 0, 4, 1, 1, 609, 0, 0, 4, 1, 1, 610, 0, 0, 4, 1, 1, 611, 0, 0, 4, 1, 1, 612, 0, 0, 4, 1, 1, 613, 0, 0, 4, 1, 1, 614, 0, 0, 4, 1, 1, 615, 0, 0, 4, 1, 1, 616, 0, 0, 4, 1, 1, 617, 0, 0, 4, 1, 1, 618, 0, 0, 4, 1, 1, 619, 0, 0, 4, 1, 1, 620, 0, 0, 4, 1, 1, 621, 0, 0, 4, 1, 1, 622, 0, 0, 4, 1, 1, 623, 0, 0, 4, 1, 1, 624, 0, 0, 4, 1, 1, 625, 0, 0, 4, 1, 1, 626, 0, 0, 4, 1, 1, 627, 0, 0, 4, 1, 1, 628, 0, 0, 4, 1, 1, 629, 0, 0, 4, 1, 1, 630, 0, 0, 4, 1, 1, 631, 0, 0, 4, 1, 1, 632, 0, 0, 4, 1, 1, 633, 0, 0, 4, 1, 1, 634, 0, 0, 4, 1, 1, 635, 0, 0, 4, 1, 1, 636, 0, 0, 4, 1, 1, 637, 0, 0, 4, 1, 1, 638, 0, 0, 4, 1, 1, 639, 0, 0, 4, 1, 1, 640, 0, 0, 4, 1, 1, 641, 0, 0, 4, 1, 1, 642, 0, 0, 4, 1, 1, 643, 0, 0, 4, 1, 1, 644, 0, 0, 4, 1, 1, 645, 0, 0, 4, 1, 1, 646, 0, 0, 4, 1, 1, 647, 0, 0, 4, 1, 1, 648, 0, 0, 4, 1, 1, 649, 0, 0, 4, 1, 1, 650, 0, 0, 4, 1, 1, 651, 0, 0, 4, 1, 1, 652, 0, 0, 4, 1, 1, 653, 0, 0, 4, 1, 1, 654, 0, 0, 4, 1, 1, 655, 0, 0, 4, 1, 1, 656, 0, 0, 4, 1, 1, 657, 0, 0, 4, 1, 1, 658, 0, 0, 4, 1, 1, 659, 0, 0, 4, 1, 1, 660, 0, 0, 4, 1, 1, 661, 0, 0, 4, 1, 1, 662, 0, 0, 4, 1, 1, 663, 0, 0, 4, 1, 1, 664, 0, 0, 4, 1, 1, 665, 0, 0, 4, 1, 1, 666, 0, 0, 4, 1, 1, 667, 0, 0, 4, 1, 1, 668, 0, 0, 4, 1, 1, 669, 0, 0, 4, 1, 1, 670, 0, 0, 4, 1, 1, 671, 0, 0, 4, 1, 1, 672, 0, 0, 4, 1, 1, 673, 0, 0, 4, 1, 1, 674, 0, 0, 4, 1, 1, 675, 0, 0, 4, 1, 1, 676, 0, 0, 4, 1, 1, 677, 0, 0, 4, 1, 1, 678, 0, 0, 4, 1, 1, 679, 0, 0, 4, 1, 1, 680, 0, 0, 4, 1, 1, 681, 0, 0, 4, 1, 1, 682, 0, 0, 4, 1, 1, 683, 0, 0, 4, 1, 1, 684, 0, 0, 4, 1, 1, 685, 0, 0, 4, 1, 1, 686, 0, 0, 4, 1, 1, 687, 0, 0, 4, 1, 1, 688, 0, 0, 4, 1, 1, 689, 0, 0, 4, 1, 1, 690, 0, 0, 4, 1, 1, 691, 0, 0, 4, 1, 1, 692, 0, 0, 4, 1, 1, 693, 0, 0, 4, 1, 1, 694, 0, 0, 4, 1, 1, 695, 0, 0, 4, 1, 1, 696, 0, 0, 4, 1, 1, 697, 0, 0, 4, 1, 1, 698, 0, 0, 4, 1, 1, 699, 0, 0, 4, 1, 1, 700, 0, 0, 4, 1, 1, 701, 0, 0, 4, 1, 1, 702, 0, 0, 4, 1, 1, 703, 0, 0, 4, 1, 1, 704, 0, 0, 4, 1, 1, 705, 0, 0, 4, 1, 1, 706, 0, 0, 4, 1, 1, 707, 0, 0, 4, 1, 1, 708, 0, 0, 4, 1, 1, 709, 0, 0, 4, 1, 1, 710, 0, 0, 4, 1, 1, 711, 0, 0, 4, 1, 1, 712, 0, 0, 4, 1, 1, 713, 0, 0, 4, 1, 1, 714, 0, 0, 4, 1, 1, 715, 0, 0, 4, 1, 1, 716, 0, 0, 4, 1, 1, 717, 0, 0, 4, 1, 1, 718, 0, 0, 4, 1, 1, 719, 0, 0, 4, 1, 1, 720, 0, 0, 4, 1, 1, 721, 0, 0, 4, 1, 1, 722, 0, 0, 4, 1, 1, 723, 0, 0, 4, 1, 1, 724, 0, 0, 4, 1, 1, 725, 0, 0, 4, 1, 1, 726, 0, 0, 4, 1, 1, 727, 0, 0, 4, 1, 1, 728, 0, 0, 4, 1, 1, 729, 0, 0, 4, 1, 1, 730, 0, 0, 4, 1, 1, 731, 0, 0, 4, 1, 1, 732, 0, 0, 4, 1, 1, 733, 0, 0, 4, 1, 1, 734, 0, 0, 4, 1, 1, 735, 0, 0, 4, 1, 1, 736, 0, 0, 4, 1, 1, 737, 0, 0, 4, 1, 1, 738, 0, 0, 4, 1, 1, 739, 0, 0, 4, 1, 1, 740, 0, 0, 4, 1, 1, 741, 0, 0, 4, 1, 1, 742, 0, 0, 4, 1, 1, 743, 0, 0, 4, 1, 1, 744, 0, 0, 4, 1, 1, 745, 0, 0, 4, 1, 1, 746, 0, 0, 4, 1, 1, 747, 0, 0, 4, 1, 1, 748, 0, 0, 4, 1, 1, 749, 0, 0, 4, 1, 1, 750, 0, 0, 4, 1, 1, 751, 0, 0, 4, 1, 1, 752, 0, 0, 4, 1, 1, 0, 5, 0, 4, 1, 1, 0, 6, 0, 4, 1, 1, 0, 7, 0, 4, 1, 1, 0, 8, 0, 4, 1, 1, 0, 9, 0, 4, 1, 1, 0, 10, 0, 4, 1, 1, 0, 11, 0, 4, 1, 1, 0, 12, 0, 4, 1, 1, 0, 13, 0, 4, 1, 1, 0, 14, 0, 4, 1, 1, 0, 15, 0, 4, 1, 1, 0, 16, 0, 4, 1, 1, 0, 17, 0, 4, 1, 1, 0, 18, 0, 4, 1, 1, 0, 19, 0, 4, 1, 1, 0, 20, 0, 4, 1, 1, 0, 21, 0, 4, 1, 1, 0, 22, 0, 4, 1, 1, 0, 23, 0, 4, 1, 1, 0, 24, 0, 4, 1, 1, 0, 25, 0, 4, 1, 1, 0, 26, 0, 4, 1, 1, 0, 27, 0, 4, 1, 1, 0, 28, 0, 4, 1, 1, 0, 29, 0, 4, 1, 1, 0, 30, 0, 4, 1, 1, 0, 31, 0, 4, 1, 1, 0, 32, 0, 4, 1, 1, 0, 33, 0, 4, 1, 1, 0, 34, 0, 4, 1, 1, 0, 35, 0, 4, 1, 1, 0, 36, 0, 4, 1, 1, 0, 37, 0, 4, 1, 1, 0, 38, 0, 4, 1, 1, 0, 39, 0, 4, 1, 1, 0, 40, 0, 4, 1, 1, 0, 41, 0, 4, 1, 1, 0, 42, 0, 4, 1, 1, 0, 43, 0, 4, 1, 1, 0, 44, 0, 4, 1, 1, 0, 45, 0, 4, 1, 1, 0, 46, 0, 4, 1, 1, 0, 47, 0, 4, 1, 1, 0, 48, 0, 4, 1, 1, 0, 49, 0, 4, 1, 1, 0, 50, 0, 4, 1, 1, 0, 51, 0, 4, 1, 1, 0, 4, 0, 4, 1, 1, 0, 52, 0, 4, 1, 1, 0, 53, 0, 4, 1, 1, 0, 54, 0, 4, 1, 1, 0, 55, 0, 4, 1, 1, 0, 56, 0, 4, 1, 1, 0, 57, 0, 4, 1, 1, 0, 58, 0, 4, 1, 1, 0, 3, 0, 4, 1, 1, 0, 59, 0, 4, 1, 1, 0, 60, 0, 4, 1, 1, 0, 61, 0, 4, 1, 1, 0, 62, 0, 4, 1, 1, 0, 63, 0, 4, 1, 1, 0, 64, 0, 4, 1, 1, 0, 65, 0, 4, 1, 1, 0, 66, 0, 4, 1, 1, 0, 67, 0, 4, 1, 1, 0, 68, 0, 4, 1, 1, 0, 69, 0, 4, 1, 1, 0, 70, 0, 4, 1, 1, 0, 71, 0, 4, 1, 1, 0, 72, 0, 4, 1, 1, 0, 73, 0, 4, 1, 1, 0, 74, 0, 4, 1, 1, 0, 75, 0, 4, 1, 1, 0, 76, 0, 4, 1, 1, 0, 77, 0, 4, 1, 1, 0, 78, 0, 4, 1, 1, 0, 79, 0, 4, 1, 1, 0, 80, 0, 4, 1, 1, 0, 81, 0, 4, 1, 1, 0, 82, 0, 4, 1, 1, 0, 83, 0, 4, 1, 1, 0, 84, 0, 4, 1, 1, 0, 85, 0, 4, 1, 1, 0, 86, 0, 4, 1, 1, 0, 87, 0, 4, 1, 1, 0, 88, 0, 4, 1, 1, 0, 89, 0, 4, 1, 1, 0, 90, 0, 4, 1, 1, 0, 91, 0, 4, 1, 1, 0, 92, 0, 4, 1, 1, 0, 93, 0, 4, 1, 1, 0, 94, 0, 4, 1, 1, 0, 95, 0, 4, 1, 1, 0, 96, 0, 4, 1, 1, 0, 97, 0, 4, 1, 1, 0, 98, 0, 4, 1, 0, 12037652484, 2, 16777216, 665, 12037652483, 2, 16777216, 665, 1, 0, 12037652480, 665, 0, 12037652482, 665, 12037652480, 665, 2, 53, 0, 0, 1, 2, 1, 0, 25341984768, 371, 1, 1, 0, 0, 4, 1, 0, 12037652484, 2, 16777216, 665, 12037652483, 2, 16777216, 665, 1, 0, 12037652481, 665, 0, 12037652482, 665, 12037652481, 665, 2, 54, 0, 0, 1, 2, 1, 0, 25341984769, 371, 1, 1, 0, 0, 4, 1, 0, 1ULL, 12037652483, 2, 16777216, 665, 1, 0, 12037652484, 2, 16777216, 665, 2, 1, 55, 0, 12037652483, 2, 16777216, 665, 12037652484, 2, 16777216, 665, 1, 0, 12037652482, 665, 0, 2, 1, 1, 0, 25341984770, 371, 1, 1, 0, 0, 4, 1, 0, 56, 5, 1, 57, 6, 2, 0, 1, 0, 58, 7, 1, 2, 0, 0, 59, 8, 2, 1, 0, 0, 60, 9, 1, 2, 0, 0, 61, 10, 2, 1, 0, 0, 62, 11, 1, 2, 0, 0, 63, 12, 2, 1, 0, 0, 64, 13, 1, 2, 0, 0, 65, 14, 2, 1, 0, 0, 66, 15, 1, 2, 0, 0, 67, 16, 2, 1, 0, 0, 68, 17, 1, 2, 0, 0, 69, 18, 2, 1, 0, 0, 70, 19, 1, 2, 0, 0, 71, 20, 2, 1, 0, 0, 72, 21, 1, 2, 0, 0, 73, 22, 2, 1, 0, 0, 74, 23, 1, 2, 0, 0, 75, 24, 2, 1, 0, 0, 76, 25, 1, 2, 0, 0, 77, 26, 2, 1, 0, 0, 78, 27, 1, 2, 0, 0, 79, 28, 2, 1, 0, 0, 80, 29, 1, 2, 0, 0, 81, 30, 2, 1, 0, 0, 82, 31, 1, 2, 0, 0, 83, 32, 2, 1, 0, 0, 84, 33, 1, 2, 0, 0, 85, 34, 2, 1, 0, 0, 86, 35, 1, 2, 0, 0, 87, 36, 2, 1, 0, 0, 2, 25341984771, 371, 1, 0, 0, 0, 4, 1, 0, 88, 5, 1, 89, 6, 2, 0, 1, 0, 90, 7, 1, 2, 0, 0, 91, 8, 2, 1, 0, 0, 92, 9, 1, 2, 0, 0, 93, 10, 2, 1, 0, 0, 94, 11, 1, 2, 0, 0, 95, 12, 2, 1, 0, 0, 96, 13, 1, 2, 0, 0, 97, 14, 2, 1, 0, 0, 98, 15, 1, 2, 0, 0, 99, 16, 2, 1, 0, 0, 100, 17, 1, 2, 0, 0, 753, 18, 2, 1, 0, 0, 754, 19, 1, 2, 0, 0, 755, 20, 2, 1, 0, 0, 756, 21, 1, 2, 0, 0, 757, 22, 2, 1, 0, 0, 758, 23, 1, 2, 0, 0, 759, 24, 2, 1, 0, 0, 760, 25, 1, 2, 0, 0, 761, 26, 2, 1, 0, 0, 762, 27, 1, 2, 0, 0, 763, 28, 2, 1, 0, 0, 764, 29, 1, 2, 0, 0, 765, 30, 2, 1, 0, 0, 766, 31, 1, 2, 0, 0, 767, 32, 2, 1, 0, 0, 768, 33, 1, 2, 0, 0, 769, 34, 2, 1, 0, 0, 770, 35, 1, 2, 0, 0, 771, 36, 2, 1, 0, 0, 2, 25341984772, 371, 1, 0, 0, 0, 4, 1, 0, 772, 5, 1, 773, 6, 2, 0, 1, 0, 774, 7, 1, 2, 0, 0, 775, 8, 2, 1, 0, 0, 776, 9, 1, 2, 0, 0, 777, 10, 2, 1, 0, 0, 778, 11, 1, 2, 0, 0, 779, 12, 2, 1, 0, 0, 780, 13, 1, 2, 0, 0, 781, 14, 2, 1, 0, 0, 782, 15, 1, 2, 0, 0, 783, 16, 2, 1, 0, 0, 784, 17, 1, 2, 0, 0, 785, 18, 2, 1, 0, 0, 786, 19, 1, 2, 0, 0, 787, 20, 2, 1, 0, 0, 788, 21, 1, 2, 0, 0, 789, 22, 2, 1, 0, 0, 790, 23, 1, 2, 0, 0, 791, 24, 2, 1, 0, 0, 792, 25, 1, 2, 0, 0, 793, 26, 2, 1, 0, 0, 794, 27, 1, 2, 0, 0, 795, 28, 2, 1, 0, 0, 796, 29, 1, 2, 0, 0, 797, 30, 2, 1, 0, 0, 798, 31, 1, 2, 0, 0, 799, 32, 2, 1, 0, 0, 800, 33, 1, 2, 0, 0, 801, 34, 2, 1, 0, 0, 802, 35, 1, 2, 0, 0, 803, 36, 2, 1, 0, 0, 2, 25341984773, 371, 1, 0, 0, 0, 4, 1, 0, 804, 5, 1, 805, 6, 2, 0, 1, 0, 806, 7, 1, 2, 0, 0, 807, 8, 2, 1, 0, 0, 808, 9, 1, 2, 0, 0, 809, 10, 2, 1, 0, 0, 810, 11, 1, 2, 0, 0, 811, 12, 2, 1, 0, 0, 812, 13, 1, 2, 0, 0, 813, 14, 2, 1, 0, 0, 814, 15, 1, 2, 0, 0, 815, 16, 2, 1, 0, 0, 816, 17, 1, 2, 0, 0, 817, 18, 2, 1, 0, 0, 818, 19, 1, 2, 0, 0, 819, 20, 2, 1, 0, 0, 820, 21, 1, 2, 0, 0, 821, 22, 2, 1, 0, 0, 822, 23, 1, 2, 0, 0, 823, 24, 2, 1, 0, 0, 824, 25, 1, 2, 0, 0, 825, 26, 2, 1, 0, 0, 826, 27, 1, 2, 0, 0, 827, 28, 2, 1, 0, 0, 828, 29, 1, 2, 0, 0, 829, 30, 2, 1, 0, 0, 830, 31, 1, 2, 0, 0, 831, 32, 2, 1, 0, 0, 832, 33, 1, 2, 0, 0, 833, 34, 2, 1, 0, 0, 834, 35, 1, 2, 0, 0, 835, 36, 2, 1, 0, 0, 2, 25341984774, 371, 1, 0, 0, 0, 4, 1, 0, 836, 5, 1, 837, 6, 2, 0, 1, 0, 838, 7, 1, 2, 0, 0, 839, 8, 2, 1, 0, 0, 840, 9, 1, 2, 0, 0, 841, 10, 2, 1, 0, 0, 842, 11, 1, 2, 0, 0, 843, 12, 2, 1, 0, 0, 844, 13, 1, 2, 0, 0, 845, 14, 2, 1, 0, 0, 846, 15, 1, 2, 0, 0, 847, 16, 2, 1, 0, 0, 848, 17, 1, 2, 0, 0, 849, 18, 2, 1, 0, 0, 850, 19, 1, 2, 0, 0, 851, 20, 2, 1, 0, 0, 852, 21, 1, 2, 0, 0, 853, 22, 2, 1, 0, 0, 854, 23, 1, 2, 0, 0, 855, 24, 2, 1, 0, 0, 856, 25, 1, 2, 0, 0, 857, 26, 2, 1, 0, 0, 858, 27, 1, 2, 0, 0, 859, 28, 2, 1, 0, 0, 860, 29, 1, 2, 0, 0, 861, 30, 2, 1, 0, 0, 862, 31, 1, 2, 0, 0, 863, 32, 2, 1, 0, 0, 864, 33, 1, 2, 0, 0, 865, 34, 2, 1, 0, 0, 866, 35, 1, 2, 0, 0, 867, 36, 2, 1, 0, 0, 2, 25341984775, 371, 1, 0, 0, 0, 4, 1, 0, 868, 868, 1, 0, 25341984776, 371, 1, 1, 0, 0, 4, 1, 0, 25341984776, 371, 869, 1, 0, 25341984777, 371, 1, 1, 0, 0, 4, 1, 0, 870, 870, 1, 0, 25341984778, 371, 1, 1, 0, 0, 4, 1, 0, 25341984778, 371, 871, 1, 0, 25341984779, 371, 1, 1, 0, 0, 4, 1, 0, 872, 872, 1, 0, 25341984780, 371, 1, 1, 0, 0, 4, 1, 0, 25341984780, 371, 873, 1, 0, 25341984781, 371, 1, 1, 0, 0, 4, 1, 0, 874, 874, 1, 0, 25341984782, 371, 1, 1, 0, 0, 4, 1, 0, 25341984782, 371, 875, 1, 0, 25341984783, 371, 1, 1, 0, 0, 4, 1, 0, 876, 876, 1, 0, 25341984784, 371, 1, 1, 0, 0, 4, 1, 0, 25341984784, 371, 877, 1, 0, 25341984785, 371, 1, 1, 0, 0, 4, 1, 0, 878, 878, 1, 0, 25341984786, 371, 1, 1, 0, 0, 4, 1, 0, 25341984786, 371, 879, 1, 0, 25341984787, 371, 1, 1, 0, 0, 4, 1, 0, 880, 880, 1, 0, 25341984788, 371, 1, 1, 0, 0, 4, 1, 0, 25341984788, 371, 881, 1, 0, 25341984789, 371, 1, 1, 0, 0, 4, 1, 0, 882, 882, 1, 0, 25341984790, 371, 1, 1, 0, 0, 4, 1, 0, 25341984790, 371, 883, 1, 0, 25341984791, 371, 1, 1, 0, 0, 4, 1, 0, 884, 884, 1, 0, 25341984792, 371, 1, 1, 0, 0, 4, 1, 0, 25341984792, 371, 885, 1, 0, 25341984793, 371, 1, 1, 0, 0, 4, 1, 0, 886, 886, 1, 0, 25341984794, 371, 1, 1, 0, 0, 4, 1, 0, 25341984794, 371, 887, 1, 0, 25341984795, 371, 1, 1, 0, 0, 4, 1, 0, 888, 888, 1, 0, 25341984796, 371, 1, 1, 0, 0, 4, 1, 0, 25341984796, 371, 889, 1, 0, 25341984797, 371, 1, 1, 0, 0, 4, 1, 0, 890, 890, 1, 0, 25341984798, 371, 1, 1, 0, 0, 4, 1, 0, 25341984798, 371, 891, 1, 0, 25341984799, 371, 1, 1, 0, 0, 4, 1, 0, 25ULL, 892, 1, 15ULL, 893, 2, 0, 1, 0, 41ULL, 894, 1, 2, 0, 0, 16ULL, 895, 2, 1, 0, 0, 2ULL, 896, 1, 2, 0, 0, 28ULL, 897, 2, 1, 0, 0, 13ULL, 898, 1, 2, 0, 0, 13ULL, 899, 2, 1, 0, 0, 39ULL, 900, 1, 2, 0, 0, 18ULL, 901, 2, 1, 0, 0, 34ULL, 902, 1, 2, 0, 0, 20ULL, 903, 2, 1, 0, 0, 2, 25341984800, 371, 1, 0, 0, 0, 4, 1, 0, 20ULL, 892, 1, 17ULL, 893, 2, 0, 1, 0, 15ULL, 894, 1, 2, 0, 0, 41ULL, 895, 2, 1, 0, 0, 16ULL, 896, 1, 2, 0, 0, 2ULL, 897, 2, 1, 0, 0, 28ULL, 898, 1, 2, 0, 0, 13ULL, 899, 2, 1, 0, 0, 13ULL, 900, 1, 2, 0, 0, 39ULL, 901, 2, 1, 0, 0, 18ULL, 902, 1, 2, 0, 0, 34ULL, 903, 2, 1, 0, 0, 2, 25341984801, 371, 1, 0, 0, 0, 4, 1, 0, 34ULL, 892, 1, 20ULL, 893, 2, 0, 1, 0, 17ULL, 894, 1, 2, 0, 0, 15ULL, 895, 2, 1, 0, 0, 41ULL, 896, 1, 2, 0, 0, 16ULL, 897, 2, 1, 0, 0, 2ULL, 898, 1, 2, 0, 0, 28ULL, 899, 2, 1, 0, 0, 13ULL, 900, 1, 2, 0, 0, 13ULL, 901, 2, 1, 0, 0, 39ULL, 902, 1, 2, 0, 0, 18ULL, 903, 2, 1, 0, 0, 2, 25341984802, 371, 1, 0, 0, 0, 4, 1, 0, 18ULL, 892, 1, 34ULL, 893, 2, 0, 1, 0, 20ULL, 894, 1, 2, 0, 0, 17ULL, 895, 2, 1, 0, 0, 15ULL, 896, 1, 2, 0, 0, 41ULL, 897, 2, 1, 0, 0, 16ULL, 898, 1, 2, 0, 0, 2ULL, 899, 2, 1, 0, 0, 28ULL, 900, 1, 2, 0, 0, 13ULL, 901, 2, 1, 0, 0, 13ULL, 902, 1, 2, 0, 0, 39ULL, 903, 2, 1, 0, 0, 2, 25341984803, 371, 1, 0, 0, 0, 4, 1, 0, 39ULL, 892, 1, 18ULL, 893, 2, 0, 1, 0, 34ULL, 894, 1, 2, 0, 0, 20ULL, 895, 2, 1, 0, 0, 17ULL, 896, 1, 2, 0, 0, 15ULL, 897, 2, 1, 0, 0, 41ULL, 898, 1, 2, 0, 0, 16ULL, 899, 2, 1, 0, 0, 2ULL, 900, 1, 2, 0, 0, 28ULL, 901, 2, 1, 0, 0, 13ULL, 902, 1, 2, 0, 0, 13ULL, 903, 2, 1, 0, 0, 2, 25341984804, 371, 1, 0, 0, 0, 4, 1, 0, 13ULL, 892, 1, 39ULL, 893, 2, 0, 1, 0, 18ULL, 894, 1, 2, 0, 0, 34ULL, 895, 2, 1, 0, 0, 20ULL, 896, 1, 2, 0, 0, 17ULL, 897, 2, 1, 0, 0, 15ULL, 898, 1, 2, 0, 0, 41ULL, 899, 2, 1, 0, 0, 16ULL, 900, 1, 2, 0, 0, 2ULL, 901, 2, 1, 0, 0, 28ULL, 902, 1, 2, 0, 0, 13ULL, 903, 2, 1, 0, 0, 2, 25341984805, 371, 1, 0, 0, 0, 4, 1, 0, 13ULL, 892, 1, 13ULL, 893, 2, 0, 1, 0, 39ULL, 894, 1, 2, 0, 0, 18ULL, 895, 2, 1, 0, 0, 34ULL, 896, 1, 2, 0, 0, 20ULL, 897, 2, 1, 0, 0, 17ULL, 898, 1, 2, 0, 0, 15ULL, 899, 2, 1, 0, 0, 41ULL, 900, 1, 2, 0, 0, 16ULL, 901, 2, 1, 0, 0, 2ULL, 902, 1, 2, 0, 0, 28ULL, 903, 2, 1, 0, 0, 2, 25341984806, 371, 1, 0, 0, 0, 4, 1, 0, 28ULL, 892, 1, 13ULL, 893, 2, 0, 1, 0, 13ULL, 894, 1, 2, 0, 0, 39ULL, 895, 2, 1, 0, 0, 18ULL, 896, 1, 2, 0, 0, 34ULL, 897, 2, 1, 0, 0, 20ULL, 898, 1, 2, 0, 0, 17ULL, 899, 2, 1, 0, 0, 15ULL, 900, 1, 2, 0, 0, 41ULL, 901, 2, 1, 0, 0, 16ULL, 902, 1, 2, 0, 0, 2ULL, 903, 2, 1, 0, 0, 2, 25341984807, 371, 1, 0, 0, 0, 4, 1, 0, 2ULL, 892, 1, 28ULL, 893, 2, 0, 1, 0, 13ULL, 894, 1, 2, 0, 0, 13ULL, 895, 2, 1, 0, 0, 39ULL, 896, 1, 2, 0, 0, 18ULL, 897, 2, 1, 0, 0, 34ULL, 898, 1, 2, 0, 0, 20ULL, 899, 2, 1, 0, 0, 17ULL, 900, 1, 2, 0, 0, 15ULL, 901, 2, 1, 0, 0, 41ULL, 902, 1, 2, 0, 0, 16ULL, 903, 2, 1, 0, 0, 2, 25341984808, 371, 1, 0, 0, 0, 4, 1, 0, 16ULL, 892, 1, 2ULL, 893, 2, 0, 1, 0, 28ULL, 894, 1, 2, 0, 0, 13ULL, 895, 2, 1, 0, 0, 13ULL, 896, 1, 2, 0, 0, 39ULL, 897, 2, 1, 0, 0, 18ULL, 898, 1, 2, 0, 0, 34ULL, 899, 2, 1, 0, 0, 20ULL, 900, 1, 2, 0, 0, 17ULL, 901, 2, 1, 0, 0, 15ULL, 902, 1, 2, 0, 0, 41ULL, 903, 2, 1, 0, 0, 2, 25341984809, 371, 1, 0, 0, 0, 4, 1, 0, 41ULL, 892, 1, 16ULL, 893, 2, 0, 1, 0, 2ULL, 894, 1, 2, 0, 0, 28ULL, 895, 2, 1, 0, 0, 13ULL, 896, 1, 2, 0, 0, 13ULL, 897, 2, 1, 0, 0, 39ULL, 898, 1, 2, 0, 0, 18ULL, 899, 2, 1, 0, 0, 34ULL, 900, 1, 2, 0, 0, 20ULL, 901, 2, 1, 0, 0, 17ULL, 902, 1, 2, 0, 0, 15ULL, 903, 2, 1, 0, 0, 2, 25341984810, 371, 1, 0, 0, 0, 4, 1, 0, 15ULL, 892, 1, 41ULL, 893, 2, 0, 1, 0, 16ULL, 894, 1, 2, 0, 0, 2ULL, 895, 2, 1, 0, 0, 28ULL, 896, 1, 2, 0, 0, 13ULL, 897, 2, 1, 0, 0, 13ULL, 898, 1, 2, 0, 0, 39ULL, 899, 2, 1, 0, 0, 18ULL, 900, 1, 2, 0, 0, 34ULL, 901, 2, 1, 0, 0, 20ULL, 902, 1, 2, 0, 0, 17ULL, 903, 2, 1, 0, 0, 2, 25341984811, 371, 1, 0, 0, 0, 4, 1, 0, 904, 12037652778, 665, 1, 146, 0, 0, 1, 25341984812, 371, 1, 0, 0, 0, 4, 1, 0, 904, 12037652778, 665, 1, 1ULL, 0, 0, 1, 12037652774, 665, 1, 0, 904, 0, 128ULL, 25341984812, 371, 2, 1, 0, 0, 2, 25341984813, 371, 1, 0, 0, 0, 4, 1, 0, 12037652794, 665, 25341984813, 371, 1, 0, 12037652802, 665, 0, 1, 25341984814, 371, 1, 0, 0, 0, 4, 1, 0, 12037652795, 665, 25341984813, 371, 1, 0, 12037652803, 665, 0, 1, 25341984815, 371, 1, 0, 0, 0, 4, 1, 0, 12037652796, 665, 25341984813, 371, 1, 0, 12037652804, 665, 0, 1, 25341984816, 371, 1, 0, 0, 0, 4, 1, 0, 12037652797, 665, 25341984813, 371, 1, 0, 12037652805, 665, 0, 1, 25341984817, 371, 1, 0, 0, 0, 4, 1, 0, 12037652798, 665, 25341984813, 371, 1, 0, 12037652806, 665, 0, 1, 25341984818, 371, 1, 0, 0, 0, 4, 1, 0, 12037652799, 665, 25341984813, 371, 1, 0, 12037652807, 665, 0, 1, 25341984819, 371, 1, 0, 0, 0, 4, 1, 0, 12037652800, 665, 25341984813, 371, 1, 0, 12037652808, 665, 0, 1, 25341984820, 371, 1, 0, 0, 0, 4, 1, 0, 12037652801, 665, 25341984813, 371, 1, 0, 12037652809, 665, 0, 1, 25341984821, 371, 1, 0, 0, 0, 4, 1, 0, 905, 12037652893, 665, 1, 1ULL, 0, 0, 1, 25341984822, 371, 1, 0, 0, 0, 4, 1, 0, 906, 25341984823, 371, 1, 0, 0, 0, 4, 1, 0, 907, 12037652925, 665, 1, 213, 0, 0, 1, 25341984824, 371, 1, 0, 0, 0, 4, 1, 0, 907, 12037652925, 665, 1, 214, 0, 0, 1, 25341984825, 371, 1, 0, 0, 0, 4, 1, 0, 907, 12037652925, 665, 1, 1ULL, 0, 0, 1, 12037652920, 665, 1, 0, 907, 0, 128ULL, 25341984824, 371, 2, 1, 0, 0, 2, 25341984826, 371, 1, 0, 0, 0, 4, 1, 0, 12037652941, 665, 25341984826, 371, 1, 0, 12037652949, 665, 0, 1, 25341984827, 371, 1, 0, 0, 0, 4, 1, 0, 12037652942, 665, 25341984826, 371, 1, 0, 12037652950, 665, 0, 1, 25341984828, 371, 1, 0, 0, 0, 4, 1, 0, 12037652943, 665, 25341984826, 371, 1, 0, 12037652951, 665, 0, 1, 25341984829, 371, 1, 0, 0, 0, 4, 1, 0, 12037652944, 665, 25341984826, 371, 1, 0, 12037652952, 665, 0, 1, 25341984830, 371, 1, 0, 0, 0, 4, 1, 0, 12037652945, 665, 25341984826, 371, 1, 0, 12037652953, 665, 0, 1, 25341984831, 371, 1, 0, 0, 0, 4, 1, 0, 12037652946, 665, 25341984826, 371, 1, 0, 12037652954, 665, 0, 1, 25341984832, 371, 1, 0, 0, 0, 4, 1, 0, 12037652947, 665, 25341984826, 371, 1, 0, 12037652955, 665, 0, 1, 25341984833, 371, 1, 0, 0, 0, 4, 1, 0, 12037652948, 665, 25341984826, 371, 1, 0, 12037652956, 665, 0, 1, 25341984834, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 908, 1, 1ULL, 12037652969, 665, 2, 0, 1, 0, 2, 25341984835, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 908, 1, 0, 12037652969, 665, 0, 1, 25341984836, 371, 1, 0, 0, 0, 4, 1, 0, 909, 12037653132, 665, 1, 1ULL, 0, 0, 1, 25341984837, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 911, 1, 12037653104, 665, 0, 0, 1, 25341984838, 371, 1, 0, 0, 0, 4, 1, 0, 1ULL, 12037653107, 665, 1, 12037653072, 665, 0, 0, 1ULL, 12037653082, 665, 2, 12037653073, 665, 0, 3, 1, 2, 0, 1ULL, 25341984837, 371, 1, 12037653074, 665, 0, 0, 3, 1, 1, 0, 25341984839, 371, 1, 1, 0, 0, 4, 1, 0, 12037653133, 665, 910, 1, 12037653135, 665, 0, 0, 12037653023, 665, 910, 2, 12037653106, 665, 0, 0, 1, 2, 1, 0, 910, 0, 1, 25341984840, 371, 1, 0, 0, 0, 4, 1, 1, 12037653022, 665, 1ULL, 0, 1ULL, 911, 2, 0, 12037653104, 665, 0, 1, 2, 1, 0, 25341984841, 371, 1, 1, 0, 0, 4, 1, 0, 912, 215, 1, 0, 25341984842, 371, 1, 1, 0, 0, 4, 1, 0, 913, 147, 1, 0, 25341984843, 371, 1, 1, 0, 2, 4, 1, 0, 914, 0, 1, 101, 0, 0, 0, 1, 1, 102, 0, 0, 0, 1, 1, 103, 0, 0, 0, 1, 1, 104, 0, 0, 0, 1, 1, 105, 0, 0, 0, 1, 1, 106, 0, 0, 0, 1, 1, 107, 0, 0, 0, 1, 1, 108, 0, 0, 0, 1, 1, 915, 0, 0, 0, 1, 1, 916, 0, 0, 0, 1, 1, 917, 0, 0, 0, 1, 1, 918, 0, 0, 0, 1, 1, 919, 0, 0, 0, 1, 1, 920, 0, 0, 0, 1, 1, 921, 0, 0, 1, 115, 1, 922, 0, 0, 1, 115, 1, 0, 25341984989, 371, 0, 2, 1, 1, 4, 0, 0, 923, 925, 1, 0, 924, 0, 1, 925, 1, 0, 25341984844, 371, 0, 1, 1, 2, 4, 0, 0, 109, 0, 1, 926, 0, 0, 0, 1, 1, 927, 0, 0, 0, 1, 1, 928, 0, 0, 0, 1, 1, 929, 0, 0, 0, 1, 1, 930, 0, 0, 0, 1, 1, 931, 0, 0, 0, 1, 1, 932, 0, 0, 0, 1, 1, 933, 0, 0, 0, 1, 1, 934, 0, 0, 0, 1, 1, 935, 0, 0, 1, 147, 1, 936, 0, 0, 1, 147, 1, 0, 25341984992, 371, 0, 2, 1, 2, 4, 0, 0, 937, 0, 1, 938, 0, 0, 0, 1, 1, 939, 0, 0, 0, 1, 1, 940, 0, 0, 0, 1, 1, 941, 0, 0, 0, 1, 1, 942, 0, 0, 0, 1, 1, 943, 0, 0, 0, 1, 1, 944, 0, 0, 0, 1, 1, 945, 0, 0, 0, 1, 1, 946, 0, 0, 0, 1, 1, 947, 0, 0, 1, 149, 1, 948, 0, 0, 1, 149, 1, 0, 25341984995, 371, 0, 2, 1, 4, 4, 0, 3, 99, 2, 0, 3, 100, 1, 101, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341984998, 371, 1, 4, 0, 4, 4, 1, 3, 102, 2, 0, 3, 103, 1, 104, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985001, 371, 1, 4, 0, 4, 4, 1, 3, 949, 2, 0, 950, 3, 1, 951, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985004, 371, 1, 4, 0, 4, 4, 1, 3, 952, 2, 0, 953, 3, 1, 954, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985007, 371, 1, 4, 0, 4, 4, 1, 3, 955, 2, 0, 956, 3, 1, 957, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985010, 371, 1, 4, 0, 4, 4, 1, 3, 958, 2, 0, 959, 3, 1, 960, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985013, 371, 1, 4, 0, 4, 4, 1, 3, 105, 2, 0, 3, 106, 1, 107, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985016, 371, 1, 4, 0, 4, 4, 1, 3, 961, 2, 0, 962, 3, 1, 963, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985019, 371, 1, 4, 0, 4, 4, 1, 3, 964, 2, 0, 965, 3, 1, 966, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985022, 371, 1, 4, 0, 4, 4, 1, 3, 967, 2, 0, 968, 3, 1, 969, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985025, 371, 1, 4, 0, 4, 4, 1, 3, 108, 2, 0, 3, 109, 1, 110, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985028, 371, 1, 4, 0, 4, 4, 1, 3, 111, 2, 0, 3, 112, 1, 113, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985031, 371, 1, 4, 0, 4, 4, 1, 3, 970, 2, 0, 971, 3, 1, 972, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985034, 371, 1, 4, 0, 4, 4, 1, 3, 25341984989, 371, 2, 0, 3, 114, 1, 115, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985037, 371, 1, 4, 0, 4, 4, 1, 3, 116, 2, 0, 3, 117, 1, 118, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985040, 371, 1, 4, 0, 4, 4, 1, 3, 119, 2, 0, 3, 120, 1, 121, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985043, 371, 1, 4, 0, 4, 4, 1, 3, 122, 2, 0, 3, 123, 1, 124, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985046, 371, 1, 4, 0, 4, 4, 1, 3, 125, 2, 0, 3, 126, 1, 127, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985049, 371, 1, 4, 0, 4, 4, 1, 3, 128, 2, 0, 3, 129, 1, 130, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985052, 371, 1, 4, 0, 4, 4, 1, 3, 131, 2, 0, 3, 132, 1, 133, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985055, 371, 1, 4, 0, 4, 4, 1, 3, 134, 2, 0, 3, 135, 1, 136, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985058, 371, 1, 4, 0, 4, 4, 1, 3, 137, 2, 0, 3, 138, 1, 139, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985061, 371, 1, 4, 0, 4, 4, 1, 3, 140, 2, 0, 3, 141, 1, 142, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985064, 371, 1, 4, 0, 4, 4, 1, 3, 973, 2, 0, 974, 3, 1, 975, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985067, 371, 1, 4, 0, 4, 4, 1, 3, 143, 2, 0, 3, 144, 1, 145, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985070, 371, 1, 4, 0, 4, 4, 1, 3, 25341984992, 371, 2, 0, 3, 146, 1, 147, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985073, 371, 1, 4, 0, 4, 4, 1, 3, 25341984995, 371, 2, 0, 3, 148, 1, 149, 0, 0, 1ULL, 3, 2, 2, 0, 0, 1, 2, 1, 3, 0, 0, 1ULL, 3, 2, 1, 0, 0, 2, 25341985076, 371, 1, 4, 0, 2, 4, 1, 0, 150, 3, 1, 0, 25341985079, 371, 0, 2, 1, 1, 4, 0, 0, 151, 3, 2, 0, 25341985082, 371, 0, 1, 2, 1, 4, 0, 0, 152, 3, 2, 0, 25341985085, 371, 0, 1, 2, 1, 4, 0, 0, 153, 3, 2, 0, 25341985088, 371, 0, 1, 2, 1, 4, 0, 0, 154, 3, 2, 0, 25341985091, 371, 0, 1, 2, 1, 4, 0, 0, 155, 3, 2, 0, 25341985094, 371, 0, 1, 2, 1, 4, 0, 0, 156, 3, 2, 0, 25341985097, 371, 0, 1, 2, 1, 4, 0, 0, 157, 3, 2, 0, 25341985100, 371, 0, 1, 2, 1, 4, 0, 0, 158, 3, 2, 0, 25341985103, 371, 0, 1, 2, 1, 4, 0, 0, 159, 3, 2, 0, 25341985106, 371, 0, 1, 2, 1, 4, 0, 0, 160, 3, 2, 0, 25341985109, 371, 0, 1, 2, 1, 4, 0, 0, 161, 3, 2, 0, 25341985112, 371, 0, 1, 2, 1, 4, 0, 0, 162, 3, 2, 0, 25341985115, 371, 0, 1, 2, 1, 4, 0, 0, 163, 3, 2, 0, 25341985118, 371, 0, 1, 2, 1, 4, 0, 0, 164, 3, 2, 0, 25341985121, 371, 0, 1, 2, 1, 4, 0, 0, 165, 3, 2, 0, 25341985124, 371, 0, 1, 2, 2, 4, 0, 0, 4756475762779100925ULL, 3, 1, 0, 0, 5, 1, 1, 0, 2, 0, 166, 1, 1, 0, 25341985127, 371, 0, 2, 1, 2, 4, 0, 0, 4, 3, 1, 5, 0, 0, 1, 2, 1, 167, 0, 0, 1, 25341985130, 371, 1, 2, 0, 2, 4, 1, 0, 4756475762779100925ULL, 3, 1, 0, 0, 7, 1, 1, 0, 2, 0, 168, 1, 1, 0, 25341985133, 371, 0, 2, 1, 2, 4, 0, 0, 6, 3, 1, 7, 0, 0, 1, 2, 1, 169, 0, 0, 1, 25341985136, 371, 1, 2, 0, 1};
@@ -0,0 +1,170 @@
+#include <map>
+#include <algorithm> // std::max
+#include <vector>
+#include <omp.h>
+#include "goldilocks_cubic_extension.hpp"
+#include "zhInv.hpp"
+#include "starks.hpp"
+#include "constant_pols_starks.hpp"
+#include "zkevmSteps.hpp"
+#include "zkevm.chelpers.step42ns.parser.hpp"
+#include "zkevm.chelpers.step42ns.parser.tiled.hpp" // Generated by chelpersGenerator --tiled
+
+#define STEP42NS_TILE_MIN_ROWS 64 // Blocks start at multiples of it, so zi(i) is the same for the block rows
+
+/*
+    Evaluates step42ns by blocks of rows whose polynomial columns fit in tileBytes, e.g. the L2 cache size.
+    For every block, a thread copies the columns read by the expression into a contiguous buffer, one column after
+    the other, with the 1 or 3 elements of every row of a column together, and the constant polynomials of the block
+    rows, including the next rows they reference. Then it runs the parser over the buffer, with the arguments remapped
+    to it, so that every column is read from consecutive addresses instead of from one distant row of every section.
+    Returns false if tileBytes does not fit a block of STEP42NS_TILE_MIN_ROWS rows.
+*/
+bool ZkevmSteps::step42ns_parser_first_tiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch, uint64_t tileBytes)
+{
+    // Find the columns read by the expression, i.e. the different (offset, stride) arguments, with the largest number of
+    // elements per row read from them, and the largest next row
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> columns;
+    uint64_t nextRows = 0;
+    uint64_t i_args = 0;
+    for (uint64_t kk = 0; kk < NOPS_; kk++)
+    {
+        zkassert(op42[kk] < step42nsOps.size());
+        const Step42nsOp &op = step42nsOps[op42[kk]];
+        for (uint64_t k = 0; k < op.args.size(); k++)
+        {
+            const Step42nsArg &arg = op.args[k];
+            if (arg.type != STEP42NS_POLS)
+            {
+                zkassert(args42[i_args + arg.modulus] == nrows);
+                nextRows = std::max(nextRows, args42[i_args + arg.next]);
+            }
+            if (arg.type != STEP42NS_CONST_NEXT)
+            {
+                uint64_t &dim = columns[std::make_pair(args42[i_args + arg.offset], args42[i_args + arg.stride])];
+                dim = std::max(dim, arg.dim);
+            }
+        }
+        i_args += op.nArgs;
+    }
+    zkassert(i_args == NARGS_);
+
+    // Columns are copied in the order of their offsets, every one taking dim elements per row
+    std::vector<uint64_t> columnOffsets;
+    std::vector<uint64_t> columnStrides;
+    std::vector<uint64_t> columnDims;
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> columnIndexes;
+    uint64_t columnsWidth = 0;
+    for (auto it = columns.begin(); it != columns.end(); it++)
+    {
+        columnIndexes[it->first] = columnOffsets.size();
+        columnOffsets.push_back(it->first.first);
+        columnStrides.push_back(it->first.second);
+        columnDims.push_back(it->second);
+        columnsWidth += it->second;
+    }
+    uint64_t nColumns = columnOffsets.size();
+    uint64_t numpols = params.pConstPols2ns->numPols();
+
+    // Rows of every block, a power of two so that the blocks divide nrows
+    uint64_t blockRows = nrows;
+    while ((blockRows > STEP42NS_TILE_MIN_ROWS) && ((blockRows + nextRows) * (columnsWidth + numpols) * sizeof(Goldilocks::Element) > tileBytes))
+    {
+        blockRows >>= 1;
+    }
+    if ((blockRows < STEP42NS_TILE_MIN_ROWS) || (blockRows + nextRows > nrows) || ((blockRows + nextRows) * (columnsWidth + numpols) * sizeof(Goldilocks::Element) > tileBytes))
+    {
+        return false;
+    }
+    uint64_t stageRows = blockRows + nextRows;
+
+    // Start of every column in the block buffer, where element d of row i of a column is at start + (i - blockStart) * dim + d
+    std::vector<uint64_t> columnStarts(nColumns);
+    for (uint64_t c = 0, start = 0; c < nColumns; c++)
+    {
+        columnStarts[c] = start;
+        start += stageRows * columnDims[c];
+    }
+
+    // Remap the arguments to the block buffer
+    std::vector<uint64_t> tiledArgs(args42, args42 + NARGS_);
+    i_args = 0;
+    for (uint64_t kk = 0; kk < NOPS_; kk++)
+    {
+        const Step42nsOp &op = step42nsOps[op42[kk]];
+        for (uint64_t k = 0; k < op.args.size(); k++)
+        {
+            const Step42nsArg &arg = op.args[k];
+            if (arg.type == STEP42NS_CONST_NEXT)
+                continue;
+            uint64_t column = columnIndexes[std::make_pair(args42[i_args + arg.offset], args42[i_args + arg.stride])];
+            tiledArgs[i_args + arg.offset] = columnStarts[column];
+            tiledArgs[i_args + arg.stride] = columnDims[column];
+            if (arg.type == STEP42NS_POLS_NEXT)
+            {
+                tiledArgs[i_args + arg.modulus] = stageRows;
+            }
+        }
+        i_args += op.nArgs;
+    }
+
+    uint64_t stageSize = stageRows * (columnsWidth + numpols);
+    uint64_t nThreads = omp_get_max_threads();
+    Goldilocks::Element *pStage = (Goldilocks::Element *)malloc(nThreads * stageSize * sizeof(Goldilocks::Element));
+    if (pStage == NULL)
+    {
+        cerr << "Error: ZkevmSteps::step42ns_parser_first_tiled() failed calling malloc() of size " << nThreads * stageSize * sizeof(Goldilocks::Element) << endl;
+        exit(-1);
+    }
+
+#pragma omp parallel for
+    for (uint64_t blockStart = 0; blockStart < nrows; blockStart += blockRows)
+    {
+        Goldilocks::Element *stage = &pStage[omp_get_thread_num() * stageSize];
+        Goldilocks::Element *stageConst = &stage[columnsWidth * stageRows];
+        for (uint64_t k = 0; k < stageRows; k++)
+        {
+            uint64_t row = (blockStart + k) % nrows;
+            for (uint64_t c = 0; c < nColumns; c++)
+            {
+                for (uint64_t d = 0; d < columnDims[c]; d++)
+                {
+                    stage[columnStarts[c] + k * columnDims[c] + d] = params.pols[columnOffsets[c] + row * columnStrides[c] + d];
+                }
+            }
+            std::memcpy(&stageConst[k * numpols], &params.pConstPols2ns->getElement(0, row), numpols * sizeof(Goldilocks::Element));
+        }
+
+        ConstantPolsStarks constPols2ns(stageConst, stageRows, numpols);
+        Polinomial x_2ns(params.x_2ns[blockStart], blockRows, 1, params.x_2ns.offset());
+        StepsParams blockParams = {
+            pols : stage,
+            pConstPols : params.pConstPols,
+            pConstPols2ns : &constPols2ns,
+            challenges : params.challenges,
+            x_n : params.x_n,
+            x_2ns : x_2ns,
+            zi : params.zi,
+            evals : params.evals,
+            xDivXSubXi : params.xDivXSubXi,
+            xDivXSubWXi : params.xDivXSubWXi,
+            publicInputs : params.publicInputs,
+            q_2ns : &params.q_2ns[blockStart * FIELD_EXTENSION],
+            f_2ns : params.f_2ns
+        };
+
+        // Rows 0 to blockRows of blockParams are rows blockStart to blockStart + blockRows; the parser loop is not
+        // parallelized again inside this parallel region
+        if (nrowsBatch == NROWS_STEPS_AVX512_)
+        {
+            step42ns_parser_first_avx512_args(blockParams, blockRows, nrowsBatch, tiledArgs.data());
+        }
+        else
+        {
+            step42ns_parser_first_avx_args(blockParams, blockRows, nrowsBatch, tiledArgs.data());
+        }
+    }
+
+    free(pStage);
+    return true;
+}
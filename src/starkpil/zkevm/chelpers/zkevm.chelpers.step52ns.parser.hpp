@@ -2,7 +2,7 @@
 #define NARGS_ 6761
 
 
-uint64_t op52[NOPS_] = { 0, 10, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 3, 14, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 19, 18, 18, 19, 19, 18, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 18, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 20, 20, 18, 18, 18, 18, 20, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 20, 20, 20, 20, 20, 5, 8, 3, 11, 4, 11, 7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 18, 20, 18, 20, 18, 20, 18, 20, 20, 20, 18, 20, 18, 20, 18, 20, 20, 20, 20, 20, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 19, 20, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 6, 8, 15};
+inline uint64_t op52[NOPS_] = { 0, 10, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 3, 14, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 19, 19, 18, 18, 19, 19, 18, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 19, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 18, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 20, 20, 18, 18, 18, 18, 20, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 20, 20, 20, 20, 20, 5, 8, 3, 11, 4, 11, 7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 18, 20, 18, 20, 18, 20, 18, 20, 20, 20, 18, 20, 18, 20, 18, 20, 20, 20, 20, 20, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 19, 20, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 6, 8, 15};
 
 
-uint64_t args52[NARGS_] = { 12037652480, 665, 12037652481, 665, 12037652482, 665, 12037652483, 665, 12037652484, 665, 12037652485, 665, 12037652486, 665, 12037652487, 665, 12037652488, 665, 12037652489, 665, 12037652490, 665, 12037652491, 665, 12037652492, 665, 12037652493, 665, 12037652494, 665, 12037652495, 665, 12037652496, 665, 12037652497, 665, 12037652498, 665, 12037652499, 665, 12037652500, 665, 12037652501, 665, 12037652502, 665, 12037652503, 665, 12037652504, 665, 12037652505, 665, 12037652506, 665, 12037652507, 665, 12037652508, 665, 12037652509, 665, 12037652510, 665, 12037652511, 665, 12037652512, 665, 12037652513, 665, 12037652514, 665, 12037652515, 665, 12037652516, 665, 12037652517, 665, 12037652518, 665, 12037652519, 665, 12037652520, 665, 12037652521, 665, 12037652522, 665, 12037652523, 665, 12037652524, 665, 12037652525, 665, 12037652526, 665, 12037652527, 665, 12037652528, 665, 12037652529, 665, 12037652530, 665, 12037652531, 665, 12037652532, 665, 12037652533, 665, 12037652534, 665, 12037652535, 665, 12037652536, 665, 12037652537, 665, 12037652538, 665, 12037652539, 665, 12037652540, 665, 12037652541, 665, 12037652542, 665, 12037652543, 665, 12037652544, 665, 12037652545, 665, 12037652546, 665, 12037652547, 665, 12037652548, 665, 12037652549, 665, 12037652550, 665, 12037652551, 665, 12037652552, 665, 12037652553, 665, 12037652554, 665, 12037652555, 665, 12037652556, 665, 12037652557, 665, 12037652558, 665, 12037652559, 665, 12037652560, 665, 12037652561, 665, 12037652562, 665, 12037652563, 665, 12037652564, 665, 12037652565, 665, 12037652566, 665, 12037652567, 665, 12037652568, 665, 12037652569, 665, 12037652570, 665, 12037652571, 665, 12037652572, 665, 12037652573, 665, 12037652574, 665, 12037652575, 665, 12037652576, 665, 12037652577, 665, 12037652578, 665, 12037652579, 665, 12037652580, 665, 12037652581, 665, 12037652582, 665, 12037652583, 665, 12037652584, 665, 12037652585, 665, 12037652586, 665, 12037652587, 665, 12037652588, 665, 12037652589, 665, 12037652590, 665, 12037652591, 665, 12037652592, 665, 12037652593, 665, 12037652594, 665, 12037652595, 665, 12037652596, 665, 12037652597, 665, 12037652598, 665, 12037652599, 665, 12037652600, 665, 12037652601, 665, 12037652602, 665, 12037652603, 665, 12037652604, 665, 12037652605, 665, 12037652606, 665, 12037652607, 665, 12037652608, 665, 12037652609, 665, 12037652610, 665, 12037652611, 665, 12037652612, 665, 12037652613, 665, 12037652614, 665, 12037652615, 665, 12037652616, 665, 12037652617, 665, 12037652618, 665, 12037652619, 665, 12037652620, 665, 12037652621, 665, 12037652622, 665, 12037652623, 665, 12037652624, 665, 12037652625, 665, 12037652626, 665, 12037652627, 665, 12037652628, 665, 12037652629, 665, 12037652630, 665, 12037652631, 665, 12037652632, 665, 12037652633, 665, 12037652634, 665, 12037652635, 665, 12037652636, 665, 12037652637, 665, 12037652638, 665, 12037652639, 665, 12037652640, 665, 12037652641, 665, 12037652642, 665, 12037652643, 665, 12037652644, 665, 12037652645, 665, 12037652646, 665, 12037652647, 665, 12037652648, 665, 12037652649, 665, 12037652650, 665, 12037652651, 665, 12037652652, 665, 12037652653, 665, 12037652654, 665, 12037652655, 665, 12037652656, 665, 12037652657, 665, 12037652658, 665, 12037652659, 665, 12037652660, 665, 12037652661, 665, 12037652662, 665, 12037652663, 665, 12037652664, 665, 12037652665, 665, 12037652666, 665, 12037652667, 665, 12037652668, 665, 12037652669, 665, 12037652670, 665, 12037652671, 665, 12037652672, 665, 12037652673, 665, 12037652674, 665, 12037652675, 665, 12037652676, 665, 12037652677, 665, 12037652678, 665, 12037652679, 665, 12037652680, 665, 12037652681, 665, 12037652682, 665, 12037652683, 665, 12037652684, 665, 12037652685, 665, 12037652686, 665, 12037652687, 665, 12037652688, 665, 12037652689, 665, 12037652690, 665, 12037652691, 665, 12037652692, 665, 12037652693, 665, 12037652694, 665, 12037652695, 665, 12037652696, 665, 12037652697, 665, 12037652698, 665, 12037652699, 665, 12037652700, 665, 12037652701, 665, 12037652702, 665, 12037652703, 665, 12037652704, 665, 12037652705, 665, 12037652706, 665, 12037652707, 665, 12037652708, 665, 12037652709, 665, 12037652710, 665, 12037652711, 665, 12037652712, 665, 12037652713, 665, 12037652714, 665, 12037652715, 665, 12037652716, 665, 12037652717, 665, 12037652718, 665, 12037652719, 665, 12037652720, 665, 12037652721, 665, 12037652722, 665, 12037652723, 665, 12037652724, 665, 12037652725, 665, 12037652726, 665, 12037652727, 665, 12037652728, 665, 12037652729, 665, 12037652730, 665, 12037652731, 665, 12037652732, 665, 12037652733, 665, 12037652734, 665, 12037652735, 665, 12037652736, 665, 12037652737, 665, 12037652738, 665, 12037652739, 665, 12037652740, 665, 12037652741, 665, 12037652742, 665, 12037652743, 665, 12037652744, 665, 12037652745, 665, 12037652746, 665, 12037652747, 665, 12037652748, 665, 12037652749, 665, 12037652750, 665, 12037652751, 665, 12037652752, 665, 12037652753, 665, 12037652754, 665, 12037652755, 665, 12037652756, 665, 12037652757, 665, 12037652758, 665, 12037652759, 665, 12037652760, 665, 12037652761, 665, 12037652762, 665, 12037652763, 665, 12037652764, 665, 12037652765, 665, 12037652766, 665, 12037652767, 665, 12037652768, 665, 12037652769, 665, 12037652770, 665, 12037652771, 665, 12037652772, 665, 12037652773, 665, 12037652774, 665, 12037652775, 665, 12037652776, 665, 12037652777, 665, 12037652778, 665, 12037652779, 665, 12037652780, 665, 12037652781, 665, 12037652782, 665, 12037652783, 665, 12037652784, 665, 12037652785, 665, 12037652786, 665, 12037652787, 665, 12037652788, 665, 12037652789, 665, 12037652790, 665, 12037652791, 665, 12037652792, 665, 12037652793, 665, 12037652794, 665, 12037652795, 665, 12037652796, 665, 12037652797, 665, 12037652798, 665, 12037652799, 665, 12037652800, 665, 12037652801, 665, 12037652802, 665, 12037652803, 665, 12037652804, 665, 12037652805, 665, 12037652806, 665, 12037652807, 665, 12037652808, 665, 12037652809, 665, 12037652810, 665, 12037652811, 665, 12037652812, 665, 12037652813, 665, 12037652814, 665, 12037652815, 665, 12037652816, 665, 12037652817, 665, 12037652818, 665, 12037652819, 665, 12037652820, 665, 12037652821, 665, 12037652822, 665, 12037652823, 665, 12037652824, 665, 12037652825, 665, 12037652826, 665, 12037652827, 665, 12037652828, 665, 12037652829, 665, 12037652830, 665, 12037652831, 665, 12037652832, 665, 12037652833, 665, 12037652834, 665, 12037652835, 665, 12037652836, 665, 12037652837, 665, 12037652838, 665, 12037652839, 665, 12037652840, 665, 12037652841, 665, 12037652842, 665, 12037652843, 665, 12037652844, 665, 12037652845, 665, 12037652846, 665, 12037652847, 665, 12037652848, 665, 12037652849, 665, 12037652850, 665, 12037652851, 665, 12037652852, 665, 12037652853, 665, 12037652854, 665, 12037652855, 665, 12037652856, 665, 12037652857, 665, 12037652858, 665, 12037652859, 665, 12037652860, 665, 12037652861, 665, 12037652862, 665, 12037652863, 665, 12037652864, 665, 12037652865, 665, 12037652866, 665, 12037652867, 665, 12037652868, 665, 12037652869, 665, 12037652870, 665, 12037652871, 665, 12037652872, 665, 12037652873, 665, 12037652874, 665, 12037652875, 665, 12037652876, 665, 12037652877, 665, 12037652878, 665, 12037652879, 665, 12037652880, 665, 12037652881, 665, 12037652882, 665, 12037652883, 665, 12037652884, 665, 12037652885, 665, 12037652886, 665, 12037652887, 665, 12037652888, 665, 12037652889, 665, 12037652890, 665, 12037652891, 665, 12037652892, 665, 12037652893, 665, 12037652894, 665, 12037652895, 665, 12037652896, 665, 12037652897, 665, 12037652898, 665, 12037652899, 665, 12037652900, 665, 12037652901, 665, 12037652902, 665, 12037652903, 665, 12037652904, 665, 12037652905, 665, 12037652906, 665, 12037652907, 665, 12037652908, 665, 12037652909, 665, 12037652910, 665, 12037652911, 665, 12037652912, 665, 12037652913, 665, 12037652914, 665, 12037652915, 665, 12037652916, 665, 12037652917, 665, 12037652918, 665, 12037652919, 665, 12037652920, 665, 12037652921, 665, 12037652922, 665, 12037652923, 665, 12037652924, 665, 12037652925, 665, 12037652926, 665, 12037652927, 665, 12037652928, 665, 12037652929, 665, 12037652930, 665, 12037652931, 665, 12037652932, 665, 12037652933, 665, 12037652934, 665, 12037652935, 665, 12037652936, 665, 12037652937, 665, 12037652938, 665, 12037652939, 665, 12037652940, 665, 12037652941, 665, 12037652942, 665, 12037652943, 665, 12037652944, 665, 12037652945, 665, 12037652946, 665, 12037652947, 665, 12037652948, 665, 12037652949, 665, 12037652950, 665, 12037652951, 665, 12037652952, 665, 12037652953, 665, 12037652954, 665, 12037652955, 665, 12037652956, 665, 12037652957, 665, 12037652958, 665, 12037652959, 665, 12037652960, 665, 12037652961, 665, 12037652962, 665, 12037652963, 665, 12037652964, 665, 12037652965, 665, 12037652966, 665, 12037652967, 665, 12037652968, 665, 12037652969, 665, 12037652970, 665, 12037652971, 665, 12037652972, 665, 12037652973, 665, 12037652974, 665, 12037652975, 665, 12037652976, 665, 12037652977, 665, 12037652978, 665, 12037652979, 665, 12037652980, 665, 12037652981, 665, 12037652982, 665, 12037652983, 665, 12037652984, 665, 12037652985, 665, 12037652986, 665, 12037652987, 665, 12037652988, 665, 12037652989, 665, 12037652990, 665, 12037652991, 665, 12037652992, 665, 12037652993, 665, 12037652994, 665, 12037652995, 665, 12037652996, 665, 12037652997, 665, 12037652998, 665, 12037652999, 665, 12037653000, 665, 12037653001, 665, 12037653002, 665, 12037653003, 665, 12037653004, 665, 12037653005, 665, 12037653006, 665, 12037653007, 665, 12037653008, 665, 12037653009, 665, 12037653010, 665, 12037653011, 665, 12037653012, 665, 12037653013, 665, 12037653014, 665, 12037653015, 665, 12037653016, 665, 12037653017, 665, 12037653018, 665, 12037653019, 665, 12037653020, 665, 12037653021, 665, 12037653022, 665, 12037653023, 665, 12037653024, 665, 12037653025, 665, 12037653026, 665, 12037653027, 665, 12037653028, 665, 12037653029, 665, 12037653030, 665, 12037653031, 665, 12037653032, 665, 12037653033, 665, 12037653034, 665, 12037653035, 665, 12037653036, 665, 12037653037, 665, 12037653038, 665, 12037653039, 665, 12037653040, 665, 12037653041, 665, 12037653042, 665, 12037653043, 665, 12037653044, 665, 12037653045, 665, 12037653046, 665, 12037653047, 665, 12037653048, 665, 12037653049, 665, 12037653050, 665, 12037653051, 665, 12037653052, 665, 12037653053, 665, 12037653054, 665, 12037653055, 665, 12037653056, 665, 12037653057, 665, 12037653058, 665, 12037653059, 665, 12037653060, 665, 12037653061, 665, 12037653062, 665, 12037653063, 665, 12037653064, 665, 12037653065, 665, 12037653066, 665, 12037653067, 665, 12037653068, 665, 12037653069, 665, 12037653070, 665, 12037653071, 665, 12037653072, 665, 12037653073, 665, 12037653074, 665, 12037653075, 665, 12037653076, 665, 12037653077, 665, 12037653078, 665, 12037653079, 665, 12037653080, 665, 12037653081, 665, 12037653082, 665, 12037653083, 665, 12037653084, 665, 12037653085, 665, 12037653086, 665, 12037653087, 665, 12037653088, 665, 12037653089, 665, 12037653090, 665, 12037653091, 665, 12037653092, 665, 12037653093, 665, 12037653094, 665, 12037653095, 665, 12037653096, 665, 12037653097, 665, 12037653098, 665, 12037653099, 665, 12037653100, 665, 12037653101, 665, 12037653102, 665, 12037653103, 665, 12037653104, 665, 12037653105, 665, 12037653106, 665, 12037653107, 665, 12037653108, 665, 12037653109, 665, 12037653110, 665, 12037653111, 665, 12037653112, 665, 12037653113, 665, 12037653114, 665, 12037653115, 665, 12037653116, 665, 12037653117, 665, 12037653118, 665, 12037653119, 665, 12037653120, 665, 12037653121, 665, 12037653122, 665, 12037653123, 665, 12037653124, 665, 12037653125, 665, 12037653126, 665, 12037653127, 665, 12037653128, 665, 12037653129, 665, 12037653130, 665, 12037653131, 665, 12037653132, 665, 12037653133, 665, 12037653134, 665, 12037653135, 665, 12037653136, 665, 12037653137, 665, 12037653138, 665, 12037653139, 665, 12037653140, 665, 12037653141, 665, 12037653142, 665, 12037653143, 665, 12037653144, 665, 23194501140, 128, 23194501143, 128, 23194501146, 128, 23194501149, 128, 23194501120, 128, 23194501121, 128, 23194501122, 128, 23194501123, 128, 23194501124, 128, 23194501125, 128, 23194501126, 128, 23194501127, 128, 23194501152, 128, 23194501155, 128, 23194501128, 128, 23194501129, 128, 23194501130, 128, 23194501131, 128, 23194501132, 128, 23194501133, 128, 23194501158, 128, 23194501161, 128, 23194501164, 128, 23194501167, 128, 23194501134, 128, 23194501135, 128, 23194501170, 128, 23194501173, 128, 23194501176, 128, 23194501179, 128, 23194501182, 128, 23194501185, 128, 23194501188, 128, 23194501191, 128, 23194501194, 128, 23194501197, 128, 23194501200, 128, 23194501203, 128, 23194501206, 128, 23194501209, 128, 23194501212, 128, 23194501215, 128, 23194501218, 128, 23194501221, 128, 23194501224, 128, 23194501227, 128, 23194501136, 128, 23194501137, 128, 23194501138, 128, 23194501139, 128, 23194501230, 128, 23194501233, 128, 23194501236, 128, 23194501239, 128, 23194501242, 128, 23194501245, 128, 25341984845, 371, 25341984848, 371, 25341984851, 371, 25341984854, 371, 25341984857, 371, 25341984860, 371, 25341984863, 371, 25341984866, 371, 25341984869, 371, 25341984872, 371, 25341984875, 371, 25341984878, 371, 25341984881, 371, 25341984884, 371, 25341984887, 371, 25341984890, 371, 25341984893, 371, 25341984896, 371, 25341984899, 371, 25341984902, 371, 25341984905, 371, 25341984908, 371, 25341984911, 371, 25341984914, 371, 25341984917, 371, 25341984920, 371, 25341984923, 371, 25341984926, 371, 25341984929, 371, 25341984932, 371, 25341984935, 371, 25341984938, 371, 25341984941, 371, 25341984944, 371, 25341984947, 371, 25341984950, 371, 25341984953, 371, 25341984956, 371, 25341984959, 371, 25341984962, 371, 25341984965, 371, 25341984968, 371, 25341984971, 371, 25341984974, 371, 25341984977, 371, 25341984980, 371, 25341984983, 371, 25341984986, 371, 25341984768, 371, 25341984769, 371, 25341984770, 371, 25341984771, 371, 25341984772, 371, 25341984773, 371, 25341984774, 371, 25341984775, 371, 25341984776, 371, 25341984777, 371, 25341984778, 371, 25341984779, 371, 25341984780, 371, 25341984781, 371, 25341984782, 371, 25341984783, 371, 25341984784, 371, 25341984785, 371, 25341984786, 371, 25341984787, 371, 25341984788, 371, 25341984789, 371, 25341984790, 371, 25341984791, 371, 25341984792, 371, 25341984793, 371, 25341984794, 371, 25341984795, 371, 25341984796, 371, 25341984797, 371, 25341984798, 371, 25341984799, 371, 25341984800, 371, 25341984801, 371, 25341984802, 371, 25341984803, 371, 25341984804, 371, 25341984805, 371, 25341984806, 371, 25341984807, 371, 25341984808, 371, 25341984809, 371, 25341984810, 371, 25341984811, 371, 25341984812, 371, 25341984813, 371, 25341984814, 371, 25341984815, 371, 25341984816, 371, 25341984817, 371, 25341984818, 371, 25341984819, 371, 25341984820, 371, 25341984821, 371, 25341984822, 371, 25341984823, 371, 25341984824, 371, 25341984825, 371, 25341984826, 371, 25341984827, 371, 25341984828, 371, 25341984829, 371, 25341984830, 371, 25341984831, 371, 25341984832, 371, 25341984833, 371, 25341984834, 371, 25341984835, 371, 25341984836, 371, 25341984837, 371, 25341984838, 371, 25341984839, 371, 25341984840, 371, 25341984841, 371, 25341984842, 371, 25341984843, 371, 25341984989, 371, 25341984844, 371, 25341984992, 371, 25341984995, 371, 25341984998, 371, 25341985001, 371, 25341985004, 371, 25341985007, 371, 25341985010, 371, 25341985013, 371, 25341985016, 371, 25341985019, 371, 25341985022, 371, 25341985025, 371, 25341985028, 371, 25341985031, 371, 25341985034, 371, 25341985037, 371, 25341985040, 371, 25341985043, 371, 25341985046, 371, 25341985049, 371, 25341985052, 371, 25341985055, 371, 25341985058, 371, 25341985061, 371, 25341985064, 371, 25341985067, 371, 25341985070, 371, 25341985073, 371, 25341985076, 371, 25341985079, 371, 25341985082, 371, 25341985085, 371, 25341985088, 371, 25341985091, 371, 25341985094, 371, 25341985097, 371, 25341985100, 371, 25341985103, 371, 25341985106, 371, 25341985109, 371, 25341985112, 371, 25341985115, 371, 25341985118, 371, 25341985121, 371, 25341985124, 371, 25341985127, 371, 25341985130, 371, 25341985133, 371, 25341985136, 371, 31566331904, 6, 31566331907, 6, 12037652483, 665, 2, 12037652534, 665, 4, 12037652484, 665, 6, 12037652535, 665, 7, 12037652536, 665, 8, 12037652537, 665, 9, 12037652485, 665, 10, 85, 11, 12037652480, 665, 12, 12037652486, 665, 14, 86, 15, 12037652487, 665, 17, 87, 18, 12037652488, 665, 20, 88, 21, 12037652489, 665, 23, 89, 24, 12037652490, 665, 26, 90, 27, 12037652491, 665, 29, 91, 30, 12037652492, 665, 32, 92, 33, 12037652493, 665, 35, 12037652481, 665, 36, 12037652494, 665, 38, 12037652495, 665, 40, 12037652496, 665, 42, 12037652497, 665, 44, 12037652498, 665, 46, 12037652499, 665, 48, 12037652500, 665, 50, 12037652501, 665, 52, 25341984768, 371, 53, 12037652502, 665, 55, 12037652503, 665, 57, 12037652504, 665, 59, 12037652505, 665, 61, 12037652506, 665, 63, 12037652507, 665, 65, 12037652508, 665, 67, 12037652509, 665, 69, 25341984769, 371, 70, 12037652510, 665, 72, 12037652511, 665, 74, 12037652512, 665, 76, 12037652513, 665, 78, 12037652514, 665, 80, 12037652515, 665, 82, 12037652516, 665, 84, 12037652517, 665, 86, 12037652526, 665, 87, 25341984770, 371, 88, 12037652518, 665, 90, 12037652527, 665, 91, 12037652519, 665, 93, 12037652528, 665, 94, 12037652520, 665, 96, 12037652529, 665, 97, 12037652521, 665, 99, 12037652530, 665, 100, 12037652522, 665, 102, 12037652531, 665, 103, 12037652523, 665, 105, 12037652532, 665, 106, 12037652524, 665, 108, 12037652533, 665, 109, 12037652698, 665, 111, 12037652699, 665, 112, 12037652700, 665, 113, 36, 114, 12037652538, 665, 116, 12037652539, 665, 118, 12037652540, 665, 120, 12037652541, 665, 122, 12037652542, 665, 124, 12037652543, 665, 126, 12037652544, 665, 128, 12037652545, 665, 130, 12037652546, 665, 132, 12037652547, 665, 134, 12037652548, 665, 136, 12037652549, 665, 138, 12037652550, 665, 140, 12037652551, 665, 142, 12037652552, 665, 144, 12037652553, 665, 146, 12037652554, 665, 148, 12037652555, 665, 150, 12037652556, 665, 152, 12037652557, 665, 154, 12037652558, 665, 156, 12037652559, 665, 158, 12037652560, 665, 160, 12037652561, 665, 162, 12037652562, 665, 164, 12037652563, 665, 166, 12037652564, 665, 168, 12037652565, 665, 170, 12037652566, 665, 172, 12037652567, 665, 174, 12037652568, 665, 176, 12037652569, 665, 178, 12037652570, 665, 180, 12037652571, 665, 182, 12037652572, 665, 184, 12037652573, 665, 186, 12037652574, 665, 188, 12037652575, 665, 190, 12037652576, 665, 192, 12037652577, 665, 194, 12037652578, 665, 196, 12037652579, 665, 198, 12037652580, 665, 200, 12037652581, 665, 202, 12037652582, 665, 204, 12037652583, 665, 206, 12037652584, 665, 208, 12037652585, 665, 210, 12037652586, 665, 212, 12037652587, 665, 214, 12037652588, 665, 216, 12037652589, 665, 218, 12037652590, 665, 220, 12037652591, 665, 222, 12037652592, 665, 224, 12037652593, 665, 226, 12037652594, 665, 228, 12037652595, 665, 230, 12037652596, 665, 232, 12037652597, 665, 234, 12037652598, 665, 236, 12037652599, 665, 238, 12037652600, 665, 240, 12037652601, 665, 242, 12037652602, 665, 244, 12037652603, 665, 246, 12037652604, 665, 248, 12037652605, 665, 250, 12037652606, 665, 252, 12037652607, 665, 254, 12037652608, 665, 256, 12037652609, 665, 258, 12037652610, 665, 260, 12037652611, 665, 262, 12037652612, 665, 264, 12037652613, 665, 266, 12037652614, 665, 268, 12037652615, 665, 270, 12037652616, 665, 272, 12037652617, 665, 274, 12037652618, 665, 276, 12037652619, 665, 278, 12037652620, 665, 280, 12037652621, 665, 282, 12037652622, 665, 284, 12037652623, 665, 286, 12037652624, 665, 288, 12037652625, 665, 290, 12037652626, 665, 292, 12037652627, 665, 294, 12037652628, 665, 296, 12037652629, 665, 298, 12037652630, 665, 300, 12037652631, 665, 302, 12037652632, 665, 304, 12037652633, 665, 306, 12037652634, 665, 308, 12037652635, 665, 310, 12037652636, 665, 312, 12037652637, 665, 314, 12037652638, 665, 316, 12037652639, 665, 318, 12037652640, 665, 320, 12037652641, 665, 322, 12037652642, 665, 324, 12037652643, 665, 326, 12037652644, 665, 328, 12037652645, 665, 330, 12037652646, 665, 332, 12037652647, 665, 334, 12037652648, 665, 336, 12037652649, 665, 338, 12037652650, 665, 340, 12037652651, 665, 342, 12037652652, 665, 344, 12037652653, 665, 346, 12037652654, 665, 348, 12037652655, 665, 350, 12037652656, 665, 352, 12037652657, 665, 354, 12037652658, 665, 356, 12037652659, 665, 358, 12037652660, 665, 360, 12037652661, 665, 362, 12037652662, 665, 364, 12037652663, 665, 366, 12037652664, 665, 368, 12037652665, 665, 370, 12037652666, 665, 372, 12037652667, 665, 374, 12037652668, 665, 376, 12037652669, 665, 378, 12037652670, 665, 380, 12037652671, 665, 382, 12037652672, 665, 384, 12037652673, 665, 386, 12037652674, 665, 388, 12037652675, 665, 390, 12037652676, 665, 392, 12037652677, 665, 394, 12037652678, 665, 396, 12037652679, 665, 398, 12037652680, 665, 400, 12037652681, 665, 402, 12037652682, 665, 404, 12037652683, 665, 406, 12037652684, 665, 408, 12037652685, 665, 410, 12037652686, 665, 412, 12037652687, 665, 414, 12037652688, 665, 416, 12037652689, 665, 418, 12037652690, 665, 420, 12037652691, 665, 422, 12037652692, 665, 424, 12037652693, 665, 426, 12037652694, 665, 428, 12037652695, 665, 430, 12037652696, 665, 432, 12037652697, 665, 434, 12037652701, 665, 436, 12037652702, 665, 438, 12037652703, 665, 440, 12037652704, 665, 442, 12037652705, 665, 443, 12037652706, 665, 444, 12037652707, 665, 445, 25341984771, 371, 446, 25341984772, 371, 448, 25341984773, 371, 449, 25341984774, 371, 450, 25341984775, 371, 452, 21, 454, 12037652745, 665, 455, 12037652746, 665, 456, 12037652738, 665, 460, 12037652741, 665, 461, 12037652714, 665, 465, 12037652708, 665, 466, 114, 467, 12037652709, 665, 468, 12037652715, 665, 470, 115, 471, 12037652716, 665, 473, 116, 474, 12037652717, 665, 476, 117, 477, 12037652718, 665, 479, 118, 480, 12037652719, 665, 482, 119, 483, 12037652720, 665, 485, 120, 486, 12037652721, 665, 488, 121, 489, 12037652722, 665, 491, 12037652710, 665, 492, 12037652711, 665, 493, 12037652723, 665, 495, 12037652724, 665, 497, 12037652725, 665, 499, 12037652726, 665, 501, 12037652727, 665, 503, 12037652728, 665, 505, 12037652729, 665, 507, 12037652730, 665, 509, 12037652712, 665, 510, 12037652713, 665, 511, 12037652744, 665, 512, 12037652731, 665, 514, 12037652732, 665, 516, 12037652733, 665, 518, 12037652734, 665, 520, 12037652735, 665, 522, 12037652736, 665, 524, 12037652737, 665, 526, 25341984800, 371, 529, 122, 530, 25341984801, 371, 532, 25341984802, 371, 534, 25341984803, 371, 536, 25341984804, 371, 538, 25341984805, 371, 540, 25341984806, 371, 542, 25341984807, 371, 544, 25341984808, 371, 546, 25341984809, 371, 548, 25341984810, 371, 550, 25341984811, 371, 552, 12037652759, 665, 553, 12037652747, 665, 554, 124, 555, 12037652760, 665, 556, 12037652748, 665, 557, 12037652761, 665, 558, 12037652749, 665, 559, 12037652762, 665, 560, 12037652750, 665, 561, 12037652763, 665, 566, 12037652764, 665, 567, 12037652765, 665, 568, 123, 569, 25341984812, 371, 570, 12037652776, 665, 572, 12037652777, 665, 573, 12037652778, 665, 574, 12037652779, 665, 576, 12037652780, 665, 577, 138, 578, 25341984813, 371, 579, 12037652766, 665, 580, 146, 581, 139, 583, 12037652767, 665, 584, 140, 586, 12037652768, 665, 587, 141, 589, 12037652769, 665, 590, 142, 592, 12037652770, 665, 593, 143, 595, 12037652771, 665, 596, 144, 598, 12037652772, 665, 599, 145, 601, 12037652773, 665, 602, 12037652781, 665, 605, 12037652782, 665, 607, 12037652783, 665, 609, 12037652784, 665, 611, 12037652785, 665, 612, 12037652786, 665, 614, 12037652787, 665, 616, 12037652788, 665, 618, 12037652789, 665, 620, 12037652790, 665, 623, 12037652775, 665, 625, 12037652791, 665, 627, 12037652793, 665, 628, 12037652792, 665, 631, 25341984814, 371, 632, 25341984815, 371, 634, 25341984816, 371, 636, 25341984817, 371, 638, 25341984818, 371, 640, 25341984819, 371, 642, 25341984820, 371, 644, 25341984821, 371, 646, 12037652879, 665, 648, 12037652880, 665, 649, 0, 650, 12037652892, 665, 651, 12037652877, 665, 652, 12037652856, 665, 654, 12037652822, 665, 655, 12037652857, 665, 656, 12037652826, 665, 657, 12037652858, 665, 658, 12037652830, 665, 659, 12037652859, 665, 660, 12037652834, 665, 661, 12037652860, 665, 662, 12037652838, 665, 663, 12037652863, 665, 664, 12037652846, 665, 665, 12037652861, 665, 666, 12037652842, 665, 667, 12037652864, 665, 668, 12037652810, 665, 669, 12037652862, 665, 670, 12037652850, 665, 671, 12037652865, 665, 672, 12037652837, 665, 673, 12037652887, 665, 674, 12037652814, 665, 675, 12037652866, 665, 676, 12037652823, 665, 678, 12037652827, 665, 679, 12037652831, 665, 680, 12037652835, 665, 681, 12037652839, 665, 682, 12037652847, 665, 683, 12037652843, 665, 684, 12037652811, 665, 685, 12037652888, 665, 686, 12037652815, 665, 687, 12037652824, 665, 689, 12037652828, 665, 690, 12037652832, 665, 691, 12037652836, 665, 692, 12037652840, 665, 693, 12037652848, 665, 694, 12037652844, 665, 695, 12037652812, 665, 696, 12037652889, 665, 697, 12037652816, 665, 698, 12037652825, 665, 700, 12037652829, 665, 701, 12037652833, 665, 702, 12037652841, 665, 703, 12037652849, 665, 704, 12037652845, 665, 705, 12037652813, 665, 706, 12037652890, 665, 707, 12037652817, 665, 708, 12037652818, 665, 710, 12037652867, 665, 711, 12037652819, 665, 713, 12037652820, 665, 715, 12037652821, 665, 717, 12037652868, 665, 719, 12037652869, 665, 724, 12037652870, 665, 729, 12037652871, 665, 734, 12037652872, 665, 739, 12037652851, 665, 744, 12037652873, 665, 745, 12037652881, 665, 746, 12037652852, 665, 748, 12037652853, 665, 750, 12037652854, 665, 752, 12037652874, 665, 754, 12037652882, 665, 755, 12037652883, 665, 756, 12037652875, 665, 761, 12037652884, 665, 763, 12037652876, 665, 764, 25341984822, 371, 769, 12037652885, 665, 770, 12037652886, 665, 771, 12037652891, 665, 772, 12037652855, 665, 773, 12037652897, 665, 775, 12037652896, 665, 776, 12037652895, 665, 777, 12037652894, 665, 778, 12037652901, 665, 779, 12037652900, 665, 780, 12037652899, 665, 781, 12037652898, 665, 782, 193, 783, 12037652907, 665, 784, 12037652906, 665, 785, 194, 786, 197, 788, 12037652910, 665, 789, 12037652908, 665, 790, 198, 791, 200, 793, 12037652912, 665, 794, 12037652909, 665, 795, 201, 796, 12037652913, 665, 798, 202, 799, 12037652914, 665, 801, 203, 802, 12037652915, 665, 804, 204, 805, 12037652916, 665, 807, 205, 808, 12037652917, 665, 810, 206, 811, 12037652918, 665, 813, 207, 814, 12037652919, 665, 816, 208, 817, 12037652911, 665, 820, 199, 821, 25341984824, 371, 822, 12037652923, 665, 824, 12037652924, 665, 825, 12037652925, 665, 826, 12037652926, 665, 828, 12037652927, 665, 829, 25341984825, 371, 830, 213, 831, 12037652921, 665, 833, 217, 834, 12037652928, 665, 836, 12037652929, 665, 838, 12037652930, 665, 840, 12037652931, 665, 842, 12037652932, 665, 844, 12037652933, 665, 846, 12037652934, 665, 848, 12037652935, 665, 850, 12037652936, 665, 852, 12037652922, 665, 854, 12037652937, 665, 855, 12037652938, 665, 857, 12037652940, 665, 858, 12037652939, 665, 861, 25341984827, 371, 862, 25341984828, 371, 864, 25341984829, 371, 866, 25341984830, 371, 868, 25341984831, 371, 870, 25341984832, 371, 872, 25341984833, 371, 874, 25341984834, 371, 876, 12037652969, 665, 878, 12037652957, 665, 880, 12037652959, 665, 881, 12037652960, 665, 882, 1, 883, 12037652961, 665, 885, 25341984835, 371, 886, 12037652962, 665, 888, 12037652963, 665, 890, 12037652964, 665, 892, 12037652965, 665, 894, 12037652966, 665, 896, 12037652967, 665, 898, 12037652968, 665, 900, 25341984836, 371, 901, 12037653107, 665, 902, 12037653130, 665, 903, 12037653129, 665, 904, 12037653128, 665, 905, 12037653127, 665, 906, 12037653126, 665, 907, 12037653125, 665, 908, 12037653124, 665, 909, 12037653123, 665, 910, 12037653122, 665, 911, 12037652977, 665, 912, 12037653042, 665, 913, 12037652985, 665, 914, 12037653043, 665, 915, 12037652993, 665, 916, 12037653044, 665, 917, 12037652986, 665, 918, 12037653045, 665, 919, 12037653001, 665, 920, 12037653046, 665, 921, 12037653009, 665, 922, 12037653047, 665, 923, 12037653041, 665, 924, 12037653049, 665, 925, 12037653017, 665, 926, 12037653048, 665, 927, 12037653018, 665, 928, 12037653050, 665, 929, 12037653019, 665, 930, 12037653051, 665, 931, 12037653020, 665, 932, 12037653052, 665, 933, 12037653021, 665, 934, 12037653053, 665, 935, 45, 936, 12037653054, 665, 937, 12037653023, 665, 938, 12037653055, 665, 939, 12037653024, 665, 940, 12037653056, 665, 941, 12037653108, 665, 942, 12037653114, 665, 943, 12037653109, 665, 944, 12037653115, 665, 945, 12037653110, 665, 946, 12037653116, 665, 947, 12037653111, 665, 948, 12037653117, 665, 949, 12037653112, 665, 950, 12037653118, 665, 951, 12037653113, 665, 952, 12037653119, 665, 953, 12037653025, 665, 954, 12037653057, 665, 955, 12037653033, 665, 956, 12037653072, 665, 957, 12037653121, 665, 958, 12037653131, 665, 959, 25341984837, 371, 960, 12037653058, 665, 961, 12037652976, 665, 963, 12037652984, 665, 964, 12037652992, 665, 965, 12037653000, 665, 966, 12037653008, 665, 967, 12037653016, 665, 968, 12037653040, 665, 969, 12037653032, 665, 970, 12037652975, 665, 972, 12037652983, 665, 973, 12037652991, 665, 974, 12037652999, 665, 975, 12037653007, 665, 976, 12037653015, 665, 977, 12037653039, 665, 978, 12037653031, 665, 979, 12037652974, 665, 981, 12037652982, 665, 982, 12037652990, 665, 983, 12037652998, 665, 984, 12037653006, 665, 985, 12037653014, 665, 986, 12037653038, 665, 987, 12037653030, 665, 988, 12037652973, 665, 990, 12037652981, 665, 991, 12037652989, 665, 992, 12037652997, 665, 993, 12037653005, 665, 994, 12037653013, 665, 995, 12037653037, 665, 996, 12037653029, 665, 997, 12037652972, 665, 999, 12037652980, 665, 1000, 12037652988, 665, 1001, 12037652996, 665, 1002, 12037653004, 665, 1003, 12037653012, 665, 1004, 12037653036, 665, 1005, 12037653028, 665, 1006, 12037652971, 665, 1008, 12037652979, 665, 1009, 12037652987, 665, 1010, 12037652995, 665, 1011, 12037653003, 665, 1012, 12037653011, 665, 1013, 12037653035, 665, 1014, 12037653027, 665, 1015, 12037652970, 665, 1017, 12037652978, 665, 1018, 12037652994, 665, 1019, 12037653002, 665, 1020, 12037653010, 665, 1021, 12037653034, 665, 1022, 12037653026, 665, 1023, 12037653059, 665, 1025, 12037653060, 665, 1034, 12037653061, 665, 1043, 12037653062, 665, 1052, 12037653063, 665, 1061, 12037653064, 665, 1070, 12037653076, 665, 1072, 12037653065, 665, 1073, 12037653066, 665, 1075, 12037653068, 665, 1077, 12037653022, 665, 1078, 12037653105, 665, 1079, 12037653067, 665, 1081, 25341984838, 371, 1083, 12037653070, 665, 1084, 12037653069, 665, 1086, 12037653093, 665, 1087, 12037653097, 665, 1088, 12037653094, 665, 1089, 12037653098, 665, 1090, 12037653071, 665, 1092, 12037653073, 665, 1093, 12037653082, 665, 1094, 12037653074, 665, 1095, 12037653106, 665, 1096, 12037653134, 665, 1097, 25341984841, 371, 1098, 12037653136, 665, 1099, 25341984840, 371, 1100, 25341984839, 371, 1101, 12037653103, 665, 1103, 12037653087, 665, 1104, 12037653088, 665, 1105, 12037653089, 665, 1106, 12037653101, 665, 1107, 12037653096, 665, 1108, 12037653095, 665, 1109, 12037653100, 665, 1110, 12037653099, 665, 1111, 12037653079, 665, 1112, 12037653080, 665, 1113, 12037653078, 665, 1114, 12037653077, 665, 1115, 12037653090, 665, 1116, 12037653091, 665, 1117, 12037653092, 665, 1118, 12037653083, 665, 1119, 12037653084, 665, 1120, 12037653104, 665, 1121, 12037653086, 665, 1122, 12037653085, 665, 1123, 12037653081, 665, 1124, 12037653135, 665, 1125, 12037653120, 665, 1128, 25341984845, 371, 1133, 23194501143, 128, 1134, 23194501140, 128, 1135, 25341984998, 371, 1138, 25341984848, 371, 1139, 23194501149, 128, 1140, 23194501146, 128, 1141, 25341985001, 371, 1144, 25341984851, 371, 1145, 23194501121, 128, 1146, 23194501120, 128, 1147, 25341985004, 371, 1150, 25341984854, 371, 1151, 23194501123, 128, 1152, 23194501122, 128, 1153, 25341985007, 371, 1156, 25341984857, 371, 1157, 23194501125, 128, 1158, 23194501124, 128, 1159, 25341985010, 371, 1162, 25341984860, 371, 1163, 23194501127, 128, 1164, 23194501126, 128, 1165, 25341985013, 371, 1168, 25341984863, 371, 1169, 23194501155, 128, 1170, 23194501152, 128, 1171, 25341985016, 371, 1174, 25341984866, 371, 1175, 23194501129, 128, 1176, 23194501128, 128, 1177, 25341985019, 371, 1180, 25341984869, 371, 1181, 23194501131, 128, 1182, 23194501130, 128, 1183, 25341985022, 371, 1186, 25341984872, 371, 1187, 23194501133, 128, 1188, 23194501132, 128, 1189, 25341985025, 371, 1192, 25341984875, 371, 1193, 23194501161, 128, 1194, 23194501158, 128, 1195, 25341985028, 371, 1198, 25341984878, 371, 1199, 23194501167, 128, 1200, 23194501164, 128, 1201, 25341985031, 371, 1204, 25341984881, 371, 1205, 23194501135, 128, 1206, 23194501134, 128, 1207, 25341985034, 371, 1210, 25341984884, 371, 1211, 23194501173, 128, 1212, 23194501170, 128, 1213, 25341985037, 371, 1216, 25341984887, 371, 1217, 23194501179, 128, 1218, 23194501176, 128, 1219, 25341985040, 371, 1222, 25341984890, 371, 1223, 23194501185, 128, 1224, 23194501182, 128, 1225, 25341985043, 371, 1228, 25341984893, 371, 1229, 23194501191, 128, 1230, 23194501188, 128, 1231, 25341985046, 371, 1234, 25341984896, 371, 1235, 23194501197, 128, 1236, 23194501194, 128, 1237, 25341985049, 371, 1240, 25341984899, 371, 1241, 23194501203, 128, 1242, 23194501200, 128, 1243, 25341985052, 371, 1246, 25341984902, 371, 1247, 23194501209, 128, 1248, 23194501206, 128, 1249, 25341985055, 371, 1252, 25341984905, 371, 1253, 23194501215, 128, 1254, 23194501212, 128, 1255, 25341985058, 371, 1258, 25341984908, 371, 1259, 23194501221, 128, 1260, 23194501218, 128, 1261, 25341985061, 371, 1264, 25341984911, 371, 1265, 23194501227, 128, 1266, 23194501224, 128, 1267, 25341985064, 371, 1270, 25341984914, 371, 1271, 23194501137, 128, 1272, 23194501136, 128, 1273, 25341984844, 371, 1276, 25341984917, 371, 1278, 23194501139, 128, 1279, 23194501138, 128, 1280, 25341985067, 371, 1283, 25341984920, 371, 1284, 23194501233, 128, 1285, 23194501230, 128, 1286, 25341985070, 371, 1289, 25341984923, 371, 1290, 23194501239, 128, 1291, 23194501236, 128, 1292, 25341985073, 371, 1295, 25341984926, 371, 1296, 23194501245, 128, 1297, 23194501242, 128, 1298, 25341985076, 371, 1301, 25341984929, 371, 1302, 12037652751, 665, 1303, 12037652752, 665, 1304, 12037652753, 665, 1305, 12037652754, 665, 1306, 12037652755, 665, 1307, 12037652756, 665, 1308, 12037652757, 665, 1309, 12037652758, 665, 1310, 25341985079, 371, 1312, 25341984932, 371, 1313, 25341985082, 371, 1315, 25341984935, 371, 1316, 25341985085, 371, 1318, 25341984938, 371, 1319, 25341985088, 371, 1321, 25341984941, 371, 1322, 25341985091, 371, 1324, 25341984944, 371, 1325, 12037652743, 665, 1326, 12037652742, 665, 1327, 25341985094, 371, 1329, 25341984947, 371, 1330, 25341985097, 371, 1332, 25341984950, 371, 1333, 25341985100, 371, 1335, 25341984953, 371, 1336, 25341985103, 371, 1338, 25341984956, 371, 1339, 25341985106, 371, 1341, 25341984959, 371, 1342, 12037652958, 665, 1343, 25341985109, 371, 1345, 25341984962, 371, 1346, 12037653137, 665, 1347, 12037653138, 665, 1348, 12037653139, 665, 1349, 12037653140, 665, 1350, 25341984965, 371, 1352, 12037653141, 665, 1353, 12037653142, 665, 1354, 12037653143, 665, 1355, 12037653144, 665, 1356, 25341984968, 371, 1358, 25341985112, 371, 1360, 25341984971, 371, 1361, 25341985115, 371, 1363, 25341984974, 371, 1364, 25341985118, 371, 1366, 25341984977, 371, 1367, 25341985121, 371, 1369, 25341984980, 371, 1370, 25341985124, 371, 1372, 25341984983, 371, 1373, 25341985130, 371, 1375, 25341985127, 371, 1376, 25341984986, 371, 1377, 25341985136, 371, 1379, 25341985133, 371, 1380, 12037652525, 665, 1381, 126, 1382, 25341984776, 371, 1383, 127, 1384, 25341984778, 371, 1385, 128, 1386, 25341984780, 371, 1387, 129, 1388, 25341984782, 371, 1389, 130, 1390, 25341984784, 371, 1391, 131, 1392, 25341984786, 371, 1393, 132, 1394, 25341984788, 371, 1395, 133, 1396, 25341984790, 371, 1397, 134, 1398, 25341984792, 371, 1399, 135, 1400, 25341984794, 371, 1401, 136, 1402, 25341984796, 371, 1403, 137, 1404, 25341984798, 371, 1405, 25341984777, 371, 1406, 25341984779, 371, 1407, 125, 1408, 25341984781, 371, 1409, 25341984783, 371, 1410, 25341984785, 371, 1411, 25341984787, 371, 1412, 25341984789, 371, 1413, 25341984791, 371, 1414, 25341984793, 371, 1415, 25341984795, 371, 1416, 25341984797, 371, 1417, 25341984799, 371, 1418, 12037653075, 665, 1421, 25341984842, 371, 1423, 25341984843, 371, 1424, 3, 1425, 2, 1426, 46, 1429, 12037652482, 665, 1430, 103, 1431, 101, 1432, 102, 1433, 104, 1434, 84, 1435, 93, 1436, 94, 1437, 95, 1438, 96, 1439, 97, 1440, 98, 1441, 99, 1442, 100, 1443, 6, 1458, 7, 1459, 8, 1460, 9, 1461, 10, 1462, 11, 1463, 12, 1464, 13, 1465, 14, 1466, 15, 1467, 16, 1468, 17, 1469, 18, 1470, 19, 1471, 20, 1472, 22, 1473, 23, 1474, 24, 1475, 25, 1476, 26, 1477, 27, 1478, 28, 1479, 29, 1480, 30, 1481, 31, 1482, 32, 1483, 33, 1484, 34, 1485, 35, 1486, 4, 1487, 106, 1489, 105, 1490, 107, 1493, 12037652739, 665, 1495, 12037652740, 665, 1496, 110, 1497, 108, 1498, 109, 1499, 111, 1500, 112, 1501, 113, 1502, 12037652774, 665, 1511, 12037652794, 665, 1513, 12037652795, 665, 1514, 12037652796, 665, 1515, 12037652797, 665, 1516, 12037652798, 665, 1517, 12037652799, 665, 1518, 12037652800, 665, 1519, 12037652801, 665, 1520, 37, 1521, 38, 1522, 39, 1523, 40, 1524, 41, 1525, 42, 1526, 43, 1527, 44, 1528, 12037652878, 665, 1537, 148, 1538, 149, 1539, 150, 1540, 151, 1541, 152, 1542, 153, 1543, 154, 1544, 155, 1545, 156, 1546, 157, 1547, 158, 1548, 159, 1549, 160, 1550, 161, 1551, 162, 1552, 163, 1553, 164, 1554, 165, 1555, 166, 1556, 167, 1557, 168, 1558, 169, 1559, 170, 1560, 171, 1561, 172, 1562, 173, 1563, 174, 1564, 175, 1565, 176, 1566, 177, 1567, 178, 1568, 179, 1569, 180, 1570, 181, 1571, 182, 1572, 183, 1573, 184, 1574, 188, 1612, 12037652902, 665, 1613, 189, 1614, 190, 1615, 191, 1616, 192, 1617, 12037652903, 665, 1622, 12037652904, 665, 1623, 12037652905, 665, 1624, 25341984826, 371, 1625, 212, 1626, 195, 1627, 215, 1628, 216, 1630, 196, 1631, 12037652941, 665, 1633, 12037652942, 665, 1634, 12037652943, 665, 1635, 12037652944, 665, 1636, 12037652945, 665, 1637, 12037652946, 665, 1638, 12037652947, 665, 1639, 12037652948, 665, 1640, 12037653102, 665, 1641, 12037653133, 665, 1642, 47, 1643, 48, 1644, 49, 1645, 50, 1646, 51, 1647, 52, 1648, 53, 1649, 54, 1650, 56, 1651, 57, 1652, 58, 1653, 59, 1654, 60, 1655, 61, 1656, 62, 1657, 63, 1658, 64, 1659, 65, 1660, 66, 1661, 67, 1662, 68, 1663, 69, 1664, 70, 1665, 71, 1666, 72, 1667, 73, 1668, 74, 1669, 75, 1670, 76, 1671, 77, 1672, 83, 1673, 55, 1674, 78, 1675, 79, 1676, 80, 1677, 81, 1678, 82, 1679, 185, 1735, 186, 1736, 187, 1737, 25341984823, 371, 1738, 209, 1739, 210, 1740, 211, 1741, 12037652802, 665, 1742, 12037652803, 665, 1743, 12037652804, 665, 1744, 12037652805, 665, 1745, 12037652806, 665, 1746, 12037652807, 665, 1747, 12037652808, 665, 1748, 12037652809, 665, 1749, 12037652893, 665, 1750, 214, 1751, 12037652920, 665, 1752, 12037652949, 665, 1753, 12037652950, 665, 1754, 12037652951, 665, 1755, 12037652952, 665, 1756, 12037652953, 665, 1757, 12037652954, 665, 1758, 12037652955, 665, 1759, 12037652956, 665, 1760, 12037653132, 665, 1761, 147, 1762, 25341984989, 371, 1763, 25341984992, 371, 1764, 25341984995, 371, 1765, 31566331904, 6, 1766, 31566331907, 6, 1767, 12037652483, 665, 1, 12037652534, 665, 3, 12037652484, 665, 5, 12037652485, 665, 13, 12037652486, 665, 16, 12037652487, 665, 19, 12037652488, 665, 22, 12037652489, 665, 25, 12037652490, 665, 28, 12037652491, 665, 31, 12037652492, 665, 34, 12037652493, 665, 37, 12037652494, 665, 39, 12037652495, 665, 41, 12037652496, 665, 43, 12037652497, 665, 45, 12037652498, 665, 47, 12037652499, 665, 49, 12037652500, 665, 51, 12037652501, 665, 54, 12037652502, 665, 56, 12037652503, 665, 58, 12037652504, 665, 60, 12037652505, 665, 62, 12037652506, 665, 64, 12037652507, 665, 66, 12037652508, 665, 68, 12037652509, 665, 71, 12037652510, 665, 73, 12037652511, 665, 75, 12037652512, 665, 77, 12037652513, 665, 79, 12037652514, 665, 81, 12037652515, 665, 83, 12037652516, 665, 85, 12037652517, 665, 89, 12037652518, 665, 92, 12037652519, 665, 95, 12037652520, 665, 98, 12037652521, 665, 101, 12037652522, 665, 104, 12037652523, 665, 107, 12037652524, 665, 110, 12037652538, 665, 115, 12037652539, 665, 117, 12037652540, 665, 119, 12037652541, 665, 121, 12037652542, 665, 123, 12037652543, 665, 125, 12037652544, 665, 127, 12037652545, 665, 129, 12037652546, 665, 131, 12037652547, 665, 133, 12037652548, 665, 135, 12037652549, 665, 137, 12037652550, 665, 139, 12037652551, 665, 141, 12037652552, 665, 143, 12037652553, 665, 145, 12037652554, 665, 147, 12037652555, 665, 149, 12037652556, 665, 151, 12037652557, 665, 153, 12037652558, 665, 155, 12037652559, 665, 157, 12037652560, 665, 159, 12037652561, 665, 161, 12037652562, 665, 163, 12037652563, 665, 165, 12037652564, 665, 167, 12037652565, 665, 169, 12037652566, 665, 171, 12037652567, 665, 173, 12037652568, 665, 175, 12037652569, 665, 177, 12037652570, 665, 179, 12037652571, 665, 181, 12037652572, 665, 183, 12037652573, 665, 185, 12037652574, 665, 187, 12037652575, 665, 189, 12037652576, 665, 191, 12037652577, 665, 193, 12037652578, 665, 195, 12037652579, 665, 197, 12037652580, 665, 199, 12037652581, 665, 201, 12037652582, 665, 203, 12037652583, 665, 205, 12037652584, 665, 207, 12037652585, 665, 209, 12037652586, 665, 211, 12037652587, 665, 213, 12037652588, 665, 215, 12037652589, 665, 217, 12037652590, 665, 219, 12037652591, 665, 221, 12037652592, 665, 223, 12037652593, 665, 225, 12037652594, 665, 227, 12037652595, 665, 229, 12037652596, 665, 231, 12037652597, 665, 233, 12037652598, 665, 235, 12037652599, 665, 237, 12037652600, 665, 239, 12037652601, 665, 241, 12037652602, 665, 243, 12037652603, 665, 245, 12037652604, 665, 247, 12037652605, 665, 249, 12037652606, 665, 251, 12037652607, 665, 253, 12037652608, 665, 255, 12037652609, 665, 257, 12037652610, 665, 259, 12037652611, 665, 261, 12037652612, 665, 263, 12037652613, 665, 265, 12037652614, 665, 267, 12037652615, 665, 269, 12037652616, 665, 271, 12037652617, 665, 273, 12037652618, 665, 275, 12037652619, 665, 277, 12037652620, 665, 279, 12037652621, 665, 281, 12037652622, 665, 283, 12037652623, 665, 285, 12037652624, 665, 287, 12037652625, 665, 289, 12037652626, 665, 291, 12037652627, 665, 293, 12037652628, 665, 295, 12037652629, 665, 297, 12037652630, 665, 299, 12037652631, 665, 301, 12037652632, 665, 303, 12037652633, 665, 305, 12037652634, 665, 307, 12037652635, 665, 309, 12037652636, 665, 311, 12037652637, 665, 313, 12037652638, 665, 315, 12037652639, 665, 317, 12037652640, 665, 319, 12037652641, 665, 321, 12037652642, 665, 323, 12037652643, 665, 325, 12037652644, 665, 327, 12037652645, 665, 329, 12037652646, 665, 331, 12037652647, 665, 333, 12037652648, 665, 335, 12037652649, 665, 337, 12037652650, 665, 339, 12037652651, 665, 341, 12037652652, 665, 343, 12037652653, 665, 345, 12037652654, 665, 347, 12037652655, 665, 349, 12037652656, 665, 351, 12037652657, 665, 353, 12037652658, 665, 355, 12037652659, 665, 357, 12037652660, 665, 359, 12037652661, 665, 361, 12037652662, 665, 363, 12037652663, 665, 365, 12037652664, 665, 367, 12037652665, 665, 369, 12037652666, 665, 371, 12037652667, 665, 373, 12037652668, 665, 375, 12037652669, 665, 377, 12037652670, 665, 379, 12037652671, 665, 381, 12037652672, 665, 383, 12037652673, 665, 385, 12037652674, 665, 387, 12037652675, 665, 389, 12037652676, 665, 391, 12037652677, 665, 393, 12037652678, 665, 395, 12037652679, 665, 397, 12037652680, 665, 399, 12037652681, 665, 401, 12037652682, 665, 403, 12037652683, 665, 405, 12037652684, 665, 407, 12037652685, 665, 409, 12037652686, 665, 411, 12037652687, 665, 413, 12037652688, 665, 415, 12037652689, 665, 417, 12037652690, 665, 419, 12037652691, 665, 421, 12037652692, 665, 423, 12037652693, 665, 425, 12037652694, 665, 427, 12037652695, 665, 429, 12037652696, 665, 431, 12037652697, 665, 433, 12037652701, 665, 435, 12037652702, 665, 437, 12037652703, 665, 439, 12037652704, 665, 441, 12037652705, 665, 447, 12037652706, 665, 451, 12037652707, 665, 453, 5, 457, 21, 458, 12037652738, 665, 459, 12037652739, 665, 462, 12037652742, 665, 463, 12037652743, 665, 464, 12037652714, 665, 469, 12037652715, 665, 472, 12037652716, 665, 475, 12037652717, 665, 478, 12037652718, 665, 481, 12037652719, 665, 484, 12037652720, 665, 487, 12037652721, 665, 490, 12037652722, 665, 494, 12037652723, 665, 496, 12037652724, 665, 498, 12037652725, 665, 500, 12037652726, 665, 502, 12037652727, 665, 504, 12037652728, 665, 506, 12037652729, 665, 508, 12037652730, 665, 513, 12037652731, 665, 515, 12037652732, 665, 517, 12037652733, 665, 519, 12037652734, 665, 521, 12037652735, 665, 523, 12037652736, 665, 525, 12037652737, 665, 527, 12037652747, 665, 528, 12037652748, 665, 531, 12037652749, 665, 533, 12037652750, 665, 535, 12037652751, 665, 537, 12037652752, 665, 539, 12037652753, 665, 541, 12037652754, 665, 543, 12037652755, 665, 545, 12037652756, 665, 547, 12037652757, 665, 549, 12037652758, 665, 551, 12037652759, 665, 562, 12037652760, 665, 563, 12037652761, 665, 564, 12037652762, 665, 565, 12037652776, 665, 571, 12037652778, 665, 575, 12037652766, 665, 582, 12037652767, 665, 585, 12037652768, 665, 588, 12037652769, 665, 591, 12037652770, 665, 594, 12037652771, 665, 597, 12037652772, 665, 600, 12037652773, 665, 603, 12037652781, 665, 604, 12037652782, 665, 606, 12037652783, 665, 608, 12037652784, 665, 610, 12037652785, 665, 613, 12037652786, 665, 615, 12037652787, 665, 617, 12037652788, 665, 619, 12037652789, 665, 621, 12037652790, 665, 622, 12037652775, 665, 624, 0, 626, 12037652791, 665, 629, 12037652792, 665, 630, 12037652802, 665, 633, 12037652803, 665, 635, 12037652804, 665, 637, 12037652805, 665, 639, 12037652806, 665, 641, 12037652807, 665, 643, 12037652808, 665, 645, 12037652809, 665, 647, 12037652892, 665, 653, 12037652814, 665, 677, 12037652815, 665, 688, 12037652816, 665, 699, 12037652817, 665, 709, 12037652818, 665, 712, 12037652819, 665, 714, 12037652820, 665, 716, 12037652821, 665, 718, 12037652822, 665, 720, 12037652823, 665, 721, 12037652824, 665, 722, 12037652825, 665, 723, 12037652826, 665, 725, 12037652827, 665, 726, 12037652828, 665, 727, 12037652829, 665, 728, 12037652830, 665, 730, 12037652831, 665, 731, 12037652832, 665, 732, 12037652833, 665, 733, 12037652834, 665, 735, 12037652835, 665, 736, 12037652836, 665, 737, 12037652837, 665, 738, 12037652838, 665, 740, 12037652839, 665, 741, 12037652840, 665, 742, 12037652841, 665, 743, 12037652842, 665, 747, 12037652843, 665, 749, 12037652844, 665, 751, 12037652845, 665, 753, 12037652846, 665, 757, 12037652847, 665, 758, 12037652848, 665, 759, 12037652849, 665, 760, 12037652850, 665, 762, 12037652851, 665, 765, 12037652852, 665, 766, 12037652853, 665, 767, 12037652854, 665, 768, 12037652855, 665, 774, 12037652907, 665, 787, 12037652910, 665, 792, 12037652912, 665, 797, 12037652913, 665, 800, 12037652914, 665, 803, 12037652915, 665, 806, 12037652916, 665, 809, 12037652917, 665, 812, 12037652918, 665, 815, 12037652919, 665, 818, 12037652911, 665, 819, 12037652923, 665, 823, 12037652925, 665, 827, 12037652921, 665, 832, 12037652928, 665, 835, 12037652929, 665, 837, 12037652930, 665, 839, 12037652931, 665, 841, 12037652932, 665, 843, 12037652933, 665, 845, 12037652934, 665, 847, 12037652935, 665, 849, 12037652936, 665, 851, 12037652922, 665, 853, 12037652937, 665, 856, 12037652938, 665, 859, 12037652939, 665, 860, 12037652949, 665, 863, 12037652950, 665, 865, 12037652951, 665, 867, 12037652952, 665, 869, 12037652953, 665, 871, 12037652954, 665, 873, 12037652955, 665, 875, 12037652956, 665, 877, 12037652957, 665, 879, 12037652961, 665, 884, 12037652962, 665, 887, 12037652963, 665, 889, 12037652964, 665, 891, 12037652965, 665, 893, 12037652966, 665, 895, 12037652967, 665, 897, 12037652968, 665, 899, 12037652977, 665, 962, 12037652976, 665, 971, 12037652975, 665, 980, 12037652974, 665, 989, 12037652973, 665, 998, 12037652972, 665, 1007, 12037652971, 665, 1016, 12037652970, 665, 1024, 12037652985, 665, 1026, 12037652984, 665, 1027, 12037652983, 665, 1028, 12037652982, 665, 1029, 12037652981, 665, 1030, 12037652980, 665, 1031, 12037652979, 665, 1032, 12037652978, 665, 1033, 12037652993, 665, 1035, 12037652992, 665, 1036, 12037652991, 665, 1037, 12037652990, 665, 1038, 12037652989, 665, 1039, 12037652988, 665, 1040, 12037652987, 665, 1041, 12037652986, 665, 1042, 12037653001, 665, 1044, 12037653000, 665, 1045, 12037652999, 665, 1046, 12037652998, 665, 1047, 12037652997, 665, 1048, 12037652996, 665, 1049, 12037652995, 665, 1050, 12037652994, 665, 1051, 12037653009, 665, 1053, 12037653008, 665, 1054, 12037653007, 665, 1055, 12037653006, 665, 1056, 12037653005, 665, 1057, 12037653004, 665, 1058, 12037653003, 665, 1059, 12037653002, 665, 1060, 12037653017, 665, 1062, 12037653016, 665, 1063, 12037653015, 665, 1064, 12037653014, 665, 1065, 12037653013, 665, 1066, 12037653012, 665, 1067, 12037653011, 665, 1068, 12037653010, 665, 1069, 12037653018, 665, 1071, 12037653019, 665, 1074, 12037653020, 665, 1076, 12037653023, 665, 1080, 12037653021, 665, 1082, 12037653025, 665, 1085, 12037653024, 665, 1091, 12037653022, 665, 1102, 12037653108, 665, 1126, 12037653109, 665, 1127, 12037653111, 665, 1129, 12037653113, 665, 1130, 12037653112, 665, 1131, 12037653110, 665, 1132, 23194501140, 128, 1136, 25341984845, 371, 1137, 23194501146, 128, 1142, 25341984848, 371, 1143, 23194501120, 128, 1148, 25341984851, 371, 1149, 23194501122, 128, 1154, 25341984854, 371, 1155, 23194501124, 128, 1160, 25341984857, 371, 1161, 23194501126, 128, 1166, 25341984860, 371, 1167, 23194501152, 128, 1172, 25341984863, 371, 1173, 23194501128, 128, 1178, 25341984866, 371, 1179, 23194501130, 128, 1184, 25341984869, 371, 1185, 23194501132, 128, 1190, 25341984872, 371, 1191, 23194501158, 128, 1196, 25341984875, 371, 1197, 23194501164, 128, 1202, 25341984878, 371, 1203, 23194501134, 128, 1208, 25341984881, 371, 1209, 23194501170, 128, 1214, 25341984884, 371, 1215, 23194501176, 128, 1220, 25341984887, 371, 1221, 23194501182, 128, 1226, 25341984890, 371, 1227, 23194501188, 128, 1232, 25341984893, 371, 1233, 23194501194, 128, 1238, 25341984896, 371, 1239, 23194501200, 128, 1244, 25341984899, 371, 1245, 23194501206, 128, 1250, 25341984902, 371, 1251, 23194501212, 128, 1256, 25341984905, 371, 1257, 23194501218, 128, 1262, 25341984908, 371, 1263, 23194501224, 128, 1268, 25341984911, 371, 1269, 23194501136, 128, 1274, 45, 1275, 25341984914, 371, 1277, 23194501138, 128, 1281, 25341984917, 371, 1282, 23194501230, 128, 1287, 25341984920, 371, 1288, 23194501236, 128, 1293, 25341984923, 371, 1294, 23194501242, 128, 1299, 25341984926, 371, 1300, 25341984929, 371, 1311, 25341984932, 371, 1314, 25341984935, 371, 1317, 25341984938, 371, 1320, 25341984941, 371, 1323, 25341984944, 371, 1328, 25341984947, 371, 1331, 25341984950, 371, 1334, 25341984953, 371, 1337, 25341984956, 371, 1340, 25341984959, 371, 1344, 25341984962, 371, 1351, 25341984965, 371, 1357, 25341984968, 371, 1359, 25341984971, 371, 1362, 25341984974, 371, 1365, 25341984977, 371, 1368, 25341984980, 371, 1371, 25341984983, 371, 1374, 25341984986, 371, 1378, 12037652959, 665, 1419, 12037652960, 665, 1420, 12037652958, 665, 1422, 3, 1427, 2, 1428, 46, 1444, 103, 1445, 101, 1446, 102, 1447, 104, 1448, 84, 1449, 93, 1450, 94, 1451, 95, 1452, 96, 1453, 97, 1454, 98, 1455, 99, 1456, 100, 1457, 4, 1488, 106, 1491, 105, 1492, 107, 1494, 110, 1503, 108, 1504, 109, 1505, 111, 1506, 112, 1507, 113, 1508, 12037652746, 665, 1509, 12037652745, 665, 1510, 123, 1512, 37, 1529, 38, 1530, 39, 1531, 40, 1532, 41, 1533, 42, 1534, 43, 1535, 44, 1536, 148, 1575, 149, 1576, 150, 1577, 151, 1578, 152, 1579, 153, 1580, 154, 1581, 155, 1582, 156, 1583, 157, 1584, 158, 1585, 159, 1586, 160, 1587, 161, 1588, 162, 1589, 163, 1590, 164, 1591, 165, 1592, 166, 1593, 167, 1594, 168, 1595, 169, 1596, 170, 1597, 171, 1598, 172, 1599, 173, 1600, 174, 1601, 175, 1602, 176, 1603, 177, 1604, 178, 1605, 179, 1606, 180, 1607, 181, 1608, 182, 1609, 183, 1610, 184, 1611, 189, 1618, 190, 1619, 191, 1620, 192, 1621, 195, 1629, 196, 1632, 47, 1680, 48, 1681, 49, 1682, 50, 1683, 51, 1684, 52, 1685, 53, 1686, 54, 1687, 56, 1688, 57, 1689, 58, 1690, 59, 1691, 60, 1692, 61, 1693, 62, 1694, 63, 1695, 64, 1696, 65, 1697, 66, 1698, 67, 1699, 68, 1700, 69, 1701, 70, 1702, 71, 1703, 72, 1704, 73, 1705, 74, 1706, 75, 1707, 76, 1708, 77, 1709, 83, 1710, 55, 1711, 78, 1712, 79, 1713, 80, 1714, 81, 1715, 82, 1716, 25341984827, 371, 1717, 25341984828, 371, 1718, 25341984829, 371, 1719, 25341984830, 371, 1720, 25341984831, 371, 1721, 25341984832, 371, 1722, 25341984833, 371, 1723, 25341984834, 371, 1724, 25341984842, 371, 1725, 25341984814, 371, 1726, 25341984815, 371, 1727, 25341984816, 371, 1728, 25341984817, 371, 1729, 25341984818, 371, 1730, 25341984819, 371, 1731, 25341984820, 371, 1732, 25341984821, 371, 1733, 25341984843, 371, 1734};
+inline uint64_t args52[NARGS_] = { 12037652480, 665, 12037652481, 665, 12037652482, 665, 12037652483, 665, 12037652484, 665, 12037652485, 665, 12037652486, 665, 12037652487, 665, 12037652488, 665, 12037652489, 665, 12037652490, 665, 12037652491, 665, 12037652492, 665, 12037652493, 665, 12037652494, 665, 12037652495, 665, 12037652496, 665, 12037652497, 665, 12037652498, 665, 12037652499, 665, 12037652500, 665, 12037652501, 665, 12037652502, 665, 12037652503, 665, 12037652504, 665, 12037652505, 665, 12037652506, 665, 12037652507, 665, 12037652508, 665, 12037652509, 665, 12037652510, 665, 12037652511, 665, 12037652512, 665, 12037652513, 665, 12037652514, 665, 12037652515, 665, 12037652516, 665, 12037652517, 665, 12037652518, 665, 12037652519, 665, 12037652520, 665, 12037652521, 665, 12037652522, 665, 12037652523, 665, 12037652524, 665, 12037652525, 665, 12037652526, 665, 12037652527, 665, 12037652528, 665, 12037652529, 665, 12037652530, 665, 12037652531, 665, 12037652532, 665, 12037652533, 665, 12037652534, 665, 12037652535, 665, 12037652536, 665, 12037652537, 665, 12037652538, 665, 12037652539, 665, 12037652540, 665, 12037652541, 665, 12037652542, 665, 12037652543, 665, 12037652544, 665, 12037652545, 665, 12037652546, 665, 12037652547, 665, 12037652548, 665, 12037652549, 665, 12037652550, 665, 12037652551, 665, 12037652552, 665, 12037652553, 665, 12037652554, 665, 12037652555, 665, 12037652556, 665, 12037652557, 665, 12037652558, 665, 12037652559, 665, 12037652560, 665, 12037652561, 665, 12037652562, 665, 12037652563, 665, 12037652564, 665, 12037652565, 665, 12037652566, 665, 12037652567, 665, 12037652568, 665, 12037652569, 665, 12037652570, 665, 12037652571, 665, 12037652572, 665, 12037652573, 665, 12037652574, 665, 12037652575, 665, 12037652576, 665, 12037652577, 665, 12037652578, 665, 12037652579, 665, 12037652580, 665, 12037652581, 665, 12037652582, 665, 12037652583, 665, 12037652584, 665, 12037652585, 665, 12037652586, 665, 12037652587, 665, 12037652588, 665, 12037652589, 665, 12037652590, 665, 12037652591, 665, 12037652592, 665, 12037652593, 665, 12037652594, 665, 12037652595, 665, 12037652596, 665, 12037652597, 665, 12037652598, 665, 12037652599, 665, 12037652600, 665, 12037652601, 665, 12037652602, 665, 12037652603, 665, 12037652604, 665, 12037652605, 665, 12037652606, 665, 12037652607, 665, 12037652608, 665, 12037652609, 665, 12037652610, 665, 12037652611, 665, 12037652612, 665, 12037652613, 665, 12037652614, 665, 12037652615, 665, 12037652616, 665, 12037652617, 665, 12037652618, 665, 12037652619, 665, 12037652620, 665, 12037652621, 665, 12037652622, 665, 12037652623, 665, 12037652624, 665, 12037652625, 665, 12037652626, 665, 12037652627, 665, 12037652628, 665, 12037652629, 665, 12037652630, 665, 12037652631, 665, 12037652632, 665, 12037652633, 665, 12037652634, 665, 12037652635, 665, 12037652636, 665, 12037652637, 665, 12037652638, 665, 12037652639, 665, 12037652640, 665, 12037652641, 665, 12037652642, 665, 12037652643, 665, 12037652644, 665, 12037652645, 665, 12037652646, 665, 12037652647, 665, 12037652648, 665, 12037652649, 665, 12037652650, 665, 12037652651, 665, 12037652652, 665, 12037652653, 665, 12037652654, 665, 12037652655, 665, 12037652656, 665, 12037652657, 665, 12037652658, 665, 12037652659, 665, 12037652660, 665, 12037652661, 665, 12037652662, 665, 12037652663, 665, 12037652664, 665, 12037652665, 665, 12037652666, 665, 12037652667, 665, 12037652668, 665, 12037652669, 665, 12037652670, 665, 12037652671, 665, 12037652672, 665, 12037652673, 665, 12037652674, 665, 12037652675, 665, 12037652676, 665, 12037652677, 665, 12037652678, 665, 12037652679, 665, 12037652680, 665, 12037652681, 665, 12037652682, 665, 12037652683, 665, 12037652684, 665, 12037652685, 665, 12037652686, 665, 12037652687, 665, 12037652688, 665, 12037652689, 665, 12037652690, 665, 12037652691, 665, 12037652692, 665, 12037652693, 665, 12037652694, 665, 12037652695, 665, 12037652696, 665, 12037652697, 665, 12037652698, 665, 12037652699, 665, 12037652700, 665, 12037652701, 665, 12037652702, 665, 12037652703, 665, 12037652704, 665, 12037652705, 665, 12037652706, 665, 12037652707, 665, 12037652708, 665, 12037652709, 665, 12037652710, 665, 12037652711, 665, 12037652712, 665, 12037652713, 665, 12037652714, 665, 12037652715, 665, 12037652716, 665, 12037652717, 665, 12037652718, 665, 12037652719, 665, 12037652720, 665, 12037652721, 665, 12037652722, 665, 12037652723, 665, 12037652724, 665, 12037652725, 665, 12037652726, 665, 12037652727, 665, 12037652728, 665, 12037652729, 665, 12037652730, 665, 12037652731, 665, 12037652732, 665, 12037652733, 665, 12037652734, 665, 12037652735, 665, 12037652736, 665, 12037652737, 665, 12037652738, 665, 12037652739, 665, 12037652740, 665, 12037652741, 665, 12037652742, 665, 12037652743, 665, 12037652744, 665, 12037652745, 665, 12037652746, 665, 12037652747, 665, 12037652748, 665, 12037652749, 665, 12037652750, 665, 12037652751, 665, 12037652752, 665, 12037652753, 665, 12037652754, 665, 12037652755, 665, 12037652756, 665, 12037652757, 665, 12037652758, 665, 12037652759, 665, 12037652760, 665, 12037652761, 665, 12037652762, 665, 12037652763, 665, 12037652764, 665, 12037652765, 665, 12037652766, 665, 12037652767, 665, 12037652768, 665, 12037652769, 665, 12037652770, 665, 12037652771, 665, 12037652772, 665, 12037652773, 665, 12037652774, 665, 12037652775, 665, 12037652776, 665, 12037652777, 665, 12037652778, 665, 12037652779, 665, 12037652780, 665, 12037652781, 665, 12037652782, 665, 12037652783, 665, 12037652784, 665, 12037652785, 665, 12037652786, 665, 12037652787, 665, 12037652788, 665, 12037652789, 665, 12037652790, 665, 12037652791, 665, 12037652792, 665, 12037652793, 665, 12037652794, 665, 12037652795, 665, 12037652796, 665, 12037652797, 665, 12037652798, 665, 12037652799, 665, 12037652800, 665, 12037652801, 665, 12037652802, 665, 12037652803, 665, 12037652804, 665, 12037652805, 665, 12037652806, 665, 12037652807, 665, 12037652808, 665, 12037652809, 665, 12037652810, 665, 12037652811, 665, 12037652812, 665, 12037652813, 665, 12037652814, 665, 12037652815, 665, 12037652816, 665, 12037652817, 665, 12037652818, 665, 12037652819, 665, 12037652820, 665, 12037652821, 665, 12037652822, 665, 12037652823, 665, 12037652824, 665, 12037652825, 665, 12037652826, 665, 12037652827, 665, 12037652828, 665, 12037652829, 665, 12037652830, 665, 12037652831, 665, 12037652832, 665, 12037652833, 665, 12037652834, 665, 12037652835, 665, 12037652836, 665, 12037652837, 665, 12037652838, 665, 12037652839, 665, 12037652840, 665, 12037652841, 665, 12037652842, 665, 12037652843, 665, 12037652844, 665, 12037652845, 665, 12037652846, 665, 12037652847, 665, 12037652848, 665, 12037652849, 665, 12037652850, 665, 12037652851, 665, 12037652852, 665, 12037652853, 665, 12037652854, 665, 12037652855, 665, 12037652856, 665, 12037652857, 665, 12037652858, 665, 12037652859, 665, 12037652860, 665, 12037652861, 665, 12037652862, 665, 12037652863, 665, 12037652864, 665, 12037652865, 665, 12037652866, 665, 12037652867, 665, 12037652868, 665, 12037652869, 665, 12037652870, 665, 12037652871, 665, 12037652872, 665, 12037652873, 665, 12037652874, 665, 12037652875, 665, 12037652876, 665, 12037652877, 665, 12037652878, 665, 12037652879, 665, 12037652880, 665, 12037652881, 665, 12037652882, 665, 12037652883, 665, 12037652884, 665, 12037652885, 665, 12037652886, 665, 12037652887, 665, 12037652888, 665, 12037652889, 665, 12037652890, 665, 12037652891, 665, 12037652892, 665, 12037652893, 665, 12037652894, 665, 12037652895, 665, 12037652896, 665, 12037652897, 665, 12037652898, 665, 12037652899, 665, 12037652900, 665, 12037652901, 665, 12037652902, 665, 12037652903, 665, 12037652904, 665, 12037652905, 665, 12037652906, 665, 12037652907, 665, 12037652908, 665, 12037652909, 665, 12037652910, 665, 12037652911, 665, 12037652912, 665, 12037652913, 665, 12037652914, 665, 12037652915, 665, 12037652916, 665, 12037652917, 665, 12037652918, 665, 12037652919, 665, 12037652920, 665, 12037652921, 665, 12037652922, 665, 12037652923, 665, 12037652924, 665, 12037652925, 665, 12037652926, 665, 12037652927, 665, 12037652928, 665, 12037652929, 665, 12037652930, 665, 12037652931, 665, 12037652932, 665, 12037652933, 665, 12037652934, 665, 12037652935, 665, 12037652936, 665, 12037652937, 665, 12037652938, 665, 12037652939, 665, 12037652940, 665, 12037652941, 665, 12037652942, 665, 12037652943, 665, 12037652944, 665, 12037652945, 665, 12037652946, 665, 12037652947, 665, 12037652948, 665, 12037652949, 665, 12037652950, 665, 12037652951, 665, 12037652952, 665, 12037652953, 665, 12037652954, 665, 12037652955, 665, 12037652956, 665, 12037652957, 665, 12037652958, 665, 12037652959, 665, 12037652960, 665, 12037652961, 665, 12037652962, 665, 12037652963, 665, 12037652964, 665, 12037652965, 665, 12037652966, 665, 12037652967, 665, 12037652968, 665, 12037652969, 665, 12037652970, 665, 12037652971, 665, 12037652972, 665, 12037652973, 665, 12037652974, 665, 12037652975, 665, 12037652976, 665, 12037652977, 665, 12037652978, 665, 12037652979, 665, 12037652980, 665, 12037652981, 665, 12037652982, 665, 12037652983, 665, 12037652984, 665, 12037652985, 665, 12037652986, 665, 12037652987, 665, 12037652988, 665, 12037652989, 665, 12037652990, 665, 12037652991, 665, 12037652992, 665, 12037652993, 665, 12037652994, 665, 12037652995, 665, 12037652996, 665, 12037652997, 665, 12037652998, 665, 12037652999, 665, 12037653000, 665, 12037653001, 665, 12037653002, 665, 12037653003, 665, 12037653004, 665, 12037653005, 665, 12037653006, 665, 12037653007, 665, 12037653008, 665, 12037653009, 665, 12037653010, 665, 12037653011, 665, 12037653012, 665, 12037653013, 665, 12037653014, 665, 12037653015, 665, 12037653016, 665, 12037653017, 665, 12037653018, 665, 12037653019, 665, 12037653020, 665, 12037653021, 665, 12037653022, 665, 12037653023, 665, 12037653024, 665, 12037653025, 665, 12037653026, 665, 12037653027, 665, 12037653028, 665, 12037653029, 665, 12037653030, 665, 12037653031, 665, 12037653032, 665, 12037653033, 665, 12037653034, 665, 12037653035, 665, 12037653036, 665, 12037653037, 665, 12037653038, 665, 12037653039, 665, 12037653040, 665, 12037653041, 665, 12037653042, 665, 12037653043, 665, 12037653044, 665, 12037653045, 665, 12037653046, 665, 12037653047, 665, 12037653048, 665, 12037653049, 665, 12037653050, 665, 12037653051, 665, 12037653052, 665, 12037653053, 665, 12037653054, 665, 12037653055, 665, 12037653056, 665, 12037653057, 665, 12037653058, 665, 12037653059, 665, 12037653060, 665, 12037653061, 665, 12037653062, 665, 12037653063, 665, 12037653064, 665, 12037653065, 665, 12037653066, 665, 12037653067, 665, 12037653068, 665, 12037653069, 665, 12037653070, 665, 12037653071, 665, 12037653072, 665, 12037653073, 665, 12037653074, 665, 12037653075, 665, 12037653076, 665, 12037653077, 665, 12037653078, 665, 12037653079, 665, 12037653080, 665, 12037653081, 665, 12037653082, 665, 12037653083, 665, 12037653084, 665, 12037653085, 665, 12037653086, 665, 12037653087, 665, 12037653088, 665, 12037653089, 665, 12037653090, 665, 12037653091, 665, 12037653092, 665, 12037653093, 665, 12037653094, 665, 12037653095, 665, 12037653096, 665, 12037653097, 665, 12037653098, 665, 12037653099, 665, 12037653100, 665, 12037653101, 665, 12037653102, 665, 12037653103, 665, 12037653104, 665, 12037653105, 665, 12037653106, 665, 12037653107, 665, 12037653108, 665, 12037653109, 665, 12037653110, 665, 12037653111, 665, 12037653112, 665, 12037653113, 665, 12037653114, 665, 12037653115, 665, 12037653116, 665, 12037653117, 665, 12037653118, 665, 12037653119, 665, 12037653120, 665, 12037653121, 665, 12037653122, 665, 12037653123, 665, 12037653124, 665, 12037653125, 665, 12037653126, 665, 12037653127, 665, 12037653128, 665, 12037653129, 665, 12037653130, 665, 12037653131, 665, 12037653132, 665, 12037653133, 665, 12037653134, 665, 12037653135, 665, 12037653136, 665, 12037653137, 665, 12037653138, 665, 12037653139, 665, 12037653140, 665, 12037653141, 665, 12037653142, 665, 12037653143, 665, 12037653144, 665, 23194501140, 128, 23194501143, 128, 23194501146, 128, 23194501149, 128, 23194501120, 128, 23194501121, 128, 23194501122, 128, 23194501123, 128, 23194501124, 128, 23194501125, 128, 23194501126, 128, 23194501127, 128, 23194501152, 128, 23194501155, 128, 23194501128, 128, 23194501129, 128, 23194501130, 128, 23194501131, 128, 23194501132, 128, 23194501133, 128, 23194501158, 128, 23194501161, 128, 23194501164, 128, 23194501167, 128, 23194501134, 128, 23194501135, 128, 23194501170, 128, 23194501173, 128, 23194501176, 128, 23194501179, 128, 23194501182, 128, 23194501185, 128, 23194501188, 128, 23194501191, 128, 23194501194, 128, 23194501197, 128, 23194501200, 128, 23194501203, 128, 23194501206, 128, 23194501209, 128, 23194501212, 128, 23194501215, 128, 23194501218, 128, 23194501221, 128, 23194501224, 128, 23194501227, 128, 23194501136, 128, 23194501137, 128, 23194501138, 128, 23194501139, 128, 23194501230, 128, 23194501233, 128, 23194501236, 128, 23194501239, 128, 23194501242, 128, 23194501245, 128, 25341984845, 371, 25341984848, 371, 25341984851, 371, 25341984854, 371, 25341984857, 371, 25341984860, 371, 25341984863, 371, 25341984866, 371, 25341984869, 371, 25341984872, 371, 25341984875, 371, 25341984878, 371, 25341984881, 371, 25341984884, 371, 25341984887, 371, 25341984890, 371, 25341984893, 371, 25341984896, 371, 25341984899, 371, 25341984902, 371, 25341984905, 371, 25341984908, 371, 25341984911, 371, 25341984914, 371, 25341984917, 371, 25341984920, 371, 25341984923, 371, 25341984926, 371, 25341984929, 371, 25341984932, 371, 25341984935, 371, 25341984938, 371, 25341984941, 371, 25341984944, 371, 25341984947, 371, 25341984950, 371, 25341984953, 371, 25341984956, 371, 25341984959, 371, 25341984962, 371, 25341984965, 371, 25341984968, 371, 25341984971, 371, 25341984974, 371, 25341984977, 371, 25341984980, 371, 25341984983, 371, 25341984986, 371, 25341984768, 371, 25341984769, 371, 25341984770, 371, 25341984771, 371, 25341984772, 371, 25341984773, 371, 25341984774, 371, 25341984775, 371, 25341984776, 371, 25341984777, 371, 25341984778, 371, 25341984779, 371, 25341984780, 371, 25341984781, 371, 25341984782, 371, 25341984783, 371, 25341984784, 371, 25341984785, 371, 25341984786, 371, 25341984787, 371, 25341984788, 371, 25341984789, 371, 25341984790, 371, 25341984791, 371, 25341984792, 371, 25341984793, 371, 25341984794, 371, 25341984795, 371, 25341984796, 371, 25341984797, 371, 25341984798, 371, 25341984799, 371, 25341984800, 371, 25341984801, 371, 25341984802, 371, 25341984803, 371, 25341984804, 371, 25341984805, 371, 25341984806, 371, 25341984807, 371, 25341984808, 371, 25341984809, 371, 25341984810, 371, 25341984811, 371, 25341984812, 371, 25341984813, 371, 25341984814, 371, 25341984815, 371, 25341984816, 371, 25341984817, 371, 25341984818, 371, 25341984819, 371, 25341984820, 371, 25341984821, 371, 25341984822, 371, 25341984823, 371, 25341984824, 371, 25341984825, 371, 25341984826, 371, 25341984827, 371, 25341984828, 371, 25341984829, 371, 25341984830, 371, 25341984831, 371, 25341984832, 371, 25341984833, 371, 25341984834, 371, 25341984835, 371, 25341984836, 371, 25341984837, 371, 25341984838, 371, 25341984839, 371, 25341984840, 371, 25341984841, 371, 25341984842, 371, 25341984843, 371, 25341984989, 371, 25341984844, 371, 25341984992, 371, 25341984995, 371, 25341984998, 371, 25341985001, 371, 25341985004, 371, 25341985007, 371, 25341985010, 371, 25341985013, 371, 25341985016, 371, 25341985019, 371, 25341985022, 371, 25341985025, 371, 25341985028, 371, 25341985031, 371, 25341985034, 371, 25341985037, 371, 25341985040, 371, 25341985043, 371, 25341985046, 371, 25341985049, 371, 25341985052, 371, 25341985055, 371, 25341985058, 371, 25341985061, 371, 25341985064, 371, 25341985067, 371, 25341985070, 371, 25341985073, 371, 25341985076, 371, 25341985079, 371, 25341985082, 371, 25341985085, 371, 25341985088, 371, 25341985091, 371, 25341985094, 371, 25341985097, 371, 25341985100, 371, 25341985103, 371, 25341985106, 371, 25341985109, 371, 25341985112, 371, 25341985115, 371, 25341985118, 371, 25341985121, 371, 25341985124, 371, 25341985127, 371, 25341985130, 371, 25341985133, 371, 25341985136, 371, 31566331904, 6, 31566331907, 6, 12037652483, 665, 2, 12037652534, 665, 4, 12037652484, 665, 6, 12037652535, 665, 7, 12037652536, 665, 8, 12037652537, 665, 9, 12037652485, 665, 10, 85, 11, 12037652480, 665, 12, 12037652486, 665, 14, 86, 15, 12037652487, 665, 17, 87, 18, 12037652488, 665, 20, 88, 21, 12037652489, 665, 23, 89, 24, 12037652490, 665, 26, 90, 27, 12037652491, 665, 29, 91, 30, 12037652492, 665, 32, 92, 33, 12037652493, 665, 35, 12037652481, 665, 36, 12037652494, 665, 38, 12037652495, 665, 40, 12037652496, 665, 42, 12037652497, 665, 44, 12037652498, 665, 46, 12037652499, 665, 48, 12037652500, 665, 50, 12037652501, 665, 52, 25341984768, 371, 53, 12037652502, 665, 55, 12037652503, 665, 57, 12037652504, 665, 59, 12037652505, 665, 61, 12037652506, 665, 63, 12037652507, 665, 65, 12037652508, 665, 67, 12037652509, 665, 69, 25341984769, 371, 70, 12037652510, 665, 72, 12037652511, 665, 74, 12037652512, 665, 76, 12037652513, 665, 78, 12037652514, 665, 80, 12037652515, 665, 82, 12037652516, 665, 84, 12037652517, 665, 86, 12037652526, 665, 87, 25341984770, 371, 88, 12037652518, 665, 90, 12037652527, 665, 91, 12037652519, 665, 93, 12037652528, 665, 94, 12037652520, 665, 96, 12037652529, 665, 97, 12037652521, 665, 99, 12037652530, 665, 100, 12037652522, 665, 102, 12037652531, 665, 103, 12037652523, 665, 105, 12037652532, 665, 106, 12037652524, 665, 108, 12037652533, 665, 109, 12037652698, 665, 111, 12037652699, 665, 112, 12037652700, 665, 113, 36, 114, 12037652538, 665, 116, 12037652539, 665, 118, 12037652540, 665, 120, 12037652541, 665, 122, 12037652542, 665, 124, 12037652543, 665, 126, 12037652544, 665, 128, 12037652545, 665, 130, 12037652546, 665, 132, 12037652547, 665, 134, 12037652548, 665, 136, 12037652549, 665, 138, 12037652550, 665, 140, 12037652551, 665, 142, 12037652552, 665, 144, 12037652553, 665, 146, 12037652554, 665, 148, 12037652555, 665, 150, 12037652556, 665, 152, 12037652557, 665, 154, 12037652558, 665, 156, 12037652559, 665, 158, 12037652560, 665, 160, 12037652561, 665, 162, 12037652562, 665, 164, 12037652563, 665, 166, 12037652564, 665, 168, 12037652565, 665, 170, 12037652566, 665, 172, 12037652567, 665, 174, 12037652568, 665, 176, 12037652569, 665, 178, 12037652570, 665, 180, 12037652571, 665, 182, 12037652572, 665, 184, 12037652573, 665, 186, 12037652574, 665, 188, 12037652575, 665, 190, 12037652576, 665, 192, 12037652577, 665, 194, 12037652578, 665, 196, 12037652579, 665, 198, 12037652580, 665, 200, 12037652581, 665, 202, 12037652582, 665, 204, 12037652583, 665, 206, 12037652584, 665, 208, 12037652585, 665, 210, 12037652586, 665, 212, 12037652587, 665, 214, 12037652588, 665, 216, 12037652589, 665, 218, 12037652590, 665, 220, 12037652591, 665, 222, 12037652592, 665, 224, 12037652593, 665, 226, 12037652594, 665, 228, 12037652595, 665, 230, 12037652596, 665, 232, 12037652597, 665, 234, 12037652598, 665, 236, 12037652599, 665, 238, 12037652600, 665, 240, 12037652601, 665, 242, 12037652602, 665, 244, 12037652603, 665, 246, 12037652604, 665, 248, 12037652605, 665, 250, 12037652606, 665, 252, 12037652607, 665, 254, 12037652608, 665, 256, 12037652609, 665, 258, 12037652610, 665, 260, 12037652611, 665, 262, 12037652612, 665, 264, 12037652613, 665, 266, 12037652614, 665, 268, 12037652615, 665, 270, 12037652616, 665, 272, 12037652617, 665, 274, 12037652618, 665, 276, 12037652619, 665, 278, 12037652620, 665, 280, 12037652621, 665, 282, 12037652622, 665, 284, 12037652623, 665, 286, 12037652624, 665, 288, 12037652625, 665, 290, 12037652626, 665, 292, 12037652627, 665, 294, 12037652628, 665, 296, 12037652629, 665, 298, 12037652630, 665, 300, 12037652631, 665, 302, 12037652632, 665, 304, 12037652633, 665, 306, 12037652634, 665, 308, 12037652635, 665, 310, 12037652636, 665, 312, 12037652637, 665, 314, 12037652638, 665, 316, 12037652639, 665, 318, 12037652640, 665, 320, 12037652641, 665, 322, 12037652642, 665, 324, 12037652643, 665, 326, 12037652644, 665, 328, 12037652645, 665, 330, 12037652646, 665, 332, 12037652647, 665, 334, 12037652648, 665, 336, 12037652649, 665, 338, 12037652650, 665, 340, 12037652651, 665, 342, 12037652652, 665, 344, 12037652653, 665, 346, 12037652654, 665, 348, 12037652655, 665, 350, 12037652656, 665, 352, 12037652657, 665, 354, 12037652658, 665, 356, 12037652659, 665, 358, 12037652660, 665, 360, 12037652661, 665, 362, 12037652662, 665, 364, 12037652663, 665, 366, 12037652664, 665, 368, 12037652665, 665, 370, 12037652666, 665, 372, 12037652667, 665, 374, 12037652668, 665, 376, 12037652669, 665, 378, 12037652670, 665, 380, 12037652671, 665, 382, 12037652672, 665, 384, 12037652673, 665, 386, 12037652674, 665, 388, 12037652675, 665, 390, 12037652676, 665, 392, 12037652677, 665, 394, 12037652678, 665, 396, 12037652679, 665, 398, 12037652680, 665, 400, 12037652681, 665, 402, 12037652682, 665, 404, 12037652683, 665, 406, 12037652684, 665, 408, 12037652685, 665, 410, 12037652686, 665, 412, 12037652687, 665, 414, 12037652688, 665, 416, 12037652689, 665, 418, 12037652690, 665, 420, 12037652691, 665, 422, 12037652692, 665, 424, 12037652693, 665, 426, 12037652694, 665, 428, 12037652695, 665, 430, 12037652696, 665, 432, 12037652697, 665, 434, 12037652701, 665, 436, 12037652702, 665, 438, 12037652703, 665, 440, 12037652704, 665, 442, 12037652705, 665, 443, 12037652706, 665, 444, 12037652707, 665, 445, 25341984771, 371, 446, 25341984772, 371, 448, 25341984773, 371, 449, 25341984774, 371, 450, 25341984775, 371, 452, 21, 454, 12037652745, 665, 455, 12037652746, 665, 456, 12037652738, 665, 460, 12037652741, 665, 461, 12037652714, 665, 465, 12037652708, 665, 466, 114, 467, 12037652709, 665, 468, 12037652715, 665, 470, 115, 471, 12037652716, 665, 473, 116, 474, 12037652717, 665, 476, 117, 477, 12037652718, 665, 479, 118, 480, 12037652719, 665, 482, 119, 483, 12037652720, 665, 485, 120, 486, 12037652721, 665, 488, 121, 489, 12037652722, 665, 491, 12037652710, 665, 492, 12037652711, 665, 493, 12037652723, 665, 495, 12037652724, 665, 497, 12037652725, 665, 499, 12037652726, 665, 501, 12037652727, 665, 503, 12037652728, 665, 505, 12037652729, 665, 507, 12037652730, 665, 509, 12037652712, 665, 510, 12037652713, 665, 511, 12037652744, 665, 512, 12037652731, 665, 514, 12037652732, 665, 516, 12037652733, 665, 518, 12037652734, 665, 520, 12037652735, 665, 522, 12037652736, 665, 524, 12037652737, 665, 526, 25341984800, 371, 529, 122, 530, 25341984801, 371, 532, 25341984802, 371, 534, 25341984803, 371, 536, 25341984804, 371, 538, 25341984805, 371, 540, 25341984806, 371, 542, 25341984807, 371, 544, 25341984808, 371, 546, 25341984809, 371, 548, 25341984810, 371, 550, 25341984811, 371, 552, 12037652759, 665, 553, 12037652747, 665, 554, 124, 555, 12037652760, 665, 556, 12037652748, 665, 557, 12037652761, 665, 558, 12037652749, 665, 559, 12037652762, 665, 560, 12037652750, 665, 561, 12037652763, 665, 566, 12037652764, 665, 567, 12037652765, 665, 568, 123, 569, 25341984812, 371, 570, 12037652776, 665, 572, 12037652777, 665, 573, 12037652778, 665, 574, 12037652779, 665, 576, 12037652780, 665, 577, 138, 578, 25341984813, 371, 579, 12037652766, 665, 580, 146, 581, 139, 583, 12037652767, 665, 584, 140, 586, 12037652768, 665, 587, 141, 589, 12037652769, 665, 590, 142, 592, 12037652770, 665, 593, 143, 595, 12037652771, 665, 596, 144, 598, 12037652772, 665, 599, 145, 601, 12037652773, 665, 602, 12037652781, 665, 605, 12037652782, 665, 607, 12037652783, 665, 609, 12037652784, 665, 611, 12037652785, 665, 612, 12037652786, 665, 614, 12037652787, 665, 616, 12037652788, 665, 618, 12037652789, 665, 620, 12037652790, 665, 623, 12037652775, 665, 625, 12037652791, 665, 627, 12037652793, 665, 628, 12037652792, 665, 631, 25341984814, 371, 632, 25341984815, 371, 634, 25341984816, 371, 636, 25341984817, 371, 638, 25341984818, 371, 640, 25341984819, 371, 642, 25341984820, 371, 644, 25341984821, 371, 646, 12037652879, 665, 648, 12037652880, 665, 649, 0, 650, 12037652892, 665, 651, 12037652877, 665, 652, 12037652856, 665, 654, 12037652822, 665, 655, 12037652857, 665, 656, 12037652826, 665, 657, 12037652858, 665, 658, 12037652830, 665, 659, 12037652859, 665, 660, 12037652834, 665, 661, 12037652860, 665, 662, 12037652838, 665, 663, 12037652863, 665, 664, 12037652846, 665, 665, 12037652861, 665, 666, 12037652842, 665, 667, 12037652864, 665, 668, 12037652810, 665, 669, 12037652862, 665, 670, 12037652850, 665, 671, 12037652865, 665, 672, 12037652837, 665, 673, 12037652887, 665, 674, 12037652814, 665, 675, 12037652866, 665, 676, 12037652823, 665, 678, 12037652827, 665, 679, 12037652831, 665, 680, 12037652835, 665, 681, 12037652839, 665, 682, 12037652847, 665, 683, 12037652843, 665, 684, 12037652811, 665, 685, 12037652888, 665, 686, 12037652815, 665, 687, 12037652824, 665, 689, 12037652828, 665, 690, 12037652832, 665, 691, 12037652836, 665, 692, 12037652840, 665, 693, 12037652848, 665, 694, 12037652844, 665, 695, 12037652812, 665, 696, 12037652889, 665, 697, 12037652816, 665, 698, 12037652825, 665, 700, 12037652829, 665, 701, 12037652833, 665, 702, 12037652841, 665, 703, 12037652849, 665, 704, 12037652845, 665, 705, 12037652813, 665, 706, 12037652890, 665, 707, 12037652817, 665, 708, 12037652818, 665, 710, 12037652867, 665, 711, 12037652819, 665, 713, 12037652820, 665, 715, 12037652821, 665, 717, 12037652868, 665, 719, 12037652869, 665, 724, 12037652870, 665, 729, 12037652871, 665, 734, 12037652872, 665, 739, 12037652851, 665, 744, 12037652873, 665, 745, 12037652881, 665, 746, 12037652852, 665, 748, 12037652853, 665, 750, 12037652854, 665, 752, 12037652874, 665, 754, 12037652882, 665, 755, 12037652883, 665, 756, 12037652875, 665, 761, 12037652884, 665, 763, 12037652876, 665, 764, 25341984822, 371, 769, 12037652885, 665, 770, 12037652886, 665, 771, 12037652891, 665, 772, 12037652855, 665, 773, 12037652897, 665, 775, 12037652896, 665, 776, 12037652895, 665, 777, 12037652894, 665, 778, 12037652901, 665, 779, 12037652900, 665, 780, 12037652899, 665, 781, 12037652898, 665, 782, 193, 783, 12037652907, 665, 784, 12037652906, 665, 785, 194, 786, 197, 788, 12037652910, 665, 789, 12037652908, 665, 790, 198, 791, 200, 793, 12037652912, 665, 794, 12037652909, 665, 795, 201, 796, 12037652913, 665, 798, 202, 799, 12037652914, 665, 801, 203, 802, 12037652915, 665, 804, 204, 805, 12037652916, 665, 807, 205, 808, 12037652917, 665, 810, 206, 811, 12037652918, 665, 813, 207, 814, 12037652919, 665, 816, 208, 817, 12037652911, 665, 820, 199, 821, 25341984824, 371, 822, 12037652923, 665, 824, 12037652924, 665, 825, 12037652925, 665, 826, 12037652926, 665, 828, 12037652927, 665, 829, 25341984825, 371, 830, 213, 831, 12037652921, 665, 833, 217, 834, 12037652928, 665, 836, 12037652929, 665, 838, 12037652930, 665, 840, 12037652931, 665, 842, 12037652932, 665, 844, 12037652933, 665, 846, 12037652934, 665, 848, 12037652935, 665, 850, 12037652936, 665, 852, 12037652922, 665, 854, 12037652937, 665, 855, 12037652938, 665, 857, 12037652940, 665, 858, 12037652939, 665, 861, 25341984827, 371, 862, 25341984828, 371, 864, 25341984829, 371, 866, 25341984830, 371, 868, 25341984831, 371, 870, 25341984832, 371, 872, 25341984833, 371, 874, 25341984834, 371, 876, 12037652969, 665, 878, 12037652957, 665, 880, 12037652959, 665, 881, 12037652960, 665, 882, 1, 883, 12037652961, 665, 885, 25341984835, 371, 886, 12037652962, 665, 888, 12037652963, 665, 890, 12037652964, 665, 892, 12037652965, 665, 894, 12037652966, 665, 896, 12037652967, 665, 898, 12037652968, 665, 900, 25341984836, 371, 901, 12037653107, 665, 902, 12037653130, 665, 903, 12037653129, 665, 904, 12037653128, 665, 905, 12037653127, 665, 906, 12037653126, 665, 907, 12037653125, 665, 908, 12037653124, 665, 909, 12037653123, 665, 910, 12037653122, 665, 911, 12037652977, 665, 912, 12037653042, 665, 913, 12037652985, 665, 914, 12037653043, 665, 915, 12037652993, 665, 916, 12037653044, 665, 917, 12037652986, 665, 918, 12037653045, 665, 919, 12037653001, 665, 920, 12037653046, 665, 921, 12037653009, 665, 922, 12037653047, 665, 923, 12037653041, 665, 924, 12037653049, 665, 925, 12037653017, 665, 926, 12037653048, 665, 927, 12037653018, 665, 928, 12037653050, 665, 929, 12037653019, 665, 930, 12037653051, 665, 931, 12037653020, 665, 932, 12037653052, 665, 933, 12037653021, 665, 934, 12037653053, 665, 935, 45, 936, 12037653054, 665, 937, 12037653023, 665, 938, 12037653055, 665, 939, 12037653024, 665, 940, 12037653056, 665, 941, 12037653108, 665, 942, 12037653114, 665, 943, 12037653109, 665, 944, 12037653115, 665, 945, 12037653110, 665, 946, 12037653116, 665, 947, 12037653111, 665, 948, 12037653117, 665, 949, 12037653112, 665, 950, 12037653118, 665, 951, 12037653113, 665, 952, 12037653119, 665, 953, 12037653025, 665, 954, 12037653057, 665, 955, 12037653033, 665, 956, 12037653072, 665, 957, 12037653121, 665, 958, 12037653131, 665, 959, 25341984837, 371, 960, 12037653058, 665, 961, 12037652976, 665, 963, 12037652984, 665, 964, 12037652992, 665, 965, 12037653000, 665, 966, 12037653008, 665, 967, 12037653016, 665, 968, 12037653040, 665, 969, 12037653032, 665, 970, 12037652975, 665, 972, 12037652983, 665, 973, 12037652991, 665, 974, 12037652999, 665, 975, 12037653007, 665, 976, 12037653015, 665, 977, 12037653039, 665, 978, 12037653031, 665, 979, 12037652974, 665, 981, 12037652982, 665, 982, 12037652990, 665, 983, 12037652998, 665, 984, 12037653006, 665, 985, 12037653014, 665, 986, 12037653038, 665, 987, 12037653030, 665, 988, 12037652973, 665, 990, 12037652981, 665, 991, 12037652989, 665, 992, 12037652997, 665, 993, 12037653005, 665, 994, 12037653013, 665, 995, 12037653037, 665, 996, 12037653029, 665, 997, 12037652972, 665, 999, 12037652980, 665, 1000, 12037652988, 665, 1001, 12037652996, 665, 1002, 12037653004, 665, 1003, 12037653012, 665, 1004, 12037653036, 665, 1005, 12037653028, 665, 1006, 12037652971, 665, 1008, 12037652979, 665, 1009, 12037652987, 665, 1010, 12037652995, 665, 1011, 12037653003, 665, 1012, 12037653011, 665, 1013, 12037653035, 665, 1014, 12037653027, 665, 1015, 12037652970, 665, 1017, 12037652978, 665, 1018, 12037652994, 665, 1019, 12037653002, 665, 1020, 12037653010, 665, 1021, 12037653034, 665, 1022, 12037653026, 665, 1023, 12037653059, 665, 1025, 12037653060, 665, 1034, 12037653061, 665, 1043, 12037653062, 665, 1052, 12037653063, 665, 1061, 12037653064, 665, 1070, 12037653076, 665, 1072, 12037653065, 665, 1073, 12037653066, 665, 1075, 12037653068, 665, 1077, 12037653022, 665, 1078, 12037653105, 665, 1079, 12037653067, 665, 1081, 25341984838, 371, 1083, 12037653070, 665, 1084, 12037653069, 665, 1086, 12037653093, 665, 1087, 12037653097, 665, 1088, 12037653094, 665, 1089, 12037653098, 665, 1090, 12037653071, 665, 1092, 12037653073, 665, 1093, 12037653082, 665, 1094, 12037653074, 665, 1095, 12037653106, 665, 1096, 12037653134, 665, 1097, 25341984841, 371, 1098, 12037653136, 665, 1099, 25341984840, 371, 1100, 25341984839, 371, 1101, 12037653103, 665, 1103, 12037653087, 665, 1104, 12037653088, 665, 1105, 12037653089, 665, 1106, 12037653101, 665, 1107, 12037653096, 665, 1108, 12037653095, 665, 1109, 12037653100, 665, 1110, 12037653099, 665, 1111, 12037653079, 665, 1112, 12037653080, 665, 1113, 12037653078, 665, 1114, 12037653077, 665, 1115, 12037653090, 665, 1116, 12037653091, 665, 1117, 12037653092, 665, 1118, 12037653083, 665, 1119, 12037653084, 665, 1120, 12037653104, 665, 1121, 12037653086, 665, 1122, 12037653085, 665, 1123, 12037653081, 665, 1124, 12037653135, 665, 1125, 12037653120, 665, 1128, 25341984845, 371, 1133, 23194501143, 128, 1134, 23194501140, 128, 1135, 25341984998, 371, 1138, 25341984848, 371, 1139, 23194501149, 128, 1140, 23194501146, 128, 1141, 25341985001, 371, 1144, 25341984851, 371, 1145, 23194501121, 128, 1146, 23194501120, 128, 1147, 25341985004, 371, 1150, 25341984854, 371, 1151, 23194501123, 128, 1152, 23194501122, 128, 1153, 25341985007, 371, 1156, 25341984857, 371, 1157, 23194501125, 128, 1158, 23194501124, 128, 1159, 25341985010, 371, 1162, 25341984860, 371, 1163, 23194501127, 128, 1164, 23194501126, 128, 1165, 25341985013, 371, 1168, 25341984863, 371, 1169, 23194501155, 128, 1170, 23194501152, 128, 1171, 25341985016, 371, 1174, 25341984866, 371, 1175, 23194501129, 128, 1176, 23194501128, 128, 1177, 25341985019, 371, 1180, 25341984869, 371, 1181, 23194501131, 128, 1182, 23194501130, 128, 1183, 25341985022, 371, 1186, 25341984872, 371, 1187, 23194501133, 128, 1188, 23194501132, 128, 1189, 25341985025, 371, 1192, 25341984875, 371, 1193, 23194501161, 128, 1194, 23194501158, 128, 1195, 25341985028, 371, 1198, 25341984878, 371, 1199, 23194501167, 128, 1200, 23194501164, 128, 1201, 25341985031, 371, 1204, 25341984881, 371, 1205, 23194501135, 128, 1206, 23194501134, 128, 1207, 25341985034, 371, 1210, 25341984884, 371, 1211, 23194501173, 128, 1212, 23194501170, 128, 1213, 25341985037, 371, 1216, 25341984887, 371, 1217, 23194501179, 128, 1218, 23194501176, 128, 1219, 25341985040, 371, 1222, 25341984890, 371, 1223, 23194501185, 128, 1224, 23194501182, 128, 1225, 25341985043, 371, 1228, 25341984893, 371, 1229, 23194501191, 128, 1230, 23194501188, 128, 1231, 25341985046, 371, 1234, 25341984896, 371, 1235, 23194501197, 128, 1236, 23194501194, 128, 1237, 25341985049, 371, 1240, 25341984899, 371, 1241, 23194501203, 128, 1242, 23194501200, 128, 1243, 25341985052, 371, 1246, 25341984902, 371, 1247, 23194501209, 128, 1248, 23194501206, 128, 1249, 25341985055, 371, 1252, 25341984905, 371, 1253, 23194501215, 128, 1254, 23194501212, 128, 1255, 25341985058, 371, 1258, 25341984908, 371, 1259, 23194501221, 128, 1260, 23194501218, 128, 1261, 25341985061, 371, 1264, 25341984911, 371, 1265, 23194501227, 128, 1266, 23194501224, 128, 1267, 25341985064, 371, 1270, 25341984914, 371, 1271, 23194501137, 128, 1272, 23194501136, 128, 1273, 25341984844, 371, 1276, 25341984917, 371, 1278, 23194501139, 128, 1279, 23194501138, 128, 1280, 25341985067, 371, 1283, 25341984920, 371, 1284, 23194501233, 128, 1285, 23194501230, 128, 1286, 25341985070, 371, 1289, 25341984923, 371, 1290, 23194501239, 128, 1291, 23194501236, 128, 1292, 25341985073, 371, 1295, 25341984926, 371, 1296, 23194501245, 128, 1297, 23194501242, 128, 1298, 25341985076, 371, 1301, 25341984929, 371, 1302, 12037652751, 665, 1303, 12037652752, 665, 1304, 12037652753, 665, 1305, 12037652754, 665, 1306, 12037652755, 665, 1307, 12037652756, 665, 1308, 12037652757, 665, 1309, 12037652758, 665, 1310, 25341985079, 371, 1312, 25341984932, 371, 1313, 25341985082, 371, 1315, 25341984935, 371, 1316, 25341985085, 371, 1318, 25341984938, 371, 1319, 25341985088, 371, 1321, 25341984941, 371, 1322, 25341985091, 371, 1324, 25341984944, 371, 1325, 12037652743, 665, 1326, 12037652742, 665, 1327, 25341985094, 371, 1329, 25341984947, 371, 1330, 25341985097, 371, 1332, 25341984950, 371, 1333, 25341985100, 371, 1335, 25341984953, 371, 1336, 25341985103, 371, 1338, 25341984956, 371, 1339, 25341985106, 371, 1341, 25341984959, 371, 1342, 12037652958, 665, 1343, 25341985109, 371, 1345, 25341984962, 371, 1346, 12037653137, 665, 1347, 12037653138, 665, 1348, 12037653139, 665, 1349, 12037653140, 665, 1350, 25341984965, 371, 1352, 12037653141, 665, 1353, 12037653142, 665, 1354, 12037653143, 665, 1355, 12037653144, 665, 1356, 25341984968, 371, 1358, 25341985112, 371, 1360, 25341984971, 371, 1361, 25341985115, 371, 1363, 25341984974, 371, 1364, 25341985118, 371, 1366, 25341984977, 371, 1367, 25341985121, 371, 1369, 25341984980, 371, 1370, 25341985124, 371, 1372, 25341984983, 371, 1373, 25341985130, 371, 1375, 25341985127, 371, 1376, 25341984986, 371, 1377, 25341985136, 371, 1379, 25341985133, 371, 1380, 12037652525, 665, 1381, 126, 1382, 25341984776, 371, 1383, 127, 1384, 25341984778, 371, 1385, 128, 1386, 25341984780, 371, 1387, 129, 1388, 25341984782, 371, 1389, 130, 1390, 25341984784, 371, 1391, 131, 1392, 25341984786, 371, 1393, 132, 1394, 25341984788, 371, 1395, 133, 1396, 25341984790, 371, 1397, 134, 1398, 25341984792, 371, 1399, 135, 1400, 25341984794, 371, 1401, 136, 1402, 25341984796, 371, 1403, 137, 1404, 25341984798, 371, 1405, 25341984777, 371, 1406, 25341984779, 371, 1407, 125, 1408, 25341984781, 371, 1409, 25341984783, 371, 1410, 25341984785, 371, 1411, 25341984787, 371, 1412, 25341984789, 371, 1413, 25341984791, 371, 1414, 25341984793, 371, 1415, 25341984795, 371, 1416, 25341984797, 371, 1417, 25341984799, 371, 1418, 12037653075, 665, 1421, 25341984842, 371, 1423, 25341984843, 371, 1424, 3, 1425, 2, 1426, 46, 1429, 12037652482, 665, 1430, 103, 1431, 101, 1432, 102, 1433, 104, 1434, 84, 1435, 93, 1436, 94, 1437, 95, 1438, 96, 1439, 97, 1440, 98, 1441, 99, 1442, 100, 1443, 6, 1458, 7, 1459, 8, 1460, 9, 1461, 10, 1462, 11, 1463, 12, 1464, 13, 1465, 14, 1466, 15, 1467, 16, 1468, 17, 1469, 18, 1470, 19, 1471, 20, 1472, 22, 1473, 23, 1474, 24, 1475, 25, 1476, 26, 1477, 27, 1478, 28, 1479, 29, 1480, 30, 1481, 31, 1482, 32, 1483, 33, 1484, 34, 1485, 35, 1486, 4, 1487, 106, 1489, 105, 1490, 107, 1493, 12037652739, 665, 1495, 12037652740, 665, 1496, 110, 1497, 108, 1498, 109, 1499, 111, 1500, 112, 1501, 113, 1502, 12037652774, 665, 1511, 12037652794, 665, 1513, 12037652795, 665, 1514, 12037652796, 665, 1515, 12037652797, 665, 1516, 12037652798, 665, 1517, 12037652799, 665, 1518, 12037652800, 665, 1519, 12037652801, 665, 1520, 37, 1521, 38, 1522, 39, 1523, 40, 1524, 41, 1525, 42, 1526, 43, 1527, 44, 1528, 12037652878, 665, 1537, 148, 1538, 149, 1539, 150, 1540, 151, 1541, 152, 1542, 153, 1543, 154, 1544, 155, 1545, 156, 1546, 157, 1547, 158, 1548, 159, 1549, 160, 1550, 161, 1551, 162, 1552, 163, 1553, 164, 1554, 165, 1555, 166, 1556, 167, 1557, 168, 1558, 169, 1559, 170, 1560, 171, 1561, 172, 1562, 173, 1563, 174, 1564, 175, 1565, 176, 1566, 177, 1567, 178, 1568, 179, 1569, 180, 1570, 181, 1571, 182, 1572, 183, 1573, 184, 1574, 188, 1612, 12037652902, 665, 1613, 189, 1614, 190, 1615, 191, 1616, 192, 1617, 12037652903, 665, 1622, 12037652904, 665, 1623, 12037652905, 665, 1624, 25341984826, 371, 1625, 212, 1626, 195, 1627, 215, 1628, 216, 1630, 196, 1631, 12037652941, 665, 1633, 12037652942, 665, 1634, 12037652943, 665, 1635, 12037652944, 665, 1636, 12037652945, 665, 1637, 12037652946, 665, 1638, 12037652947, 665, 1639, 12037652948, 665, 1640, 12037653102, 665, 1641, 12037653133, 665, 1642, 47, 1643, 48, 1644, 49, 1645, 50, 1646, 51, 1647, 52, 1648, 53, 1649, 54, 1650, 56, 1651, 57, 1652, 58, 1653, 59, 1654, 60, 1655, 61, 1656, 62, 1657, 63, 1658, 64, 1659, 65, 1660, 66, 1661, 67, 1662, 68, 1663, 69, 1664, 70, 1665, 71, 1666, 72, 1667, 73, 1668, 74, 1669, 75, 1670, 76, 1671, 77, 1672, 83, 1673, 55, 1674, 78, 1675, 79, 1676, 80, 1677, 81, 1678, 82, 1679, 185, 1735, 186, 1736, 187, 1737, 25341984823, 371, 1738, 209, 1739, 210, 1740, 211, 1741, 12037652802, 665, 1742, 12037652803, 665, 1743, 12037652804, 665, 1744, 12037652805, 665, 1745, 12037652806, 665, 1746, 12037652807, 665, 1747, 12037652808, 665, 1748, 12037652809, 665, 1749, 12037652893, 665, 1750, 214, 1751, 12037652920, 665, 1752, 12037652949, 665, 1753, 12037652950, 665, 1754, 12037652951, 665, 1755, 12037652952, 665, 1756, 12037652953, 665, 1757, 12037652954, 665, 1758, 12037652955, 665, 1759, 12037652956, 665, 1760, 12037653132, 665, 1761, 147, 1762, 25341984989, 371, 1763, 25341984992, 371, 1764, 25341984995, 371, 1765, 31566331904, 6, 1766, 31566331907, 6, 1767, 12037652483, 665, 1, 12037652534, 665, 3, 12037652484, 665, 5, 12037652485, 665, 13, 12037652486, 665, 16, 12037652487, 665, 19, 12037652488, 665, 22, 12037652489, 665, 25, 12037652490, 665, 28, 12037652491, 665, 31, 12037652492, 665, 34, 12037652493, 665, 37, 12037652494, 665, 39, 12037652495, 665, 41, 12037652496, 665, 43, 12037652497, 665, 45, 12037652498, 665, 47, 12037652499, 665, 49, 12037652500, 665, 51, 12037652501, 665, 54, 12037652502, 665, 56, 12037652503, 665, 58, 12037652504, 665, 60, 12037652505, 665, 62, 12037652506, 665, 64, 12037652507, 665, 66, 12037652508, 665, 68, 12037652509, 665, 71, 12037652510, 665, 73, 12037652511, 665, 75, 12037652512, 665, 77, 12037652513, 665, 79, 12037652514, 665, 81, 12037652515, 665, 83, 12037652516, 665, 85, 12037652517, 665, 89, 12037652518, 665, 92, 12037652519, 665, 95, 12037652520, 665, 98, 12037652521, 665, 101, 12037652522, 665, 104, 12037652523, 665, 107, 12037652524, 665, 110, 12037652538, 665, 115, 12037652539, 665, 117, 12037652540, 665, 119, 12037652541, 665, 121, 12037652542, 665, 123, 12037652543, 665, 125, 12037652544, 665, 127, 12037652545, 665, 129, 12037652546, 665, 131, 12037652547, 665, 133, 12037652548, 665, 135, 12037652549, 665, 137, 12037652550, 665, 139, 12037652551, 665, 141, 12037652552, 665, 143, 12037652553, 665, 145, 12037652554, 665, 147, 12037652555, 665, 149, 12037652556, 665, 151, 12037652557, 665, 153, 12037652558, 665, 155, 12037652559, 665, 157, 12037652560, 665, 159, 12037652561, 665, 161, 12037652562, 665, 163, 12037652563, 665, 165, 12037652564, 665, 167, 12037652565, 665, 169, 12037652566, 665, 171, 12037652567, 665, 173, 12037652568, 665, 175, 12037652569, 665, 177, 12037652570, 665, 179, 12037652571, 665, 181, 12037652572, 665, 183, 12037652573, 665, 185, 12037652574, 665, 187, 12037652575, 665, 189, 12037652576, 665, 191, 12037652577, 665, 193, 12037652578, 665, 195, 12037652579, 665, 197, 12037652580, 665, 199, 12037652581, 665, 201, 12037652582, 665, 203, 12037652583, 665, 205, 12037652584, 665, 207, 12037652585, 665, 209, 12037652586, 665, 211, 12037652587, 665, 213, 12037652588, 665, 215, 12037652589, 665, 217, 12037652590, 665, 219, 12037652591, 665, 221, 12037652592, 665, 223, 12037652593, 665, 225, 12037652594, 665, 227, 12037652595, 665, 229, 12037652596, 665, 231, 12037652597, 665, 233, 12037652598, 665, 235, 12037652599, 665, 237, 12037652600, 665, 239, 12037652601, 665, 241, 12037652602, 665, 243, 12037652603, 665, 245, 12037652604, 665, 247, 12037652605, 665, 249, 12037652606, 665, 251, 12037652607, 665, 253, 12037652608, 665, 255, 12037652609, 665, 257, 12037652610, 665, 259, 12037652611, 665, 261, 12037652612, 665, 263, 12037652613, 665, 265, 12037652614, 665, 267, 12037652615, 665, 269, 12037652616, 665, 271, 12037652617, 665, 273, 12037652618, 665, 275, 12037652619, 665, 277, 12037652620, 665, 279, 12037652621, 665, 281, 12037652622, 665, 283, 12037652623, 665, 285, 12037652624, 665, 287, 12037652625, 665, 289, 12037652626, 665, 291, 12037652627, 665, 293, 12037652628, 665, 295, 12037652629, 665, 297, 12037652630, 665, 299, 12037652631, 665, 301, 12037652632, 665, 303, 12037652633, 665, 305, 12037652634, 665, 307, 12037652635, 665, 309, 12037652636, 665, 311, 12037652637, 665, 313, 12037652638, 665, 315, 12037652639, 665, 317, 12037652640, 665, 319, 12037652641, 665, 321, 12037652642, 665, 323, 12037652643, 665, 325, 12037652644, 665, 327, 12037652645, 665, 329, 12037652646, 665, 331, 12037652647, 665, 333, 12037652648, 665, 335, 12037652649, 665, 337, 12037652650, 665, 339, 12037652651, 665, 341, 12037652652, 665, 343, 12037652653, 665, 345, 12037652654, 665, 347, 12037652655, 665, 349, 12037652656, 665, 351, 12037652657, 665, 353, 12037652658, 665, 355, 12037652659, 665, 357, 12037652660, 665, 359, 12037652661, 665, 361, 12037652662, 665, 363, 12037652663, 665, 365, 12037652664, 665, 367, 12037652665, 665, 369, 12037652666, 665, 371, 12037652667, 665, 373, 12037652668, 665, 375, 12037652669, 665, 377, 12037652670, 665, 379, 12037652671, 665, 381, 12037652672, 665, 383, 12037652673, 665, 385, 12037652674, 665, 387, 12037652675, 665, 389, 12037652676, 665, 391, 12037652677, 665, 393, 12037652678, 665, 395, 12037652679, 665, 397, 12037652680, 665, 399, 12037652681, 665, 401, 12037652682, 665, 403, 12037652683, 665, 405, 12037652684, 665, 407, 12037652685, 665, 409, 12037652686, 665, 411, 12037652687, 665, 413, 12037652688, 665, 415, 12037652689, 665, 417, 12037652690, 665, 419, 12037652691, 665, 421, 12037652692, 665, 423, 12037652693, 665, 425, 12037652694, 665, 427, 12037652695, 665, 429, 12037652696, 665, 431, 12037652697, 665, 433, 12037652701, 665, 435, 12037652702, 665, 437, 12037652703, 665, 439, 12037652704, 665, 441, 12037652705, 665, 447, 12037652706, 665, 451, 12037652707, 665, 453, 5, 457, 21, 458, 12037652738, 665, 459, 12037652739, 665, 462, 12037652742, 665, 463, 12037652743, 665, 464, 12037652714, 665, 469, 12037652715, 665, 472, 12037652716, 665, 475, 12037652717, 665, 478, 12037652718, 665, 481, 12037652719, 665, 484, 12037652720, 665, 487, 12037652721, 665, 490, 12037652722, 665, 494, 12037652723, 665, 496, 12037652724, 665, 498, 12037652725, 665, 500, 12037652726, 665, 502, 12037652727, 665, 504, 12037652728, 665, 506, 12037652729, 665, 508, 12037652730, 665, 513, 12037652731, 665, 515, 12037652732, 665, 517, 12037652733, 665, 519, 12037652734, 665, 521, 12037652735, 665, 523, 12037652736, 665, 525, 12037652737, 665, 527, 12037652747, 665, 528, 12037652748, 665, 531, 12037652749, 665, 533, 12037652750, 665, 535, 12037652751, 665, 537, 12037652752, 665, 539, 12037652753, 665, 541, 12037652754, 665, 543, 12037652755, 665, 545, 12037652756, 665, 547, 12037652757, 665, 549, 12037652758, 665, 551, 12037652759, 665, 562, 12037652760, 665, 563, 12037652761, 665, 564, 12037652762, 665, 565, 12037652776, 665, 571, 12037652778, 665, 575, 12037652766, 665, 582, 12037652767, 665, 585, 12037652768, 665, 588, 12037652769, 665, 591, 12037652770, 665, 594, 12037652771, 665, 597, 12037652772, 665, 600, 12037652773, 665, 603, 12037652781, 665, 604, 12037652782, 665, 606, 12037652783, 665, 608, 12037652784, 665, 610, 12037652785, 665, 613, 12037652786, 665, 615, 12037652787, 665, 617, 12037652788, 665, 619, 12037652789, 665, 621, 12037652790, 665, 622, 12037652775, 665, 624, 0, 626, 12037652791, 665, 629, 12037652792, 665, 630, 12037652802, 665, 633, 12037652803, 665, 635, 12037652804, 665, 637, 12037652805, 665, 639, 12037652806, 665, 641, 12037652807, 665, 643, 12037652808, 665, 645, 12037652809, 665, 647, 12037652892, 665, 653, 12037652814, 665, 677, 12037652815, 665, 688, 12037652816, 665, 699, 12037652817, 665, 709, 12037652818, 665, 712, 12037652819, 665, 714, 12037652820, 665, 716, 12037652821, 665, 718, 12037652822, 665, 720, 12037652823, 665, 721, 12037652824, 665, 722, 12037652825, 665, 723, 12037652826, 665, 725, 12037652827, 665, 726, 12037652828, 665, 727, 12037652829, 665, 728, 12037652830, 665, 730, 12037652831, 665, 731, 12037652832, 665, 732, 12037652833, 665, 733, 12037652834, 665, 735, 12037652835, 665, 736, 12037652836, 665, 737, 12037652837, 665, 738, 12037652838, 665, 740, 12037652839, 665, 741, 12037652840, 665, 742, 12037652841, 665, 743, 12037652842, 665, 747, 12037652843, 665, 749, 12037652844, 665, 751, 12037652845, 665, 753, 12037652846, 665, 757, 12037652847, 665, 758, 12037652848, 665, 759, 12037652849, 665, 760, 12037652850, 665, 762, 12037652851, 665, 765, 12037652852, 665, 766, 12037652853, 665, 767, 12037652854, 665, 768, 12037652855, 665, 774, 12037652907, 665, 787, 12037652910, 665, 792, 12037652912, 665, 797, 12037652913, 665, 800, 12037652914, 665, 803, 12037652915, 665, 806, 12037652916, 665, 809, 12037652917, 665, 812, 12037652918, 665, 815, 12037652919, 665, 818, 12037652911, 665, 819, 12037652923, 665, 823, 12037652925, 665, 827, 12037652921, 665, 832, 12037652928, 665, 835, 12037652929, 665, 837, 12037652930, 665, 839, 12037652931, 665, 841, 12037652932, 665, 843, 12037652933, 665, 845, 12037652934, 665, 847, 12037652935, 665, 849, 12037652936, 665, 851, 12037652922, 665, 853, 12037652937, 665, 856, 12037652938, 665, 859, 12037652939, 665, 860, 12037652949, 665, 863, 12037652950, 665, 865, 12037652951, 665, 867, 12037652952, 665, 869, 12037652953, 665, 871, 12037652954, 665, 873, 12037652955, 665, 875, 12037652956, 665, 877, 12037652957, 665, 879, 12037652961, 665, 884, 12037652962, 665, 887, 12037652963, 665, 889, 12037652964, 665, 891, 12037652965, 665, 893, 12037652966, 665, 895, 12037652967, 665, 897, 12037652968, 665, 899, 12037652977, 665, 962, 12037652976, 665, 971, 12037652975, 665, 980, 12037652974, 665, 989, 12037652973, 665, 998, 12037652972, 665, 1007, 12037652971, 665, 1016, 12037652970, 665, 1024, 12037652985, 665, 1026, 12037652984, 665, 1027, 12037652983, 665, 1028, 12037652982, 665, 1029, 12037652981, 665, 1030, 12037652980, 665, 1031, 12037652979, 665, 1032, 12037652978, 665, 1033, 12037652993, 665, 1035, 12037652992, 665, 1036, 12037652991, 665, 1037, 12037652990, 665, 1038, 12037652989, 665, 1039, 12037652988, 665, 1040, 12037652987, 665, 1041, 12037652986, 665, 1042, 12037653001, 665, 1044, 12037653000, 665, 1045, 12037652999, 665, 1046, 12037652998, 665, 1047, 12037652997, 665, 1048, 12037652996, 665, 1049, 12037652995, 665, 1050, 12037652994, 665, 1051, 12037653009, 665, 1053, 12037653008, 665, 1054, 12037653007, 665, 1055, 12037653006, 665, 1056, 12037653005, 665, 1057, 12037653004, 665, 1058, 12037653003, 665, 1059, 12037653002, 665, 1060, 12037653017, 665, 1062, 12037653016, 665, 1063, 12037653015, 665, 1064, 12037653014, 665, 1065, 12037653013, 665, 1066, 12037653012, 665, 1067, 12037653011, 665, 1068, 12037653010, 665, 1069, 12037653018, 665, 1071, 12037653019, 665, 1074, 12037653020, 665, 1076, 12037653023, 665, 1080, 12037653021, 665, 1082, 12037653025, 665, 1085, 12037653024, 665, 1091, 12037653022, 665, 1102, 12037653108, 665, 1126, 12037653109, 665, 1127, 12037653111, 665, 1129, 12037653113, 665, 1130, 12037653112, 665, 1131, 12037653110, 665, 1132, 23194501140, 128, 1136, 25341984845, 371, 1137, 23194501146, 128, 1142, 25341984848, 371, 1143, 23194501120, 128, 1148, 25341984851, 371, 1149, 23194501122, 128, 1154, 25341984854, 371, 1155, 23194501124, 128, 1160, 25341984857, 371, 1161, 23194501126, 128, 1166, 25341984860, 371, 1167, 23194501152, 128, 1172, 25341984863, 371, 1173, 23194501128, 128, 1178, 25341984866, 371, 1179, 23194501130, 128, 1184, 25341984869, 371, 1185, 23194501132, 128, 1190, 25341984872, 371, 1191, 23194501158, 128, 1196, 25341984875, 371, 1197, 23194501164, 128, 1202, 25341984878, 371, 1203, 23194501134, 128, 1208, 25341984881, 371, 1209, 23194501170, 128, 1214, 25341984884, 371, 1215, 23194501176, 128, 1220, 25341984887, 371, 1221, 23194501182, 128, 1226, 25341984890, 371, 1227, 23194501188, 128, 1232, 25341984893, 371, 1233, 23194501194, 128, 1238, 25341984896, 371, 1239, 23194501200, 128, 1244, 25341984899, 371, 1245, 23194501206, 128, 1250, 25341984902, 371, 1251, 23194501212, 128, 1256, 25341984905, 371, 1257, 23194501218, 128, 1262, 25341984908, 371, 1263, 23194501224, 128, 1268, 25341984911, 371, 1269, 23194501136, 128, 1274, 45, 1275, 25341984914, 371, 1277, 23194501138, 128, 1281, 25341984917, 371, 1282, 23194501230, 128, 1287, 25341984920, 371, 1288, 23194501236, 128, 1293, 25341984923, 371, 1294, 23194501242, 128, 1299, 25341984926, 371, 1300, 25341984929, 371, 1311, 25341984932, 371, 1314, 25341984935, 371, 1317, 25341984938, 371, 1320, 25341984941, 371, 1323, 25341984944, 371, 1328, 25341984947, 371, 1331, 25341984950, 371, 1334, 25341984953, 371, 1337, 25341984956, 371, 1340, 25341984959, 371, 1344, 25341984962, 371, 1351, 25341984965, 371, 1357, 25341984968, 371, 1359, 25341984971, 371, 1362, 25341984974, 371, 1365, 25341984977, 371, 1368, 25341984980, 371, 1371, 25341984983, 371, 1374, 25341984986, 371, 1378, 12037652959, 665, 1419, 12037652960, 665, 1420, 12037652958, 665, 1422, 3, 1427, 2, 1428, 46, 1444, 103, 1445, 101, 1446, 102, 1447, 104, 1448, 84, 1449, 93, 1450, 94, 1451, 95, 1452, 96, 1453, 97, 1454, 98, 1455, 99, 1456, 100, 1457, 4, 1488, 106, 1491, 105, 1492, 107, 1494, 110, 1503, 108, 1504, 109, 1505, 111, 1506, 112, 1507, 113, 1508, 12037652746, 665, 1509, 12037652745, 665, 1510, 123, 1512, 37, 1529, 38, 1530, 39, 1531, 40, 1532, 41, 1533, 42, 1534, 43, 1535, 44, 1536, 148, 1575, 149, 1576, 150, 1577, 151, 1578, 152, 1579, 153, 1580, 154, 1581, 155, 1582, 156, 1583, 157, 1584, 158, 1585, 159, 1586, 160, 1587, 161, 1588, 162, 1589, 163, 1590, 164, 1591, 165, 1592, 166, 1593, 167, 1594, 168, 1595, 169, 1596, 170, 1597, 171, 1598, 172, 1599, 173, 1600, 174, 1601, 175, 1602, 176, 1603, 177, 1604, 178, 1605, 179, 1606, 180, 1607, 181, 1608, 182, 1609, 183, 1610, 184, 1611, 189, 1618, 190, 1619, 191, 1620, 192, 1621, 195, 1629, 196, 1632, 47, 1680, 48, 1681, 49, 1682, 50, 1683, 51, 1684, 52, 1685, 53, 1686, 54, 1687, 56, 1688, 57, 1689, 58, 1690, 59, 1691, 60, 1692, 61, 1693, 62, 1694, 63, 1695, 64, 1696, 65, 1697, 66, 1698, 67, 1699, 68, 1700, 69, 1701, 70, 1702, 71, 1703, 72, 1704, 73, 1705, 74, 1706, 75, 1707, 76, 1708, 77, 1709, 83, 1710, 55, 1711, 78, 1712, 79, 1713, 80, 1714, 81, 1715, 82, 1716, 25341984827, 371, 1717, 25341984828, 371, 1718, 25341984829, 371, 1719, 25341984830, 371, 1720, 25341984831, 371, 1721, 25341984832, 371, 1722, 25341984833, 371, 1723, 25341984834, 371, 1724, 25341984842, 371, 1725, 25341984814, 371, 1726, 25341984815, 371, 1727, 25341984816, 371, 1728, 25341984817, 371, 1729, 25341984818, 371, 1730, 25341984819, 371, 1731, 25341984820, 371, 1732, 25341984821, 371, 1733, 25341984843, 371, 1734};
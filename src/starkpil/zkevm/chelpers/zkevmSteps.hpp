@@ -14,31 +14,45 @@ public:
     void step2prev_i(StepsParams &params, uint64_t i);
     void step2prev_last(StepsParams &params, uint64_t i);
     void step2prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step2prev_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
 
     void step3prev_first(StepsParams &params, uint64_t i);
     void step3prev_i(StepsParams &params, uint64_t i);
     void step3prev_last(StepsParams &params, uint64_t i);
     void step3prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step3prev_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
 
     void step3_first(StepsParams &params, uint64_t i);
     void step3_i(StepsParams &params, uint64_t i);
     void step3_last(StepsParams &params, uint64_t i);
     void step3_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step3_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step3_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step3_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+#ifdef COMPILED_CHELPERS
+    bool step3_parser_first_avx_compiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+#endif
 
     void step42ns_first(StepsParams &params, uint64_t i);
     void step42ns_i(StepsParams &params, uint64_t i);
     void step42ns_last(StepsParams &params, uint64_t i);
     void step42ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx_args(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch, const uint64_t *args42);
+    void step42ns_parser_first_avx512_args(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch, const uint64_t *args42);
+    bool step42ns_parser_first_tiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch, uint64_t tileBytes);
     void step42ns_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+#ifdef COMPILED_CHELPERS
+    bool step42ns_parser_first_avx_compiled(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+#endif
 
     void step52ns_first(StepsParams &params, uint64_t i);
     void step52ns_i(StepsParams &params, uint64_t i);
     void step52ns_last(StepsParams &params, uint64_t i);
     void step52ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step52ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step52ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
 };
 
 #endif // STARKS_STEPS_HPP
@@ -0,0 +1,210 @@
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <cstring>
+#include <cerrno>
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <omp.h>
+#include "memory_arena.hpp"
+#include "exit_process.hpp"
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+#define MEMORY_ARENA_MPOL_BIND 2       // Same values as MPOL_BIND and MPOL_INTERLEAVE in numaif.h, to avoid depending on libnuma
+#define MEMORY_ARENA_MPOL_INTERLEAVE 3
+#define MEMORY_ARENA_THP_SIZE (1ULL << MEMORY_ARENA_HUGE_PAGE_2MB_BITS) // Size of transparent huge pages
+
+// Returns the ids of the NUMA nodes of the system in increasing order, which need not be contiguous, or {0} if they cannot be known
+static vector<uint64_t> getNumaNodes(void)
+{
+    vector<uint64_t> nodes;
+    DIR *pDir = opendir("/sys/devices/system/node");
+    if (pDir != NULL)
+    {
+        struct dirent *pEntry;
+        while ((pEntry = readdir(pDir)) != NULL)
+        {
+            if ((strncmp(pEntry->d_name, "node", 4) == 0) && (pEntry->d_name[4] >= '0') && (pEntry->d_name[4] <= '9'))
+            {
+                nodes.push_back(strtoull(&pEntry->d_name[4], NULL, 10));
+            }
+        }
+        closedir(pDir);
+    }
+    if (nodes.empty())
+    {
+        nodes.push_back(0);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+// Calls mbind() with a node mask of the given node ids
+static bool numaBind(void *pAddress, uint64_t size, int mode, const vector<uint64_t> &nodes)
+{
+    uint64_t bitsPerWord = 8 * sizeof(unsigned long);
+    uint64_t maxNode = nodes.back() + 1;
+    vector<unsigned long> nodeMask((maxNode + bitsPerWord - 1) / bitsPerWord, 0);
+    for (uint64_t i = 0; i < nodes.size(); i++)
+    {
+        nodeMask[nodes[i] / bitsPerWord] |= 1UL << (nodes[i] % bitsPerWord);
+    }
+    // The kernel reads maxnode - 1 bits of the mask
+    return syscall(SYS_mbind, pAddress, size, mode, nodeMask.data(), maxNode + 1, 0) == 0;
+}
+
+static uint64_t alignUp(uint64_t value, uint64_t alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+// Bounds of the chunk of a thread in [0, size), split evenly among nThreads and aligned to pageSize in the address space,
+// so that no page is shared by two threads
+static void getChunk(const void *pAddress, uint64_t size, uint64_t pageSize, uint64_t thread, uint64_t nThreads, uint64_t &start, uint64_t &end)
+{
+    uint64_t base = (uint64_t)pAddress;
+    uint64_t chunk = (size + nThreads - 1) / nThreads;
+    start = (thread == 0) ? 0 : std::min(size, alignUp(base + thread * chunk, pageSize) - base);
+    end = (thread == nThreads - 1) ? size : std::min(size, alignUp(base + (thread + 1) * chunk, pageSize) - base);
+}
+
+void *MemoryArena::allocate(uint64_t _size, const string &hugePages, const string &numaPolicy)
+{
+    if (pAddress != NULL)
+    {
+        cerr << "Error: MemoryArena::allocate() called with an already allocated arena" << endl;
+        exitProcess();
+    }
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+    uint64_t pageBits = 0;
+    if (hugePages == "2MB")
+    {
+        pageBits = MEMORY_ARENA_HUGE_PAGE_2MB_BITS;
+    }
+    else if (hugePages == "1GB")
+    {
+        pageBits = MEMORY_ARENA_HUGE_PAGE_1GB_BITS;
+    }
+    else if ((hugePages != "") && (hugePages != "thp"))
+    {
+        cerr << "Error: MemoryArena::allocate() found invalid hugePages=" << hugePages << endl;
+        exitProcess();
+    }
+
+    // Explicit huge pages require the size to be a multiple of the page size
+    bool bTransparentHugePages = (hugePages == "thp");
+    if (pageBits > 0)
+    {
+        uint64_t hugePageSize = 1ULL << pageBits;
+        size = ((_size + hugePageSize - 1) / hugePageSize) * hugePageSize;
+        pAddress = mmap(NULL, size, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB | (pageBits << MAP_HUGE_SHIFT), -1, 0);
+        if (pAddress == MAP_FAILED)
+        {
+            cout << "MemoryArena::allocate() could not map " << size << " bytes with " << hugePages << " huge pages (errno=" << errno << "); using transparent huge pages instead" << endl;
+            pAddress = NULL;
+            bTransparentHugePages = true;
+        }
+        else
+        {
+            pageSize = hugePageSize;
+        }
+    }
+    if (pAddress == NULL)
+    {
+        size = _size;
+        pAddress = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (pAddress == MAP_FAILED)
+        {
+            cerr << "Error: MemoryArena::allocate() failed calling mmap() of size " << size << " errno=" << errno << endl;
+            pAddress = NULL;
+            exitProcess();
+        }
+        if (bTransparentHugePages)
+        {
+            if (madvise(pAddress, size, MADV_HUGEPAGE) != 0)
+            {
+                cout << "MemoryArena::allocate() failed calling madvise(MADV_HUGEPAGE) errno=" << errno << endl;
+            }
+            else
+            {
+                pageSize = MEMORY_ARENA_THP_SIZE;
+            }
+        }
+    }
+
+    if (numaPolicy == "interleave")
+    {
+        vector<uint64_t> nodes = getNumaNodes();
+        if (!numaBind(pAddress, size, MEMORY_ARENA_MPOL_INTERLEAVE, nodes))
+        {
+            cout << "MemoryArena::allocate() failed calling mbind(MPOL_INTERLEAVE) over " << nodes.size() << " nodes errno=" << errno << endl;
+        }
+    }
+    else if (numaPolicy == "bind")
+    {
+        // Part i, aligned to pages, goes to the i-th node
+        vector<uint64_t> nodes = getNumaNodes();
+        for (uint64_t i = 0; i < nodes.size(); i++)
+        {
+            uint64_t start, end;
+            getChunk(pAddress, size, pageSize, i, nodes.size(), start, end);
+            if ((end > start) && !numaBind((uint8_t *)pAddress + start, end - start, MEMORY_ARENA_MPOL_BIND, {nodes[i]}))
+            {
+                cout << "MemoryArena::allocate() failed calling mbind(MPOL_BIND) to node " << nodes[i] << " errno=" << errno << endl;
+            }
+        }
+    }
+    else if (numaPolicy != "")
+    {
+        cerr << "Error: MemoryArena::allocate() found invalid numaPolicy=" << numaPolicy << endl;
+        exitProcess();
+    }
+
+    // First touch, so that pages are actually placed before the executor uses them
+    parallelZero(pAddress, size, pageSize);
+
+    return pAddress;
+}
+
+void MemoryArena::release(void)
+{
+    if (pAddress != NULL)
+    {
+        munmap(pAddress, size);
+        pAddress = NULL;
+        size = 0;
+        pageSize = MEMORY_ARENA_PAGE_SIZE;
+    }
+}
+
+void MemoryArena::parallelZero(void *pAddress, uint64_t size, uint64_t pageSize)
+{
+#pragma omp parallel
+    {
+        uint64_t start, end;
+        getChunk(pAddress, size, pageSize, omp_get_thread_num(), omp_get_num_threads(), start, end);
+        if (end > start)
+        {
+            memset((uint8_t *)pAddress + start, 0, end - start);
+        }
+    }
+}
+
+void MemoryArena::parallelCopy(void *pDst, const void *pSrc, uint64_t size, uint64_t pageSize)
+{
+#pragma omp parallel
+    {
+        uint64_t start, end;
+        getChunk(pDst, size, pageSize, omp_get_thread_num(), omp_get_num_threads(), start, end);
+        if (end > start)
+        {
+            memcpy((uint8_t *)pDst + start, (const uint8_t *)pSrc + start, end - start);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef MEMORY_ARENA_HPP
+#define MEMORY_ARENA_HPP
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+#define MEMORY_ARENA_PAGE_SIZE 4096
+#define MEMORY_ARENA_HUGE_PAGE_2MB_BITS 21
+#define MEMORY_ARENA_HUGE_PAGE_1GB_BITS 30
+
+/*
+    Large anonymous memory area, e.g. the committed polynomials shared by the executor and the starks.
+    hugePages can be "" (default pages), "thp" (transparent huge pages), "2MB" or "1GB" (explicit huge pages,
+    that must be reserved in the system; otherwise it falls back to transparent huge pages).
+    numaPolicy can be "" (pages are placed by the first thread that touches them), "interleave" (pages are
+    interleaved among all the NUMA nodes) or "bind" (the area is split in one contiguous part per NUMA node, in the
+    order of their ids, and every part is bound to its node; it matches the static partition of the loops when the
+    OpenMP threads are pinned in the same order, e.g. with OMP_PROC_BIND=close).
+    The area is zeroed in parallel after allocation, so that with the default policy every page is placed in the
+    node of the thread that will process its rows.
+*/
+class MemoryArena
+{
+private:
+    void *pAddress = NULL;
+    uint64_t size = 0;
+    uint64_t pageSize = MEMORY_ARENA_PAGE_SIZE; // Size of the pages backing the area
+
+public:
+    ~MemoryArena() { release(); };
+
+    void *allocate(uint64_t size, const string &hugePages, const string &numaPolicy);
+    void release(void);
+    uint64_t getPageSize(void) const { return pageSize; };
+
+    // Zeroes size bytes using the static partition of omp parallel for loops, i.e. one contiguous chunk per thread,
+    // with the chunk bounds aligned to pageSize so that every page is first touched by the thread that owns its rows
+    static void parallelZero(void *pAddress, uint64_t size, uint64_t pageSize = MEMORY_ARENA_PAGE_SIZE);
+
+    // Copies size bytes with the same partition as parallelZero, aligned to the pages of pDst
+    static void parallelCopy(void *pDst, const void *pSrc, uint64_t size, uint64_t pageSize = MEMORY_ARENA_PAGE_SIZE);
+};
+
+#endif
@@ -407,6 +407,12 @@ uint64_t getNumberOfCores (void)
     return omp_get_num_procs();
 }
 
+bool cpuSupportsAvx512 (void)
+{
+    static bool bSupported = __builtin_cpu_supports("avx512f");
+    return bSupported;
+}
+
 void string2file (const string & s, const string & fileName)
 {
     std::ofstream outfile;
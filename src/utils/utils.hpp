@@ -70,6 +70,9 @@ vector<string> getFolderFiles (string folder, bool sorted);
 // Gets the nubmer of cores in the system processor
 uint64_t getNumberOfCores (void);
 
+// Returns true if the system processor supports AVX-512 (foundation instructions)
+bool cpuSupportsAvx512 (void);
+
 // Save a string into a file
 void string2file (const string &s, const string &fileName);
 
@@ -12,6 +12,9 @@ int main()
     config.mapConstPolsFile = false;
     config.zkevmConstantsTree = "config/zkevm/zkevm.consttree";
     config.zkevmStarkInfo = "config/zkevm/zkevm.starkinfo.json";
+    config.checkCompiledChelpers = true; // Checks the compiled step kernels against the interpreted ones, if built with make chelpers=1
+    config.step42nsTileBytes = 2 * 1024 * 1024; // Several blocks of rows, the last one reading the next rows of the first one
+    config.checkTiledStep42ns = true; // Checks the tiled step42ns, including its dim 3 columns, against the row by row one
 
     StarkInfo starkInfo(config, config.zkevmStarkInfo);
 
@@ -22,7 +25,7 @@ int main()
     void *pCommit = copyFile("config/zkevm/zkevm.commit", starkInfo.nCm1 * sizeof(Goldilocks::Element) * (1 << starkInfo.starkStruct.nBits));
     void *pAddress = (void *)calloc(starkInfo.mapTotalN + (starkInfo.mapSectionsN.section[eSection::cm1_n] * (1 << starkInfo.starkStruct.nBits) * FIELD_EXTENSION ), sizeof(uint64_t));
 
-        Starks starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo},pAddress);
+        Starks starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo, config.zkevmDomainTables},pAddress);
 
 
     std::memcpy(pAddress, pCommit, starkInfo.nCm1 * sizeof(Goldilocks::Element) * (1 << starkInfo.starkStruct.nBits));
@@ -82,6 +85,7 @@ int main()
         publicStarkJson[i] = Goldilocks::toString(publicInputs[i]);
     }
     ZkevmSteps zkevmSteps;
+    starks.nrowsStepBatch = 4; // AVX2 parsers, the only ones that use the compiled step kernels
     starks.genProof(fproof, &publicInputs[0], &zkevmSteps);
 
     nlohmann::ordered_json jProof = fproof.proofs.proof2json();
@@ -0,0 +1,106 @@
+#include <vector>
+#include "prover_scheduler_test.hpp"
+#include "prover_scheduler.hpp"
+#include "timer.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+// Pops all the requests of the scheduler, checks that they come in the expected order, and deletes them
+static void checkOrder (const string &test, ProverScheduler &scheduler, const vector<ProverRequest *> &expected)
+{
+    for (uint64_t i = 0; i < expected.size(); i++)
+    {
+        ProverRequest *pFront = scheduler.front();
+        ProverRequest *pProverRequest = scheduler.pop();
+        if ((pProverRequest != expected[i]) || (pFront != pProverRequest))
+        {
+            cerr << "Error: ProverSchedulerTest() " << test << " popped request " << i << " of type " << ((pProverRequest == NULL) ? "none" : proverRequestType2string(pProverRequest->type)) << " instead of type " << proverRequestType2string(expected[i]->type) << endl;
+            exitProcess();
+        }
+    }
+    if ((scheduler.size() != 0) || (scheduler.pop() != NULL))
+    {
+        cerr << "Error: ProverSchedulerTest() " << test << " has " << scheduler.size() << " requests left" << endl;
+        exitProcess();
+    }
+    for (uint64_t i = 0; i < expected.size(); i++)
+    {
+        delete expected[i];
+    }
+}
+
+void ProverSchedulerTest (Goldilocks &fr, Config &config)
+{
+    TimerStart(PROVER_SCHEDULER_TEST);
+
+    // The scheduler keeps a reference to its config, so the tests below change it between pushes
+    Config schedulerConfig = config;
+    schedulerConfig.schedulerPriority.assign(PROVER_SCHEDULER_QUEUES, 1);
+    schedulerConfig.schedulerWeight.assign(PROVER_SCHEDULER_QUEUES, 1);
+    schedulerConfig.schedulerMaxWait.assign(PROVER_SCHEDULER_QUEUES, 0);
+    schedulerConfig.schedulerPriority[prt_genFinalProof] = 2;
+
+    // A higher priority queue is served first, whatever the arrival order
+    {
+        ProverScheduler scheduler(schedulerConfig);
+        ProverRequest *pBatch = new ProverRequest(fr, config, prt_genBatchProof);
+        ProverRequest *pAggregated = new ProverRequest(fr, config, prt_genAggregatedProof);
+        ProverRequest *pFinal = new ProverRequest(fr, config, prt_genFinalProof);
+        scheduler.push(pBatch);
+        scheduler.push(pAggregated);
+        scheduler.push(pFinal);
+        checkOrder("priority", scheduler, {pFinal, pBatch, pAggregated});
+    }
+
+    // Queues with the same priority are served in proportion to their weights, ties going to the lower type: with weights 2 and 1, A B A A B A A B
+    {
+        schedulerConfig.schedulerWeight[prt_genBatchProof] = 2;
+        ProverScheduler scheduler(schedulerConfig);
+        vector<ProverRequest *> batches;
+        vector<ProverRequest *> aggregations;
+        for (uint64_t i = 0; i < 6; i++)
+        {
+            batches.push_back(new ProverRequest(fr, config, prt_genBatchProof));
+            scheduler.push(batches.back());
+            aggregations.push_back(new ProverRequest(fr, config, prt_genAggregatedProof));
+            scheduler.push(aggregations.back());
+        }
+        checkOrder("weight", scheduler, {batches[0], aggregations[0], batches[1], batches[2], aggregations[1], batches[3],
+                                         batches[4], aggregations[2], batches[5], aggregations[3], aggregations[4], aggregations[5]});
+        schedulerConfig.schedulerWeight[prt_genBatchProof] = 1;
+    }
+
+    // A request that exceeded its deadline is served before higher priority ones, the earliest deadline first
+    {
+        ProverScheduler scheduler(schedulerConfig);
+        ProverRequest *pFinal = new ProverRequest(fr, config, prt_genFinalProof);
+        ProverRequest *pBatch = new ProverRequest(fr, config, prt_genBatchProof);
+        ProverRequest *pAggregated = new ProverRequest(fr, config, prt_genAggregatedProof);
+        scheduler.push(pFinal);
+        scheduler.push(pBatch);
+        scheduler.push(pAggregated);
+        pBatch->deadline = time(NULL) - 5;
+        pAggregated->deadline = time(NULL) - 10;
+        checkOrder("deadline", scheduler, {pAggregated, pBatch, pFinal});
+    }
+
+    // Every queue is sorted by deadline, requests without deadline last
+    {
+        ProverScheduler scheduler(schedulerConfig);
+        vector<uint64_t> maxWaits = {1000, 100, 0, 500};
+        vector<ProverRequest *> requests;
+        for (uint64_t i = 0; i < maxWaits.size(); i++)
+        {
+            schedulerConfig.schedulerMaxWait[prt_genBatchProof] = maxWaits[i];
+            requests.push_back(new ProverRequest(fr, config, prt_genBatchProof));
+            scheduler.push(requests.back());
+        }
+        schedulerConfig.schedulerMaxWait[prt_genBatchProof] = 0;
+        checkOrder("queue deadline", scheduler, {requests[1], requests[3], requests[0], requests[2]});
+    }
+
+    TimerStopAndLog(PROVER_SCHEDULER_TEST);
+
+    cout << "ProverSchedulerTest() done" << endl;
+}
@@ -0,0 +1,9 @@
+#ifndef PROVER_SCHEDULER_TEST_HPP
+#define PROVER_SCHEDULER_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+void ProverSchedulerTest (Goldilocks &fr, Config &config);
+
+#endif
@@ -0,0 +1,96 @@
+#include <random>
+#include <vector>
+#include "merkle_tree_gl_test.hpp"
+#include "merkleTreeGL.hpp"
+#include "timer.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+static bool equalElements (const Goldilocks::Element *a, const Goldilocks::Element *b, uint64_t size)
+{
+    for (uint64_t i = 0; i < size; i++)
+    {
+        if (Goldilocks::toU64(a[i]) != Goldilocks::toU64(b[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Check that a tree that keeps only its top levels has the same root and group proofs as the full tree, both when it is
+// merkelized at once and when its leaves are hashed by blocks, as the fused LDE path does
+void MerkleTreeGLTest (Goldilocks &fr, Config &config)
+{
+    TimerStart(MERKLE_TREE_GL_TEST);
+
+    mt19937_64 rng(0x4d65726b6c65ULL);
+    vector<uint64_t> heights = {1, 2, 8, 256, 1024};
+    vector<uint64_t> widths = {1, 4, 12, 37};
+
+    for (uint64_t h = 0; h < heights.size(); h++)
+    {
+        for (uint64_t w = 0; w < widths.size(); w++)
+        {
+            uint64_t height = heights[h];
+            uint64_t width = widths[w];
+
+            vector<Goldilocks::Element> source(height * width);
+            for (uint64_t i = 0; i < source.size(); i++)
+            {
+                source[i] = Goldilocks::fromU64(rng() % GOLDILOCKS_PRIME);
+            }
+
+            MerkleTreeGL fullTree(height, width, source.data());
+            fullTree.merkelize();
+            Goldilocks::Element fullRoot[HASH_SIZE];
+            fullTree.getRoot(fullRoot);
+
+            uint64_t proofSize = width + fullTree.MerkleProofSize() * HASH_SIZE;
+            vector<Goldilocks::Element> fullProof(proofSize);
+            vector<Goldilocks::Element> proof(proofSize);
+
+            uint64_t nLevels = fullTree.MerkleProofSize() + 1;
+            for (uint64_t nKeptLevels = 1; nKeptLevels <= nLevels; nKeptLevels++)
+            {
+                MerkleTreeGL tree(height, width, source.data(), nKeptLevels);
+                MerkleTreeGL blockTree(height, width, source.data(), nKeptLevels);
+
+                tree.merkelize();
+
+                uint64_t blockRows = max(blockTree.getSubtreeHeight(), height / 4);
+                for (uint64_t i = 0; i < height; i += blockRows)
+                {
+                    blockTree.hashLeaves(i, min(blockRows, height - i));
+                }
+                blockTree.merkelizeNodes();
+
+                Goldilocks::Element root[HASH_SIZE];
+                tree.getRoot(root);
+                Goldilocks::Element blockRoot[HASH_SIZE];
+                blockTree.getRoot(blockRoot);
+                if (!equalElements(root, fullRoot, HASH_SIZE) || !equalElements(blockRoot, fullRoot, HASH_SIZE))
+                {
+                    cerr << "Error: MerkleTreeGLTest() root differs from the full tree with height=" << height << " width=" << width << " nKeptLevels=" << nKeptLevels << endl;
+                    exitProcess();
+                }
+
+                for (uint64_t idx = 0; idx < height; idx += 1 + height / 64)
+                {
+                    fullTree.getGroupProof(fullProof.data(), idx);
+                    tree.getGroupProof(proof.data(), idx);
+                    if (!equalElements(proof.data(), fullProof.data(), proofSize))
+                    {
+                        cerr << "Error: MerkleTreeGLTest() getGroupProof() differs from the full tree with height=" << height << " width=" << width << " nKeptLevels=" << nKeptLevels << " idx=" << idx << endl;
+                        exitProcess();
+                    }
+                }
+            }
+        }
+    }
+
+    TimerStopAndLog(MERKLE_TREE_GL_TEST);
+
+    cout << "MerkleTreeGLTest() done" << endl;
+}
@@ -0,0 +1,9 @@
+#ifndef MERKLE_TREE_GL_TEST_HPP
+#define MERKLE_TREE_GL_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+void MerkleTreeGLTest (Goldilocks &fr, Config &config);
+
+#endif
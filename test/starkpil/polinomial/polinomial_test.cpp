@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <omp.h>
+#include "polinomial_test.hpp"
+#include "polinomial.hpp"
+#include "timer.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+// Sizes of the tested polinomials, including non power of 2 ones, and number of threads they are tested with
+static const vector<uint64_t> polinomialTestSizes = {1, 7, 1000, 1024, 3001, 1 << 14};
+static const vector<uint64_t> polinomialTestThreads = {1, 2, 3, 0}; // 0 means omp_get_max_threads()
+
+static bool equalPolinomials (Polinomial &a, Polinomial &b)
+{
+    for (uint64_t i = 0; i < a.degree(); i++)
+    {
+        for (uint64_t j = 0; j < a.dim(); j++)
+        {
+            if (Goldilocks::toU64(a[i][j]) != Goldilocks::toU64(b[i][j]))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Check that calculateH1H2_parallel() returns the same h1 and h2 as calculateH1H2()
+static void H1H2Test (mt19937_64 &rng, uint64_t maxThreads)
+{
+    for (uint64_t dim = 1; dim <= 3; dim += 2)
+    {
+        for (uint64_t s = 0; s < polinomialTestSizes.size(); s++)
+        {
+            uint64_t N = polinomialTestSizes[s];
+
+            // t has repeated values, and every f value is one of them
+            Polinomial tPol(N, dim);
+            Polinomial fPol(N, dim);
+            for (uint64_t i = 0; i < N; i++)
+            {
+                for (uint64_t j = 0; j < dim; j++)
+                {
+                    tPol[i][j] = Goldilocks::fromU64(rng() % (N / 2 + 1));
+                }
+            }
+            for (uint64_t i = 0; i < N; i++)
+            {
+                Polinomial::copyElement(fPol, i, tPol, rng() % N);
+            }
+
+            Polinomial h1(N, dim);
+            Polinomial h2(N, dim);
+            Polinomial::calculateH1H2(h1, h2, fPol, tPol);
+
+            uint64_t size = Polinomial::calculateH1H2_parallelBufferSize(N);
+            if (size > 6 * N)
+            {
+                cerr << "Error: PolinomialTest() calculateH1H2_parallelBufferSize(" << N << ")=" << size << " is greater than 6N" << endl;
+                exitProcess();
+            }
+            vector<uint64_t> buffer(size);
+
+            for (uint64_t t = 0; t < polinomialTestThreads.size(); t++)
+            {
+                uint64_t nThreads = (polinomialTestThreads[t] == 0) ? maxThreads : polinomialTestThreads[t];
+                omp_set_num_threads(nThreads);
+
+                Polinomial h1Parallel(N, dim);
+                Polinomial h2Parallel(N, dim);
+                Polinomial::calculateH1H2_parallel(h1Parallel, h2Parallel, fPol, tPol, 0, buffer.data(), size);
+                if (!equalPolinomials(h1, h1Parallel) || !equalPolinomials(h2, h2Parallel))
+                {
+                    cerr << "Error: PolinomialTest() calculateH1H2_parallel() differs from calculateH1H2() with N=" << N << " dim=" << dim << " threads=" << nThreads << endl;
+                    exitProcess();
+                }
+            }
+            omp_set_num_threads(maxThreads);
+        }
+    }
+}
+
+// Check that calculateZParallel() returns the same z as calculateZ()
+static void ZTest (mt19937_64 &rng, uint64_t maxThreads)
+{
+    for (uint64_t s = 0; s < polinomialTestSizes.size(); s++)
+    {
+        uint64_t N = polinomialTestSizes[s];
+
+        // den is a permutation of num, so that the product of num / den is 1
+        Polinomial num(N, 3);
+        Polinomial den(N, 3);
+        for (uint64_t i = 0; i < N; i++)
+        {
+            for (uint64_t j = 0; j < 3; j++)
+            {
+                num[i][j] = Goldilocks::fromU64(1 + rng() % (GOLDILOCKS_PRIME - 1));
+            }
+        }
+        vector<uint64_t> permutation(N);
+        for (uint64_t i = 0; i < N; i++)
+        {
+            permutation[i] = i;
+        }
+        shuffle(permutation.begin(), permutation.end(), rng);
+        for (uint64_t i = 0; i < N; i++)
+        {
+            Polinomial::copyElement(den, i, num, permutation[i]);
+        }
+
+        Polinomial z(N, 3);
+        Polinomial::calculateZ(z, num, den);
+
+        for (uint64_t t = 0; t < polinomialTestThreads.size(); t++)
+        {
+            uint64_t nThreads = (polinomialTestThreads[t] == 0) ? maxThreads : polinomialTestThreads[t];
+            omp_set_num_threads(nThreads);
+
+            Polinomial zParallel(N, 3);
+            Polinomial::calculateZParallel(zParallel, num, den);
+            if (!equalPolinomials(z, zParallel))
+            {
+                cerr << "Error: PolinomialTest() calculateZParallel() differs from calculateZ() with N=" << N << " threads=" << nThreads << endl;
+                exitProcess();
+            }
+        }
+        omp_set_num_threads(maxThreads);
+    }
+}
+
+void PolinomialTest (Goldilocks &fr, Config &config)
+{
+    TimerStart(POLINOMIAL_TEST);
+
+    mt19937_64 rng(0x506f6c696e6f6dULL);
+    uint64_t maxThreads = omp_get_max_threads();
+
+    H1H2Test(rng, maxThreads);
+    ZTest(rng, maxThreads);
+
+    TimerStopAndLog(POLINOMIAL_TEST);
+
+    cout << "PolinomialTest() done" << endl;
+}
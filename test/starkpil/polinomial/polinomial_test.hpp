@@ -0,0 +1,9 @@
+#ifndef POLINOMIAL_TEST_HPP
+#define POLINOMIAL_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+void PolinomialTest (Goldilocks &fr, Config &config);
+
+#endif
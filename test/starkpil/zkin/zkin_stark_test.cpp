@@ -0,0 +1,102 @@
+#include <random>
+#include <vector>
+#include <unistd.h>
+#include "zkin_stark_test.hpp"
+#include "proof2zkinStark.hpp"
+#include "timer.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+// Fills the signals of a zkevm or aggregation zkin with random values, with the same names and shapes as proof2zkinStark()
+static void fillZkin (ZkinStark &zkin, mt19937_64 &rng)
+{
+    const uint64_t nQueries = 8;
+    vector<pair<string, vector<uint64_t>>> signals = {
+        {"publics", {44}},
+        {"root1", {HASH_SIZE}}, {"root2", {HASH_SIZE}}, {"root3", {HASH_SIZE}}, {"root4", {HASH_SIZE}},
+        {"evals", {21, FIELD_EXTENSION}},
+        {"s0_vals1", {nQueries, 13}}, {"s0_vals3", {nQueries, 6}}, {"s0_vals4", {nQueries, 9}}, {"s0_valsC", {nQueries, 5}},
+        {"s0_siblings1", {nQueries, 7, HASH_SIZE}}, {"s0_siblings3", {nQueries, 7, HASH_SIZE}}, {"s0_siblings4", {nQueries, 7, HASH_SIZE}}, {"s0_siblingsC", {nQueries, 7, HASH_SIZE}},
+        {"s1_root", {HASH_SIZE}}, {"s2_root", {HASH_SIZE}}, {"s3_root", {HASH_SIZE}}, {"s4_root", {HASH_SIZE}},
+        {"s1_siblings", {nQueries, 5, HASH_SIZE}}, {"s2_siblings", {nQueries, 3, HASH_SIZE}}, {"s3_siblings", {nQueries, 2, HASH_SIZE}}, {"s4_siblings", {nQueries, 1, HASH_SIZE}},
+        {"s1_vals", {nQueries, 12}}, {"s2_vals", {nQueries, 12}}, {"s3_vals", {nQueries, 6}}, {"s4_vals", {nQueries, 6}},
+        {"finalPol", {4, FIELD_EXTENSION}},
+        {"scalar", {}}}; // Not used by joinzkin(), to check signals without dimensions
+
+    for (uint64_t s = 0; s < signals.size(); s++)
+    {
+        vector<uint64_t> &values = zkin.set(signals[s].first, signals[s].second);
+        for (uint64_t i = 0; i < values.size(); i++)
+        {
+            values[i] = rng() % GOLDILOCKS_PRIME;
+        }
+    }
+}
+
+static bool equalZkins (ZkinStark &a, ZkinStark &b)
+{
+    return (a.names == b.names) && (a.shapes == b.shapes) && (a.values == b.values);
+}
+
+void ZkinStarkTest (Goldilocks &fr, Config &config)
+{
+    TimerStart(ZKIN_STARK_TEST);
+
+    mt19937_64 rng(0x5a6b696eULL);
+    ZkinStark zkin1;
+    ZkinStark zkin2;
+    fillZkin(zkin1, rng);
+    fillZkin(zkin2, rng);
+
+    // toJson() and fromJson() round trip
+    ordered_json json1 = zkin1.toJson();
+    ZkinStark zkinJson;
+    zkinJson.fromJson(json1);
+    if (!equalZkins(zkin1, zkinJson))
+    {
+        cerr << "Error: ZkinStarkTest() fromJson(toJson()) differs from the original zkin" << endl;
+        exitProcess();
+    }
+
+    // save() and load() round trip, and load() of a missing or incomplete file
+    string fileName = config.outputPath + "/zkin_stark_test.zkin.bin";
+    zkin1.save(fileName);
+    ZkinStark zkinFile;
+    if (!zkinFile.load(fileName) || !equalZkins(zkin1, zkinFile))
+    {
+        cerr << "Error: ZkinStarkTest() load() of the saved zkin differs from the original zkin" << endl;
+        exitProcess();
+    }
+    if ((truncate(fileName.c_str(), 8 * 20) != 0) || zkinFile.load(fileName))
+    {
+        cerr << "Error: ZkinStarkTest() load() of an incomplete file did not fail" << endl;
+        exitProcess();
+    }
+    remove(fileName.c_str());
+    if (zkinFile.load(fileName))
+    {
+        cerr << "Error: ZkinStarkTest() load() of a missing file did not fail" << endl;
+        exitProcess();
+    }
+
+    // joinzkin() of the binary zkins generates the same json as joinzkin() of the json zkins
+    ordered_json verKey;
+    for (uint64_t i = 0; i < HASH_SIZE; i++)
+    {
+        verKey["constRoot"][i] = rng() % GOLDILOCKS_PRIME;
+    }
+    ordered_json json2 = zkin2.toJson();
+    ordered_json joinedJson = joinzkin(json1, json2, verKey);
+    ZkinStark joined;
+    joinzkin(zkin1, zkin2, verKey, joined);
+    if (joined.toJson().dump() != joinedJson.dump())
+    {
+        cerr << "Error: ZkinStarkTest() joinzkin() of the binary zkins differs from joinzkin() of the json zkins" << endl;
+        exitProcess();
+    }
+
+    TimerStopAndLog(ZKIN_STARK_TEST);
+
+    cout << "ZkinStarkTest() done" << endl;
+}
@@ -0,0 +1,9 @@
+#ifndef ZKIN_STARK_TEST_HPP
+#define ZKIN_STARK_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+void ZkinStarkTest (Goldilocks &fr, Config &config);
+
+#endif
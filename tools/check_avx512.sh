@@ -0,0 +1,43 @@
+#!/bin/bash
+
+# Checks that the only functions of a binary with AVX-512 instructions (zmm or mask registers) are the ones owned by its
+# *.avx512.cpp objects. An inline or template function used by both kinds of objects is emitted in all of them, and if
+# the linker keeps the copy compiled with -mavx512f, AVX2-only CPUs crash with SIGILL when any caller runs it.
+# usage: check_avx512.sh <binary> <objects...>
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 <binary> <objects...>"
+    exit 1
+fi
+
+export LC_ALL=C
+BINARY=$1
+shift
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf ${TMP_DIR}' EXIT
+
+# Functions defined by every kind of object
+for OBJECT in "$@"; do
+    case ${OBJECT} in
+        *.avx512.cpp.o) LIST=${TMP_DIR}/avx512 ;;
+        *) LIST=${TMP_DIR}/other ;;
+    esac
+    nm --defined-only ${OBJECT} | awk '$2 ~ /^[TtWw]$/ { print $3 }' >> ${LIST}
+done
+touch ${TMP_DIR}/avx512 ${TMP_DIR}/other
+sort -u -o ${TMP_DIR}/avx512 ${TMP_DIR}/avx512
+sort -u -o ${TMP_DIR}/other ${TMP_DIR}/other
+comm -23 ${TMP_DIR}/avx512 ${TMP_DIR}/other > ${TMP_DIR}/owned
+
+# Functions of the binary that use zmm or mask registers
+objdump -d --no-show-raw-insn ${BINARY} | awk '/^[0-9a-f]+ <.*>:$/ { f = substr($2, 2, length($2) - 3) } /%zmm|%k[0-7]/ { print f }' | sort -u > ${TMP_DIR}/used
+
+comm -23 ${TMP_DIR}/used ${TMP_DIR}/owned > ${TMP_DIR}/shared
+if [ -s ${TMP_DIR}/shared ]; then
+    echo "Error: $0 found AVX-512 instructions in functions shared with objects built without AVX-512:"
+    c++filt < ${TMP_DIR}/shared
+    exit 1
+fi
+
+echo "$0: $(wc -l < ${TMP_DIR}/used) functions of ${BINARY} use AVX-512 instructions, all of them owned by AVX-512 objects"
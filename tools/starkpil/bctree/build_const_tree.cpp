@@ -9,6 +9,7 @@
 #include <fstream>
 #include "timer.hpp"
 #include "merkleTreeBN128.hpp"
+#include "domainTables.hpp"
 #include <filesystem>
 #include <cstdint>
 
@@ -292,7 +293,7 @@ void interpolate (Goldilocks::Element* buffSrc, uint64_t nPols, uint64_t nBits,
     free(tmpBuff);
 }
 
-void buildConstTree(const string constFile, const string starkStructFile, const string constTreeFile, const string verKeyFile)
+void buildConstTree(const string constFile, const string starkStructFile, const string constTreeFile, const string verKeyFile, const string domainTablesFile)
 {
     TimerStart(BUILD_CONST_TREE);
 
@@ -391,5 +392,15 @@ void buildConstTree(const string constFile, const string starkStructFile, const
     }
 
     free(constPolsArrayE);
+
+    // Domain tables
+    if (domainTablesFile != "")
+    {
+        TimerStart(BUILD_DOMAIN_TABLES);
+        DomainTables::save(domainTablesFile, nBits, nBitsExt);
+        TimerStopAndLog(BUILD_DOMAIN_TABLES);
+        cout << time() << " Domain tables file generated correctly" << endl;
+    }
+
     TimerStopAndLog(BUILD_CONST_TREE);
 }
\ No newline at end of file
@@ -52,6 +52,7 @@ int main(int argc, char **argv)
     string starkStructFile = "";
     string constTreeFile = "";
     string verKeyFile = "";
+    string domainTablesFile = "";
 
     ArgumentParser aParser (argc, argv);
 
@@ -75,17 +76,21 @@ int main(int argc, char **argv)
             verKeyFile = aParser.getArgumentValue("-v","--verkey");
             if (verKeyFile=="") throw runtime_error("bctree: key ouput file not specified");
         }
+        if (aParser.argumentExists("-d","--domain")) {
+            domainTablesFile = aParser.getArgumentValue("-d","--domain");
+            if (domainTablesFile=="") throw runtime_error("bctree: domain tables ouput file not specified");
+        }
 
         showVersion();
 
-        buildConstTree(constFile, starkStructFile, constTreeFile, verKeyFile);
+        buildConstTree(constFile, starkStructFile, constTreeFile, verKeyFile, domainTablesFile);
         
         return EXIT_SUCCESS;
     } catch (const exception &e) {
         cerr << e.what() << endl;
         showVersion();
-        cerr << "usage: bctree <-c|--const> <const_file> <-s|--stark> <starkstruct_file> <-t|--tree> <consttree_file> [<-v|--verkey> <verkey_file>]" << endl;
-        cerr << "example: bctree -c zkevm.const -s zkevm.starkstruct.json -t zkevm.consttree -v zkevm.verkey" << endl;
+        cerr << "usage: bctree <-c|--const> <const_file> <-s|--stark> <starkstruct_file> <-t|--tree> <consttree_file> [<-v|--verkey> <verkey_file>] [<-d|--domain> <domain_file>]" << endl;
+        cerr << "example: bctree -c zkevm.const -s zkevm.starkstruct.json -t zkevm.consttree -v zkevm.verkey -d zkevm.domain" << endl;
         return EXIT_FAILURE;        
     }    
 }
\ No newline at end of file